@@ -0,0 +1,160 @@
+#include "AudioClock.h"
+#include "Util.h"
+
+volatile uint32_t AUDIO_CLOCK::s_block_time_us = 0;
+constexpr int AUDIO_CLOCK::BLOCK_DURATION_US;
+constexpr int AUDIO_CLOCK::OUTPUT_LATENCY_US;
+constexpr int AUDIO_CLOCK::DEADLINE_LOG_SIZE;
+
+std::array<volatile uint32_t, AUDIO_CLOCK::NUM_DEADLINE_CAUSES> AUDIO_CLOCK::s_deadline_counts = {};
+std::array<AUDIO_CLOCK::DEADLINE_EVENT, AUDIO_CLOCK::DEADLINE_LOG_SIZE> AUDIO_CLOCK::s_deadline_log = {};
+volatile uint32_t AUDIO_CLOCK::s_deadline_log_index   = 0;
+uint32_t AUDIO_CLOCK::s_deadline_log_printed          = 0;
+volatile uint8_t AUDIO_CLOCK::s_pattern               = 0;
+volatile uint8_t AUDIO_CLOCK::s_step                  = 0;
+
+namespace
+{
+  const char* const DEADLINE_CAUSE_NAMES[] = { "missed block", "overrun", "late trigger" };
+}
+
+AUDIO_CLOCK::AUDIO_CLOCK() :
+  AudioStream( 0, nullptr ),
+  m_block_callback( nullptr )
+{
+  // no connections, so make sure we still get updated
+  active = true;
+}
+
+void AUDIO_CLOCK::update()
+{
+#ifdef GOLDEN_AUDIO_TEST
+  // blocks exactly a block apart, so events land on the same samples every run
+  const uint32_t now_us = s_block_time_us + BLOCK_DURATION_US;
+#else
+  const uint32_t now_us = micros();
+#endif
+
+  // more than half a block late means at least one block was never rendered
+  const uint32_t since_last_block_us = now_us - s_block_time_us;
+  if( s_block_time_us != 0 && since_last_block_us > static_cast<uint32_t>( BLOCK_DURATION_US + ( BLOCK_DURATION_US / 2 ) ) )
+  {
+    log_deadline_miss( MISSED_BLOCK, ( since_last_block_us + ( BLOCK_DURATION_US / 2 ) ) / BLOCK_DURATION_US - 1 );
+  }
+
+  // the audio library's measure of the last update of the whole graph
+  if( AudioProcessorUsage() >= 100 )
+  {
+    log_deadline_miss( OVERRUN, 1 );
+  }
+
+  // callback first, so events are placed relative to the previous block (as they would be from loop())
+  if( m_block_callback != nullptr )
+  {
+    m_block_callback();
+  }
+
+#ifdef GOLDEN_AUDIO_TEST
+  s_block_time_us = now_us;
+#else
+  s_block_time_us = micros();
+#endif
+
+#ifdef INJECT_AUDIO_LOAD
+  // every so often take longer than a block, after the stamp so the next update starts late as well as
+  // this one overrunning (stalling before it would only move the stamp)
+  static uint32_t blocks = 0;
+  if( ++blocks % INJECTED_LOAD_INTERVAL_BLOCKS == 0 )
+  {
+    delayMicroseconds( INJECTED_LOAD_US );
+  }
+#endif
+}
+
+void AUDIO_CLOCK::set_block_callback( void (*block_callback)() )
+{
+  m_block_callback = block_callback;
+}
+
+int AUDIO_CLOCK::sample_offset( uint32_t time_us )
+{
+  const int32_t delta_us = static_cast<int32_t>( time_us - s_block_time_us );
+  if( delta_us <= 0 )
+  {
+    // event arrived before the last block started (e.g. loop() was late), play as soon as possible
+#ifdef CLOCK_IN_AUDIO_UPDATE
+    // clocked from loop() this is routine, it's only a missed deadline when the audio update runs the clock
+    log_deadline_miss( LATE_TRIGGER, 1 );
+#endif
+    return 0;
+  }
+
+  constexpr int32_t sample_rate = static_cast<int32_t>( AUDIO_SAMPLE_RATE_EXACT + 0.5f );
+  const int32_t offset          = ( min_val<int32_t>( delta_us, BLOCK_DURATION_US ) * sample_rate ) / 1000000;
+
+  return min_val<int32_t>( offset, AUDIO_BLOCK_SAMPLES - 1 );
+}
+
+void AUDIO_CLOCK::log_deadline_miss( DEADLINE_CAUSE cause, uint32_t count )
+{
+  // from the audio interrupt or loop()
+  __disable_irq();
+  s_deadline_counts[cause]      = s_deadline_counts[cause] + count;
+  DEADLINE_EVENT& event         = s_deadline_log[ s_deadline_log_index & ( DEADLINE_LOG_SIZE - 1 ) ];
+  s_deadline_log_index          = s_deadline_log_index + 1;
+  event.m_time_ms               = millis();
+  event.m_cause                 = cause;
+  event.m_count                 = min_val<uint32_t>( count, 255 );
+  event.m_pattern               = s_pattern;
+  event.m_step                  = s_step;
+  __enable_irq();
+}
+
+void AUDIO_CLOCK::set_position( int pattern, int step )
+{
+  s_pattern = pattern;
+  s_step    = step;
+}
+
+uint32_t AUDIO_CLOCK::deadline_misses( DEADLINE_CAUSE cause )
+{
+  return s_deadline_counts[cause];
+}
+
+uint32_t AUDIO_CLOCK::total_deadline_misses()
+{
+  uint32_t total = 0;
+  for( uint32_t count : s_deadline_counts )
+  {
+    total += count;
+  }
+  return total;
+}
+
+void AUDIO_CLOCK::print_deadline_log()
+{
+  const uint32_t log_index = s_deadline_log_index;
+  if( log_index - s_deadline_log_printed > static_cast<uint32_t>( DEADLINE_LOG_SIZE ) )
+  {
+    Serial.print( "Deadline misses not logged:" );
+    Serial.println( log_index - s_deadline_log_printed - DEADLINE_LOG_SIZE );
+    s_deadline_log_printed = log_index - DEADLINE_LOG_SIZE;
+  }
+
+  for( ; s_deadline_log_printed != log_index; ++s_deadline_log_printed )
+  {
+    __disable_irq();
+    const DEADLINE_EVENT event = s_deadline_log[ s_deadline_log_printed & ( DEADLINE_LOG_SIZE - 1 ) ];
+    __enable_irq();
+
+    Serial.print( event.m_time_ms );
+    Serial.print( "ms " );
+    Serial.print( DEADLINE_CAUSE_NAMES[event.m_cause] );
+    Serial.print( " x" );
+    Serial.print( event.m_count );
+    Serial.print( " pattern:" );
+    Serial.print( event.m_pattern + 1 );
+    Serial.print( " step:" );
+    Serial.println( event.m_step );
+  }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <array>
+#include <Audio.h>
+
+#include "CompileSwitches.h"
+
+////////////////////////////////////////////////////////////
+// timestamps the start of each audio block, so events timestamped in an ISR can be placed at the correct sample
+// NOTE: must be constructed before any other AudioStream so it is updated first
+class AUDIO_CLOCK : public AudioStream
+{
+public:
+
+  // ways the audio can miss its deadline
+  enum DEADLINE_CAUSE : uint8_t
+  {
+    MISSED_BLOCK,       // the update started more than a block late, so blocks were dropped
+    OVERRUN,            // the last update of the whole graph took longer than a block
+    LATE_TRIGGER,       // a trigger was played after the block it was due in (only counted with CLOCK_IN_AUDIO_UPDATE)
+    NUM_DEADLINE_CAUSES
+  };
+
+private:
+
+  // a deadline miss, with where the pattern was at the time
+  struct DEADLINE_EVENT
+  {
+    uint32_t                                              m_time_ms;
+    uint8_t                                               m_cause;
+    uint8_t                                               m_count;
+    uint8_t                                               m_pattern;
+    uint8_t                                               m_step;
+  };
+
+  static constexpr int DEADLINE_LOG_SIZE                  = 16;   // power of 2
+
+  static volatile uint32_t                                s_block_time_us;
+
+  static std::array<volatile uint32_t, NUM_DEADLINE_CAUSES> s_deadline_counts;
+  static std::array<DEADLINE_EVENT, DEADLINE_LOG_SIZE>    s_deadline_log;
+  static volatile uint32_t                                s_deadline_log_index;
+  static uint32_t                                         s_deadline_log_printed;
+  static volatile uint8_t                                 s_pattern;
+  static volatile uint8_t                                 s_step;
+
+  void                                                    (*m_block_callback)();
+
+  static void                                             log_deadline_miss( DEADLINE_CAUSE cause, uint32_t count );
+
+public:
+
+  static constexpr int BLOCK_DURATION_US                  = static_cast<int>( ( AUDIO_BLOCK_SAMPLES * 1000000.0f ) / AUDIO_SAMPLE_RATE_EXACT );
+  // from the start of a block's update to its first sample leaving the DAC. AudioOutputAnalog's DMA copies the
+  // block into the half of its buffer that has just played, which is heard after the other half
+  static constexpr int OUTPUT_LATENCY_US                  = BLOCK_DURATION_US * 2;
+#ifdef INJECT_AUDIO_LOAD
+  static constexpr int INJECTED_LOAD_INTERVAL_BLOCKS      = 512;  // about every 1.5 seconds
+  static constexpr int INJECTED_LOAD_US                   = BLOCK_DURATION_US * 2;
+#endif
+
+  AUDIO_CLOCK();
+  virtual void                                            update() override;
+
+  // called in the audio interrupt at the start of every block, before any other node is updated
+  void                                                    set_block_callback( void (*block_callback)() );
+
+  // sample offset within the next block to be rendered for an event at time_us (gives a fixed latency of one block)
+  static int                                              sample_offset( uint32_t time_us );
+
+  // when the block being rendered started, sample 0 of it is heard this far behind the events placed in it
+  static uint32_t                                         block_time_us()   { return s_block_time_us; }
+
+  // the pattern and step being played, recorded with any deadline miss
+  static void                                             set_position( int pattern, int step );
+
+  static uint32_t                                         deadline_misses( DEADLINE_CAUSE cause );
+  static uint32_t                                         total_deadline_misses();
+  static void                                             print_deadline_log();   // misses since the last call, from loop()
+};
@@ -0,0 +1,103 @@
+#include "AudioProfiler.h"
+
+constexpr int NODE_PROFILE::NUM_BUCKETS;
+constexpr uint32_t NODE_PROFILE::CYCLES_PER_BLOCK;
+
+NODE_PROFILE* NODE_PROFILE::s_first = nullptr;
+
+NODE_PROFILE::NODE_PROFILE( const char* name ) :
+  m_next(nullptr),
+  m_name(name),
+  m_instance(-1),
+  m_min_cycles(0),
+  m_max_cycles(0),
+  m_total_cycles(0),
+  m_updates(0),
+  m_histogram(),
+  m_max_blocks(0)
+{
+  reset();
+
+  // keep the list in construction order, the same as the audio library's update order
+  NODE_PROFILE** last = &s_first;
+  while( *last != nullptr )
+  {
+    last = &(*last)->m_next;
+  }
+  *last = this;
+}
+
+void NODE_PROFILE::set_name( const char* name, int instance )
+{
+  m_name      = name;
+  m_instance  = instance;
+}
+
+void NODE_PROFILE::reset()
+{
+  __disable_irq();
+  m_min_cycles    = UINT32_MAX;
+  m_max_cycles    = 0;
+  m_total_cycles  = 0;
+  m_updates       = 0;
+  m_histogram.fill( 0 );
+  m_max_blocks    = 0;
+  __enable_irq();
+}
+
+void NODE_PROFILE::print_all()
+{
+  Serial.print( "node\tname\tupdates\tmin\tavg\tmax\tmax %block\tmax blocks\thistogram (<1/128 block, doubling)" );
+  Serial.println();
+
+  int index = 0;
+  for( NODE_PROFILE* node = s_first; node != nullptr; node = node->m_next )
+  {
+    // the audio interrupt writes these
+    __disable_irq();
+    const NODE_PROFILE profile = *node;
+    __enable_irq();
+
+    Serial.print( index++ );
+    Serial.print( "\t" );
+    Serial.print( profile.m_name );
+    if( profile.m_instance >= 0 )
+    {
+      Serial.print( "." );
+      Serial.print( profile.m_instance );
+    }
+    Serial.print( "\t" );
+    Serial.print( profile.m_updates );
+    Serial.print( "\t" );
+    Serial.print( profile.m_updates > 0 ? profile.m_min_cycles : 0 );
+    Serial.print( "\t" );
+    Serial.print( profile.m_updates > 0 ? static_cast<uint32_t>( profile.m_total_cycles / profile.m_updates ) : 0 );
+    Serial.print( "\t" );
+    Serial.print( profile.m_max_cycles );
+    Serial.print( "\t" );
+    Serial.print( ( profile.m_max_cycles * 100.0f ) / CYCLES_PER_BLOCK );
+    Serial.print( "\t" );
+    Serial.print( profile.m_max_blocks );
+    for( uint32_t count : profile.m_histogram )
+    {
+      Serial.print( "\t" );
+      Serial.print( count );
+    }
+    Serial.println();
+  }
+
+  Serial.print( "Audio blocks in use:" );
+  Serial.print( AudioMemoryUsage() );
+  Serial.print( " peak:" );
+  Serial.println( AudioMemoryUsageMax() );
+}
+
+void NODE_PROFILE::reset_all()
+{
+  AudioMemoryUsageMaxReset();
+
+  for( NODE_PROFILE* node = s_first; node != nullptr; node = node->m_next )
+  {
+    node->reset();
+  }
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <array>
+#include <utility>
+#include <Audio.h>
+
+#include "CompileSwitches.h"
+#include "Util.h"
+
+/////////////////////////////////////////////////////////
+
+// the cycles spent in one node's update(), kept in a list of every profiled node in the order they were constructed
+// (which is the order the audio library updates them)
+class NODE_PROFILE
+{
+  static constexpr int  NUM_BUCKETS                                     = 8;    // under 1/128 of a block's time, doubling up to half a block and over
+  static constexpr uint32_t CYCLES_PER_BLOCK                            = static_cast<uint32_t>( ( F_CPU / AUDIO_SAMPLE_RATE_EXACT ) * AUDIO_BLOCK_SAMPLES );
+  static constexpr uint32_t CYCLES_PER_BUCKET                           = CYCLES_PER_BLOCK / 128;
+
+  static NODE_PROFILE*  s_first;
+  NODE_PROFILE*         m_next;
+
+  const char*           m_name;
+  int8_t                m_instance;         // printed after the name when several nodes share it, -1 for none
+  uint32_t              m_min_cycles;
+  uint32_t              m_max_cycles;
+  uint64_t              m_total_cycles;
+  uint32_t              m_updates;
+  std::array<uint32_t, NUM_BUCKETS> m_histogram;
+  int16_t               m_max_blocks;       // most audio blocks the node has held from the pool at once in one update()
+
+public:
+
+  explicit NODE_PROFILE( const char* name );
+
+  void                  set_name( const char* name, int instance = -1 );
+
+  // called from update(), just a few cycles
+  inline void           record( uint32_t cycles, int blocks )
+  {
+    m_max_blocks        = blocks > m_max_blocks ? blocks : m_max_blocks;
+    m_min_cycles        = cycles < m_min_cycles ? cycles : m_min_cycles;
+    m_max_cycles        = cycles > m_max_cycles ? cycles : m_max_cycles;
+    m_total_cycles     += cycles;
+    ++m_updates;
+
+    // each bucket is twice the cycles of the one before
+    const uint32_t fraction = cycles / CYCLES_PER_BUCKET;
+    const int bucket        = fraction == 0 ? 0 : min_val<int>( 32 - __builtin_clz( fraction ), NUM_BUCKETS - 1 );
+    ++m_histogram[bucket];
+  }
+
+  void                  reset();
+
+  static void           print_all();   // table of every node over Serial, from loop()
+  static void           reset_all();
+};
+
+/////////////////////////////////////////////////////////
+
+// wraps any AudioStream to profile its update(), e.g. PROFILED<AudioEffectFreeverb> reverb( "reverb" );
+template< typename NODE >
+class PROFILED : public NODE
+{
+  NODE_PROFILE          m_profile;
+
+public:
+
+  template< typename... ARGS >
+  explicit PROFILED( const char* name, ARGS&&... args ) :
+    NODE( std::forward<ARGS>( args )... ),
+    m_profile( name )
+  {
+  }
+
+  PROFILED() :
+    NODE(),
+    m_profile( "" )
+  {
+  }
+
+  NODE_PROFILE&         profile()       { return m_profile; }
+
+  virtual void          update() override
+  {
+    // the pool's peak within this update (blocks allocated and released again still count), keeping the overall peak
+    const uint16_t peak_blocks  = AudioStream::memory_used_max;
+    const int start_blocks      = AudioMemoryUsage();
+    AudioStream::memory_used_max = start_blocks;
+
+    const uint32_t start_cycles = ARM_DWT_CYCCNT;
+    NODE::update();
+    const uint32_t cycles       = ARM_DWT_CYCCNT - start_cycles;
+
+    const uint16_t update_peak  = AudioStream::memory_used_max;
+    AudioStream::memory_used_max = update_peak > peak_blocks ? update_peak : peak_blocks;
+    m_profile.record( cycles, update_peak - start_blocks );
+  }
+};
+
+// declares a node of the audio graph, profiled when PROFILE_AUDIO_NODES is defined
+#ifdef PROFILE_AUDIO_NODES
+#define AUDIO_NODE( type, name ) PROFILED<type> name( #name )
+#else
+#define AUDIO_NODE( type, name ) type name
+#endif
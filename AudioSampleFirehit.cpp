@@ -1,3110 +0,0 @@
-// Audio data converted from WAV file by wav2sketch
-
-#include "AudioSampleFirehit.h"
-
-// Converted from firehit.wav, using 44100 Hz, 16 bit PCM encoding
-const unsigned int AudioSampleFirehit[24833] = {
-0x8100C1CC,0x00230014,0x002A0029,0x002B0025,0x002C002B,0x00210028,0x001C001E,0x0027001E,
-0x002B0022,0x001C0021,0x001F0019,0x001D0024,0x00030014,0x001C0010,0x0042002F,0x00470051,
-0xFFD2002A,0xFF15FF82,0xFDBCFE77,0xFBF6FCD5,0xFA76FB24,0xF9DEF9FE,0xFAB9FA10,0xFD4DFBCD,
-0x00F7FF00,0x0560031B,0x0A2F07C2,0x0F370CB2,0x148811E0,0x1999172E,0x1E081BE9,0x20F71FBC,
-0x21F821C5,0x20702188,0x1C3B1EB3,0x15D01946,0x0E081213,0x05DD09F1,0xFE0201D0,0xF71BFA71,
-0xF168F41A,0xECD6EF03,0xE965EB04,0xE674E7E3,0xE3A1E503,0xE0E9E23A,0xDE8ADFA4,0xDCE7DDAE,
-0xDBF4DC5F,0xDBB8DBC3,0xDC1EDBD4,0xDCE8DC7C,0xDDA6DD55,0xDDEDDDE0,0xDD86DDCA,0xDD00DD48,
-0xDC85DCBA,0xDC2DDC43,0xDC3FDC1D,0xDCF1DC8F,0xDE68DDA1,0xE04ADF59,0xE258E154,0xE42BE34A,
-0xE5ABE4F1,0xE731E672,0xE8F5E80F,0xEB01E9E5,0xED80EC29,0xF08EEEFF,0xF3B8F21F,0xF6E6F55A,
-0xF9A2F856,0xFBF5FADE,0xFE01FD0F,0xFFF5FF02,0x0231010D,0x04C40368,0x07AE062C,0x0ADF0934,
-0x0E820CA1,0x133110AE,0x197F1621,0x21971D5C,0x2AE22628,0x34DA2FCA,0x3FFF3A33,0x4D334649,
-0x5C34549D,0x6B0B63D0,0x770E7199,0x7DB07B2F,0x7D7F7E8A,0x76287AB2,0x69177034,0x59716163,
-0x4A9A51BE,0x3EDB444C,0x36563A43,0x2F8232D8,0x286C2C16,0x1FE32466,0x15B31AF3,0x0AC21042,
-0x009B057D,0xF886FC4C,0xF2D2F55C,0xEECAF0AB,0xEB41ECFA,0xE73AE953,0xE270E4EA,0xDD58DFD3,
-0xD939DB0E,0xD714D7EA,0xD730D6DE,0xD935D804,0xDC12DA9E,0xDEA6DD70,0xE037DF8F,0xE0A9E094,
-0xE04EE093,0xDF95DFF3,0xDF08DF40,0xDF49DF09,0xE092DFD5,0xE26AE178,0xE404E349,0xE4A9E470,
-0xE446E494,0xE354E3DB,0xE240E2CF,0xE19BE1D8,0xE1BAE189,0xE2F6E239,0xE4FAE3E8,0xE71BE610,
-0xE905E814,0xEA55E9BA,0xEB49EAD3,0xEC72EBC6,0xEDEAED20,0xEFEFEEE1,0xF26AF11B,0xF4F0F3B7,
-0xF733F61C,0xF8E6F81B,0xFA17F98A,0xFAE8FA8A,0xFB93FB42,0xFC29FBE9,0xFCBBFC73,0xFD3BFD08,
-0xFDCBFD85,0xFE49FE07,0xFE9CFE6E,0xFEB4FEAB,0xFEB4FEB8,0xFE95FEB2,0xFE81FE86,0xFE2DFE5E,
-0xFE09FE0D,0xFE6DFE2F,0xFF5CFECC,0x00EE0015,0x029201C1,0x03EE0347,0x052A0491,0x061D05AB,
-0x0703069B,0x07FC0775,0x0970089F,0x0B8A0A6A,0x0DD50CAD,0x0F920EC0,0x109E1031,0x111F10EF,
-0x1196115D,0x128811FD,0x1435133D,0x16C81567,0x1A27186F,0x1DA91BE9,0x208B1F2E,0x223D219A,
-0x22622283,0x212721EF,0x1EC52020,0x1B9F1D40,0x181419DC,0x14571637,0x102A1250,0x0B260DC8,
-0x05100834,0xFE5E01B6,0xF806FB17,0xF2ECF545,0xEF97F106,0xEDDBEE7D,0xED37ED66,0xEC89ECF8,
-0xEB23EC00,0xE89AEA09,0xE543E6FE,0xE23DE3A2,0xE060E11E,0xE004DFFE,0xE0FBE061,0xE29FE1C0,
-0xE40FE367,0xE4EFE49D,0xE507E50F,0xE4BBE4E7,0xE47FE48E,0xE4EBE4A8,0xE64BE578,0xE8B2E76A,
-0xEBA9EA25,0xEECAED3E,0xF1D8F057,0xF4C6F34E,0xF7D3F64E,0xFAFFF967,0xFE4EFC9A,0x01A6FFFB,
-0x04CB034D,0x0791063E,0x09E508B7,0x0BF10AE9,0x0DB10CDA,0x0F210E7A,0x10240FB8,0x10B31071,
-0x114C110D,0x120411A6,0x13091280,0x144713A3,0x158114EF,0x166D1608,0x16311673,0x14901593,
-0x119D133E,0x0DCB0FBC,0x09DC0BC6,0x0690081B,0x0437053D,0x02EA0377,0x02570286,0x024B0247,
-0x02860265,0x02D602AD,0x03340308,0x03B3036E,0x0480040E,0x058A04FD,0x069E061B,0x078D0722,
-0x082807DA,0x08580853,0x08440858,0x07E90818,0x074E079F,0x068E06EA,0x06040638,0x05D005DD,
-0x061605E7,0x067C0642,0x06C706AF,0x06B606CE,0x05F20679,0x042D0535,0x01960301,0xFEB0001A,
-0xFBEAFD35,0xF9C2FAC2,0xF87DF8FA,0xF83DF838,0xF8F9F882,0xFA3AF986,0xFB8FFAE8,0xFCDAFC34,
-0xFE11FD7B,0xFF00FE8E,0xFF83FF4F,0xFF6CFF91,0xFECEFF2E,0xFD7CFE36,0xFBE3FCB0,0xFA40FB11,
-0xF8BCF97D,0xF753F809,0xF5EDF69A,0xF48CF531,0xF366F3F5,0xF272F2F0,0xF166F1EF,0xF021F0D3,
-0xEE5DEF4B,0xEC33ED43,0xEA00EB1C,0xE7EFE8EA,0xE682E720,0xE5FDE624,0xE628E5F8,0xE6BCE66A,
-0xE75BE715,0xE7A0E789,0xE7B1E7A7,0xE79EE7AC,0xE797E78A,0xE800E7BF,0xE8E1E85C,0xEA4FE98F,
-0xEC08EB27,0xEDECECF5,0xEFDEEEE4,0xF1BAF0D5,0xF35FF285,0xF4EEF426,0xF696F5AE,0xF8C0F799,
-0xFB57F9F4,0xFEBEFCF0,0x0298009E,0x06C304A6,0x0AEE08DC,0x0EE70CF5,0x12A110C8,0x162B1468,
-0x199917EC,0x1CFB1B5D,0x20601EB1,0x24022232,0x280A25EC,0x2DA22A87,0x36293172,0x41C83BBB,
-0x4DFE480C,0x579E5346,0x5C9D5AC1,0x5C285D0C,0x567859F0,0x4C4851D1,0x3FFE4638,0x341639DE,
-0x2A532EDD,0x22EC264D,0x1D431FEF,0x18181AB3,0x128C156A,0x0C3B0F79,0x05BA08F3,0xFFCF02A2,
-0xFB5FFD64,0xF8AEF9DB,0xF72BF7E7,0xF593F66D,0xF2C5F462,0xEE34F0B3,0xE87AEB6E,0xE2C3E590,
-0xDE37E051,0xDB78DCA1,0xDA54DABA,0xDA23DA26,0xDA0BDA1A,0xD96ED9D2,0xD815D8CC,0xD664D737,
-0xD566D5C5,0xD5CBD570,0xD79FD68F,0xDA54D8E7,0xDD2BDBCF,0xDF99DE71,0xE15CE08D,0xE284E200,
-0xE367E2FD,0xE472E3E0,0xE5F6E51F,0xE7D3E6D5,0xE9C9E8C9,0xEBB8EABE,0xED84EC93,0xEF8CEE7C,
-0xF194F095,0xF386F294,0xF53BF469,0xF6CDF600,0xF845F794,0xF988F8EB,0xFA8CFA10,0xFB87FB10,
-0xFCB7FC1D,0xFE2EFD71,0xFFBCFEF4,0x0146008A,0x02A001F8,0x03E4034C,0x05200483,0x066705CB,
-0x07B2070C,0x0971087F,0x0B8A0A7A,0x0DFB0CC2,0x10530F31,0x124A115A,0x13CA1320,0x1499143D,
-0x151714E7,0x15491531,0x154E1551,0x15541558,0x15451558,0x146F14F1,0x12B813B9,0x0FFF1179,
-0x0CB50E6D,0x096F0B05,0x06E5080D,0x05720604,0x04E3050E,0x04C304C2,0x046B049F,0x039003FD,
-0x01F902D7,0xFFFF00FB,0xFE08FEFA,0xFCD0FD4D,0xFC74FC83,0xFCB8FC8F,0xFD18FCE5,0xFD2BFD24,
-0xFCF9FD20,0xFC6EFCBC,0xFBA4FC0B,0xFAA2FB27,0xF980FA0F,0xF871F8F2,0xF79EF7F5,0xF71BF750,
-0xF6E8F703,0xF70CF6EE,0xF744F719,0xF780F75A,0xF7A6F79E,0xF77AF79D,0xF6D3F734,0xF5ECF66A,
-0xF4F0F572,0xF3E1F471,0xF2BBF352,0xF14BF203,0xEFC4F086,0xEE4AEEF2,0xED2FEDB1,0xECB5ECDC,
-0xECA8ECA4,0xED38ECEC,0xEE0EEDA1,0xEF03EE8A,0xF014EF8B,0xF133F0A3,0xF2ABF1E9,0xF472F37B,
-0xF687F578,0xF8D0F7AD,0xFB24F9F8,0xFD94FC5B,0x001EFECC,0x02910152,0x04EC03C6,0x06F305FF,
-0x087A07C8,0x098B0917,0x0A5109F7,0x0B380AB9,0x0C8F0BD7,0x0E490D67,0x100F0F2D,0x11EB10FC,
-0x13A412C7,0x158C148B,0x17E916AC,0x1B991995,0x20DB1E0D,0x27742405,0x2E932B0F,0x34F631F4,
-0x396F3778,0x3B663AC1,0x3AF33B7A,0x388C39ED,0x353436EE,0x318E336C,0x2DE92FB8,0x2A3D2C18,
-0x26692861,0x2207244B,0x1D211FA9,0x17E31A92,0x12A0153E,0x0DBB101A,0x09060B54,0x04AD06D6,
-0x005C0282,0xFBF4FE29,0xF785F9C5,0xF32DF558,0xEEFCF109,0xEB15ECF7,0xE79CE949,0xE49BE607,
-0xE244E35A,0xE08AE14D,0xDF62DFE3,0xDEB7DF00,0xDE5FDE84,0xDE34DE43,0xDE26DE20,0xDE4CDE26,
-0xDECEDE81,0xDFABDF37,0xE0DCE033,0xE277E1A0,0xE43AE34B,0xE652E535,0xE8BFE77F,0xEB75EA15,
-0xEE43ECE5,0xF0CDEF96,0xF2F5F1E6,0xF493F3CE,0xF5BEF535,0xF69BF630,0xF758F6FA,0xF84AF7C0,
-0xF9A2F8FB,0xFB5CFA79,0xFD11FC33,0xFE70FDD1,0xFF55FEEB,0xFFC9FF96,0xFFF9FFE6,0x0050000B,
-0x012400AE,0x024F01B0,0x039802F5,0x047C0418,0x04E604BC,0x04DB04E9,0x048504B7,0x04110456,
-0x03AD03E1,0x038E0398,0x03770388,0x030E0351,0x024602B5,0x017C01E0,0x00C1011B,0x00180071,
-0xFF7CFFC2,0xFECDFF23,0xFE28FE79,0xFD81FDE0,0xFCB5FD25,0xFBD6FC48,0xFADAFB5E,0xF9D9FA58,
-0xF91AF973,0xF8A5F8CE,0xF8A9F89B,0xF8FCF8C6,0xF9BDF953,0xFACEFA43,0xFBBBFB4C,0xFC9EFC32,
-0xFD65FD07,0xFE13FDBC,0xFEF7FE6C,0x0019FF87,0x014100A9,0x027301E3,0x035602F0,0x039E0390,
-0x0322037A,0x01C8028C,0xFFC000E3,0xFD65FE9A,0xFB21FC32,0xF981FA3D,0xF896F8F0,0xF835F85B,
-0xF82BF817,0xF827F82E,0xF82AF819,0xF87BF848,0xF942F8CE,0xFAD1F9EA,0xFD22FBD8,0x0004FE7A,
-0x031A017B,0x062D04AB,0x08C4078A,0x0A7209C0,0x0AF90ADA,0x0A7A0ADB,0x091C09E0,0x072A0838,
-0x04E1060E,0x028D03AF,0x0032015C,0xFDDFFF06,0xFBBBFCC5,0xF9FDFAC6,0xF8FCF95F,0xF8AFF8BF,
-0xF8F9F8C3,0xF9DEF95E,0xFB0EFA71,0xFC2BFBA0,0xFD26FCAF,0xFDE7FD97,0xFE96FE42,0xFF7DFEFC,
-0x00E60029,0x02E901D9,0x0585042C,0x086606F1,0x0B9109F3,0x0ED00D2C,0x1249108B,0x15CB1414,
-0x195C1798,0x1CC91B1F,0x1F961E53,0x216720A0,0x2272220A,0x22CE22BA,0x22A022CC,0x22212264,
-0x2100219E,0x1F7A2048,0x1D8C1E86,0x1B591C83,0x18AE1A1D,0x1576171F,0x120113C9,0x0E371021,
-0x0A430C47,0x05E10829,0x015F039A,0xFD31FF3C,0xF967FB3C,0xF5F0F79D,0xF291F442,0xEF25F0E5,
-0xEBEAED82,0xE926EA7A,0xE6D6E7F1,0xE516E5E0,0xE3A8E44C,0xE2A6E323,0xE1ABE232,0xE060E117,
-0xDE95DF86,0xDCB0DDA8,0xDADBDBB8,0xD965DA0F,0xD89AD8EC,0xD89FD883,0xD96AD8F2,0xDABCDA04,
-0xDC3CDB7E,0xDD91DCEA,0xDE94DE25,0xDF41DEF0,0xDFC3DF81,0xE041E003,0xE0F9E08E,0xE200E170,
-0xE366E2B0,0xE4CFE426,0xE622E586,0xE733E6BD,0xE7FEE7A3,0xE8CAE86A,0xE9BDE931,0xEB18EA61,
-0xECD4EBE7,0xEEDDEDD0,0xF0FAEFED,0xF328F215,0xF54CF434,0xF731F645,0xF908F826,0xFACEF9E9,
-0xFCA4FBBA,0xFE91FD95,0x00D3FFB2,0x03520204,0x05F804A1,0x08CB0765,0x0BEB0A5A,0x0F3B0D86,
-0x12E01101,0x170314E4,0x1BA21941,0x209B1E0D,0x2614235C,0x2BE728F0,0x32332EF6,0x398735A7,
-0x42123DAF,0x4B4346B0,0x533A4F94,0x582A562E,0x58F25919,0x556D57B5,0x4E705241,0x45C74A28,
-0x3D6D4171,0x368B39BB,0x317133D4,0x2D462F54,0x28CF2B2F,0x2306261A,0x1BF11F9D,0x1416180D,
-0x0C9D1032,0x06920963,0x02630444,0xFFE000FE,0xFE26FEF8,0xFC84FD59,0xFA4BFB7F,0xF75EF8E7,
-0xF3CDF598,0xF07EF20F,0xEDCDEEFD,0xEBF5ECC5,0xEA96EB3E,0xE95BEA06,0xE7E8E8A8,0xE5F2E704,
-0xE377E4B8,0xE11DE23E,0xDF59E027,0xDEA5DEDB,0xDF10DEB9,0xE058DFA0,0xE1FEE128,0xE357E2B4,
-0xE40FE3C9,0xE436E435,0xE424E436,0xE44CE42B,0xE512E4A4,0xE651E59D,0xE7E8E716,0xE957E8A6,
-0xEA90E9FE,0xEB6EEB00,0xEC2DEBD0,0xED06EC89,0xEE69EDA3,0xF06AEF53,0xF2E2F1A1,0xF5A1F446,
-0xF842F701,0xFA81F971,0xFC50FB82,0xFDDAFD24,0xFF4EFE9E,0x01170028,0x0368022D,0x061D04C0,
-0x08B1076E,0x0ADB09D8,0x0C630BAE,0x0D8D0CFF,0x0E9B0E0F,0x0FDC0F34,0x119210A3,0x13F912BB,
-0x17161568,0x1ADC18EB,0x1EB41CC3,0x221D2077,0x2469236C,0x24FD24F6,0x23992489,0x2077223E,
-0x1C001E55,0x173B1997,0x129F14D9,0x0E9E1091,0x0AFD0CC9,0x079A094B,0x043A05F0,0x00EA0291,
-0xFDECFF62,0xFB60FC90,0xF975FA56,0xF825F8C0,0xF73BF7A6,0xF6BBF6F0,0xF661F689,0xF62FF63E,
-0xF642F632,0xF6A6F66D,0xF72BF6E4,0xF7D7F781,0xF8B0F83A,0xF975F91C,0xFA0FF9C9,0xFA46FA43,
-0xF9F6FA2E,0xF933F9A7,0xF80AF8A7,0xF687F757,0xF4FFF5C0,0xF3ABF450,0xF2B4F328,0xF1FEF25B,
-0xF133F19C,0xF074F0D2,0xEF89EFFE,0xEE6DEEFE,0xED39EDCD,0xEC16ECA8,0xEB16EB90,0xEA8CEAC3,
-0xEA6DEA73,0xEA9BEA88,0xEAF4EAC2,0xEB47EB1A,0xEB50EB52,0xEB41EB4D,0xEB22EB2C,0xEB12EB1A,
-0xEB57EB23,0xEBF6EB9A,0xECD1EC5E,0xEDCCED3F,0xEE9AEE35,0xEF50EEF1,0xEFFFEFA9,0xF0CDF068,
-0xF1D5F148,0xF349F284,0xF512F42D,0xF71DF617,0xF93EF828,0xFB87FA5E,0xFDEEFCB6,0x0085FF2C,
-0x032501D1,0x05C70473,0x08830726,0x0B3809E2,0x0DE30C86,0x10770F36,0x12F711C0,0x15421421,
-0x1733164B,0x185B17E2,0x18FC18C5,0x19291921,0x18FF1920,0x188618C6,0x17C11828,0x17121757,
-0x16D916E6,0x172416EF,0x17C4176B,0x186C181A,0x18C318A3,0x189B18C4,0x17C11849,0x1638170B,
-0x142D153A,0x12041316,0x100510FE,0x0E4C0F25,0x0C900D76,0x0AA60BA1,0x089F099D,0x0657077F,
-0x043C0543,0x023B032F,0x006A0144,0xFEFEFFAD,0xFDE1FE6D,0xFCDEFD66,0xFBB9FC50,0xFA74FB10,
-0xF93DF9CF,0xF85CF8C1,0xF7D2F808,0xF79DF7B1,0xF776F78C,0xF736F75A,0xF695F6EE,0xF58DF61F,
-0xF455F4EF,0xF358F3CD,0xF29EF2FB,0xF24FF26E,0xF235F235,0xF235F228,0xF247F23A,0xF27CF263,
-0xF2B8F2A2,0xF318F2EE,0xF3BEF35E,0xF4B8F43B,0xF5F0F54D,0xF775F6B2,0xF918F847,0xFAB0F9DD,
-0xFC35FB7C,0xFD7AFCDF,0xFE7DFE03,0xFF1EFEE2,0xFF79FF59,0xFFA6FF8E,0xFFEAFFC1,0x0040000D,
-0x00BE0072,0x01850115,0x027701F4,0x039702FF,0x04CF042F,0x05F80561,0x07210685,0x083D07A8,
-0x096008C8,0x0A8909E5,0x0BC80B1D,0x0D280C74,0x0EF20DFD,0x11070FEB,0x1375122F,0x15F814B5,
-0x18571724,0x1A19193E,0x1B011AA6,0x1AC51B04,0x19891A51,0x178B18AB,0x14E41650,0x11BD1366,
-0x0E721016,0x0B470CD3,0x087B09D2,0x06330749,0x047E0544,0x035103D7,0x02B702F4,0x025F0287,
-0x024A0243,0x02790262,0x02F002AA,0x03B00351,0x045F0414,0x04B504A7,0x044A0495,0x031203C4,
-0x0109021E,0xFE57FFC6,0xFB58FCD4,0xF855F9CB,0xF574F6E7,0xF28EF3F3,0xEFF3F134,0xEDB8EECB,
-0xEBE0ECBF,0xEA88EB27,0xE982EA09,0xE89FE920,0xE7B5E837,0xE6C3E742,0xE5C1E64B,0xE4ABE543,
-0xE3A4E422,0xE2F4E355,0xE2A2E2C0,0xE2A2E29B,0xE2EAE2C0,0xE36DE320,0xE417E3BC,0xE4E9E47D,
-0xE5C6E555,0xE6C2E63C,0xE7D9E751,0xE929E876,0xEAC8EA00,0xEC6AEB92,0xEE1CED3F,0xEFA7EEE4,
-0xF0FDF055,0xF234F19E,0xF323F2B4,0xF41AF38E,0xF52FF496,0xF6EBF5FF,0xF927F7F7,0xFBB3FA63,
-0xFE5BFD07,0x00C7FF9E,0x02F801E5,0x050803F7,0x07330619,0x09A10869,0x0C7D0B01,0x0F810DF8,
-0x12761106,0x14C113C2,0x16111597,0x16471644,0x159A1609,0x14641509,0x134B13CC,0x12B912E9,
-0x12ED12C1,0x13941332,0x145713F2,0x150E14BA,0x159C1553,0x162315E3,0x16DC1679,0x17C91744,
-0x18D0183D,0x1A0F1979,0x1AEE1A89,0x1B831B4C,0x1B811B94,0x1AF31B49,0x19B11A6A,0x17BC18D2,
-0x14F31675,0x117A134B,0x0DF60FB6,0x0A960C42,0x0796090C,0x04C00624,0x02190361,0xFF8200D8,
-0xFD17FE45,0xFAA8FBDE,0xF86CF989,0xF657F762,0xF481F562,0xF2F2F3B2,0xF174F23A,0xF01CF0BE,
-0xEED4EF78,0xEDB2EE40,0xECDAED30,0xEC14EC70,0xEB71EBB4,0xEAC1EB0F,0xEA22EA70,0xE9D5E9FA,
-0xE9D8E9D5,0xEA57EA11,0xEB38EAC5,0xEC32EBAB,0xED39ECB9,0xEE35EDB7,0xEF5CEEC5,0xF0AEF000,
-0xF238F166,0xF3CDF2F8,0xF54DF48B,0xF67DF5E4,0xF760F6FF,0xF801F7B8,0xF88DF844,0xF915F8D7,
-0xF9A5F951,0xFA10F9EA,0xFA28FA2C,0xFA0CFA2A,0xF9E9F9F8,0xF9D1F9DD,0xF9D7F9CC,0xFA11F9ED,
-0xFA81FA3F,0xFB03FABF,0xFB74FB3F,0xFBFCFBB8,0xFCB6FC4C,0xFD9CFD27,0xFEE7FE3C,0x0079FFA8,
-0x02140143,0x03A602DE,0x055D047D,0x070E0638,0x08D507E7,0x0AA209BD,0x0C510B80,0x0DDE0D13,
-0x0F570E9D,0x10780FF9,0x113510EA,0x11961172,0x11D011B8,0x121211F0,0x12A51255,0x13CD1328,
-0x1588149E,0x17A2168E,0x19BE18B4,0x1B731AB3,0x1C5D1C05,0x1C5F1C81,0x1B721BFE,0x19CE1AA8,
-0x17C818D9,0x15CB16C7,0x13D614C9,0x11DD12DE,0x0FCB10DD,0x0D730E9E,0x0B000C44,0x085D09B8,
-0x05C40712,0x0336047C,0x00FB0205,0xFF300010,0xFD83FE61,0xFBA5FC9E,0xF955FA8B,0xF6AAF801,
-0xF406F556,0xF1AEF2C5,0xEFCFF0AA,0xEEADEF2E,0xEE27EE59,0xEE25EE17,0xEE2FEE2B,0xEE08EE1C,
-0xEDB7EDDC,0xED65ED8E,0xED43ED52,0xED75ED51,0xEE21EDBD,0xEF60EEC2,0xF109F031,0xF2EEF1FA,
-0xF4E4F3F3,0xF69EF5D0,0xF815F75F,0xF952F8C3,0xFA69F9DC,0xFB9EFB03,0xFD01FC44,0xFEC8FDDA,
-0x00D7FFCE,0x032A0202,0x05A4046B,0x07EF06DA,0x09DB08F5,0x0B780AB1,0x0CAC0C1F,0x0DB50D34,
-0x0EA80E3B,0x0F450F03,0x0F8D0F77,0x0F3A0F74,0x0E510ECD,0x0CE90DA1,0x0B220C15,0x09190A1D,
-0x06C107F8,0x044D058B,0x01F30324,0xFFB100C8,0xFDE9FEC3,0xFC92FD2F,0xFBBDFC21,0xFB56FB7D,
-0xFB49FB3B,0xFB91FB5F,0xFC1DFBCE,0xFCEBFC7B,0xFDD5FD62,0xFEC3FE5B,0xFF82FF2C,0x001CFFDA,
-0x00A50066,0x015E0100,0x023C01C9,0x033F02B7,0x041D03A9,0x04AF046E,0x04E804D4,0x04FF04FB,
-0x05030502,0x051E050E,0x0577053E,0x062005C1,0x0713068F,0x08180797,0x08FD0892,0x09BC0954,
-0x0A3609FB,0x0A970A73,0x0ADB0ABC,0x0B110AFB,0x0B5B0B2E,0x0BBF0B8F,0x0C3B0BFB,0x0C970C6F,
-0x0CAB0CAE,0x0C5A0C8C,0x0B590BF1,0x09D90AAE,0x07FB08F1,0x05C906E5,0x0375049F,0x0119023C,
-0xFED8FFEC,0xFCDDFDD0,0xFB0BFBE7,0xF98BFA40,0xF818F8D4,0xF6BEF763,0xF570F612,0xF41CF4C1,
-0xF2CDF372,0xF1A0F239,0xF0ADF120,0xEFDCF044,0xEF5BEF99,0xEEE7EF2D,0xEE63EEAF,0xEDBFEE0F,
-0xECFBED64,0xEC4CECAA,0xEBCAEC07,0xEB81EBA4,0xEB8BEB82,0xEBD7EBAF,0xEC65EC25,0xECEDECB1,
-0xED32ED13,0xED41ED49,0xECF8ED24,0xEC81ECBD,0xEBE8EC30,0xEB7DEBAB,0xEB66EB57,0xEBDEEB96,
-0xECA6EC35,0xEDB4ED2F,0xEEC9EE3D,0xEFD6EF52,0xF0BDF04A,0xF188F12A,0xF243F1EC,0xF30EF2A9,
-0xF404F390,0xF53BF48E,0xF6ADF5F1,0xF839F766,0xF9E5F912,0xFB5CFAAB,0xFCB9FC0D,0xFDB9FD39,
-0xFE4BFE0F,0xFECEFE91,0xFF56FF09,0x000AFF9C,0x00FB0076,0x020A0183,0x032C02A5,0x047A03C6,
-0x05B2050F,0x071E065F,0x089707DB,0x0A08094A,0x0B7E0AC0,0x0CAC0C1A,0x0D770D1F,0x0DF40DB8,
-0x0E2F0E15,0x0E3B0E38,0x0E1F0E33,0x0E3D0E25,0x0EA30E61,0x0F580EF9,0x10130FBF,0x106F104E,
-0x100D1054,0x0F1D0FAC,0x0D7C0E67,0x0B780C84,0x096D0A72,0x07AC087F,0x065006F2,0x053305BF,
-0x043704BC,0x02FC039D,0x01C80261,0x00B60133,0xFFD30037,0xFF74FF9B,0xFF6CFF64,0xFFAFFF88,
-0x001EFFEC,0x0092005D,0x00E400BD,0x011400FB,0x0140012E,0x01670153,0x0196017E,0x01C501B3,
-0x020E01DB,0x027B023B,0x02F502B1,0x03890340,0x040D03C9,0x0490044F,0x050904D3,0x05890535,
-0x062F05D8,0x07140693,0x0831079B,0x096008C7,0x0A7C09F5,0x0B530AEF,0x0C020BB2,0x0CAD0C53,
-0x0DB50D2D,0x0F1F0E5F,0x11471026,0x13EE128B,0x16D31555,0x1981183C,0x1BA11AA5,0x1CE91C65,
-0x1D271D27,0x1C451CDE,0x1A611B76,0x17951916,0x143615F8,0x106A1258,0x0C9B0E87,0x08A20A9C,
-0x04910699,0x00650281,0xFC37FE4E,0xF84AFA3C,0xF4F0F67F,0xF242F389,0xF017F116,0xEE3FEF20,
-0xEC7EED69,0xEAB0EB9A,0xE920E9F1,0xE79EE854,0xE69BE70F,0xE621E654,0xE637E61E,0xE69FE664,
-0xE737E6E4,0xE7FEE79F,0xE8B5E862,0xE995E91E,0xEAAFEA1B,0xEC23EB64,0xEDF2ECFA,0xF006EEF0,
-0xF23DF122,0xF449F353,0xF5E9F534,0xF703F688,0xF792F765,0xF7BBF7B3,0xF7F0F7CD,0xF85AF816,
-0xF918F8AF,0xF9FCF989,0xFADDFA67,0xFBA7FB40,0xFC21FBE8,0xFC69FC40,0xFCBBFC8A,0xFD45FCF4,
-0xFE59FDBA,0xFFD8FF0C,0x018A00AF,0x03220261,0x048703DC,0x0595052B,0x06370609,0x068C0662,
-0x06920683,0x0678068C,0x065D066E,0x061B0643,0x05BA05EF,0x04F2055D,0x03E5046F,0x02AB034B,
-0x016B0206,0x006A00E5,0xFFCF0015,0xFFB7FFB0,0xFFF5FFCF,0x006F002F,0x010C00B9,0x01D60166,
-0x0317025A,0x051A03FD,0x07FA066B,0x0BA409BD,0x0FFB0DC2,0x146D123B,0x189D1697,0x1C321A79,
-0x1EFC1DB0,0x20E32009,0x21FA2188,0x223C2230,0x21C82217,0x20CE2161,0x1F272010,0x1D041E25,
-0x1A7F1BCE,0x17741900,0x13FB15CE,0x1023121C,0x0BFD0E14,0x07D009E8,0x03DA05CF,0x0038020B,
-0xFCDBFE7F,0xF9C5FB4A,0xF6F2F84D,0xF46FF597,0xF22FF33E,0xF055F137,0xEED1EF89,0xED98EE28,
-0xEC82ED10,0xEB7CEBF9,0xEA87EB08,0xE9C1EA21,0xE926E96B,0xE8E4E905,0xE8C4E8C9,0xE8ADE8B8,
-0xE87DE895,0xE852E864,0xE7F3E825,0xE7B1E7CA,0xE78EE7A4,0xE7A9E796,0xE80EE7D1,0xE8C5E85E,
-0xE9B6E933,0xEAE5EA40,0xEC27EB8A,0xED75ECCB,0xEEB7EE15,0xEFD4EF45,0xF108F06B,0xF242F1A7,
-0xF3B7F2F5,0xF578F491,0xF774F676,0xF990F884,0xFBCCFAB7,0xFE23FCF9,0x0048FF40,0x0202012C,
-0x033B02AB,0x041703C6,0x04A9046B,0x053404F3,0x05BA0575,0x066105F9,0x071C06AF,0x07C30770,
-0x08570816,0x08D00891,0x093B090C,0x09B70966,0x0A780A11,0x0B500AD1,0x0C740BDC,0x0DD50D1E,
-0x0F4E0E8B,0x10DB1016,0x124111A3,0x134F12D5,0x13E513BD,0x139213D7,0x12601309,0x10781175,
-0x0E370F5E,0x0BC10CF0,0x09710A8C,0x0754085C,0x05770662,0x03A80490,0x020702DB,0x00920143,
-0xFF48FFE5,0xFE44FEAF,0xFD66FDDC,0xFCB4FD14,0xFBFCFC53,0xFB5BFBA8,0xFAB5FAFC,0xFA37FA6D,
-0xF9A6F9E6,0xF8F4F940,0xF85BF8AA,0xF7EEF820,0xF7B3F7C1,0xF7BCF7B1,0xF7ECF7C5,0xF843F81A,
-0xF88EF86E,0xF8E4F8C8,0xF92BF902,0xF95CF946,0xF990F973,0xF9E9F9B6,0xFA63FA25,0xFB0FFAB6,
-0xFBAAFB57,0xFC2BFBF6,0xFC75FC53,0xFC44FC74,0xFBB2FC11,0xFAE2FB56,0xFA0FFA7C,0xF96FF9AE,
-0xF944F950,0xF98DF957,0xFA3EF9E0,0xFB4FFACF,0xFC6CFBDB,0xFD8EFCF9,0xFEA9FE10,0xFF8EFF1F,
-0x003DFFEF,0x00D9008F,0x01890133,0x023001D6,0x02C6027B,0x031802F5,0x03040321,0x027A02C3,
-0x0193020E,0x008F010D,0xFF980009,0xFEF3FF2F,0xFE93FEB5,0xFE85FE88,0xFEDAFEA3,0xFF6CFF18,
-0x0048FFCF,0x016B00D6,0x02E60225,0x04A803BF,0x069305A3,0x08970789,0x0A8F0991,0x0C5B0B80,
-0x0E140D3E,0x0F9A0EDF,0x1103104D,0x124311A3,0x135012C7,0x140113B5,0x1413141C,0x136713D2,
-0x11FE12CA,0x0FFB1100,0x0DC70EE0,0x0B7E0CA0,0x095C0A67,0x0727083F,0x04F00604,0x02BE03D7,
-0x00A701A5,0xFEEBFFBA,0xFD9BFE38,0xFCEDFD32,0xFCABFCC0,0xFCD8FCB6,0xFD3BFCFF,0xFDB0FD6C,
-0xFE29FDE6,0xFECCFE85,0xFF2CFF04,0xFF60FF51,0xFF64FF63,0xFF5DFF5E,0xFF51FF5A,0xFF47FF49,
-0xFF17FF39,0xFE5EFECA,0xFD23FDD3,0xFB62FC53,0xF93CFA56,0xF6FFF817,0xF4F8F5F7,0xF337F406,
-0xF1B8F266,0xF071F10E,0xEF52EFD6,0xEE70EEDC,0xEDD5EE1D,0xED7AED9D,0xED7AED67,0xEDD1ED9C,
-0xEE72EE18,0xEF31EEC1,0xF03CEFA9,0xF17BF0D3,0xF321F245,0xF511F416,0xF71DF60E,0xF946F829,
-0xFB71FA60,0xFD84FC80,0xFF59FE7D,0x00E60033,0x0227018B,0x0315029C,0x03DC0376,0x04B80447,
-0x05BF0534,0x0708065E,0x088F07D5,0x0A5B096D,0x0C3E0B47,0x0E3D0D40,0x10180F2C,0x1203111C,
-0x1418130D,0x1682153E,0x193317D7,0x1BB31A87,0x1DB91CC8,0x1E631E40,0x1D9A1E2D,0x1B701CAC,
-0x182719DC,0x14971660,0x114F12DF,0x0EC70FF5,0x0D180DD0,0x0C080C85,0x0B4B0BB3,0x0A580AD3,
-0x08F009A4,0x0713080E,0x04E90608,0x028E03CA,0x00540166,0xFE6DFF56,0xFCC9FD8F,0xFB4DFC02,
-0xF9BCFA8A,0xF7E7F8DE,0xF5F4F6F0,0xF3C1F4D9,0xF1B6F2B1,0xEFD9F0C6,0xEE5FEF15,0xED5FEDDC,
-0xEC9BECF4,0xEC0FEC52,0xEB83EBC5,0xEAE6EB2B,0xEA72EAA2,0xEA3DEA54,0xEA55EA39,0xEACDEA86,
-0xEBA1EB33,0xEC8FEC21,0xED9AED1C,0xEEA2EE27,0xEF7AEF12,0xF020EFD5,0xF080F054,0xF0E2F0AD,
-0xF152F121,0xF1EDF1A9,0xF2A8F244,0xF39DF31A,0xF480F40B,0xF57DF506,0xF66BF5F9,0xF73FF6E1,
-0xF7EEF79D,0xF889F837,0xF922F8D9,0xF9D6F978,0xFA9EFA35,0xFB64FB02,0xFC2BFBCB,0xFCDEFC86,
-0xFD5AFD1D,0xFDB9FD86,0xFE0FFDE6,0xFE72FE3A,0xFF01FEB3,0xFFBAFF52,0x00840023,0x016600EC,
-0x025101E2,0x035802D3,0x047703E6,0x05A40509,0x06E70641,0x083B078D,0x09AA08F5,0x0B1F0A5C,
-0x0CA20BE0,0x0E370D6F,0x10170F23,0x12431123,0x14E9138D,0x17E81651,0x1B1B1980,0x1E281CA7,
-0x20A31F7F,0x22342185,0x22D3229F,0x228822CD,0x218C222A,0x200C20D7,0x1E3A1F2C,0x1C541D4E,
-0x1A611B5F,0x181C1945,0x158116D9,0x128313FE,0x0F5F10F3,0x0C2E0DC5,0x09040A90,0x060B0788,
-0x0336049E,0x008901E8,0xFE01FF40,0xFB95FCCC,0xF922FA5D,0xF6DAF7F5,0xF4C6F5CB,0xF2F2F3C8,
-0xF17FF22A,0xF05DF0DA,0xEF62EFD8,0xEE88EEEB,0xEDA4EE1D,0xEC9CED28,0xEB8DEC0F,0xEAA1EB11,
-0xE9E9EA45,0xE962E9A7,0xE916E93B,0xE8AEE8E1,0xE843E87A,0xE7CFE80D,0xE756E792,0xE709E71F,
-0xE6ECE6EA,0xE751E70A,0xE80FE79C,0xE92EE886,0xEAA7E9E5,0xEC52EB81,0xEE06ED33,0xEFC4EEE9,
-0xF17FF0A1,0xF32FF251,0xF4CDF3F8,0xF66DF59F,0xF846F752,0xFA4FF93F,0xFCB5FB7C,0xFF48FDF7,
-0x020C009E,0x04F40375,0x07D10653,0x0A6A091C,0x0CE00BA8,0x0EEF0DEF,0x10A60FD1,0x122F117A,
-0x137612E4,0x14BA142A,0x15DE1553,0x16FC166D,0x18151783,0x194418AC,0x1A3819BE,0x1B121AAC,
-0x1BC01B71,0x1C301BFE,0x1C5A1C52,0x1C151C56,0x1B771BD8,0x1A731B00,0x190919C1,0x1754183C,
-0x1565165A,0x13471460,0x10D81211,0x0E300F85,0x0B4C0CC0,0x084A09D2,0x058206DE,0x02FE0439,
-0x00E001E5,0xFF11FFF2,0xFD72FE3F,0xFBC5FCA7,0xFA0EFAF1,0xF841F92D,0xF668F74F,0xF4B2F593,
-0xF31CF3EE,0xF1B8F264,0xF085F118,0xEF8BEFF9,0xEECCEF28,0xEE4FEE83,0xEE27EE36,0xEE1DEE22,
-0xEE35EE27,0xEE5FEE4B,0xEEA7EE82,0xEEFCEED4,0xEF7FEF37,0xF00EEFB6,0xF0C6F06E,0xF19CF130,
-0xF299F214,0xF3CBF32B,0xF537F478,0xF6EEF612,0xF8D4F7E0,0xFA9EF9B9,0xFC2BFB67,0xFD77FCDD,
-0xFE72FDFF,0xFF0BFECB,0xFF65FF42,0xFF7BFF79,0xFF36FF60,0xFE8EFEE9,0xFD94FE21,0xFC77FD06,
-0xFB58FBE1,0xFA3FFAC3,0xF942F9BD,0xF856F8C4,0xF789F7EE,0xF6DDF732,0xF642F68A,0xF5C3F5F9,
-0xF55FF590,0xF51EF535,0xF4DEF4FC,0xF4CAF4C9,0xF4CDF4C8,0xF4C4F4C4,0xF4D1F4CB,0xF4F8F4DB,
-0xF548F521,0xF5C9F58C,0xF685F624,0xF769F6EA,0xF87BF7E9,0xF9A9F90B,0xFAEFFA46,0xFC81FBB2,
-0xFE2FFD4A,0x0024FF2C,0x0249012F,0x047E036F,0x069D059A,0x088707A0,0x0A550974,0x0C190B32,
-0x0DDA0CF4,0x0FA00EBF,0x11591084,0x12E7121E,0x145213A6,0x15A114F5,0x17051652,0x186F17BB,
-0x19CE191F,0x1AFE1A70,0x1BDA1B7B,0x1C1C1C12,0x1B981BEF,0x1A911B24,0x191219D5,0x175D1839,
-0x15B5168F,0x141014DB,0x12761341,0x10D611AB,0x0F190FFD,0x0D1E0E25,0x0AF00C00,0x08A609C2,
-0x06820795,0x0486058A,0x02B3039B,0x011A01F0,0xFF6E003D,0xFD9CFE87,0xFBB4FCA0,0xF9ABFAAB,
-0xF7A6F89D,0xF5FDF6CB,0xF495F54C,0xF366F3F2,0xF260F2DF,0xF136F1D1,0xEFE7F096,0xEE88EF3F,
-0xED21EDD2,0xEBF8EC87,0xEB15EB84,0xEAABEAE0,0xEA9CEA99,0xEAD1EAAB,0xEB42EB07,0xEB98EB69,
-0xEBCDEBBC,0xEBE7EBD2,0xEC00EBF3,0xEC6EEC30,0xED2AECC2,0xEE37EDA3,0xEF9DEEDC,0xF128F05C,
-0xF29BF1E8,0xF3DCF33B,0xF4C1F45B,0xF5A1F53A,0xF67AF602,0xF78EF702,0xF8EAF83F,0xFA8EF9B9,
-0xFC84FB7F,0xFE7DFD87,0x0082FF80,0x02560170,0x03E70324,0x05360491,0x066D05D5,0x07B70711,
-0x09000862,0x0A6709B8,0x0BAB0B14,0x0C7D0C2A,0x0C9F0CA5,0x0BEE0C63,0x0A850B4F,0x08ED09AD,
-0x076C081F,0x064B06C9,0x059905D6,0x05400567,0x05020520,0x04AC04E0,0x041C0468,0x038403DD,
-0x02F0033D,0x029902C3,0x0292028B,0x02EF02B5,0x03790330,0x03F103B4,0x0427040E,0x04040421,
-0x036B03C1,0x02920307,0x01B00227,0x00C70136,0x00070060,0xFF7AFFBD,0xFEFBFF2F,0xFE8AFEC1,
-0xFE33FE58,0xFDF4FE1F,0xFDDCFDEA,0xFE3BFDFD,0xFEF1FE80,0x0020FF73,0x01A600D5,0x036A0282,
-0x0550045C,0x074F064E,0x093E0843,0x0AFD0A26,0x0CBD0BDE,0x0E650DA1,0x0FBE0F19,0x10DC104F,
-0x11951143,0x11D611C0,0x11C211CD,0x1164119F,0x10DB112F,0x1028107E,0x0F440FB4,0x0E1C0EB8,
-0x0CCB0D74,0x0B7D0C25,0x0A2A0AD2,0x08DB0985,0x078A0834,0x063306E7,0x04C3057E,0x033F040A,
-0x01C50284,0x0054010D,0xFF0EFFBA,0xFDCFFE74,0xFCC1FD44,0xFBA2FC35,0xFAAFFB29,0xF9EBFA4F,
-0xF94AF988,0xF8FDF91A,0xF8BCF8D4,0xF88DF89F,0xF82DF863,0xF7C3F805,0xF761F795,0xF715F73A,
-0xF6F6F705,0xF6DDF6DD,0xF6CBF6D1,0xF6F3F6DB,0xF743F718,0xF7BDF779,0xF87AF811,0xF973F8EC,
-0xFA83F9F2,0xFBCAFB1D,0xFD56FC9C,0xFF14FE3A,0x00F90013,0x02DF01E9,0x049703D1,0x05E2054D,
-0x06B6065D,0x070906EE,0x06F506FF,0x06B806E3,0x067B069A,0x06100644,0x056805CC,0x04840503,
-0x031E03E6,0x0180024F,0xFFBE0096,0xFE0BFED2,0xFCBEFD4F,0xFBE7FC44,0xFB66FB9A,0xFB15FB3E,
-0xFAEFFB01,0xFAA7FACC,0xFA4DFA81,0xF9D9FA15,0xF986F9AA,0xF955F96B,0xF954F946,0xF92BF940,
-0xF8DEF907,0xF835F894,0xF70AF7B7,0xF57EF64A,0xF3BBF4A4,0xF225F2E9,0xF0F8F184,0xF046F08E,
-0xEFFBF010,0xEFF6EFFA,0xF012F003,0xF03BF029,0xF06CF059,0xF0B6F087,0xF140F0EF,0xF218F19F,
-0xF366F2AF,0xF527F43E,0xF71BF60E,0xF928F824,0xFB2BFA2F,0xFCFFFC29,0xFEA6FDE2,0x000AFF67,
-0x014700B1,0x027001DF,0x038A02FF,0x04900407,0x055804F4,0x060D05B6,0x06970657,0x06F706CE,
-0x0719070D,0x07070709,0x06D206EF,0x068706B2,0x062E065F,0x05CD060C,0x055A0593,0x04C50516,
-0x04090474,0x034C03AB,0x029102ED,0x01E30234,0x01470191,0x00D00111,0x006F0097,0xFFFA0039,
-0xFFB9FFD7,0xFF7AFF9D,0xFF73FF72,0xFFC0FF99,0x0069000B,0x014B00DA,0x027601E6,0x03A00311,
-0x04930420,0x055604F8,0x05B2058E,0x05BD05BF,0x058F05A5,0x05550574,0x05070523,0x04C904E6,
-0x047A04A7,0x041E044E,0x03B003E8,0x035C0382,0x03370343,0x037D034B,0x043D03D5,0x057004C6,
-0x07160630,0x08FD0804,0x0AF009FA,0x0CB10BD8,0x0E3B0D87,0x0F840EF2,0x10841013,0x111910DC,
-0x11391136,0x10C3111D,0x0FFD107A,0x0EA20F5B,0x0D460E03,0x0BAB0C7D,0x0A3C0AF8,0x08E00984,
-0x07AE084B,0x0687071B,0x056B05FC,0x042404CB,0x02BF0370,0x011401EB,0xFF2D002B,0xFD30FE27,
-0xFB24FC2C,0xF948FA36,0xF798F869,0xF63AF6DF,0xF50BF5A4,0xF421F49A,0xF35EF3BC,0xF2BCF313,
-0xF22CF26B,0xF1B5F1F7,0xF15CF184,0xF101F13E,0xF0AAF0D4,0xF075F090,0xF046F057,0xF027F030,
-0xF01DF017,0xF057F030,0xF0BFF085,0xF134F0FB,0xF1D5F17F,0xF29CF236,0xF37CF307,0xF493F403,
-0xF5D9F535,0xF74CF692,0xF8DAF80A,0xFA73F9A6,0xFC19FB47,0xFDCCFCF3,0xFF91FEAC,0x0150006A,
-0x031B0231,0x04C103EF,0x06310584,0x074D06C7,0x081207B9,0x0882085F,0x08AE08A1,0x089308AD,
-0x08640889,0x07F2082C,0x078A07BC,0x0728075A,0x06E406F9,0x06C406C8,0x06C706BD,0x06EF06D0,
-0x075A071F,0x082507B0,0x093C08AD,0x0AB509F4,0x0C800B8B,0x0E600D6E,0x10040F42,0x112E10A3,
-0x11B01182,0x118611B1,0x10AE112F,0x0F541010,0x0DD00EA2,0x0C2F0D03,0x0AA30B66,0x08F609CB,
-0x0720080C,0x04FD0614,0x029403DA,0xFFD80141,0xFCFBFE73,0xFA07FB77,0xF754F898,0xF50BF619,
-0xF350F41E,0xF21BF2AD,0xF11CF193,0xF03DF0AE,0xEF5CEFCC,0xEE7CEEE6,0xEDC2EE07,0xED91ED98,
-0xEDECEDB6,0xEEEBEE57,0xF054EF93,0xF1D7F111,0xF34BF295,0xF472F3E2,0xF534F4DD,0xF5D1F58B,
-0xF675F628,0xF74DF6D2,0xF88EF7E1,0xFA25F954,0xFBE1FB07,0xFD94FCC4,0xFED9FE44,0xFFB6FF52,
-0x0044FFFF,0x00A90076,0x012100E1,0x01EA0173,0x02DE0258,0x03BE0352,0x043E0403,0x04540461,
-0x03ED042B,0x033F03A4,0x028602E1,0x01FA023E,0x01BF01D0,0x01D901C6,0x02220201,0x026B0247,
-0x02920280,0x0279028C,0x0218024F,0x019901E0,0x0133016B,0x00EA010B,0x00B000C7,0x00A400AF,
-0x008A008D,0x0058006E,0x0027003D,0x00120014,0x00230019,0x00A80056,0x017A0103,0x027201EE,
-0x036D02F4,0x042303D2,0x04610448,0x04370455,0x038003E2,0x029A0318,0x019A0221,0x008A0115,
-0xFF6BFFFB,0xFE5FFEE4,0xFD6BFDD7,0xFC9FFD04,0xFBF0FC43,0xFB79FBA6,0xFB33FB54,0xFB04FB11,
-0xFB02FAFA,0xFB0FFB05,0xFB2CFB0E,0xFB3AFB2E,0xFB65FB4E,0xFB86FB79,0xFB8EFB8B,0xFBA1FB9E,
-0xFB9DFBA3,0xFBBCFBAD,0xFBF3FBD5,0xFC46FC1D,0xFCB7FC7E,0xFD3DFCFA,0xFD8DFD68,0xFDCAFDB0,
-0xFE01FDE9,0xFE27FE0A,0xFE60FE38,0xFED7FE8D,0xFF6CFF17,0x0018FFC6,0x00C80073,0x015A0119,
-0x01B0018C,0x020201E2,0x02520223,0x02A30271,0x02F602C7,0x03460327,0x035D0357,0x03440359,
-0x02F90321,0x029302CB,0x021D0262,0x01D301F3,0x01A501B3,0x01A7019B,0x01BC01AA,0x020201E5,
-0x02440220,0x02680263,0x024F0267,0x02350242,0x021D021B,0x020A020A,0x022B0216,0x026E0242,
-0x02B40290,0x02E802CE,0x02D902EB,0x02C502DA,0x02AA02AA,0x02B002A7,0x030A02CB,0x038E0349,
-0x042803D2,0x04CA046F,0x05540510,0x05CA059A,0x06110604,0x06540635,0x06650668,0x0669065C,
-0x067D0663,0x068B067C,0x06CC069F,0x071106EE,0x07680740,0x07920787,0x077B079B,0x06EB0745,
-0x05E6067D,0x04870541,0x02D103AC,0x011801EB,0xFF600041,0xFDCFFE94,0xFC46FD0A,0xFAE2FB89,
-0xF961FA1D,0xF80DF8B8,0xF6CAF765,0xF5CFF63F,0xF536F571,0xF52AF515,0xF59EF54F,0xF65DF5EF,
-0xF776F6E7,0xF8BBF81C,0xFA15F96A,0xFB93FACB,0xFD5FFC7C,0xFF80FE65,0x020000AE,0x04E7036A,
-0x07EA066D,0x0AE50969,0x0D880C3E,0x0FBE0EAB,0x1177109D,0x12C5121E,0x13D2134E,0x148D1440,
-0x14C614B3,0x146114AE,0x133513E5,0x1153125E,0x0EBD1016,0x0BBA0D41,0x08B90A40,0x05CE0739,
-0x033E047A,0x01150219,0xFF51002E,0xFDC7FE7E,0xFCA3FD31,0xFBABFC18,0xFAE9FB49,0xFA4CFA8F,
-0xF9DCFA0C,0xF969F99F,0xF901F939,0xF89DF8CD,0xF863F877,0xF81BF83A,0xF7D4F7F4,0xF786F7A5,
-0xF71AF753,0xF6C8F6EA,0xF688F6A1,0xF662F673,0xF653F649,0xF66EF651,0xF692F67E,0xF6D9F6B3,
-0xF743F70C,0xF7EAF78B,0xF8C8F848,0xF9DFF948,0xFB14FA74,0xFC33FBA6,0xFD3CFCBD,0xFE0AFDAE,
-0xFEBDFE6B,0xFF38FF05,0xFF6DFF50,0xFF82FF81,0xFF97FF90,0xFFA3FF98,0xFFCDFFB4,0x001BFFF1,
-0x0097004F,0x014500F6,0x01D1018C,0x026A0227,0x030202C3,0x039E034F,0x046C0406,0x058504E6,
-0x06D00624,0x08350786,0x097A08DA,0x0A7F0A0B,0x0AFF0AD3,0x0ADF0AFD,0x0A1E0A93,0x0901099A,
-0x078E0852,0x062B06E1,0x04D00578,0x03A0042F,0x0293031C,0x0197020C,0x00840113,0xFF55FFF4,
-0xFE10FEB7,0xFCD2FD6F,0xFBB7FC3B,0xFAC7FB31,0xFA09FA65,0xF953F9B1,0xF8D0F915,0xF850F887,
-0xF7F4F819,0xF7B2F7D0,0xF79AF7A9,0xF78AF790,0xF78BF783,0xF799F794,0xF7BCF7A1,0xF7ECF7CD,
-0xF85AF81C,0xF8E0F890,0xF98AF927,0xFA46F9E7,0xFB1CFAB1,0xFC13FB91,0xFD29FCA2,0xFE57FDC6,
-0xFF9CFEFA,0x00E4004E,0x021D0180,0x033F02B1,0x047B03D1,0x05BD0519,0x0724067A,0x089807E6,
-0x0A02095A,0x0B3E0AB1,0x0C3D0BC8,0x0CC90C8E,0x0D060CF9,0x0CA60CE5,0x0BC40C3E,0x0A530B14,
-0x08710964,0x06330754,0x03CE0501,0x017B02A9,0xFF13004A,0xFCC1FDE4,0xFA79FBA0,0xF85BF957,
-0xF678F753,0xF4DCF59D,0xF3B6F441,0xF2FCF34E,0xF26DF2B3,0xF1F2F22B,0xF16DF1B3,0xF0D7F128,
-0xF053F092,0xF007F033,0xEFEEEFFB,0xF003EFF4,0xF00CF00B,0xF01AF015,0xEFFEF014,0xEFBBEFEA,
-0xEF76EF99,0xEF2FEF52,0xEF1FEF1F,0xEF8CEF44,0xF030EFCF,0xF128F09F,0xF23FF1A9,0xF35EF2D7,
-0xF47FF3EF,0xF581F504,0xF686F610,0xF797F70E,0xF8D5F82C,0xFA31F97B,0xFBB4FAED,0xFD33FC75,
-0xFE9AFDED,0xFFD0FF39,0x00C7004F,0x01880123,0x01FD01C3,0x02660230,0x02F902AE,0x039B033E,
-0x046503FB,0x055C04E1,0x065C05DB,0x077B06F3,0x08C10822,0x0A1A0967,0x0B9B0ACC,0x0D6C0C79,
-0x0F7F0E5D,0x120710B5,0x14E3136E,0x17D81656,0x1AB01952,0x1CF51BE3,0x1E691DD3,0x1EAE1EA9,
-0x1DDE1E74,0x1C091D15,0x197C1AD3,0x168C1815,0x137414F7,0x109B11FF,0x0DFB0F40,0x0BAD0CC6,
-0x099B0A9F,0x07DB08AE,0x06470705,0x04F40595,0x03B60448,0x02AA0332,0x0169020F,0x000F00CB,
-0xFE7BFF45,0xFCEAFDBA,0xFB62FC2B,0xFA12FAB6,0xF901F984,0xF839F89B,0xF790F7DA,0xF6DBF737,
-0xF628F676,0xF563F5C8,0xF487F4FE,0xF3BBF422,0xF32AF370,0xF2DDF2FA,0xF2D3F2D3,0xF310F2F3,
-0xF387F342,0xF427F3D5,0xF4BDF471,0xF55FF512,0xF5F8F59F,0xF68FF64E,0xF73CF6DB,0xF81BF7A9,
-0xF921F896,0xFA5BF9B5,0xFBADFAFD,0xFCEEFC48,0xFE19FD86,0xFF27FEB0,0x0019FF9E,0x00E90082,
-0x0193013F,0x021901DF,0x026D024B,0x029E0290,0x02C702B0,0x02DB02C1,0x02DC02E3,0x02CC02D6,
-0x029002BF,0x02060254,0x012C0196,0x002100A4,0xFF29FF98,0xFE57FEBA,0xFE00FE1A,0xFE1BFDFE,
-0xFEADFE4B,0xFF87FF02,0x0070FFFC,0x017400E8,0x029101FC,0x03B50325,0x04F9044D,0x064B05A4,
-0x07A106EF,0x08FF085E,0x0A3509A3,0x0AF80AA5,0x0B6A0B45,0x0B600B70,0x0B080B36,0x0AA10AD6,
-0x0A380A67,0x0A120A26,0x0A260A16,0x0A690A52,0x0A660A76,0x09F60A3B,0x0909098B,0x07B4086F,
-0x060B06E1,0x044C0532,0x0290036C,0x010C01BD,0xFFAB0058,0xFE7FFF19,0xFD49FDF0,0xFBFAFCA6,
-0xFA94FB49,0xF8F5F9C6,0xF74EF825,0xF5D7F693,0xF4A7F536,0xF3E0F438,0xF372F3A5,0xF32DF346,
-0xF2FBF31C,0xF2A4F2D4,0xF246F271,0xF1D7F212,0xF193F1AD,0xF18BF180,0xF1A9F192,0xF1EBF1C2,
-0xF24BF211,0xF291F269,0xF2D6F2B7,0xF30EF2F4,0xF329F31A,0xF34BF339,0xF36FF359,0xF3C8F396,
-0xF43CF3FD,0xF508F496,0xF5F6F584,0xF6E7F66F,0xF7EDF774,0xF8ECF86C,0xF9F6F96F,0xFB2EFA8E,
-0xFC91FBD9,0xFE3DFD6A,0x0004FF1E,0x01E50104,0x03BE02DB,0x056D0499,0x06F6062D,0x087107AE,
-0x09EF092C,0x0B6E0AA9,0x0CF80C2E,0x0E640DAE,0x0FAA0F0A,0x10E7104B,0x121C1180,0x136512B6,
-0x14E01412,0x167615A1,0x183E175D,0x1A041928,0x1B7F1AD3,0x1C821C0D,0x1CDA1CBB,0x1C631CB9,
-0x1B331BE0,0x19641A52,0x17371853,0x14C215FD,0x12421379,0x0FC91104,0x0D5A0E8E,0x0AEE0C25,
-0x087609AD,0x061B0746,0x04070506,0x02390319,0x00C10178,0xFF6D000D,0xFE29FED1,0xFCCCFD7E,
-0xFB56FC0F,0xFA00FAA9,0xF8CBF95B,0xF7E3F84C,0xF758F794,0xF704F72A,0xF6C2F6E6,0xF66FF69F,
-0xF5E5F630,0xF537F58E,0xF482F4DB,0xF3F7F438,0xF390F3BC,0xF374F378,0xF38DF37B,0xF3E5F3BA,
-0xF443F40F,0xF48DF469,0xF4BAF4A5,0xF4B4F4B9,0xF4A9F4B2,0xF495F49C,0xF4A6F497,0xF4D5F4B8,
-0xF53BF508,0xF5C1F577,0xF65CF606,0xF70FF6A9,0xF7DCF778,0xF8C5F853,0xF9FAF95B,0xFB63FAAF,
-0xFD01FC2B,0xFE9AFDCF,0xFFFEFF4B,0x010E0091,0x01B60169,0x01F001DC,0x01B101DE,0x01370181,
-0x007100DB,0xFF7A0000,0xFE37FEE1,0xFCD4FD82,0xFB34FC15,0xF9C2FA84,0xF858F90D,0xF70DF7AD,
-0xF644F6A5,0xF5AAF5F4,0xF572F583,0xF58DF572,0xF5FBF5BE,0xF6B2F650,0xF7BAF726,0xF8F9F84C,
-0xFA9DF9BE,0xFC6DFB78,0xFE6BFD65,0x007EFF78,0x025E0170,0x041A033E,0x05AE04E1,0x06EA0650,
-0x0823078D,0x093208AB,0x0A3B09B5,0x0B180AAC,0x0BD60B76,0x0C7D0C31,0x0CE30CB7,0x0D140D0E,
-0x0D1C0D0F,0x0CEB0CFE,0x0CBD0CCA,0x0CAB0CB5,0x0CA00CAA,0x0CA30CAF,0x0C940C9E,0x0C610C88,
-0x0BF30C31,0x0B640BB1,0x0AB50B0C,0x09FA0A57,0x094B099E,0x088608F2,0x07B20822,0x06CD0747,
-0x05BB064C,0x0496052A,0x0376040A,0x027602F3,0x018301FD,0x00980108,0xFFC3002C,0xFECDFF49,
-0xFDFAFE6A,0xFD1BFD8F,0xFC38FCA3,0xFB7AFBD2,0xFAD6FB1E,0xFA58FA99,0xFA0EFA2E,0xF9E7F9F5,
-0xF9DFF9E8,0xF9ADF9CE,0xF990F9A1,0xF93EF961,0xF903F91D,0xF8C8F8E5,0xF8A3F8BA,0xF867F88C,
-0xF801F836,0xF760F7C5,0xF688F6F9,0xF595F60E,0xF4A2F51A,0xF401F440,0xF3C9F3D3,0xF423F3E2,
-0xF4EAF466,0xF628F57C,0xF7A4F6E1,0xF922F864,0xFA8BF9D7,0xFBFFFB48,0xFD78FCBB,0xFF03FE3C,
-0x00ADFFC8,0x027B0198,0x046A0377,0x062C0547,0x07B106F9,0x08FF085A,0x09F6097E,0x0AB60A60,
-0x0B360AFD,0x0B7D0B64,0x0B9D0B94,0x0B9E0BA7,0x0B8A0B96,0x0B750B7E,0x0B560B65,0x0AF70B2B,
-0x0A650ABB,0x098C0A07,0x0880090A,0x073A07EE,0x0606069A,0x04EA056F,0x03F60477,0x03150383,
-0x02080293,0x00D9017A,0xFF7F0032,0xFE02FEBF,0xFC66FD30,0xFAEFFBA2,0xF990FA43,0xF83EF8E2,
-0xF701F799,0xF5C8F660,0xF4C0F53E,0xF3DFF455,0xF32EF380,0xF2AEF2E8,0xF26BF287,0xF255F252,
-0xF241F250,0xF220F231,0xF205F217,0xF1E1F1F1,0xF1C7F1D2,0xF1A1F1B5,0xF19EF19A,0xF1AFF19C,
-0xF1D8F1C3,0xF238F20A,0xF2A0F26A,0xF328F2DF,0xF3D2F385,0xF473F41D,0xF54EF4DD,0xF651F5CC,
-0xF797F6E9,0xF92FF863,0xFACBFA01,0xFC53FB8E,0xFD9DFCFC,0xFEA9FE1F,0xFF64FF07,0x0025FFC7,
-0x00CC007F,0x0153010F,0x01C9018F,0x021001F3,0x01FE0214,0x01D501EE,0x018C01B3,0x014F0164,
-0x0160014F,0x01C7018B,0x0276020F,0x037A02E8,0x04A0040B,0x05BE0535,0x06B1063C,0x07730724,
-0x07F507BE,0x086C0830,0x08B30893,0x091208D6,0x098E0954,0x0A1909D2,0x0AB10A6C,0x0B1F0AE5,
-0x0B350B31,0x0AFF0B2C,0x0A720AC7,0x09A50A15,0x08C10933,0x07B10838,0x06C40739,0x0604065A,
-0x055C05A0,0x04FD0534,0x04BC04E1,0x048004A6,0x04380461,0x03D20403,0x036D039D,0x03230338,
-0x032D031B,0x038A0350,0x041703C4,0x04B0046A,0x053804F2,0x057C0564,0x05860585,0x05660580,
-0x05460559,0x054C054A,0x052D0542,0x04F70517,0x047304BE,0x03BF042A,0x02A80334,0x016B0208,
-0x001500C2,0xFEB6FF6A,0xFD63FE09,0xFC3DFCC3,0xFB3AFBB6,0xFA61FAC4,0xF9D2FA17,0xF95AF98B,
-0xF921F93E,0xF91DF91A,0xF952F939,0xF98EF96B,0xF9EBF9BC,0xFA21FA02,0xFA2AFA22,0xFA01FA21,
-0xF9CAF9F0,0xF979F9A5,0xF911F948,0xF8C0F8E6,0xF87EF896,0xF841F861,0xF810F82D,0xF7FCF80D,
-0xF81EF80B,0xF884F851,0xF94FF8D8,0xFA88F9E4,0xFC25FB4B,0xFE32FD13,0x0085FF57,0x030601C2,
-0x058E044A,0x07FC06D0,0x0A410923,0x0C750B6A,0x0E910D89,0x10810F8C,0x121C115E,0x135412C7,
-0x13DE13AB,0x13D013EB,0x12E4136C,0x117A1244,0x0FAE109F,0x0DAE0EAB,0x0BAA0CAA,0x09E20AC1,
-0x082308F7,0x06930763,0x051505D7,0x03B00461,0x024402F9,0x010401A4,0xFFD60065,0xFECEFF50,
-0xFDECFE5D,0xFD2CFD86,0xFC71FCC6,0xFBC6FC1C,0xFB31FB77,0xFA9CFAE5,0xFA0DFA4B,0xF998F9C9,
-0xF929F95A,0xF8BFF8E7,0xF872F895,0xF844F861,0xF834F83B,0xF859F847,0xF8AEF87C,0xF94EF8EB,
-0xFA2BF9B1,0xFB3AFAB1,0xFC64FBD6,0xFD78FCF3,0xFE55FDE7,0xFF09FEAA,0xFFB7FF65,0x00520000,
-0x010F00B5,0x01DD016B,0x02B10249,0x035F0320,0x03E903A7,0x045A042E,0x04990488,0x04D304B1,
-0x04E604E4,0x04BA04D6,0x04410478,0x039D03F2,0x02D1033F,0x01B50244,0x00880119,0xFF57FFF1,
-0xFE38FEBE,0xFD34FDAF,0xFC5EFCBF,0xFBAAFC04,0xFB15FB5A,0xFA93FAD9,0xFA1BFA5A,0xF9AAF9DD,
-0xF969F988,0xF946F957,0xF95CF940,0xF99DF977,0xFA22F9E3,0xFAAEFA62,0xFB13FAD8,0xFB41FB29,
-0xFB2AFB3A,0xFAEBFB0F,0xFA61FAA7,0xF9EBFA33,0xF999F9C3,0xF944F968,0xF913F92E,0xF8DDF8FE,
-0xF8A8F8CE,0xF867F87E,0xF830F84B,0xF82BF827,0xF86AF844,0xF8EFF8A7,0xF99EF93E,0xFA58F9F9,
-0xFB15FAC0,0xFBD5FB7A,0xFC98FC37,0xFD68FCF6,0xFE3BFDD6,0xFF1DFEB0,0xFFFEFF93,0x00D00072,
-0x01860121,0x023501D0,0x02E90288,0x03820332,0x044503DD,0x050D04A0,0x05E90584,0x06DA0666,
-0x07CA074B,0x08D00847,0x09E0094B,0x0B2A0A7B,0x0CAA0BDF,0x0E4C0D77,0x10120F29,0x11C210EC,
-0x1341128A,0x142A13C9,0x148D146F,0x144A1483,0x137413EC,0x120C12D2,0x10511137,0x0E9B0F71,
-0x0CDB0DB8,0x0B290C03,0x09760A50,0x07AD088C,0x05D306BA,0x03EB04D7,0x022A0304,0x0093015C,
-0xFF33FFDE,0xFE0FFEA5,0xFD01FD82,0xFBE1FC69,0xFAB5FB4D,0xF983FA13,0xF852F8E8,0xF747F7C3,
-0xF662F6CE,0xF5B8F607,0xF558F580,0xF542F54A,0xF56FF553,0xF5E2F5A9,0xF657F617,0xF6BFF694,
-0xF708F6DE,0xF73EF72E,0xF771F758,0xF7F7F7B6,0xF8AFF850,0xF9A1F929,0xFA93FA11,0xFB5DFAFA,
-0xFBF8FBB2,0xFC5EFC2F,0xFC97FC7B,0xFCC1FCA7,0xFD17FCDE,0xFD94FD46,0xFE33FDDC,0xFF02FE92,
-0xFFA2FF54,0x0006FFDE,0x002D002C,0x000F002B,0xFFC0FFEA,0xFF57FF86,0xFF12FF33,0xFEE1FEF6,
-0xFED4FED7,0xFEC3FEC2,0xFEDDFECD,0xFEF9FEE0,0xFF1BFF02,0xFF61FF3C,0xFFD3FF9E,0x007A0023,
-0x014C00DD,0x022F01C3,0x02FB0299,0x03B3035C,0x04510409,0x04E10496,0x05810537,0x062205D2,
-0x06B50682,0x070106E6,0x06BD06F1,0x05FD0675,0x048F0560,0x02CF03B6,0x00FC01EA,0xFF3F0019,
-0xFDD1FE81,0xFCA9FD3A,0xFBC4FC31,0xFAF7FB57,0xFA52FAA0,0xF9A9FA00,0xF943F96A,0xF8FCF90B,
-0xF8F9F8F3,0xF933F90D,0xF9A8F965,0xFA3FF9F2,0xFAE1FA8E,0xFB7EFB33,0xFBECFBBA,0xFC4AFC1D,
-0xFC6FFC5D,0xFC7BFC79,0xFC8CFC86,0xFC9AFC90,0xFCD1FCAC,0xFD09FCE9,0xFD5BFD33,0xFDA7FD84,
-0xFDE2FDCC,0xFE15FDF6,0xFE4FFE2A,0xFEB8FE80,0xFF3EFEF1,0x0009FFA4,0x0104007B,0x02030180,
-0x02FF028C,0x03D20365,0x04800429,0x052404D3,0x059B0560,0x061E05DB,0x066E064C,0x067C066C,
-0x06310666,0x058105E9,0x04930519,0x034C03FB,0x01C50297,0x002C00F5,0xFE81FF52,0xFCEAFDB2,
-0xFB71FC27,0xFA40FAD1,0xF94FF9BB,0xF8B2F8F4,0xF84CF870,0xF830F844,0xF828F824,0xF835F820,
-0xF859F83C,0xF8AAF87C,0xF949F8F7,0xFA2DF9B8,0xFB50FAB9,0xFC8BFBEA,0xFDCCFD2E,0xFF0CFE6F,
-0x002EFFA3,0x016300CA,0x02A70203,0x040D0359,0x059004D0,0x073B065F,0x08E0080E,0x0A7609AD,
-0x0BEE0B3B,0x0CFA0C82,0x0DB20D5D,0x0E0F0DEA,0x0DE70E06,0x0D500DA8,0x0C5B0CD8,0x0B240BC4,
-0x09E00A85,0x086A092F,0x06E307AB,0x05510616,0x03D60499,0x025F0324,0x00FB01AC,0xFF980047,
-0xFE20FED5,0xFCA4FD67,0xFB0DFBD2,0xF966FA3D,0xF7BCF891,0xF61CF6EB,0xF49AF556,0xF37CF40B,
-0xF2A5F30E,0xF22EF265,0xF1EDF211,0xF1DEF1E3,0xF1F6F1E4,0xF235F217,0xF299F263,0xF31FF2D9,
-0xF3C8F368,0xF493F421,0xF576F504,0xF64DF5E5,0xF718F6BC,0xF7D2F777,0xF87AF82D,0xF90FF8C0,
-0xF9B0F95F,0xFA7CFA15,0xFB7CFAF9,0xFCABFC07,0xFDDEFD48,0xFF1AFE7B,0x0045FFB1,0x015200D1,
-0x024701CF,0x031D02B2,0x04030380,0x04EF047E,0x05C90561,0x06780622,0x070306C3,0x07580742,
-0x07820771,0x079C0794,0x07B807A7,0x07C507C0,0x07C407C1,0x079F07B4,0x075F0782,0x07110741,
-0x06B206E4,0x06700692,0x06570665,0x06650652,0x069F067D,0x06E806B8,0x071D0700,0x07220725,
-0x06F50713,0x064D06B1,0x055F05E7,0x040C04B7,0x0285034D,0x010801C7,0xFF9A004D,0xFE28FEE8,
-0xFCF4FD96,0xFBB5FC55,0xFA8AFB1E,0xF947F9E2,0xF82CF8B1,0xF72DF7A5,0xF6A2F6D8,0xF681F686,
-0xF6C7F691,0xF74CF703,0xF7FEF79D,0xF8B7F852,0xF977F90C,0xFA4CF9DD,0xFB40FACD,0xFC53FBC4,
-0xFD7DFCE8,0xFEB2FE19,0xFFFDFF5E,0x011D0085,0x02120199,0x02EB0283,0x0390033C,0x042E03EB,
-0x04970461,0x04E204BD,0x053A0508,0x056A0546,0x058B0577,0x05A9059F,0x05B005B0,0x05AF05AB,
-0x0588059E,0x05800580,0x05750576,0x057C057A,0x056C056B,0x05660570,0x05030535,0x046A04B1,
-0x03970402,0x028C030D,0x015E01E9,0x003900C9,0xFF18FFAF,0xFE1DFE98,0xFD3BFDAE,0xFC50FCC3,
-0xFB7BFBE6,0xFA93FAFE,0xF9B2FA1F,0xF919F955,0xF8B9F8DD,0xF8B2F8AB,0xF90DF8DF,0xF9B9F961,
-0xFA9DFA24,0xFB8FFB15,0xFCA6FC0E,0xFDC8FD37,0xFF50FE8D,0x010E0024,0x0311020F,0x054D042F,
-0x07970677,0x09CE08BA,0x0BD70ACF,0x0DF20CE2,0x100F0F05,0x125F1131,0x14FC13A2,0x176C1637,
-0x199A1892,0x1B321A74,0x1BD61BAE,0x1B551BB1,0x19B01AA4,0x174D18A3,0x147B15E8,0x119B1304,
-0x0F0F103B,0x0D040E05,0x0B450C1E,0x09D30A7F,0x0866091E,0x06ED07B6,0x05530628,0x03CE0492,
-0x0268031C,0x011A01B9,0xFFF60088,0xFEACFF4A,0xFD77FE15,0xFC0AFCC4,0xFA9BFB51,0xF91FF9DE,
-0xF7A5F866,0xF631F6EA,0xF4CBF57F,0xF35BF419,0xF200F2A8,0xF0C6F165,0xEFACF039,0xEED3EF4B,
-0xEE27EE7E,0xEDB1EDF6,0xED59ED84,0xED07ED2A,0xECCDECEF,0xECA4ECB6,0xECAEECA9,0xECBAECBB,
-0xECFFECDE,0xED44ED25,0xEDA5ED74,0xEE14EDD2,0xEEA1EE52,0xEF60EEFA,0xF02DEFBC,0xF11CF09F,
-0xF229F1A3,0xF353F2C1,0xF49BF3F1,0xF5DEF53B,0xF703F677,0xF7EEF77A,0xF8B7F854,0xF955F906,
-0xF9ECF99F,0xFA5AFA19,0xFADBFA98,0xFB33FB12,0xFB6BFB54,0xFB89FB85,0xFB6EFB76,0xFB4CFB5B,
-0xFB3DFB3D,0xFB6CFB47,0xFBD5FBA0,0xFC8EFC1A,0xFDA7FD19,0xFEDDFE3D,0x0035FF97,0x019400E5,
-0x03180257,0x04B503E8,0x065B0590,0x081D0743,0x09F70914,0x0BD60AE5,0x0DD20CC5,0x0FD20ECE,
-0x11EE10E3,0x14081302,0x15F31511,0x17B116DE,0x19001860,0x1A021986,0x1A8A1A4D,0x1AB31AA3,
-0x1A6E1AAA,0x19B41A23,0x18881921,0x16E517CD,0x14E215E6,0x129813CE,0x1038116A,0x0DD90F01,
-0x0B780CA3,0x09370A4D,0x07120820,0x050D060F,0x03050405,0x011801FF,0xFF540032,0xFDCAFE85,
-0xFC60FD0A,0xFB28FBC5,0xF9EAFA86,0xF8B6F94F,0xF784F81A,0xF658F6DE,0xF547F5C9,0xF455F4C6,
-0xF399F3EE,0xF30EF34D,0xF2BFF2DC,0xF2A8F2AF,0xF2C9F2AC,0xF308F2EE,0xF358F338,0xF3B3F388,
-0xF40CF3D3,0xF47EF445,0xF508F4BE,0xF5C6F560,0xF6D4F646,0xF7DBF74B,0xF8FBF862,0xFA20F989,
-0xFB18FAA9,0xFBEFFB8C,0xFCB2FC65,0xFD4EFD09,0xFDD9FDA0,0xFE49FE1B,0xFE9EFE86,0xFEF9FEC4,
-0xFF30FF11,0xFF71FF48,0xFFC2FF96,0x0003FFEF,0x006B0039,0x00E300B0,0x017B0132,0x022B01CB,
-0x03000295,0x03E4036B,0x04D7045E,0x05FF056F,0x06FA0684,0x07CF0766,0x08710829,0x08C208B2,
-0x089808B9,0x08190864,0x073107B4,0x060906AC,0x04B50573,0x034403F5,0x01CC0287,0x007D0112,
-0xFF58FFE6,0xFE6DFEE6,0xFDADFE07,0xFD26FD65,0xFCD2FD00,0xFCC5FCCA,0xFCC6FCC5,0xFCDEFCC9,
-0xFCFAFCE7,0xFD18FD13,0xFD1DFD15,0xFD57FD38,0xFD92FD6E,0xFDDAFDA6,0xFE39FE0E,0xFE93FE75,
-0xFEC5FEBD,0xFECAFED5,0xFE99FEC0,0xFE3DFE79,0xFDA9FDFD,0xFCECFD4A,0xFC1AFC83,0xFB45FBB1,
-0xFA81FAE0,0xF9C7FA23,0xF92DF96B,0xF8A6F8DD,0xF834F86D,0xF7AEF7E9,0xF712F760,0xF687F6C8,
-0xF5F5F645,0xF59AF5C4,0xF55AF571,0xF556F557,0xF566F55A,0xF5B3F586,0xF5F0F5D3,0xF662F62F,
-0xF6C8F696,0xF747F70D,0xF7D3F793,0xF86FF828,0xF914F8C3,0xF9B5F963,0xFA3CF9F4,0xFACFFA7D,
-0xFB77FB1B,0xFC22FBD0,0xFCF9FC93,0xFDD5FD66,0xFEB9FE43,0xFF69FF1B,0x000CFFC3,0x00890054,
-0x00FD00C3,0x01790139,0x021901C4,0x02D90275,0x03BC034E,0x04B10439,0x05BC0531,0x06D40645,
-0x080F0773,0x095B08AF,0x0AE10A1F,0x0C820BAE,0x0E4C0D56,0x10200F31,0x11A710E9,0x12F51258,
-0x13CE1374,0x141D1411,0x13AA1401,0x12AF1340,0x113511FF,0x0F6E105A,0x0D840E79,0x0B930C88,
-0x09BB0AA7,0x07F908DF,0x06430719,0x048B055E,0x02F803BC,0x01770232,0x002B00D8,0xFEFDFF96,
-0xFDC8FE5F,0xFC8CFD2A,0xFB12FBD0,0xF996FA52,0xF845F8EE,0xF729F7A3,0xF65AF6B9,0xF5EFF616,
-0xF5C0F5D9,0xF5A8F5AC,0xF5A7F5A9,0xF5AAF5A2,0xF5D7F5C2,0xF659F613,0xF728F6BD,0xF844F7B2,
-0xF9B8F8F4,0xFB30FA72,0xFCA2FBEF,0xFDE5FD4A,0xFF08FE7D,0xFFECFF83,0x00B50056,0x01430105,
-0x01AE0184,0x01EB01D2,0x021C0203,0x02260224,0x0207021A,0x01CB01F1,0x018801A9,0x013B0165,
-0x00DC010A,0x008F00AA,0x00400070,0x0008001A,0xFFD7FFEB,0xFF81FFAA,0xFF3DFF57,0xFEE3FF11,
-0xFEB0FEBF,0xFEBCFEB6,0xFEE1FED3,0xFF32FF0E,0xFF8AFF5F,0x001BFFDE,0x0089004C,0x00FF00C3,
-0x017B0139,0x020D01B2,0x02AA025D,0x0375030A,0x043403CE,0x04DE0484,0x056F051E,0x05CE059C,
-0x061B05F6,0x066D0635,0x06C8069B,0x073F070B,0x07D30785,0x0875081E,0x091608CB,0x098E094C,
-0x09DD09BC,0x0A0709EF,0x09FF0A09,0x09DD09EE,0x09A909C8,0x094B097C,0x08DE0923,0x086708A9,
-0x07AD0807,0x06D60747,0x05DD0668,0x04D00555,0x03C9044A,0x03150368,0x027802C6,0x01FC0231,
-0x016A01BA,0x00C4011E,0xFFCC0047,0xFEA2FF3E,0xFD5AFE09,0xFC09FCBA,0xFACCFB69,0xF9A1FA36,
-0xF8B1F922,0xF7FDF856,0xF751F7A5,0xF6AEF6FD,0xF5F2F641,0xF527F58D,0xF448F4AF,0xF385F3E3,
-0xF2E6F333,0xF284F2AF,0xF26AF27A,0xF28AF274,0xF2B9F2A0,0xF2F9F2D9,0xF316F312,0xF333F31F,
-0xF33FF339,0xF376F359,0xF3DDF3A6,0xF462F412,0xF4E9F4A2,0xF598F543,0xF63BF5F1,0xF6D7F68D,
-0xF783F72B,0xF851F7E9,0xF926F8B0,0xFA0BF99C,0xFB1BFA8A,0xFC1AFB90,0xFCF0FC86,0xFDB7FD5B,
-0xFE56FE01,0xFF03FEA6,0xFFBAFF61,0x00890024,0x01800107,0x027F0203,0x037B030B,0x046A03F7,
-0x054B04DF,0x062605BE,0x071A069C,0x082E079C,0x094508B5,0x0A5909D2,0x0B500ADB,0x0C130BC0,
-0x0CAC0C6B,0x0CEC0CDE,0x0D040D06,0x0CE90D05,0x0C910CC9,0x0C100C5A,0x0B770BC8,0x0AEB0B35,
-0x0A620AA6,0x0A050A2C,0x09E409E3,0x09D009D8,0x09F209DD,0x0A2E0A12,0x0A480A40,0x0A500A4D,
-0x0A330A44,0x09F20A13,0x09A509CE,0x0924096C,0x089708E6,0x07DE0842,0x06E40771,0x05A50655,
-0x041A04E7,0x02670340,0x0082016B,0xFEACFF8F,0xFD00FDCB,0xFB7AFC31,0xFA44FAD2,0xF943F9C0,
-0xF87FF8D3,0xF7EFF829,0xF78FF7B2,0xF769F775,0xF765F75C,0xF795F77E,0xF7E5F7B7,0xF857F80E,
-0xF8C8F884,0xF954F911,0xF9BFF983,0xFA2DFA00,0xFAA6FA69,0xFB12FAE4,0xFB88FB48,0xFC10FBC3,
-0xFCA2FC50,0xFD50FCEF,0xFDF2FD96,0xFE90FE42,0xFF0CFEC4,0xFF4FFF2A,0xFF8CFF6C,0xFF8EFF94,
-0xFFA5FF96,0xFFC4FFBB,0x0009FFE1,0x00530030,0x00AC0090,0x00F700CE,0x014F0120,0x01AB017D,
-0x021501DC,0x0279024F,0x02F402BA,0x0339031F,0x034A0351,0x033A034D,0x02FD032A,0x027C02BE,
-0x01BE0221,0x00D9015A,0xFFB70049,0xFE86FF23,0xFD50FDF2,0xFC52FCC1,0xFB7CFBEC,0xFAE9FB2B,
-0xFA9EFAC3,0xFA8AFA99,0xFAABFAA7,0xFAFFFAD0,0xFB88FB42,0xFC59FBE7,0xFD43FCC8,0xFE51FDCA,
-0xFF45FED4,0x0014FFB5,0x009E005C,0x00E700D2,0x012300FF,0x0149013C,0x0170015E,0x018F017E,
-0x019B019B,0x01890195,0x0148016F,0x00F8012E,0x008100BE,0x00000044,0xFF96FFCD,0xFF2BFF5B,
-0xFEBAFEEC,0xFE46FE7C,0xFDC6FDFA,0xFD27FD78,0xFC77FCCF,0xFBA9FC0B,0xFABEFB38,0xF9E3FA58,
-0xF91AF982,0xF87AF8C5,0xF809F83F,0xF7DDF7EE,0xF7CCF7DA,0xF7AAF7B8,0xF79CF7AD,0xF76EF790,
-0xF749F75B,0xF73EF743,0xF765F751,0xF7CEF794,0xF85EF80C,0xF92FF8C4,0xFA13F997,0xFB0FFA90,
-0xFC0BFB8A,0xFD19FC92,0xFE01FD91,0xFEEDFE7C,0xFFDCFF61,0x00B60045,0x017C0113,0x022101D2,
-0x02C9027E,0x03630312,0x03F403AC,0x048D0449,0x052B04DF,0x05DC0593,0x06B0064F,0x07970729,
-0x08BB082B,0x0A080959,0x0B640ABC,0x0CDB0C21,0x0E3C0D8C,0x0F7D0EE7,0x106E1000,0x112010D5,
-0x1157114A,0x11181146,0x108B10E1,0x0F9E101F,0x0E7E0F18,0x0D540DE8,0x0C210CB4,0x0AFD0B8D,
-0x09C90A5C,0x089D093B,0x07630802,0x063806CF,0x052E05B6,0x045E04C2,0x03C30410,0x034D0381,
-0x02D2030D,0x0234028E,0x016301D3,0x007600ED,0xFF57FFED,0xFE22FEBB,0xFCE8FD7F,0xFBBCFC48,
-0xFA9AFB2E,0xF969FA04,0xF859F8E8,0xF739F7CD,0xF5F8F6A4,0xF4C7F564,0xF392F434,0xF2ABF310,
-0xF1FFF255,0xF1BBF1D7,0xF1CAF1B3,0xF214F1E4,0xF294F24E,0xF321F2DD,0xF3EAF37E,0xF4C4F448,
-0xF5DCF54A,0xF74DF690,0xF903F81E,0xFB0EF9FB,0xFD58FC33,0xFFA3FE7A,0x021C00E3,0x048B0352,
-0x06FA05C8,0x09780833,0x0BBC0A94,0x0DC60CC7,0x0F810EB3,0x10C01032,0x1190113C,0x11BA11C4,
-0x115B119B,0x107410F8,0x0F130FDA,0x0D4D0E38,0x0B3B0C4C,0x09090A1B,0x06DE07FA,0x04BC05C5,
-0x02E803D4,0x01430209,0xFFBF0081,0xFE55FF07,0xFD47FDCD,0xFC4CFCD3,0xFB6DFBD3,0xFA86FAFE,
-0xF98EFA1B,0xF8A1F91A,0xF7A0F821,0xF697F718,0xF5AAF61C,0xF4DFF545,0xF458F48A,0xF412F428,
-0xF3F9F3FD,0xF402F402,0xF423F411,0xF436F435,0xF44FF441,0xF480F465,0xF4E1F4A9,0xF565F51B,
-0xF625F5BB,0xF70AF695,0xF800F792,0xF8DDF87B,0xF9B5F94E,0xFA6CFA0E,0xFB03FAC2,0xFB80FB3D,
-0xFBF6FBBD,0xFC80FC2C,0xFD10FCCC,0xFDA6FD58,0xFE2AFDEF,0xFE87FE5D,0xFEB7FEA1,0xFEC2FEBE,
-0xFEACFEBE,0xFE8DFE99,0xFE8EFE89,0xFEB5FEA0,0xFF12FEEB,0xFF7CFF49,0xFFEFFFB0,0x00580021,
-0x00A3007E,0x00DB00CB,0x010000F1,0x014B0120,0x018A015A,0x01D601AA,0x020701ED,0x0244021F,
-0x02690259,0x02A50288,0x02D502BC,0x031F02F2,0x03600339,0x03A00381,0x03C403BB,0x03F703DB,
-0x03F503F8,0x03D603F6,0x03AB03C8,0x0340037B,0x02AC0303,0x01EC024C,0x01150189,0x003900A2,
-0xFF86FFD6,0xFF0EFF47,0xFEEEFEF8,0xFEEDFEE6,0xFEF8FEEA,0xFF1DFF14,0xFF6FFF41,0xFFE5FFA9,
-0x006D001C,0x012700C4,0x02150198,0x033A02A0,0x047203D4,0x05D70525,0x076906A0,0x08F2082C,
-0x0A7D09BF,0x0BEC0B3A,0x0D330C9B,0x0E540DC0,0x0F420EC8,0x0FDE0F9C,0x1016100A,0x0FDE100E,
-0x0F2E0FA3,0x0E110EA3,0x0C9D0D5B,0x0B090BD7,0x09570A3C,0x07BC0887,0x05F606DD,0x044E051F,
-0x029C036D,0x010301CA,0xFF7D003C,0xFE32FED9,0xFD1DFD99,0xFC5EFCB4,0xFBD9FC10,0xFB7FFBA5,
-0xFB5AFB72,0xFB35FB44,0xFB1CFB23,0xFAFFFB11,0xFAEDFAF2,0xFAE5FAEF,0xFAF6FAF5,0xFB07FB00,
-0xFB24FB1E,0xFB5FFB42,0xFB60FB5F,0xFB5FFB66,0xFB39FB46,0xFAC6FB0D,0xFA37FA86,0xF986F9E4,
-0xF8C3F917,0xF800F860,0xF763F7B0,0xF6F2F72C,0xF6B7F6CA,0xF684F6A0,0xF67CF681,0xF69BF693,
-0xF6C8F6B5,0xF70EF6E9,0xF779F73F,0xF7DAF7A4,0xF84DF81E,0xF8AEF878,0xF911F8E1,0xF955F935,
-0xF96FF965,0xF953F96F,0xF8FCF929,0xF866F8BA,0xF7C2F817,0xF700F76C,0xF654F6AD,0xF5BEF603,
-0xF559F588,0xF540F542,0xF552F544,0xF5ABF575,0xF61DF5E2,0xF6B5F65F,0xF77FF70C,0xF864F7F2,
-0xF96BF8E4,0xFA8CF9FA,0xFBB3FB24,0xFCE8FC4D,0xFE19FD85,0xFF40FEB5,0x0062FFD9,0x015A00F2,
-0x024C01DE,0x02FF02B8,0x0385033A,0x03FD03C0,0x044E041F,0x04910468,0x04E904B5,0x05200509,
-0x0551053D,0x05900575,0x05CA05B2,0x062005F4,0x0677064D,0x071706C4,0x07C40765,0x0894082F,
-0x097A090B,0x0A4D09E9,0x0B010AAD,0x0B840B47,0x0BC20BB3,0x0BBD0BCB,0x0B960BB3,0x0B4E0B71,
-0x0AEB0B1E,0x0A9A0AC7,0x0A5E0A7F,0x0A070A2E,0x099F09DA,0x0908095A,0x084208A4,0x075507CF,
-0x065506D1,0x054905CF,0x045404CE,0x036A03E0,0x028302F8,0x01C00224,0x00FA015F,0x003E009E,
-0xFF9FFFEE,0xFF31FF65,0xFEF6FF0E,0xFF05FEF5,0xFF41FF1C,0xFFB8FF7D,0x0031FFF8,0x00930065,
-0x00C500AA,0x00BC00C5,0x005F0098,0xFFF7002F,0xFF79FFBA,0xFED9FF31,0xFE38FE95,0xFD9CFDE9,
-0xFD06FD4D,0xFC85FCBD,0xFC2BFC56,0xFC04FC08,0xFC1AFC0D,0xFC69FC37,0xFCFAFCAA,0xFDD8FD63,
-0xFEDEFE52,0xFFF5FF60,0x0126008F,0x026101C2,0x03AB0307,0x0513045A,0x068405C3,0x080C073E,
-0x098408C7,0x0AC20A2A,0x0BE30B5C,0x0C910C48,0x0CE00CC4,0x0CE90CE1,0x0CA80CC8,0x0C480C79,
-0x0BD20C13,0x0B5C0B9B,0x0AD10B20,0x0A200A78,0x096C09C9,0x087208F4,0x076207F0,0x063506C8,
-0x0506059B,0x03D40462,0x02B50346,0x019D0226,0x008B0115,0xFF85000A,0xFE89FF08,0xFD8FFE09,
-0xFC92FD11,0xFBB4FC1D,0xFAD6FB47,0xFA1DFA76,0xF99FF9CF,0xF93FF96A,0xF908F921,0xF8DAF8F9,
-0xF88CF8AF,0xF83EF866,0xF7D8F805,0xF758F797,0xF6E3F722,0xF656F69E,0xF5D8F620,0xF53AF581,
-0xF4ADF4F0,0xF41CF461,0xF386F3D9,0xF337F35D,0xF2FAF312,0xF2B2F2C6,0xF29CF29D,0xF2A3F291,
-0xF2C8F2A6,0xF318F2E9,0xF386F34B,0xF41BF3CE,0xF4DBF477,0xF5AEF53C,0xF6A1F627,0xF7BFF730,
-0xF8F0F854,0xFA1CF986,0xFB66FABD,0xFC97FC02,0xFDAAFD28,0xFEA1FE30,0xFF85FF1B,0x002BFFE7,
-0x009D0069,0x010500DC,0x0133011D,0x01490146,0x01480153,0x01370144,0x0122012A,0x00F90106,
-0x00DC00EA,0x00B300CE,0x00A600A5,0x007C0087,0x006F0079,0x00640061,0x00690064,0x00820070,
-0x00B90098,0x010700DE,0x0161012B,0x01BA019D,0x021601E3,0x02870249,0x02F802BE,0x03740337,
-0x040503B1,0x04B50461,0x056F0512,0x064905D0,0x072C06B7,0x081E079E,0x08FA0886,0x09D50960,
-0x0A850A2D,0x0B060ACB,0x0B790B43,0x0BBA0BA3,0x0BEA0BC8,0x0C160BFB,0x0C420C1F,0x0C760C5C,
-0x0C9B0C86,0x0C970CA0,0x0C6F0C8B,0x0C050C46,0x0B610BB1,0x0A6A0AED,0x095D09E1,0x082008BF,
-0x06AD0760,0x053005F2,0x038F045B,0x01FB02C2,0x0070012B,0xFF0CFFB7,0xFDE9FE68,0xFD1AFD71,
-0xFC90FCC0,0xFC6CFC7A,0xFC8DFC77,0xFCE6FCB7,0xFD65FD22,0xFE02FDB7,0xFE9DFE55,0xFF27FEE7,
-0xFF98FF68,0xFFD8FFBE,0xFFE4FFEE,0xFF92FFCA,0xFEF4FF4E,0xFE0EFE81,0xFCE1FD84,0xFBA3FC4C,
-0xFA5EFAF6,0xF931F9BF,0xF81EF896,0xF734F7A0,0xF658F6C4,0xF59EF5F8,0xF4DFF53B,0xF434F48F,
-0xF3C9F3F0,0xF383F3A4,0xF37DF36F,0xF3A4F384,0xF3E8F3CC,0xF465F429,0xF4D3F49E,0xF54DF510,
-0xF5B9F57C,0xF63AF5F5,0xF6A8F668,0xF739F6E5,0xF7F0F784,0xF8C1F855,0xF9AFF930,0xFAB6FA38,
-0xFBC3FB3B,0xFCD8FC44,0xFDF1FD60,0xFF1FFE85,0x0052FFB5,0x018000E4,0x02B90221,0x03F90353,
-0x051F0488,0x065F05C0,0x078206EC,0x08B4081E,0x09E3094C,0x0AFE0A6E,0x0BF70B77,0x0CB20C56,
-0x0D350CFA,0x0D520D4F,0x0D150D3D,0x0C850CD7,0x0B900C19,0x0A4E0AFD,0x08D30991,0x071807F1,
-0x05680646,0x03B70498,0x024102FD,0x00FD019E,0xFFF4006D,0xFF14FF75,0xFE6AFEB5,0xFDE5FE28,
-0xFD97FDB9,0xFD59FD7C,0xFD5BFD59,0xFD6AFD56,0xFD73FD71,0xFD7BFD78,0xFD85FD86,0xFD67FD7D,
-0xFD3CFD51,0xFCD1FD07,0xFC78FCA6,0xFBF6FC37,0xFB77FBAE,0xFAD5FB24,0xFA0EFA6A,0xF94DF9AA,
-0xF8A0F8F1,0xF7FAF852,0xF757F7AB,0xF6D5F725,0xF648F68C,0xF5D4F60D,0xF585F5AA,0xF551F564,
-0xF548F54E,0xF587F562,0xF5F4F5AD,0xF672F633,0xF717F6C3,0xF7B0F75D,0xF855F805,0xF903F8AC,
-0xF9A3F952,0xFA3EF9F6,0xFAD7FA8A,0xFB5CFB21,0xFBD1FB9F,0xFC49FC01,0xFCB0FC81,0xFD16FCE1,
-0xFD9FFD60,0xFE35FDF1,0xFEDAFE85,0xFF99FF39,0x007F000F,0x01960110,0x02A50219,0x03D40345,
-0x05070473,0x064505A6,0x076C06DE,0x087A07F4,0x09960909,0x0AA90A1E,0x0BAD0B29,0x0CB80C2B,
-0x0D840D27,0x0E380DD8,0x0EBB0E80,0x0F090EEA,0x0F3A0F29,0x0F350F36,0x0F2B0F39,0x0EF90F1A,
-0x0EB50ED4,0x0E6E0E89,0x0E1B0E47,0x0DDD0E01,0x0D9B0DC1,0x0D570D7C,0x0CF70D2E,0x0C8D0CC0,
-0x0C070C46,0x0B840BC2,0x0AEB0B40,0x0A430AA5,0x09A709F6,0x08D70943,0x07DD0860,0x06C8074F,
-0x0596062D,0x044804E9,0x030303AA,0x01B2025F,0x00830119,0xFF5FFFEA,0xFE6DFEE8,0xFD7FFDF7,
-0xFC9AFCFE,0xFBADFC21,0xFAA8FB2E,0xF980FA15,0xF834F8DB,0xF6E0F798,0xF58CF632,0xF44DF4DF,
-0xF342F3C1,0xF248F2B4,0xF174F1D6,0xF0C7F10E,0xF040F07E,0xEFFEF011,0xEFDEEFE3,0xEFEBEFD4,
-0xF046F016,0xF0C9F07F,0xF170F116,0xF238F1DD,0xF30EF2A2,0xF3DAF377,0xF49BF440,0xF553F4FF,
-0xF5F9F5B1,0xF6BBF654,0xF781F722,0xF860F7E9,0xF949F8D6,0xFA21F9B9,0xFB0EFA98,0xFBE0FB7A,
-0xFCBFFC55,0xFD8AFD1A,0xFE50FDF0,0xFF10FEA9,0xFFD7FF7F,0x00B20051,0x01A2012B,0x0292021F,
-0x039D0311,0x04970419,0x05AB0516,0x06D10636,0x08260779,0x099A08DB,0x0B270A64,0x0CAF0BF6,
-0x0DF80D67,0x0EF50E8C,0x0F980F5A,0x0FD60FC9,0x0FC30FDB,0x0F4F0F94,0x0EAC0F07,0x0DD90E46,
-0x0CD80D65,0x0BA50C4D,0x0A5B0AFD,0x08F809AF,0x075B0824,0x05C80695,0x040304F4,0x025A0329,
-0x00A7017B,0xFF2CFFE3,0xFDE9FE82,0xFCC8FD56,0xFBC6FC42,0xFAFCFB5E,0xFA5FFAA5,0xF9E6FA14,
-0xF969F9A6,0xF918F93D,0xF8D7F8ED,0xF87EF8AA,0xF83CF859,0xF7EEF812,0xF781F7BE,0xF731F754,
-0xF6BAF6FD,0xF624F676,0xF588F5DE,0xF4BAF521,0xF3F3F459,0xF329F396,0xF26DF2CC,0xF1E6F22A,
-0xF196F1BD,0xF16DF176,0xF159F164,0xF177F162,0xF1B4F190,0xF21AF1E8,0xF2AEF264,0xF378F30A,
-0xF490F40B,0xF5B2F524,0xF6FEF659,0xF85CF7A2,0xF9A4F8F7,0xFAFCFA4A,0xFC5DFBA2,0xFDC6FD14,
-0xFF2DFE7A,0x007BFFDF,0x01BE0115,0x02D20241,0x03AF034C,0x045203FD,0x04D804A6,0x050C04EE,
-0x053A052A,0x0538053F,0x053B053B,0x05430545,0x054C0547,0x0547055D,0x053B0549,0x05210532,
-0x05220520,0x053B0527,0x0566053E,0x05C50586,0x064B0603,0x070E06A5,0x080A0782,0x093C089E,
-0x0A8F09E1,0x0BFA0B45,0x0D880CBA,0x0F1C0E49,0x10980FD6,0x11EF113F,0x13201297,0x141913AD,
-0x14DE1489,0x155F1533,0x158C1588,0x1564157E,0x14DD153B,0x1402147E,0x12D41379,0x1180122C,
-0x101510D1,0x0EA70F58,0x0D340DE4,0x0BDA0C7E,0x0A890B2A,0x092909D7,0x07DE087B,0x06760727,
-0x04EC05AC,0x0371042A,0x01D4029C,0x003C010E,0xFE8FFF6B,0xFD07FDD6,0xFB7DFC42,0xFA06FAC2,
-0xF8A1F957,0xF756F7FC,0xF62BF6BB,0xF536F5A6,0xF45BF4C3,0xF3CEF40F,0xF368F397,0xF334F347,
-0xF339F32D,0xF340F334,0xF360F347,0xF388F370,0xF3BAF3A0,0xF408F3D1,0xF478F446,0xF50FF4B4,
-0xF5ABF564,0xF64AF5F8,0xF70BF6AE,0xF799F756,0xF819F7DD,0xF893F864,0xF903F8C9,0xF966F935,
-0xF9C3F991,0xFA22F9E7,0xFA75FA4B,0xFAB8FA9A,0xFB09FADC,0xFB49FB29,0xFB90FB70,0xFBDEFBB7,
-0xFC2BFC0A,0xFC83FC54,0xFCEBFCB0,0xFD60FD2D,0xFDE8FD9F,0xFE72FE36,0xFEEAFEB1,0xFF57FF20,
-0xFFADFF7E,0x0010FFD7,0x0085004D,0x011700CF,0x01CF0174,0x02BC0242,0x03CB0348,0x04EC0460,
-0x06250588,0x075906B6,0x086607D7,0x097308EB,0x0A3D09DF,0x0AD90A92,0x0B240B08,0x0B240B27,
-0x0AE80B12,0x0A7C0AB8,0x09EC0A44,0x093D0996,0x08A008F6,0x07DA0845,0x07340780,0x068B06E1,
-0x06010649,0x057605B7,0x04F50535,0x048F04BC,0x041F0457,0x03A703CF,0x0333036E,0x02AC02F8,
-0x01FC025B,0x013401A3,0x003600B4,0xFF16FFA8,0xFDE3FE8A,0xFCACFD44,0xFB9AFC2E,0xFA8FFB09,
-0xF9B1FA18,0xF8E4F947,0xF822F88C,0xF761F7CF,0xF6C5F717,0xF629F67E,0xF5A6F5EB,0xF572F57D,
-0xF54BF554,0xF567F556,0xF5B9F58D,0xF62CF5EE,0xF6BBF66F,0xF777F716,0xF844F7E0,0xF92CF8BB,
-0xFA39F9AA,0xFB5FFAC5,0xFC98FC01,0xFDC3FD33,0xFEDCFE55,0xFFEDFF6A,0x00C4005B,0x01690114,
-0x020B01BC,0x028F024F,0x02FA02C4,0x03670336,0x03C30391,0x041E03FE,0x047A0459,0x04D1049F,
-0x052C04FE,0x058B0554,0x063A05E1,0x06EC0694,0x07C0075F,0x08AD0839,0x0992091C,0x0A700A02,
-0x0B1D0ACA,0x0B9F0B6A,0x0BE50BC0,0x0BF80BF2,0x0BFB0BF7,0x0BCD0BEC,0x0B7E0BB0,0x0B140B51,
-0x0A870AD4,0x09AA0A24,0x08920921,0x074D07EC,0x05ED069A,0x045B0525,0x02D2038D,0x01600218,
-0x001700BB,0xFED8FF6F,0xFDCAFE48,0xFCCCFD42,0xFBE0FC4E,0xFAECFB6C,0xFA18FA7A,0xF96BF9BE,
-0xF8DDF918,0xF878F8A2,0xF84BF86A,0xF80DF837,0xF7D8F7F9,0xF799F7B4,0xF74AF774,0xF6F6F71D,
-0xF692F6BB,0xF63EF66A,0xF5D0F608,0xF558F597,0xF4EAF532,0xF48DF4BB,0xF439F461,0xF3F0F41B,
-0xF3C4F3D8,0xF38EF3A7,0xF39DF38C,0xF3B2F3A5,0xF3E8F3C2,0xF438F410,0xF490F45B,0xF4FAF4CD,
-0xF559F52D,0xF5AEF593,0xF60BF5E9,0xF66AF62F,0xF6BDF6A4,0xF707F6EA,0xF759F739,0xF79DF789,
-0xF7D5F7BA,0xF7DEF7DC,0xF7F5F7F5,0xF820F7FF,0xF86FF845,0xF8EEF8A8,0xF980F933,0xFA41F9DF,
-0xFAF9FAA1,0xFBA9FB53,0xFC54FBFB,0xFCE1FC9B,0xFD6BFD1E,0xFE03FDBD,0xFE9AFE4F,0xFF59FEF4,
-0x0017FFB2,0x00E00073,0x01BD0153,0x02BC0237,0x03BA0339,0x04DB043F,0x061C0578,0x076106B5,
-0x08B9080C,0x0A3B0984,0x0BB90AF9,0x0D530C8E,0x0EC60E16,0x100D0F76,0x10F7108C,0x1185114A,
-0x11AF11A3,0x11791196,0x110A114E,0x105B10C6,0x0F640FED,0x0E340ED3,0x0CB90D85,0x0AF20BE4,
-0x09000A06,0x06F107FA,0x04E805E9,0x02FF03E8,0x01460216,0xFFB4007F,0xFE49FEFC,0xFD00FDAE,
-0xFBC9FC69,0xFAB1FB34,0xF9BFFA34,0xF8EAF945,0xF84BF896,0xF7F2F814,0xF7AFF7D1,0xF79DF798,
-0xF790F795,0xF78FF783,0xF78FF790,0xF7A7F792,0xF7D4F7B8,0xF7FBF7E5,0xF85DF81F,0xF8C8F889,
-0xF946F904,0xF9CEF98D,0xFA53FA10,0xFAD9FA90,0xFB80FB22,0xFC30FBCA,0xFD09FC97,0xFDF7FD81,
-0xFF17FE8C,0x003EFFAB,0x016D00C4,0x02A5020D,0x03CE033C,0x050E0474,0x065405B3,0x07BE0708,
-0x092B0877,0x0ABD09F8,0x0C380B78,0x0D8E0CE5,0x0EA10E1D,0x0F950F19,0x10160FE1,0x10471039,
-0x0FF4102B,0x0F630FBC,0x0E800EFD,0x0D6C0E05,0x0C360CD8,0x0AFF0BA8,0x09AC0A56,0x086C090E,
-0x071A07C0,0x06000681,0x05000577,0x04330491,0x039B03D8,0x0338036A,0x02D40302,0x026702A4,
-0x01E20227,0x0149019E,0x008200EB,0xFFCA002F,0xFEF9FF5B,0xFE34FE9D,0xFD7CFDCF,0xFCB1FD13,
-0xFBD7FC43,0xFAF9FB6C,0xFA18FA8C,0xF930F9A6,0xF867F8C5,0xF7D7F81F,0xF772F79C,0xF72EF752,
-0xF72BF732,0xF71CF722,0xF72AF728,0xF741F735,0xF76FF74F,0xF7B1F786,0xF829F7E2,0xF8A9F86B,
-0xF93BF8F0,0xF9BBF981,0xFA24F9F8,0xFA5FFA4E,0xFA79FA67,0xFA7AFA75,0xFA60FA70,0xFA61FA63,
-0xFA71FA61,0xFA7CFA7B,0xFA71FA81,0xFA6DFA7F,0xFA5EFA71,0xFA39FA50,0xF9ECFA0B,0xF9A6F9C9,
-0xF961F97F,0xF91FF936,0xF8ECF90C,0xF8BEF8DE,0xF888F8A7,0xF87EF884,0xF86BF86E,0xF86DF86A,
-0xF886F87E,0xF8A5F88C,0xF8E1F8C0,0xF91AF8F5,0xF978F94F,0xF9D8F9A8,0xFA4CFA16,0xFADBFAA0,
-0xFB7BFB39,0xFC12FBD3,0xFCB2FC62,0xFD5DFD0B,0xFDF5FDAE,0xFE9AFE47,0xFF41FEF7,0xFFF6FF9A,
-0x00AC0059,0x015200EE,0x01F301A1,0x02B50251,0x03680316,0x042303C7,0x04E1047E,0x0596053A,
-0x065305F8,0x06F406A3,0x079E0751,0x084A07F0,0x08EF089D,0x0965092B,0x09FA09B2,0x0A790A3F,
-0x0B090ABD,0x0B9D0B58,0x0C4D0BEA,0x0CEF0C97,0x0D8C0D37,0x0E130DD9,0x0E6B0E47,0x0EB20E92,
-0x0ED60EC5,0x0EFA0EED,0x0F2E0F17,0x0F590F4E,0x0F6A0F66,0x0F8B0F7D,0x0F880F8F,0x0F610F76,
-0x0F0D0F3A,0x0EA30EE2,0x0E120E63,0x0D590DB7,0x0C870CF6,0x0BBA0C1B,0x0AEC0B4D,0x0A0D0A77,
-0x095509C4,0x089C08F8,0x07E70844,0x0715077E,0x064B06B0,0x056B05E3,0x048904FB,0x038D0413,
-0x02710308,0x015701DC,0x003800C2,0xFF1FFFA7,0xFDE1FE79,0xFCB4FD51,0xFB88FC22,0xFA52FAED,
-0xF923F9B9,0xF7EFF88C,0xF6E4F764,0xF5EBF65B,0xF529F577,0xF497F4D2,0xF436F467,0xF417F427,
-0xF428F41C,0xF453F437,0xF4A3F479,0xF501F4D4,0xF583F532,0xF613F5BD,0xF6BBF65A,0xF78AF729,
-0xF865F7F8,0xF94AF8DD,0xFA26F9BE,0xFB07FA9E,0xFBC2FB63,0xFC88FC25,0xFD31FCDE,0xFDD1FD7D,
-0xFE6EFE20,0xFF21FEC7,0xFFC1FF73,0x005E0015,0x00F700AC,0x016E0124,0x01C9019C,0x021901F4,
-0x02390228,0x02400235,0x02270234,0x01CD0200,0x01450198,0x008300E6,0xFF8A0009,0xFE97FF17,
-0xFDB4FE2E,0xFD01FD4A,0xFC8AFCBE,0xFC3BFC5D,0xFC2BFC37,0xFC22FC27,0xFC2EFC21,0xFC2FFC36,
-0xFC26FC2A,0xFC1EFC28,0xFC28FC1D,0xFC3CFC2F,0xFC5EFC52,0xFC86FC70,0xFCB0FC9F,0xFCC1FCB3,
-0xFCC5FCC5,0xFCDBFCCA,0xFCCFFCCB,0xFCD0FCD0,0xFCE3FCD2,0xFD03FCF2,0xFD26FD10,0xFD60FD3F,
-0xFD98FD7B,0xFDCCFDB5,0xFDEBFDDD,0xFDE5FDF2,0xFDEFFDED,0xFDD8FDDF,0xFDD7FDDC,0xFDCCFDC9,
-0xFDBAFDCA,0xFDB6FDC8,0xFDB2FDB1,0xFDA1FDA8,0xFDA1FDA2,0xFD89FD94,0xFD90FD87,0xFD90FD86,
-0xFDA3FD92,0xFDB1FDA5,0xFDD3FDB6,0xFDFCFDDF,0xFE1BFE0B,0xFE3BFE28,0xFE6DFE5E,0xFE9DFE7E,
-0xFEE0FEBB,0xFF29FF01,0xFFA0FF69,0xFFEFFFC6,0x003A001A,0x007B0064,0x00A60098,0x00CC00BF,
-0x00CE00CA,0x00D700D7,0x010F00F3,0x01460129,0x019F0168,0x020101D3,0x028B0237,0x031502D3,
-0x03B90368,0x045B040E,0x04F104A4,0x05AA054F,0x065005F2,0x06EB06A1,0x0750071E,0x0796077D,
-0x07AE07AD,0x0787079C,0x074E0766,0x06DD0718,0x06390687,0x058D05E2,0x04E20540,0x04260489,
-0x037F03D5,0x02E50328,0x026E029F,0x021F023F,0x01FE0208,0x02020201,0x021E020D,0x024C022E,
-0x02630258,0x02860280,0x02A00298,0x02A302A3,0x029A029D,0x02820292,0x025E027B,0x0207023A,
-0x018901D2,0x00C7012E,0xFFB60044,0xFE63FF13,0xFCE6FDAF,0xFB77FC34,0xFA1FFACE,0xF906F990,
-0xF82BF894,0xF7ACF7EB,0xF765F77E,0xF75FF754,0xF778F761,0xF7ABF78E,0xF802F7DA,0xF872F832,
-0xF8EDF8B2,0xF992F948,0xFA3DF9E8,0xFAEEFA96,0xFB95FB47,0xFC43FBEC,0xFCEFFC91,0xFD84FD34,
-0xFE21FDD7,0xFEB3FE6F,0xFF48FF00,0xFFDDFF95,0x004F0014,0x00AA007C,0x00F700DC,0x01340114,
-0x0156014D,0x015B0153,0x017C016F,0x019B018D,0x01CD01AD,0x021A01F7,0x029E0255,0x032802E6,
-0x03D1037E,0x048E042A,0x054604EA,0x05FE05A5,0x06870653,0x06FF06D6,0x0737072E,0x0725073E,
-0x06AB06F3,0x05E2064D,0x04C2055B,0x0355041A,0x01C10297,0x003300F7,0xFEBAFF7A,0xFD65FE04,
-0xFC41FCCC,0xFB43FBBB,0xFA85FAE7,0xF9D0FA16,0xF925F97B,0xF89DF8D6,0xF855F86B,0xF82EF834,
-0xF832F82A,0xF870F852,0xF8D5F8A0,0xF92CF902,0xF98EF965,0xF9E8F9B9,0xFA2FFA0C,0xFA6BFA3E,
-0xFABCFA90,0xFB0AFADC,0xFB61FB31,0xFBB3FB8D,0xFBF8FBD4,0xFC1DFC11,0xFC34FC34,0xFC3BFC3E,
-0xFC52FC4A,0xFC5EFC4C,0xFC8EFC76,0xFCDCFCBA,0xFD50FD11,0xFDCCFD8A,0xFE57FE0F,0xFEECFE91,
-0xFF8CFF38,0x001EFFD6,0x00AC0063,0x011900E5,0x01880154,0x01E401BC,0x022B020E,0x02500242,
-0x024E0255,0x022F0242,0x01D70209,0x016D01A0,0x0107013C,0x009500CB,0x0037005F,0x000E0026,
-0xFFF40005,0xFFF1FFFA,0xFFECFFF3,0xFFD3FFE1,0xFFB8FFC3,0xFFAEFFB1,0xFF8FFF9C,0xFF87FF90,
-0xFF97FF8C,0xFFB1FFA4,0xFFD4FFBA,0xFFF7FFE2,0x0036000D,0x008A005B,0x00E500B3,0x01440105,
-0x01D10191,0x025A020C,0x030902B3,0x03CD0370,0x04A30437,0x057F0519,0x065A05EC,0x072E06BE,
-0x080C0798,0x08C8086A,0x097D0923,0x0A0D09C4,0x0A7A0A47,0x0AAC0A9D,0x0A8A0AA3,0x0A280A65,
-0x09B609F2,0x091C095E,0x086E08BD,0x07C10807,0x072C0772,0x067B06D3,0x05C30618,0x05290573,
-0x048404D4,0x040A043B,0x03B403E1,0x0380039A,0x0388037A,0x03AD0392,0x03C403B5,0x03BF03C7,
-0x039903B8,0x03480373,0x02CE0312,0x02480287,0x01A701F2,0x012D0162,0x00C600F5,0x006C009E,
-0x00180041,0xFFC3FFED,0xFF69FF90,0xFEE9FF2A,0xFE7CFEA5,0xFE25FE4D,0xFDF3FE09,0xFDE3FDE9,
-0xFDF7FDF5,0xFE10FE06,0xFE0EFE10,0xFDFBFE0B,0xFDCFFDE5,0xFDA2FDBD,0xFD76FD7D,0xFD5FFD64,
-0xFD53FD53,0xFD51FD4A,0xFD50FD52,0xFD16FD34,0xFCB4FCF3,0xFC1CFC75,0xFB3FFBBB,0xFA5FFADC,
-0xF96DF9E0,0xF88BF908,0xF7CEF81F,0xF71FF77E,0xF690F6E4,0xF61EF653,0xF5C1F5E7,0xF572F59E,
-0xF561F561,0xF56BF564,0xF5ADF58B,0xF624F5D8,0xF6D5F677,0xF7A2F733,0xF880F816,0xF960F8EA,
-0xFA46F9DC,0xFB1EFAB6,0xFBD8FB7F,0xFC78FC2D,0xFCCAFC9C,0xFCF7FCDD,0xFCF9FCF9,0xFCD3FCE3,
-0xFC97FCBA,0xFC52FC7A,0xFC06FC26,0xFBC9FBE7,0xFBA3FBBD,0xFB97FB9E,0xFBA1FB94,0xFBC6FBAA,
-0xFC10FBEA,0xFC70FC38,0xFCF8FCAF,0xFD82FD3B,0xFE2BFDD4,0xFEFCFE96,0xFFD1FF68,0x00D60046,
-0x01D3015A,0x02F10261,0x04040374,0x05100486,0x06170595,0x071D0694,0x083B07A5,0x095008D2,
-0x0A8309E9,0x0BB80B20,0x0CD40C4D,0x0DE20D6A,0x0EA10E40,0x0F260EEF,0x0F6E0F5D,0x0F6C0F78,
-0x0F1A0F45,0x0E900ED7,0x0DD90E42,0x0CE80D67,0x0BE30C67,0x0AB30B50,0x095E09FE,0x080308AE,
-0x06940751,0x052405D4,0x03C90470,0x0299032D,0x0184020E,0x009F0111,0xFFD30031,0xFF0BFF72,
-0xFE4FFEAC,0xFD8EFDEC,0xFCD9FD32,0xFC46FC92,0xFBB9FBF2,0xFB4AFB7A,0xFAE8FB17,0xFAA3FAC5,
-0xFA4CFA79,0xFA27FA37,0xFA1CFA1E,0xFA14FA12,0xFA45FA18,0xFAA8FA70,0xFB34FAEA,0xFBF0FB97,
-0xFCDAFC64,0xFDC7FD4E,0xFEEBFE5E,0x0009FF7D,0x014100A1,0x028401E1,0x03A30316,0x04C20433,
-0x05B90540,0x06A20632,0x074906F7,0x07B1078B,0x07D707C8,0x07C707D4,0x076E079F,0x07120741,
-0x068706D8,0x05E20633,0x0527058C,0x047704D0,0x03C80424,0x02F30355,0x021D0292,0x016801B6,
-0x00C90116,0x003C007B,0xFFE00009,0xFFB3FFD1,0xFFAAFFA7,0xFFC4FFA6,0xFFFEFFDC,0x005C0026,
-0x00E20093,0x018E0135,0x025601F5,0x030C02A7,0x03D60376,0x0470042C,0x04E604AE,0x051B0512,
-0x05110522,0x04C304F0,0x04260484,0x035B03BD,0x025802E8,0x012501C3,0xFFD40081,0xFE4AFF16,
-0xFCBEFD84,0xFB1CFBE9,0xF981FA42,0xF802F8AF,0xF6B1F754,0xF5A1F61A,0xF4BAF52B,0xF3F2F449,
-0xF366F3A4,0xF2D6F320,0xF296F2AF,0xF261F275,0xF277F272,0xF2C8F295,0xF32DF2FA,0xF3CBF37B,
-0xF471F421,0xF523F4CE,0xF5C9F56E,0xF66CF617,0xF719F6C3,0xF7D2F772,0xF88CF82B,0xF94EF8E6,
-0xFA08F9B2,0xFAE2FA6E,0xFBB7FB55,0xFC94FC25,0xFD51FCF1,0xFE26FDB1,0xFEE8FE90,0xFFB6FF4A,
-0x007C001C,0x012800D4,0x01DA0183,0x0263021D,0x02C40295,0x030E02EB,0x03420320,0x03750355,
-0x039C038F,0x03C703B0,0x03FB03E8,0x0427040A,0x0442043B,0x04460455,0x0436044C,0x0419042A,
-0x03FD0416,0x03E203F5,0x03FF03F1,0x040D040A,0x04290421,0x0446042E,0x0474045C,0x04850471,
-0x04940488,0x04940496,0x04970497,0x04A7049E,0x04B604B1,0x04C604BF,0x04CF04D4,0x04C004CE,
-0x04A004BD,0x044B047F,0x03CE0412,0x03390382,0x02A402F0,0x0210025A,0x017A01C8,0x00E70127,
-0x00440090,0xFF92FFEC,0xFEBDFF2D,0xFDDFFE54,0xFD1AFD81,0xFC59FCC0,0xFBBAFC0A,0xFB4DFB81,
-0xFAFCFB1F,0xFAF6FAF8,0xFAF5FAEB,0xFB51FB16,0xFBD2FB8B,0xFC6CFC19,0xFD49FCCB,0xFE33FDB8,
-0xFF3BFEBA,0x0054FFC7,0x016600E3,0x025C01E3,0x034102CD,0x03E9039D,0x04530432,0x049D0476,
-0x04B304A7,0x0496049F,0x0468047B,0x042A0447,0x03E40416,0x038C03C8,0x03230356,0x02B302E7,
-0x02560286,0x020E023A,0x01E701FF,0x01E201D5,0x01C401D2,0x01C501C8,0x01C201C2,0x01B001BB,
-0x01720192,0x01380156,0x00F70115,0x00B500D4,0x00710097,0x00400057,0x000B0025,0xFFCDFFEC,
-0xFF92FFAE,0xFF58FF66,0xFF27FF3A,0xFEF5FEFF,0xFEE3FEEA,0xFED3FED7,0xFEE0FED9,0xFEFEFEDF,
-0xFF20FF09,0xFF4BFF2F,0xFF78FF63,0xFFA7FF86,0xFFFAFFCD,0x004F001A,0x00CF008F,0x01580115,
-0x01D70197,0x02590221,0x02BF0295,0x02E402D9,0x02DF02E8,0x02A802C5,0x02440279,0x01BA020D,
-0x01050165,0x005100B2,0xFF87FFEE,0xFEBCFF1D,0xFDEAFE56,0xFD0CFD76,0xFC12FC96,0xFB03FB85,
-0xFA05FA8C,0xF908F991,0xF811F889,0xF72BF7A2,0xF654F6B8,0xF599F5F9,0xF4D6F533,0xF432F484,
-0xF399F3F0,0xF325F353,0xF2D2F2F0,0xF2B0F2B4,0xF2B4F2B2,0xF2DAF2C3,0xF313F2EE,0xF362F32E,
-0xF3C1F386,0xF428F3F9,0xF4A2F45B,0xF507F4E2,0xF594F54B,0xF61AF5E0,0xF6A0F65E,0xF71EF6EA,
-0xF79AF760,0xF805F7CE,0xF845F82D,0xF891F872,0xF8CBF8AE,0xF8F3F8E1,0xF926F90C,0xF938F92E,
-0xF94FF941,0xF964F953,0xF95FF95C,0xF97DF973,0xF9B4F98F,0xF9F9F9D2,0xFA5CFA31,0xFAE4FAA1,
-0xFB92FB36,0xFC5DFBF0,0xFD34FCCB,0xFE33FDAC,0xFF40FEBE,0x0067FFCF,0x01B3010E,0x02F8024A,
-0x044D03A2,0x05BA0502,0x071E066E,0x087307CF,0x09D00921,0x0B040A64,0x0C440BA9,0x0D850CDD,
-0x0EBD0E17,0x102D0F6F,0x11C410EE,0x1394129F,0x15AA149B,0x17E616D1,0x19F518EE,0x1BB91AE5,
-0x1D211C82,0x1DD11D92,0x1DFC1DEE,0x1DDB1DF9,0x1D461D9C,0x1C5E1CDB,0x1B5A1BE6,0x1A111ABA,
-0x1883195E,0x1691178E,0x146A1586,0x11EB1332,0x0F52109F,0x0CB40E0C,0x0A390B6F,0x07CF08FF,
-0x055D0691,0x02FE0430,0x00AF01DE,0xFE58FF77,0xFC1EFD31,0xFA26FB14,0xF854F929,0xF6EEF799,
-0xF5E0F662,0xF4E3F561,0xF40EF47E,0xF367F3C0,0xF2BDF318,0xF22AF273,0xF198F1E3,0xF122F161,
-0xF0D8F0F8,0xF095F0B3,0xF071F074,0xF061F069,0xF072F061,0xF07CF06F,0xF0C5F0A0,0xF14BF103,
-0xF1E3F18D,0xF2A8F244,0xF391F315,0xF469F407,0xF570F4EB,0xF668F5E7,0xF76EF6E9,0xF8A6F809,
-0xF9EDF93D,0xFB28FA8F,0xFC59FBC7,0xFD6AFCE4,0xFE4AFDE0,0xFEECFE9D,0xFF5DFF2E,0xFFACFF89,
-0xFFDAFFBD,0x000AFFFA,0x003F001E,0x006B0054,0x00740074,0x007F007E,0x00700070,0x00650067,
-0x0070005E,0x00670068,0x0095007D,0x00DA00B2,0x0149010D,0x01D1018C,0x025C0219,0x030502AE,
-0x03A10355,0x043E03E9,0x04CE0487,0x05320504,0x059F0568,0x05E005CB,0x060405F4,0x060A0604,
-0x060C060B,0x05E905FD,0x05B205CE,0x056A0593,0x050B0540,0x04BA04E9,0x04560480,0x03F0041B,
-0x038E03BF,0x03310363,0x02D30301,0x028B02B4,0x023D026A,0x01E90219,0x01A401C3,0x0157017C,
-0x00E40121,0x007500AE,0x0000003A,0xFF71FFBC,0xFEEBFF2D,0xFE47FE8E,0xFD8EFDF3,0xFCC5FD2D,
-0xFBF8FC64,0xFB28FB8E,0xFA55FACB,0xF993F9FC,0xF8CEF92E,0xF83EF884,0xF7CBF808,0xF781F7A3,
-0xF766F763,0xF77DF775,0xF7CDF78D,0xF851F803,0xF90BF8A5,0xF9DEF969,0xFABDFA45,0xFBC4FB43,
-0xFCCAFC45,0xFDE0FD57,0xFF15FE6A,0x0055FFB4,0x019700F7,0x02E9023C,0x04220381,0x055704B6,
-0x066A05E0,0x077306F2,0x085607F4,0x092A08C8,0x09E4098B,0x0A9A0A4C,0x0B400AF2,0x0BD60B8D,
-0x0C560C14,0x0CC60C8B,0x0CF60CE8,0x0D100D08,0x0D080D15,0x0CC50CE9,0x0C5A0C8F,0x0BD60C18,
-0x0B210B81,0x0A3F0ABA,0x093509BB,0x07FB08A1,0x0699074A,0x053705E7,0x03D8048B,0x02920329,
-0x01760200,0x008100F9,0xFFC30018,0xFF1CFF68,0xFE9CFEDC,0xFE23FE5F,0xFDB1FDE4,0xFD6BFD85,
-0xFD36FD48,0xFD1BFD26,0xFD2DFD1D,0xFD2EFD3E,0xFD4FFD48,0xFD51FD55,0xFD4BFD56,0xFD1FFD36,
-0xFD11FD16,0xFCE5FCF8,0xFCF1FCE2,0xFD0FFCFF,0xFD3CFD24,0xFD6DFD4D,0xFDACFD90,0xFDE1FDC3,
-0xFDF8FDED,0xFE11FE0F,0xFE0FFE0E,0xFE0EFE09,0xFE11FE11,0xFDFDFE04,0xFDCEFDE8,0xFD79FDA3,
-0xFCF0FD33,0xFC4FFC90,0xFBA8FBF7,0xFAFDFB4C,0xFA58FAA7,0xF9CAFA0B,0xF955F98E,0xF8F0F922,
-0xF890F8C6,0xF820F857,0xF7C3F7FA,0xF78AF7A3,0xF7A1F78F,0xF7AFF79E,0xF7E0F7BF,0xF83DF80B,
-0xF8B0F868,0xF8FAF8D3,0xF937F90B,0xF96EF956,0xF98AF980,0xF9D0F9B1,0xFA0CF9F2,0xFA62FA33,
-0xFAC2FA8D,0xFB27FAF9,0xFB7DFB63,0xFBE3FBBE,0xFC39FC11,0xFC80FC59,0xFCE1FCB0,0xFD62FD1E,
-0xFE15FDB1,0xFEE7FE7A,0xFFDAFF61,0x00E0005B,0x01F4016A,0x03060275,0x042D03A4,0x054E04C0,
-0x066905E2,0x079C0702,0x08B4082A,0x09C70948,0x0AC10A48,0x0B950B31,0x0C300BE5,0x0C8B0C64,
-0x0CA10C9C,0x0C700C93,0x0BEA0C35,0x0B170B90,0x09F30A93,0x088E0944,0x06DD07C4,0x05240605,
-0x03440433,0x0183025A,0xFFCF00AB,0xFE47FEFD,0xFD05FDA7,0xFBF2FC6D,0xFB1EFB7C,0xFA6DFAB3,
-0xF9E4FA17,0xF974F9A8,0xF918F941,0xF8D7F8F4,0xF8C8F8D1,0xF8BAF8C5,0xF8BFF8BA,0xF8D4F8C8,
-0xF8E0F8DD,0xF8E6F8EF,0xF8DAF8DC,0xF8D1F8D6,0xF8AEF8C9,0xF88EF89C,0xF875F87C,0xF870F879,
-0xF85AF85C,0xF83AF849,0xF833F827,0xF81DF822,0xF844F828,0xF85DF843,0xF8B1F885,0xF91EF8E5,
-0xF9A1F95D,0xFA35F9E5,0xFAE7FA8F,0xFBA5FB48,0xFC76FC12,0xFD5AFCEB,0xFE52FDD2,0xFF3DFEC2,
-0x001CFFAD,0x00FE0090,0x01BB0163,0x02710220,0x031902C8,0x039B035F,0x041B03E2,0x04960461,
-0x04FA04C7,0x05530527,0x05AA0580,0x05F805D0,0x0641061B,0x06670651,0x068A0675,0x06B906A5,
-0x06DB06CB,0x06FC06F0,0x071F071B,0x074A072D,0x076B075E,0x07A10786,0x07E207C0,0x08280803,
-0x086F084D,0x08BC089B,0x08F508E5,0x091A0907,0x09200915,0x090C0916,0x08DA08F3,0x088E08C0,
-0x08300861,0x07AB07E8,0x07260763,0x067506C6,0x05CE062A,0x05180568,0x047204C0,0x03ED042E,
-0x038D03B9,0x03410361,0x03060324,0x02EA02FF,0x02E002E4,0x02F802E4,0x030902FC,0x031C0309,
-0x032A0324,0x031E0324,0x03090317,0x02BF02ED,0x0235027B,0x017101D2,0x00870102,0xFF6F0003,
-0xFE39FED1,0xFD0AFD9C,0xFBC7FC74,0xFAA8FB34,0xF989FA14,0xF877F905,0xF783F7FA,0xF6C0F720,
-0xF5F9F65D,0xF562F59E,0xF4E6F51E,0xF49EF4BD,0xF471F480,0xF44EF44B,0xF435F437,0xF44AF43E,
-0xF472F45E,0xF4B3F48E,0xF4FCF4D6,0xF54EF526,0xF5ADF584,0xF602F5DA,0xF654F62E,0xF698F671,
-0xF6E0F6B6,0xF728F702,0xF767F741,0xF7B1F788,0xF7F4F7C7,0xF845F813,0xF8AEF870,0xF93EF8FE,
-0xF9DBF98C,0xFA84FA37,0xFB1EFAD5,0xFBD5FB72,0xFC92FC34,0xFD3AFCE2,0xFE10FDAC,0xFED4FE68,
-0xFFA8FF3F,0x0092001D,0x017D0109,0x025901E4,0x032B02C7,0x03ED0390,0x0497043E,0x053D04F2,
-0x05DE058D,0x0687062D,0x071C06D2,0x07BA0765,0x083A07F8,0x08AE086F,0x090008CE,0x092D0915,
-0x09590950,0x09720971,0x0982097E,0x09670979,0x095E096E,0x093F094E,0x09070920,0x08B408DB,
-0x08440886,0x07DD0811,0x075C079E,0x06E8071C,0x067C06AC,0x06020642,0x057D05B6,0x04DB052D,
-0x0433048F,0x035F03CF,0x028C02FA,0x01B30216,0x00BB0141,0xFFBD0035,0xFEBAFF36,0xFD9AFE2B,
-0xFC88FD15,0xFB8AFC0C,0xFAA0FB18,0xF9CCFA24,0xF91AF968,0xF895F8CE,0xF828F85B,0xF7F3F808,
-0xF7B3F7D5,0xF7A1F7A2,0xF7A8F7A3,0xF7CFF7C4,0xF816F7E1,0xF87CF84B,0xF90CF8C0,0xF9BFF958,
-0xFA8DFA2C,0xFB4AFAEA,0xFC0CFBAD,0xFCD8FC77,0xFDADFD46,0xFE7BFE1E,0xFF62FEED,0x0050FFD7,
-0x014900C9,0x023C01BE,0x031D02B5,0x03E00381,0x04830441,0x050E04CA,0x05820553,0x05DA05AF,
-0x06370607,0x068C0665,0x06C606A5,0x070906E5,0x0742071A,0x07720756,0x07950785,0x07B4079B,
-0x07DD07CF,0x07F807EB,0x08100809,0x083B0829,0x0857084D,0x08670855,0x085B0868,0x082C083C,
-0x07EF080E,0x078007CA,0x0713074C,0x068C06D7,0x05E40635,0x052D0588,0x044304BB,0x035803D0,
-0x025902D1,0x015701D5,0x005F00D5,0xFF7EFFEB,0xFEAFFF10,0xFE08FE5A,0xFD6AFDBC,0xFCF8FD30,
-0xFC93FCB6,0xFC3DFC5E,0xFBF2FC18,0xFBA4FBD2,0xFB78FB95,0xFB67FB71,0xFB48FB5A,0xFB3AFB3B,
-0xFB31FB39,0xFB2AFB2C,0xFB08FB1D,0xFAE7FAF5,0xFABDFACE,0xFA81FAA7,0xFA50FA6D,0xFA33FA49,
-0xFA03FA21,0xF9F5F9FE,0xF9F6F9F4,0xFA07F9FC,0xFA27FA10,0xFA7EFA52,0xFAF8FAAF,0xFB98FB40,
-0xFC45FBEA,0xFD1AFCB7,0xFDFEFD89,0xFEE9FE6A,0xFFC5FF5A,0x00850028,0x013D00EB,0x01E80199,
-0x027D0236,0x030402BC,0x0372033B,0x03B00397,0x03CF03C0,0x03C503C2,0x039B03B0,0x0349036D,
-0x02C70311,0x023B0286,0x01A501E5,0x010F0158,0x005F00B5,0xFFB00005,0xFF04FF5B,0xFE5AFEAA,
-0xFDB7FE06,0xFCF3FD53,0xFC45FC97,0xFBB5FBFC,0xFB3AFB6F,0xFAE2FB04,0xFA9CFAB6,0xFA71FA84,
-0xFA82FA77,0xFA97FA88,0xFAD4FAB6,0xFB38FB0B,0xFBB4FB73,0xFC38FBEF,0xFCE6FC8E,0xFDB8FD48,
-0xFE88FE19,0xFF6EFEF6,0x003DFFCD,0x012100B0,0x01EF0188,0x02AB0249,0x034C0306,0x03D50392,
-0x04330410,0x04880467,0x04BE04AB,0x04D604CF,0x04EE04E2,0x04E704E5,0x04DF04E2,0x04CD04DC,
-0x049C04B5,0x048A048E,0x04580479,0x04200441,0x03DA0413,0x03AA03BF,0x03680385,0x03230342,
-0x0305030D,0x02E102F6,0x02D802D8,0x02DA02D6,0x02E102DD,0x02E102E3,0x02D002DD,0x02B402C9,
-0x028B02AD,0x0261027C,0x02400250,0x02280228,0x0210021A,0x020E020B,0x02070209,0x01FC0203,
-0x020C0207,0x0217020E,0x02330223,0x02700253,0x02AE028A,0x032102E4,0x03A50358,0x042D03E9,
-0x04C80476,0x0554050D,0x05CE0590,0x062F0607,0x067E0666,0x06B306A8,0x06CC06CD,0x06AE06C6,
-0x06690694,0x05C2061E,0x04DD0558,0x03B60454,0x02570311,0x00E501B1,0xFF68002B,0xFE09FEAE,
-0xFCB6FD56,0xFB87FC17,0xFA7BFAF6,0xF99EFA0D,0xF8FFF944,0xF88BF8AC,0xF841F853,0xF83DF82D,
-0xF851F846,0xF894F867,0xF8E2F8BA,0xF944F910,0xF9C1F986,0xFA37F9F8,0xFAA1FA65,0xFAFDFACB,
-0xFB54FB33,0xFBAEFB7C,0xFC06FBDF,0xFC5AFC36,0xFCAAFC80,0xFCE7FCC3,0xFD31FD04,0xFD81FD5D,
-0xFDD1FDA4,0xFE24FE00,0xFE7AFE50,0xFEC6FEA3,0xFF22FEF2,0xFF79FF58,0xFFBDFFA2,0xFFF4FFE2,
-0x002B0014,0x00510045,0x0071005D,0x0087007F,0x00820086,0x00670084,0x002F0050,0xFFDFFFFE,
-0xFF68FFB0,0xFEDFFF23,0xFE3DFE90,0xFD90FDEB,0xFCD8FD34,0xFC27FC7D,0xFB6DFBC5,0xFAC0FB18,
-0xFA15FA68,0xF985F9CC,0xF911F948,0xF8A6F8D8,0xF84FF87B,0xF81DF836,0xF7F5F808,0xF7F2F7F4,
-0xF7E7F7F3,0xF7F8F7F6,0xF7F7F7FA,0xF7F5F7ED,0xF80CF804,0xF80EF80A,0xF83BF81B,0xF876F84F,
-0xF8D1F8AA,0xF92FF8FA,0xF9A9F973,0xFA0AF9D9,0xFA84FA40,0xFAE6FAAB,0xFB45FB0A,0xFBA2FB73,
-0xFBFFFBD6,0xFC7CFC42,0xFCEFFCBD,0xFD8AFD41,0xFE15FDC8,0xFEC0FE66,0xFF58FF18,0xFFF8FFAD,
-0x00B00055,0x0168010A,0x023D01D1,0x032102AD,0x040B039E,0x04F9047F,0x05D70565,0x06B9064B,
-0x07860721,0x084207E1,0x0902089F,0x09CD0969,0x0AAC0A39,0x0B930B22,0x0C960C0A,0x0D8F0D0E,
-0x0E720E01,0x0F340EDA,0x0FDB0F8A,0x104C101E,0x108E1070,0x1095108E,0x106A108F,0x0FF9103F,
-0x0F5A0FB1,0x0E640EE1,0x0D5B0DDF,0x0C1A0CC6,0x0ACD0B71,0x09980A37,0x085608F2,0x074207CE,
-0x063E06B8,0x053705B6,0x042B04A8,0x032E03AA,0x022C02AD,0x013501A8,0x005000C5,0xFF8AFFEC,
-0xFEF6FF38,0xFE6FFEAB,0xFE05FE36,0xFDAAFDD7,0xFD65FD87,0xFD22FD50,0xFCEDFD00,0xFCB8FCD4,
-0xFCA8FCB7,0xFCA1FCAA,0xFCA4FCA4,0xFC95FCA3,0xFC85FC9B,0xFC55FC6E,0xFC18FC39,0xFBD0FBEF,
-0xFB8DFBAB,0xFB56FB68,0xFB10FB2B,0xFAEAFAF8,0xFAC5FADC,0xFAA7FABA,0xFA6EFA9A,0xFA32FA4E,
-0xF9EAFA11,0xF994F9C9,0xF93AF96C,0xF8F3F91B,0xF8A7F8CB,0xF854F874,0xF815F833,0xF7D6F7F3,
-0xF79BF7B0,0xF75AF775,0xF715F730,0xF6EEF6EF,0xF6F3F6E6,0xF718F6FD,0xF75EF740,0xF7BDF793,
-0xF812F7E8,0xF874F849,0xF8DAF8A5,0xF93AF909,0xF99BF963,0xF9FAF9D1,0xFA5DFA34,0xFAD6FA94,
-0xFB50FB17,0xFBBBFB85,0xFC22FBE4,0xFC8CFC5E,0xFCF1FCAD,0xFD5BFD2F,0xFDACFD81,0xFE13FDDE,
-0xFE52FE36,0xFEA8FE79,0xFED5FEC5,0xFF08FEF7,0xFF2DFF20,0xFF3FFF37,0xFF67FF59,0xFF7DFF7C,
-0xFFA0FF88,0xFFCAFFC0,0xFFE3FFDE,0x0008FFFD,0x00190016,0x00280018,0x001D0022,0x0025001F,
-0x00300027,0x00410031,0x003C0038,0x0061004D,0x009B0081,0x00C300A5,0x00F700D6,0x01410117,
-0x01980173,0x01ED01CE,0x026F023B,0x02F102AE,0x0381032F,0x03FC03B6,0x04910449,0x050E04C2,
-0x057B054A,0x05E205A7,0x062705FA,0x0678065A,0x06B306A9,0x06F406DC,0x071B070F,0x0752072E,
-0x0779076B,0x07760778,0x076F0777,0x07320751,0x06D00705,0x065A0695,0x05BA0609,0x0504055B,
-0x045204A7,0x03A003F3,0x02E40347,0x02160279,0x015F01B7,0x00BC010C,0x00380076,0xFFD10000,
-0xFF91FFA6,0xFF5CFF6E,0xFF45FF44,0xFF41FF3E,0xFF55FF50,0xFF79FF6D,0xFFABFF96,0xFFE8FFC4,
-0x004F0019,0x00CC008B,0x015A0117,0x01FF01A8,0x02BD0258,0x038B0326,0x045E03F4,0x052A04C4,
-0x061A05A7,0x06F00692,0x07D60757,0x08940830,0x096008FF,0x09F409B2,0x0A7E0A33,0x0AC80AAF,
-0x0B060AF3,0x0B000B06,0x0ADE0AF1,0x0AA50AC5,0x0A340A77,0x099109E1,0x08C7092E,0x07CF0859,
-0x06B60753,0x057A0621,0x042F04DA,0x02B30376,0x01450201,0xFFE40094,0xFE82FF33,0xFD30FDE0,
-0xFC01FC92,0xFAEEFB6D,0xF9FDFA68,0xF939F994,0xF89DF8EB,0xF83FF869,0xF813F824,0xF80AF80D,
-0xF805F80A,0xF827F814,0xF858F83B,0xF877F85F,0xF8B8F891,0xF907F8E2,0xF960F925,0xF9C9F993,
-0xFA38FA01,0xFAB1FA73,0xFB14FAE3,0xFB5DFB3A,0xFB9EFB82,0xFBBEFBBB,0xFBCAFBBB,0xFB94FBAD,
-0xFB58FB72,0xFB24FB41,0xFAE6FB04,0xFA95FABC,0xFA52FA75,0xFA3EFA46,0xFA2AFA27,0xFA37FA1C,
-0xFA45FA4A,0xFA5BFA51,0xFAB5FA87,0xFAFFFAE0,0xFB64FB2E,0xFBCFFB97,0xFC4AFC06,0xFCBFFC8A,
-0xFD2EFCF6,0xFD9CFD6A,0xFDEDFDC8,0xFE2FFE14,0xFE64FE55,0xFE62FE68,0xFE62FE69,0xFE4DFE4D,
-0xFE1EFE3A,0xFDDCFDFA,0xFD9AFDAE,0xFD52FD7B,0xFD07FD2F,0xFCC1FCDE,0xFC89FCAB,0xFC5BFC6C,
-0xFC3DFC55,0xFC42FC39,0xFC70FC4F,0xFCAEFC8F,0xFD16FCE2,0xFDACFD5F,0xFE53FE00,0xFEF0FE9A,
-0xFFA3FF46,0x0046FFFC,0x00FE00A5,0x01A90150,0x025601F8,0x02F102A1,0x038F0341,0x041B03D7,
-0x04A70464,0x051B04E6,0x0598055C,0x05FB05C7,0x06670633,0x06D206A0,0x073C0701,0x07A20765,
-0x081F07E2,0x0895085E,0x08FA08C4,0x093C091C,0x0953094F,0x092E0947,0x08DA0914,0x084D089C,
-0x078807E3,0x06B4071B,0x05BA0636,0x04AF0539,0x038C0422,0x027902FF,0x016501ED,0x005A00E0,
-0xFF65FFDA,0xFE6AFEE6,0xFD97FDFB,0xFCC2FD27,0xFC15FC6A,0xFB78FBBE,0xFAF5FB3E,0xFA79FAB8,
-0xFA08FA44,0xF9A2F9DF,0xF95CF97C,0xF929F93D,0xF913F91C,0xF924F917,0xF957F934,0xF99EF977,
-0xF9E5F9CC,0xFA42FA18,0xFAB3FA80,0xFB2AFAF1,0xFBB0FB6E,0xFC5DFBFF,0xFCFFFCAC,0xFDB4FD59,
-0xFE6BFE16,0xFF08FEAF,0xFFB2FF54,0x00560008,0x00F900A0,0x01920144,0x021D01D4,0x02B30267,
-0x033202EC,0x039B0373,0x03EA03C4,0x04250414,0x04430436,0x045D044D,0x04680468,0x0467046A,
-0x0470046C,0x046E046C,0x045A045F,0x044E045C,0x043F044D,0x042F0441,0x04000413,0x03D103F1,
-0x03B103C9,0x039F03A5,0x0377038F,0x034C0364,0x03190336,0x0300030B,0x02D102EA,0x02B302BD,
-0x029702A2,0x028C0299,0x02970295,0x02A002A9,0x028C0297,0x027D0287,0x025B026B,0x020F0239,
-0x019901CE,0x012E0170,0x00C300FA,0x0049008B,0xFFDD0011,0xFF6EFF9F,0xFEF4FF39,0xFE8FFED0,
-0xFE1CFE56,0xFDA4FDE6,0xFD1CFD63,0xFC9FFCD4,0xFC14FC66,0xFB9EFBD6,0xFB26FB61,0xFA9CFAE4,
-0xFA0AFA5A,0xF95AF9B2,0xF8A5F901,0xF7EBF852,0xF733F797,0xF68DF6E1,0xF625F64F,0xF5D0F5EF,
-0xF5A0F5B7,0xF598F59C,0xF5CDF5B6,0xF617F5EE,0xF682F644,0xF724F6C3,0xF7E3F784,0xF8DCF85F,
-0xF9E2F960,0xFB0AFA68,0xFC42FBA2,0xFD74FCD5,0xFEA6FE11,0xFFCAFF39,0x00BF0045,0x01B70142,
-0x029F0235,0x03520300,0x03ED03A7,0x047C0438,0x04F804BC,0x05590527,0x05C50594,0x060E05EF,
-0x06730641,0x06E206B1,0x07580727,0x07C8078D,0x0854080E,0x08C3088D,0x092E08F8,0x09850962,
-0x09B509A3,0x09BC09B9,0x09A309BB,0x096D0983,0x090A094A,0x087A08D4,0x07DF0830,0x072B077F,
-0x065406C6,0x057C05EA,0x04960509,0x03BD0428,0x02EA0348,0x021B0283,0x015301B5,0x00A000F8,
-0xFFDC003F,0xFF43FF92,0xFEA5FEFE,0xFE13FE56,0xFD7FFDC8,0xFD04FD3B,0xFC9DFCCB,0xFC3DFC70,
-0xFC06FC21,0xFBD3FBF4,0xFBAAFBC0,0xFB7EFB93,0xFB65FB6F,0xFB56FB67,0xFB51FB52,0xFB62FB57,
-0xFB72FB63,0xFB9EFB89,0xFBD3FBB7,0xFC10FBEA,0xFC53FC1E,0xFC9FFC6C,0xFCE9FCBE,0xFD47FD13,
-0xFDB8FD7A,0xFE24FDE9,0xFEA0FE5F,0xFF2AFEE4,0xFFAEFF70,0x0030FFED,0x00B20078,0x01360104,
-0x01A2016E,0x021701DE,0x026D0241,0x02CB0298,0x031002EE,0x034D0323,0x03A10380,0x03CB03B1,
-0x040303D5,0x04250410,0x043A0437,0x0451043E,0x0451045C,0x04420453,0x04330442,0x03F50415,
-0x03A703CD,0x033F036E,0x02CA02FC,0x024C0286,0x01C80208,0x0142017D,0x00B200F2,0x00210061,
-0xFF8CFFCE,0xFF01FF49,0xFE71FEB8,0xFDF3FE36,0xFD80FDBB,0xFD2CFD4D,0xFCFBFD1D,0xFCD2FCE5,
-0xFCD4FCCC,0xFCC9FCD2,0xFCE0FCD1,0xFD01FCED,0xFD23FD0A,0xFD4DFD30,0xFD88FD70,0xFDCFFDAB,
-0xFE21FDF3,0xFE71FE46,0xFECFFE9E,0xFF0DFEEF,0xFF38FF34,0xFF52FF49,0xFF5BFF54,0xFF3CFF4C,
-0xFF1EFF2F,0xFEF0FF11,0xFE9CFEC5,0xFE55FE71,0xFDE0FE17,0xFD6AFDA1,0xFD06FD32,0xFCC4FCE3,
-0xFC83FCA5,0xFC5FFC6D,0xFC61FC5B,0xFC6EFC66,0xFC7FFC71,0xFCAEFC8E,0xFCDDFCC5,0xFD1AFD00,
-0xFD48FD3E,0xFD9CFD75,0xFDC9FDB9,0xFE01FDE9,0xFE17FE05,0xFE1FFE15,0xFE15FE24,0xFDF9FE07,
-0xFDCAFDEA,0xFDB2FDBC,0xFD89FD9A,0xFD88FD96,0xFD84FD90,0xFDA6FD96,0xFDBAFDAE,0xFDE0FDCE,
-0xFE2CFE02,0xFE58FE3C,0xFEA4FE83,0xFEFBFECD,0xFF54FF24,0xFFBFFF88,0x001EFFDD,0x00890052,
-0x00E600BC,0x01350117,0x01810164,0x01C701A4,0x020601E5,0x022F0221,0x0253023E,0x027F0271,
-0x02880283,0x02A0028E,0x02AC02A1,0x029102A0,0x02740283,0x025C0268,0x023F024C,0x02200225,
-0x021D0221,0x021C0216,0x02350226,0x0246023F,0x025C0255,0x0266025E,0x0270026A,0x026E027A,
-0x02600262,0x025C0260,0x024E024D,0x024B024D,0x02640252,0x02600261,0x0251025A,0x023F024B,
-0x021C0231,0x02140222,0x0205020D,0x01F001F1,0x01F301EB,0x01F701FA,0x01F401F9,0x01F401F5,
-0x01E001E7,0x01AA01C2,0x01810193,0x01510167,0x01200135,0x00F000F8,0x00B800D4,0x009700AF,
-0x005F0080,0x00210039,0xFFD5FFFA,0xFF86FFAD,0xFF1EFF58,0xFECFFEFA,0xFE62FE8B,0xFE0EFE33,
-0xFDBCFDD8,0xFD75FD9B,0xFD3BFD59,0xFD14FD2A,0xFCE1FCF8,0xFCC6FCCC,0xFCACFCBB,0xFCB0FCA2,
-0xFCC0FCB5,0xFCD7FCC7,0xFD23FCF2,0xFD66FD44,0xFDBCFD93,0xFE3FFDFB,0xFEB4FE73,0xFF3FFEF4,
-0xFFC7FF74,0x00510007,0x00DB009D,0x0150011E,0x01B90189,0x022201F6,0x0284025B,0x02DF02AB,
-0x032F0310,0x038D036C,0x03D603B2,0x040D03FD,0x0427041F,0x043A0439,0x040D0436,0x03CA03EF,
-0x037803AA,0x03120345,0x02A302CB,0x0252027A,0x01E3021D,0x01A501CF,0x016C017B,0x011A013F,
-0x00E80102,0x00BD00CE,0x009800AD,0x0086008A,0x0074007C,0x008B0079,0x00A40090,0x00C300C5,
-0x00DD00D5,0x00E300E3,0x00F400EB,0x00F000FB,0x00E200F3,0x00E200F3,0x00C100D1,0x009000AC,
-0x0046006E,0xFFD0000C,0xFF2EFF85,0xFE62FEC6,0xFD83FDF7,0xFC7CFD06,0xFB7CFBF0,0xFA7EFAF8,
-0xF99BFA01,0xF8DEF93D,0xF82EF885,0xF781F7DD,0xF700F742,0xF68FF6CE,0xF651F66D,0xF62CF63A,
-0xF633F630,0xF660F645,0xF68EF675,0xF6E0F6BA,0xF743F717,0xF7AAF76C,0xF818F7DA,0xF89DF853,
-0xF944F8EF,0xF9F8F995,0xFAB8FA58,0xFB8AFB1E,0xFC69FC03,0xFD38FCDB,0xFDF5FD9F,0xFE9FFE54,
-0xFF3FFEF1,0xFFCCFF87,0x00500007,0x00C80082,0x014E0104,0x01BA0180,0x021701DC,0x0266023F,
-0x02AF0289,0x02F902D4,0x033C031B,0x039C0364,0x03F803CF,0x045B0422,0x04DF0499,0x055A051C,
-0x05D10590,0x0664061F,0x06D706A3,0x076A072B,0x07E907AD,0x0875082E,0x08EA08A5,0x0942091D,
-0x09840965,0x09A1099B,0x09B409AE,0x098809A3,0x09440967,0x08F0091E,0x089508C3,0x08410873,
-0x07FE0821,0x07BE07D2,0x076C0789,0x073C074F,0x06FF071E,0x06AF06CF,0x06700686,0x063A064D,
-0x05F8061A,0x05C905D6,0x0575059E,0x05120548,0x049204DC,0x03D60431,0x03070370,0x020B0286,
-0x00FA0182,0xFFE10070,0xFECFFF5B,0xFDB3FE46,0xFCB8FD37,0xFBD8FC4D,0xFB14FB7A,0xFA73FAC4,
-0xF9F6FA30,0xF994F9BF,0xF950F969,0xF929F93A,0xF92EF925,0xF955F93B,0xF98AF96A,0xF9C9F9AB,
-0xFA2EFA07,0xFAB7FA6D,0xFB47FB06,0xFBF7FB9C,0xFCB3FC57,0xFD7EFD1B,0xFE55FDE6,0xFF1AFEB7,
-0xFFE6FF7D,0x00B50053,0x016F0108,0x022D01C8,0x02E3028E,0x03920334,0x043603DF,0x04C50474,
-0x05440501,0x05B50574,0x060D05DE,0x0644062B,0x06730661,0x06800683,0x06870680,0x065F066C,
-0x061A0638,0x05A605DD,0x050F0561,0x044304AE,0x035503CA,0x025202D3,0x015801D3,0x004B00CD,
-0xFF56FFC8,0xFE6BFEDA,0xFD94FDF9,0xFCB7FD17,0xFBEDFC4C,0xFB3CFB8A,0xFA93FAE5,0xFA20FA57,
-0xF9C2F9EE,0xF979F99A,0xF94DF961,0xF923F938,0xF914F910,0xF901F907,0xF8FFF8F1,0xF905F8FF,
-0xF928F913,0xF962F948,0xF9ADF986,0xFA03F9DA,0xFA43FA25,0xFA81FA64,0xFAAAFA96,0xFACAFABF,
-0xFAC9FAD2,0xFAC8FAC7,0xFABCFAC1,0xFAB8FABD,0xFAC4FAC8,0xFAD2FAD4,0xFAE0FADC,0xFB23FAFE,
-0xFB53FB33,0xFB96FB73,0xFBC2FB9F,0xFC26FBF8,0xFC69FC52,0xFCCEFC97,0xFD2BFD01,0xFD7DFD55,
-0xFDB1FD9F,0xFDDEFDC3,0xFDF4FDE7,0xFE03FDF7,0xFE01FE00,0xFE02FDF6,0xFE08FE02,0xFE10FE12,
-0xFE28FE21,0xFE44FE40,0xFE64FE58,0xFE8CFE80,0xFEA7FE9A,0xFEF4FECF,0xFF4AFF22,0xFF88FF69,
-0x0007FFB9,0x008A0041,0x010900CD,0x018A0144,0x020D01CD,0x0288024C,0x02F702C2,0x03700335,
-0x03D503B0,0x0440040C,0x04A40477,0x050004D0,0x055A0534,0x05920578,0x05A505A1,0x05C505B1,
-0x05CF05C7,0x05E405E1,0x060305FB,0x06520628,0x06BF067D,0x073A0702,0x07B80770,0x08530805,
-0x08C30889,0x093C08F9,0x09C50985,0x0A2D09FC,0x0A820A57,0x0AB90A9A,0x0ACC0AC8,0x0AA70AC9,
-0x0A3D0A7A,0x099A09FF,0x08D40949,0x07D70860,0x06C90754,0x05BE0636,0x049B052B,0x0384040E,
-0x024E02EB,0x012B01BA,0xFFFA0091,0xFEBDFF5C,0xFD7CFE1A,0xFC62FCEB,0xFB4DFBD5,0xFA5AFACD,
-0xF987F9E6,0xF8CBF929,0xF82DF87A,0xF7ADF7F1,0xF741F778,0xF6EFF71B,0xF6E8F6EA,0xF6E1F6D8,
-0xF71DF6EC,0xF763F730,0xF7D1F78B,0xF85DF810,0xF902F8A8,0xF9B9F953,0xFA8DFA1D,0xFB58FAF4,
-0xFC4AFBCD,0xFD3FFCD0,0xFE30FDBB,0xFF12FEB0,0xFFD8FF7E,0x008A0033,0x010800CB,0x01630137,
-0x01990189,0x019F0199,0x017F0193,0x01250155,0x009A00EC,0x0001004F,0xFF33FF9A,0xFE54FEC1,
-0xFD5AFDD4,0xFC6BFCD6,0xFB94FBFA,0xFAC8FB2A,0xFA0EFA6B,0xF966F9C7,0xF8C9F918,0xF829F87C,
-0xF7B0F7EE,0xF737F76D,0xF6E8F710,0xF6C5F6D7,0xF6B4F6BC,0xF6D3F6BD,0xF6F2F6DC,0xF727F705,
-0xF764F746,0xF7A7F786,0xF807F7D7,0xF87CF839,0xF90DF8C2,0xF9B5F95B,0xFA81FA1C,0xFB4FFAE7,
-0xFC2EFBBC,0xFD1BFCA6,0xFE1CFD9D,0xFF13FE9A,0x000EFF8F,0x012500A1,0x021C01A0,0x032E02A2,
-0x043403B7,0x052904AE,0x06040599,0x06C8066F,0x07760726,0x081007C8,0x088A0852,0x08FB08C2,
-0x09700935,0x09DF09AE,0x0A2B0A0A,0x0A660A4B,0x0A770A6D,0x0A570A64,0x0A1B0A37,0x09C809EE,
-0x094E0988,0x08F10924,0x087E08B7,0x08190843,0x07BD07E5,0x075F078A,0x07020733,0x06C506E2,
-0x067C06A3,0x06410660,0x05F4061D,0x05AF05CE,0x05550583,0x04E90523,0x045E04A9,0x03B80413,
-0x02FE0367,0x022B029C,0x015D01C8,0x008200EE,0xFFB40024,0xFEF5FF55,0xFE4EFEA7,0xFDABFE00,
-0xFD09FD51,0xFC8FFCCA,0xFC23FC54,0xFBDFFBF3,0xFBC0FBCD,0xFBC6FBD1,0xFBDAFBCF,0xFC05FBEF,
-0xFC26FC17,0xFC54FC48,0xFC69FC67,0xFC84FC7B,0xFC9AFC96,0xFCB2FCAA,0xFCE0FCC8,0xFCF7FCD9,
-0xFD11FD0B,0xFD2EFD1D,0xFD5EFD3D,0xFD6EFD60,0xFDA2FD85,0xFDC2FDB8,0xFDE1FDCB,0xFE14FDFC,
-0xFE62FE36,0xFEB6FE92,0xFF27FEF0,0xFFA6FF70,0x0025FFF5,0x00A40072,0x011300E5,0x0178014F,
-0x01C401A2,0x021001E9,0x02590236,0x028B026C,0x02BA02A3,0x02D902D3,0x02E802E8,0x02F002F1,
-0x02E402F2,0x02DA02E0,0x02DF02DF,0x02E902E0,0x02F502E9,0x02F102EA,0x02F302ED,0x02F202E8,
-0x02E002EB,0x02CE02DB,0x02C602CD,0x02C102B7,0x02B202B0,0x02C602B9,0x02E602DB,0x030C02F5,
-0x032C0318,0x032C0326,0x033D033E,0x032A0344,0x03130325,0x02ED0309,0x02AF02DF,0x02600284,
-0x01F80230,0x016901B2,0x00C80118,0x0000006B,0xFF20FF93,0xFE48FEB4,0xFD7AFDE6,0xFCA2FD09,
-0xFBD1FC3C,0xFB21FB77,0xFA8CFACD,0xFA05FA45,0xF9A6F9C8,0xF979F981,0xF94FF95B,0xF948F944,
-0xF94EF948,0xF966F95E,0xF9A1F986,0xF9DDF9BF,0xFA32FA02,0xFA71FA58,0xFAE0FAA8,0xFB46FB16,
-0xFBBEFB86,0xFC36FC04,0xFCA3FC72,0xFD22FCEC,0xFD9FFD6B,0xFE1BFDCB,0xFE72FE3D,0xFEBFFE9E,
-0xFF11FEE5,0xFF5DFF35,0xFFA3FF7C,0xFFD7FFBC,0x001AFFF7,0x00420036,0x00480042,0x0060005C,
-0x00670060,0x00680067,0x005F005F,0x0060005B,0x0056005D,0x005F005F,0x0051005A,0x0051004E,
-0x003E0045,0x002E003A,0x0013001D,0xFFF90000,0xFFDBFFEB,0xFFB5FFCF,0xFFA5FFB2,0xFF93FF9B,
-0xFF79FF85,0xFF72FF75,0xFF61FF67,0xFF4DFF5B,0xFF45FF4C,0xFF2CFF38,0xFF3AFF3B,0xFF43FF38,
-0xFF6AFF57,0xFF99FF7F,0xFFE4FFC1,0x003E000E,0x00A20066,0x012300E5,0x01AD0165,0x02500200,
-0x02EE02A0,0x03A1034A,0x045B03FF,0x04ED04B0,0x058F053C,0x061905D7,0x069D065E,0x06F906D0,
-0x07570733,0x077E076C,0x07900781,0x07960797,0x07550771,0x0715073B,0x06C306EC,0x06420680,
-0x05AF05FF,0x04FC0558,0x045D04A5,0x039B03FD,0x02CA0335,0x02060264,0x014F01AA,0x008100E2,
-0xFFCB0019,0xFF20FF70,0xFE76FEC1,0xFDE7FE32,0xFD68FDA7,0xFD07FD32,0xFCA2FCD9,0xFC46FC6A,
-0xFC03FC20,0xFBB7FBD1,0xFB6DFB94,0xFB42FB59,0xFB3AFB3F,0xFB48FB3B,0xFB61FB56,0xFB98FB76,
-0xFBE6FBBE,0xFC19FBFF,0xFC82FC50,0xFCE0FCB0,0xFD3FFD17,0xFD9BFD6A,0xFDF5FDC7,0xFE66FE22,
-0xFEDCFE97,0xFF3FFF07,0xFFB7FF7E,0x0019FFEF,0x00700045,0x00C40090,0x010400EA,0x013E011B,
-0x01870162,0x01C201A5,0x020A01E4,0x021D0216,0x02440238,0x023D024A,0x021E022A,0x01ED0209,
-0x01A901CF,0x01660188,0x012A013F,0x00EA00FD,0x00AE00CB,0x007B0087,0x004F005D,0x002E0038,
-0x001F001E,0x001F0022,0x00280026,0x004D003F,0x00790064,0x00CE00B0,0x011C00F1,0x017B013E,
-0x01D2019C,0x023401F2,0x0299025E,0x02E502BD,0x035B0324,0x03B20387,0x040403E3,0x04370421,
-0x04610454,0x04420451,0x041F0434,0x03E10403,0x038703B6,0x03210353,0x02A402E0,0x02140263,
-0x016C01BD,0x00BE0118,0xFFF9005D,0xFF33FF9A,0xFE7EFED4,0xFDB4FE16,0xFD01FD53,0xFC45FCA4,
-0xFB96FBF1,0xFAD5FB3A,0xFA27FA84,0xF972F9CA,0xF8C6F91D,0xF81EF871,0xF78AF7CB,0xF73AF75B,
-0xF6E6F70B,0xF6CEF6D0,0xF6C4F6D1,0xF6BCF6BE,0xF6E2F6CB,0xF701F6F5,0xF72AF712,0xF786F750,
-0xF7E8F7B9,0xF85FF820,0xF908F8AE,0xF9AAF94F,0xFA5EFA02,0xFB18FAB9,0xFBDEFB7F,0xFC9CFC42,
-0xFD59FCFB,0xFE33FDC2,0xFF11FEA7,0xFFEEFF72,0x00BE0058,0x0174010E,0x021C01C7,0x0298025C,
-0x030002C8,0x036C0342,0x03C50394,0x041603F3,0x045B043F,0x04A0047B,0x04E604C4,0x051104FD,
-0x054B0530,0x056F0564,0x05A30589,0x05DD05BE,0x06190602,0x06570635,0x06960674,0x06D806B3,
-0x070A06F7,0x073B0727,0x07560746,0x07590758,0x0769075F,0x07840775,0x07830783,0x077A077D,
-0x07790782,0x075A076F,0x07290741,0x06D206F8,0x0669069F,0x05F6062C,0x056605AA,0x04C60511,
-0x0420046F,0x035F03BD,0x027702EA,0x017F01FE,0x00730104,0xFF47FFE7,0xFE39FEC3,0xFD1EFDA9,
-0xFC10FC90,0xFB12FB8E,0xFA3FFAA9,0xF96EF9CD,0xF89DF8FC,0xF7E2F839,0xF730F782,0xF6A4F6EA,
-0xF653F673,0xF61BF636,0xF61DF61C,0xF640F621,0xF68CF65F,0xF6EDF6B5,0xF74BF707,0xF7BEF783,
-0xF843F802,0xF8E4F88A,0xF972F92D,0xFA05F9BD,0xFAA0FA56,0xFB33FAF4,0xFBB8FB78,0xFC22FBF5,
-0xFC9AFC64,0xFCF2FCC6,0xFD4CFD1C,0xFDA3FD70,0xFE0CFDD9,0xFE82FE3E,0xFEE5FEAB,0xFF4EFF13,
-0xFFBAFF85,0x0022FFE5,0x007A004A,0x00F900BA,0x015B012C,0x01C90196,0x023C0203,0x029B026E,
-0x030F02E2,0x036F0341,0x03CD03A3,0x042C03F6,0x0466044E,0x04A0048A,0x04D404B5,0x04F404E4,
-0x051004FE,0x0507050B,0x050A0504,0x04FE0502,0x04E804F1,0x050304FC,0x05240510,0x055D053A,
-0x058D0570,0x05E705B4,0x062F0609,0x06780655,0x06A8069A,0x06C906B7,0x06C906BF,0x06BE06C4,
-0x069106A0,0x06380666,0x05C10601,0x054B058A,0x049204F9,0x03C70431,0x02E40361,0x01DD0263,
-0x00D30155,0xFFC10044,0xFEA6FF34,0xFDA5FE25,0xFCA6FD26,0xFBBBFC2A,0xFAD3FB3F,0xFA04FA67,
-0xF943F99B,0xF897F8EE,0xF80FF850,0xF79FF7D5,0xF756F77A,0xF733F740,0xF71DF720,0xF713F714,
-0xF720F717,0xF749F73B,0xF777F75E,0xF7C0F7A2,0xF813F7E6,0xF877F848,0xF8EAF8B3,0xF955F91F,
-0xF9CAF992,0xFA1CF9F7,0xFA74FA3F,0xFABEFA9B,0xFB0AFAE9,0xFB69FB37,0xFBD0FB95,0xFC41FC02,
-0xFCAEFC76,0xFD28FCE9,0xFD9DFD63,0xFE05FDD8,0xFE67FE36,0xFEB3FE81,0xFF05FED7,0xFF48FF2A,
-0xFF90FF62,0xFFD6FFBB,0x0014FFEF,0x0059003B,0x0092007C,0x00CD00AB,0x00F600DF,0x011F0104,
-0x015B0139,0x019D0173,0x021601CD,0x02A50253,0x034802ED,0x041003AB,0x04E4047B,0x05EA056E,
-0x06E10667,0x07DF075C,0x08FB086F,0x09FD0975,0x0AF40A83,0x0BC90B65,0x0C7E0C28,0x0D070CD4,
-0x0D400D2B,0x0D400D4A,0x0D230D3F,0x0CBE0CEC,0x0C340C77,0x0B800BE4,0x0AC60B28,0x09DE0A57,
-0x0904096B,0x080F0881,0x07250793,0x063F06B1,0x055B05CF,0x048504E9,0x03C20421,0x02FA0356,
-0x02220293,0x015A01BB,0x00950104,0xFFCF0033,0xFF0BFF64,0xFE6CFEB7,0xFDD8FE16,0xFD60FD95,
-0xFCEBFD1F,0xFCB4FCCC,0xFC88FC9C,0xFC6DFC72,0xFC77FC6B,0xFC9AFC84,0xFCC6FCAB,0xFD1EFCEA,
-0xFD7BFD56,0xFDE2FDB8,0xFE46FE0D,0xFEA5FE80,0xFEDBFEC8,0xFF09FEF4,0xFF27FF23,0xFF2FFF29,
-0xFF1DFF29,0xFEF8FF14,0xFECDFEEA,0xFE99FEB1,0xFE53FE74,0xFDF9FE21,0xFDA8FDD4,0xFD50FD71,
-0xFCF0FD19,0xFCA2FCBD,0xFC62FC84,0xFC27FC3D,0xFC0DFC15,0xFBE6FBF8,0xFBC8FBD5,0xFBC1FBC2,
-0xFBB0FBB5,0xFBAFFBA5,0xFBA6FBA2,0xFBADFBA6,0xFBBDFBB7,0xFBCCFBCA,0xFBD6FBCB,0xFC03FBEE,
-0xFC25FC1C,0xFC45FC3C,0xFC7FFC63,0xFCC2FCA7,0xFCF5FCCF,0xFD54FD21,0xFD9DFD74,0xFDDFFDBF,
-0xFE30FE04,0xFE6FFE52,0xFEABFE89,0xFED6FEC0,0xFF08FEED,0xFF2CFF20,0xFF71FF4F,0xFF9FFF91,
-0xFFBDFFBC,0xFFD9FFCC,0xFFDAFFE5,0xFFC0FFCB,0xFF8BFF97,0xFF5CFF73,0xFF12FF3F,0xFED8FEF4,
-0xFE9DFEB3,0xFE68FE77,0xFE29FE46,0xFDF0FE10,0xFDC6FDE2,0xFDADFDB4,0xFD94FD97,0xFD93FD91,
-0xFDA5FD9C,0xFDE3FDC8,0xFE3FFDFF,0xFEB2FE6B,0xFF48FF06,0xFFE7FF92,0x009E0044,0x015500FE,
-0x021901BB,0x02F40286,0x03DC0368,0x04A40438,0x05720502,0x060F05BB,0x069A0659,0x06EE06C6,
-0x0722070C,0x07220724,0x0718072A,0x06D806FF,0x068406A8,0x06230654,0x05A205E4,0x050D0556,
-0x043C04AD,0x037903DB,0x02B10313,0x01EE0246,0x01370192,0x00A900F1,0x0022005F,0xFFC3FFED,
-0xFF6BFF8E,0xFF23FF4C,0xFEECFF03,0xFEB2FEC7,0xFE7CFE92,0xFE5DFE64,0xFE40FE4B,0xFE51FE47,
-0xFE7AFE5E,0xFEAAFE8E,0xFEF3FEC5,0xFF4BFF19,0xFFBEFF88,0x0044FFF9,0x00E20091,0x01920130,
-0x026701F8,0x033802D0,0x0411039C,0x04E30480,0x05B2054A,0x065D0606,0x06F506AD,0x0766072D,
-0x07AC078A,0x07BF07B7,0x07B707C4,0x077507A0,0x070F074F,0x066F06C1,0x05B20610,0x04CF0546,
-0x03DA0453,0x02DE0355,0x01D80259,0x00E0015B,0xFFD80062,0xFEE3FF5A,0xFDD6FE5C,0xFCC4FD4D,
-0xFBB9FC3F,0xFAAAFB27,0xF9CCFA33,0xF8F0F963,0xF842F89A,0xF7B2F7FF,0xF732F778,0xF6D0F6FE,
-0xF67FF6A5,0xF62FF658,0xF5FFF614,0xF5C8F5E1,0xF5C5F5C2,0xF5CDF5BA,0xF5F0F5E0,0xF603F5F5,
-0xF62CF615,0xF646F641,0xF675F662,0xF69BF68C,0xF6C6F6AE,0xF704F6E3,0xF72FF71A,0xF77FF751,
-0xF7CEF7A7,0xF834F7FC,0xF88CF852,0xF8EFF8BA,0xF949F915,0xF9BCF984,0xFA40FA06,0xFAC6FA7E,
-0xFB58FB14,0xFBD8FB8F,0xFC67FC1E,0xFCEDFCB2,0xFD77FD28,0xFDDEFDAF,0xFE43FE12,0xFE9EFE75,
-0xFEFFFECC,0xFF50FF25,0xFF89FF73,0xFFC1FF9F,0x0004FFE2,0x00440011,0x0090006A,0x00CF00AC,
-0x014A010E,0x01BE0187,0x023701EF,0x02D40289,0x03600318,0x040303BC,0x04B40459,0x056C050E,
-0x060E05B4,0x06AA0663,0x0759070A,0x07F007A0,0x086B0833,0x08D308A4,0x09290907,0x0958094F,
-0x096F0962,0x0964096D,0x09410953,0x08FA0929,0x08BF08DF,0x087208AE,0x07F20835,0x075E07AC,
-0x06CD071B,0x06180676,0x055505BA,0x048104E7,0x03BE0434,0x03000359,0x023D029C,0x018301E5,
-0x00CA0124,0x00210073,0xFF7FFFCD,0xFED2FF24,0xFE44FE86,0xFDBFFDF6,0xFD3EFD7D,0xFCF1FD13,
-0xFCB5FCC5,0xFC91FC9F,0xFC62FC76,0xFC66FC5C,0xFC56FC5B,0xFC43FC4C,0xFC4AFC3F,0xFC4AFC50,
-0xFC5AFC4F,0xFC79FC6F,0xFCA1FC8B,0xFCD4FCB8,0xFCF6FCEE,0xFD2FFD0F,0xFD83FD59,0xFDCDFDAB,
-0xFE05FDF6,0xFE52FE33,0xFEC3FE90,0xFF2BFEF6,0xFF8CFF5C,0xFFE5FFAE,0x005A001C,0x00AF0090,
-0x010F00DA,0x017A013B,0x01E901B4,0x02400214,0x02AF0272,0x032502E1,0x03880350,0x03F003B9,
-0x04560422,0x04BE0489,0x050D04E9,0x05530540,0x05960572,0x05B905A3,0x05D705C9,0x05E005E5,
-0x05C705D3,0x059505B2,0x05480573,0x04DE0518,0x046F04AC,0x03F50433,0x036903AF,0x02D70321,
-0x02480297,0x01B60205,0x01340172,0x00A900ED,0x00220064,0xFFB7FFE9,0xFF53FF7B,0xFEFEFF2A,
-0xFEC0FEE1,0xFE6EFE9A,0xFE3FFE46,0xFE0BFE1E,0xFDEDFDFC,0xFDDDFDDD,0xFDDFFDDC,0xFDE7FDDA,
-0xFDF9FDE4,0xFE2EFE0C,0xFE6BFE46,0xFEA5FE8B,0xFEE1FEBC,0xFF11FEF9,0xFF40FF21,0xFF82FF60,
-0xFFB9FF9F,0x0016FFED,0x00760047,0x00E100AB,0x0149011D,0x019C016E,0x01EC01BF,0x02260214,
-0x02400231,0x0263025B,0x0265026F,0x0237025A,0x01FA0217,0x018401C1,0x01090147,0x005900B6,
-0xFFB00003,0xFEE0FF4C,0xFE1AFE75,0xFD5FFDC2,0xFCCFFD17,0xFC3EFC80,0xFBC4FBFE,0xFB6FFB96,
-0xFB25FB41,0xFAFBFB0C,0xFACFFAE9,0xFAC8FAC0,0xFAD8FAD5,0xFAFEFAEF,0xFB3AFB1B,0xFB8DFB5E,
-0xFBF7FBBF,0xFC69FC30,0xFCC4FC97,0xFD34FCF0,0xFDAAFD73,0xFE05FDD4,0xFE83FE41,0xFEF1FEC1,
-0xFF5FFF2E,0xFFB2FF8F,0x000CFFD6,0x00530024,0x0084006D,0x00C400AC,0x00F700E3,0x0132011E,
-0x01690152,0x01940182,0x01B301A9,0x01C701BA,0x01C301C2,0x01BD01C2,0x01A201AD,0x01700182,
-0x0149015B,0x010D0122,0x00CC00F2,0x0074009E,0x0022004E,0xFFB3FFEB,0xFF52FF7C,0xFF09FF29,
-0xFEBDFEE7,0xFE87FE9B,0xFE74FE79,0xFE86FE78,0xFE8EFE82,0xFEA8FE94,0xFEDDFEC5,0xFF08FEF3,
-0xFF39FF20,0xFF75FF5D,0xFFC6FF9E,0x0020FFF6,0x0097005E,0x00FC00CF,0x015A012A,0x01BE0189,
-0x01FB01EE,0x02260217,0x025A024D,0x026D0258,0x0269026B,0x02500261,0x0234023D,0x02150228,
-0x01E401FB,0x018901B1,0x013E0161,0x00EC0112,0x008E00BA,0x0047006C,0x0000002C,0xFFE7FFF4,
-0xFFC2FFC8,0xFFB4FFB3,0xFFA3FFB8,0xFF95FF98,0xFF7DFF83,0xFF70FF74,0xFF69FF71,0xFF52FF60,
-0xFF40FF4D,0xFF1CFF34,0xFEF3FF07,0xFEC4FEDA,0xFE8FFEB0,0xFE53FE6A,0xFE1DFE3A,0xFDF6FE05,
-0xFDE5FDF4,0xFDBEFDD9,0xFDA7FDA4,0xFDB4FDB5,0xFDB4FDAD,0xFDACFDC1,0xFDADFDB0,0xFDBBFDAD,
-0xFDC7FDC3,0xFDC7FDC9,0xFDD3FDCA,0xFDECFDEA,0xFE18FE01,0xFE29FE1C,0xFE47FE3A,0xFE64FE58,
-0xFE79FE75,0xFE89FE76,0xFEA7FE99,0xFEBEFEB8,0xFEEFFECD,0xFF11FEF9,0xFF44FF1F,0xFF78FF6B,
-0xFFC8FFA8,0x001EFFFC,0x00880046,0x00E800B3,0x0161011F,0x01F701A8,0x028A0237,0x030902C6,
-0x037A033B,0x03CA039E,0x041803F2,0x04270427,0x042A0436,0x0429042F,0x040C0423,0x03D303EC,
-0x039303B3,0x034F036F,0x02EB0312,0x029402CC,0x020D024C,0x019001D3,0x01260158,0x00B200E8,
-0x0042007C,0xFFE00014,0xFF67FF9B,0xFF08FF3D,0xFE94FECF,0xFE23FE4E,0xFDADFDE6,0xFD36FD70,
-0xFCD1FCFB,0xFC83FCA1,0xFC48FC58,0xFC12FC2F,0xFBE7FBF9,0xFBC6FBD9,0xFBA2FBB0,0xFB95FB9C,
-0xFB9FFB96,0xFBC2FBB5,0xFBE8FBD2,0xFC45FC1E,0xFC9FFC69,0xFD0DFCCE,0xFD87FD49,0xFE1EFDD0,
-0xFEC8FE6B,0xFF68FF17,0x0013FFBF,0x00BD006E,0x016A0117,0x01F901AC,0x02810248,0x02FD02C4,
-0x035B0333,0x039F0381,0x03BA03A7,0x03C603BE,0x03CE03CD,0x03C703C6,0x03BD03C7,0x03A203AE,
-0x03800397,0x035E0377,0x03230345,0x02F50315,0x02A002D2,0x02630286,0x02250249,0x01F30206,
-0x01B001C8,0x015A018B,0x01110138,0x00B100E4,0x006C0089,0x00210045,0xFFFF0013,0xFFE1FFEF,
-0xFFE2FFDC,0xFFF8FFF6,0x00120004,0x002D001B,0x004A003F,0x005C0052,0x0067005C,0x0086006A,
-0x00A00091,0x00BA00AE,0x00DE00D1,0x01190102,0x01390130,0x01650151,0x01A40186,0x01B701AC,
-0x01CC01BE,0x01D801DE,0x01D401D6,0x01DB01E2,0x01AE01C6,0x015E018A,0x01000136,0x009300D0,
-0xFFF50041,0xFF4DFFA2,0xFEACFEF0,0xFE07FE49,0xFD6EFDC3,0xFCE0FD12,0xFC68FCA3,0xFBFDFC34,
-0xFBA9FBDA,0xFB61FB83,0xFB39FB45,0xFB22FB2C,0xFB38FB2A,0xFB5AFB3F,0xFB8EFB67,0xFBD0FBB4,
-0xFC23FBF0,0xFC91FC55,0xFCF5FCBE,0xFD57FD2A,0xFDC4FD8D,0xFE37FE02,0xFEAEFE71,0xFF26FEE2,
-0xFF93FF5A,0xFFF5FFC1,0x005D002A,0x00AA007D,0x010200D7,0x016D0137,0x01D3019E,0x023701FE,
-0x02A1026E,0x02FF02D6,0x03580334,0x03B0038D,0x03E903DA,0x04270405,0x043E0434,0x044C0456,
-0x0461045E,0x04520455,0x042C043C,0x04010414,0x03B303DF,0x03630380,0x031A0336,0x02D102F7,
-0x028402A6,0x02590259,0x0245024F,0x02310236,0x0241023B,0x0253024A,0x0257025D,0x02670260,
-0x026D0272,0x027A0272,0x028E027C,0x02910288,0x028C028C,0x029C0295,0x028E0297,0x028F0283,
-0x02610274,0x02360244,0x0215021E,0x02010207,0x01C901E1,0x019501B0,0x01550172,0x01120140,
-0x00C300EE,0x00660093,0xFFE6002E,0xFF72FFB1,0xFEF3FF2D,0xFE79FEB4,0xFDEFFE38,0xFD8DFDC1,
-0xFD23FD5B,0xFCCDFCFB,0xFC88FCAB,0xFC3AFC5C,0xFC18FC2A,0xFBD1FBEF,0xFBB5FBB9,0xFBA0FBA8,
-0xFB92FB9E,0xFB9FFB95,0xFBA7FBA2,0xFBB9FBAD,0xFBD7FBBF,0xFBF2FBDE,0xFC1DFC0B,0xFC38FC30,
-0xFC53FC44,0xFC7BFC6D,0xFC89FC85,0xFC98FC85,0xFC93FC8E,0xFC75FC8A,0xFC68FC6D,0xFC4DFC62,
-0xFC2BFC38,0xFC0DFC1F,0xFBF5FC12,0xFBE8FBE1,0xFBCBFBDA,0xFBB6FBBD,0xFBA2FBB4,0xFBA1FBAA,
-0xFB8DFB92,0xFB8FFB94,0xFBAEFBA2,0xFBCFFBC7,0xFBF6FBD6,0xFC1EFC04,0xFC6FFC4E,0xFCB5FC94,
-0xFCF8FCD2,0xFD5FFD1E,0xFDB8FD7F,0xFE0CFDE9,0xFE91FE51,0xFF07FEC8,0xFFACFF52,0x0024FFE7,
-0x00AE0066,0x01440104,0x01BE017F,0x023401F9,0x02B0027D,0x031102E4,0x03800348,0x03EC03B2,
-0x0451041D,0x04BA048B,0x050A04E9,0x05760537,0x05D505A4,0x063005FB,0x069C0664,0x070506DF,
-0x0750072A,0x07A9077B,0x07E807C8,0x082E0815,0x0841083B,0x084F083B,0x08540851,0x0842084C,
-0x08310834,0x081A0823,0x07E00807,0x07A007D1,0x07480777,0x06E40715,0x066506AD,0x05C80616,
-0x054A058D,0x04A404FA,0x0419045B,0x038303C8,0x02F80342,0x027B02AC,0x01F30233,0x017D01B1,
-0x01060143,0x00AD00DE,0x0062007D,0x00300045,0xFFEF000C,0xFFC1FFD2,0xFF87FFA4,0xFF55FF74,
-0xFF39FF51,0xFEFDFF1C,0xFED1FEE8,0xFE94FEAA,0xFE62FE74,0xFE01FE2D,0xFDB4FDD4,0xFD4EFD84,
-0xFCE1FD21,0xFC61FC9D,0xFBE7FC29,0xFB67FBAA,0xFAF4FB27,0xFA85FAB8,0xFA13FA50,0xF9AEF9DE,
-0xF945F976,0xF8CFF907,0xF869F8A9,0xF815F841,0xF7E2F7FD,0xF7CBF7D1,0xF7CBF7BE,0xF7D9F7C0,
-0xF802F7EC,0xF825F820,0xF867F843,0xF8AEF882,0xF8FFF8D6,0xF941F912,0xF991F961,0xFA03F9CD,
-0xFA72FA34,0xFAE5FAA3,0xFB66FB32,0xFBEBFBAB,0xFC6FFC34,0xFCF8FCB9,0xFD91FD41,0xFE1FFDDA,
-0xFEC5FE70,0xFF6DFF17,0x0011FFBC,0x00C10063,0x016B0113,0x020901BA,0x02930254,0x032502EE,
-0x03A40369,0x041703EA,0x04610448,0x04A7048D,0x04BA04BB,0x04C104BC,0x048D04A9,0x043E046D,
-0x03BE0401,0x0334037B,0x028602DF,0x01E3022D,0x013C018D,0x009700D9,0xFFFC0044,0xFF61FFAF,
-0xFECFFF15,0xFE67FEA1,0xFE04FE39,0xFDABFDD4,0xFD71FD86,0xFD58FD5E,0xFD48FD49,0xFD64FD51,
-0xFD86FD73,0xFDB2FDA3,0xFDE3FDCD,0xFE1FFE04,0xFE5CFE38,0xFE8DFE76,0xFEC1FEA4,0xFEF5FED7,
-0xFF2CFF0C,0xFF57FF36,0xFF84FF69,0xFFA0FF92,0xFFAFFFA4,0xFFCDFFC0,0xFFE4FFD5,0xFFFFFFF3,
-0x00160008,0x00300024,0x0062003D,0x00A00077,0x00D100B5,0x010800EA,0x01590134,0x01A60182,
-0x020701D2,0x0266022E,0x02CF029C,0x034302FF,0x03B2037B,0x040D03D9,0x04820451,0x04E204A9,
-0x0542050B,0x05AD057E,0x05F505D1,0x0653061D,0x06990674,0x06EF06C7,0x07130703,0x0736072B,
-0x07410741,0x07430741,0x07380744,0x0713072D,0x06E106FD,0x06AF06BF,0x06520679,0x05FB0625,
-0x058B05CA,0x05050551,0x047404BD,0x03E20429,0x0347039B,0x02B302F5,0x0200025E,0x016B01AE,
-0x00CF0121,0x00370085,0xFF8DFFE8,0xFEFCFF4B,0xFE71FEBA,0xFDE1FE24,0xFD5FFD91,0xFCF6FD2A,
-0xFC8CFCC0,0xFC28FC5E,0xFBC1FBF3,0xFB6DFB9B,0xFB0BFB43,0xFABDFADF,0xFA68FA88,0xFA34FA4B,
-0xFA00FA20,0xF9F3F9FF,0xF9F7F9F6,0xFA02F9F5,0xFA1CFA05,0xFA43FA21,0xFA92FA6C,0xFAD7FAB6,
-0xFB3EFB0D,0xFBA8FB7D,0xFC2FFBF0,0xFC9EFC65,0xFCFFFCC7,0xFD44FD1C,0xFD8BFD5E,0xFDB6FD93,
-0xFDC7FDC9,0xFDCDFDCE,0xFDDBFDDE,0xFDD9FDE0,0xFDD0FDE2,0xFDA2FDBF,0xFD89FD9A,0xFD49FD6D,
-0xFD0CFD2E,0xFCCCFCF0,0xFC92FCAE,0xFC7FFC81,0xFC77FC79,0xFC63FC6A,0xFC80FC72,0xFC95FC7C,
-0xFCD1FCAD,0xFD11FCF2,0xFD6DFD3A,0xFDE6FDB1,0xFE77FE2D,0xFF32FED1,0xFFF8FF96,0x00E50063,
-0x01AE0145,0x0275020A,0x032F02D7,0x03C4037E,0x044F040D,0x04AD048A,0x04EC04D7,0x050B050A,
-0x0505050A,0x04ED04FE,0x04C704DE,0x048704AC,0x0412044A,0x03BA03DE,0x033B0374,0x02CC0309,
-0x0276029E,0x020B0242,0x01B901E8,0x01620189,0x00FE012A,0x009800C2,0x00420066,0xFFD60006,
-0xFF77FFA3,0xFF26FF5A,0xFEE4FF0D,0xFE94FEBC,0xFE48FE71,0xFDFEFE2A,0xFDC9FDEA,0xFDA3FDB4,
-0xFD83FD92,0xFD7EFD7D,0xFD97FD86,0xFDA7FD9C,0xFDD8FDB4,0xFE0DFDF3,0xFE56FE2B,0xFEA3FE6F,
-0xFEFFFECF,0xFF61FF38,0xFFE6FFA9,0x0072002E,0x00F000B8,0x01750136,0x01DE01A5,0x0231020C,
-0x02810268,0x02B00294,0x02D202C7,0x02D202D6,0x02D302D3,0x02AF02C0,0x028C02A8,0x02580273,
-0x01FB022C,0x01B801D4,0x01670190,0x010E013E,0x00CB00E9,0x0086009C,0x004F0062,0x0011002A,
-0xFFDEFFF9,0xFFB7FFDA,0xFF94FFAB,0xFF7EFF7B,0xFF8AFF80,0xFF97FF8D,0xFFE2FFBD,0x00500017,
-0x00C00082,0x01550106,0x020A01B4,0x02B4026C,0x036C031A,0x041103BD,0x04BF0471,0x05670513,
-0x05FA05B3,0x0679063C,0x06E706B1,0x07530718,0x07880777,0x079D0795,0x0796079E,0x0773078B,
-0x07440765,0x06E10717,0x067C06B6,0x05EB0636,0x055005A9,0x048F04F2,0x03B7041E,0x02D50344,
-0x01F3025D,0x0111017F,0x001E0091,0xFF49FFA7,0xFE75FEE2,0xFDB0FE04,0xFD17FD54,0xFC6DFCBF,
-0xFBE1FC1D,0xFB71FBAD,0xFB17FB36,0xFABAFAE8,0xFA9DFAAA,0xFA99FA92,0xFA7FFA84,0xFA7DFA7D,
-0xFA79FA7A,0xFA81FA7A,0xFA87FA86,0xFAA8FA98,0xFABEFAAF,0xFAE9FAD0,0xFB06FAFD,0xFB49FB28,
-0xFB87FB66,0xFBB0FB9A,0xFBD9FBC7,0xFBFFFBE9,0xFC1FFC14,0xFC4FFC43,0xFC6AFC59,0xFC97FC82,
-0xFCACFCA4,0xFCD6FCC9,0xFCEBFCD7,0xFCF2FCEE,0xFCF6FCEF,0xFCEFFCF4,0xFCDAFCE8,0xFCD8FCDD,
-0xFCCAFCD6,0xFCC9FCD7,0xFCC5FCC8,0xFCC2FCC1,0xFCB9FCC0,0xFCB8FCBB,0xFCBFFCBE,0xFCCAFCCC,
-0xFD04FCE8,0xFD49FD23,0xFDADFD72,0xFE37FDF1,0xFECAFE87,0xFF83FF26,0x003DFFE1,0x00EE008E,
-0x01C1015B,0x0296022D,0x036702FA,0x042803C7,0x04F10485,0x05860540,0x05FE05BD,0x06680631,
-0x06940675,0x06AE069C,0x06B906B6,0x06AC06B6,0x069F06A3,0x067F0699,0x06580669,0x06380651,
-0x05EE0619,0x059E05C3,0x053F0572,0x04E6050E,0x047204AE,0x04150444,0x03C103E9,0x037C03AA,
-0x03430362,0x031F0332,0x02F00303,0x02C802D7,0x029C02BB,0x026E0287,0x02590264,0x0232023B,
-0x01F3020D,0x01BD01CC,0x01730196,0x01120140,0x00A400D8,0x00270067,0xFFB2FFE9,0xFF33FF78,
-0xFEC2FEF5,0xFE4FFE84,0xFDC8FE11,0xFD4EFD85,0xFCD1FD19,0xFC3CFC95,0xFBC6FC09,0xFB66FB9A,
-0xFB00FB33,0xFAB2FAD8,0xFA75FA91,0xFA58FA67,0xFA4AFA4F,0xFA38FA3C,0xFA2FFA2F,0xFA3FFA39,
-0xFA4DFA43,0xFA6CFA59,0xFA90FA77,0xFABBFAA4,0xFAF4FACD,0xFB37FB06,0xFB72FB59,0xFBAFFB95,
-0xFC03FBD4,0xFC3BFC24,0xFC89FC59,0xFCEEFCBE,0xFD59FD19,0xFDCFFD9F,0xFE4BFE0A,0xFEDEFE89,
-0xFF69FF1B,0xFFF0FFAD,0x0082002E,0x010C00C4,0x01A4015C,0x022E01EA,0x02A20270,0x032202E4,
-0x0383034A,0x03D003A7,0x040C03FD,0x04330420,0x044D043E,0x045E0457,0x044A0457,0x04420445,
-0x042C0437,0x0418041A,0x03E60402,0x03A803CE,0x0358038D,0x03070333,0x02A602D0,0x023D0270,
-0x01FD021B,0x01B701E9,0x0179018A,0x01290151,0x00ED010D,0x00AC00CD,0x00750088,0x00330043,
-0x0015001A,0xFFE5FFF6,0xFFC2FFCE,0xFF96FFB1,0xFF69FF7C,0xFF3CFF55,0xFF0BFF2B,0xFEE6FEFE,
-0xFEA1FEC8,0xFE6FFE8A,0xFE25FE48,0xFDF0FE03,0xFD90FDC5,0xFD2BFD65,0xFCCCFCF9,0xFC4EFC90,
-0xFBC4FC07,0xFB39FB82,0xFAB1FAEF,0xFA1FFA69,0xF98FF9CD,0xF90BF948,0xF899F8C9,0xF83CF86A,
-0xF7E1F811,0xF79CF7BE,0xF771F77D,0xF768F771,0xF772F768,0xF78EF77C,0xF7DBF7B0,0xF824F7F5,
-0xF885F852,0xF8E5F8B9,0xF970F92C,0xFA02F9C1,0xFA9EFA45,0xFB3FFAED,0xFBEDFB96,0xFCA7FC4A,
-0xFD66FD00,0xFE28FDBA,0xFEE3FE89,0xFF8CFF3C,0x003AFFE9,0x00DD008C,0x017D012F,0x020F01CE,
-0x029C0253,0x032702E6,0x03B0036F,0x042F03F3,0x049D045F,0x052504E5,0x05B50568,0x063D05F3,
-0x06D90685,0x075D0713,0x07ED07AA,0x08730838,0x08E608B6,0x0937091A,0x097D095B,0x09920985,
-0x098F099C,0x09740988,0x0944095F,0x08F90920,0x089608C1,0x08190850,0x078307D6,0x06E40732,
-0x06310697,0x057D05DB,0x04C2051B,0x03EC0451,0x031A0382,0x025102AE,0x018201E4,0x00CB0122,
-0x001B006F,0xFF69FFB6,0xFED8FF14,0xFE3BFE88,0xFDBCFDFF,0xFD76FD9B,0xFD1BFD46,0xFCD5FCEF,
-0xFC8DFCB0,0xFC3AFC58,0xFBF8FC1B,0xFBB7FBD4,0xFB92FB99,0xFB51FB6B,0xFB30FB46,0xFB20FB1D,
-0xFAFBFB0E,0xFAD2FADF,0xFAD1FAD3,0xFAD4FAC9,0xFAD5FAD6,0xFADDFAE1,0xFB04FAEE,0xFB38FB1E,
-0xFB89FB65,0xFBECFBB8,0xFC4BFC1D,0xFCBEFC87,0xFD2BFCF6,0xFD9BFD69,0xFE0AFDCF,0xFE6FFE41,
-0xFED5FE97,0xFF3EFF0D,0xFF99FF73,0x000CFFCA,0x00610030,0x00AD0087,0x00F800D0,0x013F0113,
-0x016F0152,0x01B2018D,0x020301D5,0x024A022F,0x028E0269,0x02F302CA,0x03410327,0x03A10374,
-0x03EF03BF,0x0458042B,0x04B2047B,0x051804EA,0x05770542,0x05CA05A3,0x060605E8,0x0632061B,
-0x063E063C,0x0648063D,0x06420645,0x06240635,0x0605060E,0x05E205F6,0x05B005CB,0x058405A8,
-0x05590575,0x052A0546,0x04DF0509,0x04A604CB,0x0447046B,0x03EC041F,0x038E03C5,0x0331035C,
-0x02BC02E6,0x024C0275,0x01DD0220,0x014E0198,0x00ED011D,0x006E00B5,0xFFFF002B,0xFFA1FFD5,
-0xFF4DFF74,0xFF09FF2F,0xFEBAFEDC,0xFE85FEA3,0xFE47FE6E,0xFDF6FE1E,0xFDB0FDDA,0xFD7FFD9F,
-0xFD4BFD63,0xFD1AFD31,0xFCD3FCEF,0xFC79FCA6,0xFC20FC4F,0xFBD0FBFA,0xFB6DFB9C,0xFB29FB3C,
-0xFAECFAFE,0xFAA4FACC,0xFA6CFA8A,0xFA53FA60,0xFA3FFA49,0xFA1FFA21,0xFA08FA0E,0xFA02F9FF,
-0xF9F4F9FA,0xFA06FA00,0xFA17FA0D,0xFA57FA32,0xFA8FFA79,0xFAD7FAB4,0xFB2FFB03,0xFB8DFB63,
-0xFBF2FBBA,0xFC60FC26,0xFCE2FC9C,0xFD65FD28,0xFDE9FD9F,0xFE7EFE30,0xFEFBFEBF,0xFF75FF35,
-0xFFD5FF9F,0x00310006,0x007D005D,0x00C000AC,0x00FD00DD,0x01290114,0x0137012F,0x0142013F,
-0x0153014B,0x01300143,0x012B0129,0x01180127,0x0122011D,0x011A0122,0x012C0121,0x0154013D,
-0x01940171,0x01E101BC,0x02340202,0x0295026D,0x02F002C2,0x03660325,0x03BD038B,0x042203EE,
-0x0479044B,0x04C404A1,0x050004E6,0x05450524,0x0579055E,0x05990586,0x05B505A5,0x05C805B7,
-0x05D805D5,0x05DD05D2,0x061105F9,0x06320624,0x064B063A,0x06750661,0x06B50694,0x06C806C7,
-0x06DD06D5,0x06EA06ED,0x06E506E7,0x06CC06DD,0x069C06BC,0x0650067B,0x05EC0628,0x055005AA,
-0x049A04F9,0x03C50436,0x02ED0361,0x020D0282,0x012B019E,0x005300C4,0xFF7CFFEF,0xFEC6FF19,
-0xFDFBFE60,0xFD4CFD9E,0xFCBDFCF4,0xFC26FC6A,0xFBACFBE7,0xFB55FB77,0xFB22FB35,0xFAEFFAFD,
-0xFAD8FADF,0xFACEFACF,0xFAC2FAB6,0xFAB8FAB5,0xFAC3FAC4,0xFAD2FAC9,0xFAEFFADE,0xFB12FAFD,
-0xFB3BFB1C,0xFB75FB5E,0xFBB1FB92,0xFBE0FBCC,0xFC30FC07,0xFC50FC40,0xFC85FC68,0xFCB9FC92,
-0xFCCEFCC3,0xFCF4FCDA,0xFD1EFD0D,0xFD42FD39,0xFD66FD4D,0xFDA2FD82,0xFDCFFDBD,0xFDE6FDE2,
-0xFE25FE08,0xFE5CFE42,0xFEACFE88,0xFEE9FECE,0xFF24FF07,0xFF68FF4A,0xFFC1FF93,0xFFEAFFD2,
-0x001D000E,0x0058003C,0x00950072,0x00D400C1,0x00FB00EC,0x011F010B,0x0146012B,0x0156014D,
-0x01680161,0x0170016A,0x017B0173,0x01780177,0x017B0181,0x016C0174,0x01630171,0x01570160,
-0x01390149,0x0105011B,0x00BC00E1,0x007F0098,0x00380063,0xFFEF0010,0xFFA5FFC5,0xFF7BFF92,
-0xFF39FF60,0xFEE9FF09,0xFEB8FED6,0xFE82FE92,0xFE4EFE64,0xFE33FE41,0xFE2BFE2F,0xFE2CFE37,
-0xFE35FE25,0xFE47FE38,0xFE49FE3B,0xFE3EFE4E,0xFE2EFE30,0xFE12FE2E,0xFDFBFE09,0xFDE5FDF4,
-0xFDE0FDE4,0xFDC7FDCE,0xFD9BFDAD,0xFD72FD8E,0xFD47FD5E,0xFD0FFD2E,0xFCDDFCFA,0xFCABFCC9,
-0xFC8CFC95,0xFC81FC82,0xFC81FC85,0xFC87FC87,0xFCAEFC96,0xFCDEFCBE,0xFD1FFCFB,0xFD4FFD31,
-0xFDAAFD7F,0xFDEEFDCA,0xFE2EFE09,0xFE84FE58,0xFECEFEAF,0xFF0AFEEC,0xFF26FF17,0xFF46FF3E,
-0xFF58FF52,0xFF51FF50,0xFF69FF5D,0xFF66FF6C,0xFF78FF6B,0xFF91FF79,0xFFA4FF96,0xFFCBFFB4,
-0xFFFAFFDE,0x004C0022,0x00A30074,0x010D00C9,0x018E0149,0x023901E6,0x02DD028F,0x039B0339,
-0x044E03F9,0x04F904A6,0x05A20555,0x063305EB,0x06CA0688,0x074B0707,0x07AD077F,0x080007DC,
-0x08290819,0x08450841,0x08270842,0x07E7080A,0x079607B9,0x07110755,0x067406C0,0x05ED0631,
-0x054805A6,0x04A604F3,0x03DC0447,0x031F037E,0x026502C7,0x01A60203,0x00F1014C,0x005500AC,
-0xFFD60014,0xFF5CFF9C,0xFEF6FF1F,0xFEB5FED7,0xFE79FE92,0xFE33FE54,0xFE13FE2C,0xFDF7FE00,
-0xFDEAFDF6,0xFDE6FDE8,0xFDF1FDEF,0xFDFFFDF9,0xFE05FE03,0xFE10FE09,0xFE20FE15,0xFE06FE23,
-0xFDF6FE07,0xFDE0FDF2,0xFDC7FDD7,0xFDC2FDC4,0xFDC7FDC0,0xFDD8FDCB,0xFDE7FDE7,0xFDF4FDE4,
-0xFE1CFDF9,0xFE13FE11,0xFE14FE15,0xFE18FE16,0xFE1DFE24,0xFE0CFE10,0xFE06FE13,0xFDEAFDF7,
-0xFDB7FDCD,0xFD5EFD84,0xFD06FD39,0xFC8CFCD2,0xFC14FC5B,0xFB97FBCF,0xFB18FB5B,0xFA9DFAE1,
-0xFA30FA6B,0xF9D6FA04,0xF97CF9A3,0xF929F950,0xF8F0F90B,0xF8D0F8E2,0xF8B3F8C8,0xF8B9F8BD,
-0xF8CBF8B8,0xF904F8E4,0xF94CF929,0xF99DF976,0xFA1EF9D8,0xFA9AFA58,0xFB39FAE9,0xFBDAFB86,
-0xFC8BFC35,0xFD53FCEA,0xFE1EFDBF,0xFEE3FE88,0xFF76FF36,0x0012FFBE,0x00A90066,0x012900F1,
-0x0193015D,0x020801CA,0x024E022D,0x0284026E,0x02BF02AB,0x02DD02D2,0x02F902EF,0x030502FB,
-0x02F80306,0x02F602F3,0x030702FB,0x03090307,0x0320030A,0x032F031B,0x0350033D,0x03760360,
-0x03A8038D,0x03D603C3,0x040703EC,0x0448041F,0x0495046F,0x04D504A7,0x051804F5,0x05520536,
-0x0595056F,0x05AF05A7,0x05BF05B9,0x05C405BF,0x05C105CA,0x05BF05C1,0x058E05AE,0x056C057B,
-0x052E0550,0x05010512,0x04B204E3,0x046F0494,0x042E0450,0x03DF0400,0x038003B3,0x03480369,
-0x02F70319,0x02C302DD,0x028102A3,0x023C0255,0x01E70211,0x019701CB,0x0141016C,0x00F3011D,
-0x00B200D2,0x005F0084,0x000B0035,0xFFC3FFE6,0xFF81FFAC,0xFF1AFF5A,0xFEC0FEED,0xFE61FE99,
-0xFE17FE38,0xFDBFFDE8,0xFD8FFDA7,0xFD66FD76,0xFD46FD50,0xFD3CFD43,0xFD45FD42,0xFD4DFD3F,
-0xFD60FD56,0xFD8FFD6E,0xFDCBFDB2,0xFE2BFDFB,0xFE80FE52,0xFEDBFEAF,0xFF38FF04,0xFF9AFF6C,
-0xFFDFFFBE,0x00430011,0x00880062,0x00D400B1,0x010800EE,0x014B0121,0x018D015E,0x01A40196,
-0x01B801B8,0x01BF01BC,0x01B501BC,0x01AB01AC,0x019001A1,0x017B018A,0x016D017E,0x014D0155,
-0x013E014D,0x01350143,0x0138013A,0x0141013B,0x01570155,0x018A0173,0x01D101B0,0x022B01F5,
-0x02970260,0x02EC02C3,0x0345031D,0x038E0375,0x03B803A7,0x03CC03C7,0x03C103D6,0x039203AB,
-0x03440366,0x02D00301,0x02310284,0x019401F1,0x00D2013D,0xFFF6006C,0xFF19FF8F,0xFE22FEA1,
-0xFD45FDBA,0xFC63FCD9,0xFBABFC0B,0xFB05FB52,0xFA57FAB2,0xF9DEFA20,0xF96AF99C,0xF8FFF933,
-0xF8A5F8D5,0xF872F87F,0xF86AF86C,0xF85AF863,0xF86DF867,0xF885F87C,0xF8C6F8A6,0xF8FFF8EA,
-0xF927F916,0xF96DF94C,0xF9A4F981,0xF9F0F9CC,0xFA3CFA14,0xFA98FA62,0xFAEAFAC6,0xFB54FB28,
-0xFBAAFB72,0xFC1FFBE4,0xFC98FC5B,0xFCF7FCCD,0xFD79FD33,0xFE06FDC0,0xFE85FE45,0xFF13FECB,
-0xFFA0FF5B,0x0034FFF0,0x00C20083,0x01520109,0x01E30198,0x026C022A,0x02FC02BF,0x03850351,
-0x040B03C1,0x048F0451,0x04E804B4,0x0553051E,0x05750565,0x05930584,0x05AE05A9,0x05B105B7,
-0x059B05A9,0x057F059F,0x05500575,0x05270548,0x04DE050F,0x049C04BE,0x045D046F,0x0413042E,
-0x03E703F6,0x03C303D2,0x03B603AF,0x03A503AA,0x0390038E,0x03870384,0x03730380,0x0350036E,
-0x0330034C,0x0309031A,0x02F80303,0x02BA02D7,0x029102A6,0x02660283,0x0228024C,0x01D501FD,
-0x019701B8,0x01300163,0x00E7010E,0x008B00B9,0x003C006A,0xFFF4001F,0xFF92FFC5,0xFF2AFF56,
-0xFEC8FEF9,0xFE57FE94,0xFDEEFE26,0xFD8EFDBA,0xFD2CFD58,0xFCDDFD07,0xFC9BFCC4,0xFC65FC77,
-0xFC3CFC5A,0xFC25FC25,0xFC1BFC1C,0xFC26FC1B,0xFC2CFC24,0xFC55FC35,0xFC7FFC5F,0xFCDAFCA9,
-0xFD2BFD04,0xFD8CFD5D,0xFE0AFDC9,0xFE74FE48,0xFEF7FEB6,0xFF84FF3E,0x0019FFC8,0x0097005C,
-0x010D00D8,0x0188015F,0x020101C5,0x026A023A,0x02B50298,0x02F502DB,0x03350314,0x0367034B,
-0x039F038A,0x03DE03C1,0x040C03F6,0x04460427,0x046D0457,0x0482047B,0x048C0494,0x048D048E,
-0x0492048B,0x04760489,0x044A045E,0x040E042B,0x03D103F6,0x037B03B0,0x0310034D,0x029602D1,
-0x02090252,0x017001BA,0x00E6012B,0x0052009D,0xFFE8001E,0xFF69FFA6,0xFF0FFF46,0xFEB3FEE2,
-0xFE4DFE7D,0xFDFEFE2B,0xFDC2FDEC,0xFD8DFDA3,0xFD75FD7A,0xFD64FD62,0xFD61FD5C,0xFD74FD61,
-0xFD7CFD6E,0xFD7CFD7F,0xFD89FD82,0xFD8EFD8E,0xFD79FD81,0xFD5EFD6D,0xFD46FD50,0xFD1CFD36,
-0xFCEDFD01,0xFCB0FCCF,0xFC79FC9F,0xFC38FC5D,0xFBF6FC1E,0xFBC4FBD6,0xFB97FBB0,0xFB6DFB86,
-0xFB63FB6A,0xFB5BFB66,0xFB62FB5E,0xFB70FB61,0xFB7AFB76,0xFB92FB81,0xFBA8FB98,0xFBBAFBB2,
-0xFBFDFBE4,0xFC2CFC0E,0xFC67FC49,0xFC9FFC8A,0xFCE0FCC1,0xFD23FD09,0xFD5DFD41,0xFDA1FD81,
-0xFDE9FDC7,0xFE25FE03,0xFE5EFE3B,0xFE8EFE7E,0xFEC4FEA9,0xFEEFFEDA,0xFF08FF02,0xFF32FF24,
-0xFF4DFF3C,0xFF6CFF5E,0xFF92FF7C,0xFFADFF97,0xFFD8FFBF,0x000AFFF8,0x00310027,0x0060004E,
-0x00970083,0x00DB00B1,0x011700F9,0x014E0136,0x018A0163,0x01B3019D,0x01E001CD,0x0218020B,
-0x024B0230,0x02680266,0x027F0273,0x029A0290,0x02C202A9,0x02DE02D8,0x030B02F7,0x03400322,
-0x0373035F,0x03AA0398,0x03D603C3,0x040D03F2,0x0426041A,0x04250422,0x0427041F,0x042C0428,
-0x040D041C,0x03FC0403,0x03E003F1,0x03B003C7,0x03650383,0x030F0338,0x02AA02D7,0x02390270,
-0x01B401FA,0x01560186,0x00E60119,0x008400AD,0x002B0057,0xFFDD0002,0xFF7EFFB3,0xFF4CFF6A,
-0xFEF8FF1B,0xFEB6FED9,0xFE86FE98,0xFE3DFE61,0xFDFFFE17,0xFDD7FDED,0xFD96FDB5,0xFD65FD7F,
-0xFD2EFD46,0xFD01FD1E,0xFCDFFCF0,0xFCD1FCDC,0xFCD0FCD2,0xFCDFFCD2,0xFD01FCE9,0xFD34FD1C,
-0xFD87FD60,0xFDCCFDA9,0xFE1DFDF1,0xFEA1FE61,0xFF10FED2,0xFF8AFF46,0x0003FFC0,0x007E0039,
-0x00E400B0,0x012A00FF,0x0164013B,0x01800171,0x017E0182,0x01840188,0x015F0170,0x0137014F,
-0x00FE0116,0x00C200DB,0x007700A4,0x00140041,0xFFC8FFF5,0xFF78FFA2,0xFF30FF4F,0xFF07FF05,
-0xFEE3FEF1,0xFEDDFED6,0xFEC7FECF,0xFEDFFEC7,0xFEFAFEEA,0xFF31FF14,0xFF6BFF4F,0xFFAFFF8A,
-0x0007FFD5,0x00670039,0x00CE0097,0x013300FE,0x01900161,0x01E501B7,0x02200209,0x023E0229,
-0x025A0249,0x025A0261,0x0254025A,0x02470252,0x02230234,0x01F0020A,0x01C901DC,0x017F019E,
-0x012B0158,0x00CF00F5,0x008800B6,0x002E0054,0xFFD70002,0xFF82FFA7,0xFF1EFF4A,0xFECDFEF1,
-0xFE5BFE97,0xFDF7FE2C,0xFD9DFDC7,0xFD33FD6E,0xFCD1FCFC,0xFC6EFCA0,0xFC09FC32,0xFBAFFBE0,
-0xFB50FB82,0xFAE6FB23,0xFA86FAB2,0xFA28FA4F,0xF9CFF9FC,0xF986F9A9,0xF946F95E,0xF907F927,
-0xF8FAF8F7,0xF8F2F8F5,0xF900F8F3,0xF927F916,0xF950F935,0xF9A5F97A,0xFA0AF9CF,0xFA8AFA4E,
-0xFB14FAC6,0xFBACFB64,0xFC61FC09,0xFD1EFCB8,0xFDE1FD6F,0xFE9DFE33,0xFF75FF0B,0x003FFFCC,
-0x010800A6,0x01B5015C,0x026A0211,0x02FB02B9,0x038E0345,0x040D03D5,0x048E0445,0x050104BF,
-0x056C0532,0x05CB0594,0x06370600,0x06A0066A,0x06F906C7,0x07640739,0x07DB07A0,0x083E0811,
-0x088D0876,0x08D808BD,0x091508FA,0x095D093B,0x09800974,0x0996098E,0x09A909A5,0x09A709B2,
-0x099609A1,0x09790981,0x09560967,0x0920093D,0x08DB08FD,0x087A08AE,0x082D0854,0x079A07E9,
-0x070A0757,0x066506C2,0x05A40602,0x04E2053B,0x03FA0473,0x03210389,0x023502B9,0x015501C1,
-0x007900E0,0xFF98000A,0xFED0FF3D,0xFDFEFE6B,0xFD58FDAE,0xFCBDFD08,0xFC2EFC77,0xFBC1FBFB,
-0xFB69FB90,0xFB20FB46,0xFACDFAF1,0xFA9AFAAD,0xFA6EFA83,0xFA53FA58,0xFA47FA4A,0xFA3FFA3E,
-0xFA4DFA42,0xFA55FA4A,0xFA72FA63,0xFA8BFA76,0xFAB3FA9E,0xFAEFFAD1,0xFB25FB0A,0xFB6DFB4F,
-0xFBD5FBA4,0xFC53FC0F,0xFCBFFC87,0xFD3BFCFB,0xFDBFFD81,0xFE40FDFE,0xFED0FE7E,0xFF5FFF16,
-0xFFE5FF94,0x00820020,0x011300CF,0x018C0152,0x021201D2,0x0289025C,0x02FC02CB,0x033E031B,
-0x03780360,0x039B038B,0x03AD03A0,0x03A403AA,0x0393039C,0x036A037D,0x03250354,0x02E20311,
-0x029502B8,0x022F0268,0x01D90207,0x017501A3,0x0129014B,0x00EA0112,0x00A000BC,0x00920098,
-0x0065007F,0x0049004F,0x0041003C,0x00390043,0x003D0041,0x004D0046,0x00610058,0x00830074,
-0x0095008B,0x00B100A0,0x009D00A3,0x008F009C,0x005A0073,0x001A003D,0xFFA9FFF1,0xFF51FF7C,
-0xFEDAFF22,0xFE59FE99,0xFDCDFE0C,0xFD3EFD86,0xFCB3FCF5,0xFC13FC5E,0xFB6CFBBC,0xFAF9FB33,
-0xFA6AFAA8,0xFA01FA36,0xF9A9F9D1,0xF960F97E,0xF918F93A,0xF8F2F909,0xF8DDF8E2,0xF8D0F8DC,
-0xF8CEF8CD,0xF8E9F8E5,0xF91BF901,0xF94AF933,0xF986F966,0xF9ADF999,0xF9EBF9D1,0xFA2EFA01,
-0xFA63FA39,0xFAABFA7F,0xFAE6FACA,0xFB31FB0C,0xFB86FB57,0xFBF4FBBF,0xFC48FC11,0xFCBAFC7B,
-0xFD2DFCF0,0xFDB6FD70,0xFE40FDFA,0xFED8FE92,0xFF8CFF35,0x003DFFDF,0x00F800A0,0x01A4014F,
-0x026601FD,0x031C02BE,0x03DB037B,0x049D0435,0x055B04F6,0x061E05B2,0x06ED068D,0x07B30749,
-0x0885081B,0x094508DF,0x09F6099C,0x0A810A34,0x0AF30ABA,0x0B540B24,0x0B870B6A,0x0BAF0B96,
-0x0BC50BBA,0x0BBF0BBE,0x0BA80BB8,0x0B820B9C,0x0B3D0B5C,0x0B080B21,0x0AAA0AD6,0x0A5C0A83,
-0x0A030A39,0x09AB09DB,0x094B0980,0x08DA0906,0x08560896,0x07CB0810,0x071A0768,0x065C06B8,
-0x059105F7,0x04CD052C,0x03ED044F,0x030E0386,0x023502A6,0x015701C7,0x006200DC,0xFF68FFE3,
-0xFE7DFEE7,0xFD8FFDF8,0xFCA5FD10,0xFBD7FC3D,0xFB21FB7A,0xFA67FAC6,0xF9BDFA0D,0xF93BF980,
-0xF8BDF8F0,0xF84CF881,0xF804F82B,0xF7BCF7E5,0xF7AAF7AF,0xF7ABF7B7,0xF7AEF7AE,0xF7D9F7BD,
-0xF7F8F7EF,0xF833F81E,0xF877F85E,0xF8B0F893,0xF8F3F8CD,0xF93AF914,0xF97EF956,0xF9C2F99E,
-0xF9F1F9D7,0xFA22FA03,0xFA4AFA3A,0xFA66FA51,0xFA91FA78,0xFAB1FA9D,0xFAC4FABD,0xFADFFACC,
-0xFAFBFAF1,0xFAFCFB04,0xFB00FAFD,0xFAF3FAF4,0xFAF9FAED,0xFAF5FAED,0xFAF4FAEB,0xFB03FAF7,
-0xFB2BFB15,0xFB50FB40,0xFB94FB71,0xFBD8FBBC,0xFC30FC0D,0xFC8BFC5B,0xFCE0FCAE,0xFD40FD13,
-0xFD90FD66,0xFDE5FDB5,0xFE28FE02,0xFE6FFE52,0xFEAAFE86,0xFED5FEBE,0xFEE7FEE6,0xFF05FEF5,
-0xFF12FF0A,0xFF0BFF0C,0xFF08FF09,0xFF14FF10,0xFF31FF28,0xFF4AFF31,0xFF5FFF51,0xFF8EFF78,
-0xFFC1FFAB,0xFFF2FFD4,0x00300010,0x0078004D,0x00C2009A,0x012100EF,0x01690145,0x01CA0197,
-0x022A01FF,0x0288024B,0x02C402AF,0x02F702DD,0x032F030D,0x03290331,0x0330032A,0x03140323,
-0x02EE02FB,0x02AC02CF,0x026F0289,0x0234024D,0x01E90211,0x01B401C9,0x017E019E,0x0165016E,
-0x01520157,0x0164015B,0x01850176,0x01AD0196,0x01E201B7,0x022B0209,0x0268024D,0x02C6029D,
-0x031F02FD,0x03670344,0x03BA0391,0x03ED03D9,0x041003F9,0x04310428,0x0428042C,0x04060415,
-0x03E403FA,0x03BB03D5,0x039003A6,0x0351037F,0x02FC0326,0x02B302D9,0x02680297,0x0217023B,
-0x01DA01FF,0x019E01B1,0x017F018B,0x01650169,0x015A0163,0x0166015D,0x017A0170,0x01970173,
-0x01AF01A2,0x01E001C2,0x020401FA,0x02250211,0x0240022B,0x02550243,0x027A0266,0x026D027C,
-0x027F0273,0x0286027E,0x0270027A,0x028B0274,0x02800280,0x029C028D,0x02BA02A8,0x02DD02C8,
-0x02FE02DE,0x0329030E,0x0337032A,0x034A034D,0x034F0352,0x0361035C,0x03680363,0x035D0367,
-0x03520358,0x032B034B,0x02EA031B,0x02AF02D1,0x025B028B,0x01EB0226,0x016401B2,0x00D3011D,
-0x002B0081,0xFF83FFE4,0xFEDFFF37,0xFE22FE7F,0xFD5FFDC8,0xFC97FCF6,0xFBCEFC30,0xFB1BFB6C,
-0xFA6EFABC,0xF9D5FA19,0xF960F999,0xF911F930,0xF8BAF8DF,0xF86FF88C,0xF844F860,0xF82AF832,
-0xF822F825,0xF83BF82A,0xF854F843,0xF890F86C,0xF8E7F8B9,0xF932F90A,0xF996F96F,0xF9F3F9C9,
-0xFA71FA3B,0xFAE3FAAE,0xFB66FB20,0xFBD3FB9F,0xFC5DFC14,0xFCD2FC9C,0xFD3EFD09,0xFD8EFD6C,
-0xFDDCFDB6,0xFE10FDFC,0xFE32FE21,0xFE55FE41,0xFE61FE5B,0xFE64FE67,0xFE6CFE67,0xFE6AFE6B,
-0xFE6AFE68,0xFE74FE6E,0xFE5CFE6B,0xFE6AFE60,0xFE86FE76,0xFEA9FE92,0xFEFAFECD,0xFF50FF32,
-0xFF9DFF76,0x0015FFD9,0x00860048,0x00E100B3,0x01450115,0x01A8017D,0x020E01DC,0x026E0244,
-0x02CA02AA,0x032302F1,0x035F033E,0x03AA038A,0x03C603BA,0x040003EF,0x041E0414,0x04470434,
-0x04730464,0x0487046C,0x04AF049A,0x04D004CB,0x04E604D8,0x04F604E4,0x04F104FA,0x04FA04F8,
-0x04F104FB,0x04DF04EE,0x04D304DB,0x04AC04C1,0x04730486,0x04240449,0x03B503EC,0x03410383,
-0x02B202FC,0x02050262,0x016B01BE,0x00C90113,0x001E0076,0xFF8DFFD6,0xFEF7FF4A,0xFE74FEB1,
-0xFDF1FE34,0xFD8AFDC1,0xFD2CFD55,0xFCD0FD01,0xFC9CFCB2,0xFC89FC90,0xFC82FC8A,0xFC9FFC8C,
-0xFCBCFCB2,0xFCF6FCD5,0xFD46FD1D,0xFD97FD6A,0xFE02FDCE,0xFE5FFE30,0xFECDFE91,0xFF46FF0C,
-0xFFB7FF77,0x0012FFE8,0x0067003C,0x00C10095,0x00FB00E1,0x013D0128,0x01760166,0x01900184,
-0x01BF01A2,0x01E301D2,0x020401F4,0x0224020B,0x02440232,0x0261024C,0x0270026B,0x02A0027B,
-0x02CE02AE,0x02ED02E1,0x031802FE,0x03420334,0x03680354,0x037B0371,0x038E038E,0x03880395,
-0x037D037E,0x03660371,0x03410357,0x03120329,0x02E702FF,0x02A202C5,0x025F0284,0x02060237,
-0x01B101DB,0x013C0172,0x00E6010C,0x007100A6,0x00180042,0xFFB6FFEE,0xFF61FF8F,0xFF1EFF3E,
-0xFED0FEF4,0xFE87FEA3,0xFE3EFE60,0xFDF7FE11,0xFDB8FDDC,0xFD7AFD92,0xFD56FD69,0xFD3AFD49,
-0xFD17FD29,0xFD0AFD12,0xFCDCFCF4,0xFCE5FCE4,0xFCCEFCD8,0xFCCEFCC7,0xFCC1FCC1,0xFCC6FCBE,
-0xFCDEFCD0,0xFCE0FCDB,0xFCF9FCE7,0xFD0FFD0A,0xFD22FD16,0xFD30FD29,0xFD49FD35,0xFD6AFD59,
-0xFD75FD80,0xFD87FD7B,0xFD9EFD89,0xFDABFDA4,0xFDA7FDA7,0xFD91FD9D,0xFD8AFD89,0xFD8AFD91,
-0xFD8CFD87,0xFD95FD8E,0xFD86FD8D,0xFD91FD8B,0xFD92FD92,0xFDA1FD97,0xFD9DFD98,0xFDA4FD9E,
-0xFDAEFDA8,0xFDAEFDAA,0xFDB9FDBD,0xFDDBFDCC,0xFDF1FDDF,0xFDFBFDEC,0xFE08FE03,0xFE1FFE1E,
-0xFE28FE25,0xFE32FE33,0xFE55FE3F,0xFE6DFE68,0xFE9FFE7D,0xFEC8FEAC,0xFF03FEE0,0xFF50FF31,
-0xFF98FF74,0xFFE9FFC4,0x003C001C,0x00AF007C,0x012A00E1,0x01930157,0x021001C9,0x0279023D,
-0x02E302A1,0x03410308,0x03890362,0x03CB03A2,0x040B03E5,0x043E0422,0x04750464,0x04AE048D,
-0x04D104C0,0x04E204E6,0x04F504FC,0x04FE04FB,0x04E804F4,0x04B904CD,0x049404A2,0x045C0472,
-0x0415043F,0x03C703F6,0x037503A2,0x031F034D,0x02C202FD,0x027202A3,0x0209023F,0x01C201DF,
-0x017D01A2,0x0135015B,0x011D0128,0x00F1010A,0x00E100E5,0x00DD00E6,0x00E000DC,0x00E100E1,
-0x00FE00F4,0x012C0115,0x014F0146,0x0170015E,0x01980183,0x01C401B4,0x01D601C7,0x01DC01DB,
-0x01E101E2,0x01D601DD,0x01C101CD,0x01AC01B6,0x019001AB,0x0166017D,0x01470162,0x01190130,
-0x00DF0105,0x00AB00C0,0x00740091,0x004A0053,0x0011002E,0xFFE6FFFC,0xFFC8FFDE,0xFF97FFB4,
-0xFF77FF93,0xFF47FF5D,0xFF08FF2E,0xFECEFEF0,0xFEA5FEBC,0xFE77FE81,0xFE49FE56,0xFE24FE3A,
-0xFDFBFE0C,0xFDDBFDF3,0xFDC3FDD0,0xFDA5FDBB,0xFD7DFD8D,0xFD61FD72,0xFD56FD5F,0xFD4EFD5C,
-0xFD53FD4B,0xFD69FD63,0xFD78FD67,0xFD9FFD8A,0xFDCBFDAE,0xFDF8FDE1,0xFE27FE07,0xFE67FE3C,
-0xFEAEFE78,0xFEEAFEB4,0xFF33FF0A,0xFF75FF56,0xFFC1FFA3,0xFFF4FFD9,0x001A000A,0x002B0022,
-0x0040003B,0x003E003F,0x002A0035,0x00150022,0xFFF10001,0xFFB8FFD7,0xFF90FF9E,0xFF6AFF7E,
-0xFF40FF4E,0xFF22FF28,0xFF0FFF0D,0xFF00FF0B,0xFEFFFF01,0xFF06FF05,0xFF14FF06,0xFF38FF2B,
-0xFF6AFF56,0xFF95FF7E,0xFFB8FFAC,0xFFF3FFD5,0x00300016,0x005E0043,0x00970084,0x00BB00AE,
-0x00D100C4,0x00E900E0,0x00F200E9,0x00EB00F8,0x00CF00D8,0x009A00B2,0x0065007F,0x00310056,
-0xFFD5000A,0xFF94FFB9,0xFF3EFF63,0xFED9FF08,0xFE74FEA8,0xFE17FE3F,0xFDB9FDE1,0xFD77FD9D,
-0xFD37FD60,0xFCF8FD1B,0xFCB4FCDB,0xFC82FCA1,0xFC58FC62,0xFC31FC47,0xFC11FC1C,0xFC14FC0D,
-0xFBFEFC0C,0xFC0FFC00,0xFC1BFC0D,0xFC59FC3D,0xFC7EFC79,0xFCB8FCA1,0xFCFBFCDE,0xFD42FD25,
-0xFD94FD73,0xFDEBFDBE,0xFE43FE0F,0xFE9CFE75,0xFEEAFEC7,0xFF2BFF14,0xFF82FF58,0xFFCFFFB2,
-0x0009FFF3,0x003D0022,0x00890061,0x00BA00A5,0x00F000D0,0x01240106,0x01580141,0x0175016D,
-0x019B0185,0x01C001AC,0x01DF01CD,0x020301EC,0x022B0214,0x02550247,0x0288026E,0x02A70292,
-0x02D502BD,0x02FF02E6,0x031E030A,0x033E0332,0x035B034B,0x03760366,0x03900386,0x03B1039F,
-0x03CE03C7,0x03E603D2,0x03F903EA,0x041A040A,0x04220426,0x04440434,0x045C044D,0x0475046C,
-0x049D0486,0x04BB04AE,0x04DA04CF,0x04F004E7,0x04F704EF,0x04EB04F5,0x04CA04D7,0x049104AA,
-0x043B0466,0x03D50405,0x034F0395,0x02B002FD,0x02000256,0x01210189,0x005000BC,0xFF6DFFE2,
-0xFEA3FF02,0xFDE8FE43,0xFD33FD96,0xFCAEFCF0,0xFC21FC5D,0xFBBFFBF0,0xFB5CFB8C,0xFB1FFB37,
-0xFAF3FB0A,0xFADDFADC,0xFAD5FAD7,0xFAFFFAF6,0xFB41FB20,0xFB7BFB5C,0xFBC8FB9B,0xFC19FBF1,
-0xFC6BFC3D,0xFCC1FC96,0xFD18FCF1,0xFD72FD41,0xFDB5FD99,0xFDFCFDD6,0xFE3EFE14,0xFE66FE55,
-0xFE81FE7D,0xFE9DFE90,0xFEA5FEAD,0xFEAEFEA3,0xFECAFEBA,0xFEEBFED2,0xFF09FEF3,0xFF29FF0E,
-0xFF5FFF44,0xFF96FF81,0xFFDAFFB3,0x0023FFF4,0x00640042,0x00A70086,0x00EF00BE,0x01290111,
-0x015E0146,0x01860175,0x01A8019E,0x01AE01B1,0x01A501B5,0x01AA01B5,0x019C019F,0x017E0193,
-0x01590160,0x01470157,0x0125013C,0x00FD0100,0x00C600E8,0x00A300B3,0x00750088,0x00520064,
-0x00340044,0x00280035,0x0024002E,0x0014001A,0x000F0012,0x0019001B,0x0014001A,0x00130013,
-0x00050010,0x0002000E,0xFFEFFFF5,0xFFCDFFDB,0xFFACFFB7,0xFF8AFF96,0xFF52FF69,0xFF08FF26,
-0xFED3FEEC,0xFE86FEB0,0xFE37FE64,0xFDEDFE19,0xFDB8FDD0,0xFD77FD93,0xFD35FD4D,0xFCDFFD15,
-0xFC92FCAE,0xFC57FC71,0xFC00FC33,0xFBC8FBEC,0xFB9FFBB5,0xFB71FB8D,0xFB62FB79,0xFB58FB57,
-0xFB4CFB4F,0xFB51FB4B,0xFB6BFB60,0xFB91FB75,0xFBC2FBAE,0xFC07FBE3,0xFC5BFC30,0xFCCAFC96,
-0xFD48FD07,0xFDC1FD86,0xFE2FFDFA,0xFEBFFE7B,0xFF3EFEF9,0xFFD1FF81,0x0032000E,0x00AD0076,
-0x013200F0,0x01AF016D,0x022901E9,0x02940263,0x02F102C5,0x036D0336,0x03B1038A,0x042D03F0,
-0x0480044F,0x04D404A9,0x0535050C,0x059B056D,0x05FD05CB,0x065E0630,0x06B9068B,0x071D06F2,
-0x07780744,0x07DA07A1,0x08290809,0x088B0860,0x08E008B7,0x091B0900,0x093A0931,0x09500931,
-0x0933094C,0x0904091B,0x08CB08F1,0x087D08A4,0x08380855,0x07CD07FC,0x075F0794,0x06F6072C,
-0x068606C4,0x06390660,0x05BE0609,0x055F058D,0x05110539,0x04B004E4,0x04740498,0x0412043A,
-0x03CA03E9,0x0366039D,0x02FE032B,0x029602CE,0x02340262,0x01B101F1,0x0148017F,0x00DA0111,
-0x00480094,0xFFCF000F,0xFF3BFF87,0xFEB2FEEA,0xFE0EFE5D,0xFD78FDBD,0xFCE2FD24,0xFC57FC99,
-0xFBE1FC19,0xFB6AFBA4,0xFB08FB38,0xFAAFFADC,0xFA55FA85,0xFA02FA25,0xF9CCF9E7,0xF993F9B0,
-0xF981F981,0xF960F96A,0xF963F961,0xF955F958,0xF956F951,0xF952F959,0xF964F95D,0xF957F958,
-0xF961F95D,0xF94FF957,0xF944F94A,0xF938F943,0xF92AF935,0xF907F91A,0xF8E5F8F0,0xF8CEF8D2,
-0xF8A4F8BB,0xF87FF892,0xF862F86D,0xF864F861,0xF849F860,0xF853F851,0xF87EF872,0xF88EF882,
-0xF8B3F89A,0xF8E0F8CA,0xF924F901,0xF97AF946,0xF9CAF9A1,0xFA27F9F9,0xFAA4FA6D,0xFB11FAD7,
-0xFB8DFB4C,0xFC0DFBC6,0xFC92FC50,0xFD2AFCD7,0xFDC6FD72,0xFE61FE14,0xFEF8FEB8,0xFFAEFF55,
-0x00520001,0x00E80094,0x01890138,0x022D01DB,0x02E00290,0x03820332,0x042003D7,0x04C40467,
-0x055D0514,0x05F605A8,0x068B063A,0x070206C0,0x076D073A,0x07DB07A9,0x08260801,0x086C0849,
-0x088D0883,0x08AF08A0,0x08A708A5,0x088F0898,0x085F0877,0x080F083F,0x07B207E6,0x0739077B,
-0x06B206FF,0x06300675,0x059205E2,0x04D90533,0x042C0482,0x038803E7,0x02D20335,0x021E0282,
-0x016901CB,0x00BD011D,0x002A0074,0xFF8DFFD6,0xFF0CFF4D,0xFE89FECD,0xFE2FFE53,0xFDD2FE01,
-0xFD7EFDAC,0xFD47FD61,0xFD0FFD26,0xFD04FD00,0xFD00FCF8,0xFD07FCFC,0xFD27FD13,0xFD37FD25,
-0xFD6FFD53,0xFDA6FD8D,0xFDCDFDBA,0xFE1CFDF2,0xFE44FE33,0xFE7CFE61,0xFEBAFEA1,0xFEF8FED4,
-0xFF39FF14,0xFF78FF57,0xFFC1FF9E,0x0009FFE2,0x00580028,0x00AB0084,0x010800D9,0x014F0129,
-0x01BB0181,0x021901EB,0x0260023F,0x02C4028B,0x030902DF,0x03550329,0x039D0374,0x03DF03B5,
-0x042B040C,0x0480045F,0x04B90499,0x04FE04D5,0x05280510,0x054E0538,0x05590556,0x0559055B,
-0x05580560,0x05330544,0x04F90517,0x04B404D8,0x04630493,0x040E043A,0x039803D1,0x03310369,
-0x02B202F7,0x0243027C,0x01C20207,0x015E0191,0x00EE0116,0x009600BF,0x00280060,0xFFC6FFF6,
-0xFF5AFF8C,0xFEEFFF20,0xFE80FEB0,0xFE16FE56,0xFDA6FDE2,0xFD35FD6E,0xFCC6FCFC,0xFC47FC84,
-0xFBC6FC0A,0xFB38FB8E,0xFAA4FAF2,0xFA08FA62,0xF971F9C3,0xF8F8F936,0xF883F8B5,0xF823F846,
-0xF7C2F7E0,0xF765F797,0xF72DF746,0xF6EFF713,0xF6CDF6DE,0xF6CAF6D4,0xF6E2F6CF,0xF718F6F9,
-0xF74FF72F,0xF7AFF77D,0xF807F7E3,0xF886F84A,0xF90AF8C7,0xF97CF946,0xFA04F9B3,0xFA69FA37,
-0xFAE5FAA2,0xFB59FB24,0xFBCFFB94,0xFC2CFC08,0xFC79FC58,0xFCC5FC9F,0xFD17FCE9,0xFD55FD33,
-0xFD7DFD69,0xFDA6FD8D,0xFDD6FDC7,0xFE00FDEA,0xFE30FE0C,0xFE5EFE45,0xFE9BFE7A,0xFEE2FEB9,
-0xFF24FEFF,0xFF83FF51,0xFFE3FFB2,0x00710028,0x010100B3,0x0197013D,0x023001DD,0x02E00286,
-0x03890333,0x044003DE,0x04E90499,0x059D0546,0x063705EF,0x06C2067E,0x073606FF,0x076D0752,
-0x07A40793,0x07BE07B3,0x079907AA,0x0770077B,0x072E074B,0x06DF070C,0x069706B7,0x063D066C,
-0x05E8060F,0x057E05BE,0x052B055E,0x04D60500,0x046B049C,0x04130440,0x03D303F3,0x038C03A5,
-0x0346036D,0x030A032C,0x02BE02E5,0x02800298,0x02300259,0x01FC020F,0x01AE01D6,0x01730191,
-0x01390151,0x010C0123,0x00EF0101,0x00CA00E4,0x00BE00CA,0x009A00AF,0x0094008F,0x00940088,
-0x00AC009F,0x00C300AB,0x00D100CA,0x00FE00E5,0x011F010E,0x01350136,0x014F0142,0x015C0159,
-0x01400151,0x01310138,0x011A011F,0x0100010E,0x00D400E8,0x00A300BC,0x00600080,0x000F0036,
-0xFFBBFFE0,0xFF68FF92,0xFF05FF37,0xFEC9FEEF,0xFE7DFEA8,0xFE45FE62,0xFE16FE38,0xFDDDFDF1,
-0xFDBCFDD1,0xFD8DFDAA,0xFD78FD82,0xFD70FD79,0xFD6FFD73,0xFD86FD77,0xFDB5FDA8,0xFDE6FDC8,
-0xFE32FE0C,0xFE70FE48,0xFEB9FE8E,0xFF10FEE8,0xFF61FF3A,0xFF9BFF78,0x0006FFCB,0x0053002E,
-0x00930070,0x00CE00B4,0x011500F2,0x0129011F,0x01430138,0x01450146,0x0135013B,0x0127012F,
-0x00F2010B,0x00C000DB,0x00770094,0x000A0046,0xFF94FFD1,0xFF25FF55,0xFE91FEE0,0xFE0EFE55,
-0xFD91FDCE,0xFD16FD48,0xFCA6FCD4,0xFC3BFC67,0xFBE7FC05,0xFB96FBB5,0xFB51FB6D,0xFB2CFB3C,
-0xFAFBFB10,0xFAEBFAF5,0xFAE7FADB,0xFAEAFAEA,0xFB1EFB07,0xFB2AFB2F,0xFB75FB4E,0xFB9CFB7E,
-0xFBC5FBAD,0xFC06FBDE,0xFC53FC2B,0xFC8FFC67,0xFCCEFCB1,0xFD17FCF2,0xFD6AFD37,0xFDB2FD92,
-0xFDF2FDCB,0xFE29FE0E,0xFE6DFE4D,0xFEAAFE8E,0xFED3FEC6,0xFF13FEF6,0xFF44FF21,0xFF67FF60,
-0xFF86FF7A,0xFFB7FF9E,0xFFD1FFC7,0xFFE0FFD9,0xFFDCFFE1,0xFFD6FFDD,0xFFCFFFD2,0xFFBBFFD1,
-0xFF9CFFA4,0xFF7EFF90,0xFF65FF75,0xFF48FF57,0xFF1FFF30,0xFF00FF0A,0xFEF9FEEC,0xFF02FEF7,
-0xFF17FF06,0xFF3FFF22,0xFF7EFF5D,0xFFC7FF9A,0x0011FFE6,0x00820053,0x00FB00C6,0x016D0131,
-0x01FE01BD,0x02890249,0x032802D7,0x03B60371,0x042903EF,0x049E045B,0x050604CB,0x054F0524,
-0x05A40579,0x05DA05C3,0x05FA05EE,0x060E060A,0x06250623,0x061F0624,0x05FA0612,0x05D605F7,
-0x05A405C7,0x057B0589,0x053C055A,0x04F3051D,0x04C004DB,0x048004A2,0x042B045B,0x03E2040A,
-0x03AA03BE,0x0350037A,0x03150329,0x02CA02F4,0x027502A2,0x023B025B,0x02010221,0x01AA01D4,
-0x016D0189,0x011B014A,0x00C200F6,0x008000A1,0x00580067,0x00170037,0xFFE7FFFB,0xFFD9FFD7,
-0xFFC3FFC1,0xFFAEFFAF,0xFFADFFB3,0xFFA5FFA7,0xFFB1FFA9,0xFFB0FFB0,0xFFB8FFC4,0xFFBBFFC1,
-0xFFB8FFAF,0xFFABFFB4,0xFFA3FFA4,0xFF8FFF9E,0xFF75FF7D,0xFF4DFF66,0xFF24FF34,0xFF04FF12,
-0xFED2FEE5,0xFEA0FEC1,0xFE8DFE97,0xFE74FE7B,0xFE5AFE68,0xFE50FE52,0xFE4BFE50,0xFE4DFE4A,
-0xFE5AFE55,0xFE6EFE74,0xFE93FE82,0xFEAFFEA6,0xFECDFEBF,0xFEE3FEDA,0xFEEFFEE1,0xFF00FEFA,
-0xFF04FEF7,0xFF10FF07,0xFEF4FF09,0xFEF0FEF0,0xFED8FEEC,0xFEC2FEDB,0xFEA6FEB8,0xFE92FEA5,
-0xFE94FE96,0xFE80FE8E,0xFE85FE7D,0xFE94FE88,0xFEA2FE9B,0xFEC3FEAE,0xFEECFED6,0xFF1FFF03,
-0xFF48FF36,0xFF6FFF55,0xFF8DFF78,0xFFB6FFA2,0xFFC3FFC3,0xFFD0FFBD,0xFFEDFFEA,0xFFF4FFF5,
-0xFFF9FFF2,0xFFE8FFF2,0xFFE7FFEE,0xFFBAFFDA,0xFF8BFFB2,0xFF70FF80,0xFF41FF5F,0xFF2DFF2B,
-0xFF18FF22,0xFF0CFF07,0xFF07FF05,0xFF02FEFD,0xFF10FF04,0xFF2BFF21,0xFF3DFF31,0xFF62FF4F,
-0xFF89FF76,0xFFB2FFA1,0xFFDEFFC2,0x0010FFEF,0x00430025,0x0060004B,0x00710056,0x00710072,
-0x00660064,0x006B0067,0x00490060,0x0029003F,0x00180025,0xFFE8FFFD,0xFFA8FFC8,0xFF87FFA2,
-0xFF53FF72,0xFF2AFF44,0xFEFAFF0D,0xFEEEFEE1,0xFEF5FEEC,0xFEF4FEF0,0xFF12FEFF,0xFF37FF1A,
-0xFF65FF46,0xFFA4FF8C,0xFFEBFFCD,0x004A001A,0x00AE0089,0x011D00DA,0x017B014A,0x01E901B3,
-0x02610220,0x02B70284,0x030302E5,0x03610339,0x0398037C,0x03D803C0,0x040803FB,0x04490431,
-0x045E0460,0x0478046E,0x048C0489,0x04920496,0x047D048A,0x04790480,0x046E047C,0x0447045C,
-0x04270437,0x03F60408,0x03B903D1,0x03670388,0x02F40333,0x028A02BE,0x02140252,0x01AA01DE,
-0x0142017F,0x00D80105,0x008700B1,0x000D0049,0xFF9DFFD8,0xFF4AFF7A,0xFEF2FF15,0xFE9EFEC9,
-0xFE61FE76,0xFE29FE44,0xFE0FFE2B,0xFDF9FDFF,0xFDD8FDE0,0xFDCAFDD8,0xFDD3FDD0,0xFDD0FDD3,
-0xFDDDFDD6,0xFDF0FDE7,0xFE0FFE07,0xFE36FE2E,0xFE72FE54,0xFEB9FE91,0xFEF5FECF,0xFF25FF07,
-0xFF5AFF44,0xFF8AFF6D,0xFFBFFFAB,0xFFDAFFBF,0xFFFCFFED,0xFFF8FFFA,0x00060004,0x000D0017,
-0xFFF80007,0xFFDBFFEA,0xFFB7FFCB,0xFF8AFF97,0xFF4BFF64,0xFF0DFF28,0xFEDEFEF5,0xFEB8FECE,
-0xFE81FE96,0xFE57FE6A,0xFE3AFE46,0xFE1FFE22,0xFE23FE27,0xFE2DFE32,0xFE54FE3B,0xFE7AFE64,
-0xFEAFFE89,0xFEEEFED3,0xFF32FF12,0xFF6FFF4E,0xFFA4FF83,0xFFDCFFC1,0x0001FFF0,0x00180013,
-0x00420036,0x00520050,0x005C0052,0x00510058,0x0032003A,0x00130022,0xFFDFFFFE,0xFFB0FFC4,
-0xFF7CFF92,0xFF4CFF5F,0xFF02FF22,0xFECDFEE6,0xFE7EFEA4,0xFE34FE50,0xFDE1FE01,0xFD8CFDBC,
-0xFD3BFD65,0xFCEAFD0F,0xFC9AFCB8,0xFC64FC83,0xFC36FC54,0xFC0DFC2E,0xFBF3FC06,0xFBD8FBED,
-0xFBD6FBD9,0xFBBEFBC1,0xFBB8FBBD,0xFBB2FBBB,0xFBB0FBB8,0xFBCBFBBA,0xFBD6FBCB,0xFBDFFBD0,
-0xFBEEFBE6,0xFC04FBF1,0xFC17FC0A,0xFC27FC19,0xFC52FC3B,0xFC81FC67,0xFCAAFC90,0xFCE8FCCD,
-0xFD17FD02,0xFD4FFD3A,0xFD8DFD72,0xFDD3FDB0,0xFE24FDFA,0xFE5BFE3B,0xFEB2FE80,0xFF00FED3,
-0xFF3BFF19,0xFF7FFF5B,0xFFC5FF9E,0x0019FFE4,0x0063003C,0x00A7007E,0x00ED00CD,0x01310108,
-0x016E014A,0x01AA0190,0x01DC01C5,0x0229020F,0x026D0250,0x02A8028E,0x02E902CA,0x03230300,
-0x036A0340,0x03A40386,0x03E703C1,0x041F0403,0x0450043B,0x04740457,0x049B0488,0x04B004A2,
-0x04D404BE,0x04D804D4,0x04D804DB,0x04D004DD,0x04CF04E0,0x049F04B5,0x0490048C,0x045C0475,
-0x042D0448,0x03E6040B,0x039D03C2,0x0348037B,0x02EF0322,0x028802C4,0x022B0260,0x01C901F7,
-0x015A0196,0x0102012F,0x00A900DA,0x006A007F,0x002C003B,0xFFF50016,0xFFDDFFE7,0xFFCAFFDA,
-0xFFC7FFCB,0xFFD7FFC9,0xFFF3FFE5,0x000FFFFE,0x003A0022,0x00790052,0x00AF008B,0x010100CB,
-0x0135011F,0x0182015E,0x01AF0197,0x01D801C0,0x01F301E4,0x01FD01F3,0x020A0207,0x02080206,
-0x01F301FA,0x01E201EF,0x01B901C8,0x01A001AF,0x0165017A,0x01360149,0x00FD011A,0x00B500D6,
-0x00740095,0x0041005F,0xFFF8001F,0xFFC8FFE3,0xFF8AFFB0,0xFF3BFF6F,0xFEF1FF1D,0xFEABFED1,
-0xFE6FFE91,0xFE1DFE4D,0xFDDBFDFA,0xFD8BFDB6,0xFD52FD7D,0xFD0AFD28,0xFCCDFCDE,0xFC84FCA2,
-0xFC51FC6B,0xFC1DFC30,0xFC08FC12,0xFBF7FBFB,0xFBE3FBEC,0xFBEDFBE2,0xFBD4FBDE,0xFBD6FBDF,
-0xFBEEFBE3,0xFC01FBFE,0xFC07FC04,0xFC24FC0F,0xFC4DFC3C,0xFC6FFC62,0xFCA8FC8F,0xFCD8FCC4,
-0xFD09FCF2,0xFD3BFD22,0xFD7DFD64,0xFDB7FDA5,0xFDF2FDD1,0xFE1FFE08,0xFE49FE2C,0xFE89FE68,
-0xFEBAFE95,0xFECCFEC8,0xFEE5FEE4,0xFEE9FEEC,0xFEF4FEEB,0xFEF6FEF3,0xFEEBFEE6,0xFEEBFEE6,
-0xFEEEFEE1,0xFEE8FEEE,0xFEE6FEEA,0xFEEBFEE9,0xFEE7FEEC,0xFECFFEE5,0xFEF0FEE7,0xFEF4FEF0,
-0xFEFDFEFB,0xFF24FF10,0xFF34FF2B,0xFF60FF52,0xFF96FF79,0xFFC6FFB5,0x000FFFE4,0x006E0036,
-0x00B6008B,0x010B00D8,0x0160012F,0x01C30192,0x022501FA,0x026F0244,0x02BF029D,0x02FF02E8,
-0x032A0318,0x033A0334,0x03570344,0x035F0361,0x03650363,0x0360035E,0x03670362,0x03630364,
-0x0357035C,0x03560358,0x033D033E,0x033F0341,0x0350034D,0x034F034E,0x03500352,0x035C035B,
-0x037C0371,0x039B037A,0x03AC03A0,0x03BC03B3,0x03D103CB,0x03CF03D2,0x03E803DD,0x03E903E3,
-0x03CD03DA,0x03AB03BC,0x038C039E,0x03660385,0x03340342,0x02FA031D,0x02C702E8,0x028C02AD,
-0x02700273,0x02510259,0x02230242,0x02160217,0x0211020C,0x02150219,0x02180217,0x022E021C,
-0x02540247,0x027A0268,0x029C0286,0x02B202B0,0x02C402C6,0x02DC02CD,0x02D102D2,0x02C402C9,
-0x02AF02BA,0x02A702A9,0x028802A0,0x02680284,0x024C0257,0x02290234,0x01FF0218,0x01CE01E7,
-0x01B401BD,0x018C01A1,0x0168017A,0x0164016B,0x0152015D,0x013C014D,0x013B013F,0x012F013D,
-0x0148012E,0x0141013E,0x013B013C,0x012C0138,0x01290125,0x0116011C,0x00E700F5,0x00C200D2,
-0x00680089,0x00090041,0xFF99FFD3,0xFF22FF60,0xFE98FED5,0xFE1CFE5E,0xFD80FDD5,0xFD03FD46,
-0xFC76FCB7,0xFBF0FC31,0xFB7EFBB5,0xFB0CFB36,0xFA99FAD7,0xFA43FA69,0xFA0FFA27,0xF9CBF9ED,
-0xF9B5F9BC,0xF98DF9A1,0xF97EF98B,0xF964F974,0xF965F968,0xF970F96B,0xF978F974,0xF990F97A,
-0xF9B9F9A4,0xF9E7F9D7,0xFA17FA01,0xFA5AFA32,0xFA93FA80,0xFACAFAAA,0xFB15FAF8,0xFB58FB31,
-0xFB91FB78,0xFBC5FBA7,0xFBFCFBE0,0xFC42FC2C,0xFC6AFC58,0xFC84FC75,0xFC9DFC97,0xFCB3FCAE,
-0xFCC4FCB6,0xFCC1FCC3,0xFCCDFCD2,0xFCC3FCC6,0xFCD3FCCC,0xFCD2FCCE,0xFCE3FCE1,0xFCE1FCE6,
-0xFCEEFCEA,0xFD00FCFD,0xFD20FD15,0xFD3AFD2B,0xFD6CFD5F,0xFDACFD89,0xFE08FDDD,0xFE4FFE2A,
-0xFE93FE63,0xFEEEFEC0,0xFF3CFF11,0xFFA0FF73,0xFFFEFFD7,0x006D0036,0x00D200A2,0x0145010C,
-0x01A4017A,0x021901E6,0x027D0250,0x02E802B9,0x035F031F,0x03D10393,0x04490412,0x04C20490,
-0x053804FC,0x05AA057A,0x061D05E2,0x067F0650,0x06C906A2,0x070A06EA,0x073E0733,0x0759074E,
-0x075A075C,0x07580755,0x073B074F,0x07130723,0x06E106F3,0x068C06AC,0x063A0667,0x05C605F1,
-0x0565059D,0x04EA051D,0x047D04B4,0x041F0455,0x03AB03ED,0x033A0378,0x02DE0310,0x027802B1,
-0x021E0249,0x01BF01DE,0x017B0197,0x0142015F,0x0102012C,0x00D500E5,0x00A500BD,0x007D008D,
-0x0055005E,0x002E004B,0x000F001C,0x0008001A,0xFFDFFFF5,0xFFD9FFEF,0xFFCEFFD6,0xFFAEFFC1,
-0xFF9AFFA3,0xFF79FF86,0xFF42FF62,0xFF19FF34,0xFEFCFF11,0xFEDBFEF5,0xFECAFED2,0xFEB1FEC6,
-0xFEA9FEA8,0xFEABFEA8,0xFEA5FEAF,0xFE99FE9B,0xFE91FE88,0xFE98FE94,0xFE8CFE91,0xFE88FE82,
-0xFE83FE7D,0xFE83FE7B,0xFE60FE6C,0xFE3FFE4B,0xFE0BFE27,0xFDDCFDFB,0xFDA8FDCE,0xFD8CFD9C,
-0xFD47FD6D,0xFD1EFD2B,0xFCF9FD02,0xFCC7FCD5,0xFCA9FCB4,0xFC96FCA2,0xFC8BFC9C,0xFC8BFC86,
-0xFC97FC89,0xFCC3FCAC,0xFCE8FCCE,0xFD11FD04,0xFD53FD33,0xFD9BFD73,0xFDCFFDB5,0xFE10FDFB,
-0xFE47FE2E,0xFE8FFE71,0xFEC9FEA5,0xFEFAFEE1,0xFF34FF12,0xFF58FF41,0xFF8FFF74,0xFFA1FF98,
-0xFFADFFA8,0xFFBAFFB6,0xFFD1FFC3,0xFFD7FFCE,0xFFF4FFE3,0xFFEEFFEE,0x0003FFF8,0x0005000A,
-0x000F000C,0xFFFE0000,0xFFE2FFED,0xFFD2FFE8,0xFFC0FFD6,0xFF9DFFB2,0xFF86FF93,0xFF76FF7D,
-0xFF5DFF62,0xFF5CFF58,0xFF3DFF4D,0xFF26FF32,0xFF1AFF19,0xFF04FF0D,0xFEF6FEFB,0xFEE3FEE9,
-0xFED5FED7,0xFEC5FED9,0xFEC1FEBB,0xFEB3FEBA,0xFEA9FEA9,0xFE94FEA3,0xFE72FE84,0xFE64FE6C,
-0xFE54FE4E,0xFE4CFE44,0xFE37FE44,0xFE06FE1C,0xFDF5FDFD,0xFDD4FDE5,0xFDCEFDC8,0xFDCBFDCC,
-0xFDB0FDB3,0xFDC4FDB7,0xFDC9FDC7,0xFDE9FDE0,0xFDFFFDF0,0xFE1CFE0C,0xFE47FE32,0xFE6AFE4D,
-0xFEA7FE88,0xFEE1FEC0,0xFF29FF03,0xFF70FF50,0xFFB8FF8E,0x001AFFE9,0x0077004A,0x00DA00A7,
-0x01300109,0x01910158,0x01F301C7,0x02580221,0x02C0028B,0x032C02F3,0x0388035D,0x03EC03BB,
-0x044C0412,0x04AF0478,0x04F204CB,0x0521050E,0x055E0543,0x05800574,0x05A4058D,0x05CB05C1,
-0x05DD05DB,0x05E605E2,0x05D105D5,0x05D005D7,0x05B105BC,0x058D05A7,0x05600576,0x0537054D,
-0x0500051E,0x04B204D1,0x046B0484,0x0411043D,0x03C903EF,0x035E039C,0x03120336,0x02A502DB,
-0x024E027E,0x02030230,0x01AD01D2,0x0159018C,0x01060138,0x00C000DB,0x0070009E,0x0035005A,
-0xFFF10017,0xFFBCFFDB,0xFF94FFA9,0xFF6AFF8B,0xFF36FF4A,0xFF05FF1D,0xFEC5FEE6,0xFE84FEA5,
-0xFE38FE57,0xFDF2FE15,0xFDAEFDD0,0xFD5DFD8D,0xFD17FD3E,0xFCB8FCEC,0xFC6AFC96,0xFC18FC39,
-0xFBC4FBE4,0xFB87FBA6,0xFB3EFB66,0xFB14FB25,0xFAC8FAED,0xFA8FFAB0,0xFA74FA8F,0xFA4DFA5F,
-0xFA34FA47,0xFA25FA2D,0xFA27FA22,0xFA3FFA27,0xFA64FA49,0xFA8FFA77,0xFAC8FAAB,0xFB17FAF7,
-0xFB7FFB49,0xFBE0FBAF,0xFC59FC19,0xFCC8FC92,0xFD52FD09,0xFDF0FD9B,0xFE7FFE2B,0xFF0AFEC6,
-0xFFB3FF5D,0x0044FFF7,0x00CD0092,0x01570111,0x01DD0196,0x024E0219,0x02B40286,0x032002EC,
-0x03820357,0x03D503A1,0x042003FC,0x0449043A,0x046F0460,0x047C0476,0x04820487,0x047E048B,
-0x046A047E,0x04520457,0x04350449,0x03FE0415,0x03CA03DE,0x038203A2,0x033D0359,0x02E20312,
-0x029902BD,0x02340260,0x01EA0213,0x01A101CE,0x012F0173,0x00DF0117,0x008900C0,0x003B0063,
-0xFFE40013,0xFF94FFAE,0xFF51FF74,0xFF1AFF3D,0xFEEAFEF7,0xFEACFECB,0xFE80FE91,0xFE49FE66,
-0xFE14FE21,0xFDDFFDF2,0xFDA4FDC0,0xFD83FD9A,0xFD5DFD6B,0xFD3DFD4D,0xFD17FD27,0xFCF8FD0C,
-0xFCDFFCF4,0xFCC3FCDC,0xFCC0FCC7,0xFCB1FCC0,0xFCAAFCA8,0xFCBEFCBA,0xFCC8FCC3,0xFCDDFCDD,
-0xFD0AFCF3,0xFD32FD1F,0xFD5DFD45,0xFD99FD71,0xFDC6FDAE,0xFE03FDDB,0xFE51FE29,0xFEA1FE70,
-0xFF06FEC4,0xFF69FF32,0xFFCCFF99,0x003E0008,0x009C006F,0x011B00E1,0x018F0168,0x022201D8,
-0x029A025F,0x032102D8,0x03960358,0x041103CE,0x048B0448,0x04FF04C0,0x0565052D,0x05C90599,
-0x061E05F6,0x067C0642,0x06C80699,0x06F806DA,0x0723070F,0x073A0728,0x07370735,0x071B072E,
-0x06E3070C,0x069206BD,0x06380664,0x05D4060B,0x057F05A1,0x05010540,0x048E04C6,0x040A0457,
-0x038703BE,0x0318034B,0x029B02D2,0x021F0265,0x01BD01ED,0x0161018C,0x0106012B,0x00AC00D7,
-0x00620088,0x00060033,0xFFBEFFE7,0xFF70FF96,0xFF2BFF4F,0xFEE8FF09,0xFEA9FEC6,0xFE60FE8A,
-0xFE3EFE57,0xFE0BFE21,0xFDD5FDF2,0xFDA2FDB0,0xFD71FD8D,0xFD55FD60,0xFD30FD3F,0xFD10FD1A,
-0xFD15FD03,0xFD0CFD0E,0xFD16FD0F,0xFD0AFD12,0xFD21FD0F,0xFD2FFD28,0xFD4DFD36,0xFD66FD66,
-0xFD7DFD73,0xFD98FD85,0xFDB2FDAD,0xFDB5FDB9,0xFDAFFDB4,0xFDA3FDAD,0xFD90FDA6,0xFD6FFD7E,
-0xFD49FD59,0xFD16FD30,0xFCDEFCFA,0xFCC0FCD2,0xFCA2FCB1,0xFC8BFC8F,0xFC6EFC7D,0xFC6AFC69,
-0xFC78FC6E,0xFC79FC7B,0xFCA2FC89,0xFCD4FCBB,0xFD14FCF6,0xFD59FD2C,0xFD9FFD78,0xFDF6FDCA,
-0xFE56FE20,0xFE9AFE77,0xFEEEFEBD,0xFF3FFF15,0xFF8AFF68,0xFFD4FFAF,0x000CFFF7,0x003F0025,
-0x006D005F,0x008E0085,0x00900089,0x00950092,0x009D0090,0x0085008D,0x00820089,0x0089007E,
-0x007E007D,0x0079007C,0x00780076,0x008C007E,0x00A90094,0x00C900AE,0x00F600DB,0x01190107,
-0x0155013D,0x01890172,0x01AA0198,0x01DC01D5,0x01F501EB,0x020A020D,0x02220215,0x022A0220,
-0x02410235,0x023A0235,0x022C0236,0x0208021E,0x01EE0201,0x01D301E5,0x019701B2,0x014A0176,
-0x011D0142,0x00CE00F8,0x008A00B0,0x0034005E,0xFFEA0015,0xFF9EFFCE,0xFF3CFF6B,0xFEDFFEFE,
-0xFE93FEAE,0xFE30FE59,0xFDDCFE06,0xFD93FDB9,0xFD49FD6C,0xFCFCFD1F,0xFCC1FCE7,0xFC95FCAC,
-0xFC62FC7F,0xFC2CFC4B,0xFC21FC1B,0xFC19FC16,0xFC1DFC16,0xFC0AFC10,0xFC33FC20,0xFC50FC45,
-0xFC79FC6D,0xFCB8FCA1,0xFCE7FCC3,0xFD2EFD12,0xFD86FD59,0xFDEAFDBC,0xFE64FE21,0xFECCFE9A,
-0xFF40FF09,0xFFABFF7C,0x0017FFE4,0x0083004D,0x00F500BF,0x0167012E,0x01D3019C,0x02570215,
-0x02C4028D,0x031E02EF,0x037F0354,0x03C8039B,0x040503EE,0x04360418,0x04440436,0x044C044B,
-0x044C0457,0x044D0453,0x041F043E,0x04010413,0x03E203FC,0x03A403C4,0x03630385,0x0315033D,
-0x02E502F8,0x02A002C8,0x02610272,0x022A0246,0x0203021C,0x01C801E5,0x01A601B2,0x01760192,
-0x015B016E,0x014A015E,0x013B0137,0x013C0143,0x01330138,0x0116012A,0x011D011E,0x01170114,
-0x00FD0106,0x00DB00EB,0x00B100C3,0x008800A5,0x0060007C,0x001D003B,0xFFCAFFEF,0xFF72FFA3,
-0xFEFAFF38,0xFE9AFECC,0xFE2EFE64,0xFDC1FE00,0xFD4BFD8D,0xFD03FD1C,0xFCA1FCD5,0xFC4FFC7B,
-0xFC05FC2A,0xFBC2FBE7,0xFB76FB96,0xFB47FB5D,0xFB20FB34,0xFAF7FB03,0xFADAFAE6,0xFAC5FAD9,
-0xFAB9FAC3,0xFAB9FAB9,0xFAC8FABA,0xFACAFAD1,0xFACEFAC6,0xFAE1FAD9,0xFAFBFAEF,0xFB22FB0D,
-0xFB63FB3B,0xFB8BFB74,0xFBBBFBA0,0xFBFEFBE0,0xFC5AFC29,0xFCADFC88,0xFD09FCD6,0xFD73FD41,
-0xFDD2FDA4,0xFE4AFE0C,0xFEB2FE7F,0xFF2BFEF2,0xFF86FF64,0xFFF3FFC0,0x004B0022,0x00A40075,
-0x00E300C3,0x01300102,0x0150013C,0x019A0178,0x01B901B6,0x01DD01D0,0x020701F3,0x021D0210,
-0x0239022B,0x02550249,0x025B0256,0x027B0277,0x02890281,0x02A00295,0x02B602A6,0x02BD02BA,
-0x02CD02C5,0x02CC02CF,0x02D802D2,0x02D402E0,0x02CD02CD,0x02C302CC,0x02AF02BC,0x029602A8,
-0x026C0284,0x02420257,0x0217022C,0x01E701FC,0x01A901C7,0x01710186,0x013B0153,0x00FC0124,
-0x00DD00EF,0x00BF00DB,0x009400AD,0x0069007B,0x0044004F,0x002E0034,0x001D0023,0xFFFD0016,
-0xFFF7FFFB,0xFFE4FFEE,0xFFE9FFEA,0xFFE8FFF7,0xFFF1FFE9,0x0000FFF4,0x001A0012,0x003B0029,
-0x006D004C,0x009A007C,0x00CA00B2,0x011800E6,0x014B0132,0x01990174,0x01DB01C0,0x0226020A,
-0x027A0253,0x02C7029B,0x031A02EF,0x037B033B,0x03CD03AC,0x040603EB,0x045B0430,0x049D0479,
-0x04D204B9,0x050904E9,0x0545052C,0x05670557,0x0595057A,0x05BF05AD,0x05CA05C0,0x05DF05CF,
-0x05CC05D8,0x05C105CA,0x05A005B2,0x057A058F,0x054F055F,0x05050534,0x04C504EB,0x048704AD,
-0x04370464,0x03F30414,0x039003C1,0x03380369,0x02E0030E,0x028502B0,0x0236025F,0x01D30207,
-0x017D01A6,0x012D0151,0x00C800FA,0x0067009B,0x00120036,0xFFC2FFED,0xFF6FFF94,0xFF24FF46,
-0xFEE3FF01,0xFEAFFEC9,0xFE70FE93,0xFE39FE44,0xFE06FE1A,0xFDD3FDED,0xFDAFFDB9,0xFD81FD9B,
-0xFD4CFD68,0xFD3CFD46,0xFD0CFD25,0xFCEEFCFD,0xFCB9FCD5,0xFC79FCA8,0xFC3FFC5A,0xFBFEFC1C,
-0xFBB4FBD3,0xFB55FB7C,0xFB02FB30,0xFA93FACA,0xFA3CFA66,0xF9E5FA1B,0xF97DF9B8,0xF912F94C,
-0xF8D0F8EF,0xF882F8A4,0xF831F85A,0xF7FCF813,0xF7DEF7E9,0xF7C7F7C6,0xF7B6F7CC,0xF7BEF7C0,
-0xF7CFF7C3,0xF7F4F7E6,0xF824F80B,0xF862F83C,0xF8B5F884,0xF90CF8E1,0xF96AF939,0xF9E3F9A7,
-0xFA43FA1B,0xFAC6FA8C,0xFB49FB0D,0xFBCDFB90,0xFC59FC13,0xFCDFFC92,0xFD7EFD32,0xFDF9FDB7,
-0xFE7BFE3F,0xFEF9FEB9,0xFF4EFF26,0xFFC4FF88,0x0036FFF8,0x00810050,0x00D400A3,0x01320104,
-0x018B0163,0x01DC01C1,0x0237020C,0x02880266,0x02C802AE,0x031502E8,0x03530331,0x03880365,
-0x03B903A1,0x03D603CA,0x040903F3,0x041B0413,0x043C0429,0x04400444,0x04520442,0x044D044F,
-0x044B0453,0x04360443,0x043D0436,0x042C0432,0x040A041E,0x04010401,0x03F403F7,0x03EC03E6,
-0x03D103E0,0x03D103CD,0x03DB03C4,0x03DB03DB,0x03DE03CE,0x03FC03F2,0x040903FC,0x0420040F,
-0x04360428,0x0444043E,0x04510455,0x045F045C,0x0463046D,0x046C0467,0x0470046D,0x0455046A,
-0x0442044F,0x041A0438,0x0407040E,0x03DC03EB,0x03BB03BD,0x037B0398,0x035A036F,0x03440354,
-0x031F0333,0x0304030E,0x02DB02F4,0x02B602C6,0x028F02A4,0x0265027F,0x02300252,0x0214021F,
-0x01EC01F8,0x01BE01DC,0x018201A4,0x01380162,0x00F40119,0x00A000BE,0x003C006F,0xFFD90006,
-0xFF5FFFA2,0xFF03FF2E,0xFE84FEBB,0xFE1FFE4E,0xFDA0FDE6,0xFD32FD5D,0xFCC8FD03,0xFC5BFC8D,
-0xFC03FC30,0xFBC1FBD9,0xFB83FB9E,0xFB57FB67,0xFB30FB3F,0xFB23FB27,0xFB1AFB1D,0xFB09FB06,
-0xFB0DFB07,0xFB25FB12,0xFB3BFB31,0xFB51FB40,0xFB88FB7B,0xFB9CFB90,0xFBCDFBB5,0xFBF0FBDB,
-0xFC0CFBF7,0xFC2FFC1A,0xFC48FC3C,0xFC74FC53,0xFCA0FC89,0xFCC9FCB9,0xFCEFFCDC,0xFD19FD0D,
-0xFD40FD2D,0xFD63FD46,0xFD78FD74,0xFDA3FD87,0xFDA4FD9B,0xFDC8FDB4,0xFDE4FDD2,0xFDEDFDE7,
-0xFE04FDFC,0xFE15FE03,0xFE1EFE20,0xFE2EFE2E,0xFE3CFE35,0xFE3EFE43,0xFE4CFE54,0xFE55FE50,
-0xFE6DFE63,0xFE84FE72,0xFE91FE7F,0xFE9FFE95,0xFEB1FEA3,0xFEC4FEBF,0xFED2FECF,0xFEEBFEE6,
-0xFF1CFF0F,0xFF3FFF3B,0xFF6AFF58,0xFF96FF86,0xFFBBFFB3,0xFFF0FFE1,0x00190004,0x00470036,
-0x00790065,0x009B008C,0x00D000BD,0x00F100DC,0x01160102,0x0149012E,0x015C0153,0x0168016A,
-0x01830175,0x0199019A,0x01A9019A,0x01B701B2,0x01BD01B9,0x01C401BB,0x01C301C6,0x01BD01BC,
-0x01B501B8,0x0193019F,0x01720190,0x0155015E,0x01380142,0x01140125,0x00EE0101,0x00CB00D8,
-0x00C000C2,0x008F00A7,0x007F008A,0x00680070,0x00670060,0x00610062,0x006A0063,0x006D0073,
-0x0083007E,0x00A7008D,0x00CE00CC,0x00F300E2,0x0134010A,0x0162014A,0x01980176,0x01CC01B8,
-0x020301E7,0x0241022E,0x0259024C,0x02820272,0x02A00294,0x02C902B7,0x02DD02D1,0x02F802F5,
-0x030502FF,0x032E0318,0x0335032F,0x034A0335,0x0344034B,0x034A0342,0x03390342,0x03420341,
-0x03480349,0x03480343,0x03350336,0x032D032A,0x031B0324,0x02F0030A,0x02C202DE,0x02A002AB,
-0x0261027C,0x02220242,0x01EA0209,0x01A001D4,0x015C0180,0x010B012D,0x00C300E4,0x006C0098,
-0x001D003B,0xFFE7000E,0xFFA5FFC3,0xFF7DFF88,0xFF66FF79,0xFF4BFF53,0xFF4CFF4E,0xFF43FF41,
-0xFF49FF42,0xFF5CFF54,0xFF75FF5D,0xFF82FF74,0xFF91FF87,0xFFA7FF9C,0xFFB8FFBD,0xFFD1FFD1,
-0xFFE2FFE2,0xFFEEFFF2,0xFFE2FFE8,0xFFE2FFE1,0xFFD9FFE6,0xFFB6FFCC,0xFF9DFFA2,0xFF93FF99,
-0xFF7FFF8B,0xFF5CFF73,0xFF33FF4C,0xFF14FF23,0xFEEEFF03,0xFED5FEE3,0xFE9BFEB5,0xFE74FE82,
-0xFE55FE60,0xFE35FE40,0xFDFDFE17,0xFDD0FDEC,0xFD99FDB1,0xFD70FD80,0xFD2DFD57,0xFD0CFD13,
-0xFCE8FCF8,0xFCC5FCCC,0xFCA2FCB2,0xFC9BFC9E,0xFC81FC81,0xFC72FC81,0xFC6AFC6A,0xFC6DFC78,
-0xFC7CFC6D,0xFC85FC7A,0xFC88FC83,0xFCA3FC9B,0xFCCDFCBA,0xFCF2FCE2,0xFD0AFD01,0xFD23FD13,
-0xFD52FD3A,0xFD7BFD61,0xFD9EFD82,0xFDBDFDAA,0xFDECFDD7,0xFE1CFE01,0xFE32FE2A,0xFE67FE50,
-0xFE91FE77,0xFEC0FEA4,0xFEEDFED7,0xFF30FF0D,0xFF66FF46,0xFF9EFF84,0xFFE3FFC2,0x00250006,
-0x005F0041,0x009E008D,0x00E700C6,0x01240100,0x0167013E,0x01A2018D,0x01EE01CC,0x022B0207,
-0x027B0253,0x029E0293,0x02EB02BB,0x031202F7,0x03480322,0x0361034F,0x037B0362,0x038E0391,
-0x039B038E,0x03B103A1,0x03AF03B2,0x03A203AC,0x03A003A0,0x03910399,0x037F0389,0x03660384,
-0x035B035D,0x033C0353,0x031C032A,0x030A030B,0x02E102F2,0x02AC02CB,0x027F0292,0x0238025A,
-0x02000221,0x01B101E0,0x016F0199,0x01330158,0x00DA0102,0x008A00C2,0x005B006E,0x00140037,
-0xFFCEFFF4,0xFFAEFFC4,0xFF8AFF94,0xFF84FF89,0xFF7CFF89,0xFF75FF7A,0xFF6BFF77,0xFF71FF6D,
-0xFF60FF6D,0xFF63FF67,0xFF59FF5B,0xFF4FFF52,0xFF2DFF3D,0xFF27FF31,0xFF0FFF22,0xFEF5FF0A,
-0xFEDCFEE8,0xFEADFEC9,0xFE7BFE95,0xFE56FE6A,0xFE21FE34,0xFE04FE12,0xFDDBFDEE,0xFDD0FDD6,
-0xFDB3FDC0,0xFDAFFDB1,0xFDABFDAC,0xFD9FFD9F,0xFDA4FDA5,0xFDC8FDAD,0xFDE3FDD5,0xFE02FDEB,
-0xFE31FE14,0xFE78FE51,0xFEAFFE8F,0xFEFCFED2,0xFF3FFF15,0xFF91FF65,0xFFD6FFAD,0x003A0000,
-0x00970071,0x00E800B6,0x014B0119,0x01760163,0x01C501A0,0x020501E8,0x022B020F,0x02480244,
-0x025B024C,0x02610263,0x0255025C,0x02390251,0x0216022A,0x01ED0214,0x019601C9,0x013D016A,
-0x00E2010B,0x007A00AB,0x0003003F,0xFF8EFFD0,0xFF20FF58,0xFEAFFEE6,0xFE41FE7C,0xFDC6FE03,
-0xFD62FD91,0xFCF6FD2D,0xFCA6FCD6,0xFC4DFC81,0xFC14FC35,0xFBEBFC00,0xFBCAFBDE,0xFBACFBBB,
-0xFB9EFBA8,0xFB94FB93,0xFB99FB97,0xFBA9FB9F,0xFBBDFBB2,0xFBE6FBD3,0xFC16FBF7,0xFC4CFC33,
-0xFC79FC5D,0xFCB3FCA3,0xFCEAFCD0,0xFD32FD0C,0xFD85FD5D,0xFDC3FD9F,0xFE11FDE0,0xFE63FE3D,
-0xFEA7FE81,0xFEF6FECE,0xFF3CFF1D,0xFF83FF55,0xFFC2FFA1,0xFFF8FFDB,0x00430020,0x0080005F,
-0x00BF00A7,0x010D00E9,0x01460136,0x017D016A,0x01C001A2,0x020C01E9,0x02420226,0x0284025E,
-0x02C402AA,0x030A02E7,0x0358033B,0x039D0377,0x03E203C9,0x04280406,0x045A0445,0x048D0481,
-0x04C704A9,0x04E904D5,0x050F0500,0x05290518,0x0532052D,0x053C0537,0x0545053B,0x0533053F,
-0x05270532,0x05090528,0x04E20505,0x04B404C9,0x047E0496,0x043C0458,0x03FF0414,0x03A403CF,
-0x0346037A,0x02EB031E,0x028602C4,0x02320265,0x01CD0203,0x016E019B,0x011D0142,0x00CF00EE,
-0x00740090,0x001A003F,0xFFCDFFF5,0xFF7EFF9E,0xFF22FF48,0xFEDAFEFE,0xFE80FEA2,0xFE48FE5B,
-0xFE0CFE25,0xFDC7FDEA,0xFD9BFDB9,0xFD5CFD82,0xFD2EFD49,0xFD12FD25,0xFCEAFD05,0xFCD7FCE4,
-0xFCC9FCCE,0xFCBAFCC0,0xFCBBFCC4,0xFCB6FCBE,0xFCA2FCB6,0xFCA6FCAC,0xFCA3FCA5,0xFCACFCA0,
-0xFCBDFCA3,0xFCC1FCBF,0xFCCCFCBC,0xFCDAFCD4,0xFCF5FCEF,0xFD02FCFB,0xFD1DFD0D,0xFD35FD2B,
-0xFD46FD39,0xFD6BFD62,0xFD8CFD7A,0xFDA9FD98,0xFDD9FDC5,0xFE0AFDF3,0xFE44FE24,0xFE85FE5E,
-0xFECDFEB0,0xFF16FEEF,0xFF64FF41,0xFFB0FF87,0x0010FFDA,0x0062003B,0x00BD0090,0x011500F9,
-0x01520125,0x01A1016F,0x01CE01B5,0x021401EF,0x0255022B,0x028A026F,0x02C602AA,0x02F902D8,
-0x031E0316,0x0336032E,0x03490344,0x0364035E,0x03710364,0x0380037F,0x037E0385,0x036E037E,
-0x035F0356,0x033F0352,0x03070317,0x02C402E0,0x028802A2,0x0237025B,0x01DB0212,0x019301BA,
-0x013B0171,0x00F70115,0x009400BA,0x0049006A,0x0002002F,0xFFBDFFE5,0xFF8EFFA3,0xFF48FF69,
-0xFF10FF2F,0xFED9FEF7,0xFEB2FEC6,0xFE88FE9F,0xFE83FE84,0xFE5EFE77,0xFE49FE51,0xFE42FE41,
-0xFE34FE35,0xFE2BFE32,0xFE2AFE29,0xFE16FE18,0xFE16FE1D,0xFE11FE15,0xFE05FE12,0xFE05FE00,
-0xFDECFDF7,0xFDEDFDEF,0xFDEDFDEE,0xFDEEFDE5,0xFDEBFDEC,0xFDE0FDE6,0xFDF8FDF2,0xFE02FDFD,
-0xFE09FE04,0xFE19FE16,0xFE19FE1D,0xFE27FE22,0xFE36FE2B,0xFE50FE3D,0xFE52FE49,0xFE5DFE4B,
-0xFE73FE6B,0xFE72FE6C,0xFE7BFE76,0xFE8BFE81,0xFE95FE83,0xFE9EFE96,0xFEABFEA0,0xFED5FEC9,
-0xFEE8FEDD,0xFF12FF0B,0xFF41FF29,0xFF7CFF63,0xFFA0FF87,0xFFE6FFCA,0x00250006,0x0058003B,
-0x00A8008C,0x00F400CF,0x01350120,0x017E015F,0x01CF01B1,0x021301F3,0x02630234,0x02940279,
-0x02B702AE,0x02E502D3,0x030202F7,0x03100308,0x030E0306,0x02F002FA,0x02D802DE,0x02B402C6,
-0x0280029F,0x024A025F,0x020A0234,0x01C001EF,0x018B01A8,0x01430170,0x00FB011E,0x00B500D6,
-0x006E009B,0x001C003D,0xFFF8FFFF,0xFFBFFFD8,0xFF87FFA6,0xFF6AFF7C,0xFF4FFF5E,0xFF35FF3F,
-0xFF36FF44,0xFF2DFF35,0xFF42FF37,0xFF5DFF48,0xFF96FF76,0xFFB8FFA2,0x0006FFE0,0x005B003B,
-0x00AA008A,0x010F00DC,0x01570134,0x01B10186,0x021A01EA,0x02630238,0x02AE0288,0x02E802CD,
-0x03200306,0x034A0337,0x036A035A,0x036B0373,0x03600365,0x0349034D,0x0339033F,0x03030320,
-0x02D302E6,0x02A202B8,0x02620281,0x021E023F,0x01D001F0,0x018F01A9,0x014E0173,0x01240132,
-0x00EF0114,0x00D700EB,0x00CE00D8,0x00AA00B3,0x009F00A3,0x007E0090,0x00670078,0x00490057,
-0x0039003C,0x00260030,0xFFFD0015,0xFFE6FFEF,0xFFC9FFD3,0xFFAFFFBE,0xFF88FF9C,0xFF68FF77,
-0xFF48FF58,0xFF29FF38,0xFF04FF1B,0xFEE7FEF4,0xFED4FEDF,0xFEBAFECE,0xFE9AFEA3,0xFE79FE8D,
-0xFE65FE72,0xFE41FE59,0xFE0EFE2A,0xFDE4FDF5,0xFDC9FDD9,0xFD86FDA9,0xFD51FD61,0xFD1FFD32,
-0xFCCEFCED,0xFC93FCAC,0xFC54FC7A,0xFC0FFC31,0xFBE8FBFA,0xFBC1FBD6,0xFBB7FBBB,0xFBA2FBA7,
-0xFB99FB9C,0xFB94FBA0,0xFB98FB98,0xFBB9FBAB,0xFBB9FBC0,0xFBD8FBC7,0xFBF1FBE1,0xFC10FBFD,
-0xFC3CFC2F,0xFC5CFC48,0xFC6DFC65,0xFC91FC7D,0xFCA1FC94,0xFCAEFCA5,0xFCBFFCB5,0xFCD3FCC2,
-0xFCD9FCDD,0xFCDBFCDD,0xFCFEFCE7,0xFD0FFD02,0xFD1BFD0E,0xFD43FD2B,0xFD52FD58,0xFD82FD6A,
-0xFDABFD95,0xFDEAFDC7,0xFE1EFDFF,0xFE6DFE36,0xFED0FE93,0xFF08FEF1,0xFF62FF2C,0xFFD2FF9E,
-0x0038FFFD,0x00820063,0x00F300B7,0x014E011F,0x01A90174,0x020B01DE,0x0267023D,0x02BA028A,
-0x030F02E2,0x0362033A,0x03A00385,0x03F703C2,0x04300413,0x047E0459,0x04C604A4,0x04F204EA,
-0x05300516,0x056A0556,0x059F0589,0x05D405B3,0x05F405E1,0x060D060D,0x063F0623,0x0657064A,
-0x064D0647,0x063A0645,0x06180623,0x05F00607,0x05B705D8,0x056E0594,0x052B0548,0x04D70500,
-0x047904A2,0x040E043D,0x03A203DD,0x03460373,0x02E5030F,0x026C02A2,0x01FA0229,0x017E01BB,
-0x01200153,0x00AF00EC,0x00480084,0xFFED001D,0xFFA1FFCC,0xFF4AFF6A,0xFEFAFF21,0xFEB3FECE,
-0xFE78FE95,0xFE3EFE53,0xFE0DFE29,0xFDDFFDF1,0xFDC0FDD1,0xFDB0FDB7,0xFDA9FDB3,0xFD9AFD9D,
-0xFDA9FD9D,0xFDAEFDA6,0xFDC4FDAE,0xFDE0FDD4,0xFDF8FDEF,0xFE19FE03,0xFE3BFE26,0xFE51FE44,
-0xFE53FE54,0xFE6DFE64,0xFE81FE67,0xFE7DFE79,0xFE70FE71,0xFE6BFE73,0xFE52FE65,0xFE41FE51,
-0xFE28FE34,0xFDFBFE11,0xFDECFDED,0xFDC5FDDD,0xFDB2FDB6,0xFDAFFDAC,0xFDA4FDA3,0xFDAFFDA6,
-0xFDBAFDAE,0xFDCEFDBE,0xFDE1FDD8,0xFE0AFDF3,0xFE4CFE29,0xFE80FE64,0xFECAFEAD,0xFF1DFEF3,
-0xFF7BFF4B,0xFFD2FFAA,0x0026FFFB,0x0087004F,0x00CA00B1,0x010700EA,0x013B0128,0x0172015B,
-0x0191017C,0x01AC01A0,0x01C701BB,0x01D601CB,0x01D001CF,0x01D301CC,0x01AF01C0,0x01A401A5,
-0x017E018A,0x0152016F,0x011C013D,0x00E40104,0x008800BB,0x00380069,0xFFE20001,0xFF7AFFA6,
-0xFF1AFF52,0xFEA2FEE4,0xFE3DFE74,0xFDD6FE13,0xFD80FDA8,0xFD36FD64,0xFCE1FD05,0xFC9DFCBE,
-0xFC53FC75,0xFC19FC28,0xFBEAFBF8,0xFBB7FBD4,0xFB9FFBB6,0xFB91FB96,0xFB92FB96,0xFB99FB98,
-0xFB9FFB96,0xFBC8FBB5,0xFBDFFBCD,0xFC0DFBF9,0xFC50FC3F,0xFC7AFC68,0xFCCCFCA5,0xFD1AFCF9,
-0xFD6BFD48,0xFDC8FD98,0xFE1BFDE1,0xFE72FE3D,0xFEB8FE8B,0xFF0DFEE0,0xFF73FF34,0xFFCDFF99,
-0x001EFFF0,0x00600036,0x00B90088,0x010600E0,0x0137011A,0x01840161,0x01DA01B4,0x022001FE,
-0x02610248,0x029B027F,0x02E702C9,0x03280318,0x0366034F,0x039F037D,0x03CB03AD,0x040C03E7,
-0x044B0420,0x0477045E,0x04B70494,0x04D704C2,0x050904F1,0x0534051C,0x0546053F,0x0546054A,
-0x054F0548,0x0562055E,0x05540550,0x05320537,0x05180527,0x04ED0506,0x04C604DB,0x048004A7,
-0x0447045A,0x03FB0421,0x03AD03D2,0x035A0384,0x030D0339,0x02B702E4,0x027002A8,0x021D0242,
-0x01CC01EF,0x016D0199,0x01230152,0x00DA00FF,0x009A00B5,0x00530077,0x001D0044,0xFFDE0002,
-0xFFBEFFD3,0xFF8FFFA9,0xFF7BFF86,0xFF54FF62,0xFF27FF41,0xFF0EFF20,0xFEF1FEFE,0xFED5FEE3,
-0xFEB2FEBD,0xFE91FEA1,0xFE6FFE83,0xFE4DFE58,0xFE30FE36,0xFE0FFE18,0xFDFBFE0A,0xFDEDFDE9,
-0xFDDEFDE2,0xFDD9FDDB,0xFDCDFDD1,0xFDDBFDD0,0xFDCDFDD1,0xFDBDFDC4,0xFDB2FDBA,0xFDC4FDBB,
-0xFDBEFDC1,0xFDD0FDCA,0xFDD0FDDF,0xFDEDFDE4,0xFDEAFDF2,0xFDFDFDF4,0xFE02FE06,0xFE09FE0B,
-0xFE1AFE0D,0xFE37FE29,0xFE3BFE31,0xFE50FE3C,0xFE73FE68,0xFE8DFE7E,0xFEAFFE9F,0xFED1FEC1,
-0xFEF4FED9,0xFF2EFF0E,0xFF55FF42,0xFFA5FF72,0xFFE5FFC0,0x00180003,0x0056002D,0x00A1007B,
-0x00D400C4,0x00FA00EA,0x012B0114,0x01340139,0x01430140,0x01560151,0x014C014D,0x01350136,
-0x01120127,0x00E70106,0x00AC00CE,0x0077009E,0x00450063,0x0007002D,0xFFCFFFEB,0xFF91FFB5,
-0xFF5AFF77,0xFF1CFF3A,0xFEDCFF00,0xFEA7FEB8,0xFE70FE8D,0xFE43FE51,0xFE23FE32,0xFE00FE09,
-0xFDF4FDFE,0xFDDDFDEA,0xFDD4FDD0,0xFDDFFDD6,0xFDE9FDDF,0xFDF4FDEA,0xFE0DFE03,0xFE2DFE19,
-0xFE54FE3C,0xFE82FE6B,0xFEB8FE98,0xFEE4FED2,0xFF0FFEF5,0xFF4DFF2C,0xFF85FF63,0xFFBDFF9A,
-0xFFEDFFC5,0x00270004,0x005D0049,0x00980072,0x00CC00AF,0x010300E6,0x01200117,0x013F012F,
-0x01770158,0x018E0177,0x01BB01A0,0x01D701CA,0x01F401EC,0x020A0200,0x02150209,0x0231021C,
-0x02290229,0x02210229,0x020E0213,0x01F50206,0x01EC01F9,0x01C501D2,0x019E01AE,0x0185018D,
-0x0154016F,0x011F0132,0x00F60111,0x00C800D9,0x00AB00BB,0x0093009C,0x008C0085,0x008C0080,
-0x00AE0098,0x00CA00B1,0x00F900DF,0x0125010C,0x01590144,0x0198017D,0x01DD01AE,0x023B0206,
-0x027F025B,0x02C302A2,0x02F702E3,0x0330030B,0x03570342,0x037F035E,0x03830382,0x037F0382,
-0x03710382,0x0353036C,0x03340344,0x02F10319,0x029D02CE,0x02530281,0x01F3021D,0x018201C1,
-0x01290152,0x00C700EC,0x0054008E,0xFFF1002C,0xFF90FFC8,0xFF3CFF63,0xFEDEFF04,0xFE79FEAB,
-0xFE32FE56,0xFDD4FDFC,0xFD89FDB2,0xFD44FD6F,0xFD1CFD27,0xFCE1FD03,0xFCB6FCCA,0xFC80FC99,
-0xFC4FFC6C,0xFC32FC47,0xFC1FFC33,0xFBFEFC06,0xFC0FFC0A,0xFC0FFC0C,0xFC29FC18,0xFC3CFC35,
-0xFC61FC4C,0xFC94FC81,0xFCB9FC95,0xFCDEFCD0,0xFD18FCF6,0xFD57FD41,0xFD86FD64,0xFDB3FDA0,
-0xFDDAFDCF,0xFE0EFDF5,0xFE24FE0F,0xFE3CFE30,0xFE53FE4F,0xFE42FE4B,0xFE57FE5B,0xFE55FE56,
-0xFE5DFE5C,0xFE5AFE50,0xFE4DFE47,0xFE40FE3C,0xFE37FE35,0xFE2CFE3C,0xFE34FE30,0xFE52FE41,
-0xFE61FE5B,0xFE7AFE63,0xFEA2FE99,0xFEDFFEBC,0xFF0AFEF5,0xFF40FF24,0xFF75FF4E,0xFFA3FF80,
-0xFFC8FFB9,0x000EFFE7,0x00390031,0x007B0059,0x009F008C,0x00CB00B6,0x00FE00E4,0x01310113,
-0x014E0146,0x017A0164,0x01A9018F,0x01BC01BB,0x01DE01D7,0x020901F3,0x0229021D,0x023B022D,
-0x023F023E,0x02500250,0x0252024F,0x0256024B,0x024E025C,0x02440249,0x02390245,0x02260233,
-0x0211021E,0x02080218,0x01ED01F6,0x01DC01E4,0x01C201C3,0x01AE01BB,0x01AE01AC,0x01A001A5,
-0x019A019C,0x01970199,0x01940190,0x018D0196,0x017A018A,0x017A017A,0x01710175,0x015D016B,
-0x01510154,0x0134014D,0x00FF010F,0x00C600E4,0x0090009F,0x004A0063,0xFFFB0024,0xFF9DFFC7,
-0xFF4FFF72,0xFEF8FF20,0xFEA2FED1,0xFE4FFE7C,0xFDFDFE1A,0xFDAFFDD4,0xFD65FD83,0xFD1FFD3C,
-0xFCD2FCF0,0xFCAAFCBF,0xFC88FC99,0xFC8AFC8B,0xFC7BFC8F,0xFC80FC86,0xFC7AFC78,0xFC98FC87,
-0xFCA2FCA2,0xFCC3FCB4,0xFCF2FCD0,0xFD24FD08,0xFD65FD37,0xFD93FD6E,0xFDDCFDB6,0xFE15FDFC,
-0xFE5FFE36,0xFEA8FE88,0xFEEDFEC2,0xFF2EFF05,0xFF8BFF5A,0xFFDAFFAB,0x0014FFF6,0x00520030,
-0x008F0074,0x00D900B1,0x010400ED,0x013C011F,0x0157014C,0x0177016E,0x01980190,0x01A701A3,
-0x01AB01AD,0x01A301AC,0x0198019D,0x017F0192,0x015A016E,0x01310142,0x010F011E,0x00FD00FF,
-0x00D600EE,0x00A700C5,0x009E009F,0x008E0097,0x007B007C,0x007A0074,0x00880071,0x0097008D,
-0x00B800A4,0x00DD00C6,0x010000F5,0x012A011D,0x0151013F,0x018D0174,0x01AA0195,0x01D301C1,
-0x01E501DA,0x020E01F9,0x02160208,0x022F022E,0x02290236,0x022C0230,0x021F0226,0x02040207,
-0x01EC01F7,0x01C801DB,0x019F01B3,0x019301A6,0x01570175,0x01290139,0x00DE0111,0x00A700CF,
-0x00550085,0x00370046,0xFFF70013,0xFFC2FFE3,0xFF91FFB6,0xFF6FFF7B,0xFF2FFF50,0xFF12FF23,
-0xFEECFF10,0xFED3FEDD,0xFEBAFEC1,0xFEAAFEAE,0xFEA3FEA9,0xFEB3FEA8,0xFED9FECC,0xFEDEFEDA,
-0xFF0DFEEC,0xFF2BFF19,0xFF4EFF32,0xFF6FFF5A,0xFF8DFF7D,0xFFA3FF8D,0xFFC4FFB2,0xFFECFFDC,
-0xFFFBFFF3,0x001D0013,0x002F002D,0x00210028,0x002C0017,0x0033002B,0x00320037,0x00200032,
-0x0018001D,0x0023001F,0x00080013,0xFFFBFFF4,0xFFFEFFF9,0xFFF9FFFB,0xFFF1FFEB,0xFFF2FFF0,
-0xFFEFFFF1,0xFFF8FFF5,0xFFFDFFFF,0x00020000,0x00090007,0x00140018,0x0015001F,0x00090018,
-0x00220017,0x001E002A,0x0026001E,0x00350031,0x00400039,0x0049004B,0x005B005C,0x00630059,
-0x007A006C,0x009A0082,0x00B300A8,0x00CA00B1,0x00F700D7,0x011A00FF,0x01340126,0x014F0147,
-0x01820171,0x01910185,0x01B901A5,0x01D101C3,0x01E501D0,0x01F501F4,0x020D0205,0x01FE0203,
-0x01FD0202,0x01E501F1,0x01DB01E5,0x01BF01D0,0x01AA01B0,0x01860198,0x016D016D,0x01540161,
-0x01350147,0x01150118,0x0104010C,0x00E600F3,0x00E000E5,0x00CB00D9,0x00B400BF,0x00AB00A8,
-0x00A800AA,0x0093009C,0x00890088,0x006E007C,0x0059005C,0x00370049,0x0015001F,0x0004000C,
-0xFFEAFFF6,0xFFD1FFE2,0xFFB2FFBF,0xFF97FFAA,0xFF7AFF80,0xFF60FF69,0xFF39FF51,0xFF25FF2D,
-0xFF04FF18,0xFEF5FEFE,0xFEDDFEE3,0xFECAFED6,0xFEB1FEBE,0xFEA7FEA1,0xFE9FFE98,0xFE87FE96,
-0xFE71FE80,0xFE6FFE6B,0xFE77FE76,0xFE7AFE80,0xFEA3FE8B,0xFEA7FEA4,0xFECDFEBD,0xFEEFFEE3,
-0xFF0AFF01,0xFF40FF26,0xFF71FF55,0xFF99FF85,0xFFBCFF9B,0xFFF3FFD3,0x002C0007,0x005A0048,
-0x00870070,0x00BB009E,0x00F800E2,0x011A0107,0x014B0135,0x01820163,0x01B1019A,0x01DA01C6,
-0x020101E5,0x020D020E,0x020C0203,0x02130209,0x0203020D,0x01E701F4,0x01CB01E0,0x019C01B9,
-0x0172018F,0x014E0161,0x01120133,0x00CA00E7,0x008100A7,0x001A0051,0xFFBBFFF5,0xFF60FF81,
-0xFF04FF34,0xFE96FEC8,0xFE33FE60,0xFDD3FDFA,0xFD5CFDA3,0xFCEEFD36,0xFC87FCAE,0xFC39FC58,
-0xFBEFFC06,0xFBADFBD0,0xFB7BFB95,0xFB4DFB60,0xFB2EFB39,0xFB1EFB1F,0xFB14FB1C,0xFB24FB26,
-0xFB36FB34,0xFB5AFB53,0xFB73FB6C,0xFBB1FB93,0xFBEDFBD0,0xFC24FC06,0xFC4FFC3E,0xFC85FC6F,
-0xFCBDFCA8,0xFCECFCD7,0xFD0BFCFB,0xFD38FD2B,0xFD57FD49,0xFD75FD5A,0xFD7AFD77,0xFD92FD8C,
-0xFD92FD8C,0xFDA6FD9F,0xFDB0FDAB,0xFDBCFDB5,0xFDDCFDD2,0xFDF6FDE8,0xFE27FE12,0xFE5CFE53,
-0xFE9CFE79,0xFEECFEC3,0xFF40FF19,0xFFA9FF75,0x0005FFD2,0x007A0036,0x00F900BF,0x016C0138,
-0x01F101A7,0x02690231,0x02ED02A9,0x036E0335,0x03E403AB,0x04680432,0x04EA04B0,0x05520528,
-0x05BF0588,0x061F05F0,0x067F0653,0x06D606AA,0x070706EE,0x07360728,0x074A0740,0x07520750,
-0x074F074D,0x0736073E,0x07030721,0x06BE06E6,0x068906A8,0x06290657,0x05B505EA,0x05530579,
-0x04C90504,0x04380470,0x03B703F2,0x031B0367,0x029602D5,0x021B0266,0x018001CD,0x00FD0132,
-0x008B00C4,0x00160043,0xFFA3FFDA,0xFF32FF74,0xFED0FF02,0xFE88FEAE,0xFE1BFE59,0xFDD5FDF8,
-0xFD9FFDB9,0xFD48FD71,0xFD0FFD29,0xFCDAFCF1,0xFCB7FCC6,0xFC94FC93,0xFC86FC8E,0xFC75FC73,
-0xFC73FC79,0xFC77FC7C,0xFC83FC82,0xFC97FC86,0xFC98FC9A,0xFCA8FC9D,0xFCBEFCB6,0xFCD3FCCA,
-0xFCE7FCDD,0xFCF4FD02,0xFD03FCFA,0xFD28FD1A,0xFD31FD28,0xFD45FD3D,0xFD4CFD40,0xFD61FD58,
-0xFD7AFD6A,0xFD8EFD85,0xFDB0FDA1,0xFDCFFDCC,0xFDF9FDDA,0xFE24FE0E,0xFE4EFE39,0xFE7CFE5D,
-0xFEA9FE96,0xFEF4FECB,0xFF34FF17,0xFF83FF5C,0xFFC6FFA4,0x0014FFEB,0x005E003A,0x00A9007A,
-0x00F100D2,0x013C0109,0x01700155,0x01AC018F,0x01D401B8,0x01EE01E7,0x020701FF,0x021D0217,
-0x021E0216,0x02010208,0x01E501F0,0x01C301CF,0x01AD01B8,0x0185019C,0x0151016F,0x012B013D,
-0x010C0115,0x00D800EC,0x00A500BE,0x006E008C,0x00500066,0x00180039,0xFFF10004,0xFFCEFFE2,
-0xFFA9FFC0,0xFF77FF8D,0xFF50FF61,0xFF23FF2F,0xFEE4FF01,0xFEB8FED0,0xFE88FEA4,0xFE5AFE6F,
-0xFE2FFE41,0xFE0DFE1E,0xFDDBFDFB,0xFDB3FDCB,0xFD9CFDAD,0xFD81FD90,0xFD72FD76,0xFD72FD6E,
-0xFD64FD66,0xFD88FD6C,0xFD93FD8D,0xFDAFFDA4,0xFDC2FDBC,0xFDE8FDDA,0xFDFDFDFB,0xFE25FE1A,
-0xFE47FE3F,0xFE55FE50,0xFE7FFE6E,0xFE97FE7F,0xFEA9FEA3,0xFEBEFEB1,0xFEC7FEC5,0xFEE6FEDD,
-0xFEFDFEF6,0xFF18FF0E,0xFF48FF22,0xFF6FFF55,0xFF97FF7D,0xFFCDFFAE,0x000CFFE7,0x0045002A,
-0x00890060,0x00D200AE,0x010F00F7,0x015A0135,0x01A30182,0x01F601CA,0x0240020F,0x02990269,
-0x02EE02BF,0x0343031E,0x038D0364,0x03EA03BA,0x043B040C,0x04890465,0x04E004B5,0x05340512,
-0x056A0550,0x05A00588,0x05D105BB,0x05FF05EB,0x0619060D,0x06320634,0x06450637,0x06370637,
-0x0628063C,0x06070622,0x05D505F2,0x059205BA,0x05420577,0x04E70515,0x049204BF,0x0426045F,
-0x03BB03EC,0x03470381,0x02D7030F,0x026F02A3,0x01FA0233,0x018A01BF,0x011F015D,0x00BC00EF,
-0x0071008E,0x00310046,0xFFE10005,0xFFA4FFC1,0xFF67FF80,0xFF37FF44,0xFEEDFF11,0xFEB5FED2,
-0xFE85FE96,0xFE53FE6E,0xFE24FE38,0xFDF0FE06,0xFDBAFDCE,0xFD89FDA8,0xFD67FD81,0xFD1DFD3C,
-0xFCECFD01,0xFCAFFCD7,0xFC78FC8F,0xFC45FC63,0xFC17FC2A,0xFBF3FC01,0xFBAEFBCF,0xFB98FBA8,
-0xFB75FB89,0xFB66FB73,0xFB62FB5E,0xFB5BFB59,0xFB49FB4C,0xFB48FB4A,0xFB3DFB4E,0xFB59FB4E,
-0xFB4FFB55,0xFB53FB54,0xFB4DFB53,0xFB4EFB51,0xFB5FFB60,0xFB62FB63,0xFB73FB71,0xFB93FB80,
-0xFBB9FBA2,0xFBD6FBC1,0xFC02FBEC,0xFC51FC23,0xFC96FC75,0xFCFFFCD2,0xFD5EFD2F,0xFDE1FD9C,
-0xFE56FE21,0xFED9FE94,0xFF61FF1D,0xFFEAFFA7,0x007C002E,0x00FA00B5,0x016B0138,0x01E901A2,
-0x0252021E,0x02B00281,0x030E02E0,0x0360033F,0x03AB038A,0x03D303BD,0x03F603E1,0x040D0404,
-0x04160417,0x040E0411,0x040A041C,0x03F10400,0x03DF03DB,0x03B803CC,0x037B039D,0x0347036A,
-0x0301031F,0x02BE02EC,0x028A02AB,0x024E0270,0x02150234,0x01C801FA,0x019701AC,0x015E017D,
-0x01220138,0x00E20107,0x00A500C1,0x0071008D,0x00310055,0x000A0020,0xFFE1FFF1,0xFFAFFFC7,
-0xFF76FF94,0xFF47FF69,0xFF14FF38,0xFEE5FEFD,0xFEB0FECF,0xFE83FE99,0xFE59FE71,0xFE37FE4A,
-0xFE10FE2B,0xFDDEFDFA,0xFDB3FDCE,0xFD92FD97,0xFD75FD83,0xFD5EFD60,0xFD74FD68,0xFD6BFD6C,
-0xFD6EFD65,0xFD7AFD77,0xFD8BFD85,0xFDB0FD9A,0xFDE6FDD1,0xFE11FDFB,0xFE37FE17,0xFE81FE5A,
-0xFEB9FE9A,0xFEFAFEE2,0xFF48FF23,0xFF8CFF79,0xFFC7FFAC,0x0012FFEB,0x00590038,0x009C007B,
-0x00CF00AE,0x011100F5,0x01520132,0x017F0161,0x01B50191,0x01E301D0,0x02090200,0x02210215,
-0x02530232,0x026D0264,0x02A40293,0x02CD02B5,0x02EE02E0,0x03150306,0x03360325,0x03540348,
-0x0366035D,0x03740372,0x03740373,0x03740380,0x036E0376,0x03610366,0x03410358,0x03240338,
-0x02F20303,0x02D402E2,0x029002B6,0x02580270,0x0226024A,0x01F40213,0x01C601DF,0x019601AD,
-0x016B017C,0x013D0154,0x01240131,0x01040118,0x00CF00E7,0x00AD00C4,0x007B0099,0x00690073,
-0x0037005A,0xFFFE001C,0xFFCAFFE0,0xFF7DFFAA,0xFF2DFF55,0xFEE1FF00,0xFE82FEB0,0xFE16FE59,
-0xFDB2FDE3,0xFD4DFD83,0xFCEAFD1F,0xFC8FFCC4,0xFC37FC66,0xFBE2FC09,0xFBA4FBB8,0xFB77FB87,
-0xFB3DFB60,0xFB23FB26,0xFB23FB1E,0xFB1EFB1D,0xFB2AFB0F,0xFB34FB30,0xFB5AFB4E,0xFB8BFB6F,
-0xFBB5FB98,0xFBF6FBCD,0xFC29FC07,0xFC77FC50,0xFCBBFC97,0xFD08FCE4,0xFD5CFD2D,0xFDB1FD8B,
-0xFDFEFDDE,0xFE5DFE38,0xFEBDFE91,0xFF0EFEDE,0xFF7EFF41,0xFFDBFFA8,0x00520012,0x00C1008C,
-0x013100FA,0x01A3016C,0x022601E9,0x02950266,0x030302CB,0x036D0339,0x03D5039D,0x043B0402,
-0x04850464,0x04C004B1,0x04E704D0,0x05190509,0x052C0521,0x05170531,0x05040515,0x04E404FA,
-0x04A604C4,0x044B046B,0x03FE0420,0x03A303C8,0x0334035D,0x02BE02ED,0x0251028C,0x01D4021A,
-0x017D01B0,0x0128014B,0x00C300F5,0x0083009D,0x001D0055,0xFFDEFFF4,0xFF9DFFB9,0xFF6EFF90,
-0xFF38FF55,0xFF18FF24,0xFEF2FF07,0xFEEEFEF3,0xFEDEFEED,0xFED0FEDD,0xFEC0FECB,0xFEBCFEBE,
-0xFEA9FEB8,0xFE9CFE93,0xFE8EFE95,0xFE7DFE8A,0xFE5BFE6C,0xFE47FE51,0xFE3FFE3D,0xFE19FE24,
-0xFDFDFE0D,0xFDD8FDEC,0xFDAEFDC5,0xFD96FD98,0xFD62FD7D,0xFD48FD5A,0xFD36FD47,0xFD09FD23,
-0xFCF4FCFD,0xFCCEFCE2,0xFCD4FCD1,0xFCB3FCC4,0xFCAEFCB3,0xFCB7FCAF,0xFCC8FCC3,0xFCEBFCD1,
-0xFD0BFCFA,0xFD31FD15,0xFD67FD4A,0xFD95FD7E,0xFDD0FDB1,0xFE07FDE4,0xFE56FE32,0xFE92FE71,
-0xFED5FEAC,0xFF0CFEE9,0xFF56FF3B,0xFF93FF76,0xFFCEFFB1,0x0016FFF8,0x0047002B,0x00910074,
-0x00D800AD,0x012200F7,0x016A014D,0x01AE0184,0x01EF01D5,0x0215020E,0x0254023B,0x02670265,
-0x027D0274,0x02930293,0x029A02A7,0x028C0295,0x026B0283,0x0244025E,0x0225023E,0x01D901FB,
-0x019D01B9,0x015D0178,0x011A0138,0x00D400F5,0x009900B7,0x004E007A,0x0013003A,0xFFDAFFF1,
-0xFFAFFFC8,0xFF89FF9E,0xFF70FF82,0xFF5DFF67,0xFF47FF4E,0xFF4BFF49,0xFF4EFF41,0xFF47FF4B,
-0xFF51FF52,0xFF62FF59,0xFF64FF62,0xFF75FF72,0xFF98FF8C,0xFFA7FF99,0xFFC7FFB0,0xFFECFFCF,
-0x0005FFF2,0x0010FFFA,0x00310020,0x004C0038,0x0060004D,0x00630059,0x00750071,0x0077007E,
-0x00930089,0x009E0095,0x00A500A2,0x00A400AD,0x009A009E,0x009E0094,0x009B00A2,0x00A0009F,
-0x00970096,0x00A10095,0x00AA00A2,0x00B600AA,0x00BB00B6,0x00CA00CB,0x00DA00E0,0x00FC00F1,
-0x010600FA,0x01150119,0x012E012D,0x013A012E,0x0151014E,0x01500155,0x01570163,0x015F015F,
-0x0161015D,0x01630168,0x01550160,0x01400145,0x012E013A,0x01100122,0x00E900FF,0x00B300CD,
-0x009500A6,0x00630073,0x0034004C,0xFFF60017,0xFFCAFFE8,0xFF9CFFB8,0xFF62FF85,0xFF3DFF57,
-0xFF16FF2A,0xFF12FF10,0xFEFCFF07,0xFEE9FEF6,0xFEF0FEE0,0xFF06FEF9,0xFF2BFF17,0xFF46FF34,
-0xFF5BFF4A,0xFF7CFF6E,0xFF9BFF87,0xFFB3FFA7,0xFFD6FFBE,0xFFE7FFDC,0x0003FFFA,0x00210016,
-0x0034002E,0x00380030,0x0031002D,0x00290037,0x0024002A,0x00150020,0xFFFE0004,0xFFF30001,
-0xFFDCFFEA,0xFFBAFFCD,0xFFB7FFBD,0xFFA6FFAE,0xFF87FF93,0xFF66FF6E,0xFF47FF56,0xFF1FFF3C,
-0xFF11FF18,0xFF02FF09,0xFEE1FEF5,0xFEC4FED1,0xFEB6FEB4,0xFEA0FEAE,0xFE80FE8F,0xFE76FE84,
-0xFE6DFE70,0xFE7AFE73,0xFE81FE75,0xFEA8FE91,0xFEC1FEB3,0xFEF6FED7,0xFF29FF0B,0xFF62FF4B,
-0xFFB5FF8B,0x0007FFDF,0x00590034,0x00B30087,0x010000D6,0x01590130,0x01B1018B,0x020401DE,
-0x02440229,0x028D0269,0x02C602AE,0x02F902E0,0x031B0307,0x03460330,0x034B034B,0x03490342,
-0x034B034F,0x03430347,0x03240335,0x030B0314,0x02DF02F0,0x02B202C6,0x0286029D,0x02510267,
-0x02100237,0x01D901F3,0x01AB01C7,0x01750195,0x012D0154,0x0106011F,0x00E400F5,0x00AF00CD,
-0x008E00A9,0x0070007C,0x0068006B,0x00530054,0x004E0044,0x00400049,0x00420035,0x004B0043,
-0x0052004C,0x005D0056,0x0063005E,0x00770077,0x00810086,0x0079008A,0x0079007A,0x007F0084,
-0x0065006D,0x004A0051,0x002A003A,0x00000027,0xFFE0FFEC,0xFFAEFFCA,0xFF83FF93,0xFF45FF66,
-0xFF06FF23,0xFECDFEE5,0xFE96FEAB,0xFE65FE6C,0xFE32FE49,0xFE06FE0F,0xFDDFFDF7,0xFDBBFDC9,
-0xFD7EFDA7,0xFD5CFD73,0xFD44FD46,0xFD20FD26,0xFD03FD0A,0xFCECFD01,0xFCCCFCDF,0xFCBBFCB7,
-0xFC9AFCAC,0xFC8AFC90,0xFC85FC82,0xFC7DFC78,0xFC64FC6D,0xFC73FC6C,0xFC74FC70,0xFC8DFC79,
-0xFC9EFC9E,0xFCBEFCB1,0xFD00FCDE,0xFD3CFD1A,0xFD7BFD5A,0xFDDAFDA3,0xFE1CFDF0,0xFE74FE45,
-0xFED8FEA2,0xFF29FF06,0xFF9CFF6B,0xFFE3FFBE,0x0022FFFA,0x004E003A,0x008B006B,0x00B500A3,
-0x00D200CB,0x00DD00DC,0x00ED00EC,0x00E900E7,0x00D300DC,0x00C100D6,0x00A400AD,0x00810096,
-0x00660072,0x0055005A,0x00380046,0x001E002F,0x0014001B,0x001C001B,0x00060018,0x0006000A,
-0x00110012,0x001F001B,0x00320028,0x00400049,0x0059004D,0x0070005F,0x00960080,0x00A6009D,
-0x00AF00AB,0x00CB00BE,0x00D700D3,0x00E800DF,0x00F900E5,0x010900F6,0x01120111,0x0123011F,
-0x012F012A,0x013E0136,0x0147014A,0x0150014E,0x0162015E,0x01700164,0x0179017E,0x01720176,
-0x0179017A,0x01700179,0x01760171,0x015C016D,0x01450154,0x01400153,0x013E013F,0x01320135,
-0x012D0125,0x010F0118,0x010A010E,0x0116010C,0x010E010E,0x010F0111,0x01130113,0x0118011F,
-0x012F0124,0x013F013A,0x0159014C,0x0180016E,0x0198018A,0x01C201AF,0x01E001C8,0x020601EA,
-0x020D020A,0x0231021C,0x0239022B,0x02540245,0x02580252,0x0247024E,0x02470245,0x021E0238,
-0x01F5020D,0x01CB01E3,0x01AE01B5,0x01660187,0x012C0145,0x00E300FE,0x009F00C7,0x0051006E,
-0x0003002B,0xFFB2FFD6,0xFF6BFF8E,0xFF14FF36,0xFECBFEF1,0xFE8AFEAE,0xFE4DFE73,0xFE07FE2D,
-0xFDD9FDF0,0xFD9EFDBC,0xFD80FD8A,0xFD53FD69,0xFD36FD49,0xFD28FD26,0xFD29FD2E,0xFD31FD2C,
-0xFD3DFD3B,0xFD40FD3B,0xFD51FD48,0xFD6CFD68,0xFD79FD73,0xFD88FD81,0xFD9DFD92,0xFDBFFDB0,
-0xFDB1FDC0,0xFDB8FDAD,0xFDAFFDAD,0xFDA9FDAB,0xFD88FD97,0xFD64FD81,0xFD3EFD52,0xFD08FD32,
-0xFCDEFCEF,0xFCB8FCC7,0xFC77FC96,0xFC4EFC63,0xFC18FC36,0xFBFBFC04,0xFBD0FBE2,0xFBC4FBBF,
-0xFBD1FBC4,0xFBD2FBD7,0xFBEAFBE1,0xFC04FBF6,0xFC2AFC11,0xFC79FC52,0xFCAFFC8F,0xFCFCFCD0,
-0xFD45FD1D,0xFD89FD6B,0xFDF7FDC2,0xFE61FE40,0xFEC5FE91,0xFF30FEF7,0xFF9AFF68,0x0007FFCC,
-0x00640034,0x00C6009A,0x012D00F7,0x0193015B,0x01ED01BB,0x02400219,0x028D0269,0x02E602BB,
-0x032D030D,0x03610349,0x03940379,0x03C203AD,0x03D703D4,0x03E203E3,0x040603EE,0x040B040C,
-0x0418040D,0x040A0406,0x03EC03FD,0x03CD03EA,0x03B103C1,0x039203A4,0x03630370,0x03330350,
-0x03130329,0x02FB030C,0x02C402D7,0x029C02AF,0x026C0285,0x02500265,0x023D0244,0x021E0224,
-0x020B0210,0x01FC0204,0x01FF01FF,0x01F60200,0x01FC01F7,0x021C0212,0x02070216,0x0224020D,
-0x02380224,0x0245023C,0x023D0239,0x02580243,0x025D0254,0x02640252,0x026C0268,0x02670274,
-0x025A025C,0x02600264,0x024E0259,0x024E0247,0x02370248,0x021F0223,0x01FC0210,0x01D601E4,
-0x01AF01CD,0x019201A6,0x0160017C,0x013E0150,0x010A0126,0x00E700FC,0x00CE00D9,0x009800B4,
-0x00710084,0x00500062,0x00260047,0x00030011,0xFFFC0006,0xFFDAFFF4,0xFFD8FFD0,0xFFB4FFD0,
-0xFFA8FFA7,0xFF95FF96,0xFF81FF80,0xFF72FF76,0xFF5DFF60,0xFF3FFF4A,0xFF2EFF35,0xFF24FF24,
-0xFEFEFF12,0xFECFFEEE,0xFEA6FEB4,0xFE7CFE89,0xFE60FE72,0xFE2BFE44,0xFDFEFE10,0xFDF0FDFB,
-0xFDE7FDEF,0xFDCAFDD7,0xFDD0FDC7,0xFDCEFDCB,0xFDD3FDC9,0xFDD2FDC9,0xFDE6FDDE,0xFDF6FDF5,
-0xFE0FFE07,0xFE20FE18,0xFE35FE31,0xFE42FE37,0xFE52FE49,0xFE55FE52,0xFE55FE54,0xFE4EFE55,
-0xFE43FE3C,0xFE46FE3C,0xFE39FE3B,0xFE30FE39,0xFE27FE29,0xFE2AFE28,0xFE28FE2D,0xFE2EFE2C,
-0xFE2BFE2B,0xFE34FE34,0xFE3DFE33,0xFE4AFE46,0xFE6BFE5D,0xFE86FE7A,0xFEB6FEA1,0xFECDFEC7,
-0xFEE3FEDE,0xFF10FF02,0xFF41FF2C,0xFF57FF4A,0xFF79FF65,0xFFA1FF95,0xFFACFFAA,0xFFC7FFBD,
-0xFFD7FFD9,0xFFDBFFDC,0xFFE9FFE1,0xFFE4FFE2,0xFFDFFFDA,0xFFD7FFDC,0xFFDDFFD7,0xFFD2FFD6,
-0xFFD3FFD8,0xFFC2FFD3,0xFFC4FFC3,0xFFC3FFC2,0xFFB2FFB8,0xFFA9FFA5,0xFFA0FF9E,0xFFA2FFA4,
-0xFFA6FFAA,0xFFADFFAF,0xFFB9FFB2,0xFFCBFFCA,0xFFD7FFD0,0xFFDAFFD7,0xFFF2FFDC,0xFFEFFFE5,
-0xFFEEFFF4,0xFFE9FFEE,0x0004FFEF,0xFFE6FFFC,0xFFC8FFD9,0xFFCAFFD2,0xFFB3FFC1,0xFF8FFFA3,
-0xFF77FF8A,0xFF5DFF69,0xFF34FF43,0xFF23FF2F,0xFF0FFF15,0xFF01FF01,0xFEEBFEF1,0xFED9FEDD,
-0xFED6FEDF,0xFEDFFEDA,0xFEDFFEE3,0xFEF2FEF7,0xFF0FFF02,0xFF43FF2D,0xFF7CFF5A,0xFFA7FF99,
-0xFFD8FFBC,0x0024FFF9,0x006C003E,0x00B2008D,0x011B00DD,0x01710148,0x01D6019B,0x02340211,
-0x02900260,0x02EC02C9,0x033C031B,0x037D035C,0x03C703AE,0x040403DC,0x0420040C,0x0455043B,
-0x047A0462,0x04920489,0x04A20496,0x0495049A,0x048D0487,0x047E048D,0x046C046F,0x044A0459,
-0x04270440,0x04020412,0x03D103EC,0x038603B1,0x03430360,0x02FA031B,0x02A802D1,0x024B0279,
-0x01E70214,0x018301BB,0x0114014B,0x009F00D5,0x002A005B,0xFFB7FFF2,0xFF46FF86,0xFEDCFF1E,
-0xFE79FEAD,0xFE1BFE4A,0xFDD7FDF7,0xFD9CFDC0,0xFD6FFD8A,0xFD3FFD52,0xFD22FD38,0xFD1AFD1E,
-0xFD1DFD13,0xFD21FD22,0xFD28FD22,0xFD43FD2E,0xFD4FFD49,0xFD5BFD50,0xFD5FFD63,0xFD50FD5C,
-0xFD4CFD51,0xFD2DFD3A,0xFD16FD29,0xFCF5FD07,0xFCCFFCEA,0xFCBEFCCC,0xFC96FCAB,0xFC88FC7F,
-0xFC61FC77,0xFC4EFC5E,0xFC3DFC51,0xFC2CFC34,0xFC30FC34,0xFC3FFC3B,0xFC4DFC3B,0xFC62FC4D,
-0xFC80FC6E,0xFCAEFC90,0xFCDFFCC8,0xFD03FCF0,0xFD3AFD2A,0xFD7EFD5D,0xFDBBFD9E,0xFE10FDE2,
-0xFE5FFE3A,0xFE96FE7F,0xFEE6FEB8,0xFF38FF08,0xFF8BFF5D,0xFFC7FFA9,0x0001FFEC,0x0047002E,
-0x00880069,0x00C400A8,0x011300F1,0x013B0131,0x0178015A,0x01AA018B,0x01D001BA,0x01FF01E2,
-0x023C0224,0x026B024C,0x02940278,0x02BF02A5,0x02DA02D2,0x02F802EA,0x031E030E,0x03330326,
-0x033B0336,0x03400342,0x03460343,0x034A0345,0x03530349,0x033C033D,0x03320338,0x03220329,
-0x0309030A,0x02E202FD,0x02C302D7,0x029702B7,0x0273027B,0x0244025C,0x02070226,0x01E001FA,
-0x01A201BD,0x01670187,0x01390150,0x01050115,0x00D900EF,0x00A400B9,0x007E0094,0x0059006F,
-0x00370042,0x002C003B,0x0007001B,0xFFF2FFF8,0xFFE9FFF1,0xFFD3FFE3,0xFFC6FFCF,0xFFCEFFD0,
-0xFFCAFFC4,0xFFB2FFBC,0xFF98FFA9,0xFF90FF9A,0xFF72FF8A,0xFF67FF70,0xFF51FF5D,0xFF37FF35,
-0xFF1DFF2B,0xFF06FF11,0xFEF8FF07,0xFEE9FEF2,0xFEC2FED0,0xFEB0FEB4,0xFEA3FEAA,0xFE94FE9F,
-0xFE91FE99,0xFE9DFE94,0xFEA3FE99,0xFEC0FEB1,0xFED1FECD,0xFEF3FED8,0xFF11FF06,0xFF32FF1A,
-0xFF4FFF3B,0xFF76FF56,0xFF8BFF80,0xFFB6FFA0,0xFFD8FFC5,0xFFEAFFDE,0xFFF0FFE8,0xFFFBFFFE,
-0xFFFCFFF9,0x000A000D,0x00150001,0x000E0015,0x000F000F,0x00150016,0x00250022,0x0048003B,
-0x00530057,0x007A0068,0x00990085,0x00B000A5,0x00DB00BE,0x011400FC,0x013E0125,0x01680154,
-0x01890177,0x01AC01A0,0x01D001C5,0x01EA01DF,0x01FF01F7,0x02090206,0x020C020D,0x020D0211,
-0x02130215,0x0203020F,0x01E601F9,0x01C801D6,0x01A701B0,0x0178018A,0x014C015E,0x01270133,
-0x01040114,0x00CD00EC,0x00AD00BD,0x0087009B,0x0056006E,0x0027003D,0xFFDEFFFB,0xFFB0FFC7,
-0xFF81FF8C,0xFF4FFF66,0xFF06FF2A,0xFECFFEF2,0xFE92FEB8,0xFE4EFE6D,0xFE13FE32,0xFDD5FDF7,
-0xFD87FDB1,0xFD56FD71,0xFD21FD38,0xFCFAFD0E,0xFCCEFCE5,0xFCC6FCC9,0xFCB0FCC0,0xFCA6FCA7,
-0xFCA5FCA0,0xFC9CFCA1,0xFCA2FC9C,0xFCCDFCB5,0xFCF0FCE8,0xFD16FD05,0xFD49FD32,0xFD8BFD6A,
-0xFDC4FDA9,0xFDF5FDE1,0xFE3EFE14,0xFE84FE63,0xFED7FEA7,0xFF2AFF03,0xFF85FF53,0xFFC8FFAB,
-0x0018FFF6,0x006A004E,0x00B4008D,0x00F300D8,0x01350118,0x01700150,0x01B7018C,0x01E601CD,
-0x021701FB,0x02410228,0x02610255,0x026C0260,0x02810271,0x028A028F,0x02950293,0x0289028E,
-0x02740277,0x02630269,0x025E025B,0x02430256,0x02300238,0x0209021E,0x01F40203,0x01DF01EC,
-0x01CB01D7,0x01B501C4,0x01AA01AC,0x019901A1,0x01810186,0x0173017C,0x01500161,0x0125013B,
-0x00FB011D,0x00E000EE,0x00B300C9,0x00750088,0x00380051,0xFFE9000E,0xFFA0FFC7,0xFF53FF78,
-0xFEFEFF2E,0xFEC4FEE1,0xFE6BFE9C,0xFE2CFE44,0xFDF5FE1F,0xFDC4FDDB,0xFD88FDB2,0xFD50FD69,
-0xFD26FD3A,0xFCEBFD04,0xFCD0FCDD,0xFCA1FCBD,0xFC88FCA3,0xFC7CFC82,0xFC67FC6E,0xFC64FC5D,
-0xFC58FC5C,0xFC62FC5A,0xFC66FC6A,0xFC76FC68,0xFC7EFC75,0xFC95FC8A,0xFCB4FC9A,0xFCD7FCBC,
-0xFCFCFCE2,0xFD2DFD19,0xFD61FD47,0xFD9DFD79,0xFDE9FDB6,0xFE3DFE13,0xFE93FE60,0xFF0CFED4,
-0xFF6AFF38,0xFFE0FF95,0x005C0021,0x00D6009D,0x0167011D,0x01D801A2,0x024F021A,0x02EB0297,
-0x0350031C,0x03C70380,0x042B03FE,0x04920465,0x04EC04C0,0x052C050B,0x05600541,0x058B057B,
-0x05AE0597,0x05D005C6,0x05DE05D6,0x05DC05E4,0x05D505DB,0x05CF05CA,0x05B605C4,0x059C05A8,
-0x05680583,0x054A0551,0x0510052A,0x04DD04FC,0x04BC04C8,0x047E0499,0x044A0466,0x0412042B,
-0x03C903EC,0x037703A8,0x03330357,0x02E2031B,0x028302B1,0x02210257,0x019A01E0,0x01420176,
-0x00B200FD,0x0047007E,0xFFC40002,0xFF3DFF80,0xFEBAFEFB,0xFE40FE7D,0xFDC4FE0D,0xFD4FFD8D,
-0xFCDFFD18,0xFC70FCA7,0xFC0CFC3C,0xFB9DFBE0,0xFB41FB76,0xFB05FB2D,0xFACAFAE0,0xFA9AFAB1,
-0xFA8EFA94,0xFA6DFA78,0xFA75FA6E,0xFA86FA7D,0xFA89FA87,0xFAAAFA92,0xFAD7FABD,0xFAEFFAE8,
-0xFB32FB0C,0xFB5FFB4D,0xFB88FB70,0xFBB9FB9D,0xFBE2FBD2,0xFC0FFBFD,0xFC2EFC21,0xFC4EFC49,
-0xFC61FC52,0xFC7DFC69,0xFC98FC8A,0xFCC5FCA6,0xFCE3FCC3,0xFD02FCEB,0xFD34FD24,0xFD5BFD36,
-0xFD8DFD74,0xFDCDFDA5,0xFE0EFDF1,0xFE5EFE29,0xFEA1FE7E,0xFEF3FEC8,0xFF3FFF25,0xFF9BFF6B,
-0xFFEAFFBB,0x004E001D,0x00AD007C,0x011300DD,0x016F0140,0x01CA019E,0x022401FE,0x02850258,
-0x02CB02A6,0x031102EE,0x03410324,0x0396036F,0x03CC03BB,0x040703E6,0x043E042C,0x04730459,
-0x049D048F,0x04B704B2,0x04E104DB,0x04F004ED,0x050604FC,0x0510050B,0x04FA0506,0x04ED04F4,
-0x04CB04E3,0x04A404C2,0x0460048F,0x0418043D,0x03B603EC,0x034B0382,0x02E10315,0x026502A3,
-0x01DE021A,0x015D01A0,0x00E40120,0x005D00A8,0xFFDF0020,0xFF68FFAC,0xFEF8FF2C,0xFE94FEBE,
-0xFE36FE68,0xFDF0FE18,0xFDB8FDCD,0xFD9DFD9F,0xFD7EFD81,0xFD6FFD77,0xFD64FD62,0xFD7CFD75,
-0xFD97FD92,0xFDC0FDB4,0xFDEDFDE3,0xFE28FE0E,0xFE66FE51,0xFEAFFE87,0xFEEBFEC4,0xFF2BFF06,
-0xFF5FFF46,0xFF9EFF7E,0xFFD3FFB6,0xFFF9FFE1,0x00280019,0x0051004B,0x007F006B,0x00A40095,
-0x00C400B2,0x00E000C9,0x00F100E7,0x010000FD,0x00F800F1,0x010F0102,0x00F900FA,0x00EF00EC,
-0x00E700EC,0x00EA00E7,0x00CD00DB,0x00C200CB,0x00B500B8,0x00A0009E,0x00900099,0x0070007E,
-0x00630072,0x004A005D,0x0038004B,0x001C0031,0xFFFA0009,0xFFE2FFEC,0xFFCDFFD1,0xFFA0FFAA,
-0xFF87FF90,0xFF6BFF70,0xFF60FF66,0xFF53FF51,0xFF38FF49,0xFF37FF3E,0xFF36FF3B,0xFF20FF2D,
-0xFF24FF21,0xFF3DFF33,0xFF44FF44,0xFF51FF45,0xFF61FF4E,0xFF5BFF62,0xFF66FF66,0xFF74FF74,
-0xFF76FF6F,0xFF76FF73,0xFF7AFF79,0xFF66FF7D,0xFF5CFF54,0xFF3EFF4C,0xFF10FF33,0xFEE5FF07,
-0xFEB1FECB,0xFE67FE88,0xFE22FE49,0xFDEFFE14,0xFDA4FDC1,0xFD60FD7E,0xFD25FD3B,0xFCEAFD0C,
-0xFCC0FCCB,0xFC87FCA9,0xFC6CFC7D,0xFC4DFC60,0xFC4AFC49,0xFC47FC42,0xFC54FC46,0xFC69FC62,
-0xFC76FC6F,0xFC9DFC87,0xFCC8FCA8,0xFCEFFCD2,0xFD0DFCF8,0xFD31FD1B,0xFD6BFD4B,0xFDA1FD8C,
-0xFDCDFDB4,0xFE11FDE8,0xFE5EFE3C,0xFE92FE78,0xFED6FEB5,0xFF0EFEF8,0xFF58FF32,0xFFACFF8E,
-0xFFFAFFD3,0x003D001A,0x009D0066,0x00F200BC,0x014D011B,0x019E0171,0x01F201C7,0x02450217,
-0x02910268,0x02DE02BB,0x03250306,0x03730347,0x039D0385,0x03E303C1,0x041503F9,0x04380430,
-0x04510445,0x0464045E,0x0478046C,0x048D047E,0x049B0491,0x049D0497,0x049A0495,0x04930491,
-0x048C0498,0x046F047C,0x04580465,0x04490450,0x042A0433,0x04060419,0x03EF03FE,0x03C703E7,
-0x039603B7,0x036D038C,0x033D034F,0x0311032A,0x02D602F4,0x029902B3,0x02620284,0x0218023E,
-0x01D101F9,0x018F01B5,0x01430165,0x00F8011F,0x00BC00D8,0x0069008C,0x0023004D,0xFFDFFFFC,
-0xFFABFFCD,0xFF6BFF90,0xFF36FF4F,0xFEF9FF13,0xFEDDFEF1,0xFEAFFEC2,0xFE97FE9F,0xFE80FE86,
-0xFE6DFE75,0xFE67FE62,0xFE79FE6A,0xFE69FE67,0xFE6BFE68,0xFE72FE77,0xFE81FE76,0xFE89FE84,
-0xFE98FE92,0xFEC3FEAB,0xFECAFEC0,0xFEE8FEDA,0xFF02FEF5,0xFF1CFF0E,0xFF26FF2F,0xFF27FF1D,
-0xFF2CFF23,0xFF2CFF2C,0xFF1CFF22,0xFF09FF19,0xFEF3FF07,0xFEDDFEE8,0xFEC9FED1,0xFE99FEAF,
-0xFE6FFE87,0xFE5BFE71,0xFE3AFE4B,0xFE2CFE34,0xFE26FE25,0xFE22FE1F,0xFE33FE2D,0xFE42FE3C,
-0xFE68FE56,0xFE93FE7A,0xFED4FEB9,0xFF0FFEF2,0xFF59FF2E,0xFFA8FF7F,0xFFFCFFD3,0x00430027,
-0x00910074,0x00DB00B1,0x011000F8,0x014E0130,0x01840161,0x019B0191,0x01AA01A6,0x01B101AF,
-0x019D01A9,0x019601A5,0x01710182,0x01300150,0x00F8011C,0x00B000DF,0x0072009E,0x00260042,
-0xFFD90002,0xFF76FFAC,0xFF20FF56,0xFEC3FEF7,0xFE82FEA6,0xFE28FE53,0xFDD1FE01,0xFD8EFDA9,
-0xFD3DFD5F,0xFD0BFD22,0xFCCDFCEC,0xFCA8FCB3,0xFC6DFC90,0xFC50FC5F,0xFC27FC33,0xFC0BFC1B,
-0xFBE7FBFD,0xFBE2FBEC,0xFBDDFBE8,0xFBDFFBE7,0xFBE1FBD7,0xFBF4FBEB,0xFC12FBF6,0xFC33FC27,
-0xFC61FC4C,0xFC95FC7A,0xFCE2FCBF,0xFD30FD0C,0xFD89FD5D,0xFDD7FDB4,0xFE2FFE07,0xFE8AFE5A,
-0xFEDEFEBA,0xFF3FFF15,0xFFACFF88,0x0007FFE1,0x005E0033,0x00D00098,0x01340105,0x018C0167,
-0x01E801C4,0x023D020D,0x02930266,0x02EB02BC,0x0335030C,0x0383035E,0x03D303A7,0x041503F2,
-0x04500435,0x0488046B,0x04BD04A5,0x04F204DA,0x051504FA,0x05350519,0x054D0548,0x05670559,
-0x057D056F,0x058B058A,0x0590058B,0x059D059A,0x059D0597,0x0597059C,0x058A058A,0x0585058E,
-0x056A0573,0x0548055E,0x0528053B,0x05050516,0x04C304DE,0x048104A4,0x043E045E,0x03E40410,
-0x039003C2,0x032D0358,0x02D602FC,0x026E029D,0x02140239,0x01AF01E7,0x0158017B,0x00F30121,
-0x009100BD,0x00310062,0xFFE20008,0xFF95FFB9,0xFF65FF73,0xFF26FF34,0xFEE0FF00,0xFE9EFEBB,
-0xFE65FE7E,0xFE29FE4D,0xFDE8FE11,0xFDB7FDDA,0xFD90FDAD,0xFD48FD75,0xFD1CFD3A,0xFCEEFD08,
-0xFCBDFCD6,0xFC95FCA3,0xFC5FFC70,0xFC40FC50,0xFC0DFC2C,0xFBECFBF8,0xFBE4FBE6,0xFBD5FBDF,
-0xFBD7FBC9,0xFBCDFBCC,0xFBD6FBC4,0xFBE5FBDB,0xFBF0FBE6,0xFC06FBFE,0xFC26FC1F,0xFC4FFC35,
-0xFC6CFC65,0xFC94FC86,0xFCB8FCA2,0xFCE9FCD4,0xFCFEFCFC,0xFD1DFD14,0xFD3FFD31,0xFD49FD3A,
-0xFD40FD4A,0xFD40FD44,0xFD40FD46,0xFD56FD4B,0xFD49FD49,0xFD3CFD3E,0xFD3BFD3A,0xFD32FD34,
-0xFD47FD31,0xFD51FD4D,0xFD6BFD5A,0xFD7CFD77,0xFDAAFD91,0xFDDCFDBE,0xFE1EFE06,0xFE53FE45,
-0xFE92FE75,0xFED1FEB1,0xFF25FEF4,0xFF60FF43,0xFF9CFF79,0xFFE1FFC1,0x000BFFFB,0x003C002C,
-0x00660054,0x008E0081,0x00A600A6,0x00B200AC,0x00C700C3,0x00C400CA,0x00CE00C6,0x00C300C8,
-0x00BB00C8,0x009F00A9,0x00920092,0x0084008F,0x00700082,0x0063006A,0x005C005E,0x005E0055,
-0x0056005C,0x0050004D,0x004D004C,0x005F005C,0x00680065,0x00790069,0x0078007D,0x009F008A,
-0x00B100B1,0x00CA00B9,0x00F000D9,0x010400F8,0x0124010E,0x01480134,0x015F014B,0x01780167,
-0x01A1018D,0x01C701B2,0x01EA01D5,0x01F501F5,0x02110207,0x0229021E,0x02280224,0x02320229,
-0x023B0231,0x023E0240,0x02400239,0x023D0244,0x023E023A,0x022F0233,0x021E021A,0x0207020D,
-0x01E601F5,0x01D401E2,0x01C001D1,0x018701AA,0x01790180,0x01490166,0x012F0144,0x0102011C,
-0x00D900EE,0x00B100CA,0x008A0096,0x006B0074,0x00480059,0x00220037,0x001A001E,0x000D0017,
-0x000C000C,0x00010009,0x001F000D,0x002A0027,0x00480038,0x00680060,0x0097007E,0x00C800AC,
-0x011100E7,0x01440122,0x016D0159,0x01920185,0x01CB01B1,0x01EC01D3,0x01FC01F7,0x02090207,
-0x02160217,0x020E021D,0x01FA0208,0x01DA01E8,0x01B401C5,0x01700190,0x013B0156,0x00FB0117,
-0x00CC00E7,0x009000AE,0x0056006F,0x00270047,0xFFFA0017,0xFFE7FFF1,0xFFB8FFD1,0xFFA2FFA6,
-0xFF8DFF92,0xFF81FF8B,0xFF7FFF7A,0xFF86FF89,0xFF87FF85,0xFFA5FF9C,0xFFBBFFAC,0xFFA6FFB3,
-0xFFC0FFBB,0xFFD5FFD0,0xFFEAFFEE,0x0006FFF3,0x000E000B,0x001E0017,0x00230021,0x002E0024,
-0x0022001F,0x00150014,0x001D001D,0x0004000D,0xFFF20001,0xFFE1FFF0,0xFFD2FFDC,0xFFD0FFD0,
-0xFFAAFFB9,0xFFA6FFA3,0xFF91FF96,0xFF75FF84,0xFF72FF6A,0xFF69FF6B,0xFF49FF55,0xFF35FF37,
-0xFF28FF35,0xFF0DFF1F,0xFEECFEFC,0xFEE6FEE9,0xFEBFFED4,0xFEB1FEB8,0xFEA7FEB2,0xFE8FFE96,
-0xFE7FFE88,0xFE72FE81,0xFE75FE75,0xFE64FE6A,0xFE6BFE6F,0xFE79FE75,0xFE78FE76,0xFE89FE7D,
-0xFEA2FE97,0xFEBCFEB0,0xFED7FEC7,0xFEF9FEE1,0xFF16FF02,0xFF32FF25,0xFF4AFF3E,0xFF69FF63,
-0xFF8FFF7F,0xFFB3FFA7,0xFFC6FFBD,0xFFECFFD7,0x0004FFFA,0x00140006,0x00220020,0x002E0027,
-0x003E003C,0x003B003D,0x004A004D,0x00500057,0x00560054,0x0049004F,0x004A0041,0x00370039,
-0x002C002E,0x001A0016,0x00120011,0x00080002,0xFFFD0001,0x0002FFF3,0xFFFFFFF7,0xFFFDFFFB,
-0x0007FFFA,0x001A000D,0x002E0026,0x004B0040,0x00730065,0x00980085,0x00A400A0,0x00CC00B3,
-0x00F400E0,0x010000FE,0x010E010D,0x01080113,0x010B010B,0x0111010B,0x00F80103,0x00D900EB,
-0x00BF00CF,0x00A900B1,0x00890093,0x00690075,0x00490051,0x00240039,0xFFFD0017,0xFFE5FFF2,
-0xFFBDFFDB,0xFFB3FFBB,0xFFB3FFB6,0xFFA8FFA9,0xFF9FFFA7,0xFFA6FFA3,0xFFADFFA0,0xFFB7FFB1,
-0xFFBEFFB0,0xFFAFFFB6,0xFFC4FFBE,0xFFCCFFD8,0xFFD9FFDA,0xFFDDFFD5,0xFFD8FFD7,0xFFE6FFEA,
-0xFFD8FFD8,0xFFDEFFDD,0xFFD9FFD8,0xFFDDFFD8,0xFFE8FFE4,0xFFEAFFF0,0xFFF6FFF2,0x00080007,
-0x0016000F,0x00320016,0x0045003B,0x0062004A,0x0077006C,0x0090008F,0x00A20097,0x00C800BD,
-0x00D900D7,0x00DD00DD,0x00E600EB,0x00E800E5,0x00E100DE,0x00E300DC,0x00D700E6,0x00D400DE,
-0x00B700C5,0x009C00AC,0x0085008E,0x005A006A,0x003C004F,0x002E003C,0x0023001E,0x00020009,
-0xFFE6FFF4,0xFFE2FFE4,0xFFD6FFD9,0xFFB8FFCA,0xFFAAFFAD,0xFFA3FFB2,0xFFA4FFA7,0xFFA8FFAF,
-0xFFB4FFBB,0xFFADFFB3,0xFFBAFFB1,0xFFB5FFB7,0xFFB6FFB4,0xFFAFFFB1,0xFF9AFFA6,0xFF9AFF9C,
-0xFF88FF8D,0xFF72FF80,0xFF5CFF67,0xFF35FF49,0xFF1BFF2A,0xFEF9FF0B,0xFED1FEE9,0xFEA4FEB8,
-0xFE6CFE80,0xFE42FE4D,0xFE01FE23,0xFDD3FDE3,0xFDAAFDC1,0xFD6EFD8F,0xFD4CFD55,0xFD1FFD36,
-0xFCFFFD11,0xFCEEFCF6,0xFCD0FCD9,0xFCD7FCDB,0xFCCDFCDB,0xFCDAFCCF,0xFCF8FCEC,0xFD04FCFA,
-0xFD24FD12,0xFD3CFD2E,0xFD62FD4C,0xFD81FD79,0xFDB6FDA9,0xFDF4FDD7,0xFE27FE0C,0xFE60FE42,
-0xFE95FE74,0xFEBCFEA8,0xFEF5FEDE,0xFF28FF16,0xFF40FF3E,0xFF7CFF58,0xFF9FFF89,0xFFC1FFAF,
-0xFFDDFFD1,0xFFFCFFF5,0x00160006,0x0034001E,0x004C003B,0x0060005A,0x00840070,0x00A60094,
-0x00CA00B1,0x00E400D0,0x00F100E8,0x010B00FE,0x011E011A,0x0139012E,0x01460142,0x015F014C,
-0x0166015B,0x0177015F,0x01780177,0x0176017E,0x0183017B,0x018F018C,0x019E019C,0x01A101A9,
-0x01B701AA,0x01CF01BF,0x01EC01E3,0x02100203,0x02390227,0x026D0256,0x029F0289,0x02CD02B6,
-0x02F502DE,0x033A0317,0x0357034F,0x0383036B,0x03A1039B,0x03C603BC,0x03D003CC,0x03CE03DE,
-0x03CD03D2,0x03B703CC,0x039E03AA,0x03760387,0x0349036E,0x030B0331,0x02C502F0,0x028A02AE,
-0x024D026D,0x02090222,0x01CF01EA,0x018E01B4,0x01460167,0x011E012A,0x00EA010C,0x00C800E0,
-0x009F00B4,0x0076008A,0x00630063,0x00470051,0x00210031,0xFFF9000D,0xFFDCFFE7,0xFFCDFFDA,
-0xFFBAFFC4,0xFF98FFA9,0xFF76FF8A,0xFF6BFF6B,0xFF3FFF59,0xFF29FF36,0xFF07FF1D,0xFEEEFEFA,
-0xFECEFEDC,0xFEABFEBE,0xFE85FE92,0xFE6DFE6E,0xFE43FE5C,0xFE18FE2F,0xFE0CFE14,0xFDEEFE04,
-0xFDCEFDDA,0xFDBAFDC4,0xFDB2FDB0,0xFDACFDAE,0xFDA7FDB2,0xFDA1FDA9,0xFDAFFDAA,0xFDC2FDB6,
-0xFDDBFDCF,0xFDECFDE5,0xFE03FDF3,0xFE20FE0F,0xFE4AFE31,0xFE5FFE4C,0xFE8CFE77,0xFEA1FE98,
-0xFEC5FEAE,0xFEE0FED2,0xFF01FEF1,0xFF12FF15,0xFF45FF2E,0xFF5FFF4B,0xFF78FF66,0xFF94FF8E,
-0xFF92FF99,0xFF9FFFA7,0xFFA1FFA0,0xFFA8FF98,0xFFB1FFB3,0xFFA8FFB1,0xFFA8FFAD,0xFFA4FFB0,
-0xFFA9FFAB,0xFFAEFFBA,0xFFAAFFAB,0xFFAEFFB2,0xFFADFFB0,0xFFAAFFA6,0xFFA8FFA6,0xFF9DFFA4,
-0xFF99FF97,0xFF90FF98,0xFF8EFF90,0xFF7FFF85,0xFF74FF77,0xFF73FF73,0xFF63FF6E,0xFF54FF52,
-0xFF45FF4A,0xFF37FF35,0xFF2BFF32,0xFF27FF31,0xFF20FF23,0xFF20FF23,0xFF2DFF29,0xFF38FF2C,
-0xFF3CFF35,0xFF56FF4E,0xFF73FF65,0xFF7EFF7A,0xFFA5FF92,0xFFC1FFB0,0xFFDBFFCA,0xFFFFFFE9,
-0x00110002,0x002D0023,0x0048003B,0x004A004E,0x005C005A,0x005F006A,0x0070006A,0x00700074,
-0x0075006E,0x0062006C,0x00650061,0x00530060,0x00650067,0x006E006F,0x00860074,0x008C007C,
-0x00A10094,0x00CB00B6,0x010400E4,0x012A0116,0x015F014C,0x01A40187,0x01EB01D0,0x0229020D,
-0x0275024F,0x02C302A0,0x030502E3,0x0350032A,0x03820366,0x03C50390,0x03ED03DC,0x041E0409,
-0x042E0433,0x044C043E,0x045D045A,0x0469046D,0x04520465,0x04570457,0x04420448,0x041F0431,
-0x0411040F,0x03EB03FF,0x03BC03CC,0x039203B0,0x0361037D,0x03230345,0x02DD030C,0x029C02BD,
-0x02620274,0x021A023B,0x01C701EA,0x017D019C,0x01320157,0x00E6010E,0x009800C0,0x0036006E,
-0xFFF50011,0xFFA3FFD1,0xFF54FF79,0xFF1BFF39,0xFEDDFEF8,0xFE9AFEB0,0xFE5EFE76,0xFE20FE3D,
-0xFDF1FE0E,0xFDB8FDD1,0xFD97FD9B,0xFD76FD8C,0xFD4BFD57,0xFD46FD51,0xFD34FD45,0xFD3DFD39,
-0xFD47FD3F,0xFD45FD43,0xFD5EFD5D,0xFD73FD68,0xFD8EFD88,0xFDABFD97,0xFDC4FDB6,0xFDD9FDCF,
-0xFDFCFDF1,0xFE16FE09,0xFE2FFE1B,0xFE38FE39,0xFE50FE45,0xFE60FE5C,0xFE65FE6B,0xFE77FE68,
-0xFE78FE74,0xFE72FE75,0xFE5DFE64,0xFE4CFE54,0xFE42FE3F,0xFE32FE35,0xFE21FE2E,0xFE0DFE19,
-0xFE00FE05,0xFDE7FDFA,0xFDE5FDE6,0xFDD4FDE9,0xFDE0FDD9,0xFDDAFDDA,0xFDE6FDD8,0xFDF4FDE3,
-0xFDFAFDF5,0xFE19FE0C,0xFE33FE2B,0xFE40FE45,0xFE61FE4D,0xFE83FE6B,0xFE90FE84,0xFEA5FE95,
-0xFEB5FEB6,0xFEC1FEB9,0xFED1FEC4,0xFED7FED3,0xFEDFFED4,0xFECFFED5,0xFEC2FECE,0xFEC1FEC6,
-0xFEB3FEC2,0xFEA3FEAB,0xFE94FE9C,0xFE85FE8B,0xFE76FE7C,0xFE80FE83,0xFE66FE72,0xFE56FE53,
-0xFE62FE5C,0xFE58FE60,0xFE55FE4C,0xFE5BFE52,0xFE66FE5E,0xFE6BFE5E,0xFE7AFE62,0xFE7FFE7C,
-0xFE88FE8C,0xFE93FE89,0xFEA6FEA3,0xFEBEFEBD,0xFECCFECF,0xFEF2FEE0,0xFF22FF14,0xFF4CFF3D,
-0xFF76FF58,0xFFB2FF96,0xFFDEFFCA,0x00250001,0x006F004A,0x00AF0084,0x00EE00CF,0x01470118,
-0x01950171,0x01EC01C3,0x022F0208,0x0282025F,0x02D402AE,0x031402FC,0x035B0343,0x03900376,
-0x03D303B1,0x041103EF,0x043B0422,0x045F044D,0x047E0474,0x04930488,0x04AD04AE,0x04BA04BC,
-0x04B604BD,0x04C104BC,0x04BD04B4,0x04C504C9,0x04B304B7,0x04B104B0,0x049E049D,0x0497049D,
-0x048E048A,0x0477047E,0x04640464,0x044A0453,0x04250442,0x04180420,0x03F20400,0x03B603DE,
-0x039603A1,0x03690385,0x03240350,0x02F3030F,0x029E02D0,0x024B026D,0x0207022C,0x01A801D8,
-0x0150017A,0x00E30115,0x008200BA,0x001D004B,0xFFA9FFDD,0xFF41FF7A,0xFED4FF0C,0xFE72FEA4,
-0xFE12FE46,0xFDBBFDED,0xFD6AFD92,0xFD15FD46,0xFCE2FCF2,0xFCB3FCC4,0xFC91FC98,0xFC6BFC7C,
-0xFC61FC61,0xFC53FC61,0xFC59FC5B,0xFC56FC5E,0xFC67FC5E,0xFC78FC7A,0xFC8CFC87,0xFCA2FC9A,
-0xFCB6FCAD,0xFCC5FCBC,0xFCC8FCCB,0xFCC7FCBD,0xFCC7FCCA,0xFCBEFCC1,0xFCB6FCC9,0xFCB5FCB9,
-0xFC99FC97,0xFC9FFC9F,0xFC95FC9F,0xFC96FC9B,0xFC93FC90,0xFC9EFC94,0xFC98FC9F,0xFCB2FCA4,
-0xFCD1FCBB,0xFCF0FCDE,0xFD16FCF8,0xFD3EFD23,0xFD6AFD54,0xFD9DFD86,0xFDCCFDA9,0xFE00FDF0,
-0xFE33FE21,0xFE5EFE54,0xFEA9FE87,0xFED6FEBD,0xFF0BFEF8,0xFF46FF2A,0xFF7EFF67,0xFFB5FFA3,
-0xFFE0FFCC,0x001DFFFA,0x004F0035,0x0085006E,0x00B2009B,0x00F400CE,0x0123010B,0x0153013E,
-0x017E0167,0x01BB0196,0x01F001D4,0x02160204,0x02430228,0x02640253,0x027A0276,0x0288028C,
-0x02950298,0x029E029D,0x029302A2,0x028B0290,0x026E0280,0x024C0266,0x0228023B,0x01FB0214,
-0x01C601DB,0x018901AB,0x014F0171,0x01070132,0x00C700ED,0x009200AF,0x0051006C,0x0011002C,
-0xFFE6FFFC,0xFFAFFFC6,0xFF8FFF9D,0xFF6BFF73,0xFF5DFF68,0xFF47FF4E,0xFF3AFF42,0xFF2DFF3F,
-0xFF2BFF24,0xFF3CFF2B,0xFF41FF39,0xFF43FF49,0xFF5BFF4D,0xFF6EFF63,0xFF7CFF75,0xFF7CFF76,
-0xFF99FF93,0xFFACFF9D,0xFFABFFA9,0xFFC0FFB8,0xFFC9FFBE,0xFFD6FFD3,0xFFE9FFDE,0x000CFFF8,
-0x0012000C,0x0030001F,0x00460042,0x0056004C,0x00850073,0x0092008E,0x00C400A7,0x00E700DB,
-0x00FA00F5,0x0121010B,0x0143012E,0x01730157,0x01810177,0x01AF019B,0x01D101BE,0x01F201E5,
-0x02180207,0x02300227,0x02400234,0x0253024B,0x025A0258,0x026A025C,0x025E0261,0x025C0258,
-0x025A0260,0x0253025B,0x02400248,0x02410241,0x02280232,0x0226022C,0x02130220,0x01FF020B,
-0x01F401FB,0x01F701F2,0x01E101E5,0x01E301D9,0x01C401CB,0x01CA01C6,0x01B101C1,0x019E01A8,
-0x0189019A,0x016B0179,0x01500160,0x01240145,0x00F70115,0x00C500E4,0x008900AF,0x0042006C,
-0xFFF6001F,0xFFA8FFCE,0xFF5FFF85,0xFF09FF29,0xFEBEFEE4,0xFE6DFE94,0xFE17FE4A,0xFDC6FDFB,
-0xFD9AFDBD,0xFD5BFD7B,0xFD23FD3F,0xFCFFFD07,0xFCECFCF3,0xFCC8FCDC,0xFCB8FCBE,0xFCB4FCBA,
-0xFCAFFCA8,0xFCA4FCAA,0xFC99FC9A,0xFC97FC9E,0xFC90FC91,0xFC92FC99,0xFC8DFC93,0xFC8EFC8A,
-0xFC8DFC9A,0xFC90FC99,0xFCA8FCA5,0xFCB2FCA2,0xFCBAFCB3,0xFCCEFCCA,0xFCEDFCD8,0xFD06FCFB,
-0xFD1BFD16,0xFD5CFD38,0xFD87FD6F,0xFDB1FDA0,0xFDDFFDC3,0xFE1AFDFA,0xFE5CFE3A,0xFE8CFE7F,
-0xFECCFEB3,0xFF20FEFB,0xFF5CFF47,0xFFA2FF7C,0xFFF6FFC7,0x00340013,0x0089005B,0x00D400AC,
-0x011500F6,0x014F0136,0x01A4017B,0x01E701C7,0x022E0213,0x026C0247,0x02B1028B,0x02E402CB,
-0x03240302,0x034D0337,0x03780361,0x03A50396,0x03C603BA,0x03DF03CB,0x03F003E7,0x040B03FF,
-0x040C040C,0x03F90401,0x03EA03EE,0x03CF03E0,0x03AC03C9,0x03840397,0x03560370,0x031D033C,
-0x02D00302,0x029002B7,0x023D026B,0x01F5020E,0x01A501C5,0x01460174,0x01050127,0x00B200D9,
-0x0067007F,0x002B004B,0xFFDB0007,0xFFA6FFBE,0xFF76FF91,0xFF31FF4D,0xFF08FF1F,0xFEDEFEEF,
-0xFEBDFEC8,0xFEA5FEB6,0xFE90FEA1,0xFE84FE85,0xFE74FE83,0xFE6CFE6B,0xFE69FE62,0xFE72FE6C,
-0xFE71FE70,0xFE72FE7B,0xFE7BFE7A,0xFE8DFE8D,0xFE97FE8E,0xFE9EFE9A,0xFEBAFEB4,0xFEC1FEBB,
-0xFED3FEC2,0xFEE1FED7,0xFEE2FEDD,0xFEEAFEE4,0xFEFFFEF9,0xFF0AFF06,0xFF10FF13,0xFF16FF18,
-0xFF2BFF1B,0xFF3CFF34,0xFF55FF40,0xFF6DFF62,0xFF91FF86,0xFFBFFFAA,0xFFF8FFD9,0x0035001E,
-0x00670046,0x00A90094,0x00FF00C7,0x0141011F,0x017C015E,0x01BC01A4,0x021401E8,0x02450232,
-0x026D025E,0x02970280,0x02BA02AA,0x02CF02BF,0x02D402D7,0x02D402DD,0x02EC02DD,0x02D502DA,
-0x02BE02CA,0x02A702AF,0x028A029B,0x025B026A,0x022C0244,0x01FC0217,0x01B801DA,0x0187019F,
-0x01450164,0x00FE0120,0x00CE00E9,0x007A00A6,0x00360058,0xFFF80019,0xFFB4FFD4,0xFF6DFF95,
-0xFF36FF4F,0xFEF2FF15,0xFEB1FED6,0xFE75FE95,0xFE2FFE50,0xFDF5FE0F,0xFDAAFDCD,0xFD85FD96,
-0xFD49FD66,0xFD0EFD38,0xFCE8FCF5,0xFCCEFCE1,0xFCB9FCC7,0xFCADFCA5,0xFC9BFC9D,0xFC94FC99,
-0xFC91FC93,0xFC9BFC96,0xFCAAFCA2,0xFCB5FCB0,0xFCC4FCC7,0xFCEEFCE0,0xFD18FCFB,0xFD2EFD20,
-0xFD50FD3C,0xFD74FD5C,0xFD99FD8C,0xFDB4FDB2,0xFDDBFDD2,0xFE00FDF3,0xFE24FE18,0xFE41FE32,
-0xFE59FE4D,0xFE75FE68,0xFE89FE86,0xFE9DFE95,0xFEA9FEA3,0xFECBFEC0,0xFED2FEC6,0xFEF1FEE3,
-0xFF09FEF7,0xFF15FF0D,0xFF29FF1D,0xFF3CFF2B,0xFF4FFF4A,0xFF65FF53,0xFF87FF7B,0xFF9EFF99,
-0xFFBCFFB4,0xFFDAFFCE,0x0002FFF7,0x001D0008,0x00440031,0x005D004C,0x00790065,0x0097008C,
-0x00AA009E,0x00D400D3,0x00E200E2,0x00F100E8,0x00EF0101,0x010B00FF,0x01010109,0x010800FC,
-0x01040101,0x00FD00FC,0x00EA00F2,0x00DF00DB,0x00DA00D6,0x00D200D4,0x00C900D1,0x00C100D1,
-0x00BE00C3,0x00C600B7,0x00BC00C8,0x00D600D0,0x00E400DA,0x00E400E8,0x00F200EE,0x00F900FB,
-0x01000105,0x01170113,0x0114011E,0x01230117,0x012D0121,0x012D0132,0x0126012B,0x0134012A,
-0x01310134,0x0124012C,0x01230119,0x01110111,0x01110112,0x00F90105,0x01130101,0x010B0104,
-0x010500FA,0x00F80101,0x010400FD,0x00FD0108,0x00F50107,0x00FA00FB,0x010800FD,0x01080103,
-0x010F0109,0x010E010C,0x0102010B,0x00F800F8,0x00E600EF,0x00D000DB,0x00B500CF,0x009A00AC,
-0x00790086,0x0061006E,0x004E0059,0x00340045,0x002D002B,0x00120021,0x0014000C,0x0005000A,
-0x00160008,0x001E0017,0x00260024,0x003A0032,0x004D0045,0x0060005E,0x00860076,0x009C008F,
-0x009B00A2,0x00CB00BA,0x00D600D9,0x00ED00E5,0x00EF00F1,0x010000F9,0x00F000F6,0x00ED00EE,
-0x00D300E7,0x00C200C5,0x00AA00B9,0x00860094,0x006D0070,0x003E0058,0x00170033,0xFFE1FFEC,
-0xFFC0FFD9,0xFF93FFB1,0xFF74FF8A,0xFF3FFF63,0xFF21FF34,0xFF1AFF20,0xFEFAFF0C,0xFEE7FEEB,
-0xFEDCFED6,0xFED2FED2,0xFECFFECB,0xFECFFECE,0xFECAFEC6,0xFED0FEC9,0xFED4FEC7,0xFEE3FEDA,
-0xFEFAFEEC,0xFF15FF01,0xFF1AFF16,0xFF21FF23,0xFF45FF37,0xFF65FF56,0xFF70FF5F,0xFF7EFF7A,
-0xFF7EFF7A,0xFF86FF81,0xFF97FF94,0xFF9AFFA1,0xFF8FFF90,0xFF93FF89,0xFF80FF84,0xFF6BFF76,
-0xFF53FF62,0xFF49FF4E,0xFF21FF3B,0xFF00FF0A,0xFEE1FEEB,0xFEBEFECF,0xFEA5FEB6,0xFE78FE93,
-0xFE6CFE75,0xFE41FE53,0xFE2BFE38,0xFE0DFE15,0xFDF6FDFF,0xFDDEFDEE,0xFDC7FDD2,0xFDC1FDCE,
-0xFDB0FDB6,0xFDB3FDAD,0xFDA4FDAC,0xFDAEFDAD,0xFDC2FDBA,0xFDD1FDCE,0xFDECFDE0,0xFE0AFDF7,
-0xFE25FE1C,0xFE54FE37,0xFE93FE75,0xFECBFEB2,0xFF17FEF1,0xFF65FF3D,0xFFACFF86,0xFFF9FFCE,
-0x00510026,0x00920072,0x00EA00C1,0x0127010C,0x016E0145,0x019E017E,0x01EC01BC,0x020D01FE,
-0x0237021B,0x02550245,0x027E0266,0x027C0279,0x028E0288,0x02B1029F,0x02BD02BC,0x02C802BA,
-0x02D002C9,0x02DD02DB,0x02EE02EA,0x02FE02FB,0x03150309,0x031E0314,0x0329031E,0x03480341,
-0x035C035E,0x037A036D,0x03980385,0x03A5039E,0x03BA03B4,0x03C503CA,0x03C703C7,0x03C803CD,
-0x03CF03C8,0x03C303D3,0x03BF03C5,0x03A203B2,0x038F039F,0x036B037F,0x03520360,0x0321033E,
-0x02EF030B,0x02B702DA,0x028502A4,0x02500269,0x021F023A,0x01F00207,0x01A601C3,0x016F0197,
-0x013D0167,0x01190128,0x00EF0109,0x00B500C8,0x009E00A5,0x006C007D,0x004E0058,0x0021003A,
-0x0008000A,0xFFEBFFF8,0xFFC4FFD3,0xFFA9FFAD,0xFF81FF96,0xFF53FF65,0xFF41FF4B,0xFF22FF31,
-0xFEF7FF0A,0xFEE8FEF3,0xFEC0FEDB,0xFEA3FEAF,0xFE8BFE96,0xFE61FE78,0xFE44FE5D,0xFE14FE35,
-0xFDF0FE07,0xFDCFFDE7,0xFDA3FDBD,0xFD78FD8A,0xFD47FD5B,0xFD19FD35,0xFCEBFCFC,0xFCC4FCD0,
-0xFCA0FCB6,0xFC80FC95,0xFC66FC72,0xFC55FC67,0xFC37FC46,0xFC38FC38,0xFC2BFC32,0xFC1BFC2A,
-0xFC26FC1D,0xFC2CFC2B,0xFC2FFC31,0xFC37FC2C,0xFC47FC3D,0xFC63FC4B,0xFC66FC61,0xFC7CFC6F,
-0xFC96FC89,0xFCABFCA2,0xFCC6FCB7,0xFCEBFCD6,0xFD1CFD06,0xFD35FD23,0xFD6DFD47,0xFD96FD80,
-0xFDC5FDAF,0xFDFBFDE6,0xFE39FE25,0xFE6DFE56,0xFEA9FE91,0xFEE4FEC2,0xFF34FF11,0xFF52FF3C,
-0xFF7CFF63,0xFFA3FF8E,0xFFC6FFB8,0xFFE2FFDE,0x000CFFF8,0x00260017,0x0037002E,0x0050003E,
-0x005D005E,0x006C0062,0x007C0081,0x008D0088,0x00A70093,0x00C500B5,0x00DA00D2,0x010500EE,
-0x0137011A,0x015D014E,0x01890179,0x01C401A6,0x01E701D4,0x02140201,0x02380226,0x0262024D,
-0x0270026E,0x02A0028F,0x02B602B5,0x02C602C3,0x02C902CA,0x02DB02D0,0x02C902D9,0x02C802CB,
-0x02BD02C8,0x02A602AB,0x027D0288,0x0275027A,0x025B026D,0x023F0240,0x021E0226,0x01FB020A,
-0x01C001DD,0x01B901C8,0x019501A9,0x01800191,0x0171017A,0x01530167,0x01320147,0x0126012D,
-0x01060113,0x00E700EE,0x00D400DE,0x00C400CD,0x00A900B1,0x008C009D,0x00600078,0x004E004F,
-0x0030003E,0x001D0020,0x000D001A,0x0001FFFD,0xFFEDFFF9,0xFFE6FFE3,0xFFF1FFEF,0xFFECFFF0,
-0xFFF6FFF2,0x000C0003,0x00210017,0x002E0029,0x004F003C,0x00740066,0x008A0080,0x00A400A0,
-0x00D300C1,0x00EF00DA,0x01180109,0x012C0118,0x01420137,0x01520150,0x01440142,0x01440144,
-0x0146014B,0x012E013E,0x012B0124,0x0113011B,0x00F800FE,0x00D500E5,0x00A900C0,0x00890099,
-0x0046006B,0x001F0030,0xFFEF000D,0xFFBEFFDB,0xFF7FFFA1,0xFF5CFF66,0xFF1EFF3A,0xFEE4FF02,
-0xFEAAFEC8,0xFE7AFE92,0xFE4BFE6D,0xFE25FE2E,0xFDF8FE13,0xFDDFFDE3,0xFDC4FDCC,0xFDAFFDB7,
-0xFD9CFDA2,0xFD84FD8D,0xFD6EFD79,0xFD74FD6D,0xFD65FD6D,0xFD61FD69,0xFD66FD60,0xFD55FD5A,
-0xFD53FD59,0xFD49FD4D,0xFD40FD39,0xFD2EFD33,0xFD0EFD17,0xFCFAFCFB,0xFCE3FCF5,0xFCD1FCDB,
-0xFCC9FCD5,0xFC9FFCB6,0xFC94FC9B,0xFC87FC8E,0xFC65FC79,0xFC6BFC65,0xFC60FC6B,0xFC54FC5E,
-0xFC62FC56,0xFC5DFC59,0xFC58FC57,0xFC67FC5B,0xFC70FC5F,0xFC90FC89,0xFC9BFC9A,0xFCBAFCB4,
-0xFCD8FCBD,0xFD11FCFA,0xFD40FD28,0xFD5AFD47,0xFD98FD80,0xFDD4FDC3,0xFE1BFDFA,0xFE65FE44,
-0xFEB5FE8F,0xFF10FEE8,0xFF64FF2F,0xFFB8FF84,0x0018FFE9,0x006D004A,0x00D6009D,0x01340101,
-0x0187015D,0x01E601C1,0x023B0202,0x02840258,0x02D102AF,0x032002F6,0x03540339,0x03940379,
-0x03C603AF,0x03F503DA,0x041C0402,0x04360420,0x045D0444,0x04710465,0x0480046F,0x048D0485,
-0x04890483,0x04960489,0x048D0497,0x048B0485,0x047C0483,0x04640470,0x044F045C,0x044B0451,
-0x043F0441,0x04210430,0x03F00404,0x03CE03E9,0x03AE03C7,0x037A038F,0x03450366,0x03130329,
-0x02DA02FF,0x02A702C2,0x02610284,0x02300244,0x01D60205,0x019501B1,0x01500178,0x01120135,
-0x00D100EF,0x009800B4,0x0071007C,0x0043005A,0x00230028,0xFFFE0012,0xFFD8FFEA,0xFFBEFFD7,
-0xFFB0FFB5,0xFFA0FFB0,0xFF9CFFA0,0xFF99FF9A,0xFFA4FFA6,0xFF9CFFA8,0xFF97FF9B,0xFFB2FFB1,
-0xFFCAFFC4,0xFFE5FFD4,0x0007FFF2,0x002E001A,0x00580041,0x00740066,0x00A20087,0x00BC00B2,
-0x00D000C1,0x00EF00E2,0x010100FB,0x011B0113,0x0125011B,0x0134012F,0x011B0128,0x010A0118,
-0x00FC0102,0x00FA0101,0x00CD00E0,0x00BF00C1,0x00A200B1,0x007F0092,0x00520070,0x00360044,
-0x0013002D,0xFFFF000D,0xFFD3FFE8,0xFFC1FFCE,0xFF97FFB1,0xFF78FF80,0xFF73FF6E,0xFF4FFF61,
-0xFF31FF40,0xFF1AFF26,0xFEFAFF13,0xFEDAFEED,0xFEBEFEC6,0xFE9EFEA8,0xFE7BFE83,0xFE4FFE6C,
-0xFE26FE3F,0xFE15FE17,0xFDE9FDF9,0xFDB9FDCF,0xFD94FDAC,0xFD82FD89,0xFD5FFD68,0xFD40FD45,
-0xFD22FD31,0xFD0EFD15,0xFCFBFD09,0xFCDDFCEA,0xFCC9FCD7,0xFCC7FCC4,0xFCC6FCBF,0xFCB9FCBF,
-0xFCB0FCAD,0xFCAAFCAA,0xFCACFCAB,0xFCA1FCA8,0xFCA7FCA5,0xFCADFCA4,0xFCABFCA8,0xFCB4FCAE,
-0xFCB4FCB9,0xFCC0FCC0,0xFCC9FCC9,0xFCDDFCD2,0xFCF5FCE7,0xFD1DFD08,0xFD41FD28,0xFD52FD4D,
-0xFD77FD60,0xFDADFD9A,0xFDEDFDCC,0xFE2AFDFF,0xFE7AFE4D,0xFEBAFE98,0xFF18FEE6,0xFF64FF3E,
-0xFFB3FF91,0x000BFFDB,0x00650035,0x00B20090,0x011200E7,0x015F013A,0x01C50191,0x020A01E8,
-0x02530229,0x02970284,0x02E402C6,0x031C0304,0x0356033C,0x0397037F,0x03D703B8,0x040D03E9,
-0x0429041C,0x044B043B,0x04740463,0x04800478,0x04800485,0x04820494,0x047F0481,0x047B0479,
-0x0464047C,0x043A0458,0x0420042B,0x03FF040D,0x03CA03E4,0x039503B4,0x03650383,0x03290343,
-0x02E60303,0x02A102BD,0x026E028C,0x021C024A,0x01E301FC,0x01A501CB,0x016B0187,0x0124014A,
-0x00F30102,0x00B100D3,0x007F0094,0x00570071,0x002E0038,0x00050018,0xFFEDFFFD,0xFFD4FFDE,
-0xFFACFFBC,0xFF8FFFA0,0xFF7BFF88,0xFF73FF7D,0xFF67FF69,0xFF5CFF60,0xFF5DFF61,0xFF48FF5E,
-0xFF3FFF47,0xFF2EFF34,0xFF1FFF27,0xFF11FF1D,0xFF06FEFF,0xFEE4FEE6,0xFED2FED3,0xFEABFEB9,
-0xFE8BFE9A,0xFE76FE8C,0xFE51FE61,0xFE3AFE45,0xFE1AFE2F,0xFE0DFE16,0xFDF2FDF3,0xFDF1FDEA,
-0xFDF0FDF4,0xFDDEFDEC,0xFDF0FDEB,0xFDF6FDF2,0xFE0EFE00,0xFE22FE19,0xFE30FE2D,0xFE5EFE3E,
-0xFE82FE72,0xFE9CFE8A,0xFEC5FEAB,0xFEE6FECE,0xFF0CFEE7,0xFF1FFF14,0xFF3AFF2C,0xFF5FFF4F,
-0xFF79FF68,0xFF88FF82,0xFFAEFF96,0xFFBEFFBB,0xFFCDFFC6,0xFFDDFFD7,0xFFF1FFEC,0x00090005,
-0x00100014,0x00200015,0x002C002D,0x00390033,0x00520047,0x0055004A,0x00630058,0x00620065,
-0x00750060,0x00660067,0x006B0061,0x006D0071,0x00670065,0x005C006A,0x0051005A,0x00490053,
-0x00400049,0x0029002C,0x00240026,0x000D0014,0xFFEFFFF3,0xFFDDFFE7,0xFFB9FFC6,0xFFB4FFBE,
-0xFF92FFA6,0xFF84FF8B,0xFF78FF7F,0xFF71FF70,0xFF56FF59,0xFF39FF47,0xFF2CFF40,0xFF0EFF1F,
-0xFF0DFF08,0xFEF7FEFD,0xFEDFFEE4,0xFEC1FED8,0xFE9CFEB0,0xFE8AFE99,0xFE70FE83,0xFE5AFE6B,
-0xFE51FE5B,0xFE3DFE4A,0xFE2BFE3C,0xFE23FE25,0xFE39FE2F,0xFE3BFE37,0xFE42FE3D,0xFE50FE41,
-0xFE60FE58,0xFE83FE70,0xFEA7FE97,0xFED0FEC1,0xFF04FEDE,0xFF2FFF1D,0xFF65FF3C,0xFF92FF7C,
-0xFFBFFFAE,0xFFEFFFE4,0x0024000F,0x005B003D,0x00870069,0x00A90096,0x00DC00D2,0x010B00EC,
-0x012B0121,0x014F013B,0x01720163,0x017B0175,0x01A00190,0x01BD01AD,0x01CD01C3,0x01DE01D5,
-0x01F101E2,0x01EF01F7,0x01F401FA,0x01F501FE,0x01EF01EE,0x01F301E9,0x01EB01EE,0x01E301E0,
-0x01DA01DC,0x01D001CD,0x01CD01C7,0x01BC01BB,0x01B101B3,0x01A701A6,0x01970198,0x0198019B,
-0x0196019E,0x01A1018E,0x019F019F,0x019301A4,0x0185018F,0x0188018B,0x0173017E,0x016B016F,
-0x01570162,0x014F0156,0x0123013E,0x010F0113,0x00E700F6,0x00C800D7,0x009500AD,0x006E0080,
-0x004A005F,0x001C002A,0xFFE3FFFF,0xFFB8FFD5,0xFF9FFFAC,0xFF71FF8A,0xFF4CFF5F,0xFF28FF2B,
-0xFF01FF0C,0xFEECFEF2,0xFEC7FEDA,0xFEA5FEB1,0xFE92FE94,0xFE83FE80,0xFE73FE7D,0xFE66FE6F,
-0xFE56FE5C,0xFE58FE58,0xFE4BFE4C,0xFE4EFE43,0xFE47FE4E,0xFE4FFE49,0xFE60FE54,0xFE5CFE59,
-0xFE72FE6E,0xFE8BFE7A,0xFE9BFE92,0xFEACFEA7,0xFECAFEC0,0xFEECFEE1,0xFF13FEFE,0xFF3BFF21,
-0xFF6BFF54,0xFF90FF7B,0xFFB1FFAB,0xFFD9FFC8,0x0008FFF0,0x002A001E,0x00580039,0x007B006A,
-0x00A6008F,0x00B600AE,0x00C100B7,0x00DD00DD,0x00EA00E5,0x00F400F2,0x00E900F3,0x00F200F8,
-0x00F10101,0x00E600EE,0x00E800E6,0x00D000D9,0x00C100CD,0x00B000B5,0x00A000A8,0x00950098,
-0x00720086,0x006C006D,0x005C005C,0x00430047,0x002E0038,0x0011001C,0xFFF30000,0xFFCFFFE5,
-0xFFB7FFC8,0xFF87FFA4,0xFF6FFF82,0xFF4BFF66,0xFF24FF33,0xFF01FF0F,0xFED7FEE3,0xFEBDFEC6,
-0xFE9DFEAC,0xFE78FE85,0xFE65FE6B,0xFE4BFE58,0xFE38FE3A,0xFE23FE2B,0xFE18FE1F,0xFE0EFE0C,
-0xFDF0FDFF,0xFDE8FDEA,0xFDE2FDE5,0xFDC5FDDB,0xFDCCFDCA,0xFDC4FDC9,0xFDD3FDC6,0xFDDEFDCD,
-0xFDFAFDE1,0xFDFCFDF6,0xFE10FE01,0xFE2FFE25,0xFE46FE3E,0xFE7FFE61,0xFEA5FE8B,0xFED3FEBF,
-0xFF04FEE6,0xFF36FF1D,0xFF79FF53,0xFFA5FF8B,0xFFE8FFC1,0x00140003,0x00470030,0x00940068,
-0x00C400A8,0x010100E9,0x01360123,0x016C0159,0x01A60185,0x01D701C9,0x020901EB,0x02440225,
-0x026F0254,0x02A1028E,0x02DA02BE,0x02FF02F2,0x0326030F,0x0348033C,0x0370035D,0x038D0381,
-0x03A00399,0x03BB03A8,0x03CF03C9,0x03D303CE,0x03DB03DB,0x03E503EA,0x03E203E8,0x03CC03E4,
-0x03C603CC,0x03B703C2,0x03A003AB,0x037E038E,0x036F0379,0x03430352,0x0323032C,0x0304031B,
-0x02E002F9,0x02BB02C6,0x028702A6,0x025A0267,0x023B024D,0x02140227,0x01D601F3,0x01A501C2,
-0x01760194,0x01410161,0x01050121,0x00DA00F0,0x009800AA,0x005D0073,0x00270037,0xFFD9FFFB,
-0xFF94FFB7,0xFF52FF76,0xFF16FF33,0xFED0FEF5,0xFE9AFEBA,0xFE62FE77,0xFE27FE45,0xFDF5FE07,
-0xFDCAFDD6,0xFD98FDAD,0xFD7AFD8D,0xFD63FD68,0xFD59FD60,0xFD44FD4D,0xFD3EFD3E,0xFD3CFD47,
-0xFD4AFD47,0xFD5BFD4B,0xFD62FD4B,0xFD6AFD57,0xFD72FD72,0xFD7FFD77,0xFDA5FD8D,0xFDA2FDAA,
-0xFDB7FDB6,0xFDD1FDCF,0xFDEFFDE3,0xFE08FE04,0xFE24FE1B,0xFE47FE39,0xFE67FE5D,0xFE95FE83,
-0xFEAEFEA5,0xFEBBFEB4,0xFED7FECA,0xFEF1FEE4,0xFF0EFEFE,0xFF1AFF0C,0xFF2CFF19,0xFF31FF2C,
-0xFF28FF2E,0xFF32FF2F,0xFF39FF31,0xFF2FFF33,0xFF27FF27,0xFF1DFF26,0xFF14FF1A,0xFF09FF0D,
-0xFF0BFF11,0xFEFEFEFB,0xFF02FEF9,0xFEF4FEFC,0xFEDEFEE2,0xFEECFEF0,0xFEF7FEF2,0xFEF2FEF1,
-0xFF06FF00,0xFF19FF11,0xFF19FF1B,0xFF38FF2A,0xFF4BFF42,0xFF71FF61,0xFF7EFF75,0xFF9DFF81,
-0xFFBFFFA4,0xFFCBFFC4,0xFFEAFFDD,0x000AFFFD,0x002C001C,0x004A003D,0x00590058,0x00730069,
-0x00880079,0x00A20090,0x00AA00AE,0x00B400BB,0x00B800C7,0x00C500C1,0x00C500CC,0x00C400C2,
-0x00C200CB,0x00BB00BF,0x00B800C1,0x00B100AF,0x00A500AA,0x00A500A7,0x00A300A4,0x00A800A2,
-0x00A100A1,0x00A100A3,0x00AE00AA,0x00C400AF,0x00D100C7,0x00E400DA,0x00F900E5,0x01130104,
-0x0129011A,0x014E0137,0x01660159,0x0197017C,0x01B0019B,0x01CF01B7,0x01EA01DF,0x021401FE,
-0x021D0215,0x02260226,0x02380235,0x0242023F,0x0242023F,0x023E0241,0x0235023C,0x022E0234,
-0x02280226,0x02250225,0x020A0211,0x01E90202,0x01D501E4,0x01C301DB,0x01B201C2,0x019E01AB,
-0x01900199,0x01860196,0x0167017B,0x0163016C,0x0153015A,0x01420151,0x0129013B,0x01120120,
-0x00FC0108,0x00DF00E1,0x00CF00D2,0x00AC00B5,0x008B00A6,0x0065007D,0x005B005E,0x00300044,
-0x001D0028,0xFFFE000C,0xFFE6FFF8,0xFFCEFFDE,0xFFB9FFBD,0xFFA6FFB1,0xFF90FF98,0xFF85FF8D,
-0xFF76FF79,0xFF62FF6E,0xFF51FF5B,0xFF3AFF4D,0xFF36FF38,0xFF25FF36,0xFF0BFF1B,0xFF07FF10,
-0xFEF4FF07,0xFEEAFEF8,0xFEE3FEE3,0xFED6FED5,0xFECFFEC2,0xFEB7FEC5,0xFEBBFEB5,0xFEB2FEBA,
-0xFE9EFEA0,0xFEBBFEA9,0xFEA1FEAA,0xFE9DFEA2,0xFE9FFEAA,0xFE98FEA0,0xFE87FE88,0xFE8DFE87,
-0xFE72FE82,0xFE61FE6C,0xFE60FE68,0xFE51FE54,0xFE58FE54,0xFE3DFE4A,0xFE35FE34,0xFE2EFE34,
-0xFE22FE2C,0xFE1AFE19,0xFE0BFE0F,0xFE01FE05,0xFDF3FDFB,0xFDEFFDE9,0xFDE7FDE3,0xFDDAFDE4,
-0xFDD4FDD5,0xFDD7FDD3,0xFDBEFDBD,0xFDB6FDBC,0xFDB5FDB3,0xFDA4FDA5,0xFD90FD90,0xFD98FD9C,
-0xFD8EFD87,0xFD95FD8E,0xFD8DFD92,0xFD9FFD9F,0xFDB6FDB4,0xFDC1FDB0,0xFDDAFDD0,0xFDF2FDE3,
-0xFE13FDFD,0xFE26FE30,0xFE49FE3C,0xFE7AFE5E,0xFE9FFE87,0xFEC5FEA5,0xFEF5FED9,0xFF11FF01,
-0xFF35FF24,0xFF5CFF42,0xFF80FF6C,0xFF9CFF88,0xFFBDFFAB,0xFFDDFFC8,0xFFF7FFE1,0x00100000,
-0x0020001A,0x003A0031,0x00510040,0x0064005D,0x007E006C,0x0096007F,0x00AE0095,0x00C000B7,
-0x00C400B5,0x00CD00CD,0x00EA00DF,0x00EB00F1,0x00FE00F2,0x0109010C,0x0113010B,0x0127011D,
-0x01240125,0x012B0134,0x0140013D,0x01460147,0x014F0148,0x014A0157,0x0150015A,0x01570150,
-0x0157014E,0x01620156,0x01650163,0x0161015C,0x0172016C,0x01820178,0x01930188,0x01AD0198,
-0x01C601BD,0x01E101CD,0x021001F9,0x0235021A,0x026B0254,0x027D0275,0x02A9029F,0x02D702C7,
-0x02FE02EB,0x030A02FE,0x0327031C,0x032C032E,0x0346033B,0x03420346,0x0348034A,0x033F0344,
-0x03240330,0x03110314,0x03030307,0x02E102EC,0x02B302C8,0x0290029F,0x02620272,0x02340248,
-0x0207021E,0x01CE01E3,0x019C01B3,0x0169017B,0x01310150,0x00F70118,0x00C600E0,0x009C00B7,
-0x0073008D,0x003C005F,0x00260030,0x00040012,0xFFD5FFEC,0xFFC5FFCD,0xFFABFFB6,0xFFA3FFA5,
-0xFF89FF8C,0xFF89FF87,0xFF69FF7F,0xFF6CFF69,0xFF59FF5D,0xFF54FF51,0xFF50FF52,0xFF33FF39,
-0xFF23FF2C,0xFF0DFF1F,0xFEEAFEFE,0xFED9FEDF,0xFEB4FEC2,0xFE7FFE9F,0xFE5FFE73,0xFE32FE4D,
-0xFE06FE1B,0xFDE6FDF2,0xFDB1FDC2,0xFD86FD9D,0xFD61FD7C,0xFD45FD5A,0xFD2FFD43,0xFD09FD21,
-0xFD05FCFF,0xFCEFFCFB,0xFCE2FCEC,0xFCDEFCDA,0xFCDFFCDE,0xFCEAFCE6,0xFD02FCFD,0xFD0CFCFF,
-0xFD1CFD0E,0xFD38FD28,0xFD60FD44,0xFD9FFD82,0xFDBEFDAA,0xFDF7FDD4,0xFE2BFE0C,0xFE6AFE47,
-0xFEB3FE8B,0xFEE2FEC3,0xFF3BFF15,0xFF80FF5C,0xFFBBFFA6,0xFFF5FFE3,0x003C001D,0x008C006D,
-0x00C700AD,0x00FA00EE,0x0121010A,0x01530136,0x017A0168,0x01880180,0x01AB019F,0x01AA01B0,
-0x01BB01AB,0x01B801B1,0x01A701AB,0x01A701A7,0x018B0191,0x0184018E,0x0171017E,0x01480160,
-0x013B0147,0x01260130,0x0127012A,0x01120114,0x0109010E,0x010F0108,0x01210126,0x011D011B,
-0x0123011B,0x01230125,0x01300132,0x0134013C,0x0139013D,0x0146013D,0x014F013F,0x01410149,
-0x014C0149,0x01450142,0x013F013F,0x013B0140,0x012A0132,0x012A012B,0x0119011F,0x010F0110,
-0x00F60102,0x00EB00F8,0x00F300F6,0x00E300E0,0x00E200DE,0x00E100E1,0x00D900DC,0x00E300E3,
-0x00E000E3,0x00E100E5,0x00E600EC,0x00DC00E1,0x00E700E7,0x00E100E7,0x00E500E7,0x00EA00EB,
-0x00E700EA,0x00CF00D6,0x00D500D0,0x00D400CE,0x00CC00C8,0x00C600C2,0x00C000C3,0x00AB00BA,
-0x00A100AD,0x009F009F,0x008A0096,0x007D007E,0x00640071,0x004E0056,0x00250034,0x000F002A,
-0xFFF70004,0xFFD9FFEC,0xFFB8FFCD,0xFF95FFAC,0xFF77FF84,0xFF5CFF5C,0xFF2FFF45,0xFF22FF29,
-0xFF03FF0E,0xFEF0FEF3,0xFED9FEE0,0xFEC3FECC,0xFEB6FEC4,0xFEA6FEAB,0xFE93FE98,0xFE8EFE95,
-0xFE8DFE83,0xFE7FFE89,0xFE79FE84,0xFE7BFE75,0xFE7DFE83,0xFE87FE72,0xFE7FFE83,0xFE76FE70,
-0xFE6EFE76,0xFE6BFE6F,0xFE68FE65,0xFE68FE6A,0xFE6FFE69,0xFE7CFE68,0xFE75FE78,0xFE7EFE77,
-0xFE8BFE87,0xFE82FE82,0xFE91FE8D,0xFE8BFE8D,0xFEA3FE9E,0xFEABFEA9,0xFEB6FEB3,0xFEC0FEB5,
-0xFECBFEC0,0xFECBFECC,0xFEDAFEDB,0xFED2FED5,0xFEDFFEDB,0xFEE7FEE6,0xFEF0FEE7,0xFEFDFEFE,
-0xFF10FF01,0xFF0CFF09,0xFF12FF0B,0xFF10FF12,0xFF29FF1B,0xFF31FF20,0xFF49FF41,0xFF70FF58,
-0xFF81FF72,0xFFA8FF85,0xFFBFFFA7,0xFFDCFFCD,0x0004FFEE,0x0011000E,0x00240019,0x003C0030,
-0x0061004D,0x0076006B,0x00790075,0x00970085,0x0095009B,0x008D0090,0x0090008A,0x0096008F,
-0x0085008D,0x00860082,0x006C007A,0x00660064,0x005A005E,0x00510056,0x00410043,0x003E003D,
-0x00270031,0x001A0026,0x00150014,0x000B000C,0xFFF3FFF9,0xFFE8FFF5,0xFFD6FFDC,0xFFC1FFCD,
-0xFFB2FFB4,0xFF92FF9F,0xFF7FFF82,0xFF69FF74,0xFF53FF5B,0xFF48FF4F,0xFF3CFF3C,0xFF3DFF33,
-0xFF28FF30,0xFF32FF2B,0xFF30FF33,0xFF36FF2C,0xFF46FF3E,0xFF5CFF52,0xFF81FF67,0xFFACFFA0,
-0xFFD4FFB9,0xFFFEFFE3,0x002A0018,0x005F0046,0x0090007E,0x00CA00AD,0x010500E4,0x0132011C,
-0x01610147,0x01850178,0x01B6019A,0x01CE01BF,0x01E401DD,0x020501F5,0x020A0208,0x021E021A,
-0x0223021C,0x02270226,0x021F0225,0x02300223,0x02250229,0x021A0221,0x0210021A,0x0207020A,
-0x01EF01FD,0x01E201EF,0x01D601E3,0x01C101CE,0x01B301D0,0x019501A1,0x018E0192,0x0177017B,
-0x0162016B,0x014E015C,0x013D0148,0x0138012E,0x0129012B,0x01170117,0x01090102,0x00F200FD,
-0x00E900EA,0x00E000E4,0x00CA00CE,0x00B800B7,0x00A900AA,0x009D009D,0x008E0094,0x00790081,
-0x005A0070,0x003D0049,0x001D002F,0x00000014,0xFFDBFFEE,0xFFCBFFD1,0xFFA1FFB1,0xFF76FF8D,
-0xFF51FF6B,0xFF27FF3F,0xFF0EFF1E,0xFEEFFF00,0xFECFFEE0,0xFEB8FEBE,0xFEA0FEAD,0xFE88FE95,
-0xFE7DFE8C,0xFE70FE78,0xFE67FE72,0xFE6CFE61,0xFE74FE6F,0xFE6EFE67,0xFE78FE72,0xFE77FE77,
-0xFE92FE87,0xFEA4FEA4,0xFEC0FEAE,0xFED1FEC5,0xFEEDFEDB,0xFF06FEFB,0xFF25FF11,0xFF44FF37,
-0xFF5BFF4D,0xFF74FF68,0xFFA3FF8F,0xFFBCFFB0,0xFFD9FFC3,0xFFF1FFE0,0x00100005,0x001F0021,
-0x002B0020,0x0034002B,0x003B0038,0x0032003D,0x003E0037,0x0035003A,0x0030002F,0x00270029,
-0x00140021,0x000C0011,0xFFF70003,0xFFF1FFF6,0xFFEEFFF0,0xFFEBFFED,0xFFECFFE2,0xFFF0FFF0,
-0xFFE4FFEB,0xFFEBFFE4,0xFFF3FFEF,0xFFECFFF2,0xFFFAFFF6,0xFFF4FFF0,0xFFFDFFFC,0x0003FFFB,
-0x000F0001,0xFFFC0004,0xFFFBFFEF,0xFFEDFFF0,0xFFD9FFDA,0xFFCAFFC8,0xFFBBFFC3,0xFFA9FFB5,
-0xFF94FFA1,0xFF8FFF8D,0xFF6AFF75,0xFF54FF5D,0xFF46FF46,0xFF2AFF3E,0xFF14FF26,0xFF0DFF0E,
-0xFEEBFEF7,0xFEE5FEEC,0xFEC8FED3,0xFEC6FEC4,0xFEBFFECC,0xFEAFFEBC,0xFEADFEB1,0xFEAEFEB4,
-0xFEB0FEB2,0xFEAEFEAD,0xFEAEFEB3,0xFEB2FEB2,0xFED0FEC3,0xFED4FED5,0xFEF5FEE2,0xFF06FF04,
-0xFF25FF1E,0xFF42FF3A,0xFF64FF4B,0xFF95FF86,0xFFC6FFA4,0xFFFAFFD1,0x001A000C,0x00520038,
-0x008A0074,0x00BC00A5,0x00EF00D1,0x011E00FC,0x014C0132,0x01740161,0x01AB0191,0x01D401C8,
-0x01F601E8,0x02180213,0x02390221,0x024C023E,0x02570253,0x02680258,0x027E026A,0x0288027D,
-0x028D0284,0x028D028F,0x028D0294,0x028C0294,0x028B0297,0x028D0291,0x02880286,0x02830293,
-0x02740274,0x02780280,0x026E027B,0x0264026D,0x02550263,0x02430247,0x022A0235,0x02270228,
-0x020D021F,0x01F50207,0x01DB01EA,0x01C201CD,0x019B01B7,0x01850191,0x016C0180,0x014D0155,
-0x012F0143,0x010B011A,0x00E500F2,0x00C800D1,0x009900B1,0x0086008E,0x005A006D,0x0021003A,
-0xFFEA0005,0xFFB3FFCC,0xFF8EFF97,0xFF55FF6F,0xFF16FF39,0xFEEBFEF7,0xFEABFEC6,0xFE71FE8D,
-0xFE35FE59,0xFE10FE27,0xFDD0FDF5,0xFDB7FDBF,0xFD83FD9E,0xFD5FFD6D,0xFD48FD4C,0xFD2BFD37,
-0xFD10FD28,0xFD01FD09,0xFCEFFCFD,0xFCE3FCE2,0xFCE7FCE2,0xFCD7FCE5,0xFCD8FCD4,0xFCDCFCE5,
-0xFCDFFCD7,0xFCE8FCE2,0xFCF9FCEB,0xFCF5FCFD,0xFD02FCFD,0xFD13FD0D,0xFD29FD20,0xFD42FD36,
-0xFD4AFD48,0xFD6AFD5C,0xFD84FD75,0xFDACFD99,0xFDD0FDB6,0xFDEDFDE3,0xFE21FE08,0xFE45FE3A,
-0xFE75FE5B,0xFEA0FE91,0xFECEFEB7,0xFEFFFEE7,0xFF3CFF16,0xFF5FFF4E,0xFF8BFF73,0xFFB7FFA7,
-0xFFE2FFC9,0x0011FFF7,0x00510033,0x0070005C,0x00A3008A,0x00D900C3,0x00FE00EB,0x011D010B,
-0x0138012D,0x01580158,0x0173016D,0x01920188,0x01A8019E,0x01AA01A3,0x01B501B4,0x01BD01C1,
-0x01BA01C0,0x01B401B9,0x01BB01BC,0x01AA01B0,0x01A201A6,0x01930194,0x01850186,0x017F0184,
-0x01700175,0x01560161,0x013F0155,0x01280130,0x0111011B,0x00F70101,0x00E300E8,0x00BB00D6,
-0x00A100B4,0x00830099,0x005D0076,0x0042004C,0x0023002D,0x00040010,0xFFE9FFF3,0xFFC7FFD4,
-0xFFACFFB7,0xFF97FFA3,0xFF79FF8B,0xFF63FF68,0xFF47FF50,0xFF3CFF3E,0xFF2DFF2E,0xFF29FF2C,
-0xFF29FF20,0xFF31FF2D,0xFF48FF3F,0xFF56FF4F,0xFF5FFF53,0xFF70FF62,0xFF8DFF7C,0xFFAAFFA2,
-0xFFBCFFAF,0xFFD9FFC5,0xFFFBFFE5,0x001A0007,0x003B002A,0x00580045,0x007A006A,0x0081007E,
-0x00A8009C,0x00C500B1,0x00E200DE,0x00F900F2,0x0124010B,0x013E0132,0x0164014F,0x018F017F,
-0x01AE019F,0x01D601C5,0x01FE01F0,0x02270216,0x02550240,0x027E0275,0x02A60295,0x02CC02C4,
-0x02F202DE,0x03150313,0x032C031E,0x033E0342,0x034A0343,0x03550354,0x0355035C,0x034A0352,
-0x03370342,0x0323032F,0x02F10307,0x02D702EB,0x02AB02BF,0x02780296,0x0258026B,0x021F0239,
-0x01F3020C,0x01B701DD,0x017701A4,0x01310160,0x00FD011A,0x00B400D9,0x006F0098,0x001D0044,
-0xFFCBFFFA,0xFF80FFA1,0xFF34FF5C,0xFEDFFF09,0xFE8FFEB2,0xFE31FE62,0xFDE2FE0C,0xFD96FDB1,
-0xFD4EFD69,0xFD04FD22,0xFCB2FCE0,0xFC80FC9B,0xFC51FC6C,0xFC2AFC37,0xFBFEFC10,0xFBD9FBE3,
-0xFBC6FBD3,0xFBB7FBC5,0xFBAAFBB1,0xFBA8FBA9,0xFBBDFBB8,0xFBC0FBB3,0xFBCBFBBE,0xFBE0FBD6,
-0xFBF6FBEB,0xFC10FBFD,0xFC2CFC13,0xFC43FC34,0xFC5FFC4F,0xFC7DFC6B,0xFC98FC89,0xFCB7FCA9,
-0xFCDAFCC9,0xFCF2FCDE,0xFD0FFCFA,0xFD32FD24,0xFD63FD4D,0xFD88FD77,0xFDAAFD9B,0xFDEAFDCE,
-0xFE1BFE02,0xFE47FE2C,0xFE83FE6A,0xFEBAFEA4,0xFEEFFEDB,0xFF3FFF26,0xFF80FF5D,0xFFC1FFA0,
-0x0010FFE3,0x0059002C,0x00A90081,0x00E300C3,0x0132010D,0x01890163,0x01C601A5,0x021301F0,
-0x02530236,0x029A027E,0x02D402C1,0x030A02F6,0x033E031E,0x03720360,0x038E0382,0x039F0399,
-0x03C203B6,0x03CF03CD,0x03C903CB,0x03D103CE,0x03BF03CE,0x03B603C2,0x039E03B4,0x03840391,
-0x0362036D,0x03350347,0x031A0325,0x02E30304,0x02AB02C5,0x02830293,0x02570272,0x021B023D,
-0x01E50200,0x01BA01D4,0x019201AB,0x01630178,0x012C014A,0x0107011D,0x00D200F1,0x00AA00C0,
-0x007E009E,0x00590076,0x00300042,0x001D0029,0xFFFE000B,0xFFD5FFE8,0xFFC4FFCD,0xFFB0FFC0,
-0xFFA0FFA8,0xFF97FF95,0xFF96FF9A,0xFF90FF8B,0xFF87FF8C,0xFF8BFF80,0xFF92FF89,0xFF92FF96,
-0xFF95FF9B,0xFF9DFFA0,0xFF9DFFA3,0xFFA9FFA1,0xFFB3FFAA,0xFFAFFFA8,0xFFABFFAB,0xFFAFFFAC,
-0xFFB3FFB6,0xFFA8FFB0,0xFFADFFAE,0xFFA3FFAA,0xFF98FFA2,0xFFA0FF9B,0xFF97FF98,0xFF9AFF9F,
-0xFF94FF8F,0xFF8AFF88,0xFF8CFF84,0xFF82FF91,0xFF84FF8C,0xFF8FFF8F,0xFF84FF8C,0xFF96FF83,
-0xFF80FF84,0xFF8CFF8B,0xFF86FF88,0xFF84FF88,0xFF84FF87,0xFF78FF78,0xFF6FFF72,0xFF66FF70,
-0xFF5EFF66,0xFF4BFF58,0xFF41FF44,0xFF3AFF44,0xFF22FF33,0xFF25FF19,0xFF18FF1D,0xFF10FF11,
-0xFF0EFF11,0xFEF6FF01,0xFF01FF00,0xFEF9FEFD,0xFEEAFEF1,0xFEF8FEEB,0xFED5FEEA,0xFEE6FEE8,
-0xFED1FEDC,0xFECBFED6,0xFEC3FEC3,0xFEB4FEBD,0xFEB3FEB1,0xFEA9FEAF,0xFE9EFE9D,0xFE93FE90,
-0xFE94FE9C,0xFE82FE93,0xFE77FE80,0xFE7AFE77,0xFE67FE64,0xFE6CFE63,0xFE62FE61,0xFE5CFE52,
-0xFE55FE53,0xFE5DFE55,0xFE51FE52,0xFE4FFE56,0xFE57FE52,0xFE6CFE5E,0xFE66FE63,0xFE67FE5B,
-0xFE78FE6F,0xFE83FE84,0xFE88FE88,0xFE9DFE92,0xFEA9FEA2,0xFEBBFEBF,0xFEDEFED2,0xFEFDFEF7,
-0xFF30FF16,0xFF48FF3E,0xFF6FFF53,0xFF9BFF85,0xFFBFFFB5,0xFFEDFFDB,0x0029000E,0x005B003F,
-0x007D0066,0x00A70089,0x00D800C4,0x010500F3,0x01300121,0x015E0142,0x0182016C,0x01AA0197,
-0x01C301B9,0x01DD01D1,0x01FE01EC,0x0218020A,0x022F022B,0x02510242,0x02670256,0x027D0277,
-0x0294027C,0x02AC029E,0x02C002AA,0x02CC02BD,0x02E902D4,0x02F202E6,0x02FC02EC,0x02FC02F9,
-0x03060300,0x03010300,0x02F702FC,0x02FA02F0,0x02E502E4,0x02BB02D2,0x02AA02A6,0x029802A9,
-0x0275027F,0x024B0260,0x022D023F,0x0207021A,0x01DE01F7,0x01B101CC,0x01830197,0x0156016F,
-0x01330144,0x01160122,0x00F40109,0x00D100E6,0x00AC00B9,0x00860094,0x00710087,0x00660072,
-0x00420051,0x00450048,0x002D0038,0x002B002D,0x00230025,0x00260022,0x001B001C,0x0011000A,
-0x00010003,0x00090003,0xFFFCFFFE,0x00000001,0xFFF0FFF8,0xFFEAFFEE,0xFFD8FFD8,0xFFC8FFCE,
-0xFFB6FFBA,0xFFA1FFAA,0xFF87FF8F,0xFF71FF7E,0xFF5DFF6C,0xFF44FF54,0xFF1DFF2A,0xFF00FF0D,
-0xFED7FEF3,0xFEC0FEC3,0xFE95FEA4,0xFE85FE89,0xFE62FE6B,0xFE43FE4D,0xFE33FE3C,0xFE19FE25,
-0xFE0BFE18,0xFDF7FE05,0xFDFAFDF7,0xFDEDFDF5,0xFDFBFDF8,0xFE01FE02,0xFE02FDF7,0xFE22FE14,
-0xFE38FE2F,0xFE48FE3B,0xFE5CFE4E,0xFE78FE65,0xFE8BFE85,0xFEBDFEAA,0xFEDDFED4,0xFEFBFEE9,
-0xFF20FF14,0xFF43FF30,0xFF58FF4E,0xFF77FF63,0xFF8EFF8E,0xFF96FF94,0xFFACFF9D,0xFFCEFFC1,
-0xFFDCFFCB,0xFFDFFFD6,0xFFE3FFE6,0xFFEFFFF4,0xFFF3FFF8,0xFFF3FFF1,0xFFE2FFEA,0xFFDFFFE7,
-0xFFD1FFD9,0xFFCFFFCF,0xFFBFFFBE,0xFFB7FFB3,0xFFA1FFA9,0xFF9CFF9E,0xFF92FF9A,0xFF83FF90,
-0xFF78FF8E,0xFF7BFF7A,0xFF81FF85,0xFF8EFF97,0xFF8FFF9D,0xFFA7FFA5,0xFFB4FFA9,0xFFC2FFBA,
-0xFFBFFFBF,0xFFD3FFCD,0xFFDBFFD3,0xFFE3FFEA,0xFFECFFE4,0xFFEDFFEB,0xFFFEFFEA,0xFFF7FFF7,
-0xFFF0FFF2,0xFFF6FFFB,0xFFE4FFF0,0xFFE2FFE8,0xFFDDFFDD,0xFFE4FFDC,0xFFE1FFE0,0xFFE5FFDB,
-0xFFF0FFE4,0xFFF4FFF2,0xFFF4FFE9,0xFFFFFFFA,0x000D000C,0x0019001A,0x002A0026,0x003C0040,
-0x0057004A,0x006C005D,0x008D007A,0x009C008B,0x00A5009E,0x00C000AC,0x00BB00B7,0x00CC00C6,
-0x00D800CA,0x00CF00CE,0x00DE00E4,0x00D000D9,0x00D300D1,0x00D700CC,0x00C400D5,0x00C000C3,
-0x00C000BF,0x00BA00C3,0x00A600AB,0x009F00A5,0x009C009E,0x008C0094,0x0089008C,0x0087008B,
-0x007C0089,0x0063006F,0x0071006D,0x00670064,0x0066005F,0x0057005E,0x0053005A,0x003E0049,
-0x00490047,0x00440046,0x0045003E,0x00490046,0x00450044,0x004D0043,0x004C004C,0x00450046,
-0x00470041,0x004B003B,0x003E003D,0x00350035,0x003C0037,0x00310034,0x002B0036,0x00260021,
-0x00210019,0x00100016,0x0006000B,0xFFEDFFFF,0xFFDBFFE0,0xFFCFFFCD,0xFFC2FFC4,0xFFA4FFAD,
-0xFF8DFF98,0xFF7CFF8A,0xFF67FF7B,0xFF58FF5F,0xFF51FF57,0xFF31FF42,0xFF2AFF32,0xFF1FFF2B,
-0xFF18FF23,0xFF0CFF0D,0xFF06FF0B,0xFF02FF03,0xFF01FF05,0xFEF4FEFF,0xFF00FEF4,0xFEFDFF02,
-0xFF0CFF03,0xFF0DFF09,0xFF20FF1A,0xFF32FF25,0xFF4CFF41,0xFF5EFF4D,0xFF73FF6C,0xFF96FF81,
-0xFFB3FFAD,0xFFCDFFBF,0xFFEFFFE0,0x00070000,0x00260022,0x00440037,0x006B0058,0x007A0072,
-0x008A0083,0x009B0098,0x00A500A0,0x00B600AA,0x00BD00B9,0x00B900B5,0x00C800BC,0x00C800C5,
-0x00B900BA,0x00C100B5,0x00A300B1,0x00A500AA,0x00A100A4,0x00970097,0x00940092,0x00830084,
-0x0078007F,0x006A0078,0x006B0077,0x0069006F,0x00670062,0x005D0061,0x004D0057,0x004B0051,
-0x003C0042,0x00330035,0x002B002D,0x000E001C,0xFFF20002,0xFFEDFFF1,0xFFE0FFE4,0xFFD7FFDD,
-0xFFD9FFD5,0xFFD8FFD8,0xFFD6FFD7,0xFFDCFFD7,0xFFE6FFD7,0xFFF4FFEA,0x0006FFFD,0x00170013,
-0x00270017,0x005E0042,0x00720069,0x008E007E,0x00A70097,0x00C100B6,0x00D300C3,0x00F300EA,
-0x00FD00FF,0x00FA0104,0x010C00FC,0x01080119,0x01020106,0x00F70101,0x00F000F3,0x00D000E1,
-0x00BD00C4,0x00A300B3,0x008A009B,0x007B008C,0x00690073,0x004B0058,0x00370040,0x0021002F,
-0x0017001A,0x0000000B,0xFFE5FFED,0xFFE2FFE0,0xFFCEFFD0,0xFFC3FFCC,0xFFB6FFC2,0xFFB3FFB4,
-0xFFA6FFA8,0xFFA7FFA8,0xFF9AFF9D,0xFF9EFF9E,0xFF96FF9F,0xFFA0FF97,0xFF9BFFA2,0xFF9FFF9F,
-0xFFA0FFA2,0xFFA8FF9F,0xFFA5FFA3,0xFFA3FFAC,0xFFB3FFB4,0xFFB5FFB2,0xFFC3FFB5,0xFFBCFFB8,
-0xFFBEFFBC,0xFFC5FFC1,0xFFC7FFC1,0xFFCBFFCA,0xFFD0FFCA,0xFFC7FFC4,0xFFC5FFCF,0xFFCCFFC8,
-0xFFC7FFC1,0xFFCDFFCB,0xFFCCFFD1,0xFFCDFFC9,0xFFD5FFCC,0xFFD0FFD4,0xFFE6FFCD,0xFFF3FFE9,
-0xFFFEFFEC,0x000EFFFC,0x0010000C,0x002F001D,0x00450035,0x004F0040,0x006F0053,0x006F0071,
-0x007C0074,0x009A0094,0x00B900AE,0x00C800BF,0x00E400CF,0x00ED00E4,0x00F700FB,0x01040100,
-0x01190112,0x0117011A,0x01230121,0x01230120,0x012A011E,0x01270137,0x011E0124,0x0120011E,
-0x010C0112,0x00FC010B,0x00E300EC,0x00C600D4,0x00AC00B2,0x009A009E,0x0063007A,0x0043005D,
-0x00240037,0x00020013,0xFFE3FFEF,0xFFB9FFD2,0xFF97FFA8,0xFF85FF93,0xFF6AFF72,0xFF47FF5A,
-0xFF41FF45,0xFF2AFF3B,0xFF1FFF29,0xFF16FF21,0xFF06FF0E,0xFF02FEF9,0xFEEEFEF5,0xFEF0FEEE,
-0xFEF6FEF7,0xFEEAFEF3,0xFEE5FEE1,0xFED9FEDA,0xFEC8FECE,0xFEBCFEC7,0xFE9EFEAD,0xFE9AFE9F,
-0xFE81FE94,0xFE66FE73,0xFE5EFE5F,0xFE3DFE50,0xFE2EFE41,0xFE20FE22,0xFE0AFE1D,0xFE05FE0B,
-0xFDFCFE0E,0xFDFEFDF9,0xFE02FE04,0xFE0BFDFB,0xFE1BFE15,0xFE2BFE1B,0xFE47FE32,0xFE68FE52,
-0xFE7EFE69,0xFE96FE89,0xFEBFFEB2,0xFEDAFECF,0xFF09FEF2,0xFF35FF27,0xFF51FF48,0xFF82FF69,
-0xFFA1FF8C,0xFFBCFFA7,0xFFD9FFC9,0x0009FFF2,0x00130008,0x00360024,0x00460038,0x005C0049,
-0x006D0060,0x00750070,0x008B0089,0x00970094,0x00AA00A7,0x00A800A7,0x00A200A4,0x00AC009F,
-0x00AB00B4,0x009700A5,0x009A00A2,0x00A000A6,0x00850098,0x007C007C,0x006C0072,0x005D006B,
-0x00510055,0x003F0043,0x003F003F,0x003A0041,0x00330030,0x0033002A,0x0038002F,0x002E0032,
-0x002A002A,0x0039002D,0x00400038,0x00470044,0x00560052,0x0060005D,0x006C0062,0x00750072,
-0x008C007B,0x00940092,0x00AE0099,0x00B300A9,0x00C900BF,0x00E300D9,0x00F400E3,0x00F500F8,
-0x010F00FF,0x0118011C,0x01270120,0x013C0135,0x01400141,0x014C014D,0x01530159,0x0164015E,
-0x016C0170,0x01640167,0x0157015C,0x0159015D,0x015C0157,0x014E014F,0x014B014D,0x01400148,
-0x0133013D,0x01310131,0x012B0130,0x01250125,0x012A0125,0x01230125,0x011E011C,0x01210127,
-0x012A0124,0x0128012F,0x012D0125,0x01290129,0x0129012A,0x01280122,0x0120012B,0x010D011C,
-0x00FB0109,0x00F100F2,0x00E800DD,0x00C500E0,0x00AF00BA,0x0083008B,0x005B006D,0x003C0055,
-0x0016002B,0xFFF40003,0xFFD7FFD8,0xFFA4FFC2,0xFF82FF8F,0xFF59FF71,0xFF36FF47,0xFF19FF26,
-0xFEFFFF17,0xFEEAFEF9,0xFEC3FED8,0xFEACFEB7,0xFE8FFEA0,0xFE7FFE89,0xFE67FE78,0xFE40FE50,
-0xFE26FE31,0xFE14FE1F,0xFDF5FE07,0xFDDAFDEE,0xFDC2FDD1,0xFDA8FDB0,0xFD95FD9E,0xFD7EFD81,
-0xFD6BFD77,0xFD63FD5F,0xFD5DFD5E,0xFD54FD4C,0xFD5CFD49,0xFD54FD52,0xFD56FD53,0xFD66FD5B,
-0xFD79FD6D,0xFD8AFD7E,0xFDA5FD92,0xFDBEFDA9,0xFDC9FDBB,0xFDECFDE5,0xFDFAFDF4,0xFE1DFE0C,
-0xFE42FE2C,0xFE67FE54,0xFE74FE68,0xFEA5FE8C,0xFEC1FEAC,0xFEDFFED6,0xFEFFFEF2,0xFF22FF13,
-0xFF44FF38,0xFF65FF50,0xFF88FF71,0xFFB5FF9C,0xFFD6FFCA,0xFFFEFFE7,0x0022000C,0x004E0038,
-0x007B0068,0x00A7009C,0x00D700C2,0x010300EE,0x013A0128,0x016A0150,0x019E018C,0x01CC01BB,
-0x01FD01EC,0x022A021B,0x024C023A,0x027C0264,0x029C0296,0x02B002AB,0x02CF02C1,0x02DC02D3,
-0x02DE02E1,0x02E702EF,0x02E202E8,0x02E702E7,0x02CE02DF,0x02B702CC,0x02AA02B4,0x0297029D,
-0x026F0284,0x025A025C,0x02380250,0x021F0224,0x01F7020C,0x01E201EB,0x01BB01D1,0x01A501AE,
-0x01810189,0x01640177,0x013C0152,0x013E0140,0x011B012F,0x01090113,0x0100010D,0x00E200EE,
-0x00D300DC,0x00C600C9,0x00B000B6,0x00A800A4,0x0088009A,0x0081008F,0x006B0072,0x005F0062,
-0x00520058,0x003F0046,0x002D0032,0x002E0027,0x001B001F,0x000F000A,0x0010000D,0x0004000B,
-0xFFF8FFFE,0xFFE5FFF9,0xFFF1FFEC,0xFFEBFFE9,0xFFE5FFEA,0xFFDCFFE9,0xFFD2FFE8,0xFFCAFFD2,
-0xFFCAFFC4,0xFFC0FFC2,0xFFBCFFB6,0xFFA0FFAF,0xFF9AFFA0,0xFF99FF91,0xFF8EFF8E,0xFF8AFF8E,
-0xFF77FF7D,0xFF84FF7F,0xFF82FF7E,0xFF8EFF81,0xFF8CFF86,0xFFA3FFA0,0xFFAFFFAC,0xFFC2FFBC,
-0xFFE3FFD6,0xFFF8FFF5,0x00150007,0x00230023,0x0045003B,0x005E0056,0x00780074,0x008B008B,
-0x009E0098,0x00AD00A0,0x00B300AD,0x00B000B4,0x009F00A6,0x009B00AB,0x0083008F,0x0078007D,
-0x005B006A,0x0038004A,0x000F0022,0xFFEAFFFD,0xFFD0FFEC,0xFFA0FFC0,0xFF76FF8E,0xFF50FF66,
-0xFF2FFF42,0xFF12FF20,0xFEF1FF01,0xFECFFEDE,0xFEB9FEC4,0xFE95FEAD,0xFE7BFE89,0xFE77FE78,
-0xFE5EFE6B,0xFE4CFE5C,0xFE3CFE41,0xFE3AFE3F,0xFE35FE33,0xFE2BFE2E,0xFE2AFE26,0xFE20FE1F,
-0xFE16FE17,0xFE1BFE1A,0xFE23FE20,0xFE26FE20,0xFE14FE18,0xFE16FE18,0xFE0FFE13,0xFE14FE12,
-0xFE11FE01,0xFE12FE13,0xFE09FE0E,0xFE10FE0D,0xFE10FE0D,0xFE08FE0E,0xFE0AFE13,0xFE11FE0C,
-0xFE13FE10,0xFE1CFE1B,0xFE2AFE2A,0xFE37FE30,0xFE48FE37,0xFE65FE53,0xFE77FE6A,0xFE8EFE7B,
-0xFEBAFEA3,0xFED2FEC8,0xFEF6FEE1,0xFF10FF02,0xFF34FF27,0xFF67FF53,0xFF96FF84,0xFFC8FFB0,
-0xFFFCFFDF,0x0036001E,0x0068004D,0x0090007C,0x00CF00B2,0x00F900EA,0x012D0119,0x01740153,
-0x01A10192,0x01D701B5,0x020601E4,0x02470228,0x026A0253,0x029F0285,0x02C202AF,0x02E302D2,
-0x030402ED,0x031B030E,0x0337032B,0x03360335,0x03480340,0x03490352,0x0339034B,0x03300335,
-0x031D032F,0x02FD030E,0x02E402F3,0x02C302D1,0x029202AF,0x02630289,0x0237024A,0x020A0216,
-0x01CC01E4,0x019901B0,0x015D0175,0x01320145,0x0109011D,0x00D700EA,0x009E00BA,0x006A0085,
-0x003D0052,0x0022002D,0xFFED0003,0xFFC6FFE4,0xFFA6FFBD,0xFF6CFF95,0xFF46FF5D,0xFF1FFF32,
-0xFEFAFF0E,0xFED7FEE7,0xFEACFEC2,0xFE8CFE9C,0xFE65FE7D,0xFE50FE57,0xFE3BFE49,0xFE1FFE2E,
-0xFE12FE13,0xFE11FE14,0xFE08FE06,0xFE04FE09,0xFDF5FE04,0xFDFAFDF5,0xFE11FE11,0xFE14FE18,
-0xFE27FE1D,0xFE2FFE32,0xFE40FE3C,0xFE5BFE4B,0xFE6DFE62,0xFE84FE71,0xFE9EFE8F,0xFEBFFEB0,
-0xFECEFECA,0xFEECFEE2,0xFF05FEF4,0xFF28FF10,0xFF38FF2E,0xFF4EFF44,0xFF73FF5D,0xFF85FF73,
-0xFF95FF86,0xFFB8FFA0,0xFFC5FFBD,0xFFD0FFD7,0xFFEEFFE9,0x0010000A,0x00210018,0x0037002B,
-0x00530041,0x0065005F,0x0078006F,0x00890080,0x009B0092,0x00A7009E,0x00BF00B9,0x00C300C3,
-0x00C000C0,0x00BE00C2,0x00BD00BD,0x00B300BD,0x00B100B3,0x009C00A7,0x0085008E,0x00770082,
-0x005C006B,0x0035004A,0x00150024,0xFFECFFFF,0xFFCBFFDE,0xFFA6FFBF,0xFF7EFF8E,0xFF61FF6E,
-0xFF40FF55,0xFF1EFF26,0xFF07FF17,0xFEF4FF0C,0xFEE1FEE9,0xFEDBFEE1,0xFEE1FEDD,0xFED5FED5,
-0xFEDAFEDE,0xFEE4FEDE,0xFEF0FEED,0xFEF9FEF1,0xFF14FEFD,0xFF1DFF1E,0xFF2EFF29,0xFF49FF41,
-0xFF54FF56,0xFF6CFF69,0xFF8FFF7B,0xFF90FF89,0xFFABFFA2,0xFFBDFFB4,0xFFC9FFC0,0xFFE2FFDC,
-0xFFFBFFEC,0x000F0008,0x002B0016,0x00440039,0x00630059,0x007D0070,0x00AA008D,0x00CE00BE,
-0x00F400E1,0x0136011C,0x01610147,0x01970181,0x01CC01AE,0x021001ED,0x0247022B,0x027D025A,
-0x02B7028E,0x02CD02B5,0x02EE02D9,0x031102F8,0x0328031F,0x033E0331,0x033F033C,0x03420342,
-0x03470347,0x033B0341,0x03230337,0x031B031E,0x02FC0308,0x02E102E4,0x02CD02D2,0x02A602B5,
-0x02770285,0x02490257,0x021A022F,0x01EC0201,0x01B201CF,0x017A018D,0x01390158,0x00ED010E,
-0x00A300D3,0x005C0089,0x0016003D,0xFFC6FFEC,0xFF80FFA3,0xFF31FF57,0xFEFCFF16,0xFEB1FED6,
-0xFE77FE91,0xFE40FE54,0xFE10FE26,0xFDDFFDF1,0xFDB8FDC1,0xFD9CFDA3,0xFD80FD93,0xFD72FD7C,
-0xFD5DFD69,0xFD59FD66,0xFD66FD65,0xFD64FD69,0xFD6BFD64,0xFD7CFD6F,0xFD8BFD81,0xFD92FD89,
-0xFDA8FD9A,0xFDA9FDAC,0xFDB2FDB3,0xFDBFFDC2,0xFDCEFDD7,0xFDDFFDD6,0xFDE5FDDF,0xFDF5FDE6,
-0xFDF9FDF4,0xFE0AFDFD,0xFE0CFE06,0xFE10FE0F,0xFE17FE14,0xFE2FFE2A,0xFE45FE33,0xFE5CFE49,
-0xFE74FE69,0xFE94FE81,0xFEADFE98,0xFEDBFEBF,0xFEFEFEE5,0xFF33FF1A,0xFF67FF49,0xFF97FF7F,
-0xFFD4FFB3,0x0003FFF4,0x00440027,0x007F0060,0x00AC0093,0x00E100C9,0x010F00F4,0x0136011D,
-0x01690151,0x018B0186,0x01B3019C,0x01CB01BF,0x01E501DA,0x01F801EB,0x020C0205,0x0217021D,
-0x022C0222,0x022B022D,0x022E0227,0x02320235,0x0225022E,0x02260226,0x021F021D,0x02070211,
-0x02060202,0x02000205,0x01F401FB,0x01DE01ED,0x01CC01DB,0x01BE01CC,0x01A401B2,0x01800194,
-0x01690177,0x0148015C,0x01230134,0x00FC0111,0x00E100EC,0x00B400C3,0x008E00A5,0x00630071,
-0x00340049,0x000F0016,0xFFE2FFFC,0xFFA6FFC3,0xFF8EFF97,0xFF63FF7C,0xFF43FF5C,0xFF2FFF3B,
-0xFF17FF22,0xFEF2FF02,0xFED7FEE3,0xFECAFED4,0xFEB6FEBD,0xFEB4FEB1,0xFEA3FEAA,0xFE9DFE9A,
-0xFE8DFE90,0xFE90FE92,0xFE91FE99,0xFE8AFE8B,0xFE93FE88,0xFE86FE86,0xFE8CFE87,0xFE85FE8F,
-0xFE91FE85,0xFEA0FE93,0xFE9FFEA3,0xFEB3FEAE,0xFEB9FEB6,0xFEC7FEBD,0xFEEBFEDB,0xFEF9FEE9,
-0xFF18FF0E,0xFF35FF23,0xFF61FF4B,0xFF84FF6C,0xFFA1FF99,0xFFCBFFBC,0xFFF0FFDE,0x00220005,
-0x00440032,0x0059004D,0x00870075,0x00AA009F,0x00C900C1,0x00DD00D4,0x00FB00F2,0x010F0106,
-0x0130011B,0x0140013C,0x0148014A,0x0157014E,0x015F0151,0x01750168,0x016E0176,0x01800176,
-0x0182018E,0x01890180,0x0180018F,0x01830184,0x018F018C,0x018B0190,0x01870183,0x01820188,
-0x017E0183,0x0178017C,0x01610178,0x015C015E,0x014A014F,0x012D0140,0x011C012C,0x010B011C,
-0x00F00104,0x00D500ED,0x00BC00C6,0x00A300B4,0x00760096,0x00550064,0x0043004C,0x000C0022,
-0xFFF3FFF2,0xFFD5FFDF,0xFFADFFC6,0xFF88FF9A,0xFF6BFF78,0xFF4AFF60,0xFF2BFF3F,0xFF10FF25,
-0xFEFFFEFD,0xFEE1FEEB,0xFED0FED4,0xFEB5FEC6,0xFEA6FEAE,0xFE9AFE9B,0xFE7CFE8C,0xFE7BFE79,
-0xFE75FE75,0xFE6CFE6F,0xFE5AFE63,0xFE5AFE64,0xFE5FFE63,0xFE57FE5F,0xFE62FE60,0xFE66FE6C,
-0xFE6BFE68,0xFE68FE63,0xFE73FE66,0xFE83FE77,0xFE8EFE86,0xFE97FE8F,0xFEABFE9F,0xFEB7FEB1,
-0xFEC9FEC3,0xFEE1FED3,0xFF12FEF6,0xFF22FF13,0xFF49FF3B,0xFF76FF61,0xFF98FF8B,0xFFC5FFAD,
-0xFFFBFFDD,0x001F000B,0x00460030,0x007B0066,0x009C008E,0x00C500AE,0x00E500D5,0x00F500F3,
-0x011500FF,0x011E0112,0x011E0120,0x011B0120,0x01210120,0x0113011F,0x01000110,0x00EA00F4,
-0x00D700E0,0x00B400C9,0x009500AA,0x00730082,0x004D006B,0x00350045,0x001B0027,0xFFF8000B,
-0xFFDAFFE8,0xFFCAFFD2,0xFFB2FFBC,0xFF9CFFA1,0xFF78FF83,0xFF65FF73,0xFF5AFF61,0xFF4CFF52,
-0xFF2DFF34,0xFF22FF2B,0xFF0DFF19,0xFF07FF08,0xFF02FF04,0xFEFAFEF6,0xFEEBFEF5,0xFEEFFEE6,
-0xFEE8FEEC,0xFEEDFEE9,0xFEE4FEEA,0xFEE1FED7,0xFEE7FEE5,0xFEF0FEF1,0xFEF4FEED,0xFEF3FEF5,
-0xFEF6FEF4,0xFEFCFEFE,0xFF03FEFE,0xFF02FEFD,0xFF0EFF08,0xFF1AFF15,0xFF2DFF21,0xFF36FF36,
-0xFF52FF41,0xFF63FF61,0xFF77FF6B,0xFF90FF80,0xFF9CFF92,0xFFBCFFA7,0xFFD7FFC8,0xFFFDFFEA,
-0x000C000D,0x00240019,0x004D0038,0x00760057,0x00890080,0x00A5009C,0x00D500BD,0x00F200E8,
-0x011A0107,0x013C0133,0x0167014C,0x01860178,0x01AD019E,0x01D001C4,0x01EF01E7,0x020B01FE,
-0x02210215,0x023A022A,0x024E0243,0x025F025C,0x0272026C,0x027F0275,0x027D0280,0x02810279,
-0x027E0284,0x027A027D,0x02690271,0x02540262,0x0240024D,0x02280238,0x02030219,0x01F20201,
-0x01C201D9,0x01A701B1,0x017F018C,0x015E0164,0x01360142,0x00FF0108,0x00E300F1,0x00B200D0,
-0x009300AC,0x00710085,0x00490065,0x00240039,0x00030018,0xFFDCFFEE,0xFFB8FFCA,0xFF9DFF98,
-0xFF6DFF7B,0xFF45FF5B,0xFF1BFF3B,0xFEF5FF10,0xFED1FEE2,0xFEAEFEC2,0xFE80FE9D,0xFE53FE69,
-0xFE34FE48,0xFE0CFE29,0xFDF4FE07,0xFDD2FDE6,0xFDB2FDC2,0xFDAEFDAA,0xFD9BFDA1,0xFD92FD93,
-0xFD92FD82,0xFD91FD8F,0xFD90FD8C,0xFD9AFD99,0xFDB1FDAB,0xFDCAFDBE,0xFDDEFDD5,0xFDFFFDE1,
-0xFE15FE0E,0xFE2DFE24,0xFE54FE42,0xFE73FE61,0xFE8CFE7A,0xFEAEFEA6,0xFED0FEC4,0xFEE8FEDD,
-0xFF0BFEF7,0xFF20FF14,0xFF41FF35,0xFF5FFF49,0xFF71FF63,0xFF92FF89,0xFFA7FF9B,0xFFC6FFBA,
-0xFFD8FFD2,0xFFF6FFEE,0x0005FFFE,0x00260015,0x00430035,0x0057004D,0x006C0069,0x0085007C,
-0x009A0099,0x00A40095,0x00B900AA,0x00C200B6,0x00CE00C1,0x00D700D0,0x00D400D3,0x00D900DC,
-0x00E200E1,0x00E200E3,0x00DB00DE,0x00E100E5,0x00E300E5,0x00DE00DB,0x00DC00E5,0x00DB00D8,
-0x00DA00D9,0x00D700DC,0x00DB00E3,0x00CE00D8,0x00CE00CC,0x00D000CE,0x00D400D2,0x00CF00D2,
-0x00C500C5,0x00BC00C4,0x00C300C3,0x00B000B9,0x00A500B2,0x009B00A3,0x0092009E,0x00890099,
-0x00860087,0x00740078,0x00670074,0x0056005C,0x004A004C,0x00400044,0x00270032,0x0023002B,
-0x000E0015,0x00030002,0x00020006,0xFFEAFFF1,0xFFF0FFEE,0xFFE8FFF3,0xFFE6FFE5,0xFFDFFFE2,
-0xFFE9FFE1,0xFFF2FFEE,0xFFF3FFF8,0x00040000,0x0013000C,0x001E0015,0x00300025,0x003D0033,
-0x00580049,0x0068005D,0x0081006E,0x008E0086,0x009F0098,0x00C000A8,0x00D100BF,0x00D300D3,
-0x00EC00E1,0x00EC00F1,0x010000EE,0x010000FB,0x01010103,0x010B0105,0x01070109,0x010A0112,
-0x010F0109,0x0110010C,0x0106010C,0x01070108,0x01060104,0x01040101,0x01070101,0x010D0101,
-0x01070106,0x010A010D,0x01060108,0x010F010E,0x01040109,0x01040104,0x00EF0100,0x00E700E8,
-0x00E000E1,0x00CB00D1,0x00B400C9,0x009E00AF,0x0090008F,0x006B007D,0x005B006B,0x00440055,
-0x00330037,0x0023002B,0x0016001A,0x0005000F,0x0001FFFE,0x0001FFFE,0xFFF3FFFE,0xFFECFFF4,
-0xFFE4FFED,0xFFEDFFEA,0xFFE8FFE7,0xFFEDFFE0,0xFFEBFFEE,0xFFE4FFE1,0xFFDBFFDC,0xFFCFFFD7,
-0xFFCDFFD1,0xFFB1FFC5,0xFF9EFFB4,0xFF86FF98,0xFF70FF87,0xFF60FF6F,0xFF4AFF59,0xFF32FF3E,
-0xFF1AFF26,0xFEF4FF05,0xFEE3FEF3,0xFECCFEDD,0xFEC5FECD,0xFEABFEB1,0xFE9BFE9D,0xFE8FFE8D,
-0xFE80FE7B,0xFE65FE6C,0xFE53FE59,0xFE46FE53,0xFE3DFE47,0xFE3FFE48,0xFE3DFE42,0xFE39FE39,
-0xFE2CFE33,0xFE2FFE2B,0xFE2CFE26,0xFE2DFE26,0xFE26FE2C,0xFE28FE24,0xFE26FE28,0xFE2EFE2C,
-0xFE2FFE32,0xFE29FE35,0xFE3DFE3A,0xFE49FE43,0xFE4DFE45,0xFE58FE4F,0xFE6DFE5E,0xFE85FE7C,
-0xFE87FE82,0xFEA7FE94,0xFEC0FEB1,0xFED5FECF,0xFEFEFEEF,0xFF15FF10,0xFF44FF26,0xFF66FF56,
-0xFF8EFF77,0xFFAEFF9B,0xFFCDFFBC,0x0005FFED,0x00210013,0x004E0036,0x007D0069,0x0097008C,
-0x00BC00AD,0x00DB00CC,0x010700F3,0x0125011D,0x01540135,0x01740160,0x018A0182,0x01A1019F,
-0x01C201AF,0x01D201D1,0x01E001D9,0x01FB01FC,0x01FF0201,0x020F0209,0x02240215,0x0229022D,
-0x022A0222,0x0221022B,0x021E0223,0x022B0225,0x021A0222,0x021A0217,0x02090209,0x020001FD,
-0x01E601EF,0x01D101D9,0x01B001BE,0x019801A9,0x017E0190,0x01570175,0x0139014C,0x01170130,
-0x00F90106,0x00D300E0,0x00C100C5,0x009800AF,0x0082008E,0x00660070,0x00580057,0x00470045,
-0x0033003C,0x0021002B,0x00130021,0x00080010,0xFFFB000C,0xFFF0FFF5,0xFFE4FFE8,0xFFD5FFE2,
-0xFFC4FFCF,0xFFA5FFB5,0xFF90FFA3,0xFF7CFF91,0xFF5BFF70,0xFF44FF4E,0xFF20FF35,0xFF07FF17,
-0xFEE0FEF1,0xFEC4FED6,0xFEA5FEBD,0xFE91FE99,0xFE73FE7D,0xFE6BFE70,0xFE45FE53,0xFE3CFE43,
-0xFE39FE38,0xFE2CFE31,0xFE2EFE24,0xFE30FE33,0xFE32FE2F,0xFE3DFE42,0xFE54FE4C,0xFE5DFE5F,
-0xFE72FE71,0xFE80FE82,0xFE89FE8A,0xFE9FFE99,0xFEBBFEAF,0xFEC4FEBC,0xFEDBFED2,0xFEEDFEEE,
-0xFEF4FEFC,0xFF0DFEFF,0xFF1AFF13,0xFF2CFF26,0xFF3DFF3C,0xFF41FF45,0xFF4CFF46,0xFF5BFF56,
-0xFF65FF5F,0xFF72FF6C,0xFF76FF71,0xFF83FF7F,0xFF81FF82,0xFF8BFF85,0xFF8DFF98,0xFF9EFF9C,
-0xFFA9FFA4,0xFFB2FFA9,0xFFB4FFB8,0xFFC4FFB8,0xFFCCFFC8,0xFFD2FFD3,0xFFD0FFCD,0xFFE6FFDD,
-0xFFEAFFE9,0xFFEEFFF3,0xFFF8FFF9,0x0009FFFC,0x00110014,0x000D0012,0x001D001D,0x002F0021,
-0x00310030,0x00380031,0x003C0038,0x005F0046,0x005B005B,0x00640063,0x006D0067,0x007C0072,
-0x00800080,0x008E0089,0x009F0093,0x00A800A2,0x00AB00AC,0x00B400AD,0x00BD00B7,0x00C800BF,
-0x00C700D0,0x00C800CA,0x00C300C8,0x00C600C6,0x00B700BF,0x00BA00B5,0x00A900B9,0x00A500AD,
-0x009600A3,0x008E0092,0x0082008C,0x006E007F,0x0062006F,0x005A0068,0x0053005F,0x00440042,
-0x00470043,0x003D0041,0x003A003B,0x00410041,0x003F004A,0x00400040,0x00510047,0x00560058,
-0x0063005D,0x006A0069,0x007F0070,0x008E0082,0x0093008E,0x0095009E,0x009F0095,0x00A400A3,
-0x00A400AA,0x00A600A8,0x00AE00AA,0x00AD00A6,0x00AF00AE,0x00AF00A9,0x00A700AC,0x00A800AD,
-0x00B300AD,0x00A700A9,0x00B700B6,0x00C100BD,0x00C500C2,0x00C300C2,0x00CB00CE,0x00D800D2,
-0x00D800DF,0x00DF00DD,0x00DD00D8,0x00D700D9,0x00CC00D5,0x00CF00D3,0x00C500CB,0x00B800C4,
-0x00A800BA,0x009300A5,0x008B009A,0x006C0082,0x00540067,0x003F004E,0x002A0034,0x001B0020,
-0x00010008,0xFFEDFFF6,0xFFD5FFE2,0xFFBCFFC5,0xFFB1FFB7,0xFF9FFFA0,0xFF8FFF98,0xFF7BFF7E,
-0xFF77FF7E,0xFF78FF70,0xFF6EFF6E,0xFF5CFF5B,0xFF5DFF57,0xFF63FF60,0xFF58FF5D,0xFF5BFF5E,
-0xFF4AFF5A,0xFF49FF4C,0xFF3EFF46,0xFF34FF42,0xFF36FF39,0xFF2BFF31,0xFF34FF2B,0xFF29FF2E,
-0xFF1EFF23,0xFF21FF22,0xFF1FFF26,0xFF23FF26,0xFF35FF2D,0xFF3EFF3A,0xFF4AFF44,0xFF4FFF46,
-0xFF60FF55,0xFF76FF70,0xFF8EFF88,0xFFBAFFB1,0xFFD4FFC7,0xFFF3FFE8,0x00140002,0x0031001E,
-0x004D0043,0x0079005C,0x009D0084,0x00B9009F,0x00D400C3,0x00F300E3,0x00F500F7,0x01170100,
-0x0120011F,0x012C0122,0x012D0131,0x013D013A,0x013B013E,0x013C0137,0x013D0145,0x012F0139,
-0x012E012E,0x01220128,0x01140113,0x00FE0108,0x00EB00FF,0x00F100F6,0x00E400EF,0x00D600E5,
-0x00D400DD,0x00CF00D6,0x00CE00CA,0x00CA00CB,0x00CC00CA,0x00CE00CB,0x00C300C2,0x00B600C1,
-0x00B400B9,0x00AD00B3,0x0094009E,0x007A0086,0x006C0078,0x0063006A,0x00380051,0x0023002F,
-0x00100019,0xFFF1FFFD,0xFFD7FFD6,0xFFB4FFBB,0xFF89FF90,0xFF73FF7D,0xFF55FF69,0xFF43FF4F,
-0xFF24FF31,0xFF11FF1C,0xFF02FF06,0xFEE4FEEA,0xFEC9FEC8,0xFEBFFEC9,0xFE9DFEB1,0xFE8BFE93,
-0xFE7AFE89,0xFE6FFE75,0xFE5BFE6C,0xFE56FE5F,0xFE4BFE51,0xFE44FE48,0xFE37FE43,0xFE42FE38,
-0xFE48FE3C,0xFE46FE46,0xFE56FE47,0xFE5EFE63,0xFE7DFE71,0xFEA3FE92,0xFECAFEB0,0xFEE0FECE,
-0xFF07FEF4,0xFF2EFF18,0xFF5AFF47,0xFF7DFF75,0xFFB3FF9D,0xFFE1FFCF,0x000AFFEF,0x0036001C,
-0x0065004C,0x007F006F,0x009B0085,0x00BC00AA,0x00CB00C7,0x00EF00E0,0x010100FC,0x01060100,
-0x011A0110,0x01200116,0x01190117,0x01270120,0x012A0123,0x0124012A,0x0130012C,0x01310130,
-0x01390138,0x01370138,0x013F013B,0x0149013E,0x0148014B,0x01460143,0x01540152,0x015C014D,
-0x0152014D,0x0151014F,0x014C014D,0x013A0147,0x01390133,0x011D0120,0x01060111,0x00FD0106,
-0x00DE00F0,0x00BF00D4,0x00AD00AC,0x00770095,0x0059006E,0x0040004E,0x00100026,0xFFF20002,
-0xFFCDFFE1,0xFFB6FFC5,0xFF7CFF99,0xFF5FFF74,0xFF3BFF50,0xFF1EFF2C,0xFF01FF15,0xFEE0FEFA,
-0xFECDFED7,0xFEC1FED1,0xFEA7FEB2,0xFE9AFE9C,0xFE96FE9D,0xFE88FE89,0xFE8CFE88,0xFE85FE85,
-0xFE89FE7E,0xFE8CFE82,0xFE86FE82,0xFE96FE8D,0xFE97FE93,0xFEA4FEA1,0xFE98FEA0,0xFEA7FEA1,
-0xFEB1FEAB,0xFEB9FEB1,0xFEC4FEBF,0xFEBCFEBA,0xFECFFEC2,0xFED7FED5,0xFEE8FEDE,0xFEF1FEEB,
-0xFF00FEF8,0xFF0FFF03,0xFF30FF21,0xFF44FF3E,0xFF53FF4A,0xFF64FF5E,0xFF84FF74,0xFF9DFF99,
-0xFFB8FFB1,0xFFC2FFC1,0xFFE2FFD8,0xFFF0FFED,0x000BFFFE,0x001E0012,0x00280023,0x0037002F,
-0x003C003E,0x004D0041,0x00510046,0x0051004B,0x0059005F,0x00580057,0x00590059,0x005A0061,
-0x00640064,0x0066006A,0x00660069,0x006F006B,0x006C0072,0x00650067,0x0069006B,0x0066006B,
-0x005E005D,0x00550060,0x004B004E,0x003B0049,0x002C0033,0x0016001A,0x00060010,0xFFF3FFF9,
-0xFFDCFFE6,0xFFB7FFC4,0xFFB2FFAB,0xFF8EFFA0,0xFF77FF84,0xFF68FF79,0xFF54FF60,0xFF4EFF47,
-0xFF45FF43,0xFF3BFF3C,0xFF38FF37,0xFF30FF38,0xFF2CFF2B,0xFF36FF37,0xFF45FF42,0xFF49FF45,
-0xFF5CFF57,0xFF6DFF68,0xFF7FFF6E,0xFF9EFF86,0xFFAFFFA0,0xFFC3FFBB,0xFFD6FFD0,0xFFEDFFDE,
-0x0002FFF9,0x001C0006,0x00330029,0x004D0040,0x00530053,0x00780064,0x008C008C,0x009D0097,
-0x00BD00B7,0x00D500CB,0x00F100E4,0x010C00F8,0x01270122,0x01470133,0x0159014E,0x01710163,
-0x0186017F,0x019C0190,0x01B001A5,0x01B201B6,0x01C201BC,0x01CC01C9,0x01D301CA,0x01CE01CF,
-0x01D001CB,0x01C201C6,0x01BE01B9,0x01B101AF,0x01A101A6,0x018C018A,0x0178017C,0x01660165,
-0x014C0158,0x012D013B,0x01160120,0x00F40112,0x00D300E0,0x00C000CB,0x00AA00B2,0x009600A1,
-0x00740084,0x005E0063,0x0056004F,0x003B0047,0x0029002A,0x001F0022,0x000F0017,0x00020006,
-0xFFFEFFFE,0xFFEDFFEE,0xFFE8FFE7,0xFFDAFFD9,0xFFD4FFD7,0xFFC7FFC5,0xFFB5FFBB,0xFFACFFA9,
-0xFF9BFFA0,0xFF7EFF8E,0xFF65FF74,0xFF51FF55,0xFF35FF47,0xFF1AFF2A,0xFF02FF0E,0xFEEBFEF1,
-0xFECCFEDB,0xFEB0FEC0,0xFEA8FEAB,0xFE8FFE9D,0xFE84FE8B,0xFE88FE8C,0xFE8BFE82,0xFE7DFE85,
-0xFE84FE7C,0xFE87FE8E,0xFE93FE8A,0xFEA1FE9A,0xFEA9FEA4,0xFEC8FEBC,0xFED6FECF,0xFEEAFED2,
-0xFEF0FEE2,0xFF04FEF1,0xFF0AFF04,0xFF1CFF0F,0xFF34FF29,0xFF38FF3B,0xFF46FF3C,0xFF4EFF45,
-0xFF5FFF52,0xFF6FFF6B,0xFF79FF71,0xFF8BFF7D,0xFF99FF97,0xFFA6FF9E,0xFFB9FFB0,0xFFC4FFC3,
-0xFFD4FFCD,0xFFD7FFD4,0xFFEBFFDA,0xFFF6FFEB,0xFFF6FFF2,0xFFFCFFF6,0x00000008,0x000A0004,
-0x000F0014,0x00160013,0x00100015,0x00100011,0x00190013,0x001D001D,0x001C0023,0x00210018,
-0x001F0018,0x001D001F,0x00220024,0x002B0032,0x002D0030,0x00350034,0x0042003B,0x00530045,
-0x00590056,0x0066005C,0x00730070,0x00880084,0x009D008E,0x00B100A8,0x00BD00B1,0x00C100BE,
-0x00CE00C4,0x00D200CF,0x00DE00D4,0x00DB00D6,0x00DE00D6,0x00D500D7,0x00D400D0,0x00CC00CF,
-0x00C300CA,0x00BE00C5,0x00B300B6,0x00B400BA,0x00A700B1,0x00A800A8,0x009E00A4,0x00A300A7,
-0x00AA00A8,0x00A600A1,0x00A200A5,0x00A600AA,0x00A900A5,0x00AF00B3,0x00B400BB,0x00BE00C5,
-0x00CE00C2,0x00D600DA,0x00DD00E7,0x00ED00EA,0x00F500F2,0x010300EE,0x01110101,0x011A0113,
-0x011A011B,0x0114011B,0x011F0119,0x0120011E,0x011F0125,0x01210128,0x011C0124,0x01240123,
-0x0118011A,0x011F0120,0x01280127,0x012A012C,0x011F012B,0x011F0123,0x011A0121,0x012A0128,
-0x01270123,0x01250125,0x012E0126,0x01380134,0x013C0137,0x012D0130,0x01300135,0x012C012D,
-0x0124012A,0x011A0127,0x010B0119,0x00FA00FF,0x00DD00E6,0x00C600D8,0x00B000C0,0x00890095,
-0x00660070,0x003E004E,0x00190034,0xFFE00002,0xFFB6FFC6,0xFF93FFA4,0xFF6AFF79,0xFF38FF52,
-0xFF0FFF23,0xFEE5FEFC,0xFEB4FECC,0xFE8AFEA2,0xFE5DFE81,0xFE3AFE51,0xFE1EFE32,0xFDFDFE09,
-0xFDCEFDE8,0xFDB4FDC6,0xFD93FDA5,0xFD77FD81,0xFD57FD68,0xFD4BFD4C,0xFD3BFD40,0xFD2BFD2F,
-0xFD09FD1D,0xFD09FD11,0xFD0AFD08,0xFCFEFCFF,0xFD04FCF5,0xFD01FCFE,0xFD10FCFB,0xFD20FD10,
-0xFD2FFD23,0xFD3CFD34,0xFD57FD4E,0xFD75FD6D,0xFD97FD86,0xFDB8FDA5,0xFDDAFDC7,0xFDFFFDF5,
-0xFE1FFE12,0xFE4DFE35,0xFE7AFE6A,0xFE9AFE86,0xFEC7FEAF,0xFEEBFEE3,0xFF16FEFF,0xFF3EFF29,
-0xFF60FF4B,0xFF8FFF77,0xFFB8FFA1,0xFFE3FFC7,0x0004FFEF,0x00290016,0x005A0041,0x0081007C,
-0x00A60098,0x00D400BF,0x010100E8,0x01270117,0x014D0135,0x016E015B,0x01930181,0x01B401A9,
-0x01CC01CA,0x01F201DD,0x02100201,0x0227021B,0x0239022E,0x0241023A,0x024D0241,0x02570249,
-0x0251025F,0x024E0258,0x02500256,0x0247024A,0x02450245,0x0232023E,0x0223022C,0x0217021D,
-0x02080209,0x01E401ED,0x01CA01CC,0x01A901B6,0x0187019A,0x016E0186,0x01500161,0x01290135,
-0x01110121,0x00F80105,0x00D500E1,0x00B700CD,0x009800A8,0x0077008A,0x0068006C,0x005B005D,
-0x00400049,0x00310035,0x001D002D,0x0025001B,0x00100016,0x00090009,0x00010007,0xFFF8FFFC,
-0xFFF5FFF3,0xFFE0FFE5,0xFFD9FFE0,0xFFDBFFD3,0xFFDCFFE8,0xFFD4FFD6,0xFFDBFFD3,0xFFDFFFDD,
-0xFFE1FFDC,0xFFE5FFDB,0xFFF9FFE6,0xFFF9FFEE,0x0007FFF5,0x00100006,0x001F0018,0x00290020,
-0x0035002D,0x003B0037,0x00520042,0x00570056,0x005E0059,0x00680062,0x005C005D,0x0066005F,
-0x005B0064,0x0056005A,0x0044004F,0x00340039,0x00270031,0x00100017,0xFFEFFFF8,0xFFE5FFE4,
-0xFFCAFFD3,0xFFABFFBB,0xFF8CFFA4,0xFF7CFF92,0xFF6DFF7C,0xFF5CFF65,0xFF3BFF49,0xFF21FF2D,
-0xFF16FF1A,0xFF09FF10,0xFEFCFF07,0xFEEEFEF1,0xFEEFFEE7,0xFEE2FEE8,0xFED2FED3,0xFECCFECE,
-0xFEBFFED0,0xFEC0FEC7,0xFEB4FEC1,0xFEAEFEAD,0xFEA5FEAF,0xFE9FFE9B,0xFE8CFE96,0xFE8DFE89,
-0xFE85FE83,0xFE82FE82,0xFE7EFE7D,0xFE73FE70,0xFE72FE71,0xFE71FE69,0xFE73FE6F,0xFE73FE73,
-0xFE72FE79,0xFE7BFE7C,0xFE84FE86,0xFE90FE8E,0xFE99FE94,0xFE9CFE9E,0xFEB2FEA7,0xFEC2FEBB,
-0xFEC3FEC0,0xFED1FECC,0xFEDDFED0,0xFEEFFEE4,0xFEFCFEFE,0xFF0BFF06,0xFF1EFF1D,0xFF31FF2C,
-0xFF39FF3B,0xFF4EFF44,0xFF68FF5C,0xFF7BFF79,0xFF93FF92,0xFFA9FF9A,0xFFBCFFAF,0xFFDAFFC3,
-0xFFE6FFEB,0x0004FFFC,0x00190011,0x003A002C,0x004F0042,0x0066005E,0x00770078,0x00960090,
-0x00B100AC,0x00C000C0,0x00DA00D4,0x00F100E2,0x010E00F9,0x01200117,0x01360128,0x013F013B,
-0x01560146,0x015E0158,0x0169015C,0x0178016F,0x01820186,0x0180018B,0x01890187,0x018A018E,
-0x018F018B,0x018D0186,0x018A0185,0x01830181,0x017A0177,0x0173016F,0x01660168,0x016B0167,
-0x01610171,0x01610163,0x01550156,0x01460149,0x0141014A,0x013F0148,0x012D0138,0x011D012F,
-0x0102011A,0x00E400FA,0x00D500E6,0x00C500CE,0x009D00AD,0x00810089,0x005D0067,0x0040004F,
-0x00210033,0x00040018,0xFFE6FFF3,0xFFD3FFDE,0xFFBDFFC9,0xFFA7FFAD,0xFF9EFFA3,0xFF92FF9D,
-0xFF93FF96,0xFF8CFF8D,0xFF8CFF87,0xFF89FF85,0xFF9BFF8C,0xFFA1FF9A,0xFFA3FF9D,0xFFB0FFA8,
-0xFFBDFFBE,0xFFBCFFC1,0xFFCDFFCB,0xFFD4FFD7,0xFFD8FFD8,0xFFD8FFD7,0xFFCDFFD1,0xFFD0FFCB,
-0xFFD1FFD6,0xFFC7FFCD,0xFFB7FFC0,0xFFB1FFBA,0xFFA7FFAD,0xFFA2FF9E,0xFF94FF99,0xFF8EFF92,
-0xFF90FF8F,0xFF7FFF8D,0xFF8BFF87,0xFF84FF86,0xFF80FF84,0xFF8DFF8E,0xFF82FF81,0xFF85FF7F,
-0xFF90FF86,0xFF97FF92,0xFF9CFF9F,0xFF98FFA4,0xFFA6FFA3,0xFFA5FFA1,0xFFB0FFAC,0xFFACFFB3,
-0xFFB3FFAE,0xFFBDFFB7,0xFFC2FFBA,0xFFCEFFC3,0xFFD3FFCD,0xFFD7FFD8,0xFFE6FFDB,0xFFF0FFED,
-0xFFF2FFEB,0x0009FFF9,0x000F000C,0x00180016,0x00220025,0x0024002C,0x00330031,0x004C0049,
-0x00470047,0x00490040,0x00490044,0x004B0048,0x00500052,0x0046004A,0x00430046,0x00480037,
-0x003E003F,0x0038003F,0x00380039,0x003A0035,0x002E0033,0x002A002B,0x0032002B,0x00210024,
-0x001D0020,0x0019001A,0x0018001D,0x0014001A,0x00160013,0x0017000A,0x0016000D,0x000C0013,
-0x000D0007,0x00120007,0x00260013,0x0024001B,0x002A0024,0x00330029,0x0040003C,0x003E003E,
-0x00420046,0x00530050,0x005C005B,0x0061005C,0x006C006E,0x007A006F,0x00740075,0x00780070,
-0x00760072,0x0078007D,0x00750077,0x0078007A,0x007A0079,0x007B0080,0x0072007C,0x00820071,
-0x007A007B,0x006F0075,0x00750078,0x007E0088,0x007D0082,0x0081007B,0x007D007E,0x007C007E,
-0x008E0083,0x008D0086,0x00830089,0x00840082,0x007C0081,0x007E007F,0x007C0089,0x0071007A,
-0x006C0078,0x00610069,0x005B0056,0x00450053,0x00390036,0x002E0032,0x001E001D,0x0010001D,
-0x00120019,0x0000000D,0x0005FFFD,0xFFF90002,0xFFF2FFF8,0xFFF6FFFC,0xFFF9FFF8,0x0000FFF6,
-0x00070004,0x00070006,0x00110008,0x0010000E,0x000D000E,0x001A0014,0x001D001D,0x001B0018,
-0x000F0010,0x000A0011,0x0002000C,0xFFFA0004,0x00020003,0xFFF3FFF8,0xFFDEFFE6,0xFFD1FFD1,
-0xFFC4FFCE,0xFFBCFFBE,0xFFB2FFB5,0xFFA6FFAE,0xFF9FFFA7,0xFFA2FFA8,0xFF9BFFA1,0xFFA0FF96,
-0xFF98FF95,0xFF92FF95,0xFF90FF96,0xFF95FF93,0xFF90FF90,0xFF9FFF94,0xFF96FF95,0xFF9AFF99,
-0xFF9EFF98,0xFF95FF98,0xFF92FF91,0xFF8CFF98,0xFF91FF8F,0xFF8DFF86,0xFF88FF81,0xFF81FF8B,
-0xFF80FF82,0xFF83FF81,0xFF84FF7E,0xFF7FFF7D,0xFF7EFF86,0xFF7CFF78,0xFF87FF81,0xFF87FF81,
-0xFF82FF7E,0xFF8DFF85,0xFF8BFF8E,0xFF95FF8A,0xFF95FF96,0xFFA1FFA5,0xFFB9FFAC,0xFFC3FFB9,
-0xFFCBFFBD,0xFFD9FFCD,0xFFEFFFDC,0x0000FFF6,0x0010FFFE,0x00200017,0x00290019,0x0033002D,
-0x00470039,0x00550047,0x00500048,0x00600050,0x006A0069,0x00620068,0x00650060,0x005D0053,
-0x004E0059,0x0041004C,0x0039003E,0x003D0041,0x0026002E,0x0018001A,0x000F0010,0xFFFC0009,
-0xFFF90000,0xFFE0FFEF,0xFFD3FFDE,0xFFCDFFD8,0xFFB9FFBF,0xFFB8FFB9,0xFFB4FFAF,0xFFA4FFAB,
-0xFF91FF97,0xFF8FFF93,0xFF7EFF84,0xFF75FF79,0xFF72FF75,0xFF6FFF76,0xFF6CFF6E,0xFF64FF62,
-0xFF65FF65,0xFF62FF69,0xFF61FF66,0xFF65FF68,0xFF6EFF66,0xFF76FF69,0xFF74FF79,0xFF81FF75,
-0xFF84FF7B,0xFF8AFF8C,0xFF9AFF90,0xFF9BFF99,0xFF9DFF9A,0xFFA6FF9F,0xFFABFFA6,0xFFB4FFB1,
-0xFFB0FFB0,0xFFB6FFB4,0xFFB3FFAC,0xFFAEFFB3,0xFFA9FFA4,0xFFABFFA2,0xFF9FFF9C,0xFF9BFF98,
-0xFF97FF9A,0xFF91FF8D,0xFF8FFF89,0xFF8AFF81,0xFF88FF84,0xFF8CFF8D,0xFF92FF91,0xFF9FFF97,
-0xFFA4FFA5,0xFFA7FFAC,0xFFBAFFB4,0xFFD1FFCA,0xFFE0FFDB,0xFFF3FFED,0x0004FFFF,0x00150010,
-0x0024001F,0x00340035,0x0042003D,0x004F0049,0x005B004F,0x00630057,0x00690060,0x007C006D,
-0x007F0077,0x00810083,0x00820085,0x00820081,0x008E008F,0x00910097,0x00980096,0x009E009C,
-0x00A100A0,0x00A600A5,0x00A400A8,0x00AF00A6,0x00AE00B0,0x00B000B3,0x00BA00B7,0x00B700AF,
-0x00BF00BC,0x00BF00C1,0x00C000C1,0x00C300BC,0x00CC00C8,0x00C200C2,0x00C400BF,0x00C600C7,
-0x00CB00C5,0x00CB00C9,0x00C600C4,0x00C400C6,0x00CB00BE,0x00BF00BE,0x00B500BE,0x00A400B2,
-0x00A100AD,0x009B009E,0x00890097,0x00830086,0x00740078,0x006A0067,0x005B0059,0x00500050,
-0x003C0040,0x002C0034,0x001A0025,0x000B001C,0xFFFE0006,0xFFF0FFFC,0xFFDFFFEB,0xFFD5FFDB,
-0xFFBDFFC7,0xFFABFFB7,0xFF99FFA8,0xFF8EFF9B,0xFF84FF8F,0xFF6BFF74,0xFF5CFF5C,0xFF46FF57,
-0xFF3DFF3D,0xFF23FF30,0xFF1BFF1B,0xFF07FF06,0xFEF9FEFD,0xFEE5FEE9,0xFEDFFEDA,0xFED2FED7,
-0xFEC0FEC9,0xFEB9FEBB,0xFEB0FEB9,0xFEACFEAC,0xFEB0FEAA,0xFEB5FEAC,0xFEB5FEAF,0xFEB8FEB3,
-0xFEC0FEBB,0xFEC0FEC5,0xFED4FEC7,0xFEE0FEDE,0xFEDFFEDD,0xFEEFFEED,0xFEFBFEFD,0xFF01FF07,
-0xFF20FF17,0xFF27FF1F,0xFF3CFF32,0xFF44FF3F,0xFF54FF50,0xFF71FF66,0xFF83FF75,0xFF9FFF8B,
-0xFFABFF97,0xFFC1FFAC,0xFFDAFFD1,0xFFEBFFE5,0x000A0002,0x001D0017,0x00310033,0x0052004B,
-0x00770066,0x0083007E,0x00A10099,0x00B500AC,0x00D000C0,0x00E800DB,0x010300EF,0x010C00FD,
-0x011A010D,0x01230122,0x0133012F,0x013A013A,0x013F0142,0x014D014C,0x015A014E,0x01510153,
-0x015D0161,0x0153015A,0x0160015F,0x015D0161,0x0152015A,0x0162015B,0x01550160,0x0141014B,
-0x01420149,0x01360140,0x0129012D,0x0114011F,0x01000109,0x00E900FE,0x00D400E9,0x00C400CF,
-0x00B100BD,0x009B00A3,0x00890090,0x007B0087,0x006A0071,0x005B0060,0x004D0055,0x003F0045,
-0x00360039,0x00330037,0x00310037,0x00330033,0x002E0032,0x00300031,0x00350036,0x00400041,
-0x00460048,0x004E0049,0x00600057,0x00660061,0x00780078,0x008A0082,0x009F0092,0x00B300AA,
-0x00BD00BC,0x00CF00C4,0x00E500D7,0x00F500EA,0x00F900F6,0x010500FC,0x010C010A,0x01110113,
-0x010F010F,0x0111010B,0x01080107,0x00FE00F8,0x00EE00F9,0x00E800EB,0x00D300E5,0x00C500CC,
-0x00B000B5,0x009C00A6,0x008C0091,0x007F0082,0x00700078,0x0060005E,0x005A0062,0x004C0050,
-0x00440049,0x00460045,0x003D003C,0x003E003F,0x00310038,0x002D0030,0x00220028,0x00160020,
-0x000E0014,0x0004000E,0xFFF80000,0xFFE2FFF0,0xFFCDFFD4,0xFFAEFFBD,0xFF91FF97,0xFF6CFF80,
-0xFF51FF62,0xFF2FFF39,0xFF10FF1A,0xFEECFF01,0xFEC4FED3,0xFEA3FEBA,0xFE8AFE97,0xFE68FE79,
-0xFE45FE59,0xFE2FFE3F,0xFE1BFE29,0xFE07FE11,0xFDF0FDFB,0xFDDCFDE6,0xFDD1FDD4,0xFDC3FDCD,
-0xFDB0FDB7,0xFDA9FDAE,0xFD9EFDAB,0xFD97FDA2,0xFD9DFDA0,0xFD9CFD9D,0xFDA8FD9E,0xFDA3FDA4,
-0xFDA5FDA3,0xFDAEFDAE,0xFDBFFDB8,0xFDCCFDBE,0xFDE0FDDA,0xFDF5FDEC,0xFE0BFE02,0xFE28FE1F,
-0xFE41FE36,0xFE62FE53,0xFE7DFE6E,0xFEA9FE94,0xFECBFEB5,0xFEE8FEDA,0xFF0BFEFA,0xFF32FF19,
-0xFF4CFF3F,0xFF70FF5F,0xFF94FF84,0xFFA9FFA9,0xFFCBFFBF,0xFFE4FFD8,0xFFF7FFF4,0x00170008,
-0x002E0028,0x0042003E,0x00620059,0x007F0079,0x00900085,0x00B1009F,0x00D100CA,0x00EC00DF,
-0x010300FC,0x012B011B,0x014B013A,0x01660157,0x01810173,0x019B018C,0x01BB01B0,0x01D501C8,
-0x01E701DF,0x020201F6,0x020F020C,0x021B021A,0x02280226,0x0230022D,0x02370237,0x0236023B,
-0x02300231,0x022E0232,0x02180221,0x020F0218,0x01F70201,0x01E001F0,0x01CA01D7,0x01AC01BA,
-0x0187019C,0x01670177,0x013E0154,0x0122012D,0x01010117,0x00EA00F9,0x00CA00D1,0x00AA00B9,
-0x009500A2,0x0076008A,0x00530068,0x004B0056,0x00380048,0x002A0032,0x001A0027,0x000C0015,
-0x0002000E,0x00000007,0xFFECFFF7,0xFFE1FFE3,0xFFE0FFF0,0xFFCAFFDA,0xFFC9FFC9,0xFFC1FFC6,
-0xFFB6FFB6,0xFFADFFB4,0xFFA2FFAB,0xFF96FFA2,0xFF94FF99,0xFF94FF94,0xFF85FF86,0xFF80FF81,
-0xFF7EFF7E,0xFF81FF7B,0xFF8AFF8B,0xFF88FF89,0xFF89FF91,0xFF9FFF93,0xFF9FFF9F,0xFFAFFFA4,
-0xFFBDFFB6,0xFFC3FFB9,0xFFD5FFCB,0xFFD7FFD6,0xFFE1FFDD,0xFFEDFFE2,0xFFF6FFF6,0xFFF6FFF8,
-0x00040001,0x00110003,0x00150010,0x001F0015,0x00210021,0x00200023,0x002F0024,0x002B002A,
-0x00280025,0x0033002A,0x002A0029,0x002A0024,0x002A0028,0x0025002A,0x00180023,0x0018001C,
-0x000E0017,0x00050012,0xFFE9FFFC,0xFFE7FFE5,0xFFD0FFCD,0xFFB1FFB6,0xFF94FFA1,0xFF7CFF89,
-0xFF53FF6A,0xFF3FFF53,0xFF21FF2F,0xFF04FF17,0xFEDFFEEC,0xFED0FEDB,0xFEB8FEC2,0xFEA4FEA9,
-0xFE92FE9A,0xFE8BFE8E,0xFE6FFE7A,0xFE69FE65,0xFE5CFE63,0xFE56FE58,0xFE59FE50,0xFE4EFE4C,
-0xFE56FE53,0xFE5AFE5A,0xFE5BFE5F,0xFE64FE67,0xFE65FE6D,0xFE70FE71,0xFE85FE78,0xFE90FE7E,
-0xFEA2FE8D,0xFEA4FE9F,0xFEB7FEA9,0xFEC4FEB7,0xFED4FECF,0xFEE5FED5,0xFEF2FEEB,0xFF10FEFF,
-0xFF22FF11,0xFF35FF24,0xFF4DFF3D,0xFF66FF5B,0xFF80FF73,0xFF9AFF92,0xFFB1FFA7,0xFFCFFFC2,
-0xFFF3FFE2,0x0014FFFF,0x002E001C,0x0053003B,0x00780066,0x00960089,0x00BC00AE,0x00DA00CB,
-0x00F700E9,0x0120010D,0x01430137,0x0161014A,0x01860171,0x01A2018C,0x01BC01A6,0x01D401C4,
-0x01F201DE,0x01FC01F2,0x02100203,0x022D0219,0x02380232,0x0243023E,0x024E024E,0x02620262,
-0x0268026F,0x02690270,0x02720278,0x027A0273,0x02820272,0x027E0274,0x026E026D,0x0266026A,
-0x025C026A,0x0254025B,0x0243024E,0x02360241,0x02230227,0x020C021B,0x01ED01FB,0x01CF01D9,
-0x01A501BC,0x017F0199,0x01520173,0x01280148,0x0109011E,0x00E200F1,0x00AF00C5,0x007C0091,
-0x0054006E,0x00240040,0xFFFB000A,0xFFD6FFE0,0xFFABFFC2,0xFF8BFF9E,0xFF6AFF7D,0xFF4AFF57,
-0xFF38FF4C,0xFF18FF2D,0xFF08FF12,0xFEF8FEFD,0xFEE8FEE7,0xFED5FEDB,0xFEC2FECC,0xFEB4FEBB,
-0xFEA1FEA6,0xFE94FE94,0xFE7DFE87,0xFE72FE78,0xFE70FE6E,0xFE59FE5E,0xFE56FE53,0xFE40FE4D,
-0xFE3CFE40,0xFE2EFE38,0xFE2BFE35,0xFE29FE2E,0xFE2AFE2C,0xFE2BFE2C,0xFE27FE2C,0xFE2BFE2B,
-0xFE39FE38,0xFE3CFE39,0xFE42FE3F,0xFE4EFE40,0xFE62FE59,0xFE65FE5F,0xFE7AFE73,0xFE8AFE81,
-0xFEA6FE9A,0xFEB9FEAF,0xFEC8FEC0,0xFEDEFED3,0xFEEBFEEB,0xFF0AFEFC,0xFF19FF16,0xFF34FF2B,
-0xFF4CFF44,0xFF68FF5C,0xFF89FF75,0xFFA4FF96,0xFFB9FFA5,0xFFD4FFC9,0xFFECFFE7,0x0008FFFC,
-0x0028001D,0x003E0030,0x00520047,0x006A005E,0x00740070,0x0084007E,0x008F0091,0x00990097,
-0x00AA00A0,0x00A800A8,0x00AF00AD,0x00B800B6,0x00B000AD,0x00B100AB,0x00AB00AE,0x00A800AC,
-0x009D00A4,0x008B0096,0x00790082,0x00780081,0x00720079,0x00590067,0x00510056,0x0042004F,
-0x003A0044,0x002F0037,0x0020002B,0x0011001B,0x000B0015,0x000F000D,0x0009FFFF,0xFFFCFFFC,
-0xFFF9FFF5,0xFFEEFFF0,0xFFF0FFF8,0xFFE6FFF4,0xFFEEFFF3,0xFFEBFFFC,0xFFF2FFF4,0xFFF3FFF4,
-0xFFF1FFF0,0xFFF3FFF6,0xFFF8FFFD,0xFFFD0003,0x00050002,0x00070005,0x00070004,0x000E000F,
-0x00160011,0x001D001E,0x00270026,0x00280026,0x0044003A,0x00420045,0x00560049,0x006A0066,
-0x007B006C,0x00930081,0x00A20098,0x00B900AB,0x00C500BE,0x00E100D0,0x00F000E9,0x00FB00F6,
-0x0112010E,0x01190119,0x011E0122,0x012B0123,0x012D012B,0x0129012F,0x0126012C,0x01250125,
-0x01120114,0x01070104,0x00F700F9,0x00E500ED,0x00D400D5,0x00B900C4,0x00AB00B3,0x0095009E,
-0x00840087,0x00680071,0x00510058,0x0044004A,0x00270032,0x001C001F,0x0009000C,0xFFFDFFFC,
-0xFFE6FFE7,0xFFCAFFD5,0xFFC0FFC4,0xFFB0FFBD,0xFFA2FFA3,0xFF94FF96,0xFF82FF83,0xFF6FFF79,
-0xFF67FF6C,0xFF5CFF62,0xFF50FF57,0xFF4DFF55,0xFF40FF49,0xFF3CFF3E,0xFF3BFF36,0xFF3EFF3B,
-0xFF40FF41,0xFF3DFF42,0xFF43FF43,0xFF54FF4F,0xFF61FF54,0xFF63FF60,0xFF6FFF69,0xFF78FF76,
-0xFF86FF80,0xFF8DFF8E,0xFFA1FF90,0xFFA9FFA7,0xFFB2FFAD,0xFFC5FFB8,0xFFC7FFC4,0xFFD1FFCB,
-0xFFDFFFDC,0xFFECFFF2,0xFFF4FFFB,0xFFFEFFFE,0x00050007,0x00160012,0x001C001A,0x00300025,
-0x0029002E,0x00330029,0x003A0038,0x003D003E,0x0042003A,0x00470043,0x00430042,0x0052004D,
-0x00530053,0x004B004D,0x0050004E,0x00500056,0x00520052,0x00500054,0x00560055,0x004E0051,
-0x004B0050,0x0052004E,0x004C0049,0x004E0046,0x00420042,0x00450046,0x0036003D,0x00330034,
-0x002E0033,0x00200025,0x00190023,0x0008001A,0xFFFE0006,0xFFFAFFF7,0xFFEEFFF0,0xFFE1FFDE,
-0xFFDBFFDD,0xFFCFFFD2,0xFFC1FFC7,0xFFB6FFC1,0xFFB0FFB7,0xFFACFFB3,0xFF9FFF9F,0xFF9CFF99,
-0xFF95FF9C,0xFF8EFF97,0xFF8FFF96,0xFF92FF97,0xFF91FF90,0xFF91FF92,0xFF86FF8C,0xFF8EFF8C,
-0xFF8AFF90,0xFF8CFF8D,0xFF83FF85,0xFF8AFF8C,0xFF92FF8E,0xFF93FF8E,0xFF9FFF95,0xFF9FFFA2,
-0xFFADFFA7,0xFFB8FFAE,0xFFC4FFB9,0xFFD1FFCA,0xFFE5FFE1,0xFFF8FFF0,0x000C000B,0x002B001F,
-0x003A0035,0x004D0042,0x00610053,0x00720069,0x008A0084,0x0094008F,0x009D0098,0x00AC00A4,
-0x00B500B1,0x00B300AC,0x00AD00AA,0x00B300A4,0x00AD00A9,0x00A200A1,0x0097009F,0x008B0091,
-0x008B0095,0x0087008C,0x00830083,0x0080007D,0x0084007A,0x00790077,0x00780078,0x007A0075,
-0x007E007D,0x007B007A,0x007C007B,0x0077007D,0x0079007C,0x007E007B,0x007F0076,0x007C0074,
-0x00760070,0x006E0070,0x0062006B,0x005F0067,0x0056005B,0x00450050,0x0041004A,0x00330040,
-0x002B002C,0x001C0026,0x00160017,0x000B000C,0xFFFF0000,0xFFF5FFFB,0xFFE8FFEF,0xFFE2FFE0,
-0xFFDBFFD2,0xFFD4FFD0,0xFFCAFFD1,0xFFCEFFD0,0xFFBFFFCD,0xFFBFFFC4,0xFFBEFFC8,0xFFB8FFBF,
-0xFFB7FFB6,0xFFB4FFBD,0xFFAAFFB6,0xFFA7FFB1,0xFFADFFB1,0xFFADFFAB,0xFFA4FFA1,0xFF9FFFA6,
-0xFF9AFF97,0xFF93FF93,0xFF85FF88,0xFF85FF7E,0xFF81FF7D,0xFF6CFF6E,0xFF60FF68,0xFF59FF60,
-0xFF53FF58,0xFF4AFF4E,0xFF43FF45,0xFF2FFF3F,0xFF25FF2B,0xFF24FF2A,0xFF1FFF28,0xFF1EFF20,
-0xFF15FF17,0xFF17FF14,0xFF0DFF11,0xFF0CFF0E,0xFF0CFF0F,0xFF0BFF0E,0xFF09FF12,0xFF0DFF0F,
-0xFF12FF13,0xFF1CFF12,0xFF1EFF1D,0xFF2CFF20,0xFF2FFF26,0xFF37FF30,0xFF3AFF37,0xFF45FF3C,
-0xFF4BFF4A,0xFF56FF51,0xFF60FF55,0xFF75FF64,0xFF7FFF78,0xFF84FF82,0xFF97FF8F,0xFFA8FFA6,
-0xFFBBFFAC,0xFFC8FFC0,0xFFD1FFCC,0xFFE4FFE0,0xFFEEFFF3,0xFFFDFFF5,0x00070001,0x0011000F,
-0x00190016,0x00190019,0x001A001B,0x00240023,0x00220021,0x0028001B,0x00270029,0x00220022,
-0x00280024,0x002A0026,0x00240021,0x002C0021,0x00240025,0x002B0026,0x0030002C,0x003A0034,
-0x00430040,0x00460040,0x00450042,0x00580050,0x005F0060,0x006C006B,0x00710070,0x00790079,
-0x00800080,0x00810082,0x008B008C,0x00990095,0x009E0099,0x00A600A1,0x00A300A4,0x00A400A6,
-0x00B000A8,0x00AD00A8,0x00B800B2,0x00B800B1,0x00B800B1,0x00C400B9,0x00C900C0,0x00C700C4,
-0x00D100CD,0x00D800D5,0x00E500DB,0x00F100EC,0x00F500F4,0x010200FE,0x01090105,0x01120111,
-0x01160116,0x0121011A,0x01220121,0x012F0130,0x012D0133,0x01280129,0x012A0126,0x0129011F,
-0x011A011F,0x01110119,0x010D011A,0x01010106,0x010000F7,0x00F000F2,0x00E600EC,0x00D300DC,
-0x00C100D0,0x00B700C4,0x00AF00B9,0x009C00A3,0x00980096,0x0084008D,0x006C007B,0x005E0068,
-0x004B005C,0x0039004B,0x002F0034,0x001F002D,0x000B0020,0xFFFD000A,0xFFEDFFF3,0xFFDFFFEA,
-0xFFCEFFD5,0xFFBAFFC2,0xFFACFFB2,0xFF9EFFA2,0xFF94FF92,0xFF80FF81,0xFF73FF70,0xFF64FF6D,
-0xFF5AFF66,0xFF4AFF4F,0xFF46FF45,0xFF3AFF3E,0xFF33FF38,0xFF28FF31,0xFF25FF28,0xFF21FF1F,
-0xFF12FF19,0xFF11FF18,0xFF10FF11,0xFF0EFF0A,0xFF0CFF0C,0xFF10FF08,0xFF07FF12,0xFF09FF04,
-0xFF09FF0C,0xFF07FF0E,0xFF14FF0C,0xFF1DFF16,0xFF22FF19,0xFF1FFF1D,0xFF20FF1E,0xFF28FF28,
-0xFF30FF34,0xFF39FF34,0xFF38FF3C,0xFF43FF3A,0xFF46FF4A,0xFF51FF47,0xFF5BFF54,0xFF5BFF61,
-0xFF6BFF64,0xFF6CFF6F,0xFF6FFF72,0xFF81FF80,0xFF8DFF8D,0xFF90FF95,0xFFA1FF9F,0xFFB1FFA8,
-0xFFB3FFAF,0xFFBBFFB0,0xFFC3FFBD,0xFFC9FFD0,0xFFCCFFD3,0xFFD2FFD2,0xFFD1FFD6,0xFFDDFFD7,
-0xFFE1FFDD,0xFFE4FFDB,0xFFE7FFE2,0xFFE5FFE3,0xFFE4FFE2,0xFFE5FFE4,0xFFF1FFEE,0xFFEEFFE8,
-0xFFF3FFEA,0xFFF1FFEB,0xFFF4FFEA,0xFFF4FFF4,0xFFE9FFEF,0xFFFCFFF6,0xFFF4FFFE,0xFFFAFFF6,
-0x0001FFFD,0xFFFCFFF5,0xFFFEFFF6,0x0002FFFB,0xFFFCFFFF,0xFFF70000,0xFFF8FFF7,0xFFF0FFF2,
-0xFFF3FFEC,0xFFF5FFF2,0xFFF1FFEF,0xFFF3FFED,0xFFF3FFF3,0xFFF1FFF5,0xFFFCFFFB,0xFFFBFFFF,
-0x0006FFFB,0x000C0007,0x00170011,0x001D0018,0x002D0026,0x0038002F,0x00500048,0x00560053,
-0x00600059,0x0076006A,0x00890074,0x0098008A,0x00A90097,0x00B900A7,0x00C600B9,0x00DA00CE,
-0x00E700DE,0x00FB00E8,0x010200F9,0x010C0109,0x010C0108,0x011A0112,0x01220119,0x01220125,
-0x01230124,0x011D0121,0x011E012A,0x011E0125,0x01290121,0x01220126,0x011C011F,0x011B011B,
-0x010E0113,0x0113010C,0x010D0112,0x01110108,0x010A0107,0x01090109,0x010500FD,0x00F700FE,
-0x00F900F8,0x00EF00F2,0x00ED00F0,0x00E600E9,0x00DF00E5,0x00DB00E0,0x00D600DC,0x00C100CD,
-0x00B200B8,0x00A600A6,0x00910097,0x00840086,0x00710076,0x0056005F,0x003B0040,0x002C002B,
-0x0002000F,0xFFE5FFF2,0xFFCCFFE0,0xFFB1FFC5,0xFF97FFA4,0xFF7AFF81,0xFF61FF6F,0xFF46FF52,
-0xFF2EFF3F,0xFF1EFF2B,0xFF09FF13,0xFF01FF02,0xFEE5FEF1,0xFED7FEDB,0xFEC4FECD,0xFEB9FEBB,
-0xFEB4FEBA,0xFEA5FEAB,0xFE9FFE9D,0xFE8DFE93,0xFE89FE87,0xFE80FE85,0xFE83FE81,0xFE80FE81,
-0xFE78FE7D,0xFE79FE7E,0xFE7DFE83,0xFE82FE86,0xFE8AFE89,0xFE94FE8F,0xFEA2FE9C,0xFEA5FE9E,
-0xFEB0FEA0,0xFEC3FEB7,0xFEC9FEC3,0xFED3FED7,0xFEDCFEDD,0xFEF3FEF5,0xFEF5FEFB,0xFF05FF02,
-0xFF10FF08,0xFF1FFF15,0xFF24FF19,0xFF26FF21,0xFF30FF2E,0xFF36FF37,0xFF3DFF3C,0xFF4EFF46,
-0xFF51FF49,0xFF59FF51,0xFF60FF55,0xFF71FF67,0xFF79FF71,0xFF7AFF71,0xFF8DFF85,0xFF94FF8D,
-0xFFA9FFA3,0xFFBCFFB6,0xFFC2FFC3,0xFFD5FFCC,0xFFE7FFE3,0xFFF4FFF4,0x0004FFF8,0x000A0005,
-0x001E0014,0x002F0030,0x00340031,0x003F003D,0x00490041,0x0057004D,0x005D0057,0x00610063,
-0x0067006A,0x00720072,0x00780072,0x0083007D,0x008C0080,0x00900086,0x009D0092,0x00AB009D,
-0x00B300A9,0x00BD00B2,0x00BF00C2,0x00D800CD,0x00E000DF,0x00EA00E4,0x00FF00F4,0x010F010C,
-0x0123011D,0x01310126,0x01450138,0x0151014F,0x015C0157,0x016A016B,0x01770179,0x0187017D,
-0x01A2018D,0x01A3019C,0x01A101A0,0x01A601A9,0x01AF01B1,0x01BA01B1,0x01B901B0,0x01B901AF,
-0x01B101B6,0x01AC01AE,0x01A001A4,0x019A01A6,0x018C0196,0x017D0187,0x0174017D,0x01670174,
-0x01560160,0x01490156,0x0138013F,0x012F012E,0x011F011F,0x01080113,0x00F80104,0x00E900F1,
-0x00D300E4,0x00C600D7,0x00B300B8,0x009E00A9,0x0088008A,0x006C007A,0x005B0065,0x00460051,
-0x00290038,0x0017001E,0xFFFF0007,0xFFE1FFEB,0xFFC8FFD6,0xFFA9FFBC,0xFF91FFA0,0xFF78FF8B,
-0xFF6CFF75,0xFF55FF54,0xFF41FF42,0xFF28FF32,0xFF0BFF18,0xFEFFFF05,0xFEEFFEF7,0xFEDDFEE3,
-0xFECDFECC,0xFEBBFEC4,0xFEB2FEB3,0xFEA4FEA5,0xFE98FE9C,0xFE90FE94,0xFE83FE89,0xFE7BFE7E,
-0xFE75FE74,0xFE6EFE6E,0xFE71FE6A,0xFE6CFE67,0xFE66FE6A,0xFE67FE69,0xFE6DFE6D,0xFE6FFE73,
-0xFE79FE77,0xFE8AFE7F,0xFE8DFE87,0xFEA4FE99,0xFEB4FEA9,0xFEC2FEB8,0xFED7FECA,0xFEF2FEE0,
-0xFF01FEFD,0xFF12FF0A,0xFF2CFF1F,0xFF45FF36,0xFF56FF48,0xFF69FF5B,0xFF80FF74,0xFF94FF89,
-0xFFA8FF98,0xFFB9FFA8,0xFFC4FFBD,0xFFD2FFCE,0xFFE0FFDE,0xFFF2FFF2,0x0006FFFF,0x0016000B,
-0x00220019,0x0024001D,0x002D0028,0x00370030,0x0042003E,0x00460044,0x00540048,0x005A0052,
-0x005B005B,0x00610060,0x00630060,0x006F0063,0x006D0068,0x00680069,0x00670068,0x00650063,
-0x00640065,0x00600069,0x005E0067,0x005C0059,0x005E0058,0x00590057,0x00550053,0x004F0051,
-0x0047004A,0x004B004D,0x004D004E,0x004C004D,0x0045004B,0x00410043,0x0045003D,0x004E0044,
-0x00440040,0x0044003C,0x003F0041,0x0043003E,0x00420043,0x003C003B,0x0043003C,0x0040003F,
-0x003D0037,0x003E003C,0x003D0044,0x003D0037,0x003E003B,0x00410042,0x0036003E,0x00380038,
-0x00380038,0x002A0032,0x00230025,0x001E0020,0x0018001E,0x000A0017,0x0004000A,0x00050008,
-0x0003FFFE,0xFFFAFFF8,0xFFF7FFF8,0xFFF2FFF8,0xFFF6FFF8,0xFFF4FFFB,0xFFFAFFFE,0x00010006,
-0x000E0008,0x000D0011,0x00190012,0x00260021,0x00280029,0x0031002F,0x003C003A,0x00450044,
-0x00470049,0x004F004E,0x00500054,0x00520057,0x00570056,0x00600059,0x005B0051,0x00560053,
-0x0047004F,0x003F0046,0x00440041,0x00360043,0x0032003A,0x00340037,0x002C002C,0x00290023,
-0x00230021,0x001A0019,0x00110018,0x00120014,0x000B000E,0x00070009,0x00020006,0xFFFD0000,
-0xFFF5FFFB,0xFFF3FFF5,0xFFEAFFEF,0xFFE9FFEA,0xFFE2FFE4,0xFFDBFFD9,0xFFDAFFD2,0xFFCEFFD1,
-0xFFC0FFC5,0xFFB8FFBD,0xFFAEFFB9,0xFFACFFAC,0xFFA6FFA7,0xFF9EFF9D,0xFF94FF94,0xFF90FF90,
-0xFF88FF88,0xFF7FFF83,0xFF7CFF82,0xFF76FF7B,0xFF70FF6F,0xFF68FF66,0xFF5DFF63,0xFF61FF5F,
-0xFF50FF57,0xFF4AFF50,0xFF40FF4A,0xFF42FF43,0xFF39FF3E,0xFF3CFF38,0xFF31FF38,0xFF2EFF33,
-0xFF2CFF2D,0xFF29FF28,0xFF31FF2A,0xFF2DFF31,0xFF35FF3C,0xFF3FFF41,0xFF48FF4A,0xFF56FF50,
-0xFF6AFF5C,0xFF76FF6A,0xFF8BFF76,0xFF95FF90,0xFFAAFFA0,0xFFC0FFB5,0xFFD5FFCB,0xFFE3FFE1,
-0xFFFAFFFA,0x0011000C,0x00250024,0x00380032,0x004A003E,0x005C0050,0x00630062,0x00740071,
-0x007D0084,0x00860089,0x008F008D,0x00970090,0x00A5009A,0x00A3009C,0x00A90099,0x00A9009B,
-0x00A700A4,0x00A800A6,0x00A000A6,0x00A400A6,0x00A1009F,0x00A800A3,0x00A500A8,0x00A400A8,
-0x00A300A8,0x00A200A3,0x00A700A3,0x00A500AE,0x009900A8,0x009700A0,0x009F009D,0x0097009D,
-0x00880095,0x0081008A,0x007B0079,0x00710072,0x00680069,0x00590054,0x00430043,0x00360038,
-0x00180024,0x000E000F,0x0004000C,0xFFEEFFF7,0xFFE6FFEF,0xFFD7FFE0,0xFFC8FFD0,0xFFC2FFC9,
-0xFFC6FFC4,0xFFC3FFC0,0xFFC3FFBF,0xFFC7FFC3,0xFFC3FFC3,0xFFC7FFC1,0xFFCFFFC9,0xFFD3FFD1,
-0xFFDCFFDA,0xFFE9FFE4,0xFFF2FFF0,0xFFFBFFF0,0x00060003,0x000A000D,0x001A0019,0x00270026,
-0x0036002C,0x0042003C,0x004B0049,0x00550053,0x00640061,0x006D006C,0x007F0074,0x0092008A,
-0x0099009D,0x00AD00A5,0x00B700B3,0x00C000B7,0x00CF00C5,0x00D500CA,0x00DE00D8,0x00DF00DE,
-0x00E500E3,0x00E000EB,0x00D500E5,0x00E300E2,0x00E800E7,0x00D600DB,0x00CE00D0,0x00C600C6,
-0x00BF00BE,0x00A900B2,0x009800A5,0x008E0098,0x007A0087,0x006B0078,0x0062006F,0x0051005E,
-0x0040004A,0x00320035,0x002D002F,0x001B0021,0x000F0016,0x00010009,0xFFFBFFFD,0xFFEFFFF2,
-0xFFE0FFE9,0xFFCCFFD4,0xFFC3FFCC,0xFFB5FFBA,0xFFA2FFAF,0xFF92FF9C,0xFF89FF8E,0xFF7DFF80,
-0xFF6BFF72,0xFF5DFF60,0xFF53FF5A,0xFF45FF4C,0xFF33FF3A,0xFF2AFF2F,0xFF1DFF28,0xFF15FF19,
-0xFF07FF0C,0xFF02FF06,0xFEF8FEFA,0xFEF3FEFE,0xFEEDFEF3,0xFEE1FEEF,0xFEE0FEEA,0xFEE4FEEF,
-0xFEE2FEE0,0xFEE3FEDE,0xFEE6FEE2,0xFEEBFEEB,0xFEEDFEEB,0xFEEDFEF2,0xFEFAFEF5,0xFEF9FEFA,
-0xFF01FF03,0xFF08FF0C,0xFF14FF13,0xFF1CFF1F,0xFF2FFF20,0xFF40FF34,0xFF49FF45,0xFF57FF54,
-0xFF6AFF61,0xFF73FF71,0xFF8FFF85,0xFFABFF9E,0xFFBDFFAA,0xFFD3FFC5,0xFFEFFFE3,0x0005FFF1,
-0x001B000B,0x002E0026,0x0047003F,0x00610059,0x0078006B,0x008A0080,0x009E0098,0x00B200AD,
-0x00C000BD,0x00CF00C1,0x00DE00CE,0x00EB00DE,0x00EF00F2,0x00F100F4,0x00F700F0,0x00F300F5,
-0x00F000F3,0x00F100F9,0x00EF00FA,0x00E700EB,0x00DA00E5,0x00D300DD,0x00C600D0,0x00C200C5,
-0x00BD00C4,0x00B300B9,0x00A800B0,0x009F00A8,0x0097009F,0x00920092,0x008D008F,0x00860086,
-0x00810083,0x007B007F,0x006D0073,0x00660066,0x0061005C,0x0056005F,0x004E004E,0x00420047,
-0x002F003C,0x00230032,0x001C001F,0x000F0010,0x00030003,0xFFECFFF3,0xFFE1FFE2,0xFFD4FFD8,
-0xFFC4FFC4,0xFFBCFFBF,0xFFAEFFB4,0xFFB3FFB8,0xFFAEFFB5,0xFFAEFFAB,0xFFA7FFA5,0xFFAAFFA6,
-0xFFACFFA7,0xFFA9FFA8,0xFFAAFFAA,0xFFB6FFB4,0xFFBEFFB8,0xFFC4FFBE,0xFFC7FFC1,0xFFCBFFC4,
-0xFFD4FFD3,0xFFD8FFDB,0xFFE7FFE0,0xFFF2FFF1,0xFFF5FFF1,0x0005FFFC,0x00080007,0x0013000F,
-0x001B0017,0x0029001D,0x00340029,0x003B0032,0x00460039,0x0048003F,0x00560047,0x00540054,
-0x00540056,0x005B0059,0x00530057,0x00540058,0x005A0057,0x00570051,0x00560056,0x004E0053,
-0x00420044,0x003E0040,0x0038003A,0x002E0030,0x002B002F,0x001C0027,0x0017001E,0x00120018,
-0x0009000C,0xFFFCFFFE,0xFFF9FFF8,0xFFF3FFF0,0xFFE1FFE4,0xFFD2FFD7,0xFFCBFFC9,0xFFC2FFBD,
-0xFFB5FFB2,0xFFA9FFAE,0xFF9BFFA6,0xFF90FF96,0xFF81FF87,0xFF77FF7A,0xFF6CFF73,0xFF63FF6C,
-0xFF58FF5F,0xFF4FFF52,0xFF3EFF4A,0xFF36FF40,0xFF32FF3B,0xFF27FF2B,0xFF25FF1D,0xFF14FF1B,
-0xFF04FF15,0xFF00FF11,0xFEFAFF03,0xFEF8FEFC,0xFEF8FEF5,0xFEEDFEE8,0xFEEEFEE8,0xFEEBFEEC,
-0xFEEAFEEA,0xFEEBFEE9,0xFEEAFEEF,0xFEF5FEF0,0xFEF6FEFB,0xFF02FF04,0xFF0CFF0A,0xFF20FF16,
-0xFF31FF25,0xFF43FF35,0xFF4CFF4A,0xFF5EFF5D,0xFF70FF6C,0xFF80FF7B,0xFF9DFF91,0xFFAEFFA2,
-0xFFC3FFB2,0xFFD7FFCB,0xFFE5FFD7,0xFFF5FFE9,0x00050002,0x0010000D,0x001E0019,0x002C002A,
-0x0040003A,0x00470041,0x00500047,0x005A0055,0x0064005B,0x00680066,0x0073006D,0x00790077,
-0x007D0079,0x00860080,0x008A0089,0x00920090,0x009F009E,0x00AB00A8,0x00AB00B3,0x00B100B4,
-0x00B600BD,0x00BD00BD,0x00C600C5,0x00CA00C9,0x00CF00D3,0x00D300CF,0x00CB00C8,0x00CB00CA,
-0x00CC00D1,0x00C900CD,0x00CA00CC,0x00CD00CA,0x00C400C9,0x00C700C8,0x00C900C8,0x00CB00CB,
-0x00CF00C6,0x00CF00D1,0x00D200D0,0x00CF00D1,0x00D000CD,0x00D500D1,0x00D500D3,0x00CF00D3,
-0x00CA00D1,0x00C600CA,0x00C700C3,0x00C500C1,0x00BA00C2,0x00B000B5,0x00A600B1,0x009F00A6,
-0x009300A1,0x008A008D,0x00800088,0x0074007C,0x006A006F,0x005E0069,0x0055005E,0x004C0056,
-0x00440049,0x00370040,0x002E002F,0x00270029,0x001D0019,0x00140015,0x000D000E,0x0007000F,
-0xFFFE0009,0xFFFA0003,0xFFF8FFFC,0xFFECFFF1,0xFFEEFFF0,0xFFEBFFEE,0xFFECFFE8,0xFFE5FFE8,
-0xFFE0FFE2,0xFFD8FFDB,0xFFDAFFD7,0xFFD5FFD7,0xFFCEFFD0,0xFFCCFFD1,0xFFC4FFCD,0xFFBFFFBD,
-0xFFB4FFBB,0xFFB3FFB8,0xFFAEFFB5,0xFFA7FFA9,0xFF9EFFA7,0xFF91FF9E,0xFF8EFF8E,0xFF8AFF87,
-0xFF81FF86,0xFF78FF7F,0xFF76FF7A,0xFF71FF76,0xFF65FF73,0xFF5CFF65,0xFF5AFF60,0xFF55FF5D,
-0xFF4FFF53,0xFF47FF48,0xFF45FF42,0xFF3CFF3C,0xFF38FF39,0xFF33FF31,0xFF27FF2B,0xFF1FFF20,
-0xFF21FF21,0xFF1AFF1B,0xFF13FF12,0xFF12FF12,0xFF0AFF0D,0xFF0BFF05,0xFF0CFF09,0xFF0BFF09,
-0xFF08FF0A,0xFF04FF09,0xFF08FF0C,0xFF0AFF0B,0xFF12FF10,0xFF10FF13,0xFF18FF16,0xFF1AFF1B,
-0xFF1FFF1F,0xFF28FF25,0xFF30FF23,0xFF38FF26,0xFF3AFF2F,0xFF3CFF3A,0xFF45FF3E,0xFF46FF45,
-0xFF51FF49,0xFF56FF53,0xFF5EFF54,0xFF64FF5D,0xFF70FF62,0xFF7BFF71,0xFF80FF73,0xFF8DFF7F,
-0xFFA2FF93,0xFFB3FFAD,0xFFC3FFBC,0xFFD4FFC9,0xFFEBFFE2,0x0006FFF7,0x001C000C,0x00350024,
-0x004C0040,0x0063005C,0x007E0075,0x009A008D,0x00B300A5,0x00C700B4,0x00DE00CF,0x00EE00E6,
-0x010100F7,0x0114010F,0x0128011D,0x01360133,0x013F013A,0x014F0146,0x01540155,0x01580156,
-0x01650160,0x016D0162,0x0177016D,0x017C017A,0x01830181,0x0185018C,0x018B0190,0x01910192,
-0x01920190,0x01970199,0x019A019D,0x01940199,0x019C0196,0x01990197,0x01950192,0x01920192,
-0x018B018A,0x01810184,0x0174017A,0x01660170,0x015A0164,0x014F015C,0x0144014E,0x01340141,
-0x011B0128,0x01060116,0x00F60101,0x00E200EE,0x00CB00DC,0x00B200BD,0x009C00A1,0x0087008B,
-0x006C0077,0x0054005E,0x00410048,0x00230031,0x000B0016,0xFFFB0005,0xFFE8FFEE,0xFFD0FFDE,
-0xFFBBFFC8,0xFFA8FFB1,0xFF94FFA3,0xFF84FF87,0xFF72FF79,0xFF59FF65,0xFF52FF5B,0xFF41FF4E,
-0xFF37FF3B,0xFF2CFF35,0xFF28FF27,0xFF1BFF20,0xFF13FF18,0xFF11FF17,0xFF0FFF11,0xFF0BFF0D,
-0xFF13FF10,0xFF15FF18,0xFF15FF14,0xFF14FF11,0xFF1DFF15,0xFF25FF23,0xFF2AFF25,0xFF29FF24,
-0xFF2FFF25,0xFF35FF2D,0xFF3FFF35,0xFF47FF38,0xFF46FF3B,0xFF47FF43,0xFF49FF44,0xFF46FF48,
-0xFF44FF48,0xFF46FF4B,0xFF42FF50,0xFF4AFF4E,0xFF47FF4E,0xFF48FF47,0xFF4AFF4A,0xFF4CFF49,
-0xFF53FF4B,0xFF51FF4D,0xFF56FF56,0xFF5BFF59,0xFF5DFF5C,0xFF68FF5F,0xFF73FF67,0xFF73FF6C,
-0xFF7EFF78,0xFF87FF84,0xFF92FF8D,0xFF97FF97,0xFFA2FFA4,0xFFB1FFAB,0xFFBBFFB2,0xFFBBFFBB,
-0xFFCBFFCA,0xFFCEFFD1,0xFFD6FFD0,0xFFDBFFDA,0xFFE2FFDD,0xFFE2FFDA,0xFFE8FFDF,0xFFEAFFE8,
-0xFFF3FFEC,0xFFF1FFEB,0xFFF4FFED,0xFFFAFFF9,0xFFFCFFFE,0x00020002,0x000E0011,0x001B0017,
-0x00270020,0x00300025,0x003C0032,0x00450038,0x004B0044,0x00530046,0x005F0055,0x0065005F,
-0x0064006E,0x0067006C,0x0071006A,0x0073006E,0x007A0072,0x007B0070,0x00790073,0x00790075,
-0x00790076,0x00750075,0x00700072,0x00720070,0x0070006F,0x0072006F,0x006E0072,0x006A006E,
-0x00660063,0x00650063,0x006C0064,0x00680061,0x0064005D,0x0059005F,0x005B005D,0x0057005E,
-0x00590061,0x005D005C,0x005D005F,0x0057005B,0x0059005B,0x0056005A,0x00580056,0x00560051,
-0x0050004C,0x004E004B,0x0048004A,0x00430049,0x0044004A,0x0046004B,0x00420049,0x0040003E,
-0x003E0042,0x003D0049,0x00390040,0x00400040,0x003A0040,0x003A003F,0x003A003D,0x003A0037,
-0x00360034,0x00300032,0x00300032,0x0029002D,0x002F002F,0x002D002F,0x00270025,0x00270020,
-0x0022001E,0x00180019,0x00130015,0x00100014,0x000F000D,0x000A0007,0x00030006,0xFFFFFFFE,
-0xFFFAFFFE,0xFFF6FFFB,0xFFEFFFF5,0xFFE7FFEB,0xFFE8FFE9,0xFFE5FFE5,0xFFE6FFE0,0xFFD9FFDF,
-0xFFD0FFDB,0xFFC9FFDC,0xFFCCFFD4,0xFFD0FFCE,0xFFC5FFC8,0xFFC0FFC3,0xFFBBFFBC,0xFFB3FFB8,
-0xFFA8FFAF,0xFFA1FFA6,0xFF98FFA4,0xFF8DFF9C,0xFF87FF8E,0xFF7EFF84,0xFF77FF7C,0xFF70FF72,
-0xFF6DFF69,0xFF64FF5E,0xFF5AFF57,0xFF51FF55,0xFF4BFF4E,0xFF46FF42,0xFF42FF3C,0xFF42FF3A,
-0xFF37FF37,0xFF3AFF34,0xFF3CFF37,0xFF3BFF37,0xFF38FF3C,0xFF3AFF36,0xFF3EFF3A,0xFF3EFF42,
-0xFF40FF47,0xFF3EFF43,0xFF42FF41,0xFF44FF44,0xFF46FF4A,0xFF49FF47,0xFF4CFF46,0xFF4BFF4B,
-0xFF4EFF4D,0xFF4EFF53,0xFF51FF55,0xFF5CFF5C,0xFF62FF64,0xFF6CFF6A,0xFF7AFF78,0xFF89FF7F,
-0xFF8EFF8B,0xFF9FFF94,0xFFAEFFA2,0xFFBFFFB2,0xFFCEFFC2,0xFFDEFFD6,0xFFF3FFE6,0x0002FFF7,
-0x00180008,0x00260019,0x00380028,0x004A0040,0x00540051,0x005E0059,0x00710071,0x00790081,
-0x008C0088,0x00950091,0x00A0009B,0x00AA00A3,0x00AD00B1,0x00B600B7,0x00BD00BE,0x00C000C5,
-0x00C800C6,0x00C900CB,0x00C700C8,0x00CE00C8,0x00C800CA,0x00CB00CB,0x00C600CD,0x00C200C2,
-0x00C200C4,0x00BD00C1,0x00B900B8,0x00B600B5,0x00B000B2,0x00A900AD,0x00A700AB,0x009F00A6,
-0x0094009D,0x00950097,0x008D008D,0x00880087,0x007D0082,0x00790079,0x006E0076,0x0069006B,
-0x005E0067,0x0052005F,0x004D0050,0x00490045,0x0035003F,0x002F0032,0x002B002C,0x001C001D,
-0x0009000B,0x00020002,0xFFF1FFF7,0xFFE3FFE6,0xFFDAFFDA,0xFFD5FFD1,0xFFC7FFC7,0xFFB8FFC3,
-0xFFB3FFBC,0xFFB2FFB7,0xFFACFFA6,0xFFA7FFA8,0xFF9CFFA2,0xFF9BFF9C,0xFF9BFF9A,0xFF96FF96,
-0xFF94FF99,0xFF92FF9B,0xFF97FF9B,0xFF9CFFA1,0xFF9EFF9C,0xFF9FFF9B,0xFFA5FFA5,0xFFA8FFA8,
-0xFFB0FFB1,0xFFB3FFB1,0xFFB8FFB9,0xFFC5FFC4,0xFFCEFFC8,0xFFDAFFD7,0xFFE1FFDF,0xFFE5FFE1,
-0xFFF1FFEF,0x00070000,0x000E0007,0x0015000C,0x001E001C,0x00220025,0x002B002E,0x002D0030,
-0x00340034,0x003A0034,0x003C003A,0x003D0038,0x00430038,0x003E003C,0x0038003F,0x003D003D,
-0x003E0041,0x003E003C,0x0040003F,0x00410040,0x00430040,0x00430040,0x003F0045,0x00460041,
-0x00470044,0x00420040,0x003F0040,0x003D0040,0x003D003C,0x00330034,0x002D0031,0x0028002B,
-0x00210025,0x00190019,0x000D0010,0x00020008,0xFFF6FFFB,0xFFEAFFEB,0xFFE6FFE9,0xFFDBFFDD,
-0xFFD3FFD6,0xFFC8FFD1,0xFFBCFFC4,0xFFBCFFBE,0xFFB4FFB4,0xFFABFFAE,0xFFA3FFA9,0xFF9FFFA4,
-0xFF9FFFA2,0xFF9AFFA1,0xFF9AFF9F,0xFF9DFF9E,0xFF9CFF9A,0xFF9DFF9E,0xFFA8FF9F,0xFFA9FFA4,
-0xFFADFFA7,0xFFAFFFA9,0xFFB3FFAD,0xFFBDFFB4,0xFFC4FFBB,0xFFC8FFC2,0xFFD1FFCA,0xFFD4FFD0,
-0xFFD9FFDB,0xFFE3FFE0,0xFFEAFFE9,0xFFEFFFF1,0xFFFEFFF8,0x00040004,0x0011000B,0x00190013,
-0x00250024,0x002E0032,0x00390037,0x00470043,0x00520054,0x005C0059,0x00660061,0x0069006C,
-0x0077007A,0x00820084,0x008D0088,0x0095008C,0x009E0091,0x00A40098,0x00A000A1,0x009F00A5,
-0x00A400AD,0x00A200A8,0x00A600A4,0x00A800A2,0x00A600A3,0x00A3009D,0x009C009E,0x0099009B,
-0x0097009D,0x00930090,0x00890091,0x0086008B,0x007D0083,0x0074007A,0x006E0078,0x006A0071,
-0x0065006A,0x005E0067,0x00570060,0x00510054,0x004A004E,0x00410048,0x00390042,0x0032003A,
-0x002C0030,0x00250027,0x001B001F,0x0014001B,0x000E0013,0x00040006,0xFFFBFFFE,0xFFF6FFF5,
-0xFFF0FFF0,0xFFE7FFEB,0xFFDEFFE3,0xFFD3FFDA,0xFFCFFFD7,0xFFCFFFD2,0xFFCAFFCF,0xFFC0FFC7,
-0xFFC3FFC4,0xFFC3FFBE,0xFFBEFFBC,0xFFBAFFBB,0xFFBBFFB8,0xFFB6FFB5,0xFFB5FFB6,0xFFADFFB6,
-0xFFB1FFAF,0xFFAFFFAF,0xFFACFFAF,0xFFACFFAB,0xFFA9FFA9,0xFFABFFA3,0xFFA7FFA1,0xFFA6FFA0,
-0xFFA6FFA5,0xFFA3FFA0,0xFFA2FF9D,0xFFA4FFA0,0xFFA4FFA3,0xFFA6FFA4,0xFFADFFAA,0xFFACFFAD,
-0xFFAEFFB0,0xFFB4FFB4,0xFFBBFFBB,0xFFC1FFBA,0xFFC5FFC0,0xFFCBFFC3,0xFFCDFFCA,0xFFD2FFD2,
-0xFFD8FFD2,0xFFDCFFD5,0xFFDEFFD6,0xFFDBFFDC,0xFFDDFFDF,0xFFE0FFDF,0xFFE4FFE6,0xFFE2FFE9,
-0xFFE4FFE8,0xFFE7FFE9,0xFFE7FFEC,0xFFECFFEC,0xFFEEFFE8,0xFFF0FFF1,0xFFF3FFF4,0xFFF3FFF2,
-0xFFF7FFF6,0xFFF7FFF8,0xFFFBFFFA,0xFFFDFFFC,0xFFFFFFFA,0xFFFD0004,0xFFFEFFFF,0xFFFDFFFB,
-0xFFF7FFFD,0xFFFDFFFC,0xFFF6FFF9,0xFFF2FFF1,0xFFEFFFF6,0xFFECFFF0,0xFFE5FFE7,0xFFDBFFDE,
-0xFFD5FFD8,0xFFCFFFD5,0xFFC8FFC3,0xFFBEFFBD,0xFFB3FFB8,0xFFA9FFB2,0xFFA3FFA8,0xFF9BFFA4,
-0xFF97FF9A,0xFF8FFF92,0xFF88FF8A,0xFF84FF86,0xFF7CFF82,0xFF76FF7B,0xFF79FF7B,0xFF73FF72,
-0xFF74FF75,0xFF73FF74,0xFF76FF75,0xFF76FF77,0xFF7EFF74,0xFF80FF79,0xFF82FF7E,0xFF87FF83,
-0xFF91FF87,0xFF99FF8C,0xFFA3FF9A,0xFFAAFFA4,0xFFB3FFA9,0xFFBBFFB5,0xFFC5FFC2,0xFFD2FFCE,
-0xFFDFFFD4,0xFFE7FFDE,0xFFF2FFE6,0xFFFFFFF2,0x000A0000,0x0011000D,0x001A0015,0x00260024,
-0x002F002E,0x003A0037,0x00490048,0x00560051,0x005F005E,0x006C0067,0x007A006F,0x0085007D,
-0x00920088,0x009C0094,0x00A7009C,0x00AD00A7,0x00AF00AF,0x00B600B3,0x00BA00B7,0x00BF00BC,
-0x00C200BD,0x00C600C2,0x00C100C1,0x00C600C4,0x00C300BE,0x00C000BD,0x00B800B7,0x00B400B6,
-0x00AF00AE,0x00AB00AA,0x00A300A5,0x009C009D,0x00940094,0x008D0090,0x007F0087,0x0070007D,
-0x00650071,0x00620064,0x0051005B,0x0048004E,0x003C0044,0x002E0032,0x00230025,0x0017001A,
-0x000B000B,0xFFFFFFFF,0xFFEEFFF5,0xFFE2FFE8,0xFFD3FFDE,0xFFC9FFD2,0xFFC0FFCD,0xFFBAFFC4,
-0xFFB6FFBA,0xFFB3FFB0,0xFFAEFFAD,0xFFA7FFAA,0xFFA2FFA8,0xFFA0FFA6,0xFFA2FFA3,0xFFA4FFA4,
-0xFFA2FFA0,0xFFA2FFA0,0xFFA2FF9F,0xFFA2FF9D,0xFFA0FFA1,0xFFA5FFA1,0xFFA6FFA6,0xFFA7FFA6,
-0xFFA8FFA6,0xFFACFFAB,0xFFAEFFAC,0xFFAEFFB2,0xFFADFFB4,0xFFB3FFB5,0xFFB2FFB2,0xFFB2FFB3,
-0xFFB2FFB6,0xFFB5FFBA,0xFFBCFFBB,0xFFC4FFC1,0xFFC1FFBF,0xFFC8FFBD,0xFFCDFFC4,0xFFCDFFCC,
-0xFFCFFFD2,0xFFCFFFD3,0xFFD8FFD5,0xFFDCFFDA,0xFFDAFFDE,0xFFDEFFE2,0xFFE4FFE5,0xFFEAFFE7,
-0xFFECFFE3,0xFFECFFE6,0xFFEAFFE9,0xFFEAFFEE,0xFFEEFFF3,0xFFEDFFED,0xFFEAFFE9,0xFFE7FFEA,
-0xFFE7FFE8,0xFFE7FFE7,0xFFE2FFDE,0xFFE0FFD6,0xFFD7FFD5,0xFFD2FFD4,0xFFC8FFD3,0xFFC6FFCC,
-0xFFC9FFCB,0xFFC4FFC6,0xFFBAFFBE,0xFFB4FFB9,0xFFAFFFBA,0xFFADFFB5,0xFFB0FFB1,0xFFACFFAD,
-0xFFABFFB0,0xFFAFFFAF,0xFFAFFFB1,0xFFB1FFB2,0xFFB3FFB5,0xFFB4FFB9,0xFFBAFFBA,0xFFC1FFBD,
-0xFFC4FFBE,0xFFC7FFC6,0xFFD0FFC9,0xFFD7FFCD,0xFFD9FFD0,0xFFDFFFD9,0xFFE9FFDF,0xFFEEFFE8,
-0xFFF5FFED,0xFFF8FFF4,0xFFFFFFFF,0x000A0009,0x00160018,0x00200020,0x002D0025,0x003B0032,
-0x0049003E,0x00530046,0x00610056,0x006C0065,0x00750073,0x00810082,0x008D008C,0x00980096,
-0x009C009D,0x00A900AA,0x00AC00B6,0x00B500B7,0x00BB00B6,0x00BF00B7,0x00C000B7,0x00C800BE,
-0x00C700C5,0x00C100C5,0x00C000C3,0x00C100C6,0x00C100C6,0x00C100C3,0x00C500C3,0x00BF00C2,
-0x00BF00BE,0x00BF00BD,0x00BB00BB,0x00B600BA,0x00AC00B3,0x00A800AD,0x00A200A8,0x009D009F,
-0x0096009E,0x008F0097,0x008A008D,0x00820082,0x007A0079,0x00740070,0x0069006B,0x005F005F,
-0x0055005D,0x004A0054,0x0045004D,0x003F0043,0x00340039,0x002C0031,0x00270029,0x00220021,
-0x0019001B,0x000D0015,0x0005000E,0xFFFD0006,0xFFF8FFFF,0xFFF3FFF7,0xFFEAFFE9,0xFFDFFFE3,
-0xFFDBFFDB,0xFFD4FFD3,0xFFCAFFC9,0xFFC0FFC7,0xFFB4FFBE,0xFFADFFB9,0xFFA5FFAF,0xFF9FFFA2,
-0xFF9BFF9E,0xFF94FF9A,0xFF8FFF90,0xFF8CFF85,0xFF88FF82,0xFF81FF80,0xFF7EFF7F,0xFF82FF7D,
-0xFF7FFF7A,0xFF7EFF79,0xFF7CFF7A,0xFF79FF7A,0xFF7EFF7C,0xFF7BFF7D,0xFF7DFF7F,0xFF7CFF84,
-0xFF81FF84,0xFF8DFF83,0xFF90FF82,0xFF93FF86,0xFF94FF8E,0xFF99FF8E,0xFF9FFF94,0xFF9EFFA0,
-0xFF9FFFA5,0xFFA6FFA8,0xFFABFFAB,0xFFB3FFAA,0xFFB3FFB0,0xFFB4FFB2,0xFFBBFFB6,0xFFBEFFB9,
-0xFFBBFFBD,0xFFC1FFBD,0xFFC5FFC4,0xFFC9FFC6,0xFFC7FFC8,0xFFCBFFCA,0xFFCCFFCF,0xFFD1FFD4,
-0xFFD5FFD6,0xFFDEFFD8,0xFFDEFFDB,0xFFE4FFDA,0xFFE5FFDE,0xFFE3FFE5,0xFFE4FFEA,0xFFE9FFE8,
-0xFFECFFE7,0xFFEAFFE6,0xFFE9FFEB,0xFFE9FFEE,0xFFEBFFE9,0xFFE4FFE3,0xFFE3FFE6,0xFFE3FFE9,
-0xFFE0FFE3,0xFFDFFFE1,0xFFDEFFE2,0xFFDAFFDF,0xFFD7FFD8,0xFFDAFFDA,0xFFD4FFD6,0xFFD7FFD6,
-0xFFDBFFD9,0xFFDCFFDD,0xFFDCFFDF,0xFFDBFFE1,0xFFDFFFE4,0xFFE5FFEB,0xFFEAFFEE,0xFFF1FFEF,
-0xFFF6FFF6,0xFFFBFFF7,0x0000FFFB,0x00070002,0x000F0007,0x00140014,0x00180018,0x0021001D,
-0x00290024,0x0030002A,0x00350034,0x003A003A,0x00440041,0x0048004C,0x004F004F,0x00560055,
-0x005A005F,0x0061005E,0x00690065,0x0071006E,0x00730070,0x00780079,0x007D007B,0x00800081,
-0x00810085,0x00890083,0x008B0084,0x00890086,0x008C0089,0x008C008D,0x008C0088,0x00890088,
-0x0088008C,0x0084008A,0x00840085,0x00820081,0x007E0081,0x007A007F,0x0076007D,0x0075007C,
-0x006E007A,0x006D0074,0x006A006E,0x00680067,0x00600065,0x005A0062,0x0056005D,0x00530056,
-0x004C004F,0x0048004B,0x003C0041,0x0033003C,0x002E0034,0x0021002B,0x00180022,0x000B0016,
-0x00040006,0xFFFBFFFE,0xFFE7FFF4,0xFFDFFFEA,0xFFD6FFDC,0xFFCCFFD1,0xFFC6FFC6,0xFFB8FFBA,
-0xFFADFFB2,0xFFA5FFA9,0xFF9AFFA1,0xFF92FF97,0xFF8BFF8C,0xFF81FF84,0xFF7AFF7D,0xFF75FF79,
-0xFF6EFF74,0xFF6BFF67,0xFF6BFF64,0xFF63FF60,0xFF5FFF60,0xFF5BFF65,0xFF5BFF66,0xFF5DFF65,
-0xFF5EFF62,0xFF60FF66,0xFF63FF66,0xFF65FF69,0xFF6BFF6A,0xFF6EFF6F,0xFF75FF72,0xFF78FF77,
-0xFF79FF7B,0xFF81FF81,0xFF87FF85,0xFF90FF89,0xFF91FF8C,0xFF96FF92,0xFF9CFF97,0xFFA2FF9E,
-0xFFA7FFA4,0xFFA9FFA9,0xFFB1FFB1,0xFFBCFFBC,0xFFC4FFBE,0xFFCFFFC6,0xFFD7FFCD,0xFFD9FFD8,
-0xFFE4FFE3,0xFFE9FFED,0xFFF4FFF0,0x0001FFFA,0x00080004,0x00100011,0x00170017,0x001E001D,
-0x00270021,0x002D002A,0x0034002F,0x003A0032,0x003C0032,0x003F0038,0x0041003F,0x00410040,
-0x00400044,0x00410046,0x0042004A,0x00480046,0x004D0047,0x0047004A,0x0043004A,0x0043004E,
-0x0045004B,0x00430049,0x00430048,0x00440045,0x00460041,0x00400042,0x003F0045,0x003E0044,
-0x003C003E,0x003B003D,0x00390039,0x00390035,0x00340034,0x002E0030,0x002E002D,0x002B0029,
-0x0027002B,0x00230027,0x00200022,0x001A001F,0x0017001B,0x00150018,0x00170015,0x00110011,
-0x000F000D,0x000F0009,0x000C0008,0x0008000B,0x00070009,0x00060006,0x00060003,0x00040003,
-0x00030001,0x00000001,0x00010003,0xFFFE0000,0x00010000,0x00000000,0x0004FFFF,0x0004FFFC,
-0x0004FFFA,0x0001FFFE,0xFFFE0002,0x00060002,0x0004FFFE,0x00050000,0x00070005,0x00080005,
-0x00090006,0x000A0009,0x000B000C,0x000F000F,0x00140014,0x0017000F,0x001A0013,0x001A0015,
-0x0019001A,0x001D001C,0x0022001E,0x001F0020,0x001F0021,0x00200021,0x00200025,0x001C0027,
-0x001D0026,0x001A0023,0x001A0024,0x00190022,0x00190021,0x0019001E,0x0018001A,0x00170015,
-0x00130012,0x0012000C,0x000D000C,0x0007000C,0x00040009,0x00050006,0x00000004,0xFFFDFFFE,
-0xFFF8FFFE,0xFFF6FFFC,0xFFF5FFFA,0xFFF3FFF5,0xFFF2FFF0,0xFFEDFFF0,0xFFE6FFEE,0xFFE2FFEB,
-0xFFE3FFEA,0xFFDEFFE3,0xFFDBFFDB,0xFFD7FFDB,0xFFCFFFD7,0xFFCBFFD5,0xFFC7FFCF,0xFFC4FFC8,
-0xFFC1FFC2,0xFFBEFFC0,0xFFBCFFBC,0xFFBAFFBC,0xFFB4FFB4,0xFFB4FFB6,0xFFB3FFBA,0xFFB4FFB6,
-0xFFB6FFB6,0xFFB4FFB7,0xFFB6FFBC,0xFFB8FFBD,0xFFBDFFBE,0xFFC4FFC2,0xFFC4FFC2,0xFFC7FFC6,
-0xFFCBFFD1,0xFFD0FFD2,0xFFD5FFD5,0xFFDDFFD7,0xFFE5FFD9,0xFFE8FFDA,0xFFEAFFDC,0xFFEAFFE6,
-0xFFEBFFEC,0xFFF0FFEC,0xFFF4FFEE,0xFFF5FFF1,0xFFF7FFF1,0xFFFAFFF4,0xFFFBFFF9,0x0001FFFE,
-0x0003FFFE,0x00050000,0x00090004,0x000A0009,0x0012000C,0x00150011,0x00170013,0x001C0016,
-0x001F001A,0x0024001E,0x00240020,0x00270024,0x002B0025,0x002F0024,0x002D0028,0x002B002F,
-0x002C0033,0x002C0034,0x002E0034,0x002F0030,0x002F0030,0x002D0032,0x002D0032,0x002A0030,
-0x00270031,0x0029002C,0x002C0029,0x00290029,0x00280027,0x00260021,0x00250021,0x0021001E,
-0x0021001E,0x001D001E,0x001C0017,0x001B0014,0x00190014,0x00160012,0x00150010,0x00130011,
-0x000E000F,0x000E0010,0x000C000F,0x000F000C,0x000F000C,0x000B000E,0x00090011,0x000B0012,
-0x000F0013,0x00120010,0x00130011,0x00140012,0x00100016,0x0012001A,0x0015001D,0x0018001E,
-0x001A001E,0x001D001D,0x00200020,0x001F0021,0x00200023,0x00200025,0x001F002A,0x00230026,
-0x00220026,0x00200026,0x00230025,0x001F0023,0x001F0023,0x0021001F,0x001C001E,0x0017001D,
-0x0016001B,0x00150015,0x00120012,0x0012000E,0x0011000C,0x000C000A,0x00050005,0x00040004,
-0x00000003,0xFFFE0001,0xFFFFFFFE,0x0000FFFE,0xFFFAFFFD,0xFFF8FFFE,0xFFFA0001,0xFFFAFFFD,
-0xFFFCFFFC,0xFFFAFFFE,0xFFF8FFFB,0xFFF8FFFA,0xFFF6FFF9,0xFFF4FFF7,0xFFF3FFF5,0xFFF3FFF1,
-0xFFF1FFEF,0xFFF0FFEC,0xFFEFFFEB,0xFFE9FFEA,0xFFE5FFE8,0xFFE8FFE3,0xFFE6FFDD,0xFFE6FFDF,
-0xFFE2FFDF,0xFFE3FFDF,0xFFE1FFDE,0xFFE1FFDF,0xFFE1FFDF,0xFFE3FFE0,0xFFE4FFDF,0xFFE5FFE2,
-0xFFE7FFE2,0xFFE7FFE1,0xFFE7FFE5,0xFFE5FFE7,0xFFE7FFE7,0xFFE7FFE7,0xFFE6FFEA,0xFFE8FFE9,
-0xFFE7FFEA,0xFFE6FFE9,0xFFE4FFEA,0xFFE5FFE9,0xFFE9FFE7,0xFFE5FFE5,0xFFE6FFE4,0xFFE5FFE3,
-0xFFE4FFE2,0xFFE6FFE1,0xFFE6FFDF,0xFFE2FFDF,0xFFE0FFE3,0xFFE1FFE6,0xFFE5FFE5,0xFFE3FFE5,
-0xFFE2FFE6,0xFFE3FFE5,0xFFE5FFE6,0xFFE4FFE9,0xFFE7FFE8,0xFFE8FFEA,0xFFE9FFE9,0xFFEBFFE8,
-0xFFEBFFE9,0xFFECFFEB,0xFFEDFFEB,0xFFEEFFEB,0xFFF2FFED,0xFFF3FFEC,0xFFF3FFED,0xFFF2FFF1,
-0xFFF2FFF2,0xFFF5FFF2,0xFFF6FFF4,0xFFF7FFF7,0xFFF8FFFA,0xFFFBFFFA,0xFFFCFFFB,0x0000FFFE,
-0xFFFD0000,0x00000003,0x00000004,0x00020005,0x00030007,0x00040007,0x00080009,0x0009000B,
-0x0008000B,0x00040011,0x000C0012,0x0011000F,0x0010000F,0x000F0014,0x00120014,0x00140014,
-0x00160015,0x00180016,0x001A0015,0x001A0019,0x0019001C,0x001A001F,0x001A0020,0x001F0021,
-0x00210022,0x0022001F,0x00240021,0x00230024,0x00250026,0x00290026,0x002B0023,0x002A0023,
-0x00280027,0x002B0027,0x002A0027,0x002B0027,0x002B0025,0x002B0024,0x00290022,0x00230025,
-0x001F0025,0x001F0024,0x001C0022,0x001B0020,0x0018001C,0x00160019,0x00140017,0x00140010,
-0x0011000C,0x000E0009,0x000B0007,0x00090004,0x00070003,0x00020002,0xFFFF0002,0xFFFDFFFE,
-0xFFFAFFFE,0xFFF7FFFE,0xFFF6FFFE,0xFFF5FFF9,0xFFF4FFF9,0xFFF1FFF5,0xFFF0FFF4,0xFFECFFF3,
-0xFFEBFFF0,0xFFE8FFEE,0xFFE9FFEB,0xFFE9FFE7,0xFFE6FFE4,0xFFE3FFE4,0xFFE1FFE3,0xFFDEFFE0,
-0xFFDAFFE0,0xFFDBFFE1,0xFFDDFFDD,0xFFDDFFD7,0xFFDBFFD8,0xFFDAFFD8,0xFFDBFFD7,0xFFDAFFD7,
-0xFFD8FFD8,0xFFD7FFDB,0xFFD9FFDB,0xFFDCFFD9,0xFFDFFFD9,0xFFDEFFD9,0xFFE0FFDC,0xFFDEFFDD,
-0xFFDEFFE1,0xFFDFFFDF,0xFFE0FFDF,0xFFE0FFE2,0xFFE2FFE2,0xFFE3FFE2,0xFFE3FFE4,0xFFE4FFE3,
-0xFFE4FFE5,0xFFE4FFE6,0xFFE7FFE7,0xFFEAFFE3,0xFFEAFFE4,0xFFE7FFE9,0xFFE8FFEB,0xFFEAFFEC,
-0xFFEDFFED,0xFFEFFFEE,0xFFEDFFF3,0xFFF0FFF5,0xFFF1FFF4,0xFFF4FFF6,0xFFF6FFF9,0xFFFAFFF8,
-0xFFFEFFF8,0xFFFFFFF8,0xFFFFFFFC,0xFFFE0000,0x00000000,0x00010002,0x00030004,0x00070005,
-0x00080002,0x000A0003,0x00090006,0x000A0007,0x000C0008,0x000C0007,0x000B0007,0x000A000A,
-0x000C0009,0x000A0008,0x0008000B,0x0006000B,0x0006000A,0x0006000A,0x0006000A,0x00070007,
-0x00060006,0x00050007,0x00050008,0x00060006,0x00050003,0x00040003,0x00040002,0x00030002,
-0x00010003,0x00010003,0x00020002,0x0004FFFF,0x0003FFFE,0x00020000,0x00000002,0x00000002,
-0xFFFF0002,0xFFFE0004,0xFFFF0004,0x00000004,0x00000002,0xFFFE0006,0xFFFD000B,0x00040007,
-0x00060004,0x00020008,0x0005000B,0x0008000C,0x0008000A,0x000B000D,0x000F000D,0x000F000E,
-0x00100011,0x00130013,0x00170012,0x00170014,0x00190016,0x001B0018,0x001C001A,0x001D001D,
-0x001C001C,0x001E0020,0x00210021,0x00230020,0x00240021,0x00240022,0x00240023,0x00210027,
-0x00230028,0x00280026,0x002A0022,0x002B0021,0x002A0021,0x00270025,0x00240028,0x00250028,
-0x00270026,0x00270025,0x00250024,0x00230024,0x00200025,0x001C0026,0x001E0023,0x001E0020,
-0x001D001D,0x001B001A,0x00170019,0x00150018,0x00130016,0x00110011,0x000F000E,0x000B000D,
-0x0008000B,0x00060009,0x00010008,0x00000006,0xFFFE0005,0xFFFE0000,0xFFFDFFFC,0xFFFAFFFB,
-0xFFF6FFFC,0xFFF2FFFC,0xFFF1FFFB,0xFFF2FFF7,0xFFF1FFF4,0xFFF0FFF2,0xFFEFFFEE,0xFFEDFFED,
-0xFFEAFFEC,0xFFE9FFEB,0xFFE8FFEA,0xFFE6FFE7,0xFFE4FFE7,0xFFE3FFE5,0xFFE4FFE2,0xFFE4FFDF,
-0xFFE4FFDE,0xFFE1FFDE,0xFFDEFFE0,0xFFDEFFE0,0xFFE0FFDD,0xFFE0FFDB,0xFFDFFFDB,0xFFDDFFDE,
-0xFFDEFFDF,0xFFE0FFDD,0xFFE1FFDC,0xFFE0FFDD,0xFFE0FFE0,0xFFE1FFE1,0xFFE2FFE1,0xFFE3FFE2,
-0xFFE5FFE3,0xFFE7FFE3,0xFFE9FFE4,0xFFEAFFE6,0xFFEBFFE7,0xFFECFFE8,0xFFEDFFEC,0xFFEFFFEE,
-0xFFF2FFED,0xFFF3FFEF,0xFFF2FFF3,0xFFF4FFF4,0xFFF4FFF7,0xFFF5FFFA,0xFFFAFFF9,0xFFFDFFF8,
-0xFFFFFFFA,0xFFFBFFFD,0xFFFB0002,0xFFFD0004,0xFFFF0004,0x00020005,0x00060004,0x00090003,
-0x000B0002,0x000C0004,0x00090007,0x0009000B,0x000D000B,0x000E0009,0x000C000C,0x000C000E,
-0x000D000E,0x000E000F,0x0010000D,0x0011000B,0x0010000C,0x000F000C,0x000E000D,0x000D000D,
-0x000E000C,0x000D000C,0x000D000B,0x000D000B,0x000B000A,0x0008000C,0x0006000D,0x0007000E,
-0x0008000C,0x000A0009,0x00080008,0x00070009,0x00070009,0x000A0005,0x00070004,0x00050006,
-0x00070005,0x00090002,0x00060000,0x00030004,0x00030004,0x00030002,0x00020002,0x00030001,
-0x00030001,0x00020001,0x00020000,0x00010000,0x00020001,0x00020000,0x00010000,0x00020001,
-0x00030000,0x0003FFFE,0x00020000,0x00030000,0x0004FFFE,0x0004FFFE,0x0004FFFE,0x0001FFFF,
-0xFFFE0003,0xFFFF0004,0x00020001,0x00030000,0x0003FFFE,0x00020000,0x00020000,0x00020000,
-0x00000001,0x00010002,0x00020000,0x00010001,0x00030000,0x0004FFFE,0x0003FFFF,0x0002FFFF,
-0x00010001,0x00010001,0x0002FFFF,0x0001FFFF,0x00030000,0x0005FFFD,0x0005FFFA,0x0002FFFC,
-0xFFFD0001,0xFFFE0003,0x0001FFFF,0x0002FFFC,0x0002FFFC,0x0002FFFC,0x0002FFFC,0x0000FFFC,
-0xFFFFFFFD,0xFFFDFFFE,0xFFFFFFFE,0x0000FFFD,0xFFFFFFFC,0xFFFDFFFE,0xFFFEFFFF,0xFFFEFFFE,
-0x0000FFFD,0xFFFFFFFC,0xFFFCFFFF,0xFFFC0003,0x00000000,0x0001FFFD,0xFFFFFFFE,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,
-};
@@ -1,3 +0,0 @@
-// Audio data converted from WAV file by wav2sketch
-
-extern const unsigned int AudioSampleFirehit[24833];
@@ -1,663 +0,0 @@
-// Audio data converted from WAV file by wav2sketch
-
-#include "AudioSampleKick.h"
-
-// Converted from kick.wav, using 44100 Hz, 16 bit PCM encoding
-const unsigned int AudioSampleKick[5249] = {
-0x810028E0,0x47E300DD,0x422E4950,0x26A635F2,0x1E132837,0x126716CD,0x095A10BE,0x03FD06EF,
-0xFCCB00FF,0xF704FADC,0xEF70F330,0xE760EBCE,0xDE83E311,0xD597DA13,0xCD9BD17D,0xC788CA36,
-0xC35AC558,0xBFE3C16D,0xBDF5BECA,0xBCE9BD72,0xBC4CBC75,0xBCC6BC74,0xBD51BD10,0xBDB0BD79,
-0xBE09BDD3,0xBE7EBE44,0xBEA9BEBC,0xBEC4BEA6,0xBF97BF0E,0xC07DC02B,0xC168C0CD,0xC27EC1F5,
-0xC495C34E,0xC7D3C632,0xCAB8C946,0xCDF1CC64,0xD0D5CF77,0xD42CD26B,0xD7A6D5D5,0xDAE4D930,
-0xDE55DCB4,0xE18CE008,0xE4FFE331,0xE8F9E6FC,0xED0FEB03,0xF16AEF3D,0xF647F3B2,0xFC0DF923,
-0x026DFF2E,0x0802053C,0x0DC70AF7,0x13291081,0x17DE1584,0x1CA91A46,0x211E1EF3,0x249422F7,
-0x27C4262E,0x2B7E29AB,0x2E932D27,0x30FE2FDB,0x328631C5,0x33B9333D,0x345E341D,0x34B5349A,
-0x353D34DA,0x364735C6,0x36F136B5,0x37633742,0x375F374F,0x37843782,0x37BC37AA,0x37A137AB,
-0x36E83751,0x35A33661,0x345B350E,0x330933AC,0x31D63272,0x2FA630C4,0x2D6C2E96,0x2ADA2C3E,
-0x27962938,0x242625F7,0x20412240,0x1C411E4E,0x179D19E9,0x130F155E,0x0EC010CF,0x0AE60CDC,
-0x063708A8,0x00F603A1,0xFBDAFE5D,0xF704F97C,0xF18BF430,0xEC28EEDA,0xE6C5E996,0xE13AE416,
-0xDB36DE3A,0xD59AD869,0xCFE4D2C0,0xCA8ACD2C,0xC4FDC7C2,0xBF80C22B,0xBA98BCF9,0xB59AB811,
-0xB0DBB339,0xAC4EAE88,0xA7D1AA01,0xA368A586,0x9FCCA188,0x9CCC9E4C,0x9A469B6A,0x981F992E,
-0x965F972A,0x955795C5,0x946294DC,0x94089422,0x93FD93FD,0x946C9421,0x955D94D6,0x96B495F4,
-0x98479785,0x9A2A992A,0x9C649B43,0x9F189DAF,0xA224A093,0xA598A3CF,0xA920A749,0xACF6AB03,
-0xB15CAF0D,0xB67EB3E1,0xBBE2B91B,0xC1BEBECD,0xC802C4DB,0xCE78CB2C,0xD551D1E8,0xDC47D8C6,
-0xE2BFDF86,0xE9A6E60D,0xF12EED5C,0xF895F4D7,0x0012FC5F,0x072A039A,0x0E840ADF,0x15CD122D,
-0x1CE0196D,0x235F2023,0x297A2687,0x2F4A2C64,0x345031E2,0x38C136A1,0x3CB13ACF,0x40253E8A,
-0x42B34181,0x44DE43D3,0x466745A8,0x47774711,0x480F47C7,0x486D4847,0x48C2488F,0x490D48F7,
-0x489248E4,0x47AD4835,0x465E471C,0x44DF45A0,0x4319440F,0x4143422B,0x3F54404D,0x3D3B3E46,
-0x3ADD3C08,0x385039AF,0x354C36DD,0x320633B3,0x2EC53064,0x2BB52D4E,0x283D29FB,0x24892670,
-0x208A2285,0x1C8F1E9B,0x184C1A71,0x13CA1613,0x0F301169,0x0AB10CFB,0x0601085E,0x0128039A,
-0xFC44FEBF,0xF77CF9E3,0xF291F50A,0xED79F00F,0xE87EEB0A,0xE370E5FE,0xDE6EE0E3,0xD97ADBF3,
-0xD489D703,0xCFCFD20D,0xCB42CD8E,0xC694C8FD,0xC1E6C437,0xBD6EBF9F,0xB912BB3E,0xB535B717,
-0xB155B34F,0xAD6AAF53,0xA9AEAB86,0xA61CA7E4,0xA2E5A46A,0xA036A17F,0x9DBB9EF6,0x9BA29C9F,
-0x99D39ABA,0x981E98F2,0x96AD9757,0x958C961A,0x949B9504,0x9449946A,0x9435943D,0x94519440,
-0x949D9465,0x950D94D4,0x95A69553,0x96B89621,0x97FB9756,0x997798B7,0x9B569A66,0x9D259C3B,
-0x9F589E2C,0xA1FFA0A2,0xA487A342,0xA76FA5F3,0xAAC5A917,0xAE14AC62,0xB1C1AFE1,0xB5B3B3C1,
-0xB9DAB7C1,0xBE3DBC02,0xC2DCC087,0xC7B5C543,0xCCC4CA38,0xD1DDCF4B,0xD733D48A,0xDC7DD9D9,
-0xE1BEDF1A,0xE722E475,0xEC94E9E5,0xF23EEF5C,0xF832F532,0xFE23FB2B,0x043F012D,0x0A7D075B,
-0x10890D92,0x168E1380,0x1CCC19A9,0x22591FA7,0x276E24F2,0x2C0629CD,0x303B2E20,0x340D3232,
-0x375A35BF,0x3A1738C7,0x3C753B49,0x3E823D8B,0x3FFE3F4A,0x414140A4,0x421541C3,0x42994264,
-0x42FB42D3,0x43384314,0x43534349,0x431B4346,0x428742CE,0x41F3423F,0x410F4188,0x400C4098,
-0x3EB93F6B,0x3D583E0E,0x3BD43C96,0x39E63AF1,0x37C038DB,0x356536A3,0x32E5342A,0x304731A2,
-0x2D822EE1,0x2ABA2C26,0x27BE293E,0x24B02640,0x21952329,0x1E071FDC,0x1A1F1C15,0x160B181B,
-0x11D013E7,0x0DA50FB5,0x09760B8A,0x054E076C,0x00DB031F,0xFC45FE92,0xF79BF9F4,0xF2F3F54D,
-0xEE27F087,0xE955EBBC,0xE4B7E703,0xE043E285,0xDBC9DE15,0xD706D964,0xD292D4C6,0xCE52D079,
-0xCA18CC42,0xC5CCC7F6,0xC18CC3AE,0xBD6ABF6D,0xB9C2BB95,0xB621B7DE,0xB2D0B471,0xAF8EB12E,
-0xAC4FADED,0xA94CAAC0,0xA6A7A7F6,0xA479A583,0xA29BA383,0xA0B2A1AF,0x9EE39FCB,0x9D4F9E1B,
-0x9C269CB0,0x9B209BA4,0x9A329AAB,0x995199BE,0x98A998F6,0x98179860,0x97D397E6,0x97EC97D8,
-0x980F97FE,0x9824980E,0x98959851,0x995098ED,0x9A3799C5,0x9B1E9AAE,0x9C249B97,0x9D839CBC,
-0x9F519E6B,0xA0F1A021,0xA2A7A1C8,0xA489A388,0xA6EBA5AE,0xA97AA830,0xAC31AACB,0xAEFDADA2,
-0xB20BB07F,0xB555B3A6,0xB8CDB707,0xBC77BA9D,0xC061BE69,0xC42FC24F,0xC80BC618,0xCBEBC9F7,
-0xCFD1CDDF,0xD3BAD1C1,0xD7CBD5BB,0xDBF6D9D4,0xE05CDE27,0xE4C2E27E,0xE98BE71F,0xEE2CEBD6,
-0xF2E3F07E,0xF7CFF54E,0xFCE2FA58,0x0246FF89,0x07C8050C,0x0D3B0A7C,0x12E61000,0x18D215D0,
-0x1EC11BCE,0x24A821B4,0x2AB427A4,0x30D02DC2,0x36E633DB,0x3CD439DD,0x42CC3FD1,0x48C145C8,
-0x4E944BAF,0x5452517B,0x59D5571F,0x5F135C80,0x63CE6183,0x67E365EA,0x6B6869B5,0x6E456CEA,
-0x70BC6F8F,0x72AC71C4,0x74517383,0x75A77508,0x76A57633,0x77527705,0x77CE7794,0x780F77F5,
-0x78207824,0x78137816,0x7809780D,0x779C77DD,0x770D7752,0x768B76C9,0x75F57640,0x75297591,
-0x744874B8,0x734C73C8,0x722272BD,0x70A87169,0x6EF26FD1,0x6D036DFD,0x6AF06BFE,0x689669C6,
-0x65EC674B,0x62F46473,0x6000617D,0x5CEA5E7C,0x597C5B42,0x55DE57AF,0x52495410,0x4EBE5088,
-0x4AC04CCB,0x4687489F,0x426E4485,0x3E344055,0x39FF3C1A,0x35B537E1,0x314A3381,0x2CCC2F0F,
-0x282B2A81,0x237E25D6,0x1EC32122,0x19CE1C56,0x148D1725,0x0FAC1218,0x0AEE0D4A,0x06020880,
-0x01280390,0xFC52FEC0,0xF782F9E5,0xF2C8F524,0xEE11F072,0xE940EBA7,0xE4A4E6E5,0xE066E28A,
-0xDC07DE39,0xD7D8D9EB,0xD3B4D5C8,0xCF79D19B,0xCB3DCD58,0xC730C930,0xC339C536,0xBF37C139,
-0xBB45BD3A,0xB76CB951,0xB393B575,0xB024B1CC,0xAD0BAE87,0xAA44ABA5,0xA79FA8ED,0xA51AA657,
-0xA2E4A3F4,0xA10EA1F7,0x9F5AA02F,0x9DE89E97,0x9CBC9D4E,0x9BB09C33,0x9ACB9B3C,0x99EE9A5D,
-0x98FE9977,0x985B98A1,0x9808982C,0x97D297E9,0x97CD97CA,0x97B097C1,0x979A97A2,0x97BD97A0,
-0x983A97F7,0x98A99878,0x990E98DC,0x9995994C,0x9A1899D8,0x9A9F9A58,0x9B439AEE,0x9BE29B96,
-0x9C959C3C,0x9D749D01,0x9E8E9DFA,0x9FD89F31,0xA12DA081,0xA2A0A1DE,0xA41CA36B,0xA575A4C1,
-0xA718A63B,0xA8DCA7F7,0xAAE7A9D7,0xAD19ABFF,0xAF3EAE31,0xB154B053,0xB36FB257,0xB5BFB493,
-0xB830B6F4,0xBA99B96A,0xBD42BBE2,0xC037BEBB,0xC34CC1B9,0xC67EC4E1,0xC990C803,0xCCAACB15,
-0xCFC0CE2E,0xD31CD160,0xD6B5D4DE,0xDA6ED88C,0xDE53DC5D,0xE23AE04D,0xE616E42A,0xEA21E814,
-0xEE48EC30,0xF292F06D,0xF6D1F4A5,0xFB7CF910,0x0073FDF4,0x054F02E0,0x0A2907BB,0x0F0D0C95,
-0x13E9117A,0x18BB1654,0x1D981B22,0x22992019,0x27862511,0x2C7C29FC,0x318A2F04,0x36BA341C,
-0x3BFE395C,0x413F3E9E,0x464F43D1,0x4B5248D1,0x50584DD8,0x551F52C1,0x59A5576A,0x5DB85BC0,
-0x61605F97,0x64946308,0x67836611,0x6A3A68E5,0x6C976B73,0x6E9F6DA8,0x702B6F70,0x714D70C6,
-0x720D71B0,0x72CE726D,0x73707326,0x73D973AA,0x74207400,0x74447438,0x744C7450,0x74417449,
-0x744B7449,0x73D7742C,0x73067376,0x7225729E,0x712571AC,0x6FFB7099,0x6EA86F5B,0x6D126DEC,
-0x6B4C6C2E,0x69836A6D,0x676C6886,0x652C6643,0x62F76412,0x608F61C8,0x5E0E5F4F,0x5B885CCD,
-0x58CD5A31,0x55D15755,0x527C5431,0x4F0B50C1,0x4B584D39,0x47974973,0x43EC45C8,0x40164208,
-0x3C193E1F,0x37CE39FC,0x3374359E,0x2F20314F,0x2AA22CE5,0x2629285F,0x21E32400,0x1D771FB6,
-0x18F41B3C,0x145316AA,0x0FB21200,0x0B3A0D6F,0x06DD090B,0x029104B3,0xFE580079,0xFA4AFC48,
-0xF66BF856,0xF29CF485,0xEEAEF0A0,0xEADDECC0,0xE718E8FA,0xE35EE534,0xDFD2E192,0xDC5EDE19,
-0xD8F2DAA3,0xD5BCD749,0xD2C4D43B,0xCFCED145,0xCD01CE63,0xCA5FCBAD,0xC7C4C915,0xC541C67D,
-0xC2EEC413,0xC0C5C1D1,0xBE9DBFB4,0xBC83BD8D,0xBA3EBB66,0xB7F3B91A,0xB5B1B6C8,0xB3B6B4AA,
-0xB1EBB2CF,0xB018B103,0xAE1DAF18,0xAC67AD3A,0xAAA7AB91,0xA8D1A9B9,0xA721A7FB,0xA582A64F,
-0xA408A4C4,0xA2A8A355,0xA148A1EF,0xA010A0A4,0x9EF79F80,0x9DF69E70,0x9D099D79,0x9C219C94,
-0x9B3A9BAA,0x9A749AD2,0x99BB9A19,0x98F7995B,0x984A9899,0x97C49806,0x972A9780,0x96C096EC,
-0x96AE96AE,0x96BD96B8,0x96DD96CC,0x971096FE,0x9745972F,0x97889763,0x97F097BA,0x988D9838,
-0x995498F1,0x9A2F99BF,0x9B2E9AAA,0x9C3D9BB6,0x9D3A9CBE,0x9E469DC0,0x9F719ED4,0xA0EFA026,
-0xA28BA1B7,0xA3FBA34F,0xA552A4AB,0xA6BEA601,0xA863A78B,0xAA2FA944,0xAC13AB25,0xAE05AD0C,
-0xB026AF13,0xB288B14B,0xB4EFB3C2,0xB743B617,0xB977B860,0xBBB7BA93,0xBE09BCDA,0xC092BF4A,
-0xC32BC1DD,0xC5A2C46B,0xC832C6E5,0xCAE9C98F,0xCDBCCC55,0xD0A0CF2D,0xD3A9D222,0xD67BD51E,
-0xD91CD7CC,0xDBC9DA74,0xDE84DD2A,0xE13EDFE2,0xE409E2A0,0xE6EBE57A,0xE9BAE857,0xEC66EB1A,
-0xEEF4EDA3,0xF1D4F062,0xF4E5F356,0xF821F68D,0xFB1BF996,0xFE6AFCC3,0x01930002,0x04B60320,
-0x07F2064F,0x0B52099C,0x0EF60D18,0x12AC10D3,0x16551483,0x1A341839,0x1E6C1C4C,0x22932080,
-0x26C324AA,0x2B0628E2,0x2F5F2D30,0x33A93186,0x37F535CF,0x3C4C3A13,0x40DC3E8F,0x45544319,
-0x49B3478B,0x4E094BE5,0x52395022,0x5643544B,0x59ED5825,0x5D385BA4,0x60035EA6,0x62AF6163,
-0x654263FE,0x67BD6693,0x69A568BF,0x6B446A7D,0x6C9B6BFC,0x6D8E6D20,0x6E4E6DF7,0x6ED06E98,
-0x6F1C6EFE,0x6F0D6F23,0x6EDE6EF5,0x6EB96ECD,0x6E706E9B,0x6E106E46,0x6D946DD9,0x6CF86D46,
-0x6C2C6C9F,0x6AFF6B97,0x69D26A71,0x68A6693F,0x6779681F,0x660266C8,0x644B652F,0x6262635A,
-0x601D6149,0x5DA15EDF,0x5B035C54,0x585159A7,0x55AD5709,0x52605421,0x4EEB50A4,0x4B474D1A,
-0x47EA498F,0x44A9464D,0x416A430F,0x3E2A3FC9,0x3AE93C8E,0x37753933,0x33CC35A8,0x302331F4,
-0x2C822E52,0x28982A99,0x24F626AD,0x21BB2353,0x1E61200C,0x1B111CAA,0x17F11986,0x147D164A,
-0x10BC129D,0x0D1C0EE9,0x09880B4A,0x05E107BA,0x02710418,0xFF7800ED,0xFC8AFE05,0xF99AFB0E,
-0xF6BCF829,0xF3EEF551,0xF11DF283,0xEE4EEFB4,0xEB67ECDE,0xE8A1E9FA,0xE605E753,0xE315E498,
-0xE030E197,0xDD62DED4,0xDA58DBDE,0xD790D8F3,0xD522D653,0xD2FAD40A,0xD0D5D1E5,0xCEAFCFC4,
-0xCC97CDA1,0xCAD4CBAF,0xC8DEC9E7,0xC69AC7C5,0xC42FC569,0xC181C2EB,0xBE84BFF6,0xBC24BD43,
-0xBA0FBB19,0xB7EFB900,0xB5D2B6E2,0xB3CAB4D0,0xB1B9B2C0,0xAFD9B0BC,0xAE01AEF4,0xABE4ACFD,
-0xA998AAB9,0xA7B1A8A1,0xA5FEA6D8,0xA454A522,0xA2ECA3A0,0xA188A238,0xA041A0DC,0x9F079F9F,
-0x9E0D9E7F,0x9D3A9D9D,0x9C7B9CDB,0x9BB49C1B,0x9AEA9B48,0x9A5E9A9A,0x9A299A37,0x99EF9A0D,
-0x99B199D5,0x99779989,0x997E996C,0x99AC9994,0x99FF99D4,0x9A6B9A31,0x9AF79AB1,0x9B509B23,
-0x9BD39B8E,0x9C7B9C2A,0x9D619CE9,0x9E3C9DD5,0x9F0F9EAC,0x9FE29F78,0xA0A7A04A,0xA145A0F6,
-0xA1EEA195,0xA2ADA246,0xA373A310,0xA427A3CC,0xA503A490,0xA5BCA569,0xA661A607,0xA736A6CD,
-0xA805A79E,0xA8F1A873,0xA9E6A96F,0xAAB9AA54,0xAB7BAB15,0xAC72ABF4,0xAD7CACFC,0xAE7EADFB,
-0xAFABAF0F,0xB0C6B040,0xB1C3B14E,0xB2A1B232,0xB3C7B32C,0xB537B481,0xB6A6B5F3,0xB80AB759,
-0xB977B8B8,0xBB27BA4F,0xBCD6BC00,0xBEBDBDBE,0xC0D5BFC9,0xC2F9C1DF,0xC541C41D,0xC773C654,
-0xC9EEC8AB,0xCC96CB3A,0xCF74CE07,0xD234D0D5,0xD4F8D396,0xD7B2D64E,0xDA71D910,0xDD45DBD4,
-0xE034DEBB,0xE33EE1B2,0xE676E4DB,0xE995E805,0xECCEEB2C,0xF03EEE81,0xF3D5F207,0xF774F59E,
-0xFB31F94F,0xFED8FD06,0x026D00A3,0x05FF0435,0x099207CB,0x0D140B4D,0x10AF0EE4,0x14621287,
-0x181A1642,0x1BC819F5,0x1F6E1D9C,0x231E2148,0x26E32500,0x2AA428C6,0x2E5A2C7A,0x32213044,
-0x35D233FE,0x399F37B7,0x3D6D3B85,0x41513F5E,0x45264340,0x48FA470F,0x4CB64AD9,0x505E4E84,
-0x54035235,0x579155CD,0x5B07594F,0x5E505CB2,0x616D5FE3,0x647262F0,0x675465EB,0x6A0768B6,
-0x6C8D6B52,0x6EDC6DBC,0x70E46FE4,0x72CB71D8,0x748D73B1,0x762A7561,0x77A676F2,0x78FA7856,
-0x7A227991,0x7B277AA5,0x7C087B9E,0x7CB17C61,0x7D3D7CF9,0x7DB27D78,0x7E167DE4,0x7E627E41,
-0x7E997E86,0x7EBE7EB2,0x7ED97ED1,0x7EE27EE0,0x7EE27EDE,0x7EE97EE3,0x7EE87EE7,0x7EDA7EE2,
-0x7EC57ED2,0x7EB17EC1,0x7E927EA6,0x7E6A7E84,0x7E2D7E52,0x7DDB7E0A,0x7D757DB0,0x7CF27D3D,
-0x7C5C7CAE,0x7BB37C0C,0x7AEE7B54,0x7A167A85,0x792C79A4,0x782778AB,0x770C779C,0x75DA767A,
-0x74877535,0x732073DB,0x719B7266,0x6FF370CB,0x6E216F0B,0x6C2A6D2B,0x6A086B21,0x67D368F4,
-0x658566B4,0x63186457,0x608C61DD,0x5DD35F35,0x5B025C6D,0x58215990,0x552E56A9,0x521F53A8,
-0x4F035094,0x4BCA4D6D,0x488A4A2F,0x455846F7,0x422D43C6,0x3EFF4098,0x3BD03D68,0x38A23A3D,
-0x357B3710,0x326133F0,0x2F4D30D5,0x2C412DC5,0x29462AC5,0x264827CB,0x235224CC,0x205E21D4,
-0x1D6E1EE0,0x1A871BF6,0x17B01918,0x14E01646,0x121B137B,0x0F6D10C3,0x0CC90E1A,0x0A360B7D,
-0x07B508F1,0x054B067D,0x02F0041D,0x009401C5,0xFE32FF64,0xFBD3FD00,0xF97FFAAA,0xF729F854,
-0xF4CEF5FD,0xF270F3A3,0xF00DF143,0xEDADEEDD,0xEB50EC7F,0xE8FBEA22,0xE6ADE7D2,0xE45EE583,
-0xE219E33A,0xDFDEE0FA,0xDDABDEC4,0xDB7BDC94,0xD954DA69,0xD72AD83E,0xD504D612,0xD2E2D3F0,
-0xD0BBD1D0,0xCE9BCFAB,0xCC84CD92,0xCA6BCB79,0xC85CC961,0xC653C755,0xC459C554,0xC269C360,
-0xC087C17B,0xBEB3BFA4,0xBCF5BDD6,0xBB43BC1B,0xB99ABA6A,0xB7FDB8C8,0xB674B736,0xB4FAB5B3,
-0xB38EB43D,0xB239B2DE,0xB0F0B192,0xAFB9B051,0xAE92AF22,0xAD7AAE02,0xAC70ACF4,0xAB73ABF3,
-0xAA85AAFF,0xA9AFAA1D,0xA8E4A94B,0xA822A880,0xA76EA7C7,0xA6D2A71D,0xA648A68B,0xA5D0A60A,
-0xA564A59B,0xA508A536,0xA4B9A4DF,0xA478A496,0xA447A45B,0xA429A432,0xA40BA417,0xA3EDA3FA,
-0xA3D7A3E4,0xA3C8A3D5,0xA3BEA3C6,0xA3B8A3B8,0xA3B5A3B5,0xA3B3A3B3,0xA3BEA3B5,0xA3CDA3C2,
-0xA3E1A3D4,0xA3FAA3EC,0xA415A407,0xA43DA429,0xA471A457,0xA4A1A486,0xA4C8A4B0,0xA4ECA4DA,
-0xA512A502,0xA539A52B,0xA55EA551,0xA582A571,0xA5A3A592,0xA5C3A5B6,0xA5E9A5D6,0xA61CA5FF,
-0xA658A635,0xA699A673,0xA6E3A6B8,0xA738A709,0xA796A763,0xA806A7CB,0xA882A841,0xA905A8C0,
-0xA98CA946,0xAA21A9D5,0xAAC1AA71,0xAB6EAB19,0xAC27ABCC,0xACECAC8A,0xADBDAD55,0xAEA0AE31,
-0xAF90AF18,0xB08DB009,0xB197B10A,0xB2B0B21D,0xB3D9B342,0xB511B477,0xB659B5B6,0xB7AEB700,
-0xB914B85B,0xBA8BB9CA,0xBC12BB48,0xBDA1BCD6,0xBF34BE6E,0xC0D0C007,0xC272C1A1,0xC419C345,
-0xC5CFC4F3,0xC789C6AA,0xC944C863,0xCB01CA1F,0xCCC3CBDD,0xCE89CDA2,0xD058CF6E,0xD22CD143,
-0xD407D31B,0xD5ECD4FC,0xD7D9D6E2,0xD9CED8D2,0xDBC5DAC9,0xDDC1DCC3,0xDFC0DEBF,0xE1C0E0BF,
-0xE3BDE2BE,0xE5BCE4BC,0xE7BBE6BD,0xE9B6E8B9,0xEBAEEAAE,0xEDA3ECA6,0xEF9BEEA0,0xF19AF09D,
-0xF39EF29E,0xF5AAF4A5,0xF7BCF6B1,0xF9D9F8C7,0xFC01FAE9,0xFE2FFD13,0x0062FF44,0x029D017C,
-0x04E103BE,0x0731060C,0x09860860,0x0BDC0AB2,0x0E330D07,0x10940F63,0x12FC11C8,0x156B1433,
-0x17E516A7,0x1A641923,0x1CEC1BA8,0x1F7D1E34,0x221B20C9,0x24C1236D,0x276F2618,0x2A2628CA,
-0x2CE72B85,0x2FB22E4C,0x3280311B,0x355233EB,0x382D36C1,0x3B043997,0x3DDA3C6C,0x40AF3F45,
-0x4380421C,0x464E44EB,0x491B47B8,0x4BDF4A7F,0x4E9C4D40,0x51564FFA,0x540052AB,0x569C554E,
-0x592C57E6,0x5BB05A72,0x5E255CEF,0x608D5F5C,0x62DD61B7,0x651563FB,0x67376627,0x6940683D,
-0x6B296A39,0x6D016C1B,0x6EBE6DE5,0x705C6F90,0x71E27123,0x7351729D,0x74A47400,0x75D87546,
-0x76EA766C,0x77D37766,0x7898783A,0x794078F2,0x79D3798E,0x7A4E7A12,0x7AB27A7F,0x7B067ADC,
-0x7B467B27,0x7B737B60,0x7B927B88,0x7BA57B9D,0x7BAB7BA4,0x7BA17BA2,0x7B897B96,0x7B687B7B,
-0x7B3E7B55,0x7B067B26,0x7AC87AED,0x7A867AAA,0x7A367A5D,0x79D97A09,0x797179A7,0x78FB7935,
-0x787578B6,0x77E1782B,0x773B7791,0x767F76E3,0x75B37622,0x74D4754D,0x73E27464,0x72D97365,
-0x71B8724E,0x70867121,0x6F3F6FE1,0x6DDB6E8A,0x6C5D6D1A,0x6ACC6B97,0x692669FB,0x67696849,
-0x65986685,0x63B764AB,0x61BF62B9,0x5FAF60B7,0x5D915EA2,0x5B665C7E,0x59275A48,0x56D75803,
-0x547655AB,0x52085344,0x4F8E50D1,0x4D0A4E52,0x4A7A4BC8,0x47DF4932,0x453E4690,0x429943E8,
-0x3FEF4140,0x3D453E9A,0x3AA03BF3,0x38023952,0x356A36B7,0x32D3341D,0x3042318A,0x2DB62EFD,
-0x2B322C75,0x28B629F5,0x26402778,0x23D12505,0x2168229B,0x1F022036,0x1CA11DD1,0x1A471B74,
-0x17F41921,0x15AC16D3,0x136A148C,0x112E124B,0x0EFC1011,0x0CD50DE1,0x0AB20BBB,0x0892099A,
-0x067D0782,0x04700574,0x02690369,0x00630162,0xFE5AFF5D,0xFC56FD58,0xFA56FB56,0xF855F954,
-0xF653F752,0xF453F54E,0xF24FF34B,0xF04AF14B,0xEE47EF4B,0xEC45ED4A,0xEA43EB4B,0xE846E94C,
-0xE64CE74E,0xE450E550,0xE255E357,0xE05FE15F,0xDE6BDF68,0xDC77DD75,0xDA85DB81,0xD898D98F,
-0xD6AFD7A5,0xD4C8D5BF,0xD2E2D3D7,0xD0FED1F1,0xCF21D013,0xCD50CE3D,0xCB87CC6E,0xC9C2CAA2,
-0xC804C8DE,0xC654C72A,0xC4ADC582,0xC30EC3E0,0xC17DC246,0xBFFAC0BB,0xBE84BF3E,0xBD1EBDD1,
-0xBBC4BC70,0xBA72BB19,0xB92DB9CD,0xB7F5B88F,0xB6C8B759,0xB5A8B631,0xB490B519,0xB386B40D,
-0xB28BB30C,0xB19EB219,0xB0BDB130,0xAFECB053,0xAF24AF86,0xAE67AEC4,0xADBAAE11,0xAD19AD6B,
-0xAC8BACD2,0xAC09AC48,0xAB8FABC7,0xAB1BAB4F,0xAAAFAAE1,0xAA49AA7B,0xA9EDAA17,0xA996A9BE,
-0xA940A96D,0xA8F0A91B,0xA8A8A8CF,0xA865A887,0xA81FA842,0xA7DEA7FE,0xA7A1A7C1,0xA768A788,
-0xA739A753,0xA70FA725,0xA6E8A6FD,0xA6CAA6DD,0xA6B4A6C2,0xA6A1A6AC,0xA693A698,0xA689A689,
-0xA67CA67C,0xA66BA66E,0xA65BA660,0xA654A655,0xA651A651,0xA64FA650,0xA649A64E,0xA647A64A,
-0xA649A649,0xA650A64D,0xA65BA655,0xA669A663,0xA67FA674,0xA69DA68B,0xA6BFA6AA,0xA6E3A6D0,
-0xA710A6FC,0xA747A72E,0xA782A766,0xA7C1A7A2,0xA809A7E9,0xA856A833,0xA8ACA880,0xA90AA8D9,
-0xA96AA93B,0xA9D2A99F,0xAA46AA0D,0xAAC2AA86,0xAB45AB03,0xABD2AB8B,0xAC6AAC20,0xAD0CACBE,
-0xADB6AD64,0xAE6BAE13,0xAF2BAECE,0xAFF6AF92,0xB0C6B05D,0xB19BB12F,0xB279B20B,0xB359B2EC,
-0xB441B3CF,0xB52DB4B9,0xB623B5A9,0xB71FB6A1,0xB81DB79D,0xB921B89D,0xBA2BB9A4,0xBB37BAB0,
-0xBC4ABBC1,0xBD63BCD7,0xBE7EBDF2,0xBFA2BF13,0xC0CDC03A,0xC1F9C164,0xC32BC290,0xC45CC3BE,
-0xC58FC4F3,0xC6C6C62B,0xC805C766,0xC943C8A3,0xCA83C9E0,0xCBC4CB23,0xCD0ACC67,0xCE59CDB4,
-0xCFAFCF05,0xD107D059,0xD267D1B4,0xD3CFD31B,0xD53FD487,0xD6B9D5FA,0xD83BD777,0xD9C8D8FD,
-0xDB5BDA8A,0xDCF4DC20,0xDE92DDC0,0xE039DF65,0xE1E7E112,0xE399E2C1,0xE554E476,0xE713E62F,
-0xE8D8E7EE,0xEAA0E9BB,0xEC72EB8A,0xEE49ED5A,0xF027EF34,0xF20BF118,0xF3FBF2FF,0xF5EFF4F0,
-0xF7E8F6E8,0xF9E8F8E4,0xFBEDFAEA,0xFDF7FCF3,0x0007FEFE,0x0219010F,0x042D0326,0x0644053B,
-0x085E0751,0x0A77096C,0x0C8F0B89,0x0EA80DA5,0x10C30FC0,0x12E211DA,0x150113F3,0x17231613,
-0x19461837,0x1B621A52,0x1D7F1C6E,0x1FA01E8F,0x21C320B4,0x23E522D2,0x260724F3,0x28262715,
-0x2A472936,0x2C652B54,0x2E7D2D6E,0x30932F8C,0x32AB31A6,0x34C433BC,0x36DB35D3,0x38F037EA,
-0x3B0739FD,0x3D1E3C12,0x3F353E2A,0x414B4042,0x4366425A,0x45834476,0x479E4692,0x49BC48AD,
-0x4BD94AC8,0x4DEF4CE1,0x50074EFC,0x521C5115,0x5430532A,0x563F553C,0x58485747,0x5A49594B,
-0x5C445B47,0x5E385D3E,0x60215F31,0x62026116,0x63DC62F1,0x65A864C1,0x67686688,0x691C6843,
-0x6AC569F1,0x6C626B93,0x6DF16D2A,0x6F716EB1,0x70DC7028,0x722A718A,0x735072C6,0x744A73D1,
-0x751F74B6,0x75D5757B,0x766E7621,0x76EF76AD,0x77587723,0x77A87782,0x77E577CB,0x78137801,
-0x782D7826,0x78377838,0x7836783A,0x78277830,0x780A781B,0x77E177FB,0x77AE77CC,0x77707793,
-0x7725774D,0x76CE76FC,0x766876A0,0x75F37632,0x756D75B4,0x74D37525,0x74277483,0x736C73CE,
-0x729F730A,0x71C37235,0x70D5714D,0x6FD87058,0x6EC76F52,0x6DAA6E3B,0x6C7C6D15,0x6B3B6BDD,
-0x69ED6A96,0x68916943,0x672467E0,0x65AA666A,0x642064E7,0x62876357,0x60E361B7,0x5F35600B,
-0x5D7D5E5B,0x5BB75C9D,0x59EA5AD2,0x581458FD,0x56365720,0x54545545,0x526E5364,0x5083517C,
-0x4E984F90,0x4CAB4DA2,0x4ABB4BB3,0x48CA49C5,0x46D547D0,0x44DD45D8,0x42E743E1,0x40F341EE,
-0x3EFB3FF9,0x3D063E04,0x3B123C0E,0x39203A18,0x372D3825,0x35393631,0x3348343F,0x315A3254,
-0x2F6D3067,0x2D802E79,0x2B972C8D,0x29B32AA5,0x27CD28C0,0x25E526DB,0x240124F3,0x2221230F,
-0x20412131,0x1E611F52,0x1C801D70,0x1A9D1B8A,0x18BC19A7,0x16DB17C8,0x14FA15E9,0x13171409,
-0x1139122B,0x0F5C104F,0x0D800E70,0x0BA70C93,0x09CE0ABA,0x07F408DF,0x06220707,0x04500539,
-0x0285036D,0x00BA01A0,0xFEF2FFD7,0xFD2BFE0F,0xFB63FC47,0xF9A1FA84,0xF7E3F8C2,0xF629F703,
-0xF46FF549,0xF2B7F392,0xF104F1DD,0xEF58F02F,0xEDADEE85,0xEC06ECD8,0xEA66EB31,0xE8CBE993,
-0xE735E7FC,0xE5A2E66A,0xE412E4D8,0xE288E34B,0xE100E1C4,0xDF7AE042,0xDDFEDEC0,0xDC85DD41,
-0xDB09DBC6,0xD98DDA4C,0xD81AD8D5,0xD6ACD762,0xD53FD5F5,0xD3D7D48B,0xD272D325,0xD111D1C2,
-0xCFB8D066,0xCE5ACF0B,0xCD09CDB3,0xCBC1CC63,0xCA7ACB18,0xC935C9D3,0xC7F7C892,0xC6BCC758,
-0xC587C622,0xC458C4EE,0xC32BC3BF,0xC202C293,0xC0DBC16B,0xBFBBC049,0xBEA2BF2D,0xBD8ABE14,
-0xBC7CBD01,0xBB74BBF6,0xBA70BAF2,0xB977B9F6,0xB885B8FE,0xB798B80C,0xB6B9B726,0xB5E0B647,
-0xB50BB570,0xB43FB4A1,0xB37CB3DC,0xB2C2B31F,0xB20FB267,0xB168B1BB,0xB0C6B116,0xB028B074,
-0xAF93AFDF,0xAF09AF54,0xAE88AECC,0xAE0FAE4C,0xAD9FADD6,0xAD35AD66,0xACD0ACFD,0xAC73ACA1,
-0xAC1DAC49,0xABD1ABF9,0xAB8BABB1,0xAB4EAB71,0xAB14AB33,0xAADCAAF8,0xAAACAAC5,0xAA83AA96,
-0xAA5AAA6A,0xAA31AA43,0xAA0AAA1E,0xA9EBA9FB,0xA9CAA9DD,0xA9AAA9BF,0xA990A9A1,0xA977A986,
-0xA95FA970,0xA94EA95C,0xA942A949,0xA939A93C,0xA932A933,0xA934A931,0xA934A934,0xA932A933,
-0xA939A937,0xA943A93E,0xA94CA948,0xA955A952,0xA962A95D,0xA970A96B,0xA97FA97B,0xA993A98A,
-0xA9A8A99C,0xA9C0A9B0,0xA9DDA9CA,0xA9F6A9E4,0xAA13AA01,0xAA35AA21,0xAA5CAA44,0xAA84AA6C,
-0xAAB2AA9A,0xAAE7AACE,0xAB21AB00,0xAB61AB3A,0xABA3AB7F,0xABE7ABC1,0xAC2CAC06,0xAC7BAC53,
-0xACD3ACA9,0xAD31AD02,0xAD92AD5E,0xADF8ADC2,0xAE63AE2C,0xAED7AE9C,0xAF52AF12,0xAFD3AF8E,
-0xB05AB013,0xB0E7B09E,0xB17AB12D,0xB212B1C1,0xB2B0B25D,0xB352B2FF,0xB3F9B3A3,0xB4A4B44D,
-0xB554B4FD,0xB60CB5B1,0xB6C5B669,0xB781B725,0xB842B7E4,0xB90AB8A7,0xB9D6B96E,0xBAA5BA3C,
-0xBB78BB10,0xBC4FBBE5,0xBD2BBCBC,0xBE09BD98,0xBEEFBE79,0xBFD5BF61,0xC0BAC045,0xC1A6C12F,
-0xC298C21D,0xC38DC310,0xC484C406,0xC57DC4FF,0xC678C5F9,0xC77AC6F8,0xC880C7FE,0xC989C904,
-0xCA96CA0B,0xCBA7CB19,0xCCBFCC30,0xCDDCCD4D,0xCEFACE6A,0xD022CF8C,0xD14DD0B7,0xD281D1E9,
-0xD3BBD322,0xD4FED460,0xD646D5A3,0xD796D6EB,0xD8EBD83D,0xDA43D995,0xDBA5DAF4,0xDD0FDC5C,
-0xDE7FDDC7,0xDFF2DF37,0xE16CE0AD,0xE2F1E22D,0xE476E3B3,0xE601E53C,0xE793E6CB,0xE92BE85F,
-0xEAC9E9F8,0xEC68EB95,0xEE0BED36,0xEFB1EEDC,0xF15BF086,0xF30CF236,0xF4C1F3E8,0xF677F59E,
-0xF82BF752,0xF9E4F909,0xFBA0FAC4,0xFD60FC81,0xFF23FE3E,0x00E1FFFD,0x029D01BB,0x045D037C,
-0x061D053F,0x07E10701,0x09A708C6,0x0B6D0A89,0x0D300C4A,0x0EF40E0B,0x10BA0FD2,0x127C1198,
-0x143E135F,0x16041524,0x17CA16E8,0x198D18A9,0x1B511A71,0x1D131C34,0x1ED61DF4,0x20981FB6,
-0x225D2179,0x2423233E,0x25E72506,0x27AD26D0,0x29782899,0x2B472A5F,0x2D152C2C,0x2EE42DFB,
-0x30B52FCB,0x3289319D,0x34643373,0x3640354F,0x3819372A,0x39F73907,0x3BD83AE6,0x3DBC3CC8,
-0x3FA23EAF,0x418B4096,0x43744280,0x455F446B,0x47464654,0x4930483D,0x4B214A2B,0x4D144C19,
-0x4F014E05,0x50EA4FF1,0x52D451DE,0x54C053C8,0x56A655B0,0x58835795,0x5A5C5975,0x5C335B48,
-0x5E005D17,0x5FC35EE0,0x617B60A1,0x63296254,0x64CC63FF,0x6666659B,0x67F6672C,0x697568B3,
-0x6AE66A30,0x6C4A6B9C,0x6DA16CFB,0x6EE16E46,0x700B6F79,0x71207097,0x722171A4,0x7311729E,
-0x73F17385,0x74C4745B,0x75897525,0x763D75E3,0x76E37691,0x777F7732,0x781077CA,0x789B7859,
-0x791B78DC,0x79857951,0x79DB79B1,0x7A247A00,0x7A5C7A42,0x7A8A7A76,0x7AAB7A9D,0x7AC27AB9,
-0x7ACD7ACC,0x7ACF7AD2,0x7ACA7AD1,0x7ABC7AC5,0x7AA57AB0,0x7A847A95,0x7A5F7A72,0x7A327A46,
-0x79FE7A15,0x79C679E1,0x798779A6,0x79437963,0x78F7791D,0x78A078CD,0x78417873,0x77D9780C,
-0x7764779E,0x76E57724,0x765F76A1,0x75CD7612,0x7530757C,0x748474DB,0x73CD742C,0x730D7370,
-0x724272A9,0x716971D8,0x708670FD,0x6F967011,0x6E996F17,0x6D916E13,0x6C7A6D05,0x6B566BE9,
-0x6A276AC1,0x68EB698D,0x67A5684E,0x66576705,0x64FC65AF,0x6398644B,0x622962DF,0x60AB616A,
-0x5F275FEC,0x5D9E5E65,0x5C0A5CD7,0x5A6F5B40,0x58CD599E,0x572457F6,0x5574564B,0x53BF5498,
-0x520652E0,0x50495124,0x4E884F67,0x4CC54DAB,0x4B014BE8,0x49414A24,0x477E485E,0x45B74697,
-0x43EF44D1,0x422C430D,0x406B414A,0x3EAC3F89,0x3CEE3DCA,0x3B2F3C0E,0x39743A54,0x37BE389B,
-0x360B36E3,0x3459352B,0x32A7337A,0x30FC31CF,0x2F573027,0x2DB22E7F,0x2C0A2CDC,0x2A6A2B3B,
-0x28CD299C,0x27352801,0x25A1266C,0x240F24D6,0x227F2343,0x20F021B1,0x1F602022,0x1DD21E99,
-0x1C481D10,0x1ABD1B82,0x193419F5,0x17AA186D,0x162416E9,0x149E1565,0x131913DD,0x11941251,
-0x100D10C8,0x0E890F45,0x0D040DC2,0x0B7F0C3E,0x09FB0AB9,0x08770933,0x06F107B0,0x056D062A,
-0x03E704A8,0x02640326,0x00E301A2,0xFF64001F,0xFDE0FEA3,0xFC5EFD21,0xFAE0FB9E,0xF95FFA1C,
-0xF7DFF89E,0xF664F71E,0xF4EBF5A3,0xF374F42C,0xF1FDF2B7,0xF088F142,0xEF16EFCE,0xEDABEE5F,
-0xEC41ECF1,0xEAD6EB87,0xE96EEA23,0xE80FE8C0,0xE6B3E75C,0xE559E5FF,0xE400E4AB,0xE2ADE357,
-0xE15EE207,0xE013E0BA,0xDECBDF71,0xDD89DE29,0xDC4CDCEA,0xDB0FDBAF,0xD9D4DA73,0xD8A5D93F,
-0xD77CD810,0xD653D6E2,0xD52AD5BB,0xD405D49B,0xD2EBD37D,0xD1D6D261,0xD0C3D14C,0xCFAED039,
-0xCEA1CF2A,0xCD9ACE22,0xCC98CD1D,0xCB9ACC1C,0xCA9ECB1C,0xC9A4CA1C,0xC8B1C923,0xC7C0C836,
-0xC6D4C748,0xC5E9C65D,0xC502C575,0xC41EC492,0xC33DC3AD,0xC261C2CA,0xC187C1F0,0xC0B1C11B,
-0xBFE1C047,0xBF12BF76,0xBE44BEA8,0xBD79BDDE,0xBCB6BD17,0xBBF8BC55,0xBB3CBB97,0xBA83BADD,
-0xB9CEBA2A,0xB91EB97B,0xB874B8CD,0xB7CFB821,0xB72FB77A,0xB695B6DE,0xB5FFB649,0xB56FB5B5,
-0xB4E2B526,0xB45DB49C,0xB3DDB41C,0xB361B3A0,0xB2EBB328,0xB27CB2B6,0xB215B248,0xB1B3B1E1,
-0xB154B182,0xB0F7B126,0xB0A2B0CD,0xB053B07D,0xB00BB030,0xAFC9AFE8,0xAF8AAFA4,0xAF4EAF67,
-0xAF15AF31,0xAEE2AEFD,0xAEB6AECE,0xAE8CAEA3,0xAE66AE7D,0xAE47AE58,0xAE28AE37,0xAE0AAE18,
-0xADEEADFB,0xADD7ADE0,0xADB9ADC6,0xADA1ADAE,0xAD91AD99,0xAD81AD87,0xAD70AD7A,0xAD5DAD6B,
-0xAD4BAD56,0xAD3BAD44,0xAD2DAD39,0xAD22AD2B,0xAD15AD1C,0xAD08AD0E,0xACFEAD03,0xACF4ACF9,
-0xACEDACF2,0xACE9ACEC,0xACE9ACE9,0xACECACEB,0xACF4ACEF,0xACFBACF3,0xAD02ACF8,0xAD0CAD00,
-0xAD17AD0B,0xAD27AD1C,0xAD3AAD2E,0xAD4FAD3F,0xAD66AD53,0xAD7EAD6C,0xAD9AAD87,0xADBAADA4,
-0xADD8ADC5,0xADF8ADE9,0xAE1DAE0D,0xAE48AE34,0xAE78AE61,0xAEA9AE90,0xAEDCAEC3,0xAF11AEF6,
-0xAF4DAF2C,0xAF8BAF6A,0xAFCBAFAD,0xB011AFF2,0xB05FB037,0xB0ACB080,0xB0FEB0D0,0xB153B126,
-0xB1ABB17B,0xB208B1D4,0xB269B235,0xB2CDB29B,0xB335B302,0xB3A3B36C,0xB412B3D8,0xB482B447,
-0xB4F6B4BA,0xB56FB531,0xB5E9B5A8,0xB666B621,0xB6E3B6A3,0xB763B727,0xB7E9B7A8,0xB870B82A,
-0xB8F8B8B1,0xB986B93B,0xBA18B9CA,0xBAA6BA57,0xBB37BAE9,0xBBC8BB7E,0xBC5DBC15,0xBCF9BCB0,
-0xBD97BD4D,0xBE33BDE8,0xBED2BE83,0xBF75BF24,0xC01DBFC9,0xC0C7C070,0xC173C119,0xC220C1C9,
-0xC2D3C279,0xC38BC32F,0xC447C3E8,0xC507C4A5,0xC5CBC569,0xC695C62E,0xC765C6FA,0xC835C7CC,
-0xC90AC8A2,0xC9E6C97A,0xCAC9CA58,0xCBB2CB3E,0xCCA0CC27,0xCD93CD17,0xCE8DCE0F,0xCF88CF0A,
-0xD08AD008,0xD194D10D,0xD2A2D219,0xD3B3D32D,0xD4CAD445,0xD5EBD560,0xD711D67F,0xD83AD7A3,
-0xD96BD8D1,0xDA9FDA05,0xDBD6DB3C,0xDD14DC77,0xDE59DDB6,0xDFA5DEFD,0xE0F2E048,0xE244E199,
-0xE399E2ED,0xE4ECE440,0xE644E597,0xE7A0E6F3,0xE8FEE84E,0xEA62E9AF,0xEBC3EB10,0xED27EC70,
-0xEE8DEDD5,0xEFF1EF3B,0xF157F0A1,0xF2C1F20B,0xF42CF377,0xF597F4E1,0xF702F64A,0xF86BF7B6,
-0xF9D6F922,0xFB43FA8E,0xFCB0FBFB,0xFE20FD6B,0xFF90FED9,0x00FF0048,0x027001BA,0x03E3032A,
-0x0555049A,0x06C5060D,0x0837077F,0x09AC08F2,0x0B240A6A,0x0C9B0BE3,0x0E140D5A,0x0F900ED5,
-0x110A104C,0x128411C7,0x14031346,0x158614C6,0x17091648,0x188E17CF,0x1A141954,0x1B9E1AD9,
-0x1D2C1C66,0x1EBA1DF4,0x204A1F80,0x21D82111,0x236A22A5,0x2503243C,0x269F25D3,0x283A2769,
-0x29D62904,0x2B752AA1,0x2D162C43,0x2EB92DE7,0x305E2F8B,0x32043132,0x33AC32DE,0x35563484,
-0x3703362C,0x38B137D9,0x3A5E3984,0x3C0A3B32,0x3DB43CE3,0x3F623E8E,0x41134039,0x42BE41E7,
-0x44644392,0x460B453C,0x47B646E9,0x495F4890,0x4B054A32,0x4CA74BD4,0x4E434D74,0x4FE04F0F,
-0x517950AA,0x530D5243,0x549C53D7,0x562A5565,0x57B256EF,0x59335872,0x5AAF59F2,0x5C255B6B,
-0x5D935CDB,0x5EFF5E45,0x60645FAB,0x61B96109,0x6307625D,0x645263AA,0x659564F2,0x66CF6632,
-0x68046768,0x69306896,0x6A5069BF,0x6B6A6AE2,0x6C7E6BF8,0x6D886D04,0x6E896E07,0x6F7A6F01,
-0x705D6FED,0x713370CB,0x71FB719B,0x72B9725F,0x736D7314,0x741673BE,0x74B27460,0x754674FB,
-0x75D7758D,0x765D7617,0x76D97699,0x774F7713,0x77C17786,0x782677F3,0x78777850,0x78BA789B,
-0x78F378DB,0x7921790F,0x79447938,0x795E7955,0x796C7966,0x7971796C,0x796C796D,0x79607968,
-0x794C7956,0x7930793C,0x790A791C,0x78DE78F5,0x78AE78C8,0x78787895,0x783C785B,0x77F9781C,
-0x77AD77D6,0x775A7787,0x76FA772D,0x769276C9,0x76207659,0x75A375DF,0x751D755E,0x748B74D1,
-0x73F07439,0x7349739C,0x729672F2,0x71DC723B,0x7119717C,0x704D70B4,0x6F766FE0,0x6E946F02,
-0x6DA96E1C,0x6CB46D2D,0x6BB56C35,0x6AAC6B31,0x699C6A23,0x6884690F,0x676367F3,0x663A66D1,
-0x650C65A5,0x63D6646D,0x62956331,0x614D61EF,0x600460AC,0x5EB75F62,0x5D655E0D,0x5C0B5CB4,
-0x5AAD5B5A,0x594B59FA,0x57E85898,0x567C5734,0x550F55C9,0x53A2545A,0x523352EC,0x50C1517B,
-0x4F505004,0x4DDA4E8E,0x4C5E4D16,0x4ADF4B9B,0x49624A1F,0x47E748A2,0x46694724,0x44E945A7,
-0x43684427,0x41E642A6,0x40634125,0x3EE23FA6,0x3D613E26,0x3BDE3CA2,0x3A593B1D,0x38D73998,
-0x37553815,0x35D03692,0x344B350D,0x32C5338A,0x31423207,0x2FC03082,0x2E3C2EFC,0x2CBB2D78,
-0x2B3A2BF3,0x29B62A73,0x283628F3,0x26B92772,0x253825F2,0x23B62474,0x223922F6,0x20BE217B,
-0x1F472003,0x1DD01E88,0x1C571D11,0x1AE41B9E,0x19741A2C,0x180218B8,0x16921747,0x152515DA,
-0x13BB146F,0x12521308,0x10EA11A2,0x0F89103C,0x0E290ED9,0x0CCB0D79,0x0B6D0C1D,0x0A130AC1,
-0x08BD096A,0x07690814,0x061706C0,0x04C80572,0x03780424,0x022B02D5,0x00E4018B,0xFFA00042,
-0xFE5CFEFB,0xFD18FDB6,0xFBD6FC74,0xFA97FB38,0xF959F9FC,0xF81EF8BD,0xF6E5F77F,0xF5AAF646,
-0xF46FF50E,0xF338F3D7,0xF203F2A2,0xF0D0F16C,0xEF9DF039,0xEE6BEF05,0xED3AEDD1,0xEC08ECA0,
-0xEADAEB72,0xE9ADEA41,0xE881E913,0xE754E7E9,0xE629E6BF,0xE500E594,0xE3D6E46B,0xE2ADE341,
-0xE189E21B,0xE066E0F7,0xDF42DFD5,0xDE20DEB3,0xDD00DD90,0xDBE2DC70,0xDAC2DB52,0xD9A8DA37,
-0xD892D920,0xD77CD80B,0xD669D6F8,0xD559D5E5,0xD44ED4D6,0xD343D3C9,0xD23CD2C0,0xD13AD1BC,
-0xD03BD0BC,0xCF40CFBE,0xCE49CEC5,0xCD57CDCF,0xCC66CCDB,0xCB7BCBEC,0xCA95CB03,0xC9B2CA21,
-0xC8D4C944,0xC7FEC867,0xC72BC78F,0xC657C6BD,0xC58BC5F1,0xC4C5C529,0xC404C463,0xC344C3A1,
-0xC287C2E3,0xC1D0C22B,0xC11EC178,0xC072C0CA,0xBFC6C01B,0xBF1DBF70,0xBE7ABECB,0xBDDBBE29,
-0xBD3DBD88,0xBCA6BCEC,0xBC0FBC56,0xBB7ABBC3,0xBAEFBB37,0xBA66BAAC,0xB9DEBA1D,0xB95AB996,
-0xB8D7B918,0xB85BB89A,0xB7E3B81B,0xB76DB7A3,0xB6F9B732,0xB68AB6C0,0xB61DB64F,0xB5AFB5E5,
-0xB54AB57E,0xB4E9B51C,0xB488B4BA,0xB42AB45A,0xB3D2B3FF,0xB37DB3A7,0xB329B354,0xB2D9B304,
-0xB28FB2B4,0xB247B26A,0xB202B223,0xB1C2B1DF,0xB184B1A0,0xB146B165,0xB10DB12C,0xB0DCB0F5,
-0xB0A9B0C6,0xB07BB096,0xB052B066,0xB02BB03B,0xB003B016,0xAFE2AFF6,0xAFC3AFD7,0xAFA6AFB6,
-0xAF8BAF97,0xAF74AF7F,0xAF5DAF6B,0xAF47AF51,0xAF39AF3F,0xAF29AF30,0xAF1BAF21,0xAF11AF16,
-0xAF09AF0B,0xAF00AF02,0xAEF7AEF9,0xAEF1AEF4,0xAEECAEEF,0xAEE9AEEA,0xAEE5AEEA,0xAEDFAEE5,
-0xAEDFAEE1,0xAEE0AEE3,0xAEE4AEE4,0xAEEAAEE9,0xAEF4AEF0,0xAF00AEF9,0xAF0CAF03,0xAF1BAF13,
-0xAF2DAF26,0xAF43AF38,0xAF57AF4F,0xAF6CAF69,0xAF8AAF82,0xAFA8AF9C,0xAFC5AFB8,0xAFE4AFD6,
-0xB004AFF6,0xB027B017,0xB04CB03B,0xB072B060,0xB099B087,0xB0BFB0AC,0xB0E9B0D5,0xB116B100,
-0xB144B12E,0xB176B15F,0xB1ABB192,0xB1E0B1C6,0xB218B1FE,0xB255B237,0xB292B274,0xB2D1B2B4,
-0xB317B2F4,0xB35CB337,0xB3A5B37F,0xB3F2B3CB,0xB441B417,0xB491B468,0xB4E3B4BC,0xB53AB514,
-0xB597B56C,0xB5F8B5C8,0xB657B628,0xB6B9B688,0xB720B6EB,0xB788B755,0xB7F3B7C1,0xB861B82D,
-0xB8D2B89C,0xB944B90C,0xB9BAB980,0xBA34B9F8,0xBAADBA71,0xBB28BAEC,0xBBA8BB68,0xBC2ABBE7,
-0xBCADBC68,0xBD32BCE9,0xBDB5BD70,0xBE3CBDFB,0xBEC7BE85,0xBF55BF11,0xBFE7BF9D,0xC077C02C,
-0xC10AC0C0,0xC1A2C158,0xC23CC1F0,0xC2DBC28B,0xC37EC32B,0xC420C3CC,0xC4C4C470,0xC56AC518,
-0xC618C5C4,0xC6CBC676,0xC77EC729,0xC835C7DD,0xC8F6C897,0xC9BAC953,0xCA7ECA15,0xCB41CADD,
-0xCC0CCBA8,0xCCDBCC73,0xCDB0CD47,0xCE89CE1E,0xCF68CEF8,0xD048CFD6,0xD12DD0B8,0xD218D19E,
-0xD305D288,0xD3F6D376,0xD4EDD46D,0xD5E8D56B,0xD6E9D669,0xD7EBD76A,0xD8F3D870,0xDA02D97D,
-0xDB17DA8C,0xDC2CDBA0,0xDD48DCB7,0xDE69DDD3,0xDF89DEF5,0xE0ADE018,0xE1D6E13E,0xE301E267,
-0xE42EE396,0xE55EE4C6,0xE694E5F8,0xE7CBE72A,0xE902E862,0xEA39E99E,0xEB75EADA,0xECB4EC14,
-0xEDF1ED4F,0xEF2FEE8F,0xF070EFCF,0xF1B2F111,0xF2F7F254,0xF43AF39A,0xF57CF4DD,0xF6C5F621,
-0xF80DF766,0xF952F8AC,0xFA98F9F5,0xFBE1FB40,0xFD2CFC8B,0xFE74FDD4,0xFFBFFF1A,0x010C0066,
-0x025801B1,0x03A302FE,0x04EF044D,0x063F059A,0x079006E6,0x08DD0835,0x0A2B0988,0x0B7B0AD9,
-0x0CCF0C27,0x0E250D79,0x0F7A0ECD,0x10CF1022,0x12241179,0x137C12D0,0x14D81429,0x16311584,
-0x178D16E1,0x18EC183F,0x1A4D199E,0x1BAE1AFC,0x1D101C5D,0x1E731DC0,0x1FD91F28,0x213F208F,
-0x22A621F3,0x240F235B,0x257A24C5,0x26E82632,0x285627A1,0x29C3290E,0x2B342A7D,0x2CA82BEF,
-0x2E172D61,0x2F8A2ED4,0x31013048,0x327931BD,0x33EE3334,0x356434AB,0x36DB361F,0x38523794,
-0x39CA390C,0x3B413A82,0x3CB83BF9,0x3E313D74,0x3FA73EEC,0x411D4061,0x429241D5,0x44064347,
-0x457B44BB,0x46EB462F,0x485847A0,0x49C74913,0x4B354A83,0x4CA04BEF,0x4E0A4D57,0x4F704EBD,
-0x50D35025,0x52335186,0x539052E4,0x54EA543E,0x56435596,0x579556EB,0x58E3583C,0x5A2B598A,
-0x5B725AD2,0x5CB35C14,0x5DEC5D51,0x5F215E89,0x60515FBB,0x617C60E9,0x62A2620E,0x63BF632F,
-0x64D7644C,0x65EA6561,0x66F5666F,0x67F96779,0x68F9687B,0x69F06974,0x6ADF6A68,0x6BC66B55,
-0x6CAA6C3D,0x6D866D1D,0x6E546DF0,0x6F166EB7,0x6FCD6F71,0x707A7022,0x711870C7,0x71AC7162,
-0x723C71F8,0x72C17281,0x733F7300,0x73B3737B,0x742473EF,0x748B745B,0x74E474BC,0x752D7509,
-0x7568754A,0x75937580,0x75B775A9,0x75CF75C6,0x75DC75D9,0x75E175E2,0x75DE75E1,0x75D075D9,
-0x75B875C9,0x759775AF,0x7572758E,0x75497565,0x75197533,0x74E174FF,0x74A374C6,0x74607485,
-0x7416743C,0x73C073EB,0x73617392,0x72FB7333,0x728E72C8,0x72187254,0x719771D7,0x710E7151,
-0x707B70C3,0x6FDF702B,0x6F396F8B,0x6E8A6EE5,0x6DD36E33,0x6D166D77,0x6C4D6CB5,0x6B7E6BEA,
-0x6AA66B15,0x69C46A38,0x68D96955,0x67EB6867,0x66F2676E,0x65EC6672,0x64E46570,0x63D76465,
-0x62C06351,0x61A16236,0x607B6113,0x5F535FED,0x5E265EC2,0x5CF25D8F,0x5BBA5C54,0x5A7D5B16,
-0x593759D8,0x57EF5896,0x56A4574B,0x555555FD,0x540354AB,0x52AF5357,0x51575200,0x4FFD50A5,
-0x4EA14F49,0x4D404DEC,0x4BDE4C8F,0x4A7C4B2F,0x491A49CA,0x47B64865,0x464F4701,0x44E7459A,
-0x437E4431,0x421642C8,0x40AE415E,0x3F443FF7,0x3DDB3E90,0x3C743D28,0x3B0B3BC2,0x39A03A5A,
-0x383638EF,0x36D03787,0x356C3620,0x340634B9,0x329F3353,0x313831EF,0x2FD2308C,0x2E712F25,
-0x2D132DBF,0x2BB22C5D,0x2A4F2AFB,0x28F0299B,0x2792283D,0x263526E1,0x24DA2586,0x2380242C,
-0x222822D4,0x20D2217C,0x1F7F2024,0x1E2D1ECF,0x1CDB1D7E,0x1B8B1C2D,0x1A3B1AE0,0x18EF1992,
-0x17A41846,0x165916FD,0x151315B5,0x13CF146E,0x12881328,0x114311E8,0x100410A8,0x0EC70F67,
-0x0D880E27,0x0C4D0CE8,0x0B140BAF,0x09DA0A78,0x08A20940,0x076D080A,0x063A06D7,0x050A05A4,
-0x03D90471,0x02A90341,0x017C0213,0x005100E6,0xFF27FFBA,0xFDFDFE8F,0xFCD4FD68,0xFBACFC41,
-0xFA87FB19,0xF962F9F3,0xF83FF8D0,0xF71EF7AD,0xF5FEF68C,0xF4DEF56D,0xF3C1F44F,0xF2A6F330,
-0xF18EF216,0xF074F0FD,0xEF58EFE3,0xEE40EECC,0xED2CEDB9,0xEC1AECA5,0xEB06EB8F,0xE9F6EA7C,
-0xE8E7E96E,0xE7D7E860,0xE6CDE755,0xE5C3E64C,0xE4B7E543,0xE3B1E43C,0xE2AEE335,0xE1AFE232,
-0xE0AFE130,0xDFB1E02F,0xDEB6DF32,0xDDBFDE38,0xDCC6DD3E,0xDBD1DC47,0xDADDDB53,0xD9ECDA60,
-0xD8FBD971,0xD80CD883,0xD722D798,0xD639D6AD,0xD54FD5C7,0xD46CD4E3,0xD38DD400,0xD2AED320,
-0xD1D0D244,0xD0F5D16A,0xD020D090,0xCF4DCFB9,0xCE7BCEE6,0xCDACCE15,0xCCE1CD47,0xCC15CC7C,
-0xCB4ECBB4,0xCA8ACAEE,0xC9C8CA2A,0xC909C96C,0xC84EC8B0,0xC795C7F8,0xC6E0C742,0xC62FC68D,
-0xC580C5DA,0xC4D5C52C,0xC42CC480,0xC387C3D7,0xC2E3C332,0xC241C292,0xC1A4C1F3,0xC10CC155,
-0xC072C0BC,0xBFDDC028,0xBF4DBF94,0xBEC1BF06,0xBE34BE79,0xBDACBDF2,0xBD29BD6E,0xBCACBCE9,
-0xBC32BC68,0xBBB6BBED,0xBB41BB75,0xBACEBB07,0xBA5FBA98,0xB9F7BA2B,0xB991B9C4,0xB930B960,
-0xB8D3B8FD,0xB876B8A0,0xB81CB848,0xB7C8B7F4,0xB773B79D,0xB724B750,0xB6D9B705,0xB696B6BC,
-0xB656B677,0xB616B634,0xB5D7B5F5,0xB59DB5BB,0xB569B583,0xB538B54D,0xB502B51A,0xB4D1B4EC,
-0xB4A6B4BE,0xB47EB492,0xB457B46B,0xB434B445,0xB413B421,0xB3F1B401,0xB3D3B3E2,0xB3B7B3C2,
-0xB39CB3A5,0xB382B38C,0xB36BB376,0xB355B363,0xB341B34B,0xB32FB334,0xB31DB320,0xB30DB30E,
-0xB2FDB300,0xB2EFB2F4,0xB2E0B2E4,0xB2D2B2D6,0xB2C6B2CB,0xB2BAB2C2,0xB2AEB2B6,0xB2A7B2AA,
-0xB2A1B2A1,0xB29AB29A,0xB292B293,0xB28CB28E,0xB288B287,0xB284B284,0xB287B285,0xB28DB286,
-0xB293B28E,0xB29DB29A,0xB2ACB2A6,0xB2BCB2B6,0xB2CFB2C9,0xB2E6B2DD,0xB302B2F3,0xB31FB30E,
-0xB33AB32A,0xB35BB34A,0xB380B36F,0xB3A9B395,0xB3CFB3BD,0xB3F7B3E5,0xB425B40F,0xB456B43B,
-0xB48AB46D,0xB4BDB4A1,0xB4EFB4D4,0xB526B507,0xB55EB53F,0xB599B57C,0xB5D6B5B8,0xB618B5F5,
-0xB659B636,0xB69EB67A,0xB6E3B6BF,0xB728B705,0xB771B74B,0xB7BDB793,0xB809B7DE,0xB858B82B,
-0xB8AAB87C,0xB8FCB8D0,0xB94DB924,0xB9A4B97A,0xB9FCB9CF,0xBA54BA23,0xBAAEBA80,0xBB09BADE,
-0xBB65BB3A,0xBBC5BB95,0xBC26BBF3,0xBC87BC55,0xBCEBBCB8,0xBD50BD1C,0xBDB7BD83,0xBE22BDEE,
-0xBE8DBE58,0xBEFABEC4,0xBF69BF33,0xBFD9BFA1,0xC04CC015,0xC0C3C08B,0xC13DC100,0xC1B7C178,
-0xC234C1F3,0xC2B3C26F,0xC333C2F0,0xC3B8C375,0xC440C3FB,0xC4C9C484,0xC555C510,0xC5E5C5A2,
-0xC67BC634,0xC717C6C8,0xC7B2C75F,0xC84DC7FB,0xC8EEC89B,0xC993C940,0xCA3EC9EA,0xCAEDCA95,
-0xCB9ECB43,0xCC51CBF6,0xCD09CCAA,0xCDC3CD64,0xCE82CE22,0xCF44CEE2,0xD009CFA6,0xD0D0D06E,
-0xD19CD13B,0xD270D20B,0xD346D2DD,0xD41CD3B3,0xD4F6D48A,0xD5D4D566,0xD6B5D647,0xD799D728,
-0xD881D80E,0xD96AD8F7,0xDA57D9E4,0xDB46DAD3,0xDC3BDBC1,0xDD32DCB4,0xDE28DDAC,0xDF22DEA5,
-0xE01FDFA0,0xE120E09E,0xE224E19E,0xE328E2A1,0xE42CE3A4,0xE533E4AC,0xE63CE5B6,0xE745E6BF,
-0xE852E7C8,0xE961E8D5,0xEA6FE9E6,0xEB7EEAF6,0xEC90EC07,0xEDA3ED16,0xEEB9EE2A,0xEFCFEF40,
-0xF0E5F057,0xF1FEF16F,0xF319F28C,0xF433F3A6,0xF54CF4C2,0xF66AF5E0,0xF78CF6FF,0xF8ADF81E,
-0xF9D1F941,0xFAF4FA63,0xFC18FB86,0xFD3EFCAB,0xFE67FDD2,0xFF8EFEFA,0x00B60021,0x01E0014A,
-0x030B0274,0x043803A1,0x056504D1,0x069405FF,0x07C4072C,0x08F4085B,0x0A26098C,0x0B570ABD,
-0x0C870BEE,0x0DBA0D23,0x0EF00E59,0x10280F8E,0x115B10C1,0x128F11F5,0x13C6132B,0x14FD1462,
-0x16341599,0x176C16D0,0x18A61806,0x19DE1940,0x1B161A79,0x1C501BB0,0x1D861CE9,0x1EBE1E26,
-0x1FFA1F5F,0x21352098,0x226F21D5,0x23A92310,0x24E5244A,0x26202584,0x275C26BE,0x289927FA,
-0x29D62937,0x2B112A73,0x2C502BAF,0x2D902CEB,0x2ECD2E2A,0x300A2F69,0x314930A6,0x328631E5,
-0x33C53326,0x35063467,0x364735A7,0x378936E8,0x38CA3829,0x3A0A396C,0x3B4D3AAD,0x3C913BEF,
-0x3DD33D30,0x3F153E74,0x40573FB9,0x419C40FB,0x42E1423E,0x4425437F,0x456444C2,0x46A24607,
-0x47E14747,0x49224882,0x4A6149BF,0x4B9E4AFF,0x4CD84C3C,0x4E134D76,0x4F4A4EAD,0x507D4FE0,
-0x51AC5111,0x52D85242,0x54045372,0x552D549B,0x565055C0,0x576F56E3,0x588C57FF,0x59A35916,
-0x5AB35A2C,0x5BBF5B3A,0x5CC95C43,0x5DCD5D48,0x5EC65E49,0x5FBC5F45,0x60AE6038,0x619B6126,
-0x6280620D,0x635E62EF,0x643863CD,0x650D64A2,0x65D96574,0x669E6640,0x675F6703,0x681B67BD,
-0x68CD6873,0x697A6925,0x6A2269CF,0x6AC56A73,0x6B5F6B13,0x6BF26BAA,0x6C7B6C39,0x6CF76CBA,
-0x6D5D6D2C,0x6DB06D89,0x6DF66DD6,0x6E2F6E14,0x6E576E47,0x6E756E6B,0x6E8B6E82,0x6E946E8E,
-0x6E906E90,0x6E856E8A,0x6E736E7B,0x6E576E61,0x6E336E41,0x6E056E1E,0x6DD46DF4,0x6D9F6DC0,
-0x6D626D84,0x6D1B6D43,0x6CCD6CFA,0x6C786CA8,0x6C1C6C4B,0x6BB96BE7,0x6B4A6B7D,0x6ACF6B09,
-0x6A4C6A8E,0x69C46A09,0x6934697C,0x689668E8,0x67F46849,0x674C67A0,0x669A66F0,0x65DB6637,
-0x65176576,0x644B64B0,0x637663E0,0x62976308,0x61B06225,0x60C1613A,0x5FCB6049,0x5ECF5F4E,
-0x5DCA5E4B,0x5CBF5D44,0x5BAC5C38,0x5A905B21,0x59725A04,0x584F58E4,0x572757BE,0x55F85691,
-0x54C55560,0x538F542B,0x525452F1,0x511751B6,0x4FD55077,0x4E904F34,0x4D4A4DEC,0x4C044CA0,
-0x4AB94B56,0x496A4A0D,0x481F48C3,0x46D14776,0x45824627,0x443344D9,0x42E5438C,0x4198423F,
-0x404C40F3,0x3EFE3FA6,0x3DB33E5A,0x3C683D0E,0x3B203BC3,0x39D73A7A,0x388F392F,0x374637E8,
-0x360036A5,0x34BC3561,0x3377341E,0x323232DA,0x30F13199,0x2FB23059,0x2E772F14,0x2D3C2DD6,
-0x2BFB2C9D,0x2AC02B62,0x29892A28,0x285228ED,0x271B27B3,0x25E3267C,0x24AD2547,0x23782410,
-0x224522DA,0x211221A9,0x1FDF2079,0x1EAD1F49,0x1D7B1E16,0x1C4A1CE3,0x1B1C1BB6,0x19EF1A86,
-0x18C01955,0x17921828,0x166616FF,0x153E15D4,0x141314A8,0x12EA137F,0x11C21258,0x109D112F,
-0x0F751009,0x0E520EE5,0x0D2E0DBF,0x0C0B0C9B,0x0AE90B7C,0x09CC0A5E,0x08AD093E,0x07900822,
-0x06760707,0x055F05ED,0x044904D4,0x033403BC,0x022002A8,0x01110197,0x00020087,0xFEF3FF77,
-0xFDE5FE69,0xFCDAFD5F,0xFBD5FC59,0xFAD0FB52,0xF9CBFA4D,0xF8C9F948,0xF7C9F847,0xF6C8F747,
-0xF5CAF64A,0xF4D3F54D,0xF3DBF455,0xF2E5F35E,0xF1F1F267,0xF0FEF172,0xF00BF07F,0xEF1AEF8E,
-0xEE2AEE9F,0xED3EEDB3,0xEC54ECC7,0xEB6AEBDB,0xEA80EAF3,0xE999EA0C,0xE8B4E924,0xE7CEE83F,
-0xE6E9E75A,0xE606E676,0xE523E594,0xE443E4B7,0xE364E3D9,0xE287E2F9,0xE1AAE21A,0xE0CFE13A,
-0xDFF3E05F,0xDF1ADF85,0xDE43DEAA,0xDD6BDDD2,0xDC91DCFD,0xDBBBDC27,0xDAE7DB53,0xDA14DA7E,
-0xD943D9AC,0xD873D8DB,0xD7A5D80C,0xD6D6D73E,0xD609D672,0xD53ED5A7,0xD478D4DF,0xD3B4D419,
-0xD2F0D354,0xD22BD292,0xD16CD1D0,0xD0B2D112,0xCFF7D058,0xCF3DCF9A,0xCE8ACEE6,0xCDD8CE32,
-0xCD29CD7F,0xCC7FCCD5,0xCBD6CC2E,0xCB33CB87,0xCA94CAE3,0xC9F5CA42,0xC95AC9A7,0xC8C4C90F,
-0xC833C879,0xC7A4C7E6,0xC717C75B,0xC68CC6D3,0xC607C64C,0xC585C5C7,0xC506C548,0xC48AC4CD,
-0xC412C454,0xC39EC3DD,0xC32DC368,0xC2C0C2FA,0xC256C28B,0xC1F0C221,0xC18BC1BD,0xC12AC15A,
-0xC0CBC0F8,0xC06EC09B,0xC015C044,0xBFBFBFED,0xBF6BBF98,0xBF1FBF47,0xBED4BEF9,0xBE86BEAE,
-0xBE40BE64,0xBDFCBE1D,0xBDBBBDD6,0xBD7ABD95,0xBD39BD58,0xBCFCBD1D,0xBCC6BCE1,0xBC92BCA9,
-0xBC5CBC76,0xBC29BC46,0xBBFBBC16,0xBBCDBBE5,0xBBA4BBB8,0xBB7CBB8F,0xBB57BB65,0xBB30BB42,
-0xBB0DBB1F,0xBAEDBAFD,0xBACEBADD,0xBAB2BAC0,0xBA97BAA3,0xBA7FBA89,0xBA6ABA72,0xBA56BA5F,
-0xBA43BA4A,0xBA33BA38,0xBA25BA2B,0xBA18BA1D,0xBA0DBA10,0xBA05BA04,0xB9FEB9FD,0xB9F5B9F8,
-0xB9EFB9F4,0xB9ECB9F0,0xB9EBB9EF,0xB9EAB9EC,0xB9EAB9EB,0xB9ECB9EA,0xB9F1B9EC,0xB9F6B9F2,
-0xB9FBB9F8,0xBA02BA00,0xBA0FBA0B,0xBA20BA1A,0xBA32BA29,0xBA49BA3E,0xBA61BA55,0xBA7DBA6E,
-0xBA97BA8A,0xBAB4BAA9,0xBAD7BAC9,0xBAFCBAEA,0xBB21BB0C,0xBB47BB34,0xBB6FBB5A,0xBB9BBB81,
-0xBBC3BBAA,0xBBEDBBD7,0xBC1ABC06,0xBC4ABC31,0xBC79BC5D,0xBCA6BC8D,0xBCD7BCC2,0xBD0CBCF3,
-0xBD42BD25,0xBD77BD5B,0xBDADBD92,0xBDE6BDCB,0xBE22BE06,0xBE5DBE3F,0xBE9DBE7B,0xBEDCBEB9,
-0xBF1ABEF8,0xBF5CBF3B,0xBF9FBF7F,0xBFE3BFC2,0xC02BC005,0xC077C04E,0xC0C2C098,0xC10CC0E4,
-0xC15DC134,0xC1AEC186,0xC1FFC1D8,0xC254C22C,0xC2ABC27F,0xC306C2D5,0xC361C330,0xC3BAC38E,
-0xC417C3E9,0xC479C449,0xC4DCC4AB,0xC541C50E,0xC5A9C574,0xC613C5DF,0xC67AC649,0xC6E7C6B4,
-0xC759C721,0xC7CBC790,0xC83EC801,0xC8B4C878,0xC92DC8EE,0xC9A6C966,0xCA1EC9E3,0xCA9CCA61,
-0xCB1DCADF,0xCB9DCB61,0xCC22CBE4,0xCCACCC6A,0xCD36CCF1,0xCDC1CD79,0xCE4DCE03,0xCEDCCE94,
-0xCF6DCF24,0xD000CFB7,0xD096D04D,0xD12DD0E6,0xD1C8D17E,0xD267D219,0xD309D2B6,0xD3ACD355,
-0xD450D3F9,0xD4F6D4A1,0xD59ED54B,0xD64BD5F4,0xD6FAD6A2,0xD7AAD753,0xD85DD805,0xD915D8B8,
-0xD9CDD96F,0xDA89DA2B,0xDB48DAE9,0xDC09DBA8,0xDCCEDC6B,0xDD96DD30,0xDE61DDF9,0xDF2CDEC4,
-0xDFF9DF93,0xE0CAE064,0xE1A0E137,0xE277E20D,0xE351E2E4,0xE42DE3BC,0xE509E499,0xE5E8E579,
-0xE6CCE65B,0xE7B0E73F,0xE897E825,0xE97FE90C,0xEA68E9F5,0xEB54EADF,0xEC41EBC9,0xED2FECB5,
-0xEE21EDA6,0xEF13EE96,0xF004EF88,0xF0F5F07B,0xF1EBF171,0xF2E2F266,0xF3D6F35A,0xF4CDF451,
-0xF5C6F54A,0xF6BFF642,0xF7B7F73C,0xF8B0F835,0xF9AAF92F,0xFAA7FA2A,0xFBA4FB27,0xFCA0FC21,
-0xFD9CFD1A,0xFE97FE17,0xFF92FF14,0x008E000F,0x018B010E,0x0287020A,0x03850305,0x04810403,
-0x057C0500,0x067905FD,0x077606FA,0x087207FA,0x097008F7,0x0A7109F2,0x0B6F0AEF,0x0C6B0BEE,
-0x0D6A0CED,0x0E690DEC,0x0F660EE9,0x10640FE7,0x116510E7,0x126711E8,0x136412E8,0x146413E8,
-0x156614E7,0x166C15E8,0x176F16EB,0x186F17ED,0x197118EF,0x1A7619F2,0x1B7A1AF8,0x1C7F1BFC,
-0x1D841D01,0x1E881E06,0x1F8F1F0C,0x20982014,0x21A0211D,0x22A62224,0x23AF232C,0x24BB2437,
-0x25C52541,0x26CF2649,0x27D92753,0x28E5285D,0x29F0296A,0x2AFC2A75,0x2C092B81,0x2D142C8D,
-0x2E202D99,0x2F292EA4,0x30342FB1,0x314130BE,0x325031CA,0x335C32D5,0x346733E1,0x357134EC,
-0x367D35F7,0x37893701,0x3892380A,0x399B3916,0x3AA33A20,0x3BAB3B27,0x3CB13C2E,0x3DB83D35,
-0x3EBE3E3B,0x3FC43F41,0x40C74045,0x41C94148,0x42CA424A,0x43CA4348,0x44C54445,0x45BE4540,
-0x46B6463D,0x47AF4737,0x48A4482A,0x4995491D,0x4A854A0E,0x4B724AFD,0x4C5C4BE8,0x4D434CCF,
-0x4E2A4DB3,0x4F0C4E94,0x4FE54F75,0x50BE5053,0x5195512A,0x526751FE,0x533352CF,0x53FE539A,
-0x54C65463,0x558A5528,0x564855EA,0x570156A8,0x57B85760,0x586A5813,0x591758C2,0x59BE596D,
-0x5A635A13,0x5B045AB5,0x5B9E5B52,0x5C345BEC,0x5CC65C80,0x5D515D0C,0x5DC75D8E,0x5E2D5DFC,
-0x5E875E5A,0x5ED35EAC,0x5F105EF1,0x5F3F5F27,0x5F645F52,0x5F7C5F71,0x5F865F82,0x5F875F8A,
-0x5F7A5F85,0x5F655F76,0x5F4A5F5E,0x5F265F39,0x5EF75F0B,0x5EBF5ED7,0x5E7E5E9F,0x5E385E5D,
-0x5DEC5E14,0x5D955DC2,0x5D375D67,0x5CD05D06,0x5C645C9C,0x5BEE5C27,0x5B6D5BAA,0x5AE35B28,
-0x5A535A9C,0x59BC5A0A,0x591C596E,0x587458C8,0x57C5581C,0x5710576C,0x565556B2,0x559055F1,
-0x54C35529,0x53F1545A,0x53185386,0x523A52AC,0x515351CB,0x506850E1,0x4F794FF2,0x4E834F00,
-0x4D884E09,0x4C8A4D0B,0x4B894C09,0x4A814B04,0x497749FB,0x486A48EF,0x475847E1,0x464446D1,
-0x453345BD,0x441E44A7,0x4304438C,0x41E94275,0x40CF415D,0x3FB54045,0x3E993F28,0x3D7C3E0B,
-0x3C603CEF,0x3B453BD4,0x3A2B3AB8,0x390E399D,0x37F43881,0x36D93767,0x35BE364E,0x34A73535,
-0x338E341B,0x32753306,0x315E31EE,0x304B30D7,0x2F362FC3,0x2E262EAE,0x2D142D99,0x2C012C89,
-0x2AF12B7C,0x29E32A6D,0x28D6295D,0x27C9284F,0x26BE2743,0x25B22637,0x24A8252C,0x239F2425,
-0x2299231D,0x21912216,0x208C2110,0x1F852008,0x1E801F02,0x1D7D1DFF,0x1C7B1CFC,0x1B771BF9,
-0x1A751AF8,0x197519F8,0x187818F8,0x177917FA,0x167A16FC,0x157C15FE,0x148014FF,0x13861402,
-0x128A1308,0x1190120E,0x10981114,0x0FA1101F,0x0EAC0F2A,0x0DB60E35,0x0CC40D3F,0x0BD10C4A,
-0x0AE00B5A,0x09EF0A6C,0x0900097A,0x0815088D,0x072907A0,0x063F06B4,0x055405CA,0x046B04E4,
-0x038603FE,0x02A10317,0x01BE0232,0x00DE0152,0xFFFF006F,0xFF1FFF8F,0xFE41FEB1,0xFD65FDD5,
-0xFC8BFCFA,0xFBB1FC1F,0xFAD9FB46,0xFA03FA6F,0xF92EF998,0xF856F8C3,0xF784F7EF,0xF6B5F71B,
-0xF5E4F648,0xF512F579,0xF441F4AA,0xF373F3DA,0xF2A9F30D,0xF1DAF241,0xF10AF173,0xF040F0A9,
-0xEF7AEFDD,0xEEB2EF12,0xEDE9EE4C,0xED24ED86,0xEC60ECBF,0xEB9BEBFB,0xEAD6EB38,0xEA15EA74,
-0xE955E9B2,0xE896E8F1,0xE7D5E831,0xE716E774,0xE65AE6B9,0xE59EE5FF,0xE4E3E546,0xE42EE48C,
-0xE379E3D2,0xE2C4E31C,0xE20FE267,0xE15BE1B4,0xE0A9E105,0xDFFAE055,0xDF4CDFA2,0xDEA1DEF4,
-0xDDF8DE4B,0xDD4FDDA3,0xDCA9DCFD,0xDC05DC55,0xDB63DBB3,0xDAC2DB13,0xDA24DA75,0xD987D9D9,
-0xD8EFD940,0xD859D8A8,0xD7C7D815,0xD738D782,0xD6ABD6F1,0xD622D663,0xD59AD5D8,0xD513D552,
-0xD48ED4D0,0xD40DD451,0xD391D3D3,0xD319D359,0xD2A4D2E0,0xD231D26A,0xD1C1D1F6,0xD153D186,
-0xD0E7D119,0xD07ED0B1,0xD016D04C,0xCFB4CFE8,0xCF57CF85,0xCEFBCF26,0xCE9FCECB,0xCE44CE72,
-0xCDEFCE1D,0xCD9ECDC8,0xCD50CD76,0xCD02CD27,0xCCB6CCDC,0xCC6ECC93,0xCC28CC4C,0xCBE6CC05,
-0xCBA6CBC1,0xCB67CB82,0xCB2ACB47,0xCAF2CB0C,0xCABBCAD6,0xCA84CAA1,0xCA54CA6B,0xCA25CA38,
-0xC9F4CA09,0xC9C7C9DE,0xC99EC9B3,0xC977C989,0xC951C964,0xC92FC941,0xC90DC91F,0xC8EDC8FF,
-0xC8D2C8E0,0xC8B7C8C2,0xC89BC8A9,0xC883C891,0xC871C87A,0xC860C864,0xC84CC852,0xC839C844,
-0xC82CC836,0xC820C828,0xC813C81C,0xC807C813,0xC800C80A,0xC7FDC800,0xC7F8C7F9,0xC7F2C7F4,
-0xC7ECC7F1,0xC7EDC7EF,0xC7EDC7EB,0xC7EEC7EA,0xC7F0C7ED,0xC7F2C7ED,0xC7F2C7F1,0xC7F4C7F4,
-0xC7FBC7F8,0xC7FFC7FC,0xC805C803,0xC811C80C,0xC81EC815,0xC82BC822,0xC83AC832,0xC84BC843,
-0xC860C856,0xC877C86C,0xC88EC883,0xC8A5C89E,0xC8C0C8B8,0xC8DEC8D3,0xC8FDC8F1,0xC91DC910,
-0xC93EC92F,0xC95FC952,0xC984C974,0xC9ABC998,0xC9D0C9BD,0xC9F3C9E3,0xCA1ACA0A,0xCA43CA33,
-0xCA6ECA5C,0xCA98CA87,0xCAC6CAB2,0xCAF6CADE,0xCB27CB0E,0xCB55CB3E,0xCB88CB6E,0xCBBCCBA1,
-0xCBF1CBD4,0xCC25CC0C,0xCC5DCC43,0xCC98CC7A,0xCCD2CCB3,0xCD0CCCF0,0xCD4ACD2C,0xCD89CD6A,
-0xCDC5CDAA,0xCE07CDEC,0xCE4CCE2E,0xCE91CE70,0xCED5CEB7,0xCF1ECEFE,0xCF68CF44,0xCFB3CF8B,
-0xCFFFCFD6,0xD04BD022,0xD099D06F,0xD0E9D0BD,0xD139D10E,0xD188D160,0xD1DBD1B3,0xD231D208,
-0xD28AD25C,0xD2E2D2B0,0xD339D308,0xD391D362,0xD3ECD3BC,0xD44BD418,0xD4A9D474,0xD508D4D2,
-0xD566D535,0xD5C7D596,0xD62BD5F9,0xD692D65E,0xD6F7D6C4,0xD75DD72B,0xD7C7D795,0xD833D800,
-0xD8A1D86D,0xD911D8DA,0xD983D947,0xD9F6D9B7,0xDA6ADA2A,0xDADFDAA1,0xDB56DB18,0xDBD0DB93,
-0xDC4BDC0D,0xDCCADC88,0xDD49DD0A,0xDDCBDD8E,0xDE51DE0F,0xDED6DE94,0xDF5DDF1C,0xDFE9DFA8,
-0xE077E033,0xE108E0C0,0xE19AE152,0xE22FE1E3,0xE2C4E278,0xE35BE310,0xE3F5E3A8,0xE492E441,
-0xE52FE4DE,0xE5CFE57D,0xE66FE61D,0xE710E6C0,0xE7B4E765,0xE85DE808,0xE906E8B0,0xE9ADE959,
-0xEA57EA04,0xEB04EAB0,0xEBB2EB5B,0xEC63EC07,0xED12ECB6,0xEDC1ED68,0xEE73EE1C,0xEF26EECE,
-0xEFD7EF83,0xF08BF038,0xF144F0EC,0xF1FDF19F,0xF2B3F256,0xF368F310,0xF421F3C8,0xF4DBF481,
-0xF594F53B,0xF64FF5F5,0xF709F6B0,0xF7C5F76C,0xF883F826,0xF93FF8E1,0xF9FBF99D,0xFAB8FA59,
-0xFB73FB15,0xFC2FFBD2,0xFCEDFC91,0xFDADFD4F,0xFE6BFE0C,0xFF27FEC8,0xFFE4FF85,0x00A10042,
-0x01600102,0x021F01BF,0x02DD027C,0x03990339,0x045803F9,0x051504B7,0x05D30575,0x06910634,
-0x074F06F1,0x080D07AF,0x08CA086E,0x0989092C,0x0A4709E8,0x0B040AA6,0x0BC10B65,0x0C7F0C23,
-0x0D3F0CE1,0x0DFD0D9E,0x0EBA0E5C,0x0F780F1A,0x10370FD7,0x10F31094,0x11B01151,0x126D1212,
-0x132912D1,0x13E7138E,0x14A5144B,0x15651507,0x162315C5,0x16E01683,0x179D173F,0x185D17FC,
-0x191B18B8,0x19D81976,0x1A931A36,0x1B521AF3,0x1C101BB0,0x1CCE1C6C,0x1D8C1D2A,0x1E481DE9,
-0x1F031EA7,0x1FC01F65,0x207E2021,0x213C20DD,0x21F8219B,0x22B42257,0x236F2314,0x242C23D1,
-0x24E9248D,0x25A62548,0x26632602,0x272026BB,0x27DA2778,0x28922837,0x294C28F2,0x2A0829AC,
-0x2AC22A66,0x2B7B2B20,0x2C362BD8,0x2CEF2C8F,0x2DA62D48,0x2E5E2E01,0x2F142EBA,0x2FCB2F71,
-0x30823026,0x313530D9,0x31E8318E,0x329C3242,0x334E32F6,0x33FD33A8,0x34AD345A,0x355F3508,
-0x360F35B3,0x36BA365F,0x3763370B,0x380B37B3,0x38B0385D,0x39523904,0x39F539A9,0x3A963A4A,
-0x3B343AEA,0x3BCF3B87,0x3C693C1F,0x3D003CB7,0x3D963D4D,0x3E273DDE,0x3EB53E6E,0x3F413EFC,
-0x3FC83F86,0x404D400E,0x40D14092,0x41514111,0x41CC418F,0x4244420A,0x42BC4280,0x432F42F5,
-0x439E4368,0x440443D3,0x445C4431,0x44A84483,0x44E944CC,0x451E4507,0x454B4535,0x456D4559,
-0x45844574,0x458F4588,0x45924591,0x458B458F,0x457D4585,0x45674573,0x454B4558,0x45274537,
-0x44FB4510,0x44C944E3,0x449244B1,0x44584475,0x44164435,0x43CC43F2,0x437F43A9,0x432C4357,
-0x42D242FD,0x4270429F,0x4209423C,0x419C41D3,0x41294162,0x40B140EB,0x4033406F,0x3FAE3FF0,
-0x3F233F6A,0x3E953EDF,0x3E023E4D,0x3D683DB6,0x3CC93D1D,0x3C203C78,0x3B753BCC,0x3AC53B1B,
-0x3A0F3A66,0x395439AF,0x389638F4,0x37D33837,0x37113777,0x364C36B0,0x358335E7,0x34B7351E,
-0x33EA3452,0x33193384,0x324732B5,0x317631E4,0x30A33110,0x2FCF303C,0x2EFC2F67,0x2E282E91,
-0x2D532DBA,0x2C7D2CE4,0x2BA72C0E,0x2AD32B3A,0x29FD2A67,0x29262993,0x285228C0,0x278127EE,
-0x26B1271C,0x25E12647,0x25122577,0x244224AB,0x237623DD,0x22AA2312,0x21DF2246,0x2116217B,
-0x204E20B2,0x1F881FEB,0x1EC31F25,0x1DFF1E60,0x1D3B1D9D,0x1C7A1CDA,0x1BBA1C18,0x1AF91B59,
-0x1A391A9A,0x197C19DC,0x18C01920,0x18061862,0x174A17A6,0x169016ED,0x15D71633,0x151F157A,
-0x146A14C1,0x13B41409,0x12FD1352,0x1248129C,0x119111E8,0x10DA1135,0x10271082,0x0F760FCD,
-0x0EC40F1A,0x0E110E69,0x0D600DB8,0x0CAF0D07,0x0BFE0C59,0x0B4F0BAA,0x0A9F0AFA,0x09F00A48,
-0x0941099D,0x089508F1,0x07EB0845,0x0742079B,0x069A06EF,0x05F40644,0x054D059B,0x04A404F5,
-0x03FE0452,0x035B03AE,0x02BA030A,0x02190268,0x017801C7,0x00D90128,0x003A008B,0xFF9FFFEE,
-0xFF05FF51,0xFE6CFEB6,0xFDD2FE1F,0xFD38FD89,0xFCA1FCF4,0xFC0EFC5F,0xFB7DFBCB,0xFAEDFB36,
-0xFA5DFAA2,0xF9CDFA13,0xF941F984,0xF8B3F8F7,0xF824F86D,0xF79AF7E3,0xF712F759,0xF68CF6D1,
-0xF607F649,0xF583F5C2,0xF4FEF53D,0xF47AF4BA,0xF3F9F439,0xF379F3B7,0xF2F9F337,0xF27CF2BA,
-0xF200F23D,0xF184F1C1,0xF109F147,0xF090F0CC,0xF019F054,0xEFA5EFDC,0xEF30EF65,0xEEBBEEF1,
-0xEE47EE7E,0xEDD5EE0D,0xED63ED9D,0xECF5ED2E,0xEC88ECBF,0xEC1DEC51,0xEBB3EBE6,0xEB48EB7E,
-0xEAE0EB15,0xEA7CEAAB,0xEA1AEA43,0xE9B6E9E0,0xE951E980,0xE8EDE922,0xE890E8C3,0xE835E865,
-0xE7DBE809,0xE783E7AE,0xE72DE754,0xE6D7E6FE,0xE681E6AC,0xE630E65B,0xE5E2E609,0xE595E5B9,
-0xE54AE56D,0xE500E523,0xE4B7E4DB,0xE472E495,0xE430E451,0xE3EEE40F,0xE3AEE3D0,0xE373E391,
-0xE338E354,0xE2FFE31B,0xE2C7E2E4,0xE293E2AD,0xE260E278,0xE22DE247,0xE200E218,0xE1D3E1EA,
-0xE1A7E1BE,0xE17DE193,0xE154E16C,0xE12EE146,0xE10BE123,0xE0E9E0FF,0xE0C8E0DC,0xE0A9E0BD,
-0xE08CE0A0,0xE072E084,0xE05AE068,0xE040E04F,0xE029E038,0xE015E021,0xE000E00D,0xDFEDDFFB,
-0xDFDDDFE9,0xDFCFDFD8,0xDFC1DFCA,0xDFB5DFBC,0xDFA9DFB1,0xDF9EDFA7,0xDF96DF9E,0xDF90DF95,
-0xDF8BDF8D,0xDF87DF85,0xDF82DF82,0xDF7CDF80,0xDF79DF7E,0xDF78DF7C,0xDF78DF7B,0xDF79DF7C,
-0xDF7CDF7D,0xDF81DF7D,0xDF84DF7E,0xDF87DF83,0xDF8ADF89,0xDF8EDF8F,0xDF95DF95,0xDF9DDF9A,
-0xDFA6DFA1,0xDFAFDFA9,0xDFB7DFB0,0xDFBFDFBA,0xDFC9DFC4,0xDFD4DFCC,0xDFDFDFD7,0xDFE8DFE3,
-0xDFF3DFF0,0xE001DFFC,0xE010E008,0xE01EE018,0xE02FE02A,0xE043E039,0xE057E04B,0xE06CE05F,
-0xE094E07F,0xE0BFE0A8,0xE0EBE0D3,0xE116E0FE,0xE141E12D,0xE16EE15B,0xE19DE188,0xE1CDE1B7,
-0xE1FEE1E5,0xE22FE214,0xE25DE244,0xE28DE278,0xE2BDE2AA,0xE2F0E2DB,0xE323E30E,0xE357E33F,
-0xE38AE371,0xE3BEE3A7,0xE3F4E3DC,0xE42AE410,0xE45FE444,0xE497E47A,0xE4CCE4B0,0xE501E4E9,
-0xE53AE520,0xE573E556,0xE5AAE58E,0xE5E3E5C9,0xE61CE602,0xE655E63B,0xE690E675,0xE6CBE6AE,
-0xE707E6E8,0xE742E723,0xE77CE75F,0xE7B6E79E,0xE7F4E7DA,0xE833E815,0xE86FE852,0xE8ACE88F,
-0xE8EBE8CC,0xE92AE909,0xE96AE946,0xE9A9E982,0xE9E6E9C0,0xEA23EA02,0xEA62EA43,0xEAA0EA83,
-0xEADFEAC2,0xEB22EB00,0xEB63EB40,0xEBA3EB81,0xEBE2EBC2,0xEC23EC03,0xEC65EC44,0xECA7EC85,
-0xECE7ECC7,0xED28ED0A,0xED6DED4B,0xEDB1ED8B,0xEDF3EDCE,0xEE35EE13,0xEE7AEE56,0xEEBCEE99,
-0xEEFEEEDF,0xEF44EF24,0xEF8BEF67,0xEFD0EFAB,0xF015EFF1,0xF05BF039,0xF0A0F07F,0xF0E9F0C5,
-0xF131F10B,0xF178F151,0xF1BFF19B,0xF206F1E4,0xF24FF22C,0xF299F273,0xF2E4F2BB,0xF32BF305,
-0xF372F352,0xF3BCF39C,0xF408F3E5,0xF453F430,0xF49EF47B,0xF4E9F4C4,0xF534F50F,0xF57FF55B,
-0xF5CBF5A5,0xF617F5F1,0xF662F63D,0xF6B0F688,0xF6FCF6D3,0xF746F71E,0xF790F76B,0xF7D8F7B8,
-0xF823F805,0xF86FF850,0xF8BCF899,0xF906F8E4,0xF950F92F,0xF99CF978,0xF9E7F9C0,0xFA30FA0A,
-0xFA78FA54,0xFAC0FA9F,0xFB09FAE8,0xFB53FB2E,0xFB9BFB76,0xFBE2FBBE,0xFC2BFC03,0xFC6FFC4A,
-0xFCB2FC94,0xFCF9FCDB,0xFD40FD1E,0xFD84FD60,0xFDC7FDA5,0xFE0AFDEA,0xFE4DFE2D,0xFE8EFE6F,
-0xFED0FEB1,0xFF12FEF2,0xFF52FF33,0xFF92FF72,0xFFD2FFB0,0x000FFFEE,0x004E002C,0x008A006B,
-0x00C700A8,0x010600E5,0x01420122,0x017F015F,0x01BC019C,0x01F901D7,0x02340213,0x026F024F,
-0x02A8028C,0x02E302C7,0x031F0302,0x0359033D,0x03940377,0x03CD03B0,0x040503ED,0x043F0426,
-0x047A045D,0x04B20495,0x04E904CF,0x05210508,0x055A053F,0x05920576,0x05CA05AC,0x060105E2,
-0x0636061A,0x066D0651,0x06A40687,0x06D906BB,0x070E06F2,0x07430727,0x0778075B,0x07AC0792,
-0x07E007C6,0x081507F9,0x0849082D,0x087A0862,0x08AD0895,0x08E108C8,0x091308F9,0x0943092D,
-0x09750960,0x09A70991,0x09D709C2,0x0A0809F5,0x0A3C0A24,0x0A6C0A52,0x0A980A84,0x0AC80AB6,
-0x0AF70AE5,0x0B270B14,0x0B570B41,0x0B850B6F,0x0BB30B9D,0x0BDF0BCC,0x0C0B0BFB,0x0C380C28,
-0x0C640C53,0x0C900C80,0x0CBF0CAB,0x0CEC0CD4,0x0D150D00,0x0D3F0D2B,0x0D6A0D55,0x0D940D7F,
-0x0DBD0DA8,0x0DE60DD1,0x0E0E0DFA,0x0E360E22,0x0E5E0E4A,0x0E840E71,0x0EAA0E99,0x0ED20EBD,
-0x0EF60EE2,0x0F190F09,0x0F3E0F2E,0x0F630F50,0x0F870F72,0x0FA80F95,0x0FC80FB8,0x0FE90FDB,
-0x10090FFA,0x10281019,0x10461039,0x10651057,0x10831073,0x109F108F,0x10B810AC,0x10D310C7,
-0x10EC10E1,0x110510FA,0x111E1111,0x11331128,0x11481140,0x115E1156,0x11731169,0x1186117C,
-0x11971190,0x11A411A0,0x11AF11AB,0x11B711B4,0x11BA11B9,0x11BD11BC,0x11BD11B9,0x11B711B5,
-0x11AD11B3,0x11A311AC,0x119711A0,0x11881194,0x11781185,0x11671172,0x1155115D,0x11401147,
-0x11281131,0x110F1119,0x10F51101,0x10DA10E7,0x10BE10CB,0x10A210AC,0x1082108C,0x105F106E,
-0x103D104D,0x101A1029,0x0FF61003,0x0FCF0FDD,0x0FA50FB8,0x0F7C0F90,0x0F510F67,0x0F260F3D,
-0x0EFA0F10,0x0ECE0EE2,0x0E9F0EB4,0x0E6E0E85,0x0E3C0E57,0x0E0E0E25,0x0DDC0DF0,0x0DA80DBD,
-0x0D730D8B,0x0D3F0D57,0x0D0A0D21,0x0CD20CEC,0x0C9B0CB7,0x0C650C80,0x0C2C0C4A,0x0BF40C13,
-0x0BBD0BDB,0x0B860BA2,0x0B4F0B69,0x0B170B30,0x0ADC0AFA,0x0AA20AC5,0x0A6C0A8D,0x0A360A53,
-0x09FE0A1B,0x09C509E4,0x098E09AE,0x09570978,0x09230940,0x08ED0909,0x08B808D3,0x0883089E,
-0x084E086A,0x081C0835,0x07EA07FF,0x07B507CB,0x0781079A,0x074E076A,0x071E0737,0x06ED0705,
-0x06BB06D4,0x068C06A3,0x065C0673,0x062B0645,0x05FD0617,0x05CF05E9,0x05A205BA,0x0575058C,
-0x05470560,0x051B0533,0x04F00507,0x04C604D9,0x049B04AD,0x04700483,0x04470458,0x041B042E,
-0x03EF0408,0x03C703DF,0x03A003B4,0x0378038A,0x03500361,0x0327033A,0x02FE0312,0x02D502EC,
-0x02AD02C7,0x0288029F,0x02620278,0x023D0253,0x0219022B,0x01F40205,0x01CE01E1,0x01AA01BD,
-0x01870199,0x01650175,0x01430150,0x0120012E,0x00FC010D,0x00DA00EC,0x00B900CB,0x009800AB,
-0x0076008C,0x0057006C,0x0039004D,0x001B002C,0xFFFF000C,0xFFE1FFEE,0xFFC2FFD2,0xFFA5FFB6,
-0xFF8AFF99,0xFF70FF7C,0xFF54FF60,0xFF38FF46,0xFF1FFF2B,0xFF05FF11,0xFEEBFEF8,0xFED3FEDF,
-0xFEBAFEC6,0xFEA2FEAE,0xFE8BFE97,0xFE74FE7E,0xFE5DFE69,0xFE47FE52,0xFE33FE3B,0xFE1DFE25,
-0xFE08FE11,0xFDF4FDFC,0xFDE1FDE6,0xFDCEFDD2,0xFDB9FDBF,0xFDA4FDAF,0xFD93FD9D,0xFD81FD8A,
-0xFD6FFD77,0xFD5DFD68,0xFD4CFD57,0xFD3DFD45,0xFD2DFD35,0xFD1DFD25,0xFD0EFD15,0xFCFEFD07,
-0xFCEFFCFA,0xFCE1FCEB,0xFCD4FCDD,0xFCC7FCCF,0xFCBAFCC1,0xFCADFCB5,0xFCA3FCA8,0xFC98FC9B,
-0xFC8AFC91,0xFC7EFC88,0xFC75FC7D,0xFC6CFC71,0xFC61FC67,0xFC58FC5F,0xFC4FFC55,0xFC46FC4D,
-0xFC3CFC47,0xFC34FC41,0xFC2FFC39,0xFC2AFC2F,0xFC25FC26,0xFC1FFC20,0xFC19FC1B,0xFC13FC16,
-0xFC0FFC11,0xFC0CFC0C,0xFC08FC07,0xFC03FC04,0xFBFDFC03,0xFBF9FC02,0xFBF9FBFF,0xFBF9FBFA,
-0xFBF7FBF7,0xFBF3FBF8,0xFBF3FBF7,0xFBF6FBF4,0xFBF7FBF0,0xFBF5FBF0,0xFBF5FBF2,0xFBF6FBF2,
-0xFBF7FBF2,0xFBF7FBF4,0xFBF8FBF5,0xFBF9FBF8,0xFBFAFBFA,0xFBFCFBFC,0xFBFEFBFF,0xFBFFFC02,
-0xFC03FC05,0xFC07FC07,0xFC0CFC08,0xFC11FC0A,0xFC14FC0D,0xFC16FC12,0xFC1AFC17,0xFC1EFC1C,
-0xFC22FC20,0xFC26FC24,0xFC2CFC29,0xFC32FC2C,0xFC36FC30,0xFC39FC38,0xFC3DFC3E,0xFC43FC44,
-0xFC4BFC47,0xFC50FC4B,0xFC54FC52,0xFC5AFC58,0xFC62FC5C,0xFC6AFC60,0xFC6FFC65,0xFC74FC6C,
-0xFC77FC75,0xFC7CFC7D,0xFC84FC83,0xFC8CFC87,0xFC91FC8D,0xFC97FC95,0xFC9DFC9B,0xFCA4FCA2,
-0xFCADFCA6,0xFCB3FCAC,0xFCB9FCB3,0xFCBEFCBA,0xFCC4FCC2,0xFCCAFCCA,0xFCD2FCD1,0xFCD9FCD8,
-0xFCE0FCDF,0xFCE7FCE6,0xFCEEFCEE,0xFCF6FCF5,0xFCFFFCFB,0xFD07FD03,0xFD0EFD0A,0xFD16FD12,
-0xFD1EFD1A,0xFD25FD21,0xFD2DFD2A,0xFD35FD31,0xFD3CFD39,0xFD43FD42,0xFD4EFD49,0xFD56FD4F,
-0xFD5DFD57,0xFD63FD61,0xFD6BFD69,0xFD74FD71,0xFD7EFD76,0xFD86FD7E,0xFD8CFD88,0xFD94FD90,
-0xFD9BFD99,0xFDA2FDA2,0xFDABFDA9,0xFDB3FDB1,0xFDBDFDB8,0xFDC5FDBE,0xFDCBFDC7,0xFDD2FDD2,
-0xFDDAFDDA,0xFDE3FDE1,0xFDEAFDE9,0xFDF0FDF2,0xFDF9FDFB,0xFE03FE01,0xFE0AFE08,0xFE11FE11,
-0xFE19FE1A,0xFE20FE21,0xFE28FE29,0xFE2FFE32,0xFE38FE39,0xFE42FE3F,0xFE4BFE45,0xFE53FE4C,
-0xFE59FE54,0xFE60FE5D,0xFE68FE65,0xFE71FE6B,0xFE79FE71,0xFE7FFE7A,0xFE87FE81,0xFE8DFE89,
-0xFE93FE92,0xFE9AFE9B,0xFEA0FEA2,0xFEA8FEAA,0xFEB0FEB1,0xFEB9FEB6,0xFEC0FEBC,0xFEC7FEC3,
-0xFECEFECB,0xFED3FED3,0xFEDAFEDB,0xFEE2FEE1,0xFEEBFEE7,0xFEF4FEEB,0xFEFCFEF0,0xFF02FEF7,
-0xFF06FEFF,0xFF0BFF08,0xFF11FF10,0xFF19FF16,0xFF20FF1C,0xFF26FF24,0xFF2EFF2C,0xFF35FF32,
-0xFF3BFF39,0xFF42FF40,0xFF4AFF45,0xFF52FF4B,0xFF5AFF50,0xFF60FF56,0xFF65FF5E,0xFF6AFF65,
-0xFF71FF6B,0xFF76FF72,0xFF7AFF79,0xFF80FF80,0xFF87FF84,0xFF8DFF89,0xFF93FF8E,0xFF98FF94,
-0xFF9DFF9A,0xFFA5FF9D,0xFFABFFA0,0xFFADFFA7,0xFFB0FFAE,0xFFB7FFB3,0xFFBCFFB6,0xFFBEFFBC,
-0xFFC1FFC2,0xFFC6FFC7,0xFFCBFFCB,0xFFD0FFCE,0xFFD5FFD1,0xFFD9FFD4,0xFFDCFFD9,0xFFE0FFDD,
-0xFFE4FFE0,0xFFE7FFE3,0xFFE9FFE7,0xFFECFFEC,0xFFEEFFEF,0xFFF1FFF2,0xFFF5FFF5,0xFFF6FFF7,
-0xFFFAFFFA,0xFFFCFFFC,0xFFFEFFFE,0x00010000,0x00010002,0x00030005,0x00050008,0x00080008,
-0x000A0009,0x000B000C,0x000D000E,0x0010000E,0x00100010,0x00100013,0x00130015,0x00150015,
-0x00180016,0x00190016,0x00190019,0x001A001C,0x001C001C,0x001D001D,0x001F001E,0x00200020,
-0x00210021,0x00240021,0x00250021,0x00240024,0x00240026,0x00250027,0x00260029,0x002A0028,
-0x002A0028,0x002B0029,0x002D002A,0x002E0029,0x002E002A,0x002D002D,0x002D0030,0x002F002F,
-0x0030002E,0x00300030,0x00310031,0x00320030,0x00310033,0x00320033,0x00350033,0x00360032,
-0x00380031,0x00370031,0x00370034,0x00370035,0x00390034,0x003A0034,0x003B0033,0x003C0033,
-0x003B0034,0x00390035,0x00390037,0x00390037,0x00380038,0x0037003A,0x0039003A,0x00390039,
-0x0039003A,0x003B0039,0x003C0037,0x003B0037,0x003A0039,0x003B0039,0x00390039,0x0037003B,
-0x0036003D,0x0038003C,0x0039003A,0x003A003A,0x003A0039,0x00390039,0x003A0039,0x003C0036,
-0x003B0036,0x00380038,0x00390038,0x00390038,0x00380038,0x00370038,0x00370038,0x00370038,
-0x00380036,0x00390034,0x00390034,0x00390033,0x00370033,0x00340035,0x00320037,0x00340037,
-0x00350034,0x00350033,0x00350032,0x00340031,0x00310033,0x00300034,0x00320032,0x00320030,
-0x00310030,0x00300030,0x0030002F,0x0030002E,0x002E002E,0x002E002E,0x002F002D,0x002E002B,
-0x002E002B,0x002D002A,0x002B002A,0x002A002B,0x002B0029,0x002C0027,0x002A0025,0x00290025,
-0x00280025,0x00250025,0x00220027,0x00220027,0x00230025,0x00220024,0x00220023,0x00210022,
-0x001F0022,0x00200021,0x001F001F,0x001F001E,0x001D001F,0x001C001D,0x001C001E,0x001D001B,
-0x001C001A,0x0018001B,0x0016001D,0x0018001B,0x00190019,0x00190016,0x001A0014,0x00180013,
-0x00150015,0x00120017,0x00110017,0x00110017,0x00120014,0x00120013,0x00110012,0x00120011,
-0x0012000F,0x0010000F,0x0010000F,0x0010000E,0x000F000D,0x000E000E,0x000D000E,0x000D000D,
-0x000B000D,0x000B000D,0x000B000C,0x000A000B,0x000A000C,0x000A000A,0x000B0009,0x00090009,
-0x00080009,0x0007000A,0x00070009,0x00090008,0x00080006,0x00060008,0x00070008,0x00080005,
-0x00090004,0x00080004,0x00060004,0x00050006,0x00050006,0x00060005,0x00050004,0x00050005,
-0x00050004,0x00060003,0x00070002,0x00060000,0x00040002,0x00040003,0x00040002,0x00030003,
-0x00020003,0x00020003,0x00010004,0x00020003,0x00020003,0x00010003,0x00000004,0x00000004,
-0x00010003,0x00020002,0x00040000,0x0005FFFE,0x00020000,0x00000001,0xFFFF0003,0xFFFF0004,
-0x00010002,0x00030000,0x0003FFFF,0x00020000,0x00010000,0x00010000,0x00000000,0xFFFD0003,
-0xFFFC0005,0xFFFD0005,0x00000002,0x00000001,0x00010000,0x0003FFFE,0x0002FFFD,0x0001FFFE,
-0x0001FFFF,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,
-};
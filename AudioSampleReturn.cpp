@@ -1,333 +0,0 @@
-// Audio data converted from WAV file by wav2sketch
-
-#include "AudioSampleReturn.h"
-
-// Converted from return.wav, using 44100 Hz, 16 bit PCM encoding
-const unsigned int AudioSampleReturn[2625] = {
-0x81001433,0xFEAEF6DF,0x02D803AF,0xFDB5FFA8,0x01D5FFA2,0xFC13FF52,0xFF7CFB96,0xFD68015F,
-0xFBE4FB57,0x0145FFA7,0x0026001B,0x411E1191,0x08D24EA8,0xEEF4C422,0x37ED2173,0xDF4E20DA,
-0x38DEEE7E,0xFECB54F7,0x0451D96F,0x29640EE8,0xB6F90F43,0x1BE51F82,0xDC06E77D,0xFCE7D1DF,
-0x051B2DA0,0x869DA688,0x5EA6DBC0,0xA4B4264C,0xCCDA8D64,0x1F5E013F,0xB99B01B9,0xCD5FD915,
-0x03AEDF56,0xF2B60798,0xF0FFE15B,0x0A9AFADF,0x0EEA111B,0xD35B0B56,0xE3E9DD80,0xE9F8D791,
-0xE958F6E9,0x0FA303A2,0x39130427,0xF2C42320,0x0F711A6D,0xF1FD0ABE,0x1162F724,0xFFB31983,
-0x0147101C,0x01EAE3F5,0xE48AEE86,0x0A8CE328,0x47FB1CBE,0xFCA526D7,0x058DF308,0x159C1CF8,
-0x0CF81109,0x3C7524FE,0x3DB84EE9,0x14201BCF,0x5B392B97,0x26C95E7F,0x246D18A5,0x395F2F9D,
-0x0F950882,0x0AD2FF4B,0xF3F30D27,0x1619F980,0x08C0182B,0x00FA0776,0x1DAF2922,0xE91FEE46,
-0x0BED04B2,0xFBDE06E0,0x02ACF5EC,0xEB8BF33F,0xD99AE2FF,0xF717E581,0xDDBBEF04,0xF9B0F0D1,
-0xEAA6E89A,0xDCF0D87D,0xD92CD4B1,0x231600B4,0x06B01784,0xF6A10394,0xE0E2FB9C,0xF7A9D461,
-0xF48CFB1E,0xFB88F9CE,0x298A10F4,0x0B68188A,0xF9B7F51A,0xF049FEB4,0xCB94DE47,0x091FEEDF,
-0xF2A307BD,0xFA0EE7F5,0x18971632,0x01F40532,0x31E21CF1,0xF27914B9,0x002EF22F,0x0BCFFE97,
-0x0DB51BB0,0xFD96FCBC,0x06B90352,0x00C40B9E,0x12FDFFE3,0x1F181D3C,0x0E9D17B0,0xF8BAFFBA,
-0x122D0134,0x0D36146A,0x155F0ED2,0x26C9200F,0x09BB1EB1,0x281010E8,0x420734C2,0x33CC424E,
-0x244D2BFF,0x0B001439,0x164208BE,0x1C9C1F6F,0xFDE71533,0xE3C9EECE,0xE6B4E540,0xF7FCEAB5,
-0x17270965,0x042D0BB9,0x05640927,0xDF12EF18,0xE395DD0A,0xEFE3EC76,0xFF2EF2C9,0x0D4A0DB4,
-0x092A080E,0xF9B3FEF4,0xEE6BEFD8,0xF477F5F6,0xE5A1EDAF,0xE5F2DF68,0xDA41E360,0xD9A1D909,
-0xE3BBDD7C,0xD7BADFCA,0xC8B3CD89,0xC6D8CD80,0xB312B40D,0xCFCCC3E9,0xD2FED4BE,0xB896C5AC,
-0xAC5DAF17,0xB3F4B399,0xC634B7AE,0xDE78D963,0xD139D9BF,0xC9E9C9DE,0xD9CDCD60,0xF5F9EC5D,
-0xF8FBF751,0xF59AF6B1,0xFB53F604,0x0CE9036D,0x19A214B4,0x2FCC2009,0x4A42409D,0x44DA4A5A,
-0x5196471A,0x4F7D5522,0x3E60443A,0x529E47B3,0x49EF5280,0x490746A5,0x54E94EFF,0x53E25727,
-0x5D7F5664,0x562E5EE5,0x3E624677,0x391039CE,0x2C54348D,0x3A9F2E1A,0x31D13CB5,0x22EC26B5,
-0x2AA8276F,0x2B712E53,0x2FBE2BAF,0x17412830,0xF981062B,0xF4DAF456,0xE42CEEB2,0xCD2DD70D,
-0xBE5CC6FE,0xB1F7B4BC,0xB4A6B093,0xA3EBB161,0x8F5596DA,0x863B8D09,0x832E8179,0x88E2867B,
-0x8E178A4D,0x981F9496,0xA0349BA0,0xA3B3A14B,0xA9F7A8C3,0xBCC1B0D1,0xD04DC9E1,0xD63FD472,
-0xD89DD6C5,0xE758E0AC,0xEB99E93C,0xF320EC28,0x0326FCE7,0x0A590484,0x1EF71476,0x2997260B,
-0x3A7F31F5,0x43413D97,0x4DD449F2,0x4DCD4F4F,0x577F4F44,0x6A8862FA,0x68756C81,0x67EA6830,
-0x6BB16939,0x6F606E10,0x70327011,0x648B6C25,0x546F5C8F,0x44034AE5,0x3E854114,0x2E3D3918,
-0x27A429C5,0x1AA42232,0x03D00EB4,0xF8C9FEF6,0xEC3DF0CD,0xE3B4E8D2,0xD4E0DC4D,0xC585CD21,
-0xC443C1B0,0xBC44C10A,0xB682B7E2,0xABD0B2C1,0x9FE4A4D6,0x9CDA9F49,0x982398F5,0xA2119D5C,
-0xA5D8A343,0xA83AA719,0xA9C2AA1E,0xB0DFA9E2,0xBDC9B840,0xBF38C033,0xC72DC22D,0xC4B1C46A,
-0xD05DCAE2,0xE345DAFC,0xEAD5E5FE,0xF37AEF9A,0xF7DBF602,0x0E9E021F,0x20ED177E,0x1FA5211C,
-0x28C8221C,0x342530C2,0x3366320D,0x40FA3946,0x41D245B3,0x48464246,0x4B404D2A,0x49A947BB,
-0x55454FE8,0x50075451,0x4DF44CE7,0x4DAB5048,0x3B2246B9,0x2FA234B9,0x205628FB,0x100616E5,
-0x084D0CC7,0xF872FFBA,0xF205F48F,0xED27EE8D,0xEAF5EC05,0xEA3BEC16,0xD6E7DF89,0xD37ED342,
-0xD2C5D5AD,0xCEA7CF21,0xCF76CE72,0xC68DCDD1,0xC686C4AA,0xCB2DC884,0xC59CC8AD,0xCA9FC730,
-0xCC0ECCBE,0xC3EBC77C,0xC94CC708,0xCA49C9FC,0xCFD2CA34,0xD76FD66E,0xDBFDD958,0xE702DEF4,
-0xF23CED8A,0xFBFAF857,0x04AC01B6,0x0D1B0768,0x1A30144A,0x1FCF1F64,0x239F1FF8,0x2B9B2944,
-0x2F5A2BDA,0x366732B0,0x326036E3,0x31732FA6,0x2C342FEC,0x26252921,0x241A23E2,0x21612320,
-0x1A1F1EEE,0x198C18BF,0x194018F4,0x1FF11C83,0x1A47208C,0x149214BF,0x09AD1087,0x008D0388,
-0xFEE70108,0xFA66FD0C,0xF503F648,0xEF75F24C,0xEB9FEC57,0xECD2ED42,0xE563EA7E,0xDF86E177,
-0xD892DD69,0xCFCFD49E,0xD682CFDE,0xDCE7DB9F,0xDEADDCD2,0xE269E09A,0xE0ADE064,0xE8FBE485,
-0xF398EEB8,0xF9BAF75A,0xFCFCFB78,0xFFDBFCCA,0x0AC804D6,0x15E311CC,0x166D1552,0x1B54197A,
-0x20911F3C,0x1DC91EC2,0x24FF1F17,0x299028CC,0x2AE42B12,0x28502AA1,0x241E2475,0x2A172714,
-0x28752A3B,0x255D26A7,0x20D9230F,0x1DB11E0B,0x1BC51CEF,0x16081AA6,0x0CE9105C,0x075D0A87,
-0xFFC30301,0xFE62FF18,0xFD07FF25,0xF9E9FA9E,0xF68BF90C,0xED86F161,0xE918EBD1,0xDFFBE3C1,
-0xDEF3DF12,0xD86EDD50,0xD37FD3FB,0xD96BD662,0xD82FD875,0xDC0FD852,0xDF0CE00C,0xDC73DC2D,
-0xE147DF4B,0xDEFFE1DA,0xDEBBDD22,0xE3B3E20E,0xE569E3AC,0xEC96E77B,0xF21AF0FB,0xFBD6F588,
-0x064802AD,0x091907C0,0x169D0F65,0x1F901BCD,0x2615219E,0x293328A4,0x2A102916,0x32132D57,
-0x32173345,0x31E23177,0x2F8830EF,0x2D6D2E6E,0x2C122D60,0x28352A9F,0x275E275F,0x24A125F1,
-0x215722B8,0x1DAB1F35,0x1C4A1D00,0x19491BC3,0x11371586,0x0B8C0DA8,0x09300A90,0x05B00871,
-0xFEE101DE,0xF7F5FBFC,0xEDE9F252,0xE9A1EBB5,0xE1B1E590,0xD932DEA4,0xD0C0D413,0xC7E3CC7B,
-0xC074C428,0xBC17BE14,0xBB57BABE,0xBD94BCF0,0xC00EBE75,0xC3A7C115,0xCA09C65A,0xD12FCD9B,
-0xD4DFD34F,0xD963D7AF,0xDF46DB96,0xE96EE42A,0xF1C3EF04,0xF676F262,0x007CFCFF,0x006B0024,
-0x08580400,0x0D840D5F,0x0EDD0C7B,0x14961261,0x150F1484,0x1D181735,0x265B21C3,0x29F2286F,
-0x2C192C58,0x2EC32B45,0x321B3181,0x31FB30EB,0x35743462,0x334D342E,0x316D31AF,0x32BA3230,
-0x29B42EDC,0x27CE2649,0x25F6281E,0x1E912254,0x12F91992,0x0E2D0EF9,0x06640BAA,0x028801BC,
-0xFF8703A7,0xEE86F5C9,0xE9D8EDBF,0xEDABE7B6,0xEB97EE39,0xEA39EAA2,0xE491E498,0xE4CCE76B,
-0xDC0BDCB2,0xDB48DE45,0xDCBFDE02,0xD5B2D2C8,0xE04ADF76,0xD9B8D9E5,0xE28EDD07,0xE4A9E3F6,
-0xDF68DFAB,0xE7CFE1E7,0xF41FF32C,0xEA57EC4E,0xF658F428,0xFA35F499,0xF06AF265,0xF3FFF635,
-0xFE3DF9E6,0x00410109,0x07E70943,0x0C080DA4,0x0C9103BF,0x0D5F0C2F,0x1C8B1535,0x1BD61EFE,
-0x194E2474,0x1ACD1638,0x245F1CFE,0x18932950,0x172F0EEA,0x21E52596,0x1B7815BB,0x17BF15E7,
-0x289E2B53,0x14E21F5F,0x17B51541,0x26781C4D,0x0A15183B,0x0F3E09BF,0xF482061D,0x003EFB9A,
-0xFEAA02FC,0x0AF405D5,0xF967006D,0xFF45FA61,0xFD9DFE80,0x05D7FEA4,0xFEEF0563,0xFEEDFC7A,
-0xF629000A,0xFCBAF81C,0xFA1EFEF9,0xED33F5D6,0xEF43EA5C,0xEE90F2D0,0xF908F1D1,0xEA58F522,
-0xEE36EF86,0xE9C5E9BB,0xF0C3ED35,0xF66FEF2D,0xF218F6EF,0xF56EF6C3,0xF642F35D,0xFDDCFA4C,
-0xFCECFB74,0xFF530114,0xFF5E01C7,0x09390664,0xFEE2051F,0x0768FF09,0x024909CC,0x0476016F,
-0x046C0561,0x003F023C,0xFCB50062,0xFEDEF879,0x017301AF,0xFB4CFADB,0xFEC7FFF0,0x05D00318,
-0x03E50038,0x04F10CD7,0x02FEFFEF,0xFC53006A,0x04BEFFB9,0x06810346,0x065F0BA7,0x044E0134,
-0xFF02066A,0x0398FED0,0x054D014F,0x040105C4,0xFF6EFF31,0x06010409,0xFA370131,0xFE35FD94,
-0xF9A8FEF9,0xFFF4FD6F,0xFAB2FC28,0xFA90FB14,0x0219FA93,0xF8D8014D,0x063EFC4F,0xFA76045B,
-0xFBC7F7C1,0xFE40FE09,0xFE060194,0xFAF4FA20,0xFD0EFCC1,0xF8CBFC20,0xFA1EF873,0xF4CCFB2B,
-0xF242F1BF,0xF3AAF316,0xF2B1F2F3,0xF071EF67,0xF1F2F0BB,0xF0DAF1CF,0xF157EF59,0xF6CCF74C,
-0xF0FDF254,0xF4BCF347,0xF615F765,0xF2A7F0B9,0xF80AF7CD,0xF7A7F694,0xF7DBF83D,0xF88DF8FD,
-0xF7EDF6AB,0xF931F982,0xFE78FAAF,0xFD84FDE1,0x0100FF4D,0x04230276,0x04FD05FD,0x04400342,
-0x07DB0467,0x0F750E8B,0x0DE30C06,0x0B310EE4,0x0C5B0A46,0x11F2114C,0x15341253,0x0EB3122A,
-0x0FEE0DEB,0x11771196,0x14E011F6,0x0FA91311,0x0E2F0E51,0x0F220E06,0x0E3E10F3,0x0E1A0B62,
-0x0C4C0FC2,0x0D750B05,0x0C000E13,0x07BE0ACC,0x067805A1,0x06E008E5,0x0460043B,0x003A0467,
-0xFA3EFADE,0xF9B0FB56,0xF651F735,0xF417F4CD,0xF258F367,0xF362F272,0xF531F66C,0xF023F14F,
-0xF471F2F1,0xF368F40C,0xF244F30B,0xF6CEF437,0xFA09F8D6,0xFE2BFAE6,0x00E70111,0x0020000B,
-0xFF71FF3D,0x02B70179,0xFEFB0174,0x0041FF73,0x006D0184,0x00D7FE7E,0x07A0053B,0x0700068F,
-0x0B7308EC,0x096E0B7E,0x09300A03,0x09290731,0x0C5C0C16,0x103B0D4B,0x11D811A3,0x11B410A2,
-0x16BC148F,0x13A215D2,0x148613FE,0x147E1444,0x0E24127D,0x0B750C71,0x0847092F,0x07A20883,
-0x02140500,0xFDB9FF2A,0xFFB5FEF5,0xFD47FD0D,0xFE84FCE4,0xFF7B0089,0xFFF5FFEF,0xFDA4FD5D,
-0xFBC3FCA1,0xF3C9F8A6,0xF8A7F75A,0xF99DF081,0xF0CDFCE7,0xF99EF52E,0xF750F8B3,0xFB45F679,
-0xF129F4B8,0xF85EF35E,0xF8C5FD6F,0xEAD9EDD2,0xF5BFF006,0xEC5BF61B,0x085AF819,0xF87F04C7,
-0x0C6B0083,0xF79A0651,0x0CC10FF7,0x26DE072B,0x00041A1F,0x1370FF32,0x047210CD,0xEB880EEF,
-0x097FDE77,0x09101E3E,0x0167076D,0x1DB4FBDC,0xFE402999,0x1BA1F34B,0xF3570846,0x0FE4184C,
-0x0024ED2B,0x016320CD,0xFA90E4F1,0xF9C106DF,0x122701E3,0x000E03A6,0xEEB6071D,0xF44EF1FE,
-0xE845E874,0x00530006,0x02DEFFBF,0xF81BF57D,0x0F980EE3,0xF040F815,0xDB45F48F,0xE867C8D4,
-0xCD85E54D,0xE08DD26F,0xF01EE7D2,0xD1F9DA32,0xF9E6EE1F,0x0481FDF5,0xFC80F8B7,0xF8B9F821,
-0x0DCA0168,0x03290131,0xF132FB5C,0xFB9401E7,0xFD4CF0DE,0xF9870704,0xFB78FFDF,0x0391F9FC,
-0x07DD1164,0x1B040BCA,0x0CE01B54,0x0305FBF3,0x051F09BC,0x17D21137,0x0DD90371,0x11C11B25,
-0x0EDE0C0B,0x123C193B,0x28D51B2C,0x10F81E92,0x1FF51D0B,0x110B1C3B,0x10591538,0x08170313,
-0x0BC10788,0xFC78FD9C,0x02BC0630,0x0899037B,0xFDCD07A2,0x0297F97D,0xF73F0427,0x06BE04AA,
-0xF4E6F5B8,0xF1C0F693,0xE54AE7F1,0xE7BBE71C,0xDA9EE72B,0xD9C0DA58,0xE238D84F,0xE22AE285,
-0xEE24EEF5,0xE4C0E50B,0xE435EA89,0xEE09E0C4,0xDDADED42,0xF354E3D5,0xED47EDC0,0xF211F897,
-0xF93CF0FE,0xF92FFD09,0x051DFAE9,0xF8A9FF78,0x09A50333,0x09F00509,0x09531296,0x19D30D91,
-0x17B91893,0x1AB71B31,0x1AFD1608,0x18DF2354,0x161B1379,0x196A17B7,0x193C1962,0x1A071953,
-0x1B4B18D1,0x19952073,0x170C133B,0x19661AF0,0x1A2A1A76,0x11A21292,0x10861411,0x0EDF10DC,
-0x0E2A0A7D,0x0D241094,0x087E0AEA,0xFE39017B,0xFEE5FE25,0xFB32FA04,0xFA34FF9B,0xF4D2F7C8,
-0xF003F1A2,0xEAF1ECF8,0xEB5AE962,0xE86CEB98,0xEAABE7EF,0xE292E9C1,0xEB91E66A,0xE5A8E889,
-0xE34EE2F9,0xE53EE488,0xEFC8EB2E,0xEC7EEEDD,0xED07EA01,0xF18EF320,0xEFAAEEA8,0xF743F755,
-0xF78AF3A0,0xF5FCF8AB,0xFEF4FAD3,0x02C201C5,0x040D0047,0x04FD0515,0x06E707B2,0x098C0741,
-0x0E090D94,0x0E270D56,0x139B1145,0x16BF15C3,0x1BFD182D,0x18601BCB,0x1140153E,0x0A960E49,
-0x0879096B,0x077107E3,0x0ACC07F4,0x06A00718,0x11200E6F,0x103F0ED6,0x0EF21261,0x0A5B0CDD,
-0x071C0712,0x04D80763,0x00DD0248,0xFB04FEE4,0xFA3BF74B,0xF864FAAC,0xF5CEF6FC,0xF728F74E,
-0xF83AF7EF,0xF8A3F87A,0xFA96F883,0xFB58FD94,0xF5F1F600,0xF8B3F7B8,0xF8BCF946,0xF312F5BD,
-0xF11CF180,0xF0AEF0BD,0xF30DF2CE,0xFA64F4DB,0xFB36FB8A,0xFB6FFA93,0x0030FDED,0xFE56FF63,
-0x058C0212,0x01F404B5,0x038100DD,0x06A00637,0x04910650,0x040803AB,0xFFF703D7,0x03F1FF78,
-0x02410493,0x05050410,0x01380329,0x04B902DC,0x01770213,0x043603AB,0xFE6501CF,0x0011FF0F,
-0xFB10FDF9,0xF789F8BC,0xFA54F81A,0xF6A1F88E,0xF9E9F8AD,0xFB1EFAF8,0xF53FF829,0xF589F510,
-0xF264F3B5,0xF26BF287,0xF4B4F30C,0xF028F303,0xEF6FEE90,0xF264F227,0xF0B3EFD7,0xF263F2A7,
-0xF150F1A6,0xF77BF4F0,0xF6A5F680,0xF4FCF6A7,0xF2DBF303,0xF3EDF30F,0xF25BF1A9,0xF655F6F3,
-0xF204F34F,0xF62AF51F,0xF6AFF486,0xF989F91F,0xFE30FB73,0x04BC00B9,0x0670059A,0x06F60672,
-0x0AA40955,0x0CF10A96,0x0B270CBB,0x0CE90C89,0x07C509E6,0x0BDD09B5,0x0A810ABF,0x09300A38,
-0x07870935,0x064A069B,0x063B05C6,0x07880868,0x07FA0675,0x09B10869,0x0B4509C5,0x06B10CCE,
-0xFF4D008F,0x01B80445,0xFD91FAA9,0x055F046E,0x0745050B,0x0EDB0974,0xF9CC07F3,0x0661F8EE,
-0xFD280447,0xF478FB64,0xF4B2F235,0xF881F29A,0xF7DF06E5,0x0E15FCD6,0xFF5E0FB2,0x0BBDFA2C,
-0xFE0D0379,0xF5E60ADC,0xF693F22B,0xF956F598,0x05A1FE64,0x0AAAEE3C,0xF2840207,0x08E90444,
-0x01C40501,0x0CA1114E,0x18720DEA,0xFC342390,0x14C5E7E7,0xF4B411DD,0x15E2057A,0x0721FC17,
-0x0F2D1EDF,0x0658E9FF,0xF1650E72,0x12D60660,0x0E62074C,0xF43801F0,0x03FA007F,0x146208D2,
-0x0C900CDB,0x1271130B,0x1720073A,0xEF51135E,0xFE93F5B1,0xDEBEED1E,0xF433EC09,0xF53BEA51,
-0x04B11103,0x099B0218,0xFE1305B9,0x098AFFC5,0xFC77FAE0,0xFF420CCE,0xF930F615,0x1263FDEC,
-0xFD7214AF,0xFA0FFC2A,0x07F2FAB3,0xF4450490,0x0C2EF58D,0xF42E008E,0x080810C6,0xFBCDED87,
-0x0EBE1188,0x0A3908EE,0xF7F70147,0x0219FBCF,0xEE24F84F,0x0B80FFFA,0x0378020F,0x0BCD11FC,
-0x0032FC6F,0x074006DE,0x060507AD,0x04E502D5,0x0B350673,0xFDAD06AF,0x02B9FCBE,0xFB450286,
-0x0430033A,0x098AFC98,0x056C0EFA,0xF6DD0CA4,0x0302E4EB,0xF290F9D0,0xF6660538,0x0C0CF236,
-0xFA2404BE,0x120D03D0,0x0C00165D,0xE76EF857,0xF756F238,0xD636F2FF,0xE02ABF58,0xFC36FC6C,
-0xF845F7CB,0x226B0829,0xFFE12325,0x07B1FDEC,0xFBF002FB,0xEBB6038E,0xEFDAD7AF,0xEF9EE7C1,
-0xFA09F430,0x1AA1F242,0x0FAE3447,0x0C680FFD,0xFDAC0DE2,0xF485F8B2,0x10E1FF96,0xDD0BEE11,
-0xF273F772,0x0715EF5C,0xF1561B03,0x08D9FDAB,0x086D17E9,0x00080D3E,0x2E1002AE,0xF5A72B90,
-0x12E2E3BF,0xE62BF7B5,0x16EB09D1,0xF73DFDAA,0x03E9054C,0xEB13EFE3,0xF724FE2D,0x0F63F8FE,
-0xED8108FB,0x0E82FB4C,0xEC1EF434,0xFFF509D5,0xDFB3DE6F,0xF15AF671,0xDC57DD6C,0xEF9FE1B6,
-0x125DFA63,0x02DC0829,0xFBCF064F,0x28441447,0x0B3C0ADC,0xF751124D,0xFDB00367,0xD284CFA3,
-0xF628F6D1,0xDBD0C8AA,0x005D0862,0x2C970E73,0x2BB2244A,0x058B2865,0xE3E4F016,0xF4DDE242,
-0x1C7702DC,0xC77BECB6,0x1271F2C4,0xF3A7EE9A,0xFBA427E2,0xFBFAE9E7,0xFACFFB8C,0xE5D0EB5D,
-0xE86BDB9F,0xFA4A07FC,0xF2DCE2F1,0x26940132,0xDAA1019A,0xF3921818,0xF6170332,0x1C4A1FFB,
-0x13850823,0xFCE424C2,0xE454D13F,0x187FE5C3,0x1C3334C4,0x1E2E18CC,0xEF602280,0x015EEA94,
-0xFECAEC4B,0xE938E277,0x053C0F7D,0xF93704BA,0xF58C00B8,0xF4C1EC16,0xB9E7C724,0x14ADE869,
-0x31E4235F,0x2F4F3FB8,0x366D2D93,0x1F9629E1,0xF58B139F,0x3C2417E9,0x12101934,0x1F770E81,
-0x01100CEF,0xF0BD08B6,0xE8B2DB77,0x0FA1FB67,0x1A601525,0x13E91694,0x202D17D9,0x052E1FC2,
-0x36E31A3E,0x004F13BA,0xF0F80F53,0xE771DC20,0x10030932,0xF5F2E07F,0xE72BFF5E,0xF1C8F75A,
-0xDEC6E1C2,0x023CD9EE,0x044F1259,0xF47C079C,0xE2FCF17C,0xE378E6AF,0xEFDBD5E6,0xEE23F553,
-0xE9C3F337,0xF771F4F5,0x1804F4B4,0xD4C8E876,0xEA9CE64C,0xEB26E849,0xF80A07FB,0x0B63DA68,
-0x010E24D0,0x012AF64D,0x1B833770,0x2EDAFD4E,0xECE703E1,0xE8600AA1,0xDB5EC566,0x086C113B,
-0x1962F19F,0xEFAE1A3B,0x2242229E,0x13F30CFE,0xE8F4F1BD,0xC016E456,0xD60FC3A8,0xE2A1D39F,
-0x2D3F0050,0x43C43D71,0x46B14597,0x4A8E5041,0x2A8A3B64,0x14012992,0xC2EED8BC,0xF229E21B,
-0x010BFCD1,0x25E91687,0x17641EE3,0x0B1B14A7,0xDCF9ECE4,0x0D38ED72,0x099800F7,0x0DF616EC,
-0xFBF30DDB,0xEE28F5DF,0xFB58F41D,0xE4F4E2D3,0xEE1DEB32,0xEA9CFB2D,0xDECFD55E,0xD91BE845,
-0xFA8ADB2D,0xE4FBFC6B,0x1454FCD8,0xF78A006E,0xEC57F427,0xE089E615,0xEDADEB1B,0x0503F30B,
-0xFD3C092C,0x0553F8AC,0x005D0ECC,0xE387E8FD,0xBF1ED035,0xD5FAC8EB,0xE5EADF12,0x1FFE0A8B,
-0x13D41491,0x09E517FF,0xF84EFD95,0xD6E9E80B,0xEB4AD80B,0x0093F827,0x1CC60B90,0x40FB331B,
-0x494E4961,0x2B7E3568,0x079F21FA,0xF2C2F584,0xE6A2E8E2,0xFAF9EF3E,0x06DC070E,0x1CF81216,
-0x28A21E07,0x28663480,0x079A11A9,0xFB7408E4,0xF442E640,0x038603D5,0x13390780,0x149915A2,
-0x12D71A78,0x14800E5E,0x04890F84,0xFD1C01B7,0xE34CED76,0xEC7EEAA1,0xEB61E969,0xF5B8EE02,
-0xF21AF4F4,0xEFEEF2FF,0xE78FE98A,0xEA69EDCF,0xE799E4EC,0xFAF2EEA6,0x08DE044C,0x064C09DD,
-0xF8D203DE,0xEDDFEEF5,0xDA68E6F5,0xDA25D7F3,0xDE92DC08,0xDEF5DC78,0xEB86E5E5,0xF200EF33,
-0x0CF200CB,0x1C4317BA,0x232A22B7,0x0B1315E1,0xF890030E,0xE4EFEB6E,0xF1FDEB3B,0xF12CF3CC,
-0x0C87FAAD,0x15C3139E,0x1F5217E0,0x1B552295,0x180C1809,0x1459167D,0x128F122F,0x103712CD,
-0x0FDE107D,0x10650FCC,0x0EEE0DBB,0x12E712F7,0x102B0F84,0x0AB50DCC,0x0F3B0E25,0x163A1201,
-0x1D501B43,0x136D1BC8,0x0DE30F73,0x05D709B7,0x019E052F,0xFE00FE3B,0xF5F1FA4A,0xF8D2F825,
-0x048DFDD7,0x0AC606F5,0x09080BFD,0xFF770373,0xF211F98E,0xE3ADEA2C,0xDB57DCB3,0xE570E133,
-0xE81BE61C,0xEF7AED16,0xF2EFF127,0xF456F3AC,0xF94CF62D,0xFEE4FED4,0xFAB3FC62,0xF7C1F992,
-0xF5EFF649,0xF6AFF54B,0xF3BDF55D,0xF463F680,0xF155F1AC,0xF577F267,0xF88FF729,0x0468FDC2,
-0x05A50621,0x0AC70711,0x07E90B89,0x0AF807DA,0x07000C17,0x050204B2,0x07100450,0x0D9C0853,
-0x188A1511,0x1CB419DA,0x1BAE1DB0,0x140519A9,0x0FF410CD,0x0E2D0FA8,0x09A90CEB,0x05BC0554,
-0x05B906D8,0x03BF0419,0x0E8A0733,0x08680D6F,0x0B7408AE,0x0F610E81,0x13290F05,0x0F9312FA,
-0x045C0BC9,0xF486FAEC,0xF065F00D,0xF2DEF379,0xEF3DF154,0xEA58EB36,0xE8CCE919,0xE88EE67C,
-0xF6C7F079,0xFA11FA9A,0xFE00FAA1,0xF8D0FC25,0xEE53F3B3,0xE897EB66,0xE56DE595,0xE3C6E4CE,
-0xEB8DE673,0xF27CF107,0xF362EFD1,0xF596F67C,0xF0F9F305,0xEF58EF39,0xF3DEF211,0xF445F340,
-0xF8C8F706,0x01C4FC4E,0xFD29FEC5,0x0165FFB1,0x05260459,0x0513037A,0x0B240A0D,0x0ADD09E5,
-0x12A5112D,0x0C270FF4,0x0E3E0AA7,0x07AB0C6A,0x03430422,0x0662041C,0x08DC08D6,0x0BBC0835,
-0x110C10D4,0x0FFE0ED5,0x156B130E,0x11611459,0x0B780F2B,0x0A5E086C,0x0F1C0D69,0x0CD80E88,
-0x0AD00B29,0x06FE0945,0x090B079A,0x0C7B0C30,0x0C930D57,0x01F406C8,0xFF61FF0C,0xFA19FF13,
-0xF73CF73C,0xECDDF302,0xE900EA10,0xEA89EA6E,0xF2D6F04E,0xF781F3F4,0xF6C4F5FF,0xF327F50A,
-0xEE1FF227,0xEB0BEBE4,0xEC34EB90,0xEF57EC12,0xF754F4AB,0xFBC2FA29,0xF7D3FBD7,0xF101F396,
-0xEBB5EE23,0xF04EED0A,0xF616F27F,0xFD5FF9E9,0x0067FCE9,0x003D02B3,0x01D40013,0xFAE5FF2C,
-0xF828F863,0xF8ECF87F,0xFD58FA52,0x01D1FFCA,0x0A0905DB,0x0E850A95,0x13CE13C7,0x101510FE,
-0x0D120FD2,0x0C9C0CE8,0x0D9F0D27,0x106D0DB9,0x165F130E,0x15B51661,0x0DCB1539,0x08B60A09,
-0x04CC05FB,0x07530715,0x080506AF,0x0C750990,0x0E950E39,0x06310969,0x054F06C7,0xFF080323,
-0x00B9FF7E,0x0188FE30,0x05000502,0x05CA0644,0x06090838,0xFD6BFF8D,0xFA11FBF7,0xF60BF85E,
-0xF501F59A,0xF4F7F40A,0xF477F498,0xF5CDF576,0xF95FF720,0xFB63FBBC,0xF89EF89B,0xF5A4F7DE,
-0xF2A0F3D4,0xF751F2EA,0xF65FF804,0xF426F4BD,0xF6E3F73A,0xF51AF533,0xF63EF5E3,0xFA6CF8B7,
-0xFDF2FB55,0x047C0095,0x080F05E8,0x0AAC0BDA,0x09220993,0x07410701,0x00C60523,0x00BDFFFA,
-0x01C20063,0x05BB02BE,0x0681075A,0x07D5075B,0x08080793,0x09390833,0x0C2B0A4E,0x0BC90CC5,
-0x0E400C50,0x0CF80EA3,0x0639092D,0x02840416,0x011E015D,0x0370019A,0x02F50363,0x01DE02C7,
-0x0357020E,0x05F405D9,0x0308032F,0x052704E4,0x006D0372,0xFEA3FD59,0xFF51001A,0xF9A7FB4E,
-0xF876F8DE,0xF9C7FA66,0xFB40F9F7,0xFCACFB55,0xFD14FE26,0xF900FBC9,0xF866F8CF,0xF768F697,
-0xF857F762,0xF9B5F9B9,0xF9D0F91F,0xFE91FC43,0xFD34FC62,0x01CBFF9D,0xFED40170,0x004EFF97,
-0xFF0B0079,0xFF71FE3A,0xFF5EFF66,0x0076FF45,0x02570230,0x02C00274,0x034C03FE,0x007500F5,
-0xFEC1FFBC,0xFED6FE99,0x00FD015E,0xFDCDFF03,0x0132FF0E,0x02FC019C,0x07700603,0x052A07AA,
-0x06CD04F3,0x09480727,0x070609A9,0x05B705CF,0x0400051C,0xFD6B01DE,0xFD78FCF0,0xF9DBFC1C,
-0xF95DFA2E,0xFB28F9D7,0xF8F8F935,0xFA8BF953,0xFC39FB83,0xFF40FDC2,0xF9BFFBE6,0xF9CFFBB1,
-0xF950FA78,0xF785F707,0xF8FFF879,0xF50EF4F6,0xF7C4F956,0xF824F689,0xFAFAFA97,0xF8C0F7BE,
-0xFDB2FE6F,0xFA89FA89,0xFD43F9A4,0x001700DF,0xFF94FED0,0xFCE8FF54,0xFD2CFC17,0xFD20FC9B,
-0xFC91FC67,0x01D2FF0E,0x0507032E,0x08D107F6,0x07F506B9,0x06880841,0x09AB0676,0x0562092E,
-0x07970466,0x0753080B,0x061A0999,0x0971056A,0x0AEE0BF0,0x04260717,0x0A1F03EF,0x09CB0C96,
-0x071808B2,0x099F086C,0x00DF0372,0x080A0335,0x07910ADD,0x01A9034A,0x024901BA,0x01E102ED,
-0xFE2D009F,0x00630045,0x013FFF61,0xFACDFE88,0xFDA5FBB0,0xF8A7FBE9,0xFB08F8E6,0xF651F903,
-0xFDB3FA3C,0xFD13FCD0,0xF86AFC92,0xF5F9F603,0xF4FCF6D3,0xF52DF464,0xF612F558,0xF8D3F80B,
-0xFA76F80C,0xFA75FC2E,0xFDB0F995,0xFAB5FFFD,0xFC80F8F6,0xF925FBFB,0x010AFD6B,0xFDDBFE39,
-0x004BFE80,0x04C802BE,0x03410345,0x077C05E8,0x058C07C4,0x027403B1,0x013001DF,0x03F9016F,
-0x073606D6,0x0C000844,0x0BE70CF8,0x0C980C1F,0x0B800D92,0x0930094B,0x0B560920,0x0C190B44,
-0x0EBA0F32,0x0A620C5B,0x07250A3F,0x04D603C9,0x06FF0730,0x067F06AE,0x02040409,0x02F80267,
-0x068704DC,0x065207FB,0x0631058F,0x05AC0595,0x023D03D2,0x019C02CE,0xFC38001A,0xF7C8F9DB,
-0xF864F7C0,0xF53EF65B,0xF23CF483,0xF081F08E,0xF15CF14F,0xF61BF25A,0xFA96F9D1,0xF973F95B,
-0xF8E8F9FE,0xF54DF63D,0xF7CCF738,0xF515F547,0xF87CF688,0xFD49FACE,0xFC170049,0x0152FA6F,
-0xFC98FD64,0xFC88FE88,0xF8FBFC77,0xF921F649,0x0097FF36,0x0239002A,0x059C03D0,0x0BD60C53,
-0x03920614,0x05A10333,0x00D602B1,0xFD96002A,0x0505FFD1,0x04B107C1,0x03BCFFA7,0x0BDA0BDA,
-0x0D450B61,0x0C180C5B,0x0C1A0CB2,0x086D09A2,0x09C00750,0x09B10A0D,0x09890AC1,0x04F008E4,
-0x006100F2,0x047B0160,0xFB4E005E,0xFE66FC6A,0x004DFF72,0xFB87FDA0,0xFF23FF40,0x03F500C0,
-0xFA04FE30,0xF47CF6B2,0xF7E8FC1B,0xECFFEA48,0xF974FA92,0xF838F7EA,0xF494F7CC,0xFAE2FBB0,
-0xF3D4F1CB,0xF991F3C7,0xF6A2F714,0xEF53F059,0xF883F84A,0xF79AF8B5,0xF724F486,0xF1ADF647,
-0xFCABF770,0xF900F697,0xFECBFF2E,0xF786F80B,0x02140006,0xFAE9FDCF,0x02FFFDA0,0x034104FD,
-0xFECEFD42,0x0419068E,0x04EAFE5C,0xFEE105C7,0x039CFD1F,0x024506D5,0x05D1025D,0x048003EE,
-0x0AAC08AB,0x0A70067B,0x0EAB134C,0x0D320A93,0x049D0A49,0x08F20805,0x01890365,0x05710467,
-0x02410461,0x07E1058A,0x054301B6,0x07610BD4,0x007E0518,0x06C302B9,0x014D037A,0xFEBC036A,
-0x026AFF54,0x01C5FFFC,0x040C047C,0xFFAFFE7C,0xFDF30527,0xF72AF65F,0xFAC9F9E6,0xFBF6FB56,
-0xFB28FD43,0xFB2CFBBA,0xFE75FB50,0xF5A4F92F,0xFC5EFC11,0xFA9EF9C3,0xF9F2F9D5,0xF585F631,
-0xF995FB66,0xF759F651,0xFA8AF8E1,0xFA73F98A,0xF76CFB57,0xFFC1FA28,0xFB06FEDD,0xFCE6FB91,
-0xFF12FDEC,0x00E700E8,0x0185FF3D,0x00D7032B,0x0399003E,0x015B02F1,0x04DA0338,0x006000A1,
-0x01500233,0x01C402D7,0x05490143,0x04620719,0x08AD05E5,0x076D0777,0x08D908D0,0x08BD091F,
-0x0A100AA8,0x0BF608B3,0x08750A52,0x0B0D0CC8,0x09420781,0x06B90A56,0x05800527,0x096707BA,
-0x04B4084D,0x021001EE,0xFE9BFFCC,0xFEC1FF74,0xFFC0FF82,0x01AD0004,0x02DC03EA,0x00590178,
-0x00ECFFF0,0xFB72000D,0xF9FCF8E4,0xF956FA70,0xF87DF6E3,0xFD13FC60,0xFDD5FD80,0xFAECFB89,
-0xFACBFBE1,0xFCF3FAA0,0xFC57FD7D,0xFE2FFC47,0xF456FB9C,0xFA5EF429,0xF5B8FB76,0xFC21F742,
-0xFA9EFB54,0xFF3CFF7C,0xFB05FA3F,0xFC20FBDE,0xFF77FCE4,0x02240150,0x07420377,0xFEAE0796,
-0x047DFDDA,0x014A06E7,0xF7EBFC52,0x05420214,0x050E0513,0x0311002C,0x05CC0686,0x037804BA,
-0x067B071C,0x026C002A,0x037E037B,0xFD920055,0xFF0FFC5F,0xFDA90442,0xFA3EF9C7,0xFB3C0146,
-0x0821FB2F,0xFDEB0560,0xFA3CF768,0xFA43FE9F,0xFC17F861,0xEFDDF4CD,0xF78AFC16,0xFCB5F809,
-0xF784FB67,0x0002F9E3,0xF8D4FB2C,0xF5ABEF52,0xFAC1FB51,0xF708F8B0,0xF987FB0B,0xFF8DF876,
-0x007305D4,0x0298FE4D,0x049806BE,0xF949FA02,0x0022FA20,0x00BF0301,0x019D015C,0xFD38FBAE,
-0xFE3BFE9D,0x014D0421,0xFC17F828,0x06690959,0x0CD90219,0x098F0BC7,0x142F1050,0xFDCE0696,
-0x0BAC07DB,0x15FD0BD2,0x114E14EA,0x0E980FD1,0x0CE10DFA,0x07B607FB,0x079C0A50,0x068404F5,
-0x00150992,0x031EFE32,0x021A03B0,0x005E0313,0x06F6FF54,0x01A704DB,0x08120638,0xFC55FFF1,
-0x087805C4,0xFC7500B0,0xFB56FB86,0xF3D5FEB7,0xF2BAEE8D,0xF3DCF4F0,0xFB42F175,0xFECAFFB4,
-0x0494019A,0xFA44FCE3,0xF572F8E4,0xF45DF899,0xEE5CEEEE,0xEEC8F006,0xF19CF01C,0xF572F49E,
-0xF785F4A6,0xF833F914,0xFACAF8BB,0xF9BAFAAA,0xFEDCFE60,0xFA28F9C9,0xFF14FD1A,0x0027FFB1,
-0x005F00D5,0xFFC8FD7B,0xFFDD02D4,0x05D502BE,0x0B490774,0x08BB0B59,0x0E8A0B9A,0x0B5B0F5B,
-0x09D10BE2,0x054E038E,0x06320820,0x050004E9,0x08D60603,0x0F330CD1,0x14861058,0x12FE13FA,
-0x0F6F11BF,0x05020BC2,0x09A404F2,0x06620908,0x074F06AB,0x030304D9,0x0A82080E,0x059A07DF,
-0x011705FE,0xFB59FC72,0xF6DEF9D6,0xFAA1F4EE,0xFD70FE6D,0xFAF6FA7A,0xFB91FB6F,0x0266FEA1,
-0xF879FEFC,0xF4D5F70A,0xF42BF452,0xF049F247,0xF830F47E,0xF8C0F769,0xF36DF6D5,0xF84FF3DE,
-0xF692F76A,0xF353F507,0xF46BF26F,0xF31BF57C,0xF728F470,0xF8ACF845,0xFE86FC35,0x010FFDD3,
-0xFF89022D,0x047701CC,0x00460244,0xFCCBFF33,0xFCDBFBAF,0xFF19FE84,0x0226FFA9,0x05930345,
-0x06B706B9,0x051505B9,0x053104A9,0x090C07C0,0x0C8F0A34,0x0D9C0D71,0x0CA30C53,0x09080C23,
-0x042F05ED,0xFEE302F1,0xFBA9FB4D,0xFC97FCBE,0x003EFE5D,0x03030264,0x062F03D1,0x01640485,
-0x025A0183,0x03CF023E,0x020202F9,0x0329031B,0xFF2E01AB,0xFEF7FF4D,0xFCF8FD4B,0xFE6EFDC8,
-0xFE97FDD8,0xFC88FE68,0xFB8EFB3F,0xFB95FB0D,0xF99BFAC9,0xFB33FA5B,0xFD8FFC22,0xFD58FDF5,
-0xFE86FD5E,0xFF6CFF1E,0x00AF0041,0xFE58FE8A,0xFE5EFF50,0xFCDEFD61,0xFC6DFC18,0xFCF0FCDF,
-0xFE11FDFE,0xFC2CFC31,0xFD05FD7C,0xFD77FC5F,0x00BAFF39,0x05280394,0x04FD042A,0x04DD04FB,
-0x02840439,0xFF0C00B4,0xFF6AFF1F,0x00830063,0x01E0019E,0x00C10085,0xFFC800A0,0xFE77FF13,
-0xFDAFFDE2,0xFD29FE24,0xFC8BFC28,0xFDE3FCB1,0x0054FEFB,0x02B60279,0xFFC500B7,0xFDD3FED8,
-0xFCE4FD24,0xFC22FD56,0xFE46FBC4,0xFFD5FF1B,0x00EE007C,0x02E7020F,0x00C7025D,0xFE97FF3D,
-0xFC64FD96,0xFDCCFD43,0xFBF9FDBF,0xFB24FABD,0xFB2AFB3F,0xFF69FCAD,0x033201A3,0x04220495,
-0x050C0431,0x03B104C8,0x014402A2,0xFFC8FFD7,0xFF31FEF2,0x0066FFD8,0x028501A3,0xFD8800DA,
-0xFD89FD16,0xFCA7FCE9,0xFECEFE1B,0x016900EE,0x01FB00DE,0x019301E2,0x03290326,0x03F70343,
-0x019802B7,0xFFD301CA,0xFEC4FEC5,0xFE65FE89,0xFE08FDB4,0xFE0EFE34,0xFDB8FDCF,0xFF74FEEE,
-0x01B9003B,0x030D01DE,0x03500400,0x0226027D,0x000700C2,0x03DA0119,0x02110325,0x049B03E3,
-0x01F902E9,0xFC95FF53,0xFC2CFC12,0xFD3DFCD9,0xFC9DFD34,0x0021FD51,0x03DD0280,0x0605045C,
-0x057E0645,0x0588056E,0x037A05EC,0x02C601E6,0x00BE024B,0xFEFB00D4,0xFB9FFBD7,0xFC5FFC5A,
-0xFA1EFBB8,0xFA0DF968,0xFBB0FAED,0xFDC0FCF0,0xFE24FE66,0xFF24FE1D,0xFF5DFEE3,0xFD93FF35,
-0xFC84FCD3,0xFA66FB29,0xFA2EF9ED,0xFB08FADB,0xFB75FB73,0xFA02FB14,0xFB41FAA2,0xFA5BFB3A,
-0xFA68FA27,0xFA82F9E0,0xFA4DFA8E,0xFDC7FBDF,0xFE5BFE9C,0x0022FF15,0xFFC20092,0xFF35FF7D,
-0xFF04FE56,0xFD6FFEF6,0xFF74FD44,0x0228013A,0x04BB03A6,0x051D046D,0x060A0611,0x04D80520,
-0x06A00506,0x06CF06A9,0x097F0887,0x091108CA,0x08E50982,0x068A0791,0x05B105F0,0x06C50614,
-0x069C06A6,0x097107F9,0x09E00900,0x0A1A0B69,0x096108B9,0x076709CD,0x045E0454,0x024203FF,
-0x00A80147,0xFF340006,0xFFDBFEE2,0x009D0013,0xFEAF00A4,0xFD1AFCE1,0xFBFBFCBB,0xFC67FB6D,
-0xFCFDFCD2,0xFD76FD81,0xFA9EFBB5,0xFC59FBE2,0xFA13FB01,0xF8F0F9B9,0xF71DF806,0xF79FF7BE,
-0xF89EF79A,0xF95CF8CA,0xFB64FAC9,0xFBF9FC04,0xFB8CFB9A,0xF9E4FAD5,0xFD37FB3B,0xFC42FD54,
-0xFCD0FC82,0xFC48FC69,0xFD90FCB1,0xFEEFFE71,0xFFF9FF1E,0x007FFFF9,0x011400CF,0x03FB0226,
-0x05180513,0x068E0598,0x0675071A,0x051605A6,0x06BE05D1,0x077D0733,0x069C077C,0x057E0696,
-0x05150501,0x041A04AD,0x033E03A2,0x014202DE,0x015F00F0,0x028501BC,0x02F402C5,0x043B035E,
-0x03EB046C,0x028C02ED,0x031B03C1,0x00BB0173,0xFECAFFB7,0xFF62FF95,0xFC7FFDD1,0xFD25FD18,
-0xFAEAFC5E,0xFBC1FB3D,0xF9E3FA57,0xFA4EFA4E,0xFAC1FA2A,0xFACFFAB3,0xFCA0FBD1,0xFDC5FD2B,
-0xFC7CFD02,0xFB5AFBE6,0xFA6AFB6A,0xFAD1F99A,0xFB6BFB18,0xFB08FB5B,0xFA92FB22,0xFC68FB73,
-0xFCF7FC0A,0xFDF7FD7A,0xFE43FEA6,0xFDE3FD84,0xFFCCFE79,0x005B004F,0xFFCE0006,0x0000FFC9,
-0x02A000C5,0x0373033C,0x03660378,0x01E502C8,0x00C7013B,0x00EF008F,0x016E019A,0x00F1011F,
-0x023F0159,0x01D50215,0x021601BD,0x02570286,0x009D00FE,0x013E0141,0x003D00B1,0x006B00C9,
-0xFEF2FF60,0xFE16FEC5,0xFD2EFD12,0xFF1EFE25,0x0178006C,0x005800B5,0xFF600063,0xFDF8FDB4,
-0xFD18FDB8,0xFD61FD3A,0xFCEDFD69,0xFDA5FD1F,0xFD57FCDE,0xFC85FCF3,0xFBBAFCF6,0xFB9EFB44,
-0xFBDBFC13,0xFCF2FC7D,0xFEE0FD93,0x018E003A,0x019601D9,0x009B011C,0x01270100,0xFECD0069,
-0xFFADFE23,0x001500A9,0xFFAEFFAE,0x00BF0077,0x01620094,0x01100190,0x033701DF,0x02C202B5,
-0x02FC02CC,0x0201026A,0x03290225,0x046A03E9,0x04D10533,0x02B60401,0x02910294,0x0121020C,
-0x017B00B0,0x024501FC,0x0324027F,0x01FC02F2,0x023201E2,0x00E8017C,0x004D007D,0xFF62FFC8,
-0x0036003B,0xFF63FF1D,0xFFC8FF39,0xFF5F0019,0x008FFF57,0xFF430096,0x0066FF63,0x00000094,
-0x01370032,0x0069008B,0x0118010C,0x00720099,0x013400F4,0x01650133,0x0040010A,0x00C0007F,
-0x00A10083,0x004A00F5,0x012E00DA,0x010700EF,0x01910121,0x026C024E,0x020E0269,0x02C301EC,
-0x025E0237,0x03F70301,0x031703BE,0x018F0229,0x00F900FD,0x014E011A,0x0357020D,0x042303C4,
-0x03EC0416,0x04B204A4,0x03C603C3,0x034803DA,0x012B0220,0x01900145,0x00BC0193,0x012A00A1,
-0xFF0D009A,0xFF6DFEDB,0xFF14FF3A,0xFCF3FDD6,0xFD2EFCA2,0xFE1CFE11,0x001BFF49,0xFE71FF32,
-0xFF3CFF08,0xFFD0FF43,0xFFD4FFFA,0xFED5FF96,0xFCAFFD92,0xFB94FBC5,0xFBB5FB95,0xFCA3FC7E,
-0xFCE7FCEA,0xFE26FD94,0x00E1FF31,0x011801BF,0x01F70182,0xFEEE005B,0xFF92FFAF,0xFE82FEED,
-0xFE81FEF0,0xFDF5FDC7,0xFE92FE76,0xFF0FFEF5,0x0099001C,0x001E000F,0x0016FFFF,0x00D80044,
-0x00A500FA,0x01CE00DD,0x028B0208,0x03BD03AA,0x03C503E3,0x021702FF,0x011E01CB,0x01420084,
-0x00D7018D,0x00BB00D6,0x009F004F,0x00E80105,0x00F30095,0x01C20213,0x013A01E2,0xFF9F0033,
-0xFF25FED9,0xFE81FFB7,0xFEA1FE13,0xFEF9FF28,0xFE70FE91,0xFFE7FF14,0xFED3FF60,0xFDBFFE69,
-0xFD68FDD4,0xFD70FD47,0xFC8BFCEF,0xFE55FD8C,0xFF1EFEDE,0xFF06FEE8,0xFEC1FEFF,0xFCE5FE33,
-0xFCABFC3C,0xFCF5FD46,0xFC04FC28,0xFC1BFC91,0xFDFEFD15,0xFE25FDCD,0xFEB2FEE2,0xFD20FE09,
-0xFD88FCB6,0xFEB0FE8C,0xFE1AFE1C,0xFF28FEFD,0xFFA0FF62,0xFEE7FFA2,0x007BFF4D,0x010600DF,
-0x01C7015E,0x022501A9,0x029A02DB,0x0296028A,0x010201E1,0xFF44006D,0xFE19FE3E,0xFE11FDE4,
-0xFFA5FEE5,0x00AFFFE3,0x02AA0183,0x024B02C0,0x03BB0332,0x01C702EF,0x01B801F9,0x01D601B6,
-0x00E40119,0x008F00E4,0xFFA20024,0xFEC8FFAB,0xFFA0FF0C,0xFF49FF43,0xFF22FF69,0xFF65FF6D,
-0xFF71FF5F,0xFF6BFFDF,0xFEE4FF26,0xFD37FE23,0xFDECFD4B,0xFE95FEA9,0xFE6EFE0E,0xFF25FECB,
-0xFF4EFEE4,0x00540047,0xFF920022,0xFF14FF8A,0xFE45FE9B,0xFE90FE6D,0xFEC9FEBB,0xFE96FE70,
-0xFE7BFE89,0xFF6DFF8F,0xFEAFFEE1,0xFF2FFEDA,0xFDDAFE31,0xFE48FE5F,0x0053FF3C,0x00ED0089,
-0x012900F6,0x02E80204,0x03310353,0x02630299,0x00DE0190,0xFFCF0091,0x01510061,0x028001A3,
-0x031702F6,0x03ED039C,0x0292030D,0x01AA0204,0x0206020E,0x02BC0275,0x032D026D,0x0470047C,
-0x041A0445,0x044B0432,0x03D203D0,0x033303C5,0x023D0220,0x00C1018D,0x013A0138,0x00D700C4,
-0x01B10147,0x00F3015A,0x01790151,0x01D90185,0x0102019F,0x00550015,0xFF5B002C,0xFFD1FF60,
-0xFFE50054,0xFF31FF34,0xFF37FF8A,0xFF63FF4C,0x000EFF9B,0xFFCBFFB9,0xFFF60013,0x001FFFD8,
-0xFEEAFF8B,0xFDDBFE96,0xFDCCFE11,0xFD5CFD5A,0xFCDFFCB1,0xFDFCFDA2,0xFF12FE81,0xFE4FFE41,
-0xFFA1FED1,0xFEC0FF88,0xFFD8FF36,0xFF91FFC2,0xFF4DFFE8,0xFE6FFEAD,0xFECFFECE,0xFED5FEEC,
-0xFFD9FF39,0xFF8E000D,0xFF66FF73,0x008CFFD0,0x0124018A,0x003A0065,0xFF78FFBE,0xFF8BFF4D,
-0x00860045,0x00C40079,0xFF30003D,0xFED5FEC1,0xFF7BFF9F,0x005DFF9C,0x00F500A1,0x010600AB,
-0x01BB01B2,0x01D20198,0x01FB01DA,0x00FF01D1,0x010D016C,0xFFB2005E,0xFF04FF36,0xFDCCFE8D,
-0xFE41FDF4,0xFE79FF1A,0xFE86FDFF,0xFF5CFF43,0xFF75FF81,0xFE5BFF06,0xFE4FFE9F,0xFD5AFD22,
-0xFECFFE14,0xFE42FEEA,0xFE25FDDF,0xFEB9FE7C,0xFF05FE9E,0xFEDCFF18,0xFD81FEAB,0xFCEEFD1C,
-0xFE10FD18,0xFEEDFEDE,0xFE6FFECB,0xFE56FE2D,0xFF16FEDF,0xFFC1FF85,0x0076FFF8,0xFF9F00A1,
-0xFF32FF0D,0xFEE7FEF8,0xFF0AFF54,0xFEE6FEA3,0xFFD3FFFA,0xFFBAFF1F,0x00AF008A,0x00F00104,
-0x012200FA,0x012A0131,0x014B0136,0x00DE01B8,0x00E10087,0x02820211,0x01950247,0x026301D2,
-0x025B02C8,0x01C40214,0x00000211,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-};
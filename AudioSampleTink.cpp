@@ -1,367 +0,0 @@
-// Audio data converted from WAV file by wav2sketch
-
-#include "AudioSampleTink.h"
-
-// Converted from tink.wav, using 44100 Hz, 16 bit PCM encoding
-const unsigned int AudioSampleTink[2881] = {
-0x81001677,0x09B2129B,0xF0A4FA64,0xF8FFF2DC,0xFC27FB85,0x01CCFDD5,0xFBB00042,0xFF12FAA9,
-0x03A30376,0xFC48FDF2,0x00B2FF23,0xFA75FF10,0xF847F6D5,0xFC17F9C4,0x06530099,0x0BE60B14,
-0xFFB106EC,0xFC45FBA8,0xFD43FCF6,0x02A1FF81,0x045004D3,0xFE9200E7,0x02ED002E,0x0356042A,
-0x02FD031D,0x02600352,0x0094006C,0x03D90256,0x01980437,0xFE86FEA5,0x018DFFC6,0x00910112,
-0x01670251,0x01D6FE9F,0x07BE06DE,0x01F0058E,0x055501EF,0xFDCE0304,0xFFA5FE1E,0xFDA8FF3F,
-0x0220FE8F,0x01CC045B,0x0068FF1C,0xFE91FFF2,0xFD80FE16,0xFDCCFF62,0xFDE3FC2A,0xFF5DFF8C,
-0xFEBDFF8C,0xFE97FD56,0xFD4EFE78,0xFC7BFC6C,0xFE6DFDEE,0x0220FFEC,0x000BFEE1,0x01B701D3,
-0x047505B3,0x0A340074,0x45C533B1,0xBB130BC8,0xF832A878,0x1D7F36CE,0xEEFDF7E1,0x0B5CF0F3,
-0x01F60B82,0x45AE1D85,0xB05915E5,0x18EDAA46,0x1DFB4379,0xE30A0AE2,0xF27FA7F4,0x44896D06,
-0x8176A5A7,0x5CA700B0,0x06D434B9,0xECD6ED2F,0x220F11A6,0xE4780826,0x09B2D73B,0x13A9368B,
-0xDD41D66E,0x243B1CE4,0xC0E6DE90,0x3CC6001D,0xFF5D32B4,0x106DED3F,0x11EC30C4,0xB2AAD982,
-0x0254C354,0x11BC27F0,0xFA20F648,0x1E0614DA,0xCB85004F,0xE839BD14,0x1B98101D,0xE90A0E3F,
-0xF717DC82,0xF9280783,0xCD17E0AE,0x2C64E795,0x0A7B45ED,0xEEADD426,0x10DA14F6,0xFAA80BBF,
-0xE8B7DE5C,0x1D4B0D41,0xF4350E8C,0xEF5AE935,0x09F1FE9F,0x04EB01FB,0x2789236D,0xD355F981,
-0x22E2EF2D,0xE21C1D4D,0xE751C212,0x50B22E3A,0xE5DD2D2D,0x19F6D805,0x0B074017,0xC150C895,
-0x09C8E150,0xFCB91D4E,0x00FADBD8,0x26E932DC,0xF5C402F4,0xFD8AF7B9,0x0C4512B6,0xBF7AD386,
-0x190EF255,0xE84C0513,0x0692EDF0,0x17FE19E7,0xDB80F64D,0x0C8DEEAB,0x0BC713D8,0xF03BFDC9,
-0x080DF984,0xE8CDFBFF,0xF496E73C,0xF02FF2BA,0x174E06E5,0xF96F052E,0xFF900659,0xDC70E4FA,
-0xF83AEA36,0xFAF3FACA,0xFADDFCE3,0x02DC0317,0xE3E5EECF,0x0634EE9A,0x20A1127F,0xF03B17C0,
-0xE51AD00B,0xF2EE016D,0xF9AFE953,0x14041014,0x1A991B69,0x0482069E,0xEB1BFD36,0x1DE1FCD1,
-0xFC9519E8,0x196B0627,0x1E581BEB,0xE8550CAA,0xFC81D80E,0x127D0A86,0x1F7924D9,0x052A0A41,
-0x081B0B70,0xE137FAF9,0x0F59E58F,0x0E8E2009,0x05CE01B6,0x0C9E0167,0xED05035B,0x0E48F801,
-0x0A851175,0xF64204D4,0x0612F302,0xEEF40731,0x0107EDCD,0x1BBF1755,0x01611178,0x0593FAA6,
-0xF9EB0719,0xFAF7E896,0xF9880856,0xF981F1A6,0x1D0B0D53,0xF3C413C9,0xE9CCE153,0x12FA035E,
-0x00EA0F45,0x0DE6F88E,0xF9AB1225,0xDFE4E320,0x01FEEAC2,0x09980D1F,0xF5DDFEC7,0x010AF435,
-0xFD900436,0x0A84FD75,0xF2F90596,0xE944E096,0xFF6CFE0C,0xF839F57D,0x0712FEF0,0x094209E8,
-0x01210460,0x08BC03CB,0xE939F488,0xF043E70F,0x0017FC38,0x04510199,0x00F902E9,0xF5C5FDF8,
-0xFC1EF526,0x01FF0519,0xF827F6E9,0x0249FD6C,0xED15FA4D,0x0DB8F3E7,0xFB190E95,0xFB8BF759,
-0xFBB1FF3A,0xFEE9FBFE,0x0BEC085A,0x0F8C0E2C,0x042C0E1D,0xF415F5B6,0x01ACFB33,0x0B6003DA,
-0x1061111A,0x09DC0CA5,0xFD540614,0xFF5BFC34,0x02180030,0x031B040A,0x0C5A04B2,0x093D0CD1,
-0x036B05F4,0x021204D5,0xFBD1FBF5,0x1191056E,0xFBDB0B33,0xF7A5F9D0,0x092EFBD7,0x0E400B3F,
-0x146F133D,0xFCBC088F,0xF170F62B,0xFDDBF549,0x0119FA38,0x0AB0132F,0xF7CCFE96,0xFC1DF55A,
-0x01EE0155,0xFD630317,0x02ADF674,0x02B31107,0xEF37EF61,0xED1BF1E8,0xF2D8F06B,0x0A2FFD44,
-0xF97103A4,0x01AEFEB0,0xF1EFF94A,0xFF3EF482,0x04EF07FA,0xF0ECFB64,0xFEBCF3E9,0xFD290430,
-0xF9C7F4CD,0x00910218,0x032E0565,0xFDE3FD74,0xED30FAA1,0x0175ECF3,0x10F30FA2,0x00CC0999,
-0x108C05AB,0x071612BF,0xE3E4EE5C,0x1075FB4E,0x02D90970,0xFE8D0289,0x05DC000A,0xF9480053,
-0xFF82F802,0x07DA0988,0x08B005CB,0x059D0814,0x02A80492,0x03070267,0x0BC60509,0x09260F9E,
-0xF952FD4A,0x0078FFBC,0xFD8FFC32,0x0BA1085A,0x044205F0,0xF94100E5,0xFE66F92D,0xFD15FF0F,
-0x0452FFF4,0x01E105A3,0xF9DAFD68,0xFC44FCD3,0xF657F8F6,0xF8C8F3EB,0x049B02DD,0xFDF40107,
-0x04C70250,0xFD4D0247,0x03EEFE2B,0x01B607A3,0x05090250,0xF5D8FF0E,0x0405F943,0x0A060CEB,
-0xFFBD03AF,0xF8A9FA58,0x022AFF75,0xF8F7FD7A,0x053DFEAF,0x07B705A0,0xFF6306B9,0x07940324,
-0x019B03E7,0x00330095,0x09D904C0,0x02E9096E,0x06510204,0xFBEA0378,0x0760FD4D,0xFE5807F8,
-0x01A0FCDA,0x0246012C,0x030B04D3,0x022601E4,0x030B027A,0xFFEF0396,0xF795F947,0xFE57FBB4,
-0xFF3DFEB4,0x057F016D,0x034306AA,0xF6CEFCA7,0xFBF2F830,0xFC91FB41,0x06430311,0x03F90486,
-0x00150520,0xF90FF939,0x02C5FEE8,0xFC580104,0x07170035,0x00FF06B1,0xF8F5FBA7,0xFEBDFA32,
-0x038703C7,0xFA9AFD21,0xFD93FDCB,0xFA29FA96,0x0481FFEB,0x07AB0545,0x0AD60B0F,0xFE340628,
-0xF941FA97,0xFF4DF94B,0x077B0732,0x062803C9,0x0A400C9B,0xFC8500F1,0xFFF6FDF8,0xFBB9FDD8,
-0x07B4026E,0x03BF0574,0x02170307,0xFBC00002,0xFBEBF9E2,0x01A6FE2B,0x03C805D9,0xF6C7FAE6,
-0xFC19FBC3,0xF781F79F,0x004FFB34,0xFB2C006A,0xF5EFF739,0xFA82F7B5,0xFC66FBD1,0xF9CBFAEC,
-0xFC9DFC31,0xF82AF9CB,0xF7A9F8E0,0xF476F507,0xFC01F84D,0x0055FDA5,0xFEE50145,0xFA24FBB2,
-0xF91BF9CB,0xFAC2F8FB,0x002CFD7E,0x01670181,0x008B0172,0xFF1DFEB7,0x000D0052,0xFD07FDE0,
-0xFC56FD4A,0xFDA6FAE1,0x010000DB,0x0117FFF4,0x02980175,0x061C0587,0x02220469,0x02B400BC,
-0x049F046B,0x06A20575,0x0701074B,0x03A9055E,0x04E0033A,0x05040643,0x08E905C3,0x069208D1,
-0xFFB902C4,0x0881026A,0x09540C06,0xFFF4026A,0x057B02AA,0x026B0635,0xFFA3FED6,0x04E50273,
-0x006204A9,0x01B2FF7F,0x01B30302,0xFFC6FF4B,0x03FB0186,0x051505D5,0x032404D7,0xFF430058,
-0xFCC6FEDB,0xFC8DFC62,0x0303FF0D,0x01510324,0xFC78FE62,0x0061FE85,0xFC43FEB6,0xFFA1FC8A,
-0x00F201C8,0xFB56FE28,0xFE69FBC6,0xFE76FEF1,0xFE29FD2A,0x03780186,0xFD180150,0xFAC4F9AB,
-0x001CFE49,0x0184003D,0x04100431,0xFDA40112,0xFD02FBD5,0x0130FFDD,0xFC4BFEA2,0x01E5FEB9,
-0xFEA60104,0xFB5CFCE7,0xFBF9FB4B,0xFB6EFBF6,0xFE52FC62,0xFF210080,0xF869FB8B,0xFDA8F9BA,
-0xFEECFF24,0x0022FEE3,0x016A0165,0xFF75012F,0xFA3CFB17,0x02C4FEA8,0x01B502D3,0x03150286,
-0x007301CE,0x001AFFD5,0x000B004A,0xFF990038,0x01DAFF4F,0x06560588,0xFCFF0247,0x02AFFCDD,
-0x06CE066B,0x0483059C,0x0474045D,0x00C402FF,0xFF12FED9,0x019900D2,0xFF9D0112,0x0264FFF6,
-0x021702E5,0x04300316,0x011E03BF,0xFE04FED7,0xFFC2FE61,0x025401B6,0xFE990093,0x016BFFEA,
-0xFE69FFEE,0xFEA3FED4,0xF81CFC75,0xFC9EF821,0xFF740023,0xFBE0FD2D,0xFD39FBFC,0xFCE3FDDF,
-0xFA05FB40,0xFCBDFA1B,0xFA3CFDEC,0xF59BF5CF,0xFCB1F97B,0xFBBCFD09,0xF75AF95F,0xF852F75A,
-0xFD84FA50,0xFEE5FF12,0xFB9BFCEF,0x0162FE91,0xFF53008B,0xFF1DFEFF,0x0133FFDC,0x00550232,
-0xFCF9FC87,0x0413010A,0xFDD7028D,0xFD62FBE2,0x028DFFD8,0xFF830240,0x0055FE18,0x04EF042B,
-0x01CB02AF,0x055A040E,0x00EB0333,0xFED40024,0xFFFFFE11,0xFF3900F0,0x01A5FEC7,0x0253046A,
-0xFDCEFE84,0x046D01A0,0xFB1A00D6,0xFFECFB9D,0x01DA032A,0xFB6CFE0A,0xFD49FB80,0xFE3BFE8C,
-0xFCE8FD17,0xFB95FD26,0xF6E0F7F9,0xFE4FFA7A,0xFDF7FF79,0xF815FA10,0xFBF8F949,0xFD7BFE2A,
-0xFDE8FBA8,0x02F9022F,0xFCCDFFDF,0x0019FD74,0x00B0015C,0xFCD9FF0B,0xFB4EFB49,0xFF0DFD4E,
-0x013BFFB4,0x000601BE,0xFD4BFDC7,0x01DFFF61,0xFD7700B4,0x0059FD4F,0x04330398,0x00E90203,
-0x04660264,0x03D1052A,0xFE2A0046,0x0377000C,0x03B904B4,0x01A40212,0x0392027A,0x01EF02E9,
-0x057302E6,0x041506A6,0x0083FFC5,0x04CE04A0,0xFF6A013B,0xFF7BFF8A,0xFE3DFE0D,0x0032FFE8,
-0x0118000A,0xFD8B0101,0xFE21FB2E,0x02F20258,0xFFB701B8,0xFF9BFEDC,0xFE6AFED0,0x00E60053,
-0x00CCFFF9,0x00260184,0xFE97FE47,0x02BD017A,0xFD04FFF9,0xFEDEFD50,0x024900C9,0x013B0280,
-0x02BD0122,0x02D2033D,0x03130305,0x04B402E1,0x04DC0576,0x04EF04AB,0x0318042E,0x038E031B,
-0x015B027B,0x01A900EB,0x04EE03AE,0x035C03EC,0x030D0365,0x051503C9,0x05E305C4,0x04DB0531,
-0x05FB0592,0x00060358,0x042F00B0,0x018E0445,0x0093FFB1,0x01870279,0x00ACFF74,0x03440336,
-0x009601B6,0xFE93FFE0,0xFF36FE17,0x02E4014E,0xFF9901FE,0xFBBFFCEB,0x000BFD5D,0xFD23FF5B,
-0xFDCAFD76,0xFA42FBBA,0xFC75FB33,0xFBDBFC3E,0xFC20FBA1,0xFC9FFCEA,0xFEAEFC86,0xFFA70032,
-0xFDC7FE58,0xFB52FCAF,0xFE52FC21,0xFD44FF05,0xFE37FC5B,0xFD9CFF3A,0xFECEFD73,0xFF34FF3D,
-0x009BFFDB,0xFE59FFA6,0x00B8FEE8,0xFF360143,0xFF5DFE10,0x037E01A9,0x029B03A7,0x020F0260,
-0x02AD01E2,0xFF8901D9,0x0279FFCA,0x053204AC,0x03CA045D,0x0355033C,0x06330482,0x0461062B,
-0x02CE0321,0x04650336,0x00720357,0x0227005F,0x00980265,0xFE3EFF68,0xFF40FD92,0xFE23001C,
-0xFE53FD7C,0xFF0FFEFE,0xFD57FE6D,0xFF13FDD1,0xFEA4FFD4,0xFB5EFC66,0xFECDFCF4,0xFB82FE65,
-0xFBBCF9F0,0xFFFEFF72,0xFBF5FD19,0xFCF6FCD8,0xF8D3FB92,0xF9DCF835,0xFC42FB44,0xFB33FC41,
-0xFD2AFC10,0xFC0BFCF9,0xF99BFA6B,0xFEB1FBEE,0xFBE4FEA7,0xFF91FBA5,0x00700262,0xFB63FC56,
-0x02FAFF5B,0xFFF30287,0x0310FFFB,0x043C0504,0x014E02A2,0x04F1022A,0x05800692,0x061004A0,
-0x056506E9,0x02720326,0x063D040A,0x05C806E9,0x03D10403,0x06CD05AF,0x03C505DA,0x03340283,
-0x0409045D,0x041B0339,0x0384050E,0x00460100,0x02720169,0x018B028F,0xFF3F0042,0xFF24FF16,
-0xFD55FE8E,0xFBFEFC54,0x005FFDD9,0xFC34FE88,0xFDCEFD5D,0xFBCBFC61,0xFD15FD01,0xF925FAE4,
-0xF978F8C0,0xFD5DFBA7,0xF865FBA6,0xF9F0F773,0xFCCEFC50,0xF9A6FB97,0xFAB8F910,0xFCD8FC9B,
-0xFA9EFBC9,0xFB94FA33,0xFE59FDBA,0xFCF8FD51,0xFFE1FE2D,0xFF4A009D,0xFEAFFE22,0xFFA5FFC3,
-0xFEADFE1C,0x0466022E,0x03050401,0x03F202EC,0x04EC04C2,0x049E04D4,0x05AA04DD,0x06E3066B,
-0x05B106B6,0x0587052B,0x051305CA,0x060704E5,0x042E0617,0x03F2031E,0x07160599,0x057D0715,
-0x045103DA,0x05FE05F7,0x036904BD,0x059503C1,0x036805C1,0x02A801DA,0x027B0382,0x003500DA,
-0x01DA00DE,0x004801D7,0xFC3DFDFA,0xFED6FC7F,0xFDC5FFCC,0xFD7EFCAF,0xFD12FDF3,0xFCA7FC92,
-0xFAA0FBF9,0xFBFBFA6E,0xFC26FD28,0xFA4AFA54,0xFAD3FB2D,0xF8CDF946,0xFB93F9CC,0xFBEDFC9C,
-0xFDB3FC04,0xFF6DFF1E,0xFC7AFE53,0xFCE9FBD6,0xFD66FD43,0xFE97FE02,0xFE2BFE71,0xFE01FE12,
-0xFDBCFDA4,0xFDFFFDFE,0xFF51FE67,0xFFC5000F,0xFFE1FF26,0x017700EF,0x01FD01FC,0x00E30131,
-0x02CC022B,0x01C602A0,0x01CB012B,0x01150255,0x02B200EC,0x03D3043C,0xFF180126,0x03270068,
-0x021703BF,0x002900D0,0x02C50129,0x02950379,0xFF0900A1,0x008DFF77,0xFE96FFF2,0xFE13FD95,
-0x009BFFB4,0x00670047,0xFD00FFBA,0xFE1CFC24,0xFE45FEF7,0xFE2EFE0C,0xFE9EFD9C,0x00FD00DC,
-0xFD6DFEA8,0xFEACFDF3,0xFEACFEE3,0xFF2AFF2E,0xFC07FD78,0xFE6BFCFB,0xFBD5FD79,0xFE3AFC35,
-0xFE78FEF6,0xFF0CFE2C,0xFF4AFFDC,0xFF2BFED8,0x013D000E,0x01FA0295,0xFD4FFEDF,0x0204FF53,
-0xFFA201C9,0xFF6CFE62,0x02670147,0x01340242,0x023E00DF,0x01410311,0xFF89FF4B,0x038E01D0,
-0x01F602FB,0x04DB02FE,0x008B0378,0x0129FFC3,0x03970303,0x01410292,0x015100CD,0x01F4020D,
-0xFED80077,0x0140FF1E,0x022C02A3,0xFF77005D,0x010B0062,0x004C00B4,0xFF53FFFE,0xFF11FEA5,
-0xFE98FF8E,0xFDE4FD84,0xFF0AFE7C,0xFE39FF09,0xFE87FDA5,0x007F005C,0xFDD1FE90,0x00D8FF66,
-0xFED9009B,0xFDD2FDA4,0xFFCCFEFD,0xFE6FFF55,0xFEEDFE9C,0xFEC5FF2A,0xFD0CFDB5,0xFE52FD8B,
-0xFDEEFE60,0xFF65FE68,0xFED6FF80,0xFF94FEBB,0x00A20091,0xFE4AFFAD,0x00A6FE4E,0x028002C7,
-0xFFEB00AF,0x00CC008D,0xFEEFFFE4,0x00DAFF3C,0x02A0025D,0x00E40210,0xFFB4FFE3,0x0189006B,
-0x007C015A,0x025D014F,0x021D026E,0x02E40219,0x015D02F3,0xFF41FF72,0x02AC0106,0x010C023B,
-0x00500066,0x00C4008F,0xFFE20080,0x00D8FF96,0x02630280,0x00850162,0x00F90058,0x0172019B,
-0x0002008F,0x002B003F,0xFF89FFB7,0xFEACFF24,0xFF2AFE97,0xFF3FFF90,0x00CFFFE2,0xFE7C0011,
-0x0134FF2C,0xFEBA014D,0xFDD2FCA3,0x00630008,0x0013000C,0xFFE1FFF5,0xFEDDFF8E,0xFDD8FE24,
-0x0053FEDC,0xFEED009E,0xFEA1FD95,0x01B30100,0x004B00F6,0x00990028,0x00A100F9,0x00660090,
-0x00840020,0xFFD800F6,0xFF55FEA4,0x020E0182,0xFF5E006E,0x00C60029,0x00F100C1,0x01BC013F,
-0x0266021B,0x02D9031B,0x016F01E4,0x033A028E,0x012B0246,0x02600157,0x02B10308,0x00720167,
-0x01740070,0x0114022F,0xFE64FF0B,0x02FF0069,0x02010381,0x018E0121,0x011E01F0,0x015C0092,
-0x00EF0180,0x001E0085,0xFEF9FFA0,0x00BFFF39,0xFFA90100,0xFEF3FEC3,0xFEC6FF50,0xFDEDFDC7,
-0xFEA3FEE9,0xFD5EFD6B,0xFF55FE94,0xFEA0FF0E,0xFD1EFDE3,0xFE79FD84,0xFC07FDBC,0xFD7CFC01,
-0xFD6EFE5C,0xFC87FC2E,0xFE0EFDDC,0xFD20FD51,0xFD85FD94,0xFD46FD0E,0xFD79FDAD,0xFF97FDE4,
-0xFFA60111,0xFD2DFD1C,0xFFE5FF4A,0xFD6DFE63,0x000BFE5D,0xFFE50072,0xFFA6FF70,0x013C004B,
-0x008A0173,0xFEB1FEEE,0x02820050,0x010602DE,0x019D0025,0x026002FC,0xFFEA0082,0x03A901E1,
-0x00BC02CA,0x00C2FFC8,0x029A0255,0xFFF20125,0x024C00A8,0x026F031F,0x010D0140,0x03A90280,
-0x01CA0308,0x011A0126,0x00E00114,0x01950141,0xFFC900C8,0xFEF0FF79,0x005EFEFD,0x00E0017C,
-0x0028000D,0x0121010C,0xFD91FF51,0xFF7AFE3F,0xFF46FF95,0xFE21FEFA,0xFE33FDA9,0xFEDDFEE4,
-0xFD5EFE24,0xFDB7FD5C,0xFD89FD64,0xFE79FE3C,0xFD45FDB6,0xFEB4FD96,0xFF57FF6B,0xFF2DFF16,
-0xFFDEFF5B,0xFFA4FFFD,0xFFEBFF7F,0x0032004C,0xFF29FF99,0xFF3AFF1B,0xFEF4FEFB,0x00B2FFFD,
-0xFF830031,0x012E0017,0x011C019A,0x00820087,0x0048007D,0x01A500C5,0x018B01DB,0x0135011A,
-0x02D7023F,0x017E0211,0x028401EC,0x01D7027F,0x01460135,0x01E80193,0x03210269,0x02570306,
-0x006C014B,0x01250071,0x0171018D,0x008F0101,0x00730062,0xFFB10050,0xFE95FEF8,0xFE4DFE67,
-0xFF47FE93,0xFF60FFC9,0xFE6EFE97,0xFF32FE9E,0xFE81FF6F,0xFD93FD73,0xFF9BFEAA,0xFCF5FF19,
-0xFC64FB7F,0xFEC4FE2F,0xFC55FD7B,0xFDB5FCB7,0xFDCEFE25,0xFDD4FD70,0xFE37FE79,0xFC9FFD0F,
-0x0042FE24,0x0031012A,0xFE0EFE79,0x0004FF2B,0xFDC2FF37,0x000AFDE7,0x00E20199,0xFE7FFF0D,
-0x00BCFF92,0xFFC800B3,0x009AFF5D,0x0311026E,0x0178026A,0x020C013B,0x01B302A7,0x0207010A,
-0x032B0317,0x01F3028A,0x022901F3,0x028B0274,0x014D01D6,0x035D0212,0x028C039D,0x0146012C,
-0x02BF026E,0x029F028D,0x02BE0300,0x00F301C9,0x017200E9,0x01CD01F7,0xFF9B00C7,0xFFB3FF1A,
-0x0073008E,0xFF53FFB9,0xFF84FF73,0xFE4DFEE4,0xFF34FEA9,0xFF37FF2B,0xFF49FF7D,0xFEA1FEBA,
-0xFF08FEFE,0xFE3AFEA3,0xFCD6FD83,0xFD85FCC1,0xFE3EFE38,0xFD88FDCF,0xFD59FD3A,0xFDA4FDB5,
-0xFDA2FD56,0xFED0FE3F,0xFF2DFF67,0xFDA6FE45,0xFE36FDD2,0xFE37FE44,0xFE8EFE8B,0xFE20FE67,
-0xFE51FDEB,0xFF4BFF1B,0xFF05FEFD,0xFFA9FF9A,0xFF96FF44,0xFF7F0006,0xFFF2FF69,0xFFF20028,
-0x00B20033,0x009500F0,0xFF73FFDD,0x001CFFBD,0xFF3BFFB7,0x0059FF7F,0x009300CA,0x007E0078,
-0xFF21FF98,0x00F9FFEC,0x00E40103,0x01930156,0x006300F6,0x00EC006D,0xFFB400EF,0xFF61FEDF,
-0xFFC8000E,0xFEB3FF18,0xFEDBFECD,0xFE53FE92,0xFEC9FE7E,0xFFAFFF1F,0xFE8DFF84,0xFE26FDC1,
-0xFFEBFF66,0xFEA0FF37,0xFF28FE9B,0xFF34FF86,0xFE20FE73,0xFEC2FE25,0xFFDCFFA4,0xFF5EFF82,
-0x000CFFA7,0xFF7CFFD3,0x0046FFC7,0x00660086,0x003D005E,0x0076001F,0x00E100F3,0x005D0060,
-0x009B00B7,0xFF63FFEA,0x006DFF95,0x0164013B,0x0105011B,0x00FE010B,0x0201012A,0x01C60224,
-0x01A501A1,0x018D015D,0x02F00263,0x013D0248,0x02560145,0x026D032C,0x000A00C2,0x01BD00CF,
-0x018F01F7,0x0110014F,0x010100A3,0x00C50164,0x015C0091,0x015E0215,0xFFE5001F,0x014E00E4,
-0xFEA1FFF7,0x006AFF0B,0xFFD200A8,0xFF38FF3E,0xFF7AFF48,0xFEA1FF5C,0xFEEEFDFE,0x010E00CB,
-0xFEA2FFBD,0xFF4EFEAD,0xFF69FFD4,0xFE3EFE88,0xFF42FECC,0xFEA8FF0F,0xFEADFE4B,0xFFF6FFC9,
-0xFE2EFEE8,0xFF71FE93,0xFF8DFFC4,0x006EFFCE,0x0034008C,0xFF9DFFCD,0x007BFFE1,0xFFDA0061,
-0x0010FFD2,0x008D0036,0xFFEC008C,0xFF8AFF49,0x0067004D,0x000F001F,0x018C00B7,0x00180119,
-0x0087FFAF,0x023801E3,0x00FB015C,0x01A10129,0x015B01E4,0x00070054,0x01330086,0x00F9017D,
-0xFF5CFFEC,0x01060021,0x004C0117,0xFF7AFF7A,0xFFD8FFC0,0x0062000C,0xFFE20076,0xFF00FF47,
-0xFFE3FF6F,0xFFC0002D,0xFEE8FF30,0xFF22FEBE,0xFF43FF5C,0xFF72FF4A,0xFFBEFF99,0xFF9EFFE5,
-0xFEC4FF0A,0xFFF2FF49,0xFF77FFD4,0xFFCEFFAA,0xFEE1FF6F,0xFF69FECC,0xFF29FFB9,0xFE9AFE6B,
-0xFF6FFF23,0xFFBFFF9D,0x001CFFF4,0xFF9EFFD5,0x000EFFDB,0x0022FFFB,0x012F00BD,0x005600EB,
-0x00390002,0x00720085,0x00A4006B,0x002C0092,0x007E0014,0x00F5011E,0xFFDF0063,0x00D7FFFA,
-0x01AE01A4,0x0125015F,0x02000163,0x00FA01EF,0x009E002E,0x01810171,0x00C30103,0x00C800BC,
-0x007300AA,0x0098006B,0x009000C0,0x0001002A,0x0120006D,0x00A5015B,0xFFDDFFF6,0x005F0041,
-0xFF08FFAD,0xFFBFFF46,0xFFA4FFD3,0xFEABFF26,0xFE56FE38,0xFEFDFEF2,0xFE95FE8F,0xFEF1FEEA,
-0xFE83FE89,0xFFADFF2A,0xFFA1FFDC,0xFF39FF3D,0xFF24FF4C,0xFF6DFF24,0xFFA3FFB1,0xFF47FF5C,
-0xFF2EFF4A,0xFEDAFF02,0xFFA0FF1E,0xFF7EFFDB,0xFEC6FEE2,0xFFD6FF53,0xFFE7FFEF,0x00A00047,
-0x0046008E,0x00770054,0x002A0062,0x000E001C,0x003C0020,0x004A0032,0x013200C4,0x019D017B,
-0x012B0165,0x01450114,0x01A70183,0x018B018A,0x020701E8,0x015901B3,0x01520162,0x01240138,
-0x011F011F,0x0118011F,0x00D200F8,0x008000C4,0x009B004A,0x00E000F7,0x009E0089,0x00CF00DF,
-0x00490065,0x0076007C,0x00480055,0x00490074,0xFF75FFCE,0xFEFEFF26,0xFF90FF17,0x00430007,
-0xFFF20033,0xFFB2FFAF,0xFF46FF83,0xFF74FF44,0x0017FFB1,0xFF9B0022,0xFFDDFF63,0xFF8A0022,
-0xFF27FEEE,0xFFB0FF99,0xFEBFFF47,0xFF68FEC9,0xFFE8FFFE,0xFF38FF6A,0xFFE6FF79,0x00C60077,
-0xFFBF0050,0x007DFFDF,0xFFD90075,0x00CFFFED,0x00CE014F,0xFF6EFFD3,0x00D70001,0x006200D4,
-0x00DD005E,0x0164014B,0x01360143,0x00BB0103,0x01C9011E,0x00DC01BA,0x004A0054,0x00D50087,
-0x01000111,0x007B00E3,0xFF91FFD4,0xFF8BFF95,0xFFB4FFA1,0xFF94FFAA,0x0042FFC5,0x00410083,
-0xFFADFFE0,0x0004FFAA,0x000B002E,0xFF19FF64,0x00B7FFE1,0xFED50029,0xFF16FE43,0xFF7FFFFC,
-0xFE83FE71,0xFFD9FF6D,0xFE4FFF1E,0xFF3AFE7F,0xFF3BFF8D,0xFE98FEC4,0xFF89FEE6,0xFEADFF84,
-0xFE55FE06,0xFF33FEFF,0xFE07FEAA,0xFEBBFE10,0xFF61FF70,0xFEBBFED1,0xFF95FF3F,0xFF32FF5C,
-0x0052FF8C,0x003300AB,0xFFB5FF4F,0x00DC00E0,0xFF57FFF3,0xFFC9FF73,0x00570038,0xFF7F0002,
-0x002FFFA0,0x00820086,0x00970089,0x00690087,0x01230090,0x021601D0,0x00E00184,0x013C00CE,
-0x0133017E,0x00210098,0x0121005A,0x01510186,0x006600B1,0x007C005C,0x005E009F,0x0050001B,
-0x0067009A,0x0048002D,0x00CF008F,0x000E0089,0xFF72FFA6,0x000DFFAA,0xFFE8002A,0xFF2FFF6B,
-0xFF66FF49,0xFF1BFF5C,0xFF48FF08,0xFF47FF83,0xFEF9FEDF,0xFF7EFF65,0xFFB1FF6F,0xFFDD0006,
-0xFE9DFF1D,0xFF2AFEC6,0xFF7DFF72,0xFEB4FF2A,0xFEDAFEA3,0xFF78FF46,0xFFD5FFAB,0xFFC8FFEE,
-0xFF44FF65,0xFF97FF89,0x0067FFD4,0x003D0095,0xFFBEFFB7,0x00710033,0x008F007C,0xFFAC0044,
-0xFF73FF3A,0x009A000D,0x00DC00D7,0x00E600DE,0x007E00E0,0x0075003B,0x01740114,0x0140014E,
-0x01600158,0x012B0134,0x0160014B,0x009300FF,0x003F0060,0xFFC8FFDC,0x01410084,0x008A0122,
-0x00540029,0x005D006A,0x0066004B,0x00620078,0x00150033,0x0079003E,0xFFEB0050,0x001DFFF7,
-0xFFA3FFE4,0xFF45FF51,0xFFBAFF81,0xFF82FFAC,0xFFEBFFAE,0xFF6AFFAE,0x004AFFA8,0xFFA60053,
-0xFF65FF28,0xFF8DFF99,0xFF4BFF88,0xFED8FEFB,0xFF2AFEFE,0xFEC4FF1A,0xFEBCFE68,0xFF47FF3B,
-0xFE8FFEB5,0xFF6AFEE3,0x0000FFB7,0x0032003B,0x0066003D,0xFFDA003D,0x0007FFDC,0xFF9DFFBE,
-0x00D2002B,0x009600FE,0x00220021,0x008F006E,0x006C0079,0x0092008C,0x00320056,0x002F0025,
-0x00A2006B,0x005B00B9,0xFF81FFC8,0xFFE9FFA8,0xFF9BFFCF,0x0006FF96,0xFFF2005E,0xFFAAFF5A,
-0x009B0089,0xFFDE0018,0x0034FFFB,0x00930077,0x0025005C,0x0071002D,0xFF62003E,0xFEFCFEBE,
-0x0012FFC1,0xFED5FF9B,0xFF06FE8E,0xFFDAFFB0,0xFEABFF36,0xFF7AFED6,0xFF2BFFA0,0xFF0CFEC5,
-0xFFECFF8A,0xFF89FFD7,0xFF77FF49,0x0031FFEA,0xFFB90019,0xFF73FF78,0xFEC5FF41,0xFF29FEAF,
-0x002BFFFA,0xFF67FFBE,0xFFD2FF9D,0xFF8EFF9F,0x005DFFDE,0x0027005C,0x00360015,0xFFF2001B,
-0x005D0005,0xFFEF0061,0xFFB5FF81,0x00440017,0x00490037,0x00BF008B,0x0034009F,0xFFFFFFE7,
-0x00FD0070,0x00EC0134,0x00710078,0x013A00CC,0x00AF011E,0x003F0048,0x008E0082,0x0020003D,
-0x00780065,0x008C008C,0x0095009A,0xFFEB0050,0x007CFFEE,0x006300CD,0xFFCFFFD4,0x00730030,
-0xFFF30048,0xFFE3FFCB,0xFFFEFFE6,0x0027001C,0xFFC6FFF8,0xFF88FF99,0x0015FF9E,0x00540069,
-0xFFF7FFE8,0x0065004F,0x001B004F,0xFFD8FFC3,0x00850043,0xFFBA0066,0xFFCBFF62,0x001C0036,
-0xFFD5FFD2,0xFFD90002,0x0018FFB4,0x00EB00A6,0x002D009F,0x006D001F,0x00C400CA,0x003D0078,
-0x007C0039,0x006700A9,0xFFD5FFF3,0x00510019,0x00240050,0x00480013,0x00C500AD,0x0050008A,
-0x0088005B,0x00490071,0x00DF006A,0x00C2011D,0xFFFD003E,0x004E000A,0x0029004F,0xFFD4FFE8,
-0xFFFAFFFC,0xFF9FFFCE,0xFF7EFF85,0xFF97FF96,0xFF88FF83,0xFF7CFF70,0x002CFFD1,0xFFC80030,
-0xFF9BFF93,0xFF7DFFA9,0xFF6AFF58,0xFFE4FFB9,0xFF3FFF97,0xFF1BFF02,0xFF9DFF6E,0xFF3CFF83,
-0xFF46FF28,0xFF78FF7E,0xFF36FF3E,0xFF7AFF58,0xFF32FF71,0xFF1EFF09,0xFF26FF37,0xFF51FF1E,
-0xFF11FF51,0xFEA6FEB2,0xFFB8FF12,0xFFCAFFEF,0xFF48FF66,0xFFEFFF8E,0xFFF60012,0x0028FFEA,
-0x006A0077,0xFFB3FFED,0xFFF2FFD4,0xFFEBFFF0,0xFFE6FFED,0xFFB8FFCD,0x0004FFC5,0x00920056,
-0x0001004B,0x0058FFFE,0x0075008D,0x009D0063,0x007900B8,0x00170005,0x00970077,0x00060048,
-0x003CFFF8,0x00190053,0xFFF7FFEB,0x0048001D,0x00590061,0xFFE40018,0x001A000C,0x0064003D,
-0x00650089,0xFF90FFD6,0x0004FFC8,0xFFDB000A,0xFFB1FFB1,0xFFC3FFCB,0xFF6FFF9D,0xFFA2FF5F,
-0xFFFBFFF1,0xFF9CFFBE,0x001BFFEB,0xFF7FFFD2,0x001FFFB8,0xFFCC0025,0xFF53FF76,0xFFA8FF6F,
-0xFF5EFF9F,0xFF68FF3B,0xFF40FF8D,0xFECCFEE6,0xFFB5FF41,0xFFB3FFD9,0xFF92FF90,0xFFC8FFAC,
-0xFFCFFFC1,0x00070001,0xFF83FFCB,0xFFD2FF88,0xFFDE001E,0xFF7EFF75,0x002EFFF2,0xFF9BFFD9,
-0xFFDFFFB4,0x00780016,0xFFFE0072,0x0008FFC8,0x007E0062,0x00B90081,0x00D900E3,0x00190067,
-0x00420023,0x0038004E,0x004B0036,0x00120030,0x00570030,0x000E0040,0x002B0013,0x005B0039,
-0x0044006F,0x0057002C,0x00640096,0xFF8BFFDA,0xFFA0FF88,0xFFD0FFB1,0xFFE0FFE2,0xFF73FF90,
-0x0012FFAE,0xFFDE0029,0xFFA7FFA2,0x000DFFC7,0x007F0055,0x00460071,0x00190027,0xFFA8FFDD,
-0xFFFAFFC9,0xFFA9FFED,0xFF94FF78,0xFF74FFA6,0xFEE7FF0A,0xFFDDFF4D,0xFFB00003,0xFF87FF5E,
-0xFFF2FFE1,0xFF95FF9D,0x0022FFCF,0x0016002D,0x002CFFF9,0x00C60098,0xFFE00081,0x003EFFB4,
-0x00A900DB,0xFFF50024,0x00A10057,0x00310084,0x00A30043,0x00CD00DE,0x00600082,0x00AD007F,
-0x005B00A5,0x002E003D,0x000E0028,0xFFF4FFF1,0x0032001A,0x0021003B,0x0019000C,0x008D0060,
-0x00230067,0x00310023,0xFFE40025,0xFFE9FFD0,0x0035002A,0x004E0040,0xFFCA0033,0xFF5DFF58,
-0xFFF9FFC7,0xFF3BFF94,0xFF91FF4F,0xFFAEFFB2,0xFF43FF7B,0xFF4DFF27,0xFFC1FFA2,0xFF9EFFC8,
-0xFF59FF6D,0xFF39FF4B,0xFF34FF2B,0xFF51FF4A,0xFFA5FF67,0xFFAEFFCA,0xFEEBFF40,0xFFCFFF21,
-0x0043005E,0xFF94FFC9,0x003BFFEE,0x003D0047,0x002E002D,0x002E0030,0x000CFFF9,0x005D004F,
-0xFFF10013,0x002CFFFF,0x001F0026,0x0046002A,0x007B0062,0x00A00099,0x009F00AF,0x00AC0098,
-0x00CC00EA,0x00620085,0x008B006A,0x00C400BC,0x001D0078,0x001D0002,0x00A50052,0x008E00CB,
-0x0005002B,0x00620032,0x00A7007F,0x008900B3,0x002A0048,0x00220024,0xFFC4FFFB,0x0019FFC0,
-0xFFFB0046,0xFF85FF99,0xFF8BFF89,0xFFCBFF9E,0xFFECFFF6,0xFFA8FFB5,0xFFC9FFAF,0xFFEAFFE1,
-0xFFC0FFD9,0xFFDFFFB2,0x00130029,0xFF8DFFB0,0x0015FFDD,0xFF69FFE0,0xFFB5FF52,0x00500035,
-0xFFEC0016,0x0022FFF7,0x0024002F,0x00440028,0x006B0069,0xFFFF0033,0x005E000D,0x0005006F,
-0xFFA8FF95,0x00860032,0x005C007F,0x00540041,0x0090007C,0x00100067,0x007B000E,0x010C010B,
-0x005100A7,0x00A50071,0x00270064,0x0069001D,0x00740080,0x0012003C,0x0024FFFE,0xFFFD0047,
-0xFF75FF78,0x008E0010,0xFFDF006A,0xFF94FF92,0xFFF1FFC8,0xFFFD000D,0xFF73FFC6,0xFF83FF71,
-0xFF6EFF83,0xFFA4FF72,0xFFA1FFC5,0xFFA0FF87,0xFF63FF95,0xFF66FF3F,0xFFC7FFA5,0xFF80FFB8,
-0xFF5EFF5E,0xFFBBFF85,0xFF6DFFC4,0xFF3FFF1D,0xFFB6FF9E,0xFF84FF97,0xFF9DFF9A,0xFF7CFF8E,
-0xFF81FF84,0xFFDEFF9C,0x00120017,0x00210008,0xFFF0000B,0x003FFFFF,0x00790074,0x000B0036,
-0x000EFFF9,0x00190012,0x00150014,0xFFE7FFFA,0x001AFFFD,0x00570036,0x000F003E,0xFFE9FFD0,
-0x00750039,0x00680072,0x006A0051,0x005D007F,0xFFEE0021,0x0037FFF2,0x00660064,0xFFE40022,
-0x0038FFF9,0x00310060,0x0024001D,0x00300030,0x000A0013,0x006A0043,0x00200050,0xFFE3FFF2,
-0xFFECFFDA,0x001A0016,0xFFD6FFEE,0xFFC6FFC5,0xFFCBFFBC,0xFFDAFFD4,0x0010FFF0,0x00230018,
-0xFFFD0018,0xFFF8FFD2,0x00450029,0x0042003F,0x000E002B,0x00220005,0xFFFF0031,0xFFD4FFD1,
-0xFFF5FFF1,0x0028FFF0,0x00490044,0x001B0025,0x004B002A,0x006B005E,0x00910084,0x00630080,
-0x00340046,0x0023002A,0x0018002E,0xFFF9FFFA,0x0019000E,0x0044001E,0x00400053,0x002C0011,
-0x008F005A,0x007C008C,0x001F0040,0x002A0006,0x00210049,0xFFBFFFDA,0x0042FFFB,0xFFF60039,
-0xFFCEFFC8,0xFFCFFFE4,0xFF96FFAC,0xFFF5FFB7,0x00040017,0xFFEAFFF4,0xFFE6FFE1,0xFFE9FFEA,
-0xFFD6FFD3,0xFFAAFFCC,0xFF76FF86,0xFFB9FF99,0xFFCBFFD4,0xFF90FFA3,0xFFB3FFA2,0xFFC6FFC3,
-0xFFF2FFD8,0x00140015,0xFFF9000F,0x0019FFFA,0x005D003F,0x00260049,0x001F001F,0x0009000B,
-0x0053002D,0x0012003B,0xFFFAFFF0,0xFFCFFFF4,0xFFFDFFD6,0x003C0026,0x00060031,0xFFFAFFDE,
-0x0075004F,0x00370067,0x0009001F,0x00160019,0x00350022,0x002D0034,0x00650038,0x008A0088,
-0x005E0072,0x0037003B,0x00280034,0x0054002F,0x00920091,0xFFDA0042,0xFFEAFFC5,0x0005000B,
-0xFFE8FFF8,0xFFE7FFF6,0xFFD6FFD1,0xFFBFFFC2,0x0022FFF2,0x00280046,0xFFDFFFE8,0x00650028,
-0x00240057,0x00120004,0x00250026,0xFFD1FFF5,0xFFF2FFE3,0xFFA1FFCA,0xFFBCFFAE,0xFF98FFAF,
-0xFFD6FFA9,0xFFF8FFF7,0xFFCDFFD6,0xFFFAFFD3,0x000B0012,0xFFD0FFFF,0x000AFFE5,0xFFC00019,
-0xFF93FF80,0xFFF6FFE4,0xFF80FFC7,0xFFCBFF88,0xFFF40011,0xFFC1FFC0,0x0047000F,0x000A0039,
-0xFFF8FFF9,0xFFF8000E,0xFFC5FFC1,0xFFFFFFDB,0xFFCAFFF0,0xFFBAFFAB,0xFFD3FFD0,0xFF89FFB3,
-0xFFA8FF80,0xFFE7FFE0,0xFF8DFFAF,0x0008FFBB,0xFFB9000C,0xFFB0FF91,0xFFF9FFE1,0xFFCCFFF4,
-0xFFB4FFB0,0xFFE1FFD7,0xFFCCFFE0,0xFFFCFFD8,0xFFF5000A,0xFFF2FFED,0x00030012,0xFFC4FFDA,
-0xFFECFFC8,0xFFD5FFF3,0xFFE5FFDB,0x0012000E,0xFFA6FFD6,0xFFC5FFA6,0xFFD5FFCF,0xFFEAFFD6,
-0xFFEEFFF6,0xFFBAFFCB,0x0029FFE7,0x004A0058,0xFFEE0013,0x0021FFFA,0x00380047,0x002E0028,
-0x00230038,0xFFF1FFF7,0x00380011,0x00280039,0x00000015,0xFFF7FFF9,0x00220013,0x00630046,
-0x006F007D,0x00350046,0x00620047,0x00650070,0x00460050,0x00380031,0x000E0022,0x0021000F,
-0x00330028,0x00280021,0x0041003D,0x004F0045,0x008C0071,0x00700090,0x005C005A,0x007E006D,
-0x0073008A,0x005F0060,0x006C0064,0x0018004C,0x000EFFEF,0x00340029,0xFFF70012,0x00110008,
-0xFFE70000,0x0017FFF3,0x00530054,0xFFF1002C,0xFFF6FFDB,0x0023001B,0xFFF00010,0x001A0003,
-0x00290034,0xFFF30001,0x004C001A,0x0002003B,0xFFF2FFD6,0x00200013,0x001D0014,0xFFE10004,
-0xFFE7FFD3,0xFFC4FFD7,0xFFC0FFBE,0xFFA4FFC6,0xFFBCFF9C,0xFFDBFFDB,0xFF7CFFA4,0xFFAFFF79,
-0xFFEBFFE7,0xFFB3FFCB,0xFFDEFFB8,0xFFCCFFF4,0xFFA6FF9E,0x0007FFD3,0xFFE6FFFB,0xFF9AFFBD,
-0xFF9BFF84,0xFFDFFFB6,0xFFF9FFED,0xFFC4FFE8,0xFFBFFFA3,0x0008FFFA,0xFF9EFFBE,0xFFFCFFCB,
-0xFFE7FFF8,0xFFE5FFED,0xFFC6FFDB,0xFF9DFFAE,0xFFBAFFB2,0xFFD7FFD2,0xFFD5FFD6,0xFFE5FFD9,
-0xFFEAFFF4,0x001AFFE9,0x006E0058,0x001F0036,0x00280012,0x002E003A,0xFFF1000B,0xFFD7FFE1,
-0x0017FFFF,0xFFE70012,0xFFC8FFB8,0xFFFEFFE3,0xFFF9FFFB,0x0022FFF9,0x00430048,0xFFFB0010,
-0x00110008,0x003A0024,0x00280046,0xFFC8FFDD,0x0022FFE9,0x0019002F,0xFFDC0003,0xFFEBFFD5,
-0x0013FFFD,0x0017000E,0x0056003C,0x001D0044,0x00420024,0x002D0050,0xFFF8FFFA,0x0019FFFD,
-0x0019000D,0x004A0036,0x001B003E,0xFFEAFFF2,0x00270007,0x004D004A,0x004C004A,0x0042004B,
-0x00430044,0x0025003C,0x00350027,0x005A0051,0x00700056,0x003F0060,0x00670040,0x00590078,
-0x00560044,0x00BA0096,0x0065009B,0x00620046,0x008B0077,0x00830090,0x0044005D,0x002B003A,
-0x0017001C,0x001F0021,0x00000015,0x00290012,0x0014002E,0xFFF90013,0x0011FFFA,0x00580048,
-0x003A0052,0x00280023,0x00310037,0x000D0022,0x00040009,0x00070019,0xFFD1FFE8,0xFFC1FFD4,
-0xFFAFFFA5,0xFFBEFFB4,0xFFB7FF9E,0x0017FFE4,0xFF9AFFF0,0xFF93FF78,0xFFC2FFBA,0xFFB2FFC0,
-0xFFADFFAB,0xFFB1FFA1,0xFF9FFFA9,0xFFAFFFA9,0xFFDDFFCA,0xFFD6FFE5,0xFFF5FFD6,0x00000009,
-0xFFF60000,0x0001FFED,0x0019000E,0xFFECFFF9,0xFFC0FFBE,0xFFE9FFCE,0xFFCCFFEC,0x0011FFE0,
-0x0006002A,0xFFABFFC4,0x000BFFD3,0xFFFB0021,0x0001FFF3,0x00210027,0x00170022,0x0023001B,
-0x000C0034,0xFFDFFFDC,0x0011FFED,0x001C0014,0x00220021,0xFFF80010,0xFFF0FFE1,0x003B0015,
-0xFFF10026,0x0016FFE5,0x00290041,0xFF9EFFE2,0xFFB7FF92,0xFFC3FFCF,0xFF5CFF94,0xFF86FF63,
-0xFF9CFFAB,0xFF69FF70,0xFFBFFF89,0xFFC4FFC6,0xFFB1FFBE,0xFFFAFFDA,0x000A000F,0xFFE2FFF3,
-0xFFF1FFE7,0xFFFBFFF8,0xFFDEFFEB,0xFFB6FFD5,0xFFBFFFB9,0xFFC3FFD4,0xFFD7FFCF,0x0006FFEC,
-0xFFF8000C,0xFFF7FFD8,0x00450021,0x002C0035,0x00470026,0x0057005A,0x0014002A,0x0030001C,
-0x0030003A,0x003A0029,0x00470046,0x0030002E,0x00420039,0x003E0046,0x00610055,0x00440050,
-0x004B004A,0x004A0045,0x00470049,0x0030002C,0x00280020,0x0001000C,0x001D000E,0xFFE5000E,
-0xFFC5FFC3,0x0003FFF9,0xFFF0FFEF,0xFFF30004,0xFFBAFFC9,0xFFC6FFB4,0xFFB6FFBC,0xFFD8FFC8,
-0xFFD1FFE8,0xFFABFFB6,0xFFBBFFAD,0xFFE9FFDB,0xFFF5FFF6,0xFFF2FFE1,0xFFFBFFEF,0xFFD5FFF5,
-0xFFB4FFA5,0xFFF3FFD6,0xFFC5FFD9,0xFFC9FFC0,0xFFD2FFEA,0xFFC2FFC3,0xFFC7FFBF,0x0018FFF1,
-0xFFDB0009,0x001FFFF5,0x001F003D,0x0055002E,0x0083007E,0x003C0057,0x003D002C,0x00400040,
-0x002C0039,0x0031002D,0x00650059,0x00610064,0x0027004A,0x00190005,0x0061003F,0x0046004F,
-0x0037003C,0x00090028,0xFFFCFFF7,0x0035001B,0x00110021,0x00130001,0x00270021,0xFFEA000B,
-0xFFD7FFC9,0x0000FFED,0x002F0025,0xFFF40011,0x0012FFF4,0xFFE10009,0xFFD1FFBA,0x000B0004,
-0xFFA1FFCB,0xFF9EFF9F,0xFF97FF9B,0xFFACFFA0,0xFF9AFFA8,0xFFA3FFB3,0xFFA9FF9F,0xFFCCFFCB,
-0xFFC5FFD7,0xFFD3FFBF,0xFFF3FFE8,0x000F0002,0x000A000D,0xFFF4FFF9,0x00170004,0x00200027,
-0xFFF8FFFE,0x00350015,0x001C002E,0x001D0010,0x00450043,0x00320049,0x00310039,0x0015002F,
-0xFFD9FFEF,0xFFF8FFF7,0xFFF3FFFE,0xFFFFFFF8,0x00120025,0x001F001A,0x00440034,0x002B003E,
-0x00100012,0x0048002D,0x0036004F,0x0015001C,0xFFF50008,0x0011000A,0x00270026,0x0008001D,
-0x00070006,0xFFFE0000,0xFFD9FFD5,0xFFF0FFD7,0xFFF8FFF3,0xFFEDFFFC,0xFFF9FFF7,0xFFB7FFE7,
-0xFFABFFA5,0xFFCEFFBF,0xFFCBFFBD,0xFF9FFFB7,0xFFC6FFA2,0xFFDBFFDA,0xFFCDFFCF,0xFFE5FFDB,
-0x0005FFFB,0xFFDEFFF6,0xFFECFFD6,0xFFF4FFF8,0x001D000D,0xFFF3000B,0xFFF9FFF3,0xFFDCFFF9,
-0x0005FFE3,0x002F0034,0x000D001E,0x0005FFF9,0x002A0014,0x00280033,0x00460036,0x0018004A,
-0x00140004,0x0027002F,0x00090017,0x0009FFFE,0x00230007,0x002E0030,0x00220027,0x002B0023,
-0x0041003C,0x00240034,0x00220024,0x00060023,0xFFFAFFEA,0xFFFC0016,0xFFC5FFD1,0xFFDBFFDC,
-0xFFB2FFBE,0xFFB7FFBB,0xFFB2FFAB,0xFFC9FFC2,0xFFEEFFDA,0xFFEFFFF0,0xFFEFFFEF,0x002E0001,
-0x001D0029,0x0002000A,0xFFFAFFFF,0xFFDCFFE0,0xFFF9FFE9,0xFFF50009,0x0006FFF3,0x00180017,
-0xFFF9FFFD,0x000AFFF6,0x001A0011,0x00250012,0x00230021,0x001A0021,0x00080018,0xFFFE0006,
-0x004A0029,0x002E003F,0x00210026,0x004E003F,0x004B005A,0x00590052,0x00640058,0x00620061,
-0x006D0067,0x004E0061,0x004C0046,0x0037004E,0x00210020,0x003D0031,0x0018002C,0x00520029,
-0x004B005A,0x00100014,0x000C0001,0xFFFE000A,0xFFF40003,0xFFD9FFE4,0xFFD8FFCF,0xFFCFFFD4,
-0xFFD1FFC0,0xFFA7FFC2,0xFFC4FFA3,0xFFDEFFD8,0xFFB5FFC4,0xFFC4FFBA,0xFFE2FFE1,0xFFC1FFD2,
-0xFFC2FFC0,0xFF9EFFB5,0xFFA3FF9D,0xFFB9FFB6,0xFF9AFFA4,0xFFABFF97,0xFFB7FFB1,0xFFB8FFAC,
-0xFFF4FFE7,0xFFCBFFD1,0x0005FFE5,0xFFFC0013,0xFFF0FFE4,0xFFF8FFF4,0xFFE3FFED,0x00190001,
-0xFFE5000C,0xFFC8FFC8,0xFFD1FFC4,0x0002FFEC,0x000D0007,0xFFF1FFFC,0x0002FFF5,0x00230013,
-0x00100029,0x00240010,0x00370039,0x0005001B,0x000D000F,0xFFEB000A,0xFFEAFFDA,0x000E000B,
-0xFFF30009,0xFFF1FFE8,0xFFFDFFFA,0xFFF8FFFE,0x00080003,0x0006001B,0xFFEFFFFC,0xFFFEFFFE,
-0xFFCFFFEA,0xFFE2FFD1,0xFFDFFFF0,0xFFC6FFC7,0xFFF4FFEC,0xFFD3FFEB,0xFFD9FFDB,0xFFE8FFDB,
-0xFFEBFFEC,0xFFE3FFE1,0x000AFFFE,0xFFF0000C,0xFFECFFEE,0xFFF1FFF8,0x0008FFFC,0xFFFA0007,
-0xFFE5FFE5,0xFFF4FFEA,0x00190013,0x00190017,0x001E0022,0x000E000D,0x00220015,0x0028002D,
-0x000F0018,0x0019000A,0x0025001D,0x000E0013,0x0024000C,0x0018002A,0x002D0019,0x0024002B,
-0x002F0025,0x00360036,0x00480048,0x00470046,0x005C004F,0x0036004C,0x0027001D,0x00240031,
-0x00180012,0x0045002B,0x0028002F,0x00110024,0xFFF9000E,0x00120002,0x0014001B,0xFFF20002,
-0xFFE9FFF3,0xFFCCFFD8,0xFFBEFFC3,0xFFDCFFD4,0xFFCFFFD6,0xFFD4FFBE,0xFFDAFFCF,0xFFE1FFDC,
-0xFFEEFFE9,0xFFFEFFFF,0xFFDEFFF7,0xFFDAFFDA,0xFFE5FFDF,0xFFEBFFE3,0xFFD9FFE8,0xFFBCFFD1,
-0xFFB5FFBA,0xFFB8FFAE,0xFFCDFFC6,0xFFD3FFD1,0xFFD0FFD8,0xFFE6FFCE,0xFFE8FFDB,0xFFC7FFD6,
-0xFFC7FFC2,0xFFDBFFD2,0xFFDAFFD0,0xFFC5FFCE,0xFFC4FFB4,0xFFE8FFE0,0xFFDDFFDA,0xFFE8FFDC,
-0xFFE0FFE1,0x0005FFE6,0x000B000C,0xFFE5FFFB,0xFFD2FFDD,0xFFC3FFCA,0xFFE1FFD2,0xFFCDFFDC,
-0xFFC7FFBD,0xFFCDFFC9,0xFFBBFFB9,0xFFE4FFCC,0xFFE0FFE6,0xFFEFFFE5,0x00130003,0x000B0012,
-0xFFEFFFF5,0xFFFCFFE9,0x001A000D,0xFFEC0002,0xFFE1FFDD,0xFFF0FFED,0x0002FFFD,0xFFF60000,
-0xFFFDFFF1,0xFFE0FFE9,0xFFE7FFDF,0xFFF5FFF6,0xFFF8FFF7,0xFFFE0006,0xFFE9FFEA,0xFFE7FFF3,
-0xFFDAFFD1,0x0004FFEA,0x0003FFFF,0xFFFF0004,0xFFFCFFFC,0xFFFBFFF5,0x00240011,0x0016002E,
-0x0004FFFF,0x00350029,0x0002001B,0x00190007,0x002E0028,0x002C0033,0x001D0023,0x00240019,
-0x000E0017,0x00170018,0x0003000F,0x00090005,0xFFF8FFFF,0x00010000,0xFFFE000D,0xFFE0FFE7,
-0xFFFBFFE6,0xFFF2FFF2,0xFFE7FFEE,0x0010FFFC,0x00160019,0x00260017,0x003D0039,0x001C0021,
-0x00160004,0x002E0015,0x000E0024,0xFFDFFFE4,0x0004FFF2,0xFFF1FFFF,0xFFDBFFE3,0xFFD2FFD3,
-0xFFF7FFE8,0x000C000B,0x001E0013,0x00080018,0x00110002,0x0020001D,0x0024002F,0x0001000C,
-0x000E0007,0xFFF20001,0xFFE2FFE8,0xFFD0FFDC,0xFFFEFFE3,0xFFFA0001,0xFFF0FFF8,0xFFF7FFEA,
-0x0022000C,0xFFFD0019,0xFFF7FFE8,0xFFF2FFFE,0xFFE4FFE5,0xFFF0FFFB,0xFFDBFFE4,0xFFFFFFDD,
-0x000D0017,0x0005FFFC,0x0015000A,0x00070004,0x003E001C,0x0034004B,0x00090016,0x0014000C,
-0x00400033,0x0025003F,0x00260024,0x000B0025,0x0014000E,0x0002000D,0xFFEBFFEE,0x0015FFFC,
-0x001E0022,0x00060011,0xFFF10007,0xFFFEFFEE,0x0045002B,0x002E003D,0x00220028,0x00170024,
-0x00400027,0x00490040,0x00410045,0x0020002B,0x001E0018,0x001E001C,0x0003000F,0x001E0011,
-0x00140022,0xFFDFFFF8,0xFFEBFFD9,0x0005FFF3,0x00220012,0x001A0020,0x00130012,0x001F0013,
-0x0032002D,0xFFFF0013,0x00080004,0xFFF00001,0xFFE5FFF2,0xFFC3FFE6,0xFFC6FFC5,0xFFFEFFEA,
-0xFFEA0007,0xFFD1FFD9,0xFFCCFFD0,0xFFEAFFDA,0x0002FFF9,0xFFDAFFF7,0xFFE4FFE4,0xFFE3FFED,
-0xFFECFFE1,0xFFD5FFDF,0xFFCFFFD4,0xFFC2FFBC,0xFFCAFFC7,0xFFB8FFC7,0xFFCAFFBA,0xFFECFFE4,
-0xFFDBFFE2,0xFFEBFFE7,0xFFE8FFEC,0x0004FFEF,0x00120013,0xFFCEFFF5,0xFFECFFCD,0xFFF1000B,
-0xFFD4FFE1,0xFFE9FFE3,0xFFDFFFE6,0xFFDAFFCA,0xFFFFFFEF,0xFFEEFFFC,0xFFE8FFDD,0x0000FFF2,
-0xFFEEFFEE,0xFFD2FFDB,0xFFC8FFC5,0xFFD9FFCF,0xFFEBFFD9,0xFFDFFFDE,0xFFF2FFED,0xFFF8FFF3,
-0xFFDDFFE9,0xFFFBFFE8,0x00120005,0x0014000C,0x00130019,0x000A0007,0xFFF70003,0x000AFFF8,
-0x0013000F,0x000A000C,0x00190010,0x001C001C,0x00140016,0x001B0018,0x00220013,0x001B0024,
-0x00230014,0x00300020,0x0044003F,0x004A0042,0x00000030,0x00000000,0x00000000,
-};
@@ -1,461 +0,0 @@
-// Audio data converted from WAV file by wav2sketch
-
-#include "AudioSampleType.h"
-
-// Converted from type.wav, using 44100 Hz, 16 bit PCM encoding
-const unsigned int AudioSampleType[3649] = {
-0x81001C2C,0xFFB000F9,0x0063FED3,0x01620189,0xFFA00007,0x02500122,0xFEE300D8,0x0227FFB8,
-0x046F0443,0x01C80305,0x02CC01F0,0x033502E5,0x049A0424,0x021D03B1,0x03070190,0x037204B5,
-0x0B690208,0xF72D1EEA,0x0AE0EA9A,0x150703C3,0xF631EA28,0x0EACED21,0xE7813398,0x1D39BBFB,
-0x0DD8178A,0xE4D81EDF,0x1388EF37,0xDB2307F6,0x0AC1F537,0x01390991,0x0778FC31,0x620C76CF,
-0xCC51D9DA,0xE27BE895,0xF96B8663,0x2D5B1698,0x1D3715E6,0xBEF4D013,0x0AFC051B,0x0995F7CF,
-0xCB9BDB08,0xF766BF31,0xF52BFDE4,0x29801C34,0xB0620EDD,0xF79D9618,0xF53B2E6F,0xE570F78A,
-0xF9BDBCFA,0x17B33D2C,0x0C41ED5C,0x17591058,0x000641C7,0xD8B58177,0x3FE44E1C,0xB985E92C,
-0xDA9C9CC8,0x1C3B3D14,0x26430AAA,0xEFE81DCF,0xE55DEF1F,0xE1CDCE2D,0x3E531982,0x00C636F3,
-0x0718E432,0x26A01717,0xFF540E75,0x2C0710DF,0x1AF412C5,0xD182016B,0xFD3AE93A,0xFBB80C3A,
-0xDEC5F584,0xEA84D972,0x102400BF,0x15BD270C,0xF74C01D2,0x019AF4FC,0xF8A1F42F,0xF96DFEAE,
-0x14E4FDE7,0x0312FD10,0x073C0BDF,0x030B0E35,0xE397E72D,0x047AF1BF,0xF89E0412,0x0425EF46,
-0x04321C5C,0xDA9BE316,0x17B9EAD4,0x01061B52,0xF698ED96,0x0169FDA4,0x096C06AB,0xE486F467,
-0x1B5F02ED,0xEAE2FEC6,0xFB8BEA94,0x156314E8,0xF145FCAD,0x1424F5EC,0x1E7E2CBA,0xF90B096B,
-0xE9DDE7F7,0x07B90228,0x00A6F8A0,0x103B0B64,0xFF2C0A37,0xF9DAFABD,0xFADBF9D6,0x0290F85B,
-0xF8A8018E,0xF02AF63D,0xF13DEADF,0x0BC1FDFD,0xFA040BA4,0x179A00C3,0x026B0FD8,0xFFCE012C,
-0x02FA03F1,0x018B003E,0x01570644,0xFAACF1C1,0xF8E9FBFF,0xF7B1F783,0xF449F6E5,0x0E180385,
-0x056C0ECE,0x00B608AC,0xF7E2F394,0x024E0112,0xFE49FA2F,0xFC3101EC,0xFC07FABD,0x102A06E0,
-0x1B61154C,0x041A17E5,0x008CFA16,0x119004C6,0x12B71997,0x0C640B0B,0x10D11084,0xFD07099B,
-0xFF68FE5E,0x0DD0051A,0x09C20DA6,0x09F0067D,0x0DFB0CBA,0x05320C05,0x00DF0280,0x18580C8D,
-0x06F712F9,0x024BFFF5,0x118F0CDA,0xFF0B08F7,0x066403A7,0x0DB10BE2,0x01F60656,0xFD85014A,
-0xF4E8FC6F,0xF7B6F3AD,0x018BFEEA,0xFCFBFF9C,0xF39DF698,0xF634F504,0x04D7FA66,0xFD820607,
-0xF578F3AF,0xF765F779,0xF975FA7A,0xFA45F9B8,0xFC0FF8AF,0xF97FFB3E,0x03DD0251,0xFD25FED8,
-0x03980153,0x00FC02A9,0xF9F0FAF5,0xF454F557,0xFBA4F966,0x057EFDC4,0x00DD07E7,0x05B20037,
-0x037D06FA,0xFDEAFF3B,0xFF46FC1B,0x04890793,0x01DC00B3,0x06DD05D4,0x02FE042F,0x083F02F6,
-0x0D550C54,0x0B440C04,0x068E0B8E,0x0FB60814,0x0FA31214,0x0C950F0E,0x06260909,0x081D08E6,
-0x05AB0507,0x06E80745,0x023505C0,0x0063FE64,0x087E067B,0x0607071D,0x0C040907,0x05490947,
-0xFDB8FF64,0x050D0092,0x05C90865,0x05190256,0x065B09EC,0xFAECFFB1,0xFA54F85A,0x03AF01FD,
-0xFF150013,0xFCBAFD8C,0x0067FE5F,0xFA74FBD3,0x02CD006B,0xFF10FF55,0x047700B9,0x00F103D7,
-0xF7DFFCB6,0xFC51FAD0,0xF4F0F960,0xF63FF277,0xFF93FD23,0xFB9CFBAF,0xFE3AFDC2,0xFCA8F9DA,
-0xF819FC67,0x04B6FD8D,0xF7A6FE4C,0xFA0CF816,0xFB54F96D,0xFDE6FDFA,0xFE47FD51,0xFFF500E0,
-0xFFE8FF01,0x01D500F5,0x0414032F,0xFEC90044,0x0049FF1A,0x011501B0,0x02210168,0x041803B4,
-0x01130167,0x01F8FE78,0xFD5D01D0,0x03B90045,0x02A10213,0x00950324,0x05F001C7,0x06E20A64,
-0x03B602AD,0x0A3C084A,0x015F0751,0x06D10274,0x0AA40B84,0x066F0792,0x072707DF,0x046205F7,
-0xFE30006C,0x05D803F9,0xF22AFB4D,0x06B7F4AE,0xF79D00F8,0xF598FF61,0x06C5F84A,0xFABA0104,
-0xFF05017E,0xFCCBFE85,0xF75D016C,0xFDFCF4C7,0xF0CEF94C,0xF99CF996,0xFB31F7C4,0xFDB5007C,
-0xF560F12A,0xFF5BFB7C,0xFC9FFDCA,0xFAFDFA77,0xFC80FB03,0xEE8BF56A,0xFCD0F389,0xF476F69A,
-0xF6E6FB9F,0xFA6DEEB7,0xED9BFD61,0x00C9F7B4,0xF8E9F753,0xFA07FE44,0x0198F9B8,0xF9C8012D,
-0x00A2F708,0x01D50015,0x03E904B3,0x021A0155,0x04FB08E4,0x06C4027C,0x00460452,0x05B7045D,
-0x027E0031,0x049002E4,0x0943016B,0xFCFE0827,0x08430785,0x00760284,0x081B06B8,0x0471FFB2,
-0x009906EC,0x0573FD42,0xFDD204FA,0x012602B0,0x02FCFF27,0xFFEB02AB,0xFE6EF907,0xFAA7FDAB,
-0xFEA0FF3B,0xFFBFFE0D,0xFC9EFC93,0xFEC4FE26,0xF765FAA6,0xF822FCAF,0xFB6EF646,0xF5A4F869,
-0xF329F97E,0xFB1FF4A4,0xF66FF720,0xF2D6F736,0xF88EF510,0xF4A8F812,0xF609F3D4,0xF6C1F3BB,
-0xF881F5CA,0xF6AAF9AE,0xFAC9F836,0xFB6AFB85,0xFD88FADE,0xF95DFA3A,0xF8FBFA89,0xF7F8FA86,
-0xFEC6FB04,0xFFF2FEA1,0x02FD04AF,0xFFE20018,0x055A026B,0x067506B5,0x04CB0681,0x02CA0247,
-0x0282015E,0x03E4051C,0x01F10134,0x041002C4,0x018E012B,0x03A005F9,0x036F017B,0x047403A0,
-0x07B70665,0x02AB0272,0x067B0659,0x03A1060D,0xFE5FFE08,0xFF90FF90,0xFEE2FFA9,0xFD74FCD1,
-0xFB29FBC8,0xFE2CFE98,0xFB82FA6F,0xFD07006A,0xF85BF8DD,0xF628F87B,0xF9FAF693,0xFBBAFC44,
-0xFA08FAC7,0xFBB8F996,0xF8ECFA9F,0xF83DF9F0,0xF83FF8A3,0xFC1FF9D6,0xFA46F95B,0xFA54FAC7,
-0xFD7EFAEF,0xFB9BFCCD,0x002DFD66,0xFD9BFE0C,0xFDCFFE39,0xFE15FBFA,0xFC40FD81,0xFC9DFCCE,
-0xFF66FDA6,0xFDFDFDF7,0xFFE70073,0x00CB0128,0x044101F1,0x023C057A,0x060A0487,0x051E03CA,
-0x05D906B5,0x03770353,0x04EC05C2,0x0648057A,0x03A60418,0x03B60512,0x01190134,0x067504F4,
-0x044D0420,0x0173036A,0x030B01F1,0x016F0126,0x031F0041,0x0DA90761,0x0AD70E69,0xFF330668,
-0xFAE4FB1D,0xF5E3FA34,0xE991EDE3,0xF617EF7F,0xF947F7E9,0xFB51FAD2,0xFC4FFB08,0xFAB1FC6B,
-0xF9D3F969,0xF4A1F8CB,0xF6B5F7B7,0xFAE0F711,0x0397FF29,0xFA2CFDA2,0x01C10020,0x18790544,
-0x040118A5,0x11880EDA,0xF0EAE354,0xE7CB139E,0xF6D7D3BC,0xD817EC6D,0x1C480344,0xF9D91373,
-0x053D0990,0x03F9FBAB,0x096A1747,0x125B0A71,0xE1F5FA76,0x0A79EDEF,0x027AEDDF,0xE5320ABE,
-0xFD5DD967,0x061BF7B6,0xF6CB300A,0xF95DC1C7,0xF85013E5,0x01B1F58F,0x02700520,0x0A360B71,
-0xCE90E84A,0x2BD0E675,0xCE4A0441,0xFBA1F911,0xD892CEB3,0xE042E912,0xFE0BFBCE,0xFD1CFE6F,
-0xEF3AF0E6,0x11BD18DB,0x0F27E6FB,0x13A81E58,0xEBBBFC78,0xF35AE7F2,0x0F6A04C7,0xE7260A96,
-0xF098E61F,0xD63DE194,0x18150E78,0x0E58008A,0xFCAD1154,0x13A3F948,0x10920B2C,0x1AA31BED,
-0x14B31EC1,0xF193FD3D,0xE225DE33,0xFBB8F16E,0xF94AFB6F,0x20980EEB,0x1B1B1D44,0x16781E17,
-0x07D3FDBB,0xE7A10843,0xFD87EEF7,0xFA44FD0A,0x14281106,0x06850161,0xF4AA0D4D,0x0C9BEB31,
-0xFBEA0686,0x08D60418,0xF9C1FD10,0xF0C1FC47,0x07E5EA14,0x090B12C9,0x02AD03AD,0xF68301DE,
-0x00D3F31D,0xEDE6F863,0x147E10F9,0xF90CFCF8,0xF629F798,0xF640F70A,0x0872FB76,0xFFEE1476,
-0x00C8F8EE,0x0129FDBD,0xF7F3FF1B,0xFFF9F991,0xF00C0143,0xEF53E1E0,0x010FF808,0x188A0FE7,
-0x0C7D1756,0x052F09BA,0x04AC08A8,0x1241FFE4,0x04F20EE6,0x17AF0902,0xFA5E10B6,0x04D9F860,
-0x142C11A2,0x04BB0D5C,0x049B012F,0x08AD0869,0x14B814CD,0x077E0754,0x18611706,0x181C1A5E,
-0x030F0D17,0xFDEA027B,0x07E30034,0x12530F2B,0x19511566,0x04D80B83,0xFE0502E8,0x06AFFF6D,
-0x048104DC,0xFF5001CA,0x0004F97E,0x0C820997,0x08C008FD,0x035807E8,0xFD5AFCC3,0x0171001E,
-0x05230681,0xFE04016A,0xF959FCBC,0xF6ACF720,0xF905F6C4,0xFD76FBC6,0x029A0379,0xFCB3FCBA,
-0x0080FEFC,0x03CE01DE,0xFCCA00CE,0xFBA3FAF0,0xF7E0FC5C,0xFECDF5DE,0xFDE502F7,0xFC6FFB17,
-0xFC60FCD8,0x03630154,0x0A5C063F,0x02EC080C,0xFC0E0145,0x04B6FE77,0x060D066B,0x08400579,
-0x03CE085D,0x038C0551,0x0DA607E4,0x130D1208,0x06D60D34,0x066D0597,0x07B4076B,0x06100629,
-0x0BD908EE,0x03BB0943,0x00B3008F,0x0BA90622,0x04B80938,0x01AE0139,0x02EF04F6,0x0435FEA4,
-0x07360647,0x01F80515,0xFE4D02E4,0xF614F6AA,0x01A3FC85,0x02E603FE,0xF8E7FEC3,0xF36AF736,
-0xF0A4EFD4,0xFFBDF5D6,0xF9530116,0xF742F778,0x006AF734,0xFD4C045F,0x00B3FC6C,0x03E40438,
-0xEC41F9F7,0xED88E8DC,0xF771F17C,0xF40AF9C8,0xFC8FF174,0xFBDAFEBF,0xF5FFFAEB,0xF568F718,
-0xF658F2FF,0xF2CCF303,0x0031FCB6,0x0F2B0597,0x006F0C2C,0xF9EAF6C3,0x04750435,0x02AF02BF,
-0xFD2B0018,0xFF38FC0A,0x000A01CB,0x137F0963,0x08260C33,0x0332099B,0x009FFC27,0x0BD60866,
-0x08E608DF,0x01CC04CD,0x004B04FB,0x04D5FE92,0x14D40AB2,0x0C681834,0x0C5209C5,0x0095065C,
-0x067A0599,0x133A064C,0x11181974,0x0A360BCB,0xF6A00285,0xFA7BF4EC,0x063001F5,0x05DC0343,
-0x15EC0CA7,0x032E1373,0xFB9EF8C1,0x0211015C,0xFD0900A7,0x024AFE26,0xF96BFF01,0xF28BFA7D,
-0xEFADEC27,0xFDC5F919,0x0461FBC9,0x07BC0937,0x006107E0,0xFD4BFBD1,0xF457F9DA,0xF836F2C0,
-0xFA7FFB38,0xF892FAE5,0x044FFDB4,0x075807B5,0xF8C5004B,0xF894F471,0xEFCAF779,0xFB26F4DF,
-0x05F8FC14,0x000B0ACE,0xFDDFF80E,0x030E0247,0x106A0BD1,0x02320A3B,0xFD51FEF7,0xF8EEFB01,
-0x0033FD70,0x09DA0424,0x042306C5,0x0AD6067E,0x01CD05A5,0x07E205FE,0x004F047E,0x02DAFF28,
-0x091E0758,0x0B040C4F,0x0D7A0D23,0x008206F4,0x0094FF5C,0x00D9FF23,0x0C2C0A22,0x0B1408FB,
-0x0D420CB1,0x056C0A40,0x05010441,0xFBA9002A,0x02F9FE37,0x003501FE,0xFFB10194,0xF99FFA4E,
-0xF661FA6B,0x0169F96C,0x02EB0375,0xFCF00329,0xFC3EF901,0xF6B4FB65,0x000CFB3C,0xFD5EFE7B,
-0xFB07FC1F,0x0249FFF3,0xFE7BFFDC,0xF3E1F91F,0xFB6BF6F4,0xFDCAFC93,0x02A6021D,0xFA88FE18,
-0xF4D4F850,0xF493F3A2,0xFDE9F893,0xF930FAD6,0xFC75FC03,0xFC98FAD8,0xFB1AFD40,0x04E1012A,
-0xFBDF00CE,0x009CFBDC,0xFA09FE2A,0xF7A4FA10,0xF82EF884,0xFB1AF80B,0xF985F879,0x00E4FE62,
-0x00DA0311,0xFCE7FE77,0xFFC3FD13,0xFC77FEA9,0x0212FD8A,0xFD18004B,0x017000A1,0x021C00C5,
-0xFDD1FF3D,0x0045FEA1,0xFAC5FE69,0x0238FF56,0x00DF0215,0xFCDEFE66,0xFE15FE40,0xFD9CFC8F,
-0xFDC5FF70,0x016FFF87,0x028A02AB,0xFD05FFD4,0xFB6DFC18,0xF8D0F906,0xFE26FC2D,0x0223FE8B,
-0xFD7A008C,0xFD6FFD91,0xF7B0FA2B,0xF4B4F574,0xF75BF657,0xFD4CFAC5,0xFA67FC78,0xF9E8F9AB,
-0xF9D8FAAF,0xF9D6F9D2,0xFD14FB7D,0xF7F0FA4B,0xF7C7F761,0xFD83FCA5,0xFBACFB3B,0xFA10FBF4,
-0xF744F6EE,0xFB17FA4B,0xF9E2FA96,0xFA94F9F0,0xFD1FFAB4,0xFD54FD92,0xFDB0FD8F,0xFC90FC43,
-0xFCCBFDE7,0xFD9EFC07,0xFB97FD27,0xFE49FCA9,0xFECDFFF1,0x034001C3,0xFECF000B,0x01B2019D,
-0x00C1FFFD,0x022101B4,0x00E202AB,0x045D0252,0x019901F9,0x053C036F,0x041204BE,0x068C04F0,
-0x051B05EA,0x04FF04DC,0x02F90464,0x019001BB,0xFED100D7,0xFE56FDCD,0x01C6001B,0xFFBA00D0,
-0x00DC007F,0x00BA00F2,0x001F0119,0x004AFF21,0xFF7A0075,0x007AFECB,0x01140183,0xFD32FF9A,
-0xFC88FCB3,0xFA26FAD3,0xFA62FAE8,0xFC62FA91,0xFE4EFE02,0xFC2FFD34,0xFB93FB42,0xFC90FD32,
-0xFE32FC99,0xFCB6FE58,0xFB80FC1C,0xFBDFFAE5,0xFDDCFD6D,0xFE56FE75,0xFE4BFDD7,0xFF1BFED6,
-0x00E1FFAA,0x01AE022E,0x01440082,0x0199012C,0x03B902A3,0x03BF0417,0x03370380,0x033703DE,
-0x04370230,0x03FF0574,0x03CF03A6,0x0265034B,0x049E03E0,0x078B05E2,0x056E06E8,0x03CB05D0,
-0x038602EB,0x05150350,0x025E03F8,0x037E0359,0x065E0467,0x036A05A2,0x02CE02B5,0x02460215,
-0x00250107,0x00EE0086,0x0058009E,0x01FA01A4,0xFE18007A,0xFF25FD9E,0xFB9BFE81,0xFDC8FC36,
-0xFC3CFDE1,0xF8ABF9E2,0xF8A6F7AF,0xF8C5F93E,0xFC66FA54,0xFB2DFC5F,0xFA07FA9C,0xFA13F90A,
-0xFDBCFC94,0xFDF7FDAC,0xFCF2FD3E,0xFD5CFDD8,0xFC2DFCA9,0xF894F9A7,0xFAEEFA58,0xF914F949,
-0xFEACFC0A,0xFB9EFD27,0xFC89FC36,0xFC71FC92,0xFF5DFD92,0x01A30103,0xFFAC00C4,0xFFB7FEE8,
-0x01080117,0x00960047,0x02C90154,0x027F0345,0x0305030D,0x00820174,0x01B300C5,0xFFCC011F,
-0x01CC0072,0x03C403CA,0x02DC0216,0x01BF02E1,0x016A021D,0x01DB00F9,0x031F02AE,0x016B0284,
-0xFF3CFFF1,0xFE75FE08,0xFEFBFF97,0x00DBFF93,0xFE48FFB6,0x002FFEA7,0xFEF7FFAB,0xFDD0FEFB,
-0xFDADFD8D,0xFE11FE41,0xFD5DFE08,0xFB82FC8A,0xFB61FABF,0xFC5EFC4E,0xFD26FC89,0xFCA6FC5F,
-0xFB39FC5C,0xFE95FC0C,0xFFB5FF9D,0xFCCDFF4F,0xFCF6FBE1,0xFE4AFE01,0xFB66FD09,0xFAF6FA54,
-0xF96CFAE2,0xFD56FB45,0xFE74FE69,0xFBACFCBD,0xFB77FB77,0xFDFEFC88,0x00D50003,0x03090201,
-0xFF0F0166,0xFD4AFD7B,0x0048FE63,0x031B0206,0x0175025C,0x02C80153,0x0297037A,0x012F01EF,
-0x00D90030,0x00DB0190,0x04040260,0x03DF03B2,0x016102E1,0x01D90154,0x01DA0111,0x053B04A3,
-0x05A60539,0x01C40452,0x02070223,0x02B900FE,0x01290308,0x024301FA,0x013501BD,0x02A20177,
-0x00E301B1,0x02AC0191,0x01D50318,0x038F0223,0x00D0017E,0x014801A9,0x003300C5,0xFFBEFF72,
-0xFF08001B,0xFF9DFE48,0x00D0004E,0xFDD8FF8B,0xFEA6FE68,0xFE78FDF0,0x00B00065,0x00D9002A,
-0xFED40026,0xFECAFF06,0x01E00044,0x00230105,0x01A000E5,0x019201AA,0x00DB016B,0xFFF9FFFE,
-0xFF30FFD7,0x0263007F,0x032502B5,0x02110358,0x00FD0101,0x0224012F,0x03DC033D,0x02AE03DE,
-0x02750231,0x04AB03B7,0x03BC03BF,0x02DC0372,0x02E80320,0x03130270,0x02C902F3,0x020002BB,
-0x01DD0226,0x01F501CF,0x012601DF,0x01C20129,0x002501C7,0xFF70FFA3,0x0047FF7F,0xFE26FF5D,
-0x0131FF9D,0x00BE00C8,0x00FD00D5,0x00540124,0xFF6EFF8F,0xFD78FDE8,0xFCBCFD5F,0xFC09FC4C,
-0xFCB3FC26,0xFC52FC70,0xFE1AFDE0,0xFDEDFDED,0xFD33FD78,0xFF8BFDFC,0xFD9DFF26,0xFF41FDA6,
-0x004200AF,0xFE31FEA4,0xFDE7FE1E,0xFED0FE82,0xFDACFDB0,0xFDDFFDC2,0xFF35FF58,0xFEF6FE97,
-0xFEB4FEB7,0xFE7DFEA9,0xFE6EFE5C,0xFFEDFF3D,0x014000B1,0xFF8900D4,0xFFDAFF30,0xFFD5FFA1,
-0x02A001CB,0x00EF01A8,0x029301B4,0x00D301FA,0x01CE013A,0x00E30180,0x020F018A,0x0134017F,
-0x0123015B,0x00350009,0x01BD0139,0x016001BF,0x023F019D,0x014001BD,0x002B0081,0xFFD70066,
-0x004CFFEA,0x0056004D,0x00E0003D,0x0013016C,0x00B9FFC0,0xFFD10098,0xFE90FF36,0x00B3FF3A,
-0x02DF01A1,0x016802D2,0xFFF00063,0xFFF8FFD5,0x006B005E,0x014A0066,0xFFCA0068,0x024A0183,
-0x00090180,0x00EBFFF8,0x010D0135,0x00FD008F,0x018D013A,0x021C0231,0x006600FA,0x02860197,
-0x020C0259,0x03C602CE,0x039103B8,0x021202C1,0x02EB0233,0x038802F7,0x0459045D,0x042503EF,
-0x02F603A6,0x01AE0222,0x03240243,0x00E3024B,0x027F012D,0x01B202A9,0x01270171,0x0282019C,
-0x00980203,0x01810068,0x031A02F9,0x00D60189,0x00E4019C,0x00A80063,0x00E500AA,0x01BB0153,
-0x017301D9,0x002000E3,0x01CB006D,0x0101023E,0x0067FFB1,0x0116016A,0xFF53FFD9,0xFF20FF48,
-0xFFBBFF3A,0xFFBFFF8E,0x01F60141,0x01CC01E0,0xFFF90178,0x00C2FFE8,0x005E009E,0x0072001C,
-0x012600F7,0x01BE01D6,0x00080089,0x00DD00B7,0x01A000DA,0x0146016D,0x01700173,0x027E01A9,
-0x010D022B,0x015F00F8,0x023A01C8,0x02C20305,0x021301E7,0x01BC020F,0x01CF01DB,0x01EE01D9,
-0x01E501A8,0x00F801CC,0x007000B7,0x018200F8,0x0212020C,0x018B012E,0x03E8035E,0x02E6036A,
-0x01DC0217,0x01280192,0x022A01F2,0x023D01B5,0x0263027E,0x013801EF,0x000E00BA,0xFFC0FFDD,
-0xFF68FF94,0xFFB7FF07,0x00F900C0,0x009300F2,0xFFCEFFEC,0x00C70044,0x02450192,0x020D0243,
-0x014901AB,0x00B700FD,0xFEA9FF2D,0x0066FFB5,0x00DE00D6,0x0069010E,0x00900057,0x00E500BC,
-0x00D00121,0x01A000BC,0x02B5028A,0x028E0254,0x01E402C9,0x00B90107,0x0039002C,0x00560065,
-0x01090092,0x00B100E0,0x00F700F0,0xFFEF0082,0x007A0056,0x01590090,0x02740225,0x02600245,
-0x010E0251,0x003B0016,0x02000100,0x0280025A,0x01420245,0x011600D7,0x00A000D2,0x017D00C6,
-0x02C60263,0x00F901DC,0x0202018A,0x002E01B9,0xFFC3FEAB,0x00300070,0x01AA008C,0x01B90200,
-0x019901B2,0xFF08FFDB,0x01140000,0x01120146,0xFFF9009A,0xFFCAFFD8,0xFF90FFBC,0x00C4FFE7,
-0xFFD900E2,0xFFD3FF49,0xFF49FFB9,0xFF22FEE5,0xFF0BFFB1,0xFEA6FE40,0xFEEDFEDD,0xFFECFF86,
-0x00470021,0xFF0BFFE8,0xFDF1FE11,0xFE0EFE1E,0x0012FECC,0xFECEFFED,0xFE00FE36,0xFDADFD88,
-0xFE79FE16,0xFF5FFF15,0xFFD9FFA0,0xFF0FFF7B,0xFEBCFF1C,0xFE56FE5A,0xFFBBFEF0,0x00150022,
-0x0054002B,0x004F0091,0xFE77FF3F,0xFFFEFF10,0xFF5A0028,0xFFFCFF63,0xFF9EFFC7,0xFF24FF6E,
-0xFF4CFF0F,0xFFEB0016,0xFF17FF5A,0x00C90002,0xFFC0004D,0xFFAAFFCB,0xFFE1FF8B,0x00980015,
-0x00CF0096,0x010D019A,0xFEB3FF7D,0xFFDFFF1C,0xFFE60099,0xFEFDFED2,0x00760002,0xFF5FFFF5,
-0xFEDBFF0B,0xFE23FEAE,0xFE5BFDDC,0xFED4FEB7,0xFE2DFEC3,0xFD9BFD5D,0xFD86FE0A,0xFD45FD2C,
-0xFE42FDA8,0xFEA5FEB2,0xFD50FDFB,0xFDDAFD5E,0xFDA3FDEA,0xFEC1FE68,0xFDD5FE7A,0xFD27FD09,
-0xFD53FD74,0xFD63FDA1,0xFDA9FD1C,0xFDE0FDC2,0xFF02FE78,0xFF1CFF2B,0xFEDBFEFB,0xFE4FFE87,
-0xFEF6FE8E,0xFFD9FF33,0xFFCB002A,0xFF5CFF7E,0xFF8EFF62,0xFF62FF1C,0xFFCBFFB3,0xFFE3FFB1,
-0x006F0051,0x016000C9,0x01660184,0x009F0185,0x01980065,0x018A01A1,0x02980237,0x01DC0223,
-0x01690197,0x013A0171,0x01D80159,0x020E021A,0x00A70165,0x00C100D1,0x010500BD,0x021601C8,
-0x00B00191,0x01D50112,0x00610172,0x0090004B,0x013500E0,0x002200A4,0x0028002B,0x014F0085,
-0xFF6E00A1,0xFF97FF27,0xFEB2FF6A,0xFEB2FE5E,0xFED4FF4C,0xFDEFFDC9,0xFE1EFE39,0xFD8CFDC0,
-0xFE0CFD61,0xFE7EFE92,0xFDEBFE16,0xFE0FFDD2,0xFDC3FE03,0xFE85FDEB,0xFE51FEA3,0xFE88FE6E,
-0xFF55FF0A,0xFF39FF3A,0xFFE1FF9A,0xFFF8FFEC,0x00890066,0x00A800E6,0x00840090,0xFFEE0008,
-0x00B70070,0x01670145,0xFFF200D2,0x0004FF9E,0xFF6AFFBE,0xFFD8FF90,0xFFDFFFF0,0xFF1CFF39,
-0x01050018,0x007100F5,0x00150030,0xFFEA0012,0xFFE5FFC8,0x010D0074,0x005C00E1,0xFF5FFFDE,
-0x004CFFAB,0xFF620001,0xFFBEFF55,0xFE4DFF82,0xFD5DFD73,0xFD93FD61,0xFE2EFD96,0xFE59FE7B,
-0xFDE9FE39,0xFCE3FD4D,0xFDCBFD27,0xFDE0FE48,0xFCEFFD36,0xFD68FD5B,0xFD1FFCF4,0xFDE3FD9B,
-0xFD06FD98,0xFD09FD0C,0xFCB4FC90,0xFC9EFCC7,0xFDC8FD48,0xFD42FD8A,0xFCBFFCC2,0xFD98FD12,
-0xFDB8FDFA,0xFDD8FDB4,0xFD1FFD92,0xFCCCFC45,0xFD42FD74,0xFEECFDA2,0xFE3AFF70,0xFFC1FDF9,
-0x00720092,0x00260078,0x0028FFED,0xFFFB0021,0x014C0023,0x009E01C0,0x016E0095,0x004A018C,
-0x01570023,0x010B01D3,0x00840122,0x0088007E,0xFF6D0076,0x023D00B6,0x01A60239,0xFE5DFF71,
-0xFC24FDBE,0x005EFCB3,0x01280199,0xFE2FFFCC,0xFC23FC12,0xFF10FE44,0xFFC7FFFE,0xFE0DFF59,
-0xFD49FD8D,0xFEBAFD50,0xFEC9FFC8,0xFDE7FD05,0xFF63FECC,0x0014FF43,0x003F0023,0xFDC0FF31,
-0xFDE0FD84,0xFE6DFE72,0xFFB8FF1D,0xFD94FF19,0xFCC6FC85,0xFF9BFE62,0xFE8CFF46,0x0005FEF6,
-0xFEE6FF13,0x00A900AF,0x0244005D,0x011D02C4,0x033C01C0,0x020502E2,0x013D0288,0xFECBFEE6,
-0xFEFCFF27,0x024700C5,0x0252027C,0xFE77009F,0x0023FE5F,0x0293014D,0x028102CC,0x02B502B7,
-0xFF73008E,0xFEEFFFA2,0x01DE0015,0x00C601B3,0x00BB0181,0x0050FFD6,0x001300AA,0xFF79FFCD,
-0xFF3EFEAD,0x015000AD,0x01D7015D,0x00CB0178,0x00080037,0xFF33FFE6,0xFE6DFE76,0xFF16FED8,
-0xFEEEFF33,0x0067FFC9,0xFE95FF96,0xFF47FEA8,0xFF08FF03,0xFF4AFF35,0xFF6BFF3E,0xFE32FECB,
-0xFE76FE4E,0xFE69FE99,0xFEC0FE9A,0xFE84FEC7,0xFFEBFF27,0xFFA50001,0xFEE3FEFA,0x013AFFF3,
-0x01B001AD,0x004900FA,0x00A50083,0xFF940033,0x0064FFB2,0x006C00C9,0x00A60088,0xFF2C004F,
-0x0075FF63,0x006F00C8,0xFFC2FFE7,0x00AD0041,0x023B0168,0x01A40206,0x01310142,0x00CC0125,
-0x009A0097,0x0161010E,0x00C30105,0x008500AE,0xFFA20026,0xFEBBFF15,0xFFBCFED8,0x00C700BE,
-0xFF580029,0xFFC3FF3A,0x00C10072,0x00C100BF,0x002200D5,0xFF8FFF42,0x00BB0035,0x000000D8,
-0xFF23FF3E,0xFEFAFF17,0xFECCFEBD,0xFF52FF16,0xFEA8FF41,0xFE95FE30,0xFF93FF1C,0xFF30FFB6,
-0xFFCDFF37,0xFFDBFFC7,0xFFDDFFE2,0x0015FFB6,0xFFCEFFD9,0xFF93FFEC,0xFF7CFF56,0xFF68FFBA,
-0xFF55FF2F,0xFF1BFF27,0xFEC9FF1B,0xFEACFE6D,0xFF80FF31,0xFEBAFEEC,0x0020FF8A,0xFF7FFFAB,
-0x0026FFF6,0x00360024,0x0048003D,0xFED8FF7D,0xFEB0FE79,0xFF89FF79,0xFF46FF1C,0x000FFFF5,
-0xFE3CFF47,0xFE7CFE23,0xFEFDFEDB,0xFFECFF13,0x0026006A,0xFFCBFFCA,0x001A0014,0xFF3AFF6C,
-0x0010FFA3,0xFFAFFFF9,0x003EFFD4,0x003B0076,0x0027001E,0x00320019,0xFFB8FFFB,0xFFDFFFAC,
-0x0047003F,0xFFCF000D,0x00890001,0x007A00AF,0x00BB008C,0x01490112,0x01190172,0x019B00F8,
-0x018B0183,0x013F019C,0x010B010F,0x010A011C,0x011500E7,0x006E00C9,0x011500B9,0x00E10148,
-0x0116007B,0x014701C5,0xFFA1FFF6,0x004DFFFB,0x00850077,0x018E0120,0x00CB0157,0x00620046,
-0x01220102,0x01030112,0x01660151,0x0111015A,0x011300B4,0x012D0160,0x01EC0160,0x01A701AC,
-0x00FD0194,0x00CE00A8,0x00EF00E3,0x00F300D7,0x01640156,0x01600158,0x0168015D,0x016F0174,
-0x01850178,0x01E401EF,0x012E0166,0x01470160,0x01760153,0x01920155,0x016D01B6,0x015A015B,
-0x013F0116,0x0140015C,0x012C0122,0x00DC0135,0x007E0093,0x00AD00C4,0x0073004D,0x00290098,
-0xFFE2FFC5,0xFF61FF89,0xFF8AFF89,0xFFCFFFBC,0xFF0BFF88,0xFF6FFF4F,0xFE88FF12,0xFEC8FE6A,
-0xFF96FF13,0xFEE8FFB7,0xFEFCFE9F,0xFE95FEFC,0xFED1FECB,0xFF65FF33,0xFEBAFEFD,0xFE5BFE61,
-0xFEE1FEE1,0xFF09FEBE,0xFF14FF0F,0xFE9FFEF1,0xFEAAFEDB,0xFED5FEB0,0xFF42FF11,0xFF75FF5D,
-0xFEDEFF22,0xFF44FECD,0x0029FFB1,0x0054004E,0x004A0054,0x000F002D,0xFF88FFC4,0x0012FFA9,
-0x007E006C,0x004E008B,0x008D0045,0x00440063,0x0027001F,0x00680059,0x009000A1,0xFFEE0032,
-0xFFD2FFBD,0xFFCBFFC1,0xFF26FF7B,0xFF3FFF16,0xFEF8FF0A,0xFF7CFF32,0xFED9FF63,0xFE86FE88,
-0xFE89FE91,0xFEF2FEC3,0xFEE8FEE7,0xFEF8FF14,0xFEDEFECE,0xFED3FED4,0xFE48FE80,0xFDF5FDDF,
-0xFED9FE79,0xFEF6FEF6,0xFE4BFEE3,0xFD94FDDF,0xFE3DFDD1,0xFEFEFECD,0xFF29FF2E,0xFEE5FEB7,
-0xFF45FF4A,0xFFB0FF77,0xFF3EFF94,0xFF60FF2E,0xFFDCFFDA,0xFFD6FFB8,0xFFCCFFF3,0xFF54FF63,
-0xFFEFFF73,0x00AB0042,0x00AF00A8,0x00CC00E3,0x00B500BB,0x012000F3,0x01C401AB,0x0176019D,
-0x01750146,0x01DA01DB,0x01220170,0x01800144,0x016A017F,0x00FF013E,0x017C0139,0x015E0157,
-0x01BC019D,0x01D501B9,0x012501A3,0x012700ED,0x01BF01AE,0x00DC0134,0x01340112,0x008F00DE,
-0x00750050,0x007E00AB,0x0056005C,0x00290055,0x008A0047,0x007C0070,0x0060008A,0x00410024,
-0x00710048,0x001D0049,0x00B3006A,0x00DB009F,0x007200DF,0x006A0033,0x011500F0,0x012E0116,
-0x013D0146,0x00EC0122,0x019000E1,0x01FB01DC,0x0226020B,0x026E027D,0x01EB022A,0x02C70255,
-0x028902C0,0x02D10292,0x027902C1,0x02AA0275,0x0282029A,0x01BB0242,0x016B017A,0x01E8016E,
-0x02730262,0x0206024E,0x0118014E,0x01510122,0x014A015C,0x018E015F,0x00F50158,0x010500D9,
-0x00CE0106,0x005D004B,0x013700CF,0x0121013B,0x007D00CF,0xFFEC0045,0xFF59FF8F,0xFF72FF4C,
-0xFF89FF9F,0xFF34FF68,0xFF5AFF37,0xFEC7FEF0,0xFEF7FEF8,0xFF2CFF2C,0xFEC9FF02,0xFE63FE65,
-0xFEA2FE9E,0xFEA1FEA3,0xFEC0FE90,0xFF37FF20,0xFEFAFEE6,0xFF73FF46,0xFF1CFF42,0xFF4DFF16,
-0xFF85FF5F,0x0010FFD6,0x0094003D,0x002600A8,0xFF71FFCA,0xFFC6FF59,0xFFF50017,0x0041FFEF,
-0x00670089,0xFFF10014,0x0009FFB5,0x009A0076,0x00730096,0x00460064,0x0060005B,0x007C0064,
-0x006100AA,0x00320028,0x0018004A,0xFFB9FFC4,0xFFBDFFBE,0xFF6DFF98,0xFF63FF3C,0xFFC4FFC3,
-0xFF6CFF97,0xFF22FF2A,0xFEE4FF13,0xFED2FEEE,0xFEE9FECC,0xFE56FEB6,0xFE05FDFB,0xFE2AFDFC,
-0xFE20FE56,0xFE7CFE52,0xFEC4FE8E,0xFE97FECE,0xFEE8FEA3,0xFED2FEEA,0xFEFEFEC9,0xFF22FF1E,
-0xFF50FF47,0xFF71FF52,0xFF98FF9E,0xFF59FF64,0xFED4FF23,0xFF3DFF25,0xFF93FF6A,0xFEE8FF43,
-0xFF3AFEF5,0xFFC1FF9A,0x0028FFCD,0xFFDCFFEE,0xFFEBFFFD,0x003AFFCB,0x00770075,0x004E0048,
-0x007B006F,0x00B800B2,0x00C000BC,0x010300C9,0x00FC00FC,0x00D800E9,0x011500D5,0x01150136,
-0x00A300DF,0x00B600D9,0x00E400A9,0x009800F2,0x0094008A,0x00C000C3,0x007200B3,0x00510063,
-0x0005002C,0x00AB0064,0x008800B8,0xFFA40024,0x0030FFD1,0x00590074,0x007D0055,0x00BE00A0,
-0x005400AF,0xFFDCFFF1,0xFFEEFFF2,0xFFD2FFD1,0xFF74FF8B,0xFFE4FFBD,0xFF7DFFC5,0xFFC1FF9C,
-0x0008FFEF,0xFFC9FFD3,0xFFC1FFDF,0x004CFFEE,0x0004000E,0xFFFC0006,0x0015FFDE,0x004A0042,
-0x00850079,0x00320052,0x006F003B,0x00F400B9,0x001A00B0,0x00740025,0x004B0081,0xFFFF0031,
-0x006E003D,0xFFC1FFED,0x001EFFF6,0xFFB3FFE1,0xFF4EFF88,0xFF68FF4F,0xFF09FF5F,0xFF29FEFC,
-0x0028FF77,0x0017004A,0x00090006,0xFF77FFD2,0x000BFFAF,0x0036005F,0xFFF3FFC9,0xFFC40012,
-0xFDEAFF51,0xFA85FBA3,0x0106FC80,0x07060520,0x01910527,0xFE54FF37,0xFB72FCCC,0xFF24FC05,
-0x03EB02E7,0x02A402FB,0x01A60270,0xFFF700C4,0xFEC8FF1C,0xFEC3FEE6,0x0008FF28,0x00E50075,
-0x0370028B,0xFE6901B2,0xFCC6FC7B,0xFFFBFEC8,0xFF6EFFC3,0xFEF0FF62,0xFDFBFE9C,0xFDC4FD5C,
-0x03E20066,0x04530580,0xFD8B0094,0xFD71FCD8,0xFD26FD97,0xFECFFD5F,0x023C0092,0x02C80336,
-0xFF8B013A,0xFD4FFE08,0xFE95FDD2,0x000FFF51,0xFF92FFF7,0x0007FFB1,0xFFE90039,0xFEF5FF4E,
-0xFF5DFEEE,0xFF6EFFB8,0xFE98FEC6,0xFF37FEB9,0xFFE4FFB2,0x0012FFC8,0x01140072,0x00E3018E,
-0xFF98FFB6,0x00250042,0xFE47FF32,0xFEF9FE50,0x0112FFFF,0x01020186,0xFFC80012,0xFFA7FFBC,
-0xFF89FF7E,0xFF82FFAC,0xFF88FF31,0x003D000F,0xFF75FFDD,0xFF14FF02,0xFE9EFEFF,0xFF16FE96,
-0x0025FFAF,0xFEB9FFC2,0xFDD7FE03,0xFEBBFE12,0xFFAFFF79,0xFF44FF91,0xFEAFFED8,0xFFDFFF38,
-0xFF42FFAD,0xFF53FF21,0xFFBEFF95,0xFEDEFF5D,0xFE9EFE87,0xFEDDFEE0,0xFEA2FEE1,0xFF47FECA,
-0x0200005A,0x010C0216,0xFF97FFE6,0xFF8CFF9A,0xFE9AFF02,0xFF16FEA1,0x00A5FFD2,0x01840155,
-0x01D001D2,0x005700C3,0xFEE2FF8B,0x0045FF98,0xFE45FEBF,0x00F2FF4E,0x0371039C,0xFEC3FF49,
-0x00A401DE,0xFEE4FE33,0xFD56FE26,0x0178FF08,0xFFFEFFA0,0xFFA30126,0x00C8FDF3,0xFE930203,
-0x016CFE12,0x00E90398,0xFC98FC51,0x019BFF9D,0xFE600152,0x0004FD65,0x003100F0,0xFEB3FF3E,
-0xFD310023,0xFEFCFC57,0xFD9CFF94,0xFE64FDA9,0xFE78FCDD,0xFE5600E1,0x02E0FE19,0xFC63FF5D,
-0x01460019,0xFFB8FF18,0xFE850081,0xFECFFEFE,0xFE3EFD34,0xFF9B0050,0x019EFF3C,0xFF4B0158,
-0x0113FF3B,0xFF2400DD,0x00B3FEC6,0xFD37FF6F,0x00DC00B7,0xFF6CFEB6,0x02170227,0x00D40121,
-0x02EF01CE,0x004A00A8,0x0064013C,0x0023FF1D,0xFDBCFFE9,0x039100AA,0x006101D5,0x007E00C3,
-0x012BFFFB,0xFFFE0184,0xFE8AFEF5,0xFFB6FEB1,0x010400FE,0xFED7FF12,0xFF5EFF47,0xFEB7FFB5,
-0x002DFF09,0x005500A4,0x000600B4,0xFE26FE62,0xFF4EFF54,0xFFAAFE71,0xFEE80036,0xFE28FDB7,
-0xFF9AFFA9,0x0002FFB9,0xFDE1FEED,0xFEBCFEB4,0x0020FF28,0xFFD4FFB2,0x0048FFE8,0x0004009C,
-0xFEAFFE69,0x00B80079,0x008B0034,0xFE82FFA4,0x00FAFF94,0x01370162,0xFF5C001E,0x016EFFD8,
-0xFFE70178,0x018FFF88,0x008F01FC,0x018C0092,0x008E0145,0x02B801B5,0x0043016C,0x0173012F,
-0x01150110,0x006600B5,0x02180199,0x001F00CF,0x020B00E4,0x009B01AF,0x0101005F,0x01520168,
-0x0036011B,0x01150019,0x002300F7,0x0006000F,0x0030FFB1,0x005B00ED,0xFEDEFF14,0x001DFFAC,
-0x00330014,0x0019009A,0x0015FFBD,0xFFBD0004,0xFF39FFB2,0xFFC5FEE8,0xFFD5008C,0xFF81FF4C,
-0xFF16FF12,0xFFB4FF80,0xFF9AFF8C,0xFFA4FFE9,0x004AFFA2,0xFF5D0043,0xFFE0FFA1,0xFF49FF6D,
-0xFF8CFF62,0x0061FFF6,0xFF8D000D,0x0062FF85,0x001F0049,0x01A50139,0x005F0091,0x008800DB,
-0x007E0018,0x009300D0,0x016800E0,0x007400D4,0x00E100EF,0x00D80053,0x00CD0160,0x002BFFF0,
-0x01620117,0x01230150,0x0054007B,0x00BC00F0,0xFF69FF93,0x0070005F,0x004A006F,0xFF23FF9C,
-0x0043FF66,0x008400C5,0x00B400CB,0x005A002A,0xFF6D0057,0x003AFF3C,0x002F0081,0xFEF4FF86,
-0x0042FF41,0xFF55FFDA,0xFFD8FFC5,0xFF5AFF9C,0xFF61FF6E,0xFF11FEDF,0x002FFFE9,0x00030043,
-0x003CFFD9,0x00580061,0xFF6BFFCC,0xFF78FF6D,0xFFE9FF8C,0x0031002A,0x002D001D,0x00230052,
-0xFFE5FFC8,0x00970053,0x00CD00E0,0x008000B9,0x00B200BD,0x00BE00D3,0x0069008B,0x006E0050,
-0x00BF0085,0x011F00DC,0x004800EC,0x0017FFFD,0xFFFA000F,0x008D003B,0x00830083,0x008100BE,
-0xFFD1FFCE,0x00300033,0xFFFD003E,0xFF91FF7F,0x0032FFE4,0x001F0031,0xFFDAFFDC,0xFFC0FFEC,
-0x00A20004,0x00B100B5,0x003B007B,0x00660035,0xFFF1006B,0xFFB7FF86,0xFFDCFFF3,0x0011002F,
-0xFFE1FFD4,0xFFABFFCC,0x0029FFC5,0x005B0084,0x00D70068,0x00F900F4,0x00BA00B6,0x00B900CE,
-0x00F200EF,0x00EE00D6,0x0177014C,0x018601B8,0x01DA0177,0x014601AD,0x0154012A,0x012A0152,
-0x01960119,0x018601F3,0x01570141,0x01590169,0x016F0168,0x0145015F,0x00CE0119,0x008A00B5,
-0x00490061,0xFFEBFFB4,0xFFA3FFBC,0x01D40042,0x003D0219,0xFEC8FEEE,0x027F00ED,0xFD6E0034,
-0x0020FEB7,0xFFC9FF56,0xFFBDFFC1,0x0167FFE8,0xFE830045,0xFF14FFD7,0xFD1CFC30,0xFEC700A9,
-0xFE30FC35,0x03FB02E0,0xFBE9FE2E,0x01F5FF8B,0xFFD30224,0xFD25FC67,0x01A800D3,0xFF62015F,
-0xFF37FFF8,0xFFDCFCC4,0x010D0253,0xFF7AFEF6,0xFE02FE48,0x011B0118,0x0363FEE8,0xFF800444,
-0x03200057,0x004702DC,0xFF410067,0x006AFF90,0xFF9B005A,0x01B60044,0x02540170,0xFFD6023E,
-0x0124FE3C,0x01D903A3,0x01510032,0xFF8102C6,0x0127FEFD,0x005200C6,0x00C60066,0x019000B5,
-0x01BB00AC,0xFFDC0122,0xFF7400DB,0xFDC1FD42,0xFD3AFE96,0x0093FD3D,0x007701DD,0xFFC1FE18,
-0xFE8900B6,0xFE2AFE03,0xFDB7FD83,0xFE02FDD5,0x000FFE66,0xFCCBFEFF,0xFDC2FDCC,0xFDF7FE0C,
-0xFF1BFDDD,0xFEACFF52,0xFF69FE87,0xFE1CFEE2,0xFEEDFDFA,0xFD99FE73,0xFF1BFEA8,0xFD5CFE01,
-0xFF87FEBF,0xFF23FF2B,0xFEE6FE73,0xFEB3FF27,0xFF3FFE90,0xFF87FF98,0xFFB4FF0E,0x006C00F4,
-0xFEA7FF48,0x0001FF67,0xFF70FF4F,0xFEF1FF9F,0x0153FF72,0x018D0203,0xFF110083,0x00A3FF4F,
-0x01B101B2,0x00E1005F,0x02830300,0xFF95FFE6,0xFF12FFCB,0x0064FEF2,0x00E3016B,0x02630162,
-0x006101FA,0xFC3FFDEB,0xFE16FCAD,0x01DBFFDB,0x00B00217,0xFF51FFDB,0xFF2DFE4F,0x006E00C9,
-0x0173FF85,0x01E802AA,0x036D02AC,0x002F01B7,0x00E80086,0x003E00F2,0xFBE3FE39,0xFD49FC21,
-0xFEB4FDFC,0xFF7DFF68,0x0015FF4F,0x021D00DE,0x003901EF,0x003FFF7D,0x00740104,0x000B000B,
-0x0090FFDA,0x00440117,0x00AA0016,0x0031007D,0x00160027,0xFF11FFC3,0xFFF1FF06,0xFFE900AB,
-0xFF41FE9E,0x01B800C7,0x014201BA,0x01950118,0x018901D7,0x01B5018E,0x0034010F,0x00F4004B,
-0x01B2018D,0x019C01BE,0x01480162,0x0017007F,0x0064006B,0x019D00E1,0x028C0230,0x00A90202,
-0x008B0036,0x00C600D8,0xFFADFFD6,0x00AE0053,0x006700A3,0x00CD006E,0x009600FD,0xFFE10002,
-0xFF4AFF5E,0x0085FFCC,0x00EC00D3,0x00A7011B,0xFF03FFD9,0xFE98FE86,0xFF7DFF22,0xFFEDFFCD,
-0x000DFFD8,0xFFA70063,0xFF11FF6C,0xFF00FEC7,0xFF12FE74,0x024A004F,0x000501B0,0x008AFFE8,
-0x03BE0322,0xFDB1FE82,0xFFEB00AD,0x0040FE2A,0xFCA2FF33,0x03FA0117,0xFD59FF28,0x012B037B,
-0xFF60FB8B,0xFE62023B,0x0047FAE7,0x05030761,0xFF18FE16,0x02CC023D,0x003802C3,0xFF7FFD29,
-0x0295017E,0x00F902C6,0xFDADFF2D,0x0095FEAE,0xFDB7FF96,0xFCFAFCA6,0xFEF2FC35,0x00CD01C9,
-0x02D6FF00,0xFFDF02A8,0x01BA002B,0xFFFF009C,0x00BE00BC,0xFDE4005E,0xFCB0FC06,0xFCB5FE2B,
-0x008AFD00,0xFDFD00CE,0xFFDBFD87,0xFE0DFFD5,0xFFB8FD0F,0xFCBEFFB6,0x01EB0076,0xFF1B006B,
-0xFF22FF39,0xFCAFFE0E,0xFEA7FDDD,0xFEBDFE33,0xFED00045,0xFEBEFD3B,0xFE3C00C8,0x03F0FEFA,
-0xFEB7025E,0x0103FF7F,0xFFD6FF58,0x027A036E,0xFF0BFEDF,0x008800BC,0x00CA00C5,0xFFD5FF62,
-0x00A200EF,0xFF85004D,0x02B300BB,0x025902F9,0x02A80426,0xFE36FEAB,0xFE17FEC4,0xFE88FD6E,
-0x024CFF4E,0x01260448,0x036F0170,0xFFC30087,0xFFAA0062,0xFAF5FCBD,0x010FFE63,0x012900F5,
-0x00EC0120,0x0151012F,0xFA8DFE53,0x0162FD0F,0x00EE00DE,0xFE920069,0x0126FD0F,0xFE0D0156,
-0xFBBEFBE6,0xFF4BFD3B,0xFFCB0154,0x02AFFF6A,0xFDBA02C0,0xFEA2FD41,0xFCFBFCF8,0x010B00AE,
-0xFE85FE2A,0x022001B9,0x0030FF76,0xFF08FED8,0xFE8CFFE4,0xFD7CFDF5,0x01F0FFE8,0xFE97004E,
-0x0199FF7D,0xFF9500DA,0xFFC3FFD6,0x028B0129,0x04510452,0x009D01F7,0x01560002,0x01530330,
-0xFEDFFE8C,0x01010077,0xFF350062,0x00B1FFED,0x0026006A,0x0139010D,0x011F0130,0xFF20FF6A,
-0x004E0058,0x01CF0098,0xFFAE014C,0x0018FFCB,0x00B2FFE5,0xFFB300EE,0x00FCFEC0,0xFC8500DC,
-0xFE5EFCAB,0x0269001B,0x0078017A,0xFF4BFFDA,0xFF61FFA8,0xFFC5FEF1,0xFF21FF07,0x012B00E6,
-0xFE5BFEE1,0xFF37FF94,0x015F0012,0x005501B4,0x0030007F,0xFEF0FF96,0x01CB0051,0xFF7200ED,
-0xFE27FC8D,0xFEFF005D,0x0097FF02,0x00BF0177,0xFBD4FF08,0x0109FD07,0xFBF7FF71,0xFE41FD4A,
-0xFFBDFFE8,0xFFA6FE62,0x08130320,0xFB6303BA,0xFE62FBEA,0xFB8EFD3B,0x0023FF94,0xF9BBFC4B,
-0x0037FCDD,0xFFCAFFC4,0x02400096,0x033A03F5,0xFD7FFE19,0x007B025F,0x00FFFF9F,0x061103D2,
-0x00C4FF8E,0x01A10514,0xFB2AFBBA,0xFCBAFDC7,0xFFDC0035,0x0022F97D,0xFF8F0478,0x0463FCCC,
-0x038208D1,0xFFC30204,0xFDA1FBC2,0xFDB900FB,0x00F6FC36,0x009301A1,0x02830281,0xFEF1FDB5,
-0x0185018A,0xFE12FF4B,0xFE400028,0x00CCFE40,0x03DF01CA,0x02EC04AE,0xFD20FE03,0xFD69FAE1,
-0xFAF5FFAC,0xFAA2FAAC,0xFC0BF951,0xFB0AFDDF,0xFD88FADF,0xFDC5FD4B,0x0071FD75,0xFCF10189,
-0xFE54FC3C,0xFF2B0122,0xFDE3FD0C,0xFC6BFD73,0x0065FF95,0xFD22FE3B,0xFBF4FCEE,0x01C8FD91,
-0x0AFC04A2,0x046F0898,0xF555FFCB,0xF724F5A1,0x0984039B,0x051B052C,0xF7430129,0xF61CF113,
-0x0763017D,0x0AE20B00,0xF4DE014D,0x07A9F9A9,0x0B590CAA,0xFF2407C2,0xF600F333,0x0A3F035B,
-0x008706BE,0x0440FD95,0xFCB602C9,0x062BFEB1,0x00770472,0x089204A6,0xF5DE02ED,0xF721F549,
-0x0495FE53,0x0B790878,0xF4B900F3,0xFD6CF659,0xFE0FFFB7,0x06760386,0xF3BDFACA,0x03BBFBD1,
-0x02F5041F,0xFE7002F4,0xF8E1F3CC,0x062D0379,0xF800FE19,0x02D6FCD4,0xFC63FFD1,0xFC07FA49,
-0x040300E8,0xFFBD035E,0xF620FAD3,0xFF49F8B6,0x037A0287,0x032E048E,0x052C0315,0x01B405F7,
-0xFA43FC15,0xFF9BFC7C,0xFA71FC91,0x0391FF43,0x06C8063B,0x0627078C,0x019A0018,0xFFA70300,
-0x052102D9,0x05180582,0xFEB00330,0xFCEBFA3A,0x03BE0334,0x0149020A,0x0110FEDC,0xFE5D00CE,
-0x07140137,0x014906AB,0x00E1026A,0xFB70FC40,0x062E0128,0x074B0493,0x05610A60,0xFFCE01F1,
-0xFDF0FE64,0xFCA0FD0E,0xFDEDFBEA,0xFD92FC34,0x06E1049B,0x049F0566,0x01580388,0xF986FD9C,
-0xFF55FA6B,0x003800BD,0x03EF020B,0x03200451,0x00F80284,0xFC74FEEE,0xFBFAFC06,0xFDE1FC6F,
-0x00FCFEF4,0x09ED065B,0x02840697,0x0468036A,0xFCD60014,0xFD4BFDAF,0xFF4BFCE9,0x0321011F,
-0x04DD0548,0xFE7E01B7,0xFB14FCB4,0xFD1CFB08,0xFDB7FD08,0x03EC021A,0x003200B8,0xFDA4FFD7,
-0xFD8AFD7C,0x0113FE65,0xFBFA008D,0xFEBFFC3F,0xFB36FC6E,0x0035FF6E,0xFB7CFCEB,0xFC6EFC8F,
-0x0046FD40,0x01EA0138,0x020B02BC,0x008200E3,0xFF18FF01,0x01E60028,0x02FB0297,0xFE8C0258,
-0xFD22FC62,0xFF35FD36,0x02C90234,0x03220255,0x0292033C,0x040A03EC,0x069E041E,0x02D806AB,
-0x02CA0217,0x019E0246,0x03760259,0x04540498,0x02D90320,0xFD8E00ED,0xFDCBFC20,0x024F0016,
-0x03110350,0x013601ED,0x01C50134,0xFFED00D5,0x03C80185,0x022E037A,0xFFBB00E4,0xFF31FFCE,
-0xFDFDFEEC,0xFA45FC9F,0xFC11FA26,0xFE1FFD15,0xFEECFF1A,0xFF51FED3,0xFCDDFE84,0xFC45FBF7,
-0xFCD3FBE6,0xFD95FDDA,0xFDA7FDCA,0xFB72FCDC,0xF8CFF9BC,0xF7D5F772,0xF899F8CC,0xFC38F9AB,
-0xFEEAFDFA,0xFF81FF92,0xFE19FF01,0xFE54FDDA,0xFEB4FF16,0x00F5FF0C,0x019F022A,0x0290020D,
-0x00F2028E,0xFD0FFDB1,0x008EFF07,0x024300EE,0x0414036F,0x071804E0,0x05C006FB,0x01AF03EB,
-0x025E01AB,0x01D70287,0x035902A2,0x03C90302,0x0426049A,0x02D40393,0x029C02E6,0x031B02BA,
-0x04B002FB,0x039E045D,0x03FC0538,0x043903EE,0x0325033C,0x02E202AB,0x02FF02E1,0xFFF401D4,
-0x03BE0224,0x00DB0159,0xFD480044,0xFFACFE1C,0x004A0007,0xFED8FF3C,0xFE68FDD9,0xFDD0FEF4,
-0xFE56FDB5,0xFE30FE93,0xFE62FEDF,0xFD54FDE3,0xFC07FBE6,0xFC54FC63,0xFBEFFBE9,0xFC58FBE4,
-0xFCE7FCE6,0xFFEAFE53,0xFF5E00D2,0xFEE0FE7B,0xFEA7FE50,0x01CE0016,0xFDEBFF67,0xFFE3FE94,
-0xFFE1007A,0xFE99FEFA,0x009BFFF9,0x01B500D0,0x01010177,0x00C50001,0x015A020B,0x00420104,
-0xFEF9FF66,0x008EFEB5,0x01330193,0x00F000D4,0x00710068,0x008D006C,0x0014004F,0x022D0173,
-0x01660214,0x00620067,0xFF92003B,0xFD5DFE3B,0xFEB8FD9C,0xFFDDFFA6,0xFFBCFFEC,0xFFD9FFEA,
-0xFFB2FF2E,0x00420025,0x000A00E0,0x0042FF90,0x016E0090,0x00EF01F7,0x013E0093,0xFF4700B6,
-0xFFDCFF24,0xFF56FFB5,0x02BA0071,0x037E03CF,0x020C0293,0x02460267,0x01210188,0x014B012B,
-0x02D101AE,0x03A3038C,0x027002DE,0x04070348,0x01810293,0x02CF0206,0x039E03A8,0x025A0333,
-0x024A027C,0x01560157,0x00C400FF,0x02360149,0x01ED02A8,0x01E6015C,0x016C01F2,0xFFE4010C,
-0xFEB0FECE,0xFE2BFE88,0xFCD4FD77,0xFED4FD18,0xFE4AFF8A,0xFCE2FD17,0xFCFDFD17,0xFC53FC9C,
-0xFD37FCAB,0xFC7AFD1E,0xFC04FC31,0xFB97FBAA,0xFD15FCA8,0xFC63FC21,0xFD65FD96,0xFD4FFD40,
-0xFDABFD66,0xFDB2FE12,0xFDB9FD05,0xFEE9FE15,0x000FFF4F,0x00D40086,0x015D01D2,0xFFE70062,
-0x02030076,0x016D022A,0x02210117,0x028F032A,0x03330231,0x03AB03F7,0x02C60301,0x033A0313,
-0x038D037D,0x040803AC,0x03ED0455,0x043903F4,0x02BE03E6,0x049902CB,0x0766071E,0x08850750,
-0xFF2904B5,0x0E6F024C,0x02590944,0x05D10B08,0x096C0030,0xFD160A4C,0x0003FA83,0xFAAC028D,
-0xFFE1FD13,0xFF54FFE9,0xFA2AFE02,0xFACAF9B8,0xEF6AF724,0xEB17EDD2,0xFF37FDA0,0xF68BFD03,
-0xF9AAF1BA,0x0283FF7F,0xFB00FF95,0x068DF38C,0xF2690560,0x05E0F402,0x0067F7F7,0xFE27106D,
-0xF0EBEDF2,0xF821FE3F,0xF095F3E1,0x064EF34F,0x18611A95,0x07E9FE27,0x0C8F151F,0x00C00279,
-0xF9E800B5,0x0D4202B8,0xFAA8FCB9,0x0B1E0DF0,0x093605D5,0xFE42085E,0x05F1FEB0,0x0DC8F4FC,
-0xFC0C1F03,0x0760F3FD,0xFFABFEFF,0x02E3079B,0xF515F40F,0x0D5F0AD6,0x09AA0BB8,0xF849F9ED,
-0x04BE0035,0xFACBFD14,0xF055F5FF,0xF769F1E8,0x0B46041C,0xF7F5039C,0xF99AF72A,0xFD43FA65,
-0xE922F2AA,0x077CF945,0x06D404D1,0xEB4EFF18,0xEC31E573,0xF696EB5C,0x01BF07BC,0x027DF3D9,
-0x00AE0FD5,0x0BD607CA,0xF1FCEF66,0x118A0B12,0xF9060308,0xFFFEF517,0x0BEC0269,0x00B30C4A,
-0xFD6102CE,0x08FFFC08,0x07591112,0x04C2FB96,0x08C909CE,0xFDE5077D,0x05200021,0x033D0303,
-0x11C00B23,0x038E0A89,0xFCA8049B,0x13CF05F0,0xFE320619,0xFFF6064F,0x0348FBCA,0xF8F701FC,
-0xFAC8F239,0x0251FF3C,0xF22901B3,0xFD76F018,0x0317052C,0xFB64FD70,0xEE00F8D6,0xF4BCF1A8,
-0xF42CF318,0xFF4EF63B,0xF83E002E,0xFA2AFA3A,0xEC0AF03E,0xF71CF46F,0xFA0AF3A9,0xEBC9F58B,
-0xF61BF0EF,0x02BBF9F4,0xFBCB038C,0xF6BFF68E,0xF977F604,0xFB540299,0xFDD0F164,0xF646FDE6,
-0x09E600C7,0x04E205C0,0x04710585,0x0656050C,0x0921073A,0x08DF08DA,0x07AF076E,0x082E065B,
-0x070D095B,0x060308D2,0x079E04BF,0x0DCE1099,0x0E5009BC,0x0BE90FD8,0x1167104B,0x10B60A4D,
-0x0BAB14F8,0x0E030BF3,0xFF9FFD6F,0xFF9B0EB2,0x08B6F670,0x065208AE,0xFD890689,0x087702C4,
-0x05B705CB,0x04A7061A,0xFBE803E2,0xFFB7FDF4,0xF610F48C,0xF772FE9A,0xF83DF235,0xF311F6EF,
-0xF41BF442,0xF4A2F58B,0xF298EF3E,0xEFE4F5F6,0xF614EFA8,0xEFE9F2E7,0xF311F151,0xF23EF1AE,
-0xF5B9F37A,0xF3FBF913,0xEE7DEF58,0xF075EF53,0xF7A4F18B,0xFC89FB30,0x00D4FEC8,0xFD69FE1B,
-0x00C1019B,0x01A00068,0x0370FFDA,0x08DF0DCA,0x0446FF43,0x0AB3077D,0x06830BBC,0x0AA20796,
-0x11E80B28,0x0B540DA0,0x082A0D95,0x0E7E08DB,0x0FE40E35,0x0CAF0DC5,0x0D3D1017,0x12080D2C,
-0x10D11170,0x0A380E29,0x06AA093E,0x06B30563,0x031405F4,0x03EA029B,0x01BA043E,0x030B0095,
-0x024C053C,0xFE23011F,0xF817FA4B,0xF6E0F9EC,0xFA78EF3F,0xF700FCBC,0xEFF2F798,0xF7D7F2B7,
-0xF6FEF30B,0xEA7AF5C0,0xFAABF2AA,0xF3C0EC37,0xEA4EF915,0xFE14F3E8,0xF2ACF949,0xF456EE53,
-0xEFA0F624,0xFC1EF932,0xFE80F01C,0xEB7F0364,0x04A4F896,0x0121F6FA,0xF02A00C7,0xFBC4FBBA,
-0x00A2F646,0xFC18FEEC,0xFF7004DA,0x0116FC56,0xFF94FED6,0x078505E2,0x09ED0C69,0x0B640204,
-0xFE4B06FF,0x094A0B0A,0x0C0D028F,0x04A00B8F,0x066709B5,0x09080184,0x034606F7,0x05380585,
-0x0706063B,0x082D05A4,0x0396075D,0x07180587,0x027F048E,0xFF82FE6B,0x004504D5,0x05290005,
-0xFD19FFAC,0x027502E3,0x01C4FEEC,0xFCC7014E,0x02A60012,0xFCAEFDFB,0xFB04FE0C,0xF8EBF62A,
-0xFFC5FD9C,0xFAD1FF1A,0xF7B1FB24,0xF7E3F5FD,0x0508FBA1,0xF86EFE89,0xFA17F9C3,0xFDC3FB02,
-0x0107FF72,0xFCC90644,0xF8A6F83D,0xFF33FB6C,0xFD5BFE74,0xF890FB54,0xF934FC9C,0x00E9FB47,
-0x01EE05E6,0xF9B4FB51,0xFA74F9E0,0x06A20065,0xFC040223,0xFEB4FB94,0x004FFF5A,0xFC77FFF8,
-0xFE29F973,0x003E01AE,0x08110384,0xFF850536,0xFC2EFDB9,0xFDDCFD1A,0xFDA2FEBB,0xFFE8FE28,
-0xFDBCFFFA,0xFFCD0025,0x03CE004C,0xFF5F00F9,0x01CC009A,0x02A401CA,0x031B023A,0x07DB0610,
-0x03CB052B,0x015805C5,0x02030025,0x0211011E,0x04DA063D,0x071904C1,0x069F070D,0x082F092B,
-0x08130889,0x038704B1,0x0718051C,0x042F05F6,0x02DA03F0,0x02F401B2,0x049004D1,0x09EA05F6,
-0x08D10A8F,0x05FF089D,0x061303E6,0x04C90627,0x06870636,0x045904C5,0x043D03F1,0x022D04C2,
-0xFF9100AB,0xFDF3FDB9,0x00E3FF08,0xFF2B010E,0x00C6003A,0x0063FEFA,0xFA81FF0C,0xFDE0FB1C,
-0xFC80FD7E,0xFCDCFCC1,0xFCBBFCC7,0xFCDEFCE5,0xFBCDFC6C,0xFB69FB52,0xFD37FD72,0xFE3AFBBB,
-0xFE9CFDD7,0x00180172,0x0081FEB4,0xFD26FFB7,0xFE3DFD29,0xFEEEFE85,0xFE14FF57,0xFFEBFCFE,
-0x00310283,0x03640120,0x030703F8,0x030C03E2,0x01E60130,0x0181026B,0x099B0798,0x03CEFFE7,
-0x0636070E,0x05780995,0x08E005FD,0x052306E9,0x040302E3,0x04E9072C,0x07480593,0x056D0455,
-0x09360BC5,0x06DD07A8,0x08510679,0x01A10536,0x038303FA,0x02A60160,0x0126035E,0x0345FF8C,
-0x011E0498,0xFF3AFE52,0xFA62FD5E,0xFDF0FC45,0xFD33FC89,0x019E0039,0xFAD6FDB8,0xFBD1FB57,
-0xF9A0FC28,0xFBAAF662,0xF3CDFC11,0xFCF4FC57,0xFAC4F012,0xF2DAFE00,0xFC42F9C9,0xFC71F866,
-0xF98CFBE8,0xF675FA14,0xFAF3F6C6,0xFA8EF800,0xFC02FCFA,0xFE6DFF25,0xFFD9FD77,0xFD5CFDAD,
-0xFC3EFD44,0xFC1DFC7F,0x01B4FC6B,0x01780438,0x01D400F2,0x018EFFF3,0xFFE80217,0x009D0072,
-0x09310401,0x04540306,0x05EF0E59,0x09C802BC,0x01BE0313,0x0448038C,0x01DB0731,0x0ACE02E8,
-0x039A0360,0xFF420A7A,0x0697FA7A,0xFAE8027A,0x05B901B9,0x02090305,0x0408038B,0xFE76009E,
-0x03D40231,0xFE9EFF15,0xFC9FFFAC,0xFC2FFD61,0xFB60F9FA,0xFB16F92B,0xF990FE9F,0xFEC0FA74,
-0xFAD4FB46,0xFB5BFE32,0xFD28FAB6,0xF76FFA5B,0xF8BAF837,0xF9B5F8B3,0xFC32FBC5,0xFBAAFA5B,
-0xFA98FDF0,0xFA53F8A2,0xFB0CFA82,0xFCC8FC4E,0xFC50FC97,0xFE6BFD8E,0xFC8EFDDD,0x008AFE09,
-0x00430077,0xFFFF014F,0xFEC8FE64,0xFF51FF7A,0x019300AF,0x00B000ED,0x028E0273,0x025C014E,
-0x02D703BC,0x047802C8,0x01E702B5,0x04360437,0x02F302B1,0x040E03DC,0x01030290,0x033E02D2,
-0x036D0222,0x016703BC,0x03870192,0x02AE047C,0x02970195,0x00F901C9,0x026A01F7,0x00B10120,
-0x01CB00F9,0x01010280,0x0062FF26,0xFF3F00EF,0xFF52FEA0,0xFCFEFDF9,0xFB7EFC70,0xFB8FFAB3,
-0xFD22FD5D,0xFE1CFCE2,0xFD1AFE3A,0xFC67FCC6,0xFC5EFB8F,0xFCA1FD28,0xFD5EFCA3,0xFC87FDC2,
-0xFBFBFB30,0xFB28FC3D,0xFCAEFB92,0xFBCAFD06,0xFDF4FBCE,0xFD42FD4D,0xFF18FFAD,0x002DFF5F,
-0xFE29FEAF,0xFF1EFE3B,0x00A50066,0xFF4B0068,0xFDC9FDC0,0x00B4FF93,0x01F90149,0x040E02C1,
-0x02BB03D3,0x017A01F1,0x017200DF,0x021A023E,0x026C017F,0x049103F6,0x03C204AF,0x02E202E8,
-0xFFCE026C,0xFF6DFE4C,0x025500CF,0x025A0271,0x044F0444,0x032502FA,0x023002DA,0x00DB025E,
-0xFEF6FE7B,0x005E00BB,0xFDC2FE5D,0xFEDEFEE2,0xFDDAFE7E,0xFE30FCD8,0xFBB4FE16,0xFE5EFC45,
-0xFC12FC00,0xFE5AFF0D,0xFCFDFCDC,0xFE63FE3C,0xFCCBFD22,0xFC1AFCB7,0xFC44FC4D,0xFAAAFB2B,
-0xFC85FC1E,0xFE0EFDB2,0xFE2CFD7A,0xFC9CFD44,0xFDF6FE13,0xFE11FD90,0x00A4FF77,0xFFF60042,
-0x0095FFFE,0x000500CD,0xFDFCFEE3,0x00D6FF87,0xFF690000,0x00EE0051,0x022800F0,0x03660329,
-0x02770304,0x02EA0228,0x026302DF,0x023A02AB,0x02FC01FF,0x024C032C,0x032F02F7,0x025002BE,
-0x024F02BA,0x00AE00F2,0x01620143,0x01170112,0x00B700B9,0xFFD00030,0x00D50051,0xFF0F0009,
-0xFED5FF31,0xFF0DFE19,0xFEFEFF71,0xFFCDFF6D,0xFEE8FFB4,0xFCEBFD36,0xFCEDFCEB,0xFC87FCE6,
-0xFCACFC84,0xFCBDFCE4,0xFD8AFC94,0xFD9DFE0B,0xFCCFFD0D,0xFD67FCFD,0xFD51FD7C,0xFE9EFDB6,
-0xFE1CFEC3,0xFE88FE45,0xFE46FE34,0xFE50FE4B,0xFFB3FF4B,0xFF0FFEE7,0x003BFFCB,0x01210093,
-0x01270181,0x02AC0242,0x038002EA,0x02B902F8,0x037E0347,0x02FB038B,0x022601CF,0x032D0385,
-0x046E038A,0x037503B8,0x0324040B,0x04530314,0x033D044C,0x041503C9,0x03000340,0x0386034E,
-0x01F402BC,0x024F0280,0x01AA01E3,0x012200F4,0x02EA02D1,0x00BF0172,0x010D00A9,0x00C400EF,
-0x00F20138,0x008D008E,0xFF1F001C,0xFEECFEFC,0xFEBAFE4E,0xFED7FF0C,0xFE19FE37,0xFDD8FE30,
-0xFDCAFDBC,0xFC75FD28,0xFD07FCE7,0xFD76FCEC,0xFDBCFDC1,0xFCF1FD85,0xFD97FCF6,0xFD79FD45,
-0xFDC2FDB6,0xFE0FFE36,0xFEA3FDCB,0xFF62FF7F,0xFF97FEF4,0x0027006A,0x01030077,0x00150094,
-0x00DE00CF,0x015F0080,0x01DC0223,0x022A01ED,0x02240220,0x01B1019E,0x018D01F9,0x019B0187,
-0x018E0166,0x01D00206,0x01D60193,0x020B01A7,0x025D024A,0x0191023C,0x01D2014E,0x01AA01CA,
-0x01DC0203,0x00FD015D,0x007900B5,0xFFA30005,0xFFF0FFD2,0xFF42FF7F,0x001FFF77,0xFEB2FF5E,
-0xFF76FF11,0xFEADFF62,0xFD9AFE27,0x00C9FF1D,0xFDA7FF62,0xFE16FE41,0xFE48FDB8,0xFE2CFE3C,
-0xFE97FE84,0xFE1CFE7B,0xFD79FDDC,0xFEF2FE24,0xFE84FEE5,0xFEF8FDF1,0xFF50FF83,0xFF01FF51,
-0xFEB5FF18,0xFEAFFE85,0xFF76FE9C,0xFFA90024,0xFFAFFF84,0x0023FFEB,0xFF34FFDD,0x001AFF8A,
-0x0061001B,0x000C00A5,0x00CFFFD9,0x013101AB,0xFF9DFFE9,0x011C0071,0x00220115,0x00B8FFEB,
-0x002000C1,0x0006000C,0x000AFFC3,0x00700074,0xFFA600A6,0x0042FF8C,0xFFF70056,0xFFCC004F,
-0x005AFF95,0x00030079,0x00890001,0xFFDB00C9,0x001CFFE9,0xFEF7FF8A,0xFF6AFF39,0xFF05FF32,
-0xFF67FF55,0x002FFFBE,0x005F0046,0xFF970013,0x0042FFF4,0x00FB00F4,0x0078003F,0x0052006D,
-0xFF68FFA1,0xFF7EFFE9,0x001CFFE2,0xFFE2FF67,0xFFAA001E,0xFF87FF7F,0x004E002F,0x0028FFFB,
-0x00020016,0x00B3003D,0x001E005D,0xFFCA0001,0x0082002D,0x0040FFFC,0x00830085,0x008D00CD,
-0x0018001D,0x00170041,0x00FE0065,0x00C20123,0x004C0034,0xFFD10021,0xFFA6002A,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-0x00000000,0x00000000,0x00000000,0x00000000,
-};
@@ -0,0 +1,174 @@
+#include "Clock.h"
+
+CLOCK::CLOCK() :
+  m_edge_times(),
+  m_period_fp( DEFAULT_PERIOD_US << PERIOD_FRAC_BITS ),
+  m_tick_period_us( DEFAULT_PERIOD_US ),
+  m_last_edge_us( 0 ),
+  m_predicted_edge_us( 0 ),
+  m_period_start_us( 0 ),
+  m_multiplier( 1 ),
+  m_divider( 1 ),
+  m_edge_count( 0 ),
+  m_tick_index( 1 ),
+  m_catch_up_ticks( 0 ),
+  m_locked( false ),
+  m_period_measured( false ),
+  m_free_running( false )
+{
+}
+
+bool CLOCK::time_reached( uint32_t now_us, uint32_t time_us )
+{
+  // handles micros() wrapping
+  return static_cast<int32_t>( now_us - time_us ) >= 0;
+}
+
+void CLOCK::external_edge( uint32_t time_us )
+{
+  const uint32_t interval_us  = time_us - m_last_edge_us;
+  const bool valid_interval   = interval_us >= MIN_PERIOD_US && interval_us <= MAX_PERIOD_US;
+
+  if( !m_locked )
+  {
+    // first edge, can only align the phase
+    m_locked                  = true;
+    m_period_measured         = false;
+  }
+  else if( !m_period_measured )
+  {
+    // second edge, start from the measured interval
+    if( valid_interval )
+    {
+      m_period_fp             = interval_us << PERIOD_FRAC_BITS;
+    }
+    m_period_measured         = true;
+  }
+  else
+  {
+    const int32_t error_us    = static_cast<int32_t>( time_us - m_predicted_edge_us );
+    const int32_t period      = period_us();
+    
+    if( error_us > period / 2 || error_us < -period / 2 )
+    {
+      // tempo has jumped, no point slewing towards it
+      if( valid_interval )
+      {
+        m_period_fp           = interval_us << PERIOD_FRAC_BITS;
+      }
+    }
+    else
+    {
+      const int32_t period_fp = static_cast<int32_t>( m_period_fp ) + ( ( error_us * ( 1 << PERIOD_FRAC_BITS ) ) >> PERIOD_SMOOTHING_SHIFT );
+      m_period_fp             = clamp<int32_t>( period_fp, MIN_PERIOD_US << PERIOD_FRAC_BITS, MAX_PERIOD_US << PERIOD_FRAC_BITS );
+    }
+  }
+
+  m_last_edge_us              = time_us;
+  
+  sync_edge( time_us );
+}
+
+void CLOCK::sync_edge( uint32_t time_us )
+{
+  m_predicted_edge_us         = time_us + period_us();
+
+  if( m_edge_count++ % m_divider != 0 )
+  {
+    return;
+  }
+  m_edge_count                = 1;
+
+  // any ticks from the last period which haven't fired yet are fired now, so the sequence doesn't drift
+  m_catch_up_ticks            = m_multiplier - m_tick_index;
+  
+  m_period_start_us           = time_us;
+  m_tick_index                = 0;
+  m_tick_period_us            = ( ( m_period_fp * m_divider ) / m_multiplier ) >> PERIOD_FRAC_BITS;
+}
+
+void CLOCK::on_edge( uint32_t time_us )
+{
+  m_edge_times.push( time_us );
+}
+
+bool CLOCK::poll( uint32_t now_us, uint32_t& tick_time_us )
+{
+  uint32_t edge_time_us;
+  while( m_edge_times.pop( edge_time_us ) )
+  {
+    external_edge( edge_time_us );
+  }
+
+  if( m_locked && time_reached( now_us, m_last_edge_us + ( LOST_LOCK_PERIODS * period_us() ) ) )
+  {
+    m_locked                  = false;
+  }
+
+  if( !m_locked && m_free_running && time_reached( now_us, m_predicted_edge_us ) )
+  {
+    if( time_reached( now_us, m_predicted_edge_us + period_us() ) )
+    {
+      // too far behind (e.g. just started), restart the internal clock from now
+      m_predicted_edge_us     = now_us;
+    }
+    sync_edge( m_predicted_edge_us );
+  }
+
+  if( m_catch_up_ticks > 0 )
+  {
+    --m_catch_up_ticks;
+    tick_time_us              = m_period_start_us;
+    return true;
+  }
+
+  if( m_tick_index < m_multiplier )
+  {
+    const uint32_t tick_us    = m_period_start_us + ( m_tick_index * m_tick_period_us );
+    if( time_reached( now_us, tick_us ) )
+    {
+      ++m_tick_index;
+      tick_time_us            = tick_us;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void CLOCK::set_multiplier( int multiplier )
+{
+  m_multiplier                = clamp( multiplier, 1, 16 );
+  m_tick_index                = m_multiplier;
+}
+
+void CLOCK::set_divider( int divider )
+{
+  m_divider                   = clamp( divider, 1, 16 );
+  m_edge_count                = 0;
+}
+
+void CLOCK::set_free_running( bool free_running )
+{
+  m_free_running              = free_running;
+}
+
+bool CLOCK::locked() const
+{
+  return m_locked;
+}
+
+uint32_t CLOCK::period_us() const
+{
+  return m_period_fp >> PERIOD_FRAC_BITS;
+}
+
+uint32_t CLOCK::tick_period_us() const
+{
+  return m_tick_period_us;
+}
+
+float CLOCK::tempo_bpm( int ticks_per_beat ) const
+{
+  return 60000000.0f / ( static_cast<float>( m_tick_period_us ) * ticks_per_beat );
+}
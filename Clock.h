@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Util.h"
+
+////////////////////////////////////////////////////////////
+// software PLL which locks to an external clock, predicting the time of the next edge from a smoothed period
+// output ticks can be multiplied/divided from the external clock, and it can free run when there is no external clock
+class CLOCK
+{
+  static constexpr int      PERIOD_FRAC_BITS              = 4;          // period is stored in 1/16 us
+  static constexpr int      PERIOD_SMOOTHING_SHIFT        = 3;          // proportion of the phase error used to correct the period
+  static constexpr int      LOST_LOCK_PERIODS             = 2;          // consider the external clock gone after this many missed edges
+  static constexpr uint32_t DEFAULT_PERIOD_US             = 125000;     // 16ths at 120bpm
+  static constexpr uint32_t MIN_PERIOD_US                 = 5000;
+  static constexpr uint32_t MAX_PERIOD_US                 = 2000000;
+
+  LOCKLESS_QUEUE<uint32_t, 8>                             m_edge_times;           // pushed from the trigger interrupt
+
+  volatile uint32_t                                       m_period_fp;            // smoothed period of the external clock
+  volatile uint32_t                                       m_tick_period_us;       // period of output ticks (after multiplication/division)
+  uint32_t                                                m_last_edge_us;
+  uint32_t                                                m_predicted_edge_us;
+  uint32_t                                                m_period_start_us;      // time of the edge which started the current output period
+
+  uint8_t                                                 m_multiplier;
+  uint8_t                                                 m_divider;
+  uint8_t                                                 m_edge_count;
+  uint8_t                                                 m_tick_index;           // next tick within the current output period
+  uint8_t                                                 m_catch_up_ticks;       // ticks still owed when an edge arrives early
+
+  bool                                                    m_locked;
+  bool                                                    m_period_measured;      // false until the second edge after (re)gaining lock
+  bool                                                    m_free_running;
+
+  static bool                                             time_reached( uint32_t now_us, uint32_t time_us );
+
+  void                                                    external_edge( uint32_t time_us );
+  void                                                    sync_edge( uint32_t time_us );
+
+public:
+
+  CLOCK();
+
+  // call from the trigger interrupt
+  void                                                    on_edge( uint32_t time_us );
+
+  // call regularly, returns true (and the time it was due) for each tick which is due at now_us
+  bool                                                    poll( uint32_t now_us, uint32_t& tick_time_us );
+
+  void                                                    set_multiplier( int multiplier );
+  void                                                    set_divider( int divider );
+  void                                                    set_free_running( bool free_running );    // run from the internal clock when there is no external clock
+
+  bool                                                    locked() const;
+  uint32_t                                                period_us() const;                        // smoothed period of the external clock
+  uint32_t                                                tick_period_us() const;
+  float                                                   tempo_bpm( int ticks_per_beat = 4 ) const;
+};
@@ -1,4 +1,15 @@
 #pragma once
 
 //#define DEBUG_OUTPUT
-//#define SHOW_TIMED_SECTIONS
+//#define SHOW_TIMED_SECTIONS      // summarise the time spent in each ADD_TIMED_SECTION every 2 seconds
+//#define CLOCK_IN_AUDIO_UPDATE    // process clock edges in the audio update rather than loop(), so loop() can't affect timing
+//#define INTERNAL_CLOCK           // free run from the internal clock when there is no trigger
+//#define HOT_RELOAD_PATTERNS      // reload pattern files when they change on the SD card (needs CLOCK_IN_AUDIO_UPDATE)
+//#define SHOW_DECODE_PERF         // print the cycles spent decoding compressed samples each second
+//#define SD_KITS                  // load kits from the SD card into RAM when a pattern asks for one with @kit=
+//#define PROFILE_AUDIO_NODES      // count the cycles in each audio node's update(), send 'p' over serial to print them
+//#define INJECT_AUDIO_LOAD        // stall the audio update for 2 blocks every 512, to check deadline misses are reported
+//#define SIZE_AUDIO_MEMORY        // hammer every drum with the delay off and print the peak audio blocks used, to set AUDIO_GRAPH_BLOCKS
+//#define MEASURE_TRIGGER_LATENCY  // time each stage from a trigger edge to the first sample it plays, printed every 5 seconds
+//#define BENCHMARK_DSP            // send 'b' over serial to print the cycles each DSP kernel takes (the audio glitches while it runs)
+//#define GOLDEN_AUDIO_TEST        // play every pattern from a fixed clock and record the output to GOLDEN.RAW on the SD card, or compare with it if it's there
@@ -1,27 +1,259 @@
+#include <algorithm>
+
 #include "CompileSwitches.h"
 #include "Util.h"
 
+#include "AudioClock.h"
 #include "Drum.h"
+#include "Kit.h"
+#include "TimedSection.h"
+#include "TriggerLatency.h"
+
+#if defined(HOT_RELOAD_PATTERNS) && !defined(CLOCK_IN_AUDIO_UPDATE)
+// reloading reads a whole pattern file in loop(), which would hold up the clock if it ran there too
+#error "HOT_RELOAD_PATTERNS needs CLOCK_IN_AUDIO_UPDATE"
+#endif
 
 ////////////////////////////////////////////////////////////
 
-DRUM::DRUM( const uint16_t* sample_data ) :
+std::array<DRUM*, MAX_DRUMS> DRUM::s_drums = {};
+int DRUM::s_num_drums                      = 0;
+
+DRUM::DRUM( const char* name, const DRUM_SAMPLES& samples ) :
   m_voices(),
-  m_poly_player(sample_data)
+  m_poly_player(*samples.m_layers[0].m_samples[0]),
+  m_default_samples(samples),
+  m_layers(nullptr),
+  m_num_layers(0),
+  m_velocity_layer(),
+  m_round_robin(),
+  m_kit_sample(nullptr),
+  m_kit_layer(),
+  m_envelope(),
+  m_choke_group(0)
 {
+  set_layers( samples.m_layers, samples.m_num_layers );
+
+  for( int vi = 0; vi < NUM_VOICES_PER_DRUM; ++vi )
+  {
+    m_poly_player.add_sample_player( m_voices[vi] );
+#ifdef PROFILE_AUDIO_NODES
+    m_voices[vi].profile().set_name( name, vi );
+#else
+    (void)name;
+#endif
+  }
+
+  if( s_num_drums < MAX_DRUMS )
+  {
+    s_drums[s_num_drums++] = this;
+  }
+}
+
+void DRUM::choke()
+{
+  AUDIO_NO_INTERRUPTS no_interrupts;
   for( SAMPLE_PLAYER_EFFECT& voice : m_voices )
   {
-    m_poly_player.add_sample_player( voice );
+    if( voice.playing() )
+    {
+      voice.fade_out();
+    }
+  }
+}
+
+void DRUM::set_layers( const SAMPLE_LAYER* layers, int num_layers )
+{
+  m_layers      = layers;
+  m_num_layers  = min_val( num_layers, MAX_VELOCITY_LAYERS );
+
+  // velocities below the first layer play it
+  int layer     = 0;
+  for( int velocity = 0; velocity < static_cast<int>( m_velocity_layer.size() ); ++velocity )
+  {
+    while( layer + 1 < m_num_layers && layers[layer + 1].m_min_velocity <= velocity )
+    {
+      ++layer;
+    }
+    m_velocity_layer[velocity] = layer;
+  }
+
+  m_round_robin.fill( 0 );
+}
+
+void DRUM::trigger( int pitch, int velocity, uint32_t time_us )
+{
+  // the choked voices fade out in the same block the new hit starts in
+  AUDIO_NO_INTERRUPTS no_interrupts;
+
+  if( m_choke_group != 0 )
+  {
+    for( int di = 0; di < s_num_drums; ++di )
+    {
+      if( s_drums[di] != this && s_drums[di]->m_choke_group == m_choke_group )
+      {
+        s_drums[di]->choke();
+      }
+    }
   }
+
+  velocity                          = clamp( velocity, 0, 127 );
+  const int layer                   = m_velocity_layer[velocity];
+  const SAMPLE_LAYER& samples       = m_layers[layer];
+  m_poly_player.set_sample( *samples.m_samples[ m_round_robin[layer] ] );
+  if( ++m_round_robin[layer] >= samples.m_num_samples )
+  {
+    m_round_robin[layer] = 0;
+  }
+
+  m_poly_player.play_at_pitch(pitch, velocity / 127.0f, AUDIO_CLOCK::sample_offset(time_us), m_envelope);
 }
 
-void DRUM::trigger( int pitch, float gain )
+void DRUM::set_sample( const SAMPLE_BANK_ENTRY* sample )
 {
-  m_poly_player.play_at_pitch(pitch, gain);
+  if( sample == nullptr )
+  {
+    set_layers( m_default_samples.m_layers, m_default_samples.m_num_layers );
+    return;
+  }
+
+  m_kit_sample  = sample;
+  m_kit_layer   = { &m_kit_sample, 1, 0 };
+  set_layers( &m_kit_layer, 1 );
+}
+
+void DRUM::set_envelope( const VOICE_ENVELOPE& envelope )
+{
+  m_envelope = envelope;
+}
+
+void DRUM::set_choke_group( int group )
+{
+  m_choke_group = group;
+}
+
+void DRUM::stop_voices_playing( const void* begin, const void* end )
+{
+  for( SAMPLE_PLAYER_EFFECT& voice : m_voices )
+  {
+    if( voice.playing_from( begin, end ) )
+    {
+      voice.stop();
+    }
+  }
 }
 
 ////////////////////////////////////////////////////////////
 
+void TRIGGER_SCHEDULER::schedule( uint32_t time_us, DRUM& drum, int pitch, int velocity )
+{
+  if( m_num_events == MAX_EVENTS )
+  {
+    DEBUG_TEXT_LINE("Too many scheduled triggers");
+    return;
+  }
+
+  // insert in time order, searching from the back as events mostly arrive in order
+  int ei = m_num_events++;
+  while( ei > 0 && static_cast<int32_t>( m_events[ei - 1].m_time_us - time_us ) > 0 )
+  {
+    m_events[ei] = m_events[ei - 1];
+    --ei;
+  }
+
+  m_events[ei] = { time_us, &drum, static_cast<int8_t>(pitch), static_cast<uint8_t>(velocity) };
+}
+
+void TRIGGER_SCHEDULER::update( uint32_t now_us )
+{
+  int num_due = 0;
+  while( num_due < m_num_events && static_cast<int32_t>( now_us - m_events[num_due].m_time_us ) >= 0 )
+  {
+    const EVENT& event = m_events[num_due++];
+    event.m_drum->trigger( event.m_pitch, event.m_velocity, event.m_time_us );
+  }
+
+  if( num_due > 0 )
+  {
+    m_num_events -= num_due;
+    for( int ei = 0; ei < m_num_events; ++ei )
+    {
+      m_events[ei] = m_events[ei + num_due];
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////
+
+constexpr int TRIGGER::MAX_RATCHETS;
+
+bool TRIGGER::parse( char* text )
+{
+  // pitch and velocity, followed by optional fields identified by a letter, e.g. "1,94" or "1,94,o3,r2"
+  char* field = strtok( text, ", " );
+  if( field == nullptr )
+  {
+    return false;
+  }
+  m_pitch     = atoi( field );
+
+  field       = strtok( nullptr, ", " );
+  if( field == nullptr )
+  {
+    return false;
+  }
+  m_velocity  = atoi( field );
+
+  while( ( field = strtok( nullptr, ", " ) ) != nullptr )
+  {
+    const int value = atoi( field + 1 );
+    switch( field[0] )
+    {
+      case 'o':
+      {
+        m_offset    = clamp( value, 0, TICKS_PER_STEP - 1 );
+        break;
+      }
+      case 'r':
+      {
+        m_ratchets  = clamp( value, 1, MAX_RATCHETS );
+        break;
+      }
+      case 'p':
+      {
+        m_probability = clamp( value, 0, 100 );
+        break;
+      }
+      case 'e':
+      {
+        m_every     = clamp( value, 1, 255 );
+        break;
+      }
+      case 'f':
+      {
+        m_fill_only = true;
+        break;
+      }
+      case 'n':
+      {
+        m_not_first = true;
+        break;
+      }
+      default:
+      {
+        DEBUG_TEXT_LINE("Unknown trigger field");
+        break;
+      }
+    }
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////
+
+constexpr int SEQUENCE::MAX_SEQUENCE_SIZE;
+
 SEQUENCE::SEQUENCE( DRUM& drum ) :
   m_drum(&drum)
 {
@@ -32,11 +264,92 @@ int SEQUENCE::sequence_length() const
   return m_sequence_length;
 }
 
-bool SEQUENCE::read(File& file)
+int SEQUENCE::num_stored_steps() const
+{
+  return m_steps != nullptr ? m_sequence_length : 0;
+}
+
+bool SEQUENCE::read_generator( File& file )
+{
+  // e.g. "E3,8,2,a0x5{1,94}", 3 hits in 8 steps, rotated by 2 steps, with steps 0 and 2 accented
+  const int BUFFER_SIZE = 64;
+  char buffer[BUFFER_SIZE];
+  int bi = 0;
+  char c;
+  while( file.available() > 0 && (c = file.read()) != '{' && bi < BUFFER_SIZE - 1 )
+  {
+    buffer[bi++] = c;
+  }
+  buffer[bi] = '\0';
+
+  char* field           = strtok( buffer, ", " );
+  const int hits        = field != nullptr ? atoi( field ) : 0;
+  field                 = strtok( nullptr, ", " );
+  const int steps       = field != nullptr ? atoi( field ) : 0;
+
+  m_sequence_length     = clamp( steps, 0, MAX_SEQUENCE_SIZE );
+  m_hits                = clamp( hits, 0, static_cast<int>(m_sequence_length) );
+  m_rotation            = 0;
+  m_accent_mask         = 0;
+  while( ( field = strtok( nullptr, ", " ) ) != nullptr )
+  {
+    if( field[0] == 'a' )
+    {
+      m_accent_mask     = strtoul( field + 1, nullptr, 0 );
+    }
+    else if( m_sequence_length > 0 )
+    {
+      // negative rotates the other way
+      const int length  = m_sequence_length;
+      m_rotation        = ( ( atoi( field ) % length ) + length ) % length;
+    }
+  }
+
+  bi = 0;
+  while( file.available() > 0 && (c = file.read()) != '}' && bi < BUFFER_SIZE - 1 )
+  {
+    buffer[bi++] = c;
+  }
+  buffer[bi] = '\0';
+
+  m_generated_trigger   = TRIGGER();
+  if( !m_generated_trigger.parse( buffer ) )
+  {
+    DEBUG_TEXT_LINE("Unable to read generated trigger");
+  }
+
+  // skip the rest of the line
+  while( file.available() > 0 && file.read() != '\n' )
+  {
+  }
+
+  DEBUG_TEXT("Euclidean hits:");
+  DEBUG_TEXT(m_hits);
+  DEBUG_TEXT(" steps:");
+  DEBUG_TEXT(m_sequence_length);
+  DEBUG_TEXT(" rotation:");
+  DEBUG_TEXT_LINE(m_rotation);
+
+  return m_sequence_length > 0;
+}
+
+bool SEQUENCE::read( File& file, TRIGGER* steps, int max_steps, bool& out_of_steps )
 {
   m_sequence_length = 0;
+  m_steps           = nullptr;
+
+  if( file.peek() == 'E' )
+  {
+    file.read();
+    return read_generator( file );
+  }
+
+  m_steps           = steps;
+  const bool pool_limited = max_steps < MAX_SEQUENCE_SIZE;
+  max_steps         = min_val( max_steps, MAX_SEQUENCE_SIZE );
 
-  auto consume_comma_check_end = [&file]() -> bool
+  bool line_ended  = false;
+  auto consume_comma_check_end = [&file, &line_ended]() -> bool
   {
     if( file.available() == 0 )
     {
@@ -50,6 +363,7 @@ bool SEQUENCE::read(File& file)
     }
     else if( c == '\n' )
     {
+      line_ended = true;
       return true;
     }
     else
@@ -59,14 +373,14 @@ bool SEQUENCE::read(File& file)
     }
   };
   
-  while( file.available() > 0 )
+  while( file.available() > 0 && m_sequence_length < max_steps )
   {
     char c = file.read();
 
     if( c == '-' )
     {
       // no trigger
-      m_sequence[m_sequence_length++] = { TRIGGER::EMPTY, 0 };
+      steps[m_sequence_length++] = TRIGGER();
 
        DEBUG_TEXT("Trig{EMPTY} ");
 
@@ -77,41 +391,32 @@ bool SEQUENCE::read(File& file)
     }
     else if( c == '{' )
     {
-      auto read_int = [&file](char terminator) -> int
+      // read up to the closing brace, then parse the fields
+      const int BUFFER_SIZE = 64;
+      char buffer[BUFFER_SIZE];
+      int bi = 0;
+      while( file.available() > 0 && (c = file.read()) != '}' && bi < BUFFER_SIZE - 1 )
       {
-        const int BUFFER_SIZE = 256;
-        char buffer[BUFFER_SIZE];
-        int bi = 0;
-        char c;
-        while( file.available() > 0 && (c = file.read()) != terminator && bi < BUFFER_SIZE )
-        {
-          buffer[bi++] = c;
-        }
-        buffer[bi] = '\0';
-
-        if( bi == 0 )
-        {
-          DEBUG_TEXT_LINE("Unable to read trigger");
-          return 0;
-        }
-        else if( bi >= BUFFER_SIZE )
-        {
-          DEBUG_TEXT_LINE("Trigger too large");
-          return 0;
-        }
-               
-        return atoi(buffer);       
-      };
-
-      const int8_t pitch            = read_int(',');
-      const uint8_t velocity        = read_int('}');
-
-      m_sequence[m_sequence_length++] = { pitch, velocity };
+        buffer[bi++] = c;
+      }
+      buffer[bi] = '\0';
+
+      TRIGGER trig;
+      if( !trig.parse( buffer ) )
+      {
+        DEBUG_TEXT_LINE("Unable to read trigger");
+      }
+
+      steps[m_sequence_length++] = trig;
 
       DEBUG_TEXT("Trig{");
-      DEBUG_TEXT(pitch);
+      DEBUG_TEXT(trig.m_pitch);
       DEBUG_TEXT(",");
-      DEBUG_TEXT(velocity);
+      DEBUG_TEXT(trig.m_velocity);
+      DEBUG_TEXT(",o");
+      DEBUG_TEXT(trig.m_offset);
+      DEBUG_TEXT(",r");
+      DEBUG_TEXT(trig.m_ratchets);
       DEBUG_TEXT("} ");
 
        if( consume_comma_check_end() )
@@ -131,17 +436,111 @@ bool SEQUENCE::read(File& file)
     }
   }
 
+  if( m_sequence_length == max_steps && !line_ended && file.available() > 0 )
+  {
+    // out of steps, skip the rest so it isn't read as the next sequence
+    DEBUG_TEXT_LINE("Too many steps, ignoring the rest of the line");
+    out_of_steps    = out_of_steps || pool_limited;
+    while( file.available() > 0 && file.read() != '\n' )
+    {
+    }
+  }
+
   DEBUG_TEXT(m_sequence_length);
   DEBUG_TEXT_LINE(" <END>");
   return m_sequence_length > 0;
 }
 
-bool SEQUENCE::clock(int id)
+void SEQUENCE::move_steps( int offset )
 {
-  const TRIGGER& trig = m_sequence[m_beat];
-  if( trig.m_pitch != TRIGGER::EMPTY )
+  if( m_steps != nullptr )
   {
-    m_drum->trigger(trig.m_pitch, trig.m_velocity / 127.0f);
+    m_steps += offset;
+  }
+}
+
+void SEQUENCE::set_envelope( const VOICE_ENVELOPE& envelope )
+{
+  m_envelope = envelope;
+}
+
+void SEQUENCE::set_choke_group( int group )
+{
+  m_choke_group = group;
+}
+
+void SEQUENCE::start()
+{
+  m_loop_count = 0;
+
+  if( m_drum != nullptr )
+  {
+    m_drum->set_envelope( m_envelope );
+    m_drum->set_choke_group( m_choke_group );
+  }
+}
+
+bool SEQUENCE::step( int beat, TRIGGER& trig ) const
+{
+  if( m_steps != nullptr )
+  {
+    trig = m_steps[beat];
+    return trig.m_pitch != TRIGGER::EMPTY;
+  }
+
+  // computed on the fly, a hit when the running total of hits wraps past the sequence length
+  const int rotated_beat = beat + m_rotation;
+  if( ( rotated_beat * m_hits ) % m_sequence_length >= m_hits )
+  {
+    return false;
+  }
+
+  trig = m_generated_trigger;
+  if( m_accent_mask & ( 1u << beat ) )
+  {
+    trig.m_velocity = 127;
+  }
+  return true;
+}
+
+bool SEQUENCE::should_trigger( const TRIGGER& trig, SEQUENCE_CONTEXT& context ) const
+{
+  if( ( trig.m_fill_only && !context.m_fill ) ||
+      ( trig.m_not_first && m_loop_count == 0 ) ||
+      ( m_loop_count % trig.m_every ) != 0 )
+  {
+    return false;
+  }
+
+  // only use a random number when needed, so the sequence of random numbers only depends on the pattern
+  return trig.m_probability >= 100 || context.m_random.chance( trig.m_probability );
+}
+
+bool SEQUENCE::clock( int id, SEQUENCE_CONTEXT& context )
+{
+  const STEP_TIME& step_time = context.m_step_time;
+  TRIGGER trig;
+  if( m_sequence_length > 0 && step( m_beat, trig ) && should_trigger( trig, context ) )
+  {
+    // keep the last ratchet within this step, so it can't land on the next step's trigger
+    const int ratchet_ticks   = TICKS_PER_STEP / trig.m_ratchets;
+    const int max_offset      = TICKS_PER_STEP - 1 - ( ( trig.m_ratchets - 1 ) * ratchet_ticks );
+    const int offset_ticks    = min_val( trig.m_offset + ( ( m_beat & 1 ) ? context.m_swing_ticks : 0 ), max_offset );
+
+    if( offset_ticks == 0 && trig.m_ratchets == 1 )
+    {
+      // on the beat, no need to schedule
+      m_drum->trigger(trig.m_pitch, trig.m_velocity, step_time.m_time_us);
+    }
+    else
+    {
+      for( int r = 0; r < trig.m_ratchets; ++r )
+      {
+        const int tick          = offset_ticks + ( r * ratchet_ticks );
+        const uint32_t time_us  = step_time.m_time_us + ( ( tick * step_time.m_period_us ) / TICKS_PER_STEP );
+        context.m_scheduler.schedule( time_us, *m_drum, trig.m_pitch, trig.m_velocity );
+      }
+    }
 
     /*
     DEBUG_TEXT("TRIG id:");
@@ -157,6 +556,7 @@ bool SEQUENCE::clock(int id)
   if( ++m_beat >= m_sequence_length )
   {
     m_beat          = 0;
+    ++m_loop_count;
     cycle_complete  = true;
   }
   
@@ -165,8 +565,12 @@ bool SEQUENCE::clock(int id)
 
 ////////////////////////////////////////////////////////////
 
-bool PATTERN::read( const char* filename, const DRUM_SET& drums ) 
+bool PATTERN::read( const char* filename, const DRUM_SET& drums, TRIGGER* steps, int max_steps ) 
 {
+  m_steps         = steps;
+  m_num_steps     = 0;
+  m_out_of_steps  = false;
+
   File pattern_file = SD.open(filename, FILE_READ);
 
   if( !pattern_file )
@@ -183,10 +587,32 @@ bool PATTERN::read( const char* filename, const DRUM_SET& drums )
     m_sequences[di++] = SEQUENCE(*drum);
   }
 
+  m_swing_ticks = 0;
+  m_kit[0]      = '\0';
+
+  // seed from the filename unless the pattern sets its own
+  m_seed        = 1;
+  for( const char* c = filename; *c != '\0'; ++c )
+  {
+    m_seed      = ( m_seed * 31 ) + *c;
+  }
+
   size_t num_sequences = 0;
   int largest_sequence_length = 0;
-  while( num_sequences < m_sequences.size() && m_sequences[num_sequences].read(pattern_file) )
+  while( num_sequences < m_sequences.size() )
   {
+    if( pattern_file.peek() == '@' )
+    {
+      read_directive( pattern_file );
+      continue;
+    }
+
+    if( !m_sequences[num_sequences].read(pattern_file, m_steps + m_num_steps, max_steps - m_num_steps, m_out_of_steps) )
+    {
+      break;
+    }
+    m_num_steps += m_sequences[num_sequences].num_stored_steps();
+
     const int sequence_length = m_sequences[num_sequences].sequence_length();
     if( sequence_length > largest_sequence_length )
     {
@@ -205,17 +631,135 @@ bool PATTERN::read( const char* filename, const DRUM_SET& drums )
 
   DEBUG_TEXT("Leading_sequence:");
   DEBUG_TEXT_LINE(m_leading_sequence);
+  DEBUG_TEXT("Steps:");
+  DEBUG_TEXT_LINE(m_num_steps);
+
+  // started by the PATTERN_SET when it becomes current, which sets the drum envelopes
 
   return true;
 }
 
-bool PATTERN::clock()
+TRIGGER* PATTERN::steps() const
+{
+  return m_steps;
+}
+
+int PATTERN::num_steps() const
+{
+  return m_num_steps;
+}
+
+bool PATTERN::out_of_steps() const
+{
+  return m_out_of_steps;
+}
+
+void PATTERN::move_steps( int offset )
+{
+  m_steps += offset;
+  for( SEQUENCE& sequence : m_sequences )
+  {
+    sequence.move_steps( offset );
+  }
+}
+
+void PATTERN::read_directive( File& file )
+{
+  // e.g. "@swing=3"
+  const int BUFFER_SIZE = 32;
+  char buffer[BUFFER_SIZE];
+  int bi = 0;
+  char c;
+  file.read(); // '@'
+  while( file.available() > 0 && (c = file.read()) != '\n' && bi < BUFFER_SIZE - 1 )
+  {
+    buffer[bi++] = c;
+  }
+  buffer[bi] = '\0';
+
+  char* value = strchr( buffer, '=' );
+  if( value == nullptr )
+  {
+    DEBUG_TEXT_LINE("Directive missing value");
+    return;
+  }
+  *value++ = '\0';
+
+  if( strcmp( buffer, "swing" ) == 0 )
+  {
+    m_swing_ticks = clamp( atoi( value ), 0, TICKS_PER_STEP - 1 );
+  }
+  else if( strcmp( buffer, "seed" ) == 0 )
+  {
+    m_seed        = strtoul( value, nullptr, 0 );
+  }
+  else if( strcmp( buffer, "envelope" ) == 0 )
+  {
+    // drum,gate ms,decay ms
+    const int drum      = atoi( value );
+    const char* gate    = strchr( value, ',' );
+    const char* decay   = gate != nullptr ? strchr( gate + 1, ',' ) : nullptr;
+    if( drum < 1 || drum > MAX_DRUMS || gate == nullptr )
+    {
+      DEBUG_TEXT_LINE("Bad envelope");
+      return;
+    }
+    m_sequences[drum - 1].set_envelope( VOICE_ENVELOPE::from_times( atoi( gate + 1 ), decay != nullptr ? atoi( decay + 1 ) : 0 ) );
+  }
+  else if( strcmp( buffer, "choke" ) == 0 )
+  {
+    // drum,group
+    const int drum      = atoi( value );
+    const char* group   = strchr( value, ',' );
+    if( drum < 1 || drum > MAX_DRUMS || group == nullptr )
+    {
+      DEBUG_TEXT_LINE("Bad choke group");
+      return;
+    }
+    m_sequences[drum - 1].set_choke_group( clamp( atoi( group + 1 ), 0, 255 ) );
+  }
+  else if( strcmp( buffer, "kit" ) == 0 )
+  {
+    value[ strcspn( value, " \t\r" ) ] = '\0';
+    strncpy( m_kit, value, sizeof(m_kit) - 1 );
+    m_kit[sizeof(m_kit) - 1] = '\0';
+  }
+  else
+  {
+    DEBUG_TEXT("Unknown directive:");
+    DEBUG_TEXT_LINE(buffer);
+    return;
+  }
+
+  DEBUG_TEXT(buffer);
+  DEBUG_TEXT(":");
+  DEBUG_TEXT_LINE(value);
+}
+
+const char* PATTERN::kit() const
 {
+  return m_kit;
+}
+
+void PATTERN::start()
+{
+  m_random.set_seed( m_seed );
+
+  for( SEQUENCE& seq : m_sequences )
+  {
+    seq.start();
+  }
+}
+
+bool PATTERN::clock( const STEP_TIME& step_time, bool fill, TRIGGER_SCHEDULER& scheduler )
+{
+  SEQUENCE_CONTEXT context = { step_time, m_swing_ticks, fill, m_random, scheduler };
+
   bool leading_cycle_complete = true;
   int index = 0;
   for( SEQUENCE& seq : m_sequences )
   {
-    bool cycle_complete = seq.clock(index);
+    bool cycle_complete = seq.clock(index, context);
 
     if( index++ == m_leading_sequence )
     {
@@ -228,9 +772,120 @@ bool PATTERN::clock()
 
 ////////////////////////////////////////////////////////////
 
+namespace
+{
+  const char* const PATTERN_FILENAMES[] = { "p1.txt", "p2.txt", "p3.txt", "p4.txt", "p5.txt", "p6.txt", "p7.txt", "p8.txt" };
+}
+
+bool PATTERN_SET::last_loop_of_song_entry() const
+{
+  return m_song_loop + 1 >= m_song.entry(m_song_position).m_repeats || m_skip_requests != m_skips_handled;
+}
+
+void PATTERN_SET::set_current_pattern( int pattern )
+{
+  m_current_pattern = pattern;
+  this->pattern(m_current_pattern).start();
+}
+
+PATTERN& PATTERN_SET::pattern( int pattern )
+{
+  return m_patterns[ m_pattern_slots[pattern] ];
+}
+
+void PATTERN_SET::free_steps( PATTERN& old_pattern )
+{
+  // close the gap, moving the steps of every pattern after it down
+  TRIGGER* gap          = old_pattern.steps();
+  const int gap_steps   = old_pattern.num_steps();
+  if( gap_steps == 0 )
+  {
+    return;
+  }
+
+  std::copy( gap + gap_steps, m_steps.data() + m_num_steps, gap );
+  m_num_steps          -= gap_steps;
+
+  for( int pi = 0; pi < m_num_patterns; ++pi )
+  {
+    PATTERN& p = pattern(pi);
+    if( p.steps() > gap )
+    {
+      p.move_steps( -gap_steps );
+    }
+  }
+}
+
+bool PATTERN_SET::file_size( const char* filename, uint32_t& size )
+{
+  File file = SD.open(filename, FILE_READ);
+
+  if( !file )
+  {
+    return false;
+  }
+
+  size = file.size();
+  file.close();
+
+  return true;
+}
+
+uint32_t PATTERN_SET::file_hash( const char* filename )
+{
+  File file = SD.open(filename, FILE_READ);
+
+  if( !file )
+  {
+    return 0;
+  }
+
+  // hash of the contents (FNV-1a), the SD library doesn't give modification times
+  // read a sector at a time, single byte reads each go through the SD library's cache
+  uint8_t buffer[SD_KIT_SECTOR_BYTES];
+  uint32_t hash = 2166136261u;
+  int bytes_read;
+  while( ( bytes_read = file.read( buffer, sizeof(buffer) ) ) > 0 )
+  {
+    for( int i = 0; i < bytes_read; ++i )
+    {
+      hash = ( hash ^ buffer[i] ) * 16777619u;
+    }
+  }
+  file.close();
+
+  return hash;
+}
+
+bool PATTERN_SET::file_changed( int pattern_index )
+{
+  const char* filename  = PATTERN_FILENAMES[pattern_index];
+
+  // only an edit that keeps the size needs the contents hashing
+  uint32_t size;
+  if( !file_size( filename, size ) )
+  {
+    return false;
+  }
+  if( size != m_file_sizes[pattern_index] )
+  {
+    m_file_sizes[pattern_index]   = size;
+    m_file_hashes[pattern_index]  = 0;    // the caller hashes the new contents for the next check
+    return true;
+  }
+
+  const uint32_t hash   = file_hash( filename );
+  if( hash == 0 || hash == m_file_hashes[pattern_index] )
+  {
+    return false;
+  }
+  m_file_hashes[pattern_index]    = hash;
+  return true;
+}
+
 bool PATTERN_SET::is_pattern_pending() const
 {
-  return m_current_pattern != m_pending_pattern;
+  return m_current_pattern != pending_pattern();
 }
 
 int PATTERN_SET::current_pattern() const
@@ -240,34 +895,208 @@ int PATTERN_SET::current_pattern() const
 
 int PATTERN_SET::pending_pattern() const
 {
+  if( m_song.active() )
+  {
+    if( last_loop_of_song_entry() )
+    {
+      return m_song.entry( ( m_song_position + 1 ) % m_song.num_entries() ).m_pattern;
+    }
+    return m_current_pattern;
+  }
+  
   return m_pending_pattern;
 }
 
-void PATTERN_SET::read( const DRUM_SET& drums )
+int PATTERN_SET::num_patterns() const
 {
-  const char* pattern_filenames[MAX_PATTERNS] = { "p1.txt", "p2.txt", "p3.txt", "p4.txt" };
+  return m_num_patterns;
+}
 
+void PATTERN_SET::read( const DRUM_SET& drums )
+{
+  m_drums        = drums;
   m_num_patterns = 0;
-  for( const char* filename : pattern_filenames )
+  m_num_steps    = 0;
+  for( const char* filename : PATTERN_FILENAMES )
   {
-    if( !m_patterns[m_num_patterns++].read( filename, drums ) )
+    m_pattern_slots[m_num_patterns] = m_num_patterns;
+    PATTERN& p = m_patterns[m_num_patterns];
+    if( !p.read( filename, drums, m_steps.data() + m_num_steps, MAX_STEPS - m_num_steps ) )
     {
       break;
     }
+    m_num_steps += p.num_steps();
+    if( p.out_of_steps() )
+    {
+      DEBUG_TEXT("Out of pattern steps in:");
+      DEBUG_TEXT_LINE(filename);
+    }
+    file_size( filename, m_file_sizes[m_num_patterns] );
+    m_file_hashes[m_num_patterns] = file_hash( filename );
+    ++m_num_patterns;
+  }
+
+  if( m_song.read( "song.txt", m_num_patterns ) )
+  {
+    m_song_position = 0;
+    m_song_loop     = 0;
+    set_current_pattern( m_song.entry(0).m_pattern );
+  }
+  else
+  {
+    set_current_pattern( 0 );
+  }
+}
+
+void PATTERN_SET::set_kits( KIT_SET& kits )
+{
+  m_kits = &kits;
+}
+
+const char* PATTERN_SET::wanted_kit() const
+{
+  return m_patterns[ m_pattern_slots[ pending_pattern() ] ].kit();
+}
+
+void PATTERN_SET::check_for_changes( uint32_t time_ms )
+{
+  if( static_cast<int32_t>( time_ms - m_next_check_time_ms ) < 0 )
+  {
+    return;
+  }
+  m_next_check_time_ms = time_ms + RELOAD_CHECK_INTERVAL_MS;
+
+  // wait for the previous reload to be swapped in, the shadow is still in use
+  if( m_num_patterns == 0 || m_reloaded_pattern >= 0 )
+  {
+    return;
+  }
+  // see the step pool as clock() left it after the last swap
+  std::atomic_thread_fence( std::memory_order_acquire );
+
+  // one file per check to keep the work done in any one call small
+  const int pattern_index = m_next_file_check;
+  m_next_file_check       = ( m_next_file_check + 1 ) % m_num_patterns;
+
+  if( !file_changed( pattern_index ) )
+  {
+    return;
+  }
+
+  const char* filename    = PATTERN_FILENAMES[pattern_index];
+  // a changed size skipped the hash, take it now to compare the next edit against
+  if( m_file_hashes[pattern_index] == 0 )
+  {
+    m_file_hashes[pattern_index] = file_hash( filename );
+  }
+
+  // clock() never touches the shadow or the free steps, so it's safe to read into them here
+  PATTERN& shadow = m_patterns[m_shadow_slot];
+  if( shadow.read( filename, m_drums, m_steps.data() + m_num_steps, MAX_STEPS - m_num_steps ) )
+  {
+    if( shadow.out_of_steps() )
+    {
+      DEBUG_TEXT("Not enough free pattern steps to reload:");
+      DEBUG_TEXT_LINE(filename);
+      return;
+    }
+    DEBUG_TEXT("Reloaded:");
+    DEBUG_TEXT_LINE(filename);
+    // the shadow must be completely written before clock() can see it
+    std::atomic_thread_fence( std::memory_order_release );
+    m_reloaded_pattern    = pattern_index;
   }
 }
 
 void PATTERN_SET::advance_pending_pattern()
 {
-  m_pending_pattern = ( m_pending_pattern + 1 ) % m_num_patterns;
+  if( m_song.active() )
+  {
+    // skip to the next entry in the song at the end of this loop
+    m_skip_requests = m_skip_requests + 1;
+    return;
+  }
+
+  if( m_num_patterns > 0 )
+  {
+    m_pending_pattern = ( m_pending_pattern + 1 ) % m_num_patterns;
+  }
 }
 
-void PATTERN_SET::clock()
+void PATTERN_SET::clock( uint32_t time_us, uint32_t step_period_us )
 {
-  const bool cycle_complete = m_patterns[m_current_pattern].clock();
+  ADD_TIMED_SECTION( PATTERN_CLOCK );
+
+  bool fill = is_pattern_pending();
+  if( m_song.active() )
+  {
+    fill = m_song.entry(m_song_position).m_fill && last_loop_of_song_entry();
+  }
+
+  AUDIO_CLOCK::set_position( m_current_pattern, m_step );
+
+#ifdef MEASURE_TRIGGER_LATENCY
+  TRIGGER_LATENCY::clock( time_us, step_period_us, micros() );
+#endif
+
+  const STEP_TIME step_time = { time_us, step_period_us };
+  const bool cycle_complete = pattern(m_current_pattern).clock(step_time, fill, m_scheduler);
 
-  if( cycle_complete && m_pending_pattern != m_current_pattern )
+  if( !cycle_complete )
   {
-    m_current_pattern = m_pending_pattern;
+    ++m_step;
+    return;
   }
+  m_step = 0;
+
+  const int reloaded_pattern = m_reloaded_pattern;
+  if( reloaded_pattern >= 0 )
+  {
+    std::atomic_thread_fence( std::memory_order_acquire );
+
+    // swap the reloaded pattern in, the old one becomes the shadow and its steps are freed
+    m_num_steps += m_patterns[m_shadow_slot].num_steps();
+    swap( m_pattern_slots[reloaded_pattern], m_shadow_slot );
+    free_steps( m_patterns[m_shadow_slot] );
+    if( reloaded_pattern == m_current_pattern )
+    {
+      pattern(m_current_pattern).start();
+    }
+    // check_for_changes() reads the next reload into the steps after m_num_steps
+    std::atomic_thread_fence( std::memory_order_release );
+    m_reloaded_pattern = -1;
+  }
+
+  if( m_song.active() )
+  {
+    if( last_loop_of_song_entry() )
+    {
+      m_skips_handled   = m_skip_requests;
+      m_song_position   = ( m_song_position + 1 ) % m_song.num_entries();
+      m_song_loop       = 0;
+
+      // restart even if it's the same pattern, so each entry plays back the same
+      set_current_pattern( m_song.entry(m_song_position).m_pattern );
+    }
+    else
+    {
+      m_song_loop       = m_song_loop + 1;
+    }
+  }
+  else if( m_pending_pattern != m_current_pattern )
+  {
+    set_current_pattern( m_pending_pattern );
+  }
+
+  if( m_kits != nullptr )
+  {
+    m_kits->select( pattern(m_current_pattern).kit() );
+  }
+}
+
+void PATTERN_SET::update( uint32_t now_us )
+{
+  ADD_TIMED_SECTION( TRIGGER_UPDATE );
+
+  m_scheduler.update( now_us );
 }
@@ -1,47 +1,153 @@
 #pragma once
 
 #include <array>
+#include "AudioProfiler.h"
 #include "SamplePlayer.h"
+#include "Song.h"
+
+static constexpr int MAX_DRUMS                                                = 5;
+
+#ifdef PROFILE_AUDIO_NODES
+using DRUM_VOICE = PROFILED<SAMPLE_PLAYER_EFFECT>;
+#else
+using DRUM_VOICE = SAMPLE_PLAYER_EFFECT;
+#endif
 
 ////////////////////////////////////////////////////////////
 // plays a single drum hit
 class DRUM
 {
   static constexpr int NUM_VOICES_PER_DRUM                                    = 2;
+
+  // every drum, so triggering one can choke the others in its group
+  static std::array<DRUM*, MAX_DRUMS>                       s_drums;
+  static int                                                s_num_drums;
   
-  std::array< SAMPLE_PLAYER_EFFECT, NUM_VOICES_PER_DRUM>    m_voices;
+  std::array< DRUM_VOICE, NUM_VOICES_PER_DRUM>              m_voices;
   POLYPHONIC_SAMPLE_PLAYER<NUM_VOICES_PER_DRUM>             m_poly_player;
+  const DRUM_SAMPLES&                                       m_default_samples;  // from the bank in flash
+
+  const SAMPLE_LAYER*                                       m_layers;
+  int                                                       m_num_layers;
+  std::array<uint8_t, 128>                                  m_velocity_layer;   // index in m_layers for each velocity
+  std::array<uint8_t, MAX_VELOCITY_LAYERS>                  m_round_robin;      // next sample to play in each layer
+
+  const SAMPLE_BANK_ENTRY*                                  m_kit_sample;       // kits on the SD card have one sample per drum
+  SAMPLE_LAYER                                              m_kit_layer;
+  VOICE_ENVELOPE                                            m_envelope;         // set by the current pattern
+  uint8_t                                                   m_choke_group;      // 0 for none, set by the current pattern
+
+  void                                                      choke();
+  void                                                      set_layers( const SAMPLE_LAYER* layers, int num_layers );
   
 public:
 
-  DRUM( const uint16_t* sample_data );
+  DRUM( const char* name, const DRUM_SAMPLES& samples );   // name is for the profiler, each voice is name.index
 
   inline SAMPLE_PLAYER_EFFECT&                           voice( int vi )        { return m_voices[vi]; }
   static constexpr int                                   num_voices_per_drum()  { return NUM_VOICES_PER_DRUM; }
   static constexpr float                                 voice_mix()            { return (1.0f / NUM_VOICES_PER_DRUM); }
 
-  void                                                   trigger( int pitch, float gain );
+  void                                                   trigger( int pitch, int velocity, uint32_t time_us );
+
+  void                                                   set_sample( const SAMPLE_BANK_ENTRY* sample );  // nullptr for the default sample
+  void                                                   set_envelope( const VOICE_ENVELOPE& envelope );
+  void                                                   set_choke_group( int group );   // triggering a drum fades out the others in its group
+  void                                                   stop_voices_playing( const void* begin, const void* end );
 };
 
-static constexpr int MAX_DRUMS                                                = 5;
 using DRUM_SET = std::array<DRUM*, MAX_DRUMS>;
 
+static constexpr int TICKS_PER_STEP                                           = 12;   // resolution of microtiming within a step
+
 ////////////////////////////////////////////////////////////
-// a sequence for a single drum
-class SEQUENCE
+// timing of a single step
+struct STEP_TIME
+{
+  uint32_t                                                m_time_us;          // time of the clock tick which starts the step
+  uint32_t                                                m_period_us;        // predicted duration of the step
+};
+
+////////////////////////////////////////////////////////////
+// triggers due after the start of a step, kept sorted by time so only the first needs checking
+class TRIGGER_SCHEDULER
 {
-  struct TRIGGER
+  struct EVENT
   {
-    static constexpr int EMPTY                                                = -127;
-    int8_t                                                m_pitch             = EMPTY;
-    uint8_t                                               m_velocity          = 0;
+    uint32_t                                              m_time_us;
+    DRUM*                                                 m_drum;
+    int8_t                                                m_pitch;
+    uint8_t                                               m_velocity;
   };
-  
+
+  static constexpr int MAX_EVENTS                                             = 32;
+  std::array<EVENT, MAX_EVENTS>                           m_events;
+  uint8_t                                                 m_num_events        = 0;
+
+public:
+
+  void                                                    schedule( uint32_t time_us, DRUM& drum, int pitch, int velocity );
+  void                                                    update( uint32_t now_us );
+};
+
+////////////////////////////////////////////////////////////
+// state shared by all the sequences in a pattern when they are clocked
+struct SEQUENCE_CONTEXT
+{
+  STEP_TIME                                               m_step_time;
+  int                                                     m_swing_ticks;
+  bool                                                    m_fill;             // the loop before a pattern change
+  RANDOM&                                                 m_random;
+  TRIGGER_SCHEDULER&                                      m_scheduler;
+};
+
+////////////////////////////////////////////////////////////
+// a single step of a sequence
+struct TRIGGER
+{
+  static constexpr int EMPTY                                                  = -127;
+  static constexpr int MAX_RATCHETS                                           = 4;
+  int8_t                                                  m_pitch             = EMPTY;
+  uint8_t                                                 m_velocity          = 0;
+  uint8_t                                                 m_offset            = 0;    // in ticks after the start of the step
+  uint8_t                                                 m_ratchets          = 1;    // number of times triggered within the step
+  uint8_t                                                 m_probability       = 100;  // percent
+  uint8_t                                                 m_every             = 1;    // only trigger every nth loop
+  uint8_t                                                 m_fill_only   : 1;
+  uint8_t                                                 m_not_first   : 1;          // not on the first loop after the pattern starts
+
+  TRIGGER() :
+    m_fill_only(false),
+    m_not_first(false)
+  {
+  }
+
+  bool                                                    parse( char* text );
+};
+
+////////////////////////////////////////////////////////////
+// a sequence for a single drum, either read from a list of steps or generated (see read_generator())
+class SEQUENCE
+{
   static constexpr int MAX_SEQUENCE_SIZE                                      = 32;
   DRUM*                                                   m_drum              = nullptr;
-  std::array<TRIGGER, MAX_SEQUENCE_SIZE>                  m_sequence;
+  const TRIGGER*                                          m_steps             = nullptr;  // in the pattern set's step pool, nullptr when generated
   int8_t                                                  m_beat              = 0;
   int8_t                                                  m_sequence_length   = 0;
+  uint16_t                                                m_loop_count        = 0;
+
+  // euclidean generator, hits spread as evenly as possible over the sequence length
+  TRIGGER                                                 m_generated_trigger;
+  uint8_t                                                 m_hits              = 0;
+  uint8_t                                                 m_rotation          = 0;
+  uint32_t                                                m_accent_mask       = 0;  // steps played at full velocity
+
+  VOICE_ENVELOPE                                          m_envelope;         // applied to the drum when the pattern starts
+  uint8_t                                                 m_choke_group       = 0;
+
+  bool                                                    read_generator( File& file );
+  bool                                                    step( int beat, TRIGGER& trig ) const;
+  bool                                                    should_trigger( const TRIGGER& trig, SEQUENCE_CONTEXT& context ) const;
   
 public:
 
@@ -49,9 +155,14 @@ public:
   SEQUENCE( DRUM& drum );
 
   int                                                     sequence_length() const;
+  int                                                     num_stored_steps() const;
 
-  bool                                                    read(File& file);
-  bool                                                    clock(int id);
+  bool                                                    read( File& file, TRIGGER* steps, int max_steps, bool& out_of_steps );
+  void                                                    move_steps( int offset );   // when the step pool is compacted
+  void                                                    set_envelope( const VOICE_ENVELOPE& envelope );
+  void                                                    set_choke_group( int group );
+  void                                                    start();
+  bool                                                    clock( int id, SEQUENCE_CONTEXT& context );
 };
 
 using SEQUENCE_SET = std::array<SEQUENCE, MAX_DRUMS>;
@@ -61,33 +172,89 @@ using SEQUENCE_SET = std::array<SEQUENCE, MAX_DRUMS>;
 class PATTERN
 {
   SEQUENCE_SET                                            m_sequences;
+  TRIGGER*                                                m_steps            = nullptr; // in the pattern set's step pool, generated sequences don't use any
+  uint16_t                                                m_num_steps        = 0;
+  bool                                                    m_out_of_steps     = false;   // the pool ran out before every step was read
   uint8_t                                                 m_leading_sequence = 0; // the longest sequence, when this ends we can change the pattern
+  uint8_t                                                 m_swing_ticks      = 0; // delay applied to every other step
+  uint32_t                                                m_seed             = 1;
+  RANDOM                                                  m_random;
+  char                                                    m_kit[13]          = {};  // kit file on the SD card, empty for the bank in flash
+
+  void                                                    read_directive( File& file );
   
 public:
 
-  bool                                                    read( const char* filename, const DRUM_SET& drums ); 
+  bool                                                    read( const char* filename, const DRUM_SET& drums, TRIGGER* steps, int max_steps );   // false if the file can't be opened
 
-  bool                                                    clock();   // returns true if this clock cycle ends the loop                          
+  TRIGGER*                                                steps() const;
+  int                                                     num_steps() const;
+  bool                                                    out_of_steps() const;
+  void                                                    move_steps( int offset );
+  const char*                                             kit() const;
+  void                                                    start();    // call when the pattern becomes current, so it always plays back the same
+  bool                                                    clock( const STEP_TIME& step_time, bool fill, TRIGGER_SCHEDULER& scheduler );   // returns true if this clock cycle ends the loop                          
 };
 
+class KIT_SET;
+
 ////////////////////////////////////////////////////////////
 // A set of patterns that can e cycle through
 class PATTERN_SET
 {
-  static constexpr int MAX_PATTERNS                       = 4;
-  PATTERN                                                 m_patterns[MAX_PATTERNS];
+  static constexpr int MAX_PATTERNS                       = 8;
+  static constexpr int MAX_STEPS                          = 800;    // the same RAM as 4 patterns of 5 full sequences and the shadow
+  static constexpr int RELOAD_CHECK_INTERVAL_MS           = 1000;
+  PATTERN                                                 m_patterns[MAX_PATTERNS + 1];   // the extra pattern is a shadow to reload into
+  std::array<TRIGGER, MAX_STEPS>                          m_steps;                        // shared by every pattern, each takes only the steps it stores
+  uint16_t                                                m_num_steps       = 0;          // in use by the patterns, the shadow reads into the rest
+  uint8_t                                                 m_pattern_slots[MAX_PATTERNS];  // index in m_patterns of each pattern
+  uint8_t                                                 m_shadow_slot     = MAX_PATTERNS;
+  TRIGGER_SCHEDULER                                       m_scheduler;
+
+  DRUM_SET                                                m_drums;
+  uint32_t                                                m_file_sizes[MAX_PATTERNS];     // to detect when a pattern file has changed
+  uint32_t                                                m_file_hashes[MAX_PATTERNS];
+  uint32_t                                                m_next_check_time_ms  = 0;
+  uint8_t                                                 m_next_file_check     = 0;
+  volatile int8_t                                         m_reloaded_pattern    = -1;     // set once the shadow is loaded, cleared by clock() when swapped in
 
   uint8_t                                                 m_num_patterns    = 0;
-  uint8_t                                                 m_current_pattern = 0;
-  uint8_t                                                 m_pending_pattern = 0;
+
+  // each is only written from one context, so the UI can post requests while clock() runs in an interrupt
+  volatile uint8_t                                        m_current_pattern = 0;    // written by clock()
+  volatile uint8_t                                        m_pending_pattern = 0;    // written by the UI
+  volatile uint8_t                                        m_skip_requests   = 0;    // written by the UI, in song mode
+
+  KIT_SET*                                                m_kits            = nullptr;
+
+  SONG                                                    m_song;
+  volatile uint8_t                                        m_song_position   = 0;    // written by clock()
+  volatile uint8_t                                        m_song_loop       = 0;    // loops played of the current song entry
+  uint8_t                                                 m_step            = 0;    // clock ticks into the current loop, for the deadline log
+  uint8_t                                                 m_skips_handled   = 0;
+
+  bool                                                    last_loop_of_song_entry() const;
+  void                                                    set_current_pattern( int pattern );
+  PATTERN&                                                pattern( int pattern );
+  void                                                    free_steps( PATTERN& old_pattern );
+
+  static bool                                             file_size( const char* filename, uint32_t& size );
+  static uint32_t                                         file_hash( const char* filename );
+  bool                                                    file_changed( int pattern_index );
 
 public:
 
   bool                                                    is_pattern_pending() const;
   int                                                     current_pattern() const;
   int                                                     pending_pattern() const;
+  int                                                     num_patterns() const;
 
   void                                                    read( const DRUM_SET& drums );
+  void                                                    set_kits( KIT_SET& kits );     // switch kits at loop boundaries as the patterns ask
+  const char*                                             wanted_kit() const;            // kit of the pending (or current) pattern, to preload
+  void                                                    check_for_changes( uint32_t time_ms );  // reload any pattern file which has changed, call from loop()
   void                                                    advance_pending_pattern();  
-  void                                                    clock();
+  void                                                    clock( uint32_t time_us, uint32_t step_period_us );  // time_us is the time of the clock edge (from micros())
+  void                                                    update( uint32_t now_us );                          // fires any triggers scheduled within a step
 };
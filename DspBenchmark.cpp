@@ -0,0 +1,233 @@
+#include <math.h>
+
+#include "Util.h"
+#include "DspBenchmark.h"
+#include "FixedPoint.h"
+#include "MultiMixer.h"
+#include "SampleInterpolation.h"
+#include "SampleDecoder.h"
+
+// only compiled in when asked for, the test data takes RAM
+#ifdef BENCHMARK_DSP
+
+namespace
+{
+  constexpr float BENCHMARK_SPEEDS[]        = { 0.5f, 1.0f, 1.4983f, 2.0f };
+  constexpr int   BENCHMARK_BLOCK_SIZES[]   = { 32, AUDIO_BLOCK_SAMPLES };
+  constexpr float BENCHMARK_GAINS[]         = { 1.0f, 0.5f, 1.5f };
+  constexpr float BENCHMARK_CLIP[]          = { 0.1f, 0.5f };
+  constexpr int   DATA_LENGTH               = 1024;   // enough for a block at the fastest speed
+
+  // in RAM so flash wait states don't vary the results
+  int16_t         benchmark_data[ DATA_LENGTH ];
+  int16_t         benchmark_block[ AUDIO_BLOCK_SAMPLES ];
+
+  // results go here so the kernels can't be optimised away
+  volatile int32_t benchmark_sink           = 0;
+
+  // best of the runs, the others were interrupted or missed the cache
+  template< typename KERNEL >
+  uint32_t best_cycles( int runs, KERNEL kernel )
+  {
+    uint32_t best = UINT32_MAX;
+    for( int r = 0; r < runs; ++r )
+    {
+      __disable_irq();
+      const uint32_t start_cycles = ARM_DWT_CYCCNT;
+      kernel();
+      const uint32_t cycles       = ARM_DWT_CYCCNT - start_cycles;
+      __enable_irq();
+
+      best                        = min_val( best, cycles );
+    }
+    return best;
+  }
+}
+
+void DSP_BENCHMARK::print_result( const char* kernel, const char* param_name, float param, int num_samples, uint32_t cycles )
+{
+  Serial.print( kernel );
+  Serial.print( "\t" );
+  Serial.print( param_name );
+  Serial.print( "\t" );
+  Serial.print( param );
+  Serial.print( "\t" );
+  Serial.print( num_samples );
+  Serial.print( "\t" );
+  Serial.print( cycles );
+  Serial.print( "\t" );
+  Serial.println( static_cast<float>( cycles ) / num_samples );
+}
+
+void DSP_BENCHMARK::interpolators()
+{
+  PCM_READER reader;
+  reader.m_data               = benchmark_data;
+  const FIXED_POINT gain( 0.7f );
+
+  for( float speed : BENCHMARK_SPEEDS )
+  {
+    const FIXED_POINT speed_fp( speed );
+    for( int num_samples : BENCHMARK_BLOCK_SIZES )
+    {
+      const uint32_t linear = best_cycles( RUNS, [&]()
+      {
+        int32_t sum           = 0;
+        FIXED_POINT read_head( 1.0f );
+        for( int i = 0; i < num_samples; ++i )
+        {
+          sum                += SAMPLE_INTERPOLATION::read_sample_linear_fp( reader, read_head, DATA_LENGTH, gain );
+          read_head          += speed_fp;
+        }
+        benchmark_sink        = sum;
+      } );
+      print_result( "read_sample_linear_fp", "speed", speed, num_samples, linear );
+
+      const uint32_t cubic = best_cycles( RUNS, [&]()
+      {
+        int32_t sum           = 0;
+        FIXED_POINT read_head( 1.0f );
+        for( int i = 0; i < num_samples; ++i )
+        {
+          sum                += SAMPLE_INTERPOLATION::read_sample_cubic_fp( reader, read_head, DATA_LENGTH, gain );
+          read_head          += speed_fp;
+        }
+        benchmark_sink        = sum;
+      } );
+      print_result( "read_sample_cubic_fp", "speed", speed, num_samples, cubic );
+
+      const uint32_t cubic_float = best_cycles( RUNS, [&]()
+      {
+        int32_t sum           = 0;
+        float read_head       = 1.0f;
+        for( int i = 0; i < num_samples; ++i )
+        {
+          sum                += DSP_UTILS::read_sample_cubic( read_head, benchmark_data, DATA_LENGTH );
+          read_head          += speed;
+        }
+        benchmark_sink        = sum;
+      } );
+      print_result( "DSP_UTILS::read_sample_cubic", "speed", speed, num_samples, cubic_float );
+    }
+  }
+}
+
+void DSP_BENCHMARK::mixer()
+{
+  for( float gain : BENCHMARK_GAINS )
+  {
+    const int32_t mult        = static_cast<int32_t>( gain * MIXER_KERNELS::UNITY_GAIN );
+
+    const uint32_t apply_gain = best_cycles( RUNS, [&]()
+    {
+      MIXER_KERNELS::apply_gain( benchmark_block, mult );
+    } );
+    print_result( "MIXER_KERNELS::apply_gain", "gain", gain, AUDIO_BLOCK_SAMPLES, apply_gain );
+
+    const uint32_t gain_then_add = best_cycles( RUNS, [&]()
+    {
+      MIXER_KERNELS::apply_gain_then_add( benchmark_data, benchmark_block, mult );
+    } );
+    print_result( "MIXER_KERNELS::apply_gain_then_add", "gain", gain, AUDIO_BLOCK_SAMPLES, gain_then_add );
+  }
+}
+
+void DSP_BENCHMARK::soft_clip()
+{
+  for( float clip_coefficient : BENCHMARK_CLIP )
+  {
+    for( int num_samples : BENCHMARK_BLOCK_SIZES )
+    {
+      const uint32_t cycles = best_cycles( RUNS, [&]()
+      {
+        int32_t sum           = 0;
+        for( int i = 0; i < num_samples; ++i )
+        {
+          sum                += DSP_UTILS::soft_clip_sample( benchmark_data[i], clip_coefficient );
+        }
+        benchmark_sink        = sum;
+      } );
+      print_result( "soft_clip_sample", "clip", clip_coefficient, num_samples, cycles );
+    }
+  }
+}
+
+void DSP_BENCHMARK::fixed_point()
+{
+  constexpr int NUM_OPS       = AUDIO_BLOCK_SAMPLES;
+  const FIXED_POINT gain( 0.7f );
+  const FIXED_POINT negative_gain( -0.7f );
+  const FIXED_POINT t( 0.4f );
+
+  const uint32_t add = best_cycles( RUNS, [&]()
+  {
+    FIXED_POINT sum( 0.0f );
+    for( int i = 0; i < NUM_OPS; ++i )
+    {
+      sum                     = sum + FIXED_POINT( benchmark_data[i] );
+    }
+    benchmark_sink            = sum.trunc_to_int32();
+  } );
+  print_result( "FIXED_POINT +", "-", 0.0f, NUM_OPS, add );
+
+  // the sign of each side takes a different path
+  for( const FIXED_POINT& mult : { gain, negative_gain } )
+  {
+    const uint32_t multiply = best_cycles( RUNS, [&]()
+    {
+      int32_t sum             = 0;
+      for( int i = 0; i < NUM_OPS; ++i )
+      {
+        sum                  += ( FIXED_POINT( benchmark_data[i] ) * mult ).trunc_to_int32();
+      }
+      benchmark_sink          = sum;
+    } );
+    print_result( "FIXED_POINT *", "by", mult.to_float(), NUM_OPS, multiply );
+  }
+
+  const uint32_t lerp_cycles = best_cycles( RUNS, [&]()
+  {
+    int32_t sum               = 0;
+    for( int i = 0; i < NUM_OPS; ++i )
+    {
+      sum                    += lerp<FIXED_POINT>( FIXED_POINT( benchmark_data[i] ), FIXED_POINT( benchmark_data[i + 1] ), t ).trunc_to_int32();
+    }
+    benchmark_sink            = sum;
+  } );
+  print_result( "lerp<FIXED_POINT>", "t", t.to_float(), NUM_OPS, lerp_cycles );
+
+  const uint32_t cubic = best_cycles( RUNS, [&]()
+  {
+    int32_t sum               = 0;
+    for( int i = 0; i < NUM_OPS; ++i )
+    {
+      sum                    += cubic_interpolation<FIXED_POINT>( FIXED_POINT( benchmark_data[i] ), FIXED_POINT( benchmark_data[i + 1] ),
+                                                                  FIXED_POINT( benchmark_data[i + 2] ), FIXED_POINT( benchmark_data[i + 3] ), t ).trunc_to_int32();
+    }
+    benchmark_sink            = sum;
+  } );
+  print_result( "cubic_interpolation<FIXED_POINT>", "t", t.to_float(), NUM_OPS, cubic );
+}
+
+void DSP_BENCHMARK::run()
+{
+  // a full scale sine with some harmonics, every sign and magnitude gets exercised
+  for( int i = 0; i < DATA_LENGTH; ++i )
+  {
+    const float phase         = ( i * 2.0f * M_PI ) / 97.0f;
+    benchmark_data[i]         = static_cast<int16_t>( ( sinf( phase ) * 0.8f + sinf( phase * 3.0f ) * 0.15f ) * INT16_MAX );
+  }
+
+  for( int16_t& sample : benchmark_block )
+  {
+    sample                    = 0;
+  }
+
+  Serial.println( "kernel\tparam\tvalue\tsamples\tcycles\tcycles/sample" );
+  interpolators();
+  mixer();
+  soft_clip();
+  fixed_point();
+}
+
+#endif // BENCHMARK_DSP
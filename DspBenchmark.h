@@ -0,0 +1,25 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "CompileSwitches.h"
+
+/////////////////////////////////////////////////////////
+
+// cycle counts of the inner DSP kernels across speeds, gains and block sizes, as a baseline for optimising them.
+// Each case is the best of several runs with interrupts off, so the audio glitches while it runs.
+class DSP_BENCHMARK
+{
+  static constexpr int  RUNS                = 8;
+
+  static void           print_result( const char* kernel, const char* param_name, float param, int num_samples, uint32_t cycles );
+
+  static void           interpolators();
+  static void           mixer();
+  static void           soft_clip();
+  static void           fixed_point();
+
+public:
+
+  static void           run();              // table over Serial, from loop()
+};
@@ -0,0 +1,211 @@
+#include <math.h>
+
+#include "GoldenAudio.h"
+
+namespace
+{
+  const char* const     GOLDEN_FILE_NAME    = "GOLDEN.RAW";
+  constexpr uint32_t    FNV_OFFSET_BASIS    = 2166136261u;
+  constexpr uint32_t    FNV_PRIME           = 16777619u;
+
+  const std::array<int16_t, AUDIO_BLOCK_SAMPLES> SILENCE = {};
+}
+
+GOLDEN_AUDIO::GOLDEN_AUDIO() :
+  AudioStream( 1, m_input_queue_array ),
+  m_queue(),
+  m_blocks_to_capture( 0 ),
+  m_dropped( 0 ),
+  m_file(),
+  m_recording( false ),
+  m_finished( false ),
+  m_passed( false ),
+  m_tolerance( 0 ),
+  m_total_blocks( 0 ),
+  m_blocks( 0 ),
+  m_run_hash( FNV_OFFSET_BASIS ),
+  m_mismatched_blocks( 0 ),
+  m_first_mismatch( -1 ),
+  m_max_deviation( 0 ),
+  m_sum_squared_deviation( 0 )
+{
+}
+
+void GOLDEN_AUDIO::update()
+{
+  audio_block_t* block = receiveReadOnly();
+
+  if( m_blocks_to_capture == 0 )
+  {
+    if( block != nullptr )
+    {
+      release( block );
+    }
+    return;
+  }
+  m_blocks_to_capture = m_blocks_to_capture - 1;
+
+  // held until loop() has written or compared it
+  if( !m_queue.push( block ) )
+  {
+    m_dropped = m_dropped + 1;
+    if( block != nullptr )
+    {
+      release( block );
+    }
+  }
+}
+
+void GOLDEN_AUDIO::start( uint32_t num_blocks )
+{
+  if( SD.exists( GOLDEN_FILE_NAME ) )
+  {
+    m_file              = SD.open( GOLDEN_FILE_NAME, FILE_READ );
+    m_recording         = false;
+  }
+  else
+  {
+    m_file              = SD.open( GOLDEN_FILE_NAME, FILE_WRITE );
+    m_recording         = true;
+  }
+
+  if( !m_file )
+  {
+    Serial.print( "Golden audio: can't open " );
+    Serial.println( GOLDEN_FILE_NAME );
+    return;
+  }
+
+  Serial.print( m_recording ? "Golden audio: recording " : "Golden audio: comparing " );
+  Serial.print( num_blocks );
+  Serial.println( " blocks" );
+
+  m_total_blocks        = num_blocks;
+  m_blocks_to_capture   = num_blocks;
+}
+
+uint32_t GOLDEN_AUDIO::block_hash( const int16_t* data )
+{
+  // FNV-1a
+  const uint8_t* bytes  = reinterpret_cast<const uint8_t*>( data );
+  uint32_t hash         = FNV_OFFSET_BASIS;
+  for( int i = 0; i < BLOCK_BYTES; ++i )
+  {
+    hash                = ( hash ^ bytes[i] ) * FNV_PRIME;
+  }
+  return hash;
+}
+
+void GOLDEN_AUDIO::compare( const int16_t* data, uint32_t hash )
+{
+  uint32_t golden_hash  = 0;
+  std::array<int16_t, AUDIO_BLOCK_SAMPLES> golden;
+  const bool read       = m_file.read( &golden_hash, sizeof(golden_hash) ) == static_cast<int>( sizeof(golden_hash) ) &&
+                          m_file.read( golden.data(), BLOCK_BYTES ) == BLOCK_BYTES;
+  if( read && golden_hash == hash )
+  {
+    return;
+  }
+
+  // past the end of the recording compare with silence
+  const int16_t* expected = read ? golden.data() : SILENCE.data();
+  bool mismatch         = !read;
+  for( int i = 0; i < AUDIO_BLOCK_SAMPLES; ++i )
+  {
+    const int32_t deviation   = abs( data[i] - expected[i] );
+    m_max_deviation           = max_val( m_max_deviation, deviation );
+    m_sum_squared_deviation  += deviation * deviation;
+    mismatch                 |= deviation != 0;
+  }
+
+  if( mismatch )
+  {
+    ++m_mismatched_blocks;
+    if( m_first_mismatch < 0 )
+    {
+      m_first_mismatch  = m_blocks;
+    }
+  }
+}
+
+void GOLDEN_AUDIO::process()
+{
+  if( m_total_blocks == 0 )
+  {
+    return;
+  }
+
+  audio_block_t* block;
+  while( m_queue.pop( block ) )
+  {
+    const int16_t* data   = block != nullptr ? block->data : SILENCE.data();
+    const uint32_t hash   = block_hash( data );
+    m_run_hash            = ( m_run_hash ^ hash ) * FNV_PRIME;
+
+    if( m_recording )
+    {
+      m_file.write( reinterpret_cast<const uint8_t*>( &hash ), sizeof(hash) );
+      m_file.write( reinterpret_cast<const uint8_t*>( data ), BLOCK_BYTES );
+    }
+    else
+    {
+      compare( data, hash );
+    }
+
+    if( block != nullptr )
+    {
+      release( block );
+    }
+    ++m_blocks;
+  }
+
+  if( m_blocks + m_dropped >= m_total_blocks )
+  {
+    finish();
+  }
+}
+
+void GOLDEN_AUDIO::finish()
+{
+  m_file.close();
+  m_total_blocks        = 0;
+  m_finished            = true;
+
+  Serial.print( "Golden audio: " );
+  Serial.print( m_blocks );
+  Serial.print( " blocks, run hash:" );
+  Serial.println( m_run_hash, HEX );
+
+  if( m_dropped > 0 )
+  {
+    // the run isn't complete, so neither is a recording of it
+    Serial.print( "Golden audio FAILED: dropped " );
+    Serial.print( m_dropped );
+    Serial.println( " blocks, loop() fell behind" );
+    if( m_recording )
+    {
+      SD.remove( GOLDEN_FILE_NAME );
+    }
+    return;
+  }
+
+  if( m_recording )
+  {
+    m_passed            = true;
+    Serial.print( "Golden audio recorded to " );
+    Serial.println( GOLDEN_FILE_NAME );
+    return;
+  }
+
+  const float rms_deviation = sqrtf( static_cast<float>( m_sum_squared_deviation ) / ( m_blocks * AUDIO_BLOCK_SAMPLES ) );
+  m_passed              = m_max_deviation <= m_tolerance;
+  Serial.print( m_passed ? "Golden audio PASSED" : "Golden audio FAILED" );
+  Serial.print( " mismatched blocks:" );
+  Serial.print( m_mismatched_blocks );
+  Serial.print( " first:" );
+  Serial.print( m_first_mismatch );
+  Serial.print( " max deviation:" );
+  Serial.print( m_max_deviation );
+  Serial.print( " rms deviation:" );
+  Serial.println( rms_deviation, 3 );
+}
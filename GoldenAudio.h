@@ -0,0 +1,53 @@
+#pragma once
+
+#include <array>
+#include <Audio.h>
+#include <SD.h>
+
+#include "CompileSwitches.h"
+#include "Util.h"
+
+/////////////////////////////////////////////////////////
+
+// captures a fixed number of blocks from the end of the graph, then loop() records them to the SD card or, when
+// a recording is already there, compares them with it. Each block is stored with its hash, so identical blocks
+// are compared without touching the samples.
+class GOLDEN_AUDIO : public AudioStream
+{
+  static constexpr int  QUEUE_SIZE          = 16;   // power of 2, blocks held until loop() writes or compares them (from the pool the delay line leaves)
+  static constexpr int  BLOCK_BYTES         = AUDIO_BLOCK_SAMPLES * sizeof(int16_t);
+
+  audio_block_t*        m_input_queue_array[1];
+  LOCKLESS_QUEUE<audio_block_t*, QUEUE_SIZE> m_queue;   // nullptr for a silent block
+  volatile uint32_t     m_blocks_to_capture;
+  volatile uint32_t     m_dropped;          // the queue was full, loop() fell behind
+
+  File                  m_file;
+  bool                  m_recording;
+  bool                  m_finished;
+  bool                  m_passed;
+  int32_t               m_tolerance;        // largest sample difference that still passes
+  uint32_t              m_total_blocks;
+  uint32_t              m_blocks;           // written or compared
+  uint32_t              m_run_hash;         // of every block hash, to compare runs by eye
+  uint32_t              m_mismatched_blocks;
+  int32_t               m_first_mismatch;
+  int32_t               m_max_deviation;
+  uint64_t              m_sum_squared_deviation;
+
+  static uint32_t       block_hash( const int16_t* data );
+  void                  compare( const int16_t* data, uint32_t hash );
+  void                  finish();
+
+public:
+
+  GOLDEN_AUDIO();
+  virtual void          update() override;
+
+  void                  start( uint32_t num_blocks );   // from setup(), with audio interrupts off so it starts on the same block as the clock
+  void                  set_tolerance( int32_t max_deviation )  { m_tolerance = max_deviation; }  // raise for an intentional numeric change
+  void                  process();                      // from loop()
+
+  bool                  finished() const                { return m_finished; }
+  bool                  passed() const                  { return m_passed; }   // recorded, or compared within the tolerance
+};
@@ -0,0 +1,266 @@
+#include "CompileSwitches.h"
+#include "Util.h"
+
+#include "Kit.h"
+#include "TimedSection.h"
+
+namespace
+{
+  uint16_t read_u16( const uint8_t* p )
+  {
+    return p[0] | ( p[1] << 8 );
+  }
+
+  uint32_t read_u32( const uint8_t* p )
+  {
+    return read_u16( p ) | ( static_cast<uint32_t>( read_u16( p + 2 ) ) << 16 );
+  }
+}
+
+////////////////////////////////////////////////////////////
+
+uint8_t* SAMPLE_ARENA::allocate( uint32_t bytes )
+{
+  const uint32_t aligned_bytes = ( bytes + 3 ) & ~3u;
+  if( aligned_bytes > ARENA_BYTES - m_used )
+  {
+    return nullptr;
+  }
+
+  uint8_t* memory = m_memory.data() + m_used;
+  m_used         += aligned_bytes;
+  return memory;
+}
+
+void SAMPLE_ARENA::reset()
+{
+  m_used = 0;
+}
+
+////////////////////////////////////////////////////////////
+
+bool KIT::is( const char* name ) const
+{
+  return strncmp( m_name, name, MAX_NAME_LENGTH - 1 ) == 0;
+}
+
+////////////////////////////////////////////////////////////
+
+bool KIT_SET::start_load( const char* name )
+{
+  m_load_start_us = micros();
+
+  // voices can still be playing out from the back kit after the last switch, and select() mustn't swap it in half loaded
+  AudioNoInterrupts();
+  KIT& back       = m_kits[ 1 - m_front ];
+  back.m_loaded   = false;
+  for( DRUM* drum : m_drums )
+  {
+    drum->stop_voices_playing( back.m_arena.begin(), back.m_arena.end() );
+  }
+  AudioInterrupts();
+
+  if( back.m_stream_file )
+  {
+    back.m_stream_file.close();
+  }
+
+  strncpy( back.m_name, name, KIT::MAX_NAME_LENGTH - 1 );
+  back.m_num_samples  = 0;
+  back.m_arena.reset();
+
+  m_file = SD.open( name, FILE_READ );
+  if( !m_file )
+  {
+    DEBUG_TEXT("Kit not found:");
+    DEBUG_TEXT_LINE(name);
+    return false;
+  }
+
+  uint8_t header[SD_KIT_SECTOR_BYTES];
+  if( m_file.read( header, SD_KIT_SECTOR_BYTES ) != SD_KIT_SECTOR_BYTES ||
+      read_u32( header ) != SD_KIT_MAGIC ||
+      read_u16( header + 4 ) != SD_KIT_VERSION )
+  {
+    DEBUG_TEXT("Not a kit file:");
+    DEBUG_TEXT_LINE(name);
+    m_file.close();
+    return false;
+  }
+
+  const int num_samples     = min_val<int>( read_u16( header + 6 ), MAX_DRUMS );
+  const uint32_t data_bytes = read_u32( header + 8 );
+  uint8_t* data             = back.m_arena.allocate( data_bytes );
+  if( data == nullptr )
+  {
+    DEBUG_TEXT("Kit too big for arena:");
+    DEBUG_TEXT_LINE(data_bytes);
+    m_file.close();
+    return false;
+  }
+
+  for( int si = 0; si < num_samples; ++si )
+  {
+    const uint8_t* entry      = header + SD_KIT_HEADER_BYTES + ( si * SD_KIT_ENTRY_BYTES );
+    const uint32_t offset     = read_u32( entry );
+    SAMPLE_BANK_ENTRY& sample = back.m_samples[si];
+    sample.m_data             = reinterpret_cast<const int16_t*>( data + offset );
+    sample.m_length           = read_u32( entry + 4 );
+    sample.m_sample_rate      = read_u32( entry + 8 );
+    sample.m_format           = entry[12];
+    sample.m_peak             = static_cast<int16_t>( read_u16( entry + 14 ) );
+    sample.m_loop_start       = read_u32( entry + 16 );
+    sample.m_loop_end         = read_u32( entry + 20 );
+    sample.m_resident_length  = read_u32( entry + 24 );
+    sample.m_stream_file      = sample.m_resident_length < sample.m_length ? &back.m_stream_file : nullptr;
+    sample.m_stream_offset    = read_u32( entry + 28 );
+    for( int level = 0; level < EFFECTIVE_END_LEVELS; ++level )
+    {
+      sample.m_effective_end[level] = read_u32( entry + 32 + ( level * 4 ) );
+    }
+
+    if( !is_playable( sample ) || ( offset & 3 ) != 0 || offset > data_bytes || encoded_bytes( sample ) > data_bytes - offset )
+    {
+      DEBUG_TEXT("Bad sample in kit:");
+      DEBUG_TEXT_LINE(si);
+      m_file.close();
+      return false;
+    }
+  }
+  back.m_num_samples  = num_samples;
+
+  m_load_position     = data;
+  m_load_remaining    = data_bytes;
+  m_loading           = true;
+
+  return true;
+}
+
+void KIT_SET::continue_load()
+{
+  KIT& back             = m_kits[ 1 - m_front ];
+
+  // one sector per call, so loop() keeps running while the kit loads
+  const uint32_t bytes  = min_val<uint32_t>( m_load_remaining, SD_KIT_SECTOR_BYTES );
+  if( m_file.read( m_load_position, bytes ) != static_cast<int>( bytes ) )
+  {
+    DEBUG_TEXT("Kit file truncated:");
+    DEBUG_TEXT_LINE(back.m_name);
+    strncpy( m_failed_kit, back.m_name, KIT::MAX_NAME_LENGTH - 1 );
+    m_file.close();
+    m_loading           = false;
+    return;
+  }
+
+  m_load_position      += bytes;
+  m_load_remaining     -= bytes;
+  if( m_load_remaining > 0 )
+  {
+    return;
+  }
+
+  m_file.close();
+  m_loading             = false;
+
+  // streamed samples read from their own handle, so the next kit can load while they play
+  for( int si = 0; si < back.m_num_samples; ++si )
+  {
+    if( back.m_samples[si].m_stream_file != nullptr )
+    {
+      back.m_stream_file = SD.open( back.m_name, FILE_READ );
+      break;
+    }
+  }
+  back.m_loaded         = true;
+
+  DEBUG_TEXT("Loaded kit:");
+  DEBUG_TEXT(back.m_name);
+  DEBUG_TEXT(" ms:");
+  DEBUG_TEXT( ( micros() - m_load_start_us ) / 1000.0f );
+  DEBUG_TEXT(" arena:");
+  DEBUG_TEXT(back.m_arena.used());
+  DEBUG_TEXT("/");
+  DEBUG_TEXT_LINE(SAMPLE_ARENA::capacity());
+}
+
+void KIT_SET::set_drums( const DRUM_SET& drums )
+{
+  m_drums = drums;
+}
+
+void KIT_SET::update( const char* wanted_kit )
+{
+  ADD_TIMED_SECTION( KIT_LOAD );
+
+  if( m_loading )
+  {
+    if( m_kits[ 1 - m_front ].is( wanted_kit ) )
+    {
+      continue_load();
+      return;
+    }
+
+    // the patterns have moved on since this load started
+    m_file.close();
+    m_loading = false;
+  }
+
+  if( wanted_kit[0] == '\0' || strncmp( wanted_kit, m_failed_kit, KIT::MAX_NAME_LENGTH - 1 ) == 0 )
+  {
+    return;
+  }
+
+  for( const KIT& kit : m_kits )
+  {
+    if( kit.m_loaded && kit.is( wanted_kit ) )
+    {
+      return;
+    }
+  }
+
+  if( !start_load( wanted_kit ) )
+  {
+    strncpy( m_failed_kit, wanted_kit, KIT::MAX_NAME_LENGTH - 1 );
+  }
+}
+
+void KIT_SET::select( const char* kit )
+{
+  if( kit[0] == '\0' )
+  {
+    if( m_front_selected )
+    {
+      for( DRUM* drum : m_drums )
+      {
+        drum->set_sample( nullptr );
+      }
+      m_front_selected = false;
+    }
+    return;
+  }
+
+  if( m_front_selected && m_kits[m_front].is( kit ) )
+  {
+    return;
+  }
+
+  for( int ki = 0; ki < static_cast<int>( m_kits.size() ); ++ki )
+  {
+    const KIT& candidate = m_kits[ki];
+    if( candidate.m_loaded && candidate.is( kit ) )
+    {
+      m_front          = ki;
+      m_front_selected = true;
+
+      int di = 0;
+      for( DRUM* drum : m_drums )
+      {
+        drum->set_sample( di < candidate.m_num_samples ? &candidate.m_samples[di] : nullptr );
+        ++di;
+      }
+      return;
+    }
+  }
+
+  // not loaded yet, keep playing the current samples and try again at the next loop boundary
+}
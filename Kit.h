@@ -0,0 +1,65 @@
+#pragma once
+
+#include <array>
+#include "Drum.h"
+
+////////////////////////////////////////////////////////////
+// fixed block of RAM that kit samples are loaded into, it's only ever freed all at once so it can't fragment
+class SAMPLE_ARENA
+{
+  static constexpr uint32_t ARENA_BYTES                                       = 12 * 1024;   // two are needed, keep the total within RAM
+  alignas(4) std::array<uint8_t, ARENA_BYTES>             m_memory;
+  uint32_t                                                m_used              = 0;
+
+public:
+
+  uint8_t*                                                allocate( uint32_t bytes );   // 4 byte aligned, nullptr when it won't fit
+  void                                                    reset();
+
+  const uint8_t*                                          begin() const       { return m_memory.data(); }
+  const uint8_t*                                          end() const         { return m_memory.data() + ARENA_BYTES; }
+  uint32_t                                                used() const        { return m_used; }
+  static constexpr uint32_t                               capacity()          { return ARENA_BYTES; }
+};
+
+////////////////////////////////////////////////////////////
+// samples for each drum, loaded from a kit file on the SD card (see SampleBankEntry.h for the layout)
+struct KIT
+{
+  static constexpr int MAX_NAME_LENGTH                                        = 13;   // 8.3 filename
+  SAMPLE_ARENA                                            m_arena;
+  std::array<SAMPLE_BANK_ENTRY, MAX_DRUMS>                m_samples;
+  uint8_t                                                 m_num_samples       = 0;
+  char                                                    m_name[MAX_NAME_LENGTH] = {};
+  volatile bool                                           m_loaded            = false;  // written by loop(), read by select()
+  File                                                    m_stream_file;                // open while loaded if any samples are streamed
+
+  bool                                                    is( const char* name ) const;
+};
+
+////////////////////////////////////////////////////////////
+// two kits, the drums play from the front kit while the next is streamed into the back a sector at a time
+class KIT_SET
+{
+  std::array<KIT, 2>                                      m_kits;
+  volatile uint8_t                                        m_front             = 0;      // written by select()
+  volatile bool                                           m_front_selected    = false;  // false when the drums use the bank in flash
+  DRUM_SET                                                m_drums             = {};
+
+  File                                                    m_file;
+  bool                                                    m_loading           = false;
+  char                                                    m_failed_kit[KIT::MAX_NAME_LENGTH] = {};  // so a missing file isn't retried every loop()
+  uint8_t*                                                m_load_position     = nullptr;
+  uint32_t                                                m_load_remaining    = 0;
+  uint32_t                                                m_load_start_us     = 0;
+
+  bool                                                    start_load( const char* name );
+  void                                                    continue_load();
+
+public:
+
+  void                                                    set_drums( const DRUM_SET& drums );
+
+  void                                                    update( const char* wanted_kit );   // from loop(), loads the kit the patterns will need next
+  void                                                    select( const char* kit );          // at a loop boundary, "" for the bank in flash
+};
@@ -2,7 +2,46 @@
 
 #include <Audio.h>
 
-#include "util.h"
+#include "Util.h"
+
+// the mixer's gain kernels, free functions so the DSP benchmarks can call them directly. Gains are Q8.
+namespace MIXER_KERNELS
+{
+  constexpr int UNITY_GAIN = 256;
+
+  inline void apply_gain(int16_t* dst, int32_t mult)
+  {
+    const int16_t* end = dst + AUDIO_BLOCK_SAMPLES;
+
+    do
+    {
+      const int32_t val = (*dst * mult) >> 8;
+      *dst++ = signed_saturate_rshift(val, 16, 0);
+    } while( dst < end );
+  }
+
+  inline void apply_gain_then_add(const int16_t* src, int16_t* dst, int32_t mult)
+  {
+    const int16_t* end = dst + AUDIO_BLOCK_SAMPLES;
+    
+    if( mult == UNITY_GAIN )
+    {
+      do
+      {
+        const int32_t val = *dst + *src++;
+        *dst++ = signed_saturate_rshift(val, 16, 0);
+      } while( dst < end );
+    }
+    else
+    {
+      do
+      {
+        const int32_t val = *dst + ((*src++ * mult) >> 8);
+        *dst++ = signed_saturate_rshift(val, 16, 0);
+      } while( dst < end );
+    }
+  }
+}
 
 // based on Teensy audio library AudioMixer4
 // NOTE there appears to be a more efficient version
@@ -34,7 +73,7 @@ public:
           int32_t mult = m_channel_mults[channel];
           if( mult != UNITY_GAIN )
           {
-            apply_gain( out->data, mult );
+            MIXER_KERNELS::apply_gain( out->data, mult );
           }
         }
       }
@@ -43,7 +82,7 @@ public:
         audio_block_t* in = receiveReadOnly(channel);
         if( in != nullptr )
         {
-          apply_gain_then_add( in->data, out->data, m_channel_mults[channel] );
+          MIXER_KERNELS::apply_gain_then_add( in->data, out->data, m_channel_mults[channel] );
           release( in );
         }
       }
@@ -84,40 +123,7 @@ public:
   
 private:
 
-  static const constexpr int UNITY_GAIN = 256;
-
-  void apply_gain(int16_t* dst, int32_t mult)
-  {
-    const int16_t* end = dst + AUDIO_BLOCK_SAMPLES;
-
-    do
-    {
-      const int32_t val = (*dst * mult) >> 8;
-      *dst++ = signed_saturate_rshift(val, 16, 0);
-    } while( dst < end );
-  }
-
-  void apply_gain_then_add(const int16_t* src, int16_t* dst, int32_t mult)
-  {
-    const int16_t* end = dst + AUDIO_BLOCK_SAMPLES;
-    
-    if( mult == UNITY_GAIN )
-    {
-      do
-      {
-        const int32_t val = *dst + *src++;
-        *dst++ = signed_saturate_rshift(val, 16, 0);
-      } while( dst < end );
-    }
-    else
-    {
-      do
-      {
-        const int32_t val = *dst + ((*src++ * mult) >> 8);
-        *dst++ = signed_saturate_rshift(val, 16, 0);
-      } while( dst < end );
-    }
-  }
+  static const constexpr int UNITY_GAIN = MIXER_KERNELS::UNITY_GAIN;
 
   int16_t             m_channel_mults[NUM_CHANNELS];
   audio_block_t*      m_input_queue_array[NUM_CHANNELS];
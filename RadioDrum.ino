@@ -1,15 +1,19 @@
+#include "AudioClock.h"
+#include "AudioProfiler.h"
+#include "Clock.h"
 #include "Drum.h"
+#include "DspBenchmark.h"
+#include "GoldenAudio.h"
 #include "CompileSwitches.h"
+#include "Kit.h"
 
 #include "Interface.h"
 #include "MultiMixer.h"
 #include "SamplePlayer.h"
+#include "TimedSection.h"
+#include "TriggerLatency.h"
 
-#include "AudioSampleKick.h"
-#include "AudioSampleType.h"
-#include "AudioSampleReturn.h"
-#include "AudioSampleFirehit.h"
-#include "AudioSampleTink.h"
+#include "SampleBank.h"
 
 constexpr int         NOTE_CV_PIN(A8);    // ROOT - on panel
 constexpr int         TRIG_CV_PIN(9);     // TRIG - on panel
@@ -22,41 +26,82 @@ constexpr int         ADC_MAX_VAL(8192);
 
 constexpr int         TRIG_FLASH_TIME_MS(100);
 
-constexpr uint32_t    MAX_DELAY_TIME_MS(175);    // memory is limited, so only short delays possible
+// 75 held the old 175ms delay but left the rest of the graph its peak with no margin
+constexpr int         AUDIO_MEMORY_BLOCKS(77);
+// peak blocks used by everything but the delay line plus the margin, as SIZE_AUDIO_MEMORY recommends.
+// A peak of 13, measured by tools/host/memory_test on the host's copy of the pool and graph
+constexpr int         AUDIO_GRAPH_MARGIN_BLOCKS(2);
+constexpr int         AUDIO_GRAPH_BLOCKS(15);
+#ifdef SIZE_AUDIO_MEMORY
+constexpr uint32_t    MAX_DELAY_TIME_MS(0);      // measure the graph without the delay line
+constexpr int         STRESS_HIT_INTERVAL_MS(3);
+#else
+// memory is limited, the delay line gets what the rest of the graph doesn't need (it holds a block more than its length)
+constexpr uint32_t    MAX_DELAY_TIME_MS( ( ( AUDIO_MEMORY_BLOCKS - AUDIO_GRAPH_BLOCKS - 1 ) * AUDIO_BLOCK_SAMPLES * 1000.0f ) / AUDIO_SAMPLE_RATE_EXACT );
+#endif // SIZE_AUDIO_MEMORY
+static_assert( AUDIO_GRAPH_BLOCKS < AUDIO_MEMORY_BLOCKS, "no audio memory left for the delay line" );
+constexpr float       DELAY_SYNC_THRESHOLD_MS(0.5f);
+
+constexpr int         CLOCK_MULTIPLIER(1);
+constexpr int         CLOCK_DIVIDER(1);
 
 constexpr int         NUM_PATTERN_LEDS(4);
 
+#ifdef GOLDEN_AUDIO_TEST
+#ifdef SD_KITS
+#error "kits load in the background, so golden audio needs the built in samples"
+#endif
+#ifdef HOT_RELOAD_PATTERNS
+#error "a pattern reloaded mid run would change the output, turn off HOT_RELOAD_PATTERNS for golden audio"
+#endif
+constexpr int         GOLDEN_BLOCKS_PER_STEP(32);    // ~93ms steps
+constexpr int         GOLDEN_STEPS_PER_PATTERN(32);  // each pattern gets this long before moving on (at the end of its loop)
+constexpr int         GOLDEN_TAIL_STEPS(16);         // let the reverb and delay ring out
+constexpr int         GOLDEN_TOLERANCE(0);           // max sample deviation that passes, raise it for an intentional numeric change
+constexpr uint32_t    GOLDEN_STEP_US( GOLDEN_BLOCKS_PER_STEP * AUDIO_CLOCK::BLOCK_DURATION_US );
+#endif // GOLDEN_AUDIO_TEST
+
 LED                   trig_led(RESET_LED_PIN, false);
 BUTTON                trig_button(TRIG_BUTTON_PIN, false);
 DIAL                  root_dial(ROOT_POT_PIN);
 DIAL                  chord_dial(CHORD_POT_PIN);
 std::array<LED, NUM_PATTERN_LEDS>    pattern_leds = { LED(3,false), LED(4,false), LED(5,false), LED(6,false) };
 
-DRUM                  drum_1( reinterpret_cast<const uint16_t*>(&(AudioSampleKick[0])) );               // synthesised kick
-DRUM                  drum_2( reinterpret_cast<const uint16_t*>(&(AudioSampleType[0])) );               // vintage adding machine key press
-DRUM                  drum_3( reinterpret_cast<const uint16_t*>(&(AudioSampleReturn[0])) );             // vintage adding machine carriage return
-DRUM                  drum_4( reinterpret_cast<const uint16_t*>(&(AudioSampleTink[0])) );               // vintage adding machine carriage return 2
-DRUM                  drum_5( reinterpret_cast<const uint16_t*>(&(AudioSampleFirehit[0])) );            // hitting a cast iron fire
+AUDIO_CLOCK           audio_clock;                                                                        // must be the first AudioStream, see AudioClock.h
 
+DRUM                  drum_1( "drum_1", SAMPLE_BANK::KICK_DRUM );                                         // synthesised kick
+DRUM                  drum_2( "drum_2", SAMPLE_BANK::TYPE_DRUM );                                         // vintage adding machine key press
+DRUM                  drum_3( "drum_3", SAMPLE_BANK::RETURN_DRUM );                                       // vintage adding machine carriage return
+DRUM                  drum_4( "drum_4", SAMPLE_BANK::TINK_DRUM );                                         // vintage adding machine carriage return 2
+DRUM                  drum_5( "drum_5", SAMPLE_BANK::FIREHIT_DRUM );                                      // hitting a cast iron fire
+
+static_assert( all_playable( SAMPLE_BANK::ALL_SAMPLES ), "drum samples must be 16 bit PCM, u-law or IMA ADPCM at 44.1, 22.05 or 11.025kHz" );
 
 PATTERN_SET           patterns;
+CLOCK                 sequencer_clock;
+#ifdef SD_KITS
+KIT_SET               kits;
+#endif // SD_KITS
 
 
-MultiMixer2           drum_1_mixer;
-MultiMixer2           drum_2_mixer;
-MultiMixer2           drum_3_mixer;
-MultiMixer2           drum_4_mixer;
-MultiMixer2           drum_5_mixer;
-MultiMixer5           dry_drum_mixer;
-MultiMixer5           reverb_mixer;
-MultiMixer6           delay_mixer;
-MultiMixer3           final_mixer;
+AUDIO_NODE( MultiMixer2,          drum_1_mixer );
+AUDIO_NODE( MultiMixer2,          drum_2_mixer );
+AUDIO_NODE( MultiMixer2,          drum_3_mixer );
+AUDIO_NODE( MultiMixer2,          drum_4_mixer );
+AUDIO_NODE( MultiMixer2,          drum_5_mixer );
+AUDIO_NODE( MultiMixer5,          dry_drum_mixer );
+AUDIO_NODE( MultiMixer5,          reverb_mixer );
+AUDIO_NODE( MultiMixer6,          delay_mixer );
+AUDIO_NODE( MultiMixer3,          final_mixer );
 
-AudioEffectDelay      delay_effect;
-AudioEffectFreeverb   freeverb_effect;
+AUDIO_NODE( AudioEffectDelay,     delay_effect );
+AUDIO_NODE( AudioEffectFreeverb,  freeverb_effect );
 
 
 AudioOutputAnalog     audio_output;
+#ifdef GOLDEN_AUDIO_TEST
+GOLDEN_AUDIO          golden_audio;                                                                       // after final_mixer, so it gets this block's output
+#endif // GOLDEN_AUDIO_TEST
 
 AudioConnection       patch_cord_1( drum_1.voice(0), 0, drum_1_mixer, 0 );
 AudioConnection       patch_cord_2( drum_1.voice(1), 0, drum_1_mixer, 1 );
@@ -95,21 +140,67 @@ AudioConnection       patch_cord_31( delay_effect, 0, delay_mixer, 5 );   // fee
 
 AudioConnection       patch_cord_32( final_mixer, 0, audio_output, 0 );
 AudioConnection       patch_cord_33( final_mixer, 1, audio_output, 1 );
+#ifdef GOLDEN_AUDIO_TEST
+AudioConnection       patch_cord_34( final_mixer, 0, golden_audio, 0 );
+#endif // GOLDEN_AUDIO_TEST
 
 volatile boolean g_triggered = false;
-volatile uint32_t g_delta_time_ms = 0;
 
 void notify_trigger()
 {
-  static uint32_t prev_time_ms = 0;
-  const uint32_t time_ms = millis();
-
-  g_delta_time_ms = time_ms - prev_time_ms;
-  prev_time_ms = time_ms;
+  const uint32_t time_us = micros();
+  sequencer_clock.on_edge( time_us );
+#ifdef MEASURE_TRIGGER_LATENCY
+  TRIGGER_LATENCY::edge( time_us );
+#endif
   
   g_triggered = true;
 }
 
+void process_clock_ticks( uint32_t now_us )
+{
+  ADD_TIMED_SECTION( CLOCK_TICKS );
+
+  uint32_t tick_time_us;
+  while( sequencer_clock.poll( now_us, tick_time_us ) )
+  {
+    patterns.clock( tick_time_us, sequencer_clock.tick_period_us() );
+  }
+
+  patterns.update( now_us );
+}
+
+#ifdef CLOCK_IN_AUDIO_UPDATE
+void audio_block_callback()
+{
+  process_clock_ticks( micros() );
+}
+#endif // CLOCK_IN_AUDIO_UPDATE
+
+#ifdef GOLDEN_AUDIO_TEST
+// steps the patterns every GOLDEN_BLOCKS_PER_STEP blocks rather than from the trigger input, moving on to the next
+// pattern every GOLDEN_STEPS_PER_PATTERN steps, so every run renders the same audio
+void golden_block_callback()
+{
+  static uint32_t blocks  = 0;
+  static uint32_t steps   = 0;
+
+  // events are placed relative to the previous block, step on its first sample
+  const uint32_t block_time_us = AUDIO_CLOCK::block_time_us();
+  if( blocks++ % GOLDEN_BLOCKS_PER_STEP == 0 )
+  {
+    if( steps > 0 && steps % GOLDEN_STEPS_PER_PATTERN == 0 )
+    {
+      patterns.advance_pending_pattern();
+    }
+    ++steps;
+    patterns.clock( block_time_us + 1, GOLDEN_STEP_US );
+  }
+
+  patterns.update( block_time_us + AUDIO_CLOCK::BLOCK_DURATION_US );
+}
+#endif // GOLDEN_AUDIO_TEST
+
 void setup()
 {
   Serial.begin(9600);
@@ -127,7 +218,11 @@ void setup()
     DEBUG_TEXT("No SD!!\n");
   }
 
-  AudioMemory(75);
+  AudioMemory(AUDIO_MEMORY_BLOCKS);
+
+#if defined(PROFILE_AUDIO_NODES) || defined(SHOW_TIMED_SECTIONS) || defined(BENCHMARK_DSP)
+  enable_cycle_counter();
+#endif
 
   // RADIO MUSIC setup
   //analogReference(DEFAULT);
@@ -146,6 +241,22 @@ void setup()
   drums[4] = &drum_5;
   patterns.read(drums);
 
+#ifdef SD_KITS
+  kits.set_drums(drums);
+  patterns.set_kits(kits);
+#endif // SD_KITS
+
+  sequencer_clock.set_multiplier( CLOCK_MULTIPLIER );
+  sequencer_clock.set_divider( CLOCK_DIVIDER );
+#ifdef INTERNAL_CLOCK
+  sequencer_clock.set_free_running( true );
+#endif // INTERNAL_CLOCK
+
+#ifdef CLOCK_IN_AUDIO_UPDATE
+  // patterns are loaded, safe to start clocking them from the audio update
+  audio_clock.set_block_callback( audio_block_callback );
+#endif // CLOCK_IN_AUDIO_UPDATE
+
   // set mix for drum voices within each drum
   drum_1_mixer.set_gain_all_channels( drum_1.voice_mix() );
   drum_2_mixer.set_gain_all_channels( drum_2.voice_mix() );
@@ -174,11 +285,18 @@ void setup()
   
   delay_mixer.set_gain( 5, 0.0f );    // feed back
 
-  delay_effect.delay( 0, 190 );
+  delay_effect.delay( 0, MAX_DELAY_TIME_MS );
 
   // set master mixer
   final_mixer.set_gain_all_channels( 1.0f );
 
+#ifdef GOLDEN_AUDIO_TEST
+  // fixed, rather than following the clock and the dials
+  delay_effect.delay( 0, GOLDEN_STEP_US / 1000.0f );
+  delay_mixer.set_gain( 5, 0.5f );
+  final_mixer.set_gain( 1, 0.5f );
+#endif // GOLDEN_AUDIO_TEST
+
   trig_led.setup();
   trig_button.setup();
 
@@ -189,20 +307,67 @@ void setup()
 
   delay(100);
 
+#ifdef GOLDEN_AUDIO_TEST
+  // start capturing on the block the patterns start
+  AudioNoInterrupts();
+  golden_audio.set_tolerance( GOLDEN_TOLERANCE );
+  golden_audio.start( ( patterns.num_patterns() * GOLDEN_STEPS_PER_PATTERN + GOLDEN_TAIL_STEPS ) * GOLDEN_BLOCKS_PER_STEP );
+  audio_clock.set_block_callback( golden_block_callback );
+  AudioInterrupts();
+#endif // GOLDEN_AUDIO_TEST
+
   DEBUG_TEXT_LINE("Setup complete");
 }
 
+#ifdef SIZE_AUDIO_MEMORY
+// hits every drum as fast as voices can be stolen and reports the most audio blocks in use, and with
+// AUDIO_GRAPH_MARGIN_BLOCKS what AUDIO_GRAPH_BLOCKS should be
+void size_audio_memory( int32_t time_ms )
+{
+  static int32_t next_hit_time_ms     = 0;
+  static int32_t next_report_time_ms  = 1000;
+
+  if( time_ms >= next_hit_time_ms )
+  {
+    next_hit_time_ms                  = time_ms + STRESS_HIT_INTERVAL_MS;
+
+    AudioNoInterrupts();
+    for( DRUM* drum : { &drum_1, &drum_2, &drum_3, &drum_4, &drum_5 } )
+    {
+      drum->trigger( 12, 127, micros() );
+    }
+    AudioInterrupts();
+  }
+
+  if( time_ms >= next_report_time_ms )
+  {
+    next_report_time_ms               = time_ms + 1000;
+    const int peak_blocks             = AudioMemoryUsageMax();
+    Serial.print( "Audio blocks peak:" );
+    Serial.print( peak_blocks );
+    Serial.print( " of " );
+    Serial.print( AUDIO_MEMORY_BLOCKS );
+    Serial.print( ", set AUDIO_GRAPH_BLOCKS to " );
+    Serial.print( peak_blocks + AUDIO_GRAPH_MARGIN_BLOCKS );
+    Serial.print( " (is " );
+    Serial.print( AUDIO_GRAPH_BLOCKS );
+    Serial.println( ")" );
+  }
+}
+#endif // SIZE_AUDIO_MEMORY
+
 void update_pattern_leds(int32_t time_ms)
 { 
+  // patterns after the 4th share the LEDs of the first 4
   for( int li = 0; li < NUM_PATTERN_LEDS; ++li )
   {
     LED& led = pattern_leds[li];
-    if( li == patterns.current_pattern() )
+    if( li == patterns.current_pattern() % NUM_PATTERN_LEDS )
     {
       led.set_active(true);
     }
     else if(  patterns.is_pattern_pending() &&
-              li == patterns.pending_pattern() )
+              li == patterns.pending_pattern() % NUM_PATTERN_LEDS )
     {
       if( !led.is_flash_active() )
       {
@@ -220,35 +385,70 @@ void update_pattern_leds(int32_t time_ms)
 
 void loop()
 {
+#ifndef GOLDEN_AUDIO_TEST
   static bool first_update = true;
+#endif
   const int32_t time_ms = millis();
   
   trig_led.update( time_ms );
   trig_button.update( time_ms );
   
+#ifndef GOLDEN_AUDIO_TEST
   if( trig_button.single_click() )
   {
     // advance the pattern
     DEBUG_TEXT_LINE("Advance");
     patterns.advance_pending_pattern();
   }
+#endif // !GOLDEN_AUDIO_TEST
 
   update_pattern_leds( time_ms );
+
+#ifdef HOT_RELOAD_PATTERNS
+  patterns.check_for_changes( time_ms );
+#endif // HOT_RELOAD_PATTERNS
+
+#ifdef SD_KITS
+  SAMPLE_STREAMER::update();
+  kits.update( patterns.wanted_kit() );
+
+  static uint32_t reported_underruns = 0;
+  if( SAMPLE_STREAMER::underruns() != reported_underruns )
+  {
+    reported_underruns = SAMPLE_STREAMER::underruns();
+    DEBUG_TEXT("Stream underruns:");
+    DEBUG_TEXT_LINE(reported_underruns);
+  }
+#endif // SD_KITS
   
+#ifdef DEBUG_OUTPUT
+  static uint32_t reported_deadline_misses = 0;
+  if( AUDIO_CLOCK::total_deadline_misses() != reported_deadline_misses )
+  {
+    reported_deadline_misses = AUDIO_CLOCK::total_deadline_misses();
+    AUDIO_CLOCK::print_deadline_log();
+  }
+#endif // DEBUG_OUTPUT
+
+#if !defined(CLOCK_IN_AUDIO_UPDATE) && !defined(GOLDEN_AUDIO_TEST)
+  process_clock_ticks( micros() );
+#endif
+
   if( g_triggered )
   {
     g_triggered = false;
 
-    patterns.clock();
-
     trig_led.flash_on( time_ms, TRIG_FLASH_TIME_MS, false );
   }
 
-  // update delay sync
-  static uint32_t current_delay_ms = 0;
-  uint32_t desired_delay_ms   = g_delta_time_ms;
-  desired_delay_ms            = clamp<uint32_t>( desired_delay_ms, 0, MAX_DELAY_TIME_MS );
-  if( abs(current_delay_ms - desired_delay_ms) > 5 )
+#ifdef GOLDEN_AUDIO_TEST
+  golden_audio.process();
+#else
+  // update delay sync (from the smoothed clock period, so jitter on the trigger doesn't modulate the delay)
+  static float current_delay_ms = 0.0f;
+  float desired_delay_ms      = sequencer_clock.tick_period_us() / 1000.0f;
+  desired_delay_ms            = clamp<float>( desired_delay_ms, 0.0f, MAX_DELAY_TIME_MS );
+  if( abs(current_delay_ms - desired_delay_ms) > DELAY_SYNC_THRESHOLD_MS )
   {
     current_delay_ms          = desired_delay_ms;
     DEBUG_TEXT("Set delay:");
@@ -275,6 +475,7 @@ void loop()
   }
 
   first_update = false;
+#endif // GOLDEN_AUDIO_TEST
 
 #ifdef SHOW_PERF
   int perf_time = millis();
@@ -297,4 +498,55 @@ void loop()
     ++num_samples;
   }
 #endif // SHOW_PERF
+
+#ifdef SIZE_AUDIO_MEMORY
+  size_audio_memory( time_ms );
+#endif // SIZE_AUDIO_MEMORY
+
+#ifdef SHOW_TIMED_SECTIONS
+  TIMED_SECTIONS::update( time_ms );
+#endif // SHOW_TIMED_SECTIONS
+
+#ifdef MEASURE_TRIGGER_LATENCY
+  static uint32_t next_latency_report_ms = 0;
+  if( static_cast<int32_t>( time_ms - next_latency_report_ms ) >= 0 )
+  {
+    next_latency_report_ms = time_ms + 5000;
+    TRIGGER_LATENCY::print();
+  }
+#endif // MEASURE_TRIGGER_LATENCY
+
+#if defined(PROFILE_AUDIO_NODES) || defined(BENCHMARK_DSP)
+  if( Serial.available() > 0 )
+  {
+    const int command = Serial.read();
+#ifdef PROFILE_AUDIO_NODES
+    // 'p' prints the cost of each node in the audio graph, 'r' starts counting again
+    if( command == 'p' )
+    {
+      NODE_PROFILE::print_all();
+    }
+    else if( command == 'r' )
+    {
+      NODE_PROFILE::reset_all();
+    }
+#endif // PROFILE_AUDIO_NODES
+#ifdef BENCHMARK_DSP
+    // 'b' times the DSP kernels
+    if( command == 'b' )
+    {
+      DSP_BENCHMARK::run();
+    }
+#endif // BENCHMARK_DSP
+  }
+#endif
+
+#ifdef SHOW_DECODE_PERF
+  static int32_t next_decode_perf_time_ms = 0;
+  if( time_ms > next_decode_perf_time_ms )
+  {
+    next_decode_perf_time_ms = time_ms + 1000;
+    SAMPLE_PLAYER_EFFECT::print_decode_perf();
+  }
+#endif // SHOW_DECODE_PERF
 }
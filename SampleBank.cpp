@@ -0,0 +1,4905 @@
+// Sample bank generated by tools/kit_compiler from kit.txt, do not edit
+
+#include "SampleBank.h"
+
+alignas(4) const int16_t SAMPLE_BANK_DATA[78210] = {
+// kick
+221,18402,18767,16941,13810,9894,10295,7699,5837,4711,4286,2394,1775,1021,255,-821,
+-1316,-2300,-3280,-4240,-5170,-6304,-7407,-8573,-9709,-10857,-11907,-12901,-13770,-14456,-15016,-15526,
+-16019,-16413,-16693,-16906,-17037,-17174,-17290,-17331,-17291,-17209,-17135,-17070,-17030,-16975,-16940,-16886,
+-16827,-16769,-16707,-16726,-16729,-16699,-16625,-16488,-16341,-16259,-16179,-16024,-15883,-15746,-15538,-15211,
+-14798,-14381,-14010,-13640,-13212,-12815,-12425,-12075,-11669,-11220,-10795,-10330,-9936,-9500,-9036,-8619,
+-8184,-7796,-7375,-6913,-6404,-5895,-5373,-4849,-4291,-3734,-3150,-2489,-1757,-1011,-210,621,
+1340,2050,2807,3527,4225,4905,5508,6110,6726,7337,7923,8478,8951,9364,9774,10180,
+10667,11134,11559,11923,12251,12542,12741,12934,13117,13241,13341,13406,13466,13493,13530,13629,
+13766,13895,14005,14065,14146,14179,14159,14175,14210,14212,14250,14268,14251,14241,14161,14056,
+13921,13731,13582,13403,13228,13065,12914,12758,12484,12198,11926,11628,11326,10970,10552,10134,
+9719,9254,8768,8257,7758,7233,6633,6045,5470,4879,4303,3776,3292,2790,2216,1591,
+929,246,-419,-1062,-1668,-2300,-3024,-3701,-4390,-5080,-5738,-6459,-7146,-7878,-8646,-9418,
+-10135,-10854,-11584,-12316,-13012,-13686,-14398,-15107,-15829,-16511,-17158,-17767,-18414,-19045,-19654,-20260,
+-20855,-21425,-22014,-22574,-23161,-23703,-24183,-24627,-25011,-25395,-25749,-26041,-26321,-26592,-26837,-27040,
+-27194,-27304,-27427,-27549,-27613,-27639,-27650,-27650,-27614,-27539,-27433,-27298,-27147,-26955,-26746,-26552,
+-26325,-26069,-25788,-25499,-25168,-24807,-24428,-24027,-23600,-23143,-22710,-22239,-21756,-21257,-20722,-20131,
+-19486,-18817,-18148,-17437,-16690,-15938,-15141,-14334,-13524,-12680,-11800,-10927,-10042,-9145,-8314,-7489,
+-6643,-5722,-4772,-3794,-2857,-1899,-929,18,922,1834,2783,3716,4653,5581,6509,7392,
+8227,9055,9863,10618,11364,12106,12770,13392,13985,14529,15055,15537,16010,16420,16768,17074,
+17362,17629,17831,18022,18192,18294,18374,18446,18502,18540,18574,18625,18678,18700,18659,18577,
+18484,18348,18203,18013,17823,17630,17422,17176,16938,16706,16460,16212,15942,15675,15368,15069,
+14767,14416,14045,13644,13235,12806,12388,11973,11598,11189,10747,10301,9840,9353,8837,8330,
+7835,7311,6769,6220,5651,5066,4457,3888,3323,2737,2142,1537,922,296,-321,-956,
+-1565,-2180,-2806,-3439,-4081,-4743,-5366,-6018,-6658,-7312,-7965,-8594,-9229,-9862,-10493,-11127,
+-11763,-12337,-12914,-13502,-14083,-14700,-15305,-15898,-16480,-17041,-17601,-18157,-18664,-19146,-19632,-20138,
+-20652,-21141,-21625,-22097,-22555,-23011,-23445,-23834,-24192,-24521,-24841,-25156,-25440,-25693,-25925,-26156,
+-26381,-26593,-26792,-26962,-27109,-27251,-27387,-27492,-27541,-27574,-27586,-27594,-27583,-27566,-27546,-27490,
+-27435,-27378,-27308,-27225,-27102,-26951,-26793,-26628,-26440,-26248,-26009,-25769,-25540,-25306,-25043,-24743,
+-24413,-24064,-23741,-23416,-23052,-22672,-22248,-21818,-21405,-20971,-20510,-20030,-19518,-19020,-18494,-17957,
+-17405,-16834,-16249,-15652,-15037,-14411,-13768,-13116,-12469,-11811,-11126,-10445,-9767,-9091,-8422,-7746,
+-7051,-6366,-5659,-4972,-4260,-3522,-2766,-1998,-1237,-477,301,1087,1883,2685,3474,4233,
+4992,5774,6569,7372,8103,8793,9458,10094,10701,11270,11808,12347,12850,13325,13759,14170,
+14535,14871,15177,15477,15755,16002,16202,16382,16547,16704,16834,16916,16995,17048,17106,17146,
+17171,17207,17224,17234,17221,17178,17101,17030,16958,16882,16775,16654,16535,16396,16235,16057,
+15886,15704,15510,15316,15089,14822,14555,14272,13987,13669,13354,13029,12706,12359,12001,11650,
+11302,10938,10558,10174,9792,9392,9001,8597,8156,7687,7189,6687,6171,5643,5095,4560,
+4021,3493,2954,2422,1900,1358,799,219,-366,-955,-1548,-2149,-2739,-3341,-3961,-4569,
+-5188,-5803,-6397,-6985,-7547,-8125,-8683,-9271,-9884,-10490,-11066,-11630,-12167,-12718,-13246,-13800,
+-14346,-14900,-15442,-15988,-16530,-17045,-17514,-17981,-18465,-18910,-19342,-19759,-20177,-20593,-21010,-21424,
+-21823,-22195,-22537,-22872,-23164,-23430,-23676,-23908,-24144,-24397,-24628,-24860,-25060,-25264,-25423,-25561,
+-25691,-25823,-25940,-26061,-26177,-26286,-26377,-26454,-26527,-26600,-26649,-26668,-26663,-26643,-26625,-26608,
+-26609,-26587,-26542,-26474,-26386,-26287,-26170,-26056,-25937,-25825,-25704,-25563,-25411,-25212,-24980,-24750,
+-24542,-24334,-24119,-23896,-23671,-23414,-23121,-22804,-22479,-22149,-21812,-21454,-21085,-20738,-20352,-19956,
+-19545,-19114,-18680,-18226,-17762,-17288,-16790,-16287,-15793,-15313,-14824,-14325,-13833,-13333,-12833,-12335,
+-11839,-11334,-10821,-10293,-9772,-9226,-8665,-8100,-7554,-6974,-6369,-5749,-5162,-4564,-3970,-3357,
+-2738,-2097,-1448,-798,-119,582,1292,1992,2684,3387,4096,4838,5584,6354,7118,7873,
+8628,9384,10148,10932,11714,12496,13275,14054,14813,15572,16337,17099,17863,18624,19374,20115,
+20858,21585,22302,22996,23679,24338,24962,25549,26089,26594,27060,27495,27881,28228,28558,28859,
+29123,29355,29570,29776,29959,30118,30258,30372,30468,30545,30611,30669,30708,30734,30755,30751,
+30741,30738,30732,30728,30684,30619,30545,30476,30408,30346,30271,30196,30096,29992,29879,29767,
+29639,29515,29372,29217,29032,28839,28624,28401,28156,27906,27645,27375,27077,26773,26442,26091,
+25714,25331,24956,24575,24187,23785,23361,22907,22446,21981,21519,21064,20615,20157,19658,19135,
+18590,18054,17540,17005,16468,15924,15386,14847,14305,13749,13185,12618,12047,11468,10881,10283,
+9686,9086,8482,7875,7254,6606,5925,5261,4632,4012,3402,2798,2176,1538,912,296,
+-320,-942,-1563,-2174,-2780,-3384,-3982,-4591,-5209,-5824,-6427,-7004,-7542,-8090,-8647,-9209,
+-9749,-10280,-10808,-11340,-11877,-12423,-12968,-13507,-14032,-14544,-15050,-15559,-16071,-16584,-17093,-17594,
+-18094,-18579,-19082,-19564,-20019,-20443,-20856,-21236,-21594,-21947,-22290,-22624,-22952,-23269,-23563,-23835,
+-24072,-24305,-24528,-24741,-24936,-25111,-25265,-25411,-25548,-25679,-25795,-25908,-26018,-26129,-26248,-26369,
+-26462,-26532,-26579,-26615,-26646,-26669,-26677,-26674,-26686,-26703,-26717,-26725,-26719,-26690,-26632,-26565,
+-26503,-26454,-26403,-26353,-26291,-26218,-26151,-26087,-26023,-25952,-25873,-25788,-25705,-25629,-25539,-25450,
+-25342,-25227,-25093,-24945,-24782,-24615,-24446,-24274,-24097,-23903,-23700,-23523,-23358,-23178,-22980,-22759,
+-22536,-22307,-22056,-21784,-21504,-21222,-20942,-20673,-20396,-20139,-19880,-19600,-19308,-19008,-18699,-18383,
+-18069,-17766,-17437,-17085,-16708,-16329,-15943,-15540,-15135,-14722,-14333,-13936,-13547,-13142,-12754,-12352,
+-11936,-11492,-11042,-10571,-10100,-9618,-9123,-8621,-8115,-7622,-7126,-6634,-6124,-5599,-5072,-4536,
+-3987,-3438,-2907,-2351,-1776,-1156,-524,115,736,1359,1979,2601,3221,3853,4474,5097,
+5716,6331,6946,7576,8217,8857,9489,10118,10748,11388,12036,12682,13340,14010,14684,15358,
+16030,16702,17360,17998,18640,19281,19927,20567,21184,21790,22377,22948,23487,23991,24470,24927,
+25351,25747,26128,26498,26852,27193,27506,27798,28071,28318,28527,28714,28869,29004,29103,29196,
+29292,29389,29477,29551,29609,29656,29695,29727,29751,29763,29775,29771,29768,29760,29768,29770,
+29739,29654,29557,29445,29341,29220,29099,28964,28824,28666,28506,28327,28139,27921,27693,27467,
+27244,27010,26757,26475,26178,25899,25617,25334,25031,24718,24398,24077,23756,23431,23088,22732,
+22356,21968,21552,21115,20672,20234,19768,19287,18802,18326,17863,17387,16903,16406,15903,15385,
+14844,14286,13726,13172,12623,12064,11493,10914,10335,9769,9216,8675,8118,7543,6972,6388,
+5802,5203,4608,4018,3439,2874,2315,1757,1203,657,121,-424,-952,-1462,-1962,-2453,
+-2939,-3428,-3936,-4434,-4928,-5411,-5894,-6376,-6860,-7330,-7790,-8238,-8679,-9122,-9565,-9998,
+-10423,-10820,-11205,-11580,-11963,-12338,-12701,-13055,-13395,-13729,-14059,-14396,-14723,-15039,-15341,-15634,
+-15919,-16187,-16459,-16738,-17010,-17276,-17561,-17857,-18149,-18444,-18743,-19022,-19285,-19529,-19760,-19988,
+-20220,-20455,-20711,-20962,-21189,-21400,-21614,-21848,-22086,-22318,-22532,-22750,-22960,-23165,-23355,-23543,
+-23722,-23895,-24080,-24247,-24411,-24559,-24703,-24840,-24975,-25097,-25222,-25334,-25451,-25566,-25685,-25797,
+-25901,-25995,-26086,-26180,-26276,-26376,-26470,-26549,-26617,-26683,-26751,-26837,-26899,-26943,-26961,-26961,
+-26951,-26946,-26931,-26914,-26881,-26863,-26832,-26810,-26780,-26743,-26693,-26639,-26567,-26482,-26382,-26283,
+-26176,-26064,-25941,-25809,-25673,-25538,-25409,-25285,-25151,-25017,-24875,-24718,-24537,-24336,-24136,-23924,
+-23728,-23556,-23380,-23213,-23038,-22849,-22644,-22428,-22203,-21968,-21722,-21484,-21235,-20986,-20716,-20441,
+-20148,-19831,-19517,-19216,-18920,-18620,-18335,-18056,-17772,-17480,-17189,-16886,-16565,-16238,-15907,-15573,
+-15253,-14942,-14619,-14286,-13937,-13591,-13227,-12868,-12499,-12128,-11742,-11351,-10978,-10629,-10292,-9956,
+-9612,-9271,-8918,-8572,-8222,-7874,-7520,-7159,-6790,-6421,-6057,-5702,-5350,-5018,-4701,-4364,
+-3998,-3628,-3242,-2843,-2419,-2015,-1642,-1253,-829,-406,2,403,800,1206,1615,2034,
+2460,2898,3352,3830,4307,4780,5251,5717,6201,6708,7244,7788,8320,8851,9386,9923,
+10466,11014,11568,12127,12678,13225,13775,14325,14867,15436,16015,16603,17176,17747,18314,18866,
+19428,19976,20513,21048,21578,22082,22564,23020,23459,23863,24229,24578,24930,25262,25597,25921,
+26258,26556,26814,27044,27260,27459,27643,27802,27935,28045,28150,28237,28311,28367,28413,28443,
+28450,28428,28404,28381,28364,28344,28314,28271,28229,28175,28120,28051,27973,27895,27806,27691,
+27542,27390,27248,27089,26942,26789,26654,26488,26311,26113,25902,25674,25433,25185,24904,24604,
+24286,23968,23635,23298,22950,22608,22280,21932,21536,21087,20643,20202,19737,19270,18830,18409,
+17996,17576,17166,16745,16329,15914,15502,15081,14643,14197,13736,13260,12788,12323,11858,11394,
+10905,10392,9901,9462,9043,8635,8204,7777,7338,6929,6534,6129,5706,5245,4765,4284,
+3817,3356,2890,2440,1978,1505,1048,625,237,-136,-507,-886,-1266,-1638,-2007,-2372,
+-2735,-3090,-3453,-3811,-4172,-4530,-4898,-5273,-5638,-5983,-6317,-6651,-7016,-7403,-7785,-8144,
+-8492,-8862,-9250,-9640,-9997,-10352,-10669,-10974,-11254,-11526,-11803,-12075,-12348,-12625,-12895,-13161,
+-13393,-13612,-13849,-14114,-14395,-14694,-14999,-15313,-15637,-15999,-16394,-16763,-17084,-17371,-17638,-17904,
+-18175,-18448,-18717,-18989,-19247,-19509,-19775,-20038,-20291,-20518,-20747,-20990,-21250,-21531,-21830,-22119,
+-22366,-22606,-22823,-23041,-23261,-23467,-23647,-23827,-24007,-24183,-24355,-24510,-24672,-24824,-24960,-25074,
+-25186,-25285,-25380,-25476,-25572,-25675,-25783,-25877,-25957,-26017,-26056,-26070,-26098,-26128,-26154,-26190,
+-26230,-26248,-26259,-26241,-26219,-26195,-26155,-26112,-26062,-26004,-25934,-25864,-25820,-25775,-25713,-25644,
+-25557,-25476,-25366,-25246,-25130,-25027,-24915,-24816,-24711,-24605,-24501,-24408,-24329,-24250,-24170,-24081,
+-23993,-23890,-23791,-23692,-23603,-23512,-23407,-23292,-23190,-23107,-23032,-22942,-22834,-22729,-22625,-22522,
+-22412,-22286,-22160,-22041,-21931,-21830,-21738,-21636,-21515,-21389,-21251,-21123,-20996,-20865,-20720,-20564,
+-20415,-20281,-20145,-20028,-19917,-19806,-19667,-19512,-19326,-19144,-18956,-18777,-18598,-18421,-18247,-18056,
+-17840,-17624,-17407,-17193,-16961,-16706,-16438,-16171,-15905,-15623,-15331,-15039,-14764,-14477,-14165,-13842,
+-13510,-13162,-12793,-12428,-12075,-11724,-11370,-11016,-10674,-10318,-9968,-9615,-9260,-8891,-8517,-8140,
+-7758,-7362,-6949,-6538,-6139,-5739,-5332,-4914,-4479,-4034,-3577,-3115,-2658,-2188,-1713,-1231,
+-762,-296,163,621,1077,1535,1995,2450,2893,3348,3812,4271,4743,5218,5698,6170,
+6645,7112,7580,8046,8520,8990,9472,9955,10438,10916,11386,11866,12356,12833,13310,13778,
+14263,14751,15237,15725,16222,16720,17215,17701,18190,18681,19160,19637,20099,20573,21044,21506,
+21964,22416,22862,23302,23729,24143,24546,24940,25327,25713,26090,26451,26805,27142,27473,27788,
+28091,28379,28643,28899,29143,29386,29616,29836,30048,30249,30449,30629,30805,30969,31120,31265,
+31396,31526,31645,31751,31840,31920,31992,32060,32119,32177,32227,32277,32320,32353,32389,32408,
+32433,32445,32464,32472,32479,32481,32477,32481,32482,32488,32486,32487,32481,32473,32465,32452,
+32448,32432,32421,32401,32387,32361,32337,32300,32265,32218,32175,32116,32060,31985,31917,31835,
+31755,31666,31571,31469,31364,31253,31139,31019,30890,30758,30619,30475,30329,30169,30004,29830,
+29658,29471,29285,29082,28874,28658,28426,28192,27946,27689,27424,27143,26867,26578,26291,25988,
+25686,25367,25052,24715,24372,24018,23660,23297,22927,22560,22184,21805,21415,21022,20627,20226,
+19820,19401,18990,18569,18166,17751,17349,16940,16535,16127,15720,15312,14909,14498,14096,13691,
+13296,12897,12501,12109,11717,11329,10949,10566,10187,9800,9420,9042,8660,8286,7904,7534,
+7158,6791,6424,6064,5702,5344,4987,4635,4291,3949,3610,3273,2941,2614,2289,1973,
+1661,1355,1053,752,453,148,-156,-462,-768,-1069,-1366,-1665,-1964,-2263,-2563,-2866,
+-3165,-3472,-3773,-4083,-4387,-4691,-4993,-5296,-5598,-5893,-6190,-6483,-6781,-7074,-7366,-7655,
+-7942,-8226,-8508,-8789,-9068,-9349,-9623,-9900,-10178,-10454,-10734,-11004,-11280,-11550,-11824,-12101,
+-12373,-12645,-12910,-13180,-13447,-13717,-13983,-14244,-14507,-14765,-15020,-15271,-15520,-15767,-16005,-16249,
+-16475,-16716,-16937,-17162,-17380,-17596,-17813,-18021,-18231,-18434,-18633,-18827,-19020,-19205,-19394,-19569,
+-19745,-19910,-20077,-20239,-20398,-20550,-20701,-20845,-20989,-21125,-21259,-21391,-21516,-21644,-21760,-21882,
+-21986,-22096,-22196,-22299,-22399,-22493,-22584,-22673,-22754,-22829,-22900,-22967,-23029,-23087,-23140,-23195,
+-23241,-23287,-23328,-23366,-23401,-23431,-23460,-23480,-23501,-23510,-23528,-23540,-23557,-23570,-23579,-23592,
+-23594,-23607,-23609,-23617,-23623,-23623,-23626,-23626,-23628,-23628,-23626,-23617,-23613,-23602,-23595,-23582,
+-23571,-23557,-23544,-23530,-23510,-23490,-23464,-23438,-23417,-23390,-23375,-23351,-23333,-23315,-23293,-23277,
+-23252,-23238,-23214,-23201,-23182,-23165,-23149,-23132,-23113,-23100,-23081,-23062,-23040,-23011,-22986,-22951,
+-22924,-22886,-22855,-22812,-22774,-22727,-22684,-22633,-22580,-22521,-22462,-22397,-22335,-22266,-22201,-22131,
+-22058,-21982,-21902,-21822,-21734,-21649,-21555,-21464,-21365,-21267,-21162,-21058,-20942,-20831,-20711,-20591,
+-20470,-20338,-20213,-20072,-19938,-19791,-19645,-19494,-19336,-19182,-19017,-18854,-18687,-18513,-18340,-18155,
+-17973,-17780,-17591,-17389,-17193,-16990,-16785,-16587,-16377,-16176,-15967,-15758,-15547,-15335,-15117,-14897,
+-14678,-14455,-14237,-14012,-13793,-13567,-13347,-13117,-12894,-12663,-12434,-12200,-11965,-11732,-11493,-11257,
+-11012,-10772,-10526,-10279,-10030,-9778,-9527,-9275,-9021,-8767,-8513,-8256,-8001,-7744,-7490,-7235,
+-6980,-6724,-6467,-6213,-5959,-5706,-5458,-5202,-4954,-4701,-4448,-4197,-3939,-3686,-3426,-3170,
+-2907,-2646,-2383,-2116,-1849,-1575,-1303,-1023,-749,-465,-188,98,380,669,958,1249,
+1548,1841,2144,2438,2738,3036,3335,3635,3939,4244,4552,4860,5171,5483,5799,6117,
+6435,6756,7080,7404,7732,8061,8393,8731,9069,9409,9752,10095,10442,10790,11141,11495,
+11852,12210,12571,12928,13291,13650,14017,14381,14743,15108,15468,15834,16197,16558,16923,17279,
+17642,17997,18359,18714,19070,19422,19775,20123,20473,20821,21162,21503,21837,22171,22501,22827,
+23153,23471,23790,24100,24411,24716,25014,25308,25594,25876,26150,26422,26684,26943,27192,27432,
+27674,27904,28132,28349,28559,28763,28962,29153,29340,29520,29695,29859,30021,30167,30315,30441,
+30565,30674,30777,30871,30961,31039,31117,31186,31249,31309,31358,31409,31451,31493,31526,31557,
+31583,31602,31623,31633,31644,31652,31651,31658,31649,31648,31637,31624,31610,31591,31572,31549,
+31525,31493,31468,31431,31401,31365,31324,31285,31240,31192,31142,31088,31028,30970,30901,30836,
+30762,30688,30608,30522,30434,30334,30241,30130,30028,29907,29795,29665,29540,29400,29261,29111,
+28960,28805,28640,28478,28297,28122,27929,27740,27542,27339,27130,26917,26696,26472,26244,26007,
+25770,25526,25272,25022,24758,24494,24225,23952,23677,23397,23111,22822,22530,22230,21930,21621,
+21315,20999,20688,20365,20049,19721,19399,19065,18737,18398,18063,17725,17383,17048,16703,16367,
+16026,15685,15347,15008,14674,14338,14007,13674,13341,13011,12682,12354,12029,11702,11381,11058,
+10741,10422,10104,9792,9477,9169,8859,8552,8246,7938,7633,7329,7028,6727,6433,6132,
+5843,5548,5260,4970,4683,4398,4113,3836,3553,3285,3003,2738,2458,2194,1922,1661,
+1396,1136,873,617,354,99,-163,-422,-680,-938,-1194,-1450,-1708,-1963,-2222,-2477,
+-2738,-2989,-3253,-3505,-3765,-4022,-4277,-4537,-4790,-5051,-5301,-5565,-5812,-6074,-6322,-6580,
+-6832,-7088,-7337,-7595,-7841,-8097,-8344,-8597,-8843,-9097,-9343,-9595,-9841,-10088,-10331,-10577,
+-10817,-11064,-11305,-11550,-11791,-12034,-12269,-12511,-12739,-12976,-13202,-13433,-13662,-13886,-14114,-14332,
+-14550,-14764,-14974,-15187,-15392,-15602,-15802,-16003,-16197,-16390,-16577,-16763,-16942,-17121,-17295,-17467,
+-17638,-17805,-17970,-18130,-18288,-18442,-18598,-18743,-18894,-19031,-19174,-19311,-19442,-19577,-19699,-19828,
+-19942,-20065,-20175,-20290,-20396,-20499,-20601,-20699,-20795,-20888,-20974,-21061,-21140,-21222,-21293,-21364,
+-21431,-21494,-21560,-21616,-21680,-21732,-21790,-21840,-21892,-21942,-21992,-22034,-22081,-22121,-22162,-22207,
+-22244,-22287,-22320,-22359,-22392,-22426,-22461,-22496,-22529,-22561,-22590,-22622,-22647,-22679,-22700,-22726,
+-22746,-22768,-22786,-22807,-22818,-22837,-22845,-22859,-22867,-22878,-22887,-22892,-22902,-22902,-22915,-22915,
+-22929,-22932,-22943,-22948,-22954,-22955,-22958,-22958,-22959,-22960,-22961,-22966,-22965,-22968,-22966,-22966,
+-22962,-22959,-22954,-22948,-22940,-22934,-22923,-22912,-22900,-22882,-22869,-22848,-22831,-22812,-22787,-22767,
+-22737,-22712,-22681,-22653,-22621,-22590,-22550,-22518,-22476,-22441,-22399,-22355,-22310,-22261,-22212,-22165,
+-22112,-22061,-22002,-21945,-21881,-21821,-21756,-21690,-21620,-21549,-21471,-21397,-21313,-21235,-21147,-21065,
+-20972,-20884,-20785,-20692,-20589,-20489,-20386,-20281,-20176,-20068,-19956,-19846,-19731,-19622,-19504,-19390,
+-19270,-19154,-19030,-18908,-18782,-18656,-18530,-18402,-18274,-18142,-18011,-17876,-17743,-17608,-17470,-17333,
+-17192,-17052,-16909,-16769,-16620,-16477,-16326,-16179,-16028,-15879,-15728,-15573,-15426,-15268,-15117,-14961,
+-14805,-14650,-14490,-14331,-14173,-14013,-13856,-13693,-13533,-13372,-13209,-13046,-12876,-12711,-12539,-12369,
+-12199,-12025,-11852,-11673,-11493,-11313,-11129,-10945,-10758,-10567,-10377,-10181,-9987,-9784,-9590,-9381,
+-9184,-8972,-8768,-8558,-8347,-8135,-7918,-7705,-7487,-7271,-7050,-6828,-6609,-6381,-6162,-5928,
+-5701,-5472,-5238,-5006,-4774,-4535,-4300,-4057,-3816,-3573,-3329,-3077,-2832,-2577,-2328,-2072,
+-1820,-1560,-1302,-1043,-781,-521,-258,7,271,537,806,1069,1339,1604,1873,2142,
+2412,2679,2953,3215,3493,3752,4032,4291,4570,4834,5107,5377,5651,5923,6199,6470,
+6738,7010,7278,7551,7823,8096,8372,8643,8914,9189,9459,9735,10005,10278,10550,10823,
+11092,11365,11630,11901,12172,12435,12710,12971,13244,13508,13779,14043,14314,14576,14845,15111,
+15378,15646,15914,16181,16449,16714,16985,17253,17525,17794,18065,18333,18604,18875,19143,19416,
+19680,19950,20219,20486,20756,21019,21289,21551,21819,22078,22342,22599,22858,23112,23366,23619,
+23869,24119,24368,24608,24853,25089,25328,25563,25792,26023,26247,26471,26690,26907,27120,27332,
+27538,27745,27945,28144,28336,28528,28711,28891,29065,29225,29381,29519,29648,29769,29877,29982,
+30074,30164,30240,30317,30380,30446,30498,30551,30593,30631,30666,30692,30720,30738,30757,30764,
+30775,30774,30777,30773,30767,30758,30746,30729,30714,30688,30667,30637,30610,30575,30540,30500,
+30459,30413,30367,30311,30257,30194,30131,30060,29988,29906,29826,29734,29645,29547,29449,29342,
+29236,29122,29004,28884,28759,28631,28497,28358,28218,28073,27924,27771,27612,27450,27285,27116,
+26946,26768,26591,26403,26217,26025,25830,25631,25430,25222,25014,24802,24586,24372,24154,23932,
+23708,23478,23249,23017,22780,22547,22303,22069,21828,21587,21347,21101,20859,20610,20367,20119,
+19873,19626,19378,19130,18884,18633,18383,18132,17879,17628,17376,17126,16877,16626,16377,16123,
+15876,15622,15374,15122,14872,14624,14373,14125,13873,13625,13375,13128,12884,12634,12391,12141,
+11897,11648,11405,11159,10917,10675,10432,10189,9947,9701,9459,9217,8975,8737,8497,8257,
+8018,7777,7536,7296,7050,6813,6567,6332,6088,5851,5609,5370,5129,4887,4651,4409,
+4175,3932,3696,3456,3219,2983,2746,2510,2271,2036,1799,1570,1337,1104,877,645,
+416,186,-41,-270,-497,-725,-953,-1181,-1404,-1631,-1854,-2077,-2301,-2519,-2743,-2961,
+-3182,-3401,-3619,-3836,-4049,-4264,-4475,-4691,-4904,-5114,-5327,-5530,-5741,-5941,-6148,-6347,
+-6550,-6750,-6952,-7150,-7349,-7544,-7740,-7936,-8126,-8326,-8512,-8706,-8895,-9083,-9274,-9463,
+-9652,-9843,-10027,-10214,-10398,-10580,-10763,-10945,-11125,-11305,-11483,-11662,-11838,-12015,-12186,-12360,
+-12533,-12710,-12877,-13047,-13213,-13375,-13544,-13702,-13869,-14027,-14190,-14345,-14504,-14660,-14814,-14969,
+-15122,-15272,-15425,-15573,-15725,-15870,-16021,-16165,-16311,-16452,-16594,-16733,-16875,-17013,-17150,-17283,
+-17417,-17547,-17677,-17807,-17929,-18056,-18177,-18298,-18419,-18535,-18649,-18758,-18872,-18975,-19087,-19188,
+-19294,-19392,-19491,-19587,-19680,-19773,-19864,-19952,-20036,-20119,-20201,-20281,-20363,-20439,-20512,-20588,
+-20651,-20726,-20787,-20855,-20915,-20976,-21033,-21088,-21145,-21194,-21250,-21295,-21342,-21388,-21430,-21474,
+-21510,-21550,-21582,-21620,-21646,-21681,-21708,-21739,-21767,-21795,-21818,-21843,-21865,-21884,-21909,-21925,
+-21948,-21966,-21985,-22005,-22020,-22036,-22050,-22069,-22080,-22101,-22110,-22127,-22137,-22152,-22159,-22176,
+-22179,-22193,-22198,-22205,-22211,-22214,-22220,-22221,-22222,-22219,-22219,-22219,-22220,-22221,-22216,-22214,
+-22209,-22204,-22199,-22195,-22189,-22186,-22178,-22173,-22164,-22159,-22148,-22144,-22133,-22124,-22115,-22103,
+-22095,-22079,-22069,-22050,-22043,-22025,-22014,-21996,-21982,-21962,-21947,-21923,-21907,-21883,-21861,-21837,
+-21809,-21784,-21759,-21726,-21701,-21662,-21632,-21596,-21566,-21528,-21497,-21459,-21420,-21380,-21334,-21292,
+-21245,-21198,-21153,-21101,-21053,-20999,-20947,-20892,-20835,-20776,-20717,-20653,-20593,-20524,-20460,-20389,
+-20321,-20248,-20178,-20101,-20030,-19949,-19874,-19791,-19712,-19629,-19548,-19462,-19378,-19291,-19202,-19115,
+-19022,-18931,-18838,-18746,-18650,-18558,-18459,-18365,-18264,-18165,-18065,-17961,-17859,-17754,-17647,-17543,
+-17434,-17328,-17219,-17108,-16999,-16886,-16774,-16656,-16542,-16426,-16315,-16198,-16081,-15962,-15843,-15720,
+-15600,-15475,-15354,-15228,-15105,-14979,-14855,-14728,-14600,-14470,-14338,-14208,-14076,-13943,-13813,-13674,
+-13543,-13401,-13264,-13121,-12979,-12836,-12694,-12550,-12404,-12254,-12105,-11955,-11799,-11647,-11486,-11333,
+-11168,-11010,-10845,-10682,-10517,-10346,-10179,-10005,-9835,-9661,-9484,-9307,-9124,-8945,-8761,-8577,
+-8393,-8206,-8019,-7828,-7635,-7439,-7245,-7050,-6852,-6655,-6453,-6253,-6049,-5845,-5640,-5431,
+-5227,-5016,-4810,-4597,-4388,-4175,-3962,-3749,-3530,-3316,-3096,-2879,-2658,-2441,-2222,-2005,
+-1783,-1564,-1340,-1120,-895,-672,-450,-221,-3,225,443,669,892,1117,1343,1565,
+1793,2017,2246,2471,2697,2925,3146,3376,3595,3828,4050,4282,4504,4732,4959,5182,
+5412,5636,5864,6090,6313,6541,6769,6993,7220,7443,7668,7894,8118,8344,8569,8797,
+9022,9251,9478,9703,9936,10157,10393,10616,10847,11079,11308,11541,11771,12004,12235,12469,
+12701,12937,13171,13412,13647,13888,14122,14361,14599,14839,15078,15320,15560,15804,16047,16290,
+16533,16778,17023,17267,17514,17758,18003,18245,18492,18735,18986,19232,19480,19731,19972,20224,
+20464,20713,20957,21203,21447,21695,21935,22181,22420,22658,22900,23131,23367,23602,23830,24063,
+24287,24514,24736,24954,25171,25384,25598,25803,26010,26213,26411,26613,26802,26996,27183,27365,
+27547,27721,27898,28064,28229,28384,28536,28682,28822,28959,29091,29216,29341,29456,29572,29680,
+29786,29891,29988,30088,30178,30268,30352,30434,30513,30590,30665,30735,30808,30874,30939,31002,
+31056,31108,31152,31194,31231,31267,31297,31323,31349,31369,31388,31402,31416,31425,31435,31436,
+31441,31438,31440,31433,31428,31419,31407,31396,31380,31363,31345,31326,31301,31281,31252,31229,
+31200,31173,31141,31110,31074,31042,31004,30966,30924,30879,30834,30784,30731,30680,30621,30563,
+30499,30436,30368,30302,30225,30156,30075,29999,29914,29827,29739,29644,29551,29452,29352,29249,
+29143,29032,28924,28805,28688,28565,28438,28312,28178,28048,27908,27769,27624,27477,27328,27174,
+27020,26858,26701,26532,26372,26198,26030,25851,25674,25495,25310,25128,24937,24746,24555,24358,
+24164,23965,23766,23561,23359,23150,22941,22732,22517,22307,22090,21875,21655,21438,21215,20997,
+20771,20552,20326,20103,19882,19652,19431,19200,18979,18752,18525,18301,18070,17846,17616,17390,
+17164,16939,16713,16490,16265,16044,15818,15598,15374,15151,14932,14708,14491,14270,14051,13835,
+13611,13401,13178,12967,12751,12540,12327,12119,11903,11698,11484,11274,11067,10858,10652,10445,
+10241,10037,9836,9633,9430,9231,9027,8831,8625,8432,8226,8032,7833,7634,7440,7240,
+7042,6845,6645,6452,6253,6058,5865,5668,5477,5278,5085,4889,4689,4500,4296,4109,
+3909,3721,3522,3332,3134,2943,2745,2555,2355,2167,1968,1777,1578,1389,1192,999,
+806,612,418,227,31,-156,-349,-544,-735,-930,-1122,-1312,-1508,-1697,-1890,-2081,
+-2274,-2460,-2653,-2837,-3028,-3212,-3401,-3587,-3774,-3960,-4146,-4330,-4513,-4693,-4879,-5055,
+-5241,-5418,-5597,-5778,-5952,-6129,-6308,-6477,-6657,-6823,-6997,-7168,-7337,-7507,-7673,-7842,
+-8006,-8173,-8335,-8501,-8663,-8823,-8982,-9140,-9297,-9457,-9613,-9772,-9921,-10075,-10224,-10372,
+-10526,-10669,-10821,-10966,-11109,-11259,-11395,-11541,-11679,-11818,-11956,-12093,-12231,-12370,-12502,-12639,
+-12766,-12902,-13027,-13160,-13284,-13414,-13540,-13666,-13796,-13916,-14045,-14159,-14282,-14400,-14520,-14636,
+-14755,-14871,-14987,-15102,-15214,-15330,-15443,-15555,-15670,-15775,-15888,-15993,-16101,-16207,-16313,-16415,
+-16521,-16621,-16727,-16827,-16929,-17030,-17128,-17225,-17322,-17415,-17512,-17603,-17698,-17788,-17877,-17969,
+-18052,-18145,-18226,-18315,-18398,-18480,-18565,-18640,-18721,-18794,-18870,-18944,-19018,-19088,-19161,-19229,
+-19299,-19362,-19427,-19490,-19551,-19614,-19671,-19732,-19785,-19843,-19895,-19946,-19998,-20044,-20093,-20139,
+-20185,-20232,-20274,-20317,-20354,-20396,-20431,-20468,-20503,-20534,-20571,-20597,-20632,-20657,-20686,-20714,
+-20738,-20765,-20785,-20809,-20828,-20851,-20866,-20889,-20903,-20920,-20936,-20951,-20967,-20981,-20996,-21009,
+-21023,-21032,-21049,-21062,-21073,-21086,-21094,-21102,-21112,-21118,-21125,-21135,-21140,-21154,-21161,-21172,
+-21179,-21188,-21190,-21202,-21204,-21213,-21219,-21226,-21233,-21239,-21244,-21249,-21254,-21259,-21261,-21266,
+-21267,-21270,-21270,-21270,-21268,-21267,-21264,-21259,-21260,-21252,-21255,-21245,-21247,-21235,-21236,-21224,
+-21219,-21208,-21201,-21189,-21184,-21168,-21164,-21145,-21139,-21121,-21112,-21093,-21083,-21061,-21050,-21031,
+-21014,-20999,-20978,-20962,-20939,-20919,-20894,-20871,-20847,-20822,-20796,-20771,-20745,-20718,-20691,-20658,
+-20629,-20596,-20562,-20532,-20493,-20462,-20424,-20384,-20351,-20307,-20271,-20225,-20185,-20140,-20100,-20052,
+-20011,-19959,-19914,-19862,-19812,-19762,-19709,-19658,-19603,-19548,-19495,-19437,-19384,-19325,-19269,-19209,
+-19150,-19088,-19031,-18966,-18910,-18841,-18780,-18716,-18648,-18588,-18519,-18454,-18389,-18319,-18254,-18183,
+-18116,-18041,-17973,-17895,-17832,-17753,-17686,-17608,-17537,-17463,-17386,-17314,-17231,-17158,-17074,-17000,
+-16919,-16844,-16764,-16685,-16603,-16522,-16438,-16355,-16272,-16185,-16103,-16013,-15927,-15840,-15751,-15661,
+-15569,-15477,-15384,-15289,-15195,-15097,-14999,-14901,-14802,-14699,-14598,-14491,-14388,-14283,-14174,-14070,
+-13958,-13850,-13736,-13623,-13506,-13390,-13273,-13152,-13033,-12909,-12785,-12659,-12534,-12408,-12280,-12150,
+-12019,-11884,-11751,-11614,-11475,-11341,-11195,-11062,-10912,-10773,-10625,-10479,-10333,-10182,-10031,-9877,
+-9723,-9569,-9412,-9258,-9097,-8940,-8778,-8615,-8451,-8283,-8120,-7950,-7783,-7612,-7443,-7271,
+-7104,-6932,-6761,-6588,-6413,-6240,-6066,-5890,-5713,-5534,-5360,-5181,-5008,-4825,-4651,-4467,
+-4293,-4111,-3935,-3753,-3573,-3391,-3209,-3028,-2847,-2665,-2486,-2302,-2122,-1941,-1758,-1578,
+-1394,-1213,-1029,-848,-661,-480,-295,-112,72,255,442,624,810,995,1178,1365,
+1549,1733,1919,2103,2290,2476,2666,2852,3043,3227,3418,3604,3797,3984,4172,4362,
+4551,4740,4934,5123,5318,5510,5704,5897,6095,6286,6484,6676,6873,7070,7270,7468,
+7668,7866,8064,8266,8465,8664,8869,9066,9276,9475,9683,9887,10089,10298,10500,10710,
+10913,11125,11331,11542,11751,11961,12171,12382,12594,12804,13022,13228,13444,13654,13868,14083,
+14297,14513,14724,14942,15154,15370,15587,15796,16014,16226,16440,16658,16870,17085,17297,17507,
+17723,17930,18152,18357,18575,18782,18993,19204,19411,19622,19827,20034,20238,20447,20649,20856,
+21058,21260,21462,21659,21860,22057,22254,22449,22641,22834,23025,23214,23402,23588,23770,23954,
+24132,24318,24490,24675,24840,25016,25180,25350,25513,25681,25841,26004,26161,26318,26471,26627,
+26773,26927,27070,27215,27361,27497,27639,27773,27907,28039,28166,28296,28416,28537,28652,28764,
+28874,28978,29082,29178,29278,29368,29459,29548,29629,29717,29791,29873,29946,30021,30092,30166,
+30230,30300,30360,30424,30482,30542,30597,30656,30706,30757,30799,30838,30874,30905,30938,30962,
+30990,31008,31031,31043,31060,31069,31077,31083,31083,31088,31084,31083,31079,31071,31061,31051,
+31035,31023,31003,30985,30964,30941,30919,30893,30868,30839,30810,30779,30747,30712,30677,30636,
+30598,30553,30508,30457,30408,30353,30296,30239,30174,30114,30045,29980,29904,29834,29752,29679,
+29595,29512,29425,29333,29242,29147,29051,28952,28851,28748,28639,28533,28417,28307,28187,28072,
+27948,27827,27700,27572,27440,27307,27170,27035,26894,26755,26610,26466,26320,26169,26020,25867,
+25708,25557,25392,25236,25070,24908,24747,24579,24417,24246,24076,23908,23731,23562,23385,23212,
+23033,22858,22679,22503,22323,22139,21960,21774,21593,21409,21227,21042,20858,20672,20483,20303,
+20109,19929,19733,19549,19354,19166,18974,18785,18593,18406,18211,18024,17830,17640,17446,17255,
+17061,16869,16676,16482,16294,16098,15910,15713,15522,15326,15133,14937,14744,14551,14357,14165,
+13970,13776,13581,13387,13194,12997,12807,12610,12418,12224,12028,11836,11640,11451,11251,11066,
+10867,10678,10483,10294,10098,9913,9714,9528,9332,9142,8950,8761,8571,8382,8195,8007,
+7816,7632,7441,7255,7070,6884,6700,6516,6328,6146,5959,5778,5594,5413,5231,5051,
+4872,4690,4514,4330,4156,3977,3801,3625,3449,3275,3101,2925,2753,2579,2410,2237,
+2068,1897,1728,1559,1394,1224,1060,888,725,555,395,228,66,-96,-261,-420,
+-586,-744,-908,-1066,-1224,-1385,-1540,-1703,-1859,-2018,-2177,-2331,-2490,-2646,-2802,-2961,
+-3113,-3272,-3422,-3581,-3732,-3888,-4039,-4195,-4347,-4501,-4655,-4806,-4960,-5112,-5262,-5414,
+-5567,-5715,-5869,-6015,-6167,-6316,-6465,-6615,-6764,-6912,-7061,-7210,-7359,-7507,-7653,-7799,
+-7945,-8090,-8235,-8382,-8525,-8672,-8816,-8960,-9104,-9246,-9390,-9534,-9673,-9816,-9952,-10094,
+-10229,-10372,-10504,-10647,-10779,-10919,-11050,-11186,-11319,-11453,-11584,-11716,-11844,-11974,-12100,-12229,
+-12354,-12480,-12603,-12727,-12849,-12969,-13093,-13210,-13332,-13445,-13565,-13675,-13791,-13902,-14012,-14124,
+-14233,-14338,-14449,-14549,-14659,-14761,-14863,-14965,-15063,-15163,-15261,-15356,-15455,-15548,-15645,-15737,
+-15829,-15920,-16008,-16098,-16182,-16270,-16357,-16441,-16527,-16610,-16692,-16773,-16854,-16932,-17015,-17090,
+-17171,-17241,-17321,-17392,-17468,-17541,-17608,-17680,-17747,-17817,-17890,-17953,-18025,-18085,-18151,-18216,
+-18277,-18340,-18404,-18460,-18524,-18578,-18637,-18694,-18751,-18805,-18864,-18914,-18970,-19024,-19073,-19125,
+-19171,-19222,-19269,-19319,-19365,-19413,-19456,-19501,-19544,-19586,-19627,-19670,-19707,-19750,-19787,-19824,
+-19861,-19896,-19932,-19965,-20000,-20029,-20063,-20091,-20122,-20153,-20179,-20210,-20234,-20259,-20281,-20310,
+-20329,-20356,-20377,-20397,-20420,-20436,-20457,-20476,-20489,-20509,-20520,-20540,-20553,-20569,-20584,-20596,
+-20608,-20619,-20628,-20642,-20654,-20664,-20672,-20678,-20687,-20694,-20702,-20708,-20713,-20718,-20724,-20726,
+-20733,-20735,-20742,-20744,-20747,-20750,-20752,-20755,-20757,-20758,-20757,-20762,-20762,-20768,-20766,-20768,
+-20764,-20767,-20763,-20763,-20758,-20757,-20751,-20747,-20742,-20735,-20732,-20723,-20716,-20708,-20697,-20690,
+-20679,-20668,-20656,-20648,-20630,-20627,-20605,-20597,-20579,-20567,-20551,-20538,-20521,-20507,-20489,-20475,
+-20456,-20440,-20420,-20403,-20383,-20365,-20344,-20326,-20307,-20288,-20266,-20246,-20223,-20201,-20177,-20155,
+-20128,-20105,-20077,-20052,-20025,-19999,-19969,-19943,-19912,-19882,-19851,-19821,-19787,-19758,-19723,-19688,
+-19656,-19619,-19584,-19546,-19508,-19469,-19432,-19390,-19351,-19310,-19267,-19228,-19179,-19141,-19091,-19048,
+-18999,-18951,-18903,-18856,-18807,-18758,-18708,-18655,-18602,-18551,-18494,-18444,-18386,-18334,-18275,-18221,
+-18163,-18107,-18047,-17989,-17927,-17867,-17806,-17746,-17683,-17623,-17559,-17495,-17432,-17365,-17303,-17234,
+-17174,-17101,-17039,-16970,-16900,-16835,-16762,-16696,-16622,-16554,-16482,-16409,-16340,-16265,-16192,-16118,
+-16040,-15966,-15888,-15812,-15733,-15653,-15573,-15490,-15412,-15328,-15248,-15164,-15080,-14998,-14908,-14824,
+-14730,-14645,-14551,-14466,-14371,-14283,-14185,-14090,-13997,-13894,-13803,-13698,-13603,-13503,-13400,-13300,
+-13197,-13093,-12985,-12880,-12770,-12663,-12552,-12440,-12330,-12216,-12104,-11987,-11874,-11752,-11640,-11515,
+-11402,-11274,-11155,-11027,-10901,-10776,-10647,-10519,-10390,-10261,-10128,-9997,-9859,-9726,-9588,-9449,
+-9312,-9172,-9033,-8888,-8749,-8599,-8459,-8311,-8168,-8019,-7874,-7722,-7577,-7423,-7274,-7122,
+-6970,-6818,-6664,-6508,-6358,-6197,-6046,-5886,-5730,-5575,-5414,-5259,-5100,-4940,-4785,-4623,
+-4465,-4305,-4145,-3984,-3823,-3662,-3500,-3337,-3174,-3014,-2851,-2692,-2527,-2363,-2202,-2035,
+-1876,-1710,-1547,-1384,-1216,-1055,-885,-724,-556,-396,-230,-65,102,268,433,600,
+766,931,1101,1263,1434,1599,1766,1936,2101,2269,2440,2603,2777,2939,3111,3279,
+3449,3621,3789,3962,4130,4303,4473,4644,4816,4988,5161,5336,5508,5681,5857,6029,
+6207,6380,6558,6733,6908,7086,7261,7440,7616,7795,7976,8153,8335,8511,8691,8870,
+9051,9231,9413,9594,9778,9960,10145,10326,10510,10691,10877,11060,11247,11432,11617,11799,
+11988,12170,12360,12545,12733,12921,13108,13294,13483,13668,13855,14043,14228,14418,14604,14794,
+14978,15169,15353,15544,15732,15921,16108,16295,16480,16668,16852,17041,17222,17413,17594,17786,
+17966,18154,18335,18519,18706,18886,19074,19252,19438,19615,19798,19977,20156,20335,20516,20690,
+20869,21042,21219,21391,21565,21737,21909,22082,22250,22420,22587,22754,22921,23082,23249,23409,
+23571,23730,23888,24043,24200,24352,24506,24656,24808,24955,25101,25249,25390,25534,25675,25814,
+25952,26089,26222,26356,26488,26616,26746,26872,26995,27119,27239,27358,27476,27589,27708,27817,
+27932,28037,28143,28243,28342,28437,28528,28620,28705,28793,28870,28951,29025,29099,29175,29243,
+29312,29376,29439,29502,29562,29618,29678,29731,29786,29834,29883,29923,29960,29996,30025,30055,
+30079,30098,30120,30134,30149,30158,30168,30171,30177,30176,30176,30173,30168,30159,30152,30135,
+30126,30102,30093,30065,30052,30024,30002,29976,29950,29920,29893,29858,29828,29791,29755,29717,
+29674,29631,29585,29536,29490,29434,29383,29325,29267,29207,29142,29078,29008,28941,28866,28794,
+28714,28638,28554,28472,28388,28297,28210,28114,28022,27925,27828,27724,27625,27517,27412,27301,
+27191,27075,26964,26840,26726,26602,26477,26353,26225,26091,25967,25827,25700,25558,25424,25279,
+25141,24992,24850,24698,24556,24402,24257,24101,23950,23793,23635,23481,23317,23164,22999,22838,
+22677,22510,22346,22179,22012,21844,21674,21506,21334,21166,20991,20822,20644,20476,20296,20128,
+19947,19775,19598,19421,19246,19067,18889,18713,18532,18357,18176,17998,17817,17638,17456,17277,
+17095,16917,16733,16557,16375,16196,16016,15835,15656,15476,15298,15115,14938,14752,14575,14390,
+14215,14032,13856,13676,13497,13318,13139,12959,12783,12600,12428,12242,12069,11889,11711,11539,
+11357,11186,11003,10831,10651,10480,10301,10130,9953,9781,9606,9434,9260,9088,8916,8744,
+8572,8402,8228,8063,7887,7725,7550,7387,7213,7051,6880,6715,6546,6383,6214,6052,
+5885,5721,5557,5395,5230,5071,4904,4744,4584,4419,4264,4100,3943,3783,3623,3464,
+3304,3149,2991,2836,2680,2522,2368,2210,2058,1901,1751,1594,1444,1290,1137,985,
+833,681,531,380,230,81,-70,-217,-369,-515,-664,-812,-959,-1108,-1255,-1401,
+-1549,-1694,-1840,-1985,-2131,-2274,-2420,-2562,-2707,-2850,-2993,-3135,-3280,-3418,-3562,-3698,
+-3843,-3980,-4125,-4264,-4404,-4544,-4679,-4820,-4955,-5094,-5233,-5370,-5508,-5642,-5778,-5913,
+-6048,-6185,-6315,-6451,-6580,-6717,-6845,-6985,-7108,-7247,-7371,-7506,-7630,-7761,-7888,-8017,
+-8145,-8271,-8398,-8522,-8648,-8769,-8898,-9018,-9145,-9263,-9389,-9507,-9632,-9748,-9871,-9989,
+-10109,-10228,-10344,-10462,-10579,-10695,-10809,-10929,-11037,-11156,-11264,-11379,-11488,-11602,-11708,-11824,
+-11926,-12043,-12144,-12256,-12359,-12467,-12570,-12677,-12779,-12884,-12985,-13087,-13188,-13291,-13388,-13490,
+-13586,-13686,-13782,-13880,-13972,-14071,-14160,-14258,-14344,-14443,-14526,-14624,-14707,-14801,-14886,-14976,
+-15060,-15147,-15232,-15316,-15401,-15481,-15566,-15645,-15726,-15807,-15885,-15964,-16043,-16116,-16196,-16270,
+-16344,-16418,-16491,-16562,-16633,-16702,-16774,-16843,-16909,-16979,-17041,-17110,-17174,-17235,-17303,-17357,
+-17426,-17481,-17546,-17598,-17656,-17713,-17767,-17824,-17876,-17928,-17979,-18030,-18079,-18127,-18178,-18220,
+-18271,-18313,-18359,-18403,-18443,-18487,-18530,-18572,-18607,-18651,-18682,-18726,-18755,-18793,-18824,-18857,
+-18891,-18921,-18954,-18984,-19012,-19042,-19068,-19094,-19122,-19143,-19173,-19197,-19219,-19246,-19265,-19289,
+-19309,-19329,-19348,-19368,-19386,-19403,-19422,-19436,-19454,-19470,-19485,-19500,-19517,-19528,-19546,-19555,
+-19571,-19581,-19593,-19604,-19612,-19626,-19636,-19646,-19659,-19664,-19679,-19682,-19697,-19698,-19711,-19714,
+-19723,-19728,-19739,-19743,-19753,-19757,-19764,-19769,-19773,-19781,-19785,-19793,-19797,-19800,-19806,-19806,
+-19813,-19813,-19820,-19821,-19825,-19827,-19832,-19831,-19835,-19835,-19834,-19832,-19833,-19826,-19825,-19820,
+-19813,-19810,-19801,-19795,-19785,-19779,-19766,-19760,-19746,-19737,-19724,-19709,-19697,-19680,-19669,-19653,
+-19637,-19620,-19600,-19583,-19562,-19542,-19522,-19504,-19482,-19464,-19440,-19418,-19396,-19369,-19346,-19317,
+-19294,-19266,-19243,-19216,-19192,-19161,-19136,-19105,-19075,-19046,-19015,-18985,-18954,-18919,-18889,-18854,
+-18821,-18785,-18752,-18716,-18682,-18647,-18612,-18574,-18540,-18498,-18465,-18422,-18388,-18343,-18307,-18261,
+-18223,-18179,-18139,-18098,-18053,-18011,-17968,-17923,-17884,-17835,-17791,-17745,-17697,-17654,-17605,-17562,
+-17514,-17466,-17420,-17369,-17322,-17272,-17223,-17172,-17123,-17071,-17020,-16968,-16913,-16861,-16807,-16754,
+-16699,-16645,-16588,-16534,-16478,-16422,-16363,-16308,-16245,-16189,-16128,-16067,-16008,-15945,-15885,-15820,
+-15761,-15693,-15632,-15565,-15499,-15432,-15365,-15296,-15228,-15159,-15088,-15019,-14942,-14875,-14796,-14725,
+-14648,-14569,-14497,-14414,-14341,-14259,-14181,-14098,-14016,-13933,-13846,-13762,-13675,-13587,-13501,-13410,
+-13322,-13231,-13142,-13047,-12956,-12861,-12766,-12670,-12574,-12476,-12378,-12279,-12178,-12080,-11973,-11876,
+-11765,-11664,-11555,-11450,-11341,-11236,-11126,-11018,-10906,-10796,-10681,-10571,-10456,-10343,-10226,-10111,
+-9993,-9878,-9756,-9641,-9517,-9402,-9279,-9157,-9036,-8910,-8788,-8664,-8539,-8414,-8288,-8161,
+-8034,-7904,-7778,-7644,-7519,-7384,-7260,-7124,-6996,-6861,-6730,-6596,-6465,-6331,-6200,-6062,
+-5931,-5791,-5658,-5521,-5386,-5250,-5113,-4976,-4842,-4701,-4566,-4423,-4288,-4145,-4009,-3867,
+-3729,-3586,-3444,-3303,-3162,-3021,-2878,-2740,-2592,-2454,-2305,-2164,-2018,-1875,-1727,-1583,
+-1437,-1292,-1146,-1000,-853,-706,-558,-409,-262,-114,33,182,330,480,628,779,
+929,1080,1233,1381,1535,1684,1836,1988,2139,2292,2444,2598,2749,2903,3054,3207,
+3363,3514,3673,3824,3982,4136,4289,4443,4597,4751,4907,5062,5218,5373,5529,5684,
+5840,5996,6150,6310,6464,6622,6777,6934,7088,7248,7401,7558,7718,7870,8031,8186,
+8344,8501,8661,8815,8976,9129,9290,9445,9604,9760,9918,10076,10234,10393,10551,10710,
+10867,11025,11183,11344,11499,11664,11818,11981,12137,12298,12454,12617,12773,12934,13094,13253,
+13415,13574,13735,13895,14056,14217,14377,14538,14700,14858,15021,15181,15343,15505,15664,15827,
+15988,16149,16313,16470,16634,16795,16957,17120,17278,17444,17601,17763,17926,18081,18246,18400,
+18561,18721,18878,19040,19198,19357,19515,19671,19829,19986,20140,20297,20447,20604,20752,20907,
+21057,21207,21361,21507,21658,21804,21951,22095,22242,22382,22526,22667,22805,22946,23083,23218,
+23353,23486,23618,23752,23879,24012,24136,24261,24388,24507,24631,24749,24869,24986,25100,25215,
+25326,25437,25548,25655,25761,25868,25971,26072,26175,26269,26370,26462,26556,26650,26738,26828,
+26916,27001,27086,27169,27250,27332,27410,27486,27561,27633,27704,27770,27833,27894,27947,27996,
+28040,28079,28117,28149,28179,28206,28230,28246,28266,28276,28289,28298,28301,28307,28303,28303,
+28297,28292,28282,28274,28256,28246,28224,28210,28189,28164,28147,28115,28095,28062,28035,28001,
+27970,27930,27897,27852,27815,27767,27722,27675,27622,27576,27516,27465,27400,27342,27277,27211,
+27144,27075,27003,26931,26855,26773,26696,26611,26527,26443,26351,26265,26166,26074,25973,25878,
+25775,25674,25567,25461,25351,25238,25124,25007,24889,24768,24648,24522,24397,24270,24138,24009,
+23875,23742,23607,23467,23328,23183,23043,22897,22755,22606,22461,22310,22160,22007,21855,21700,
+21546,21390,21232,21075,20917,20758,20598,20436,20275,20111,19947,19785,19615,19459,19285,19128,
+18956,18793,18626,18462,18293,18128,17958,17793,17624,17458,17291,17124,16958,16791,16626,16459,
+16294,16126,15962,15795,15630,15464,15299,15136,14970,14807,14639,14479,14312,14150,13989,13824,
+13665,13500,13342,13175,13018,12850,12697,12529,12377,12210,12052,11895,11734,11580,11421,11259,
+11106,10944,10792,10633,10477,10322,10163,10011,9852,9699,9543,9389,9232,9080,8922,8773,
+8617,8466,8313,8159,8009,7853,7702,7547,7395,7242,7094,6940,6790,6639,6485,6336,
+6184,6034,5887,5734,5588,5438,5288,5139,4991,4842,4696,4546,4399,4253,4105,3957,
+3813,3666,3519,3374,3227,3083,2940,2793,2654,2508,2366,2221,2082,1936,1799,1654,
+1517,1375,1236,1097,956,820,680,544,407,273,135,2,-137,-269,-407,-539,
+-673,-806,-935,-1067,-1198,-1328,-1459,-1589,-1720,-1847,-1977,-2103,-2233,-2360,-2486,-2614,
+-2739,-2861,-2987,-3109,-3234,-3355,-3481,-3599,-3726,-3842,-3969,-4085,-4210,-4326,-4449,-4566,
+-4685,-4802,-4921,-5036,-5157,-5270,-5389,-5504,-5620,-5735,-5852,-5964,-6081,-6194,-6310,-6423,
+-6538,-6650,-6764,-6877,-6985,-7101,-7207,-7324,-7431,-7545,-7654,-7766,-7878,-7985,-8097,-8205,
+-8315,-8422,-8534,-8637,-8750,-8853,-8963,-9071,-9177,-9285,-9389,-9497,-9602,-9708,-9812,-9917,
+-10021,-10125,-10228,-10331,-10434,-10538,-10638,-10743,-10841,-10946,-11041,-11144,-11239,-11340,-11436,-11536,
+-11630,-11733,-11824,-11924,-12014,-12110,-12200,-12297,-12390,-12483,-12570,-12662,-12750,-12840,-12929,-13015,
+-13099,-13185,-13266,-13354,-13433,-13517,-13597,-13676,-13758,-13835,-13913,-13990,-14065,-14140,-14215,-14285,
+-14362,-14428,-14501,-14569,-14637,-14708,-14772,-14841,-14905,-14971,-15032,-15098,-15155,-15222,-15276,-15342,
+-15395,-15458,-15512,-15571,-15622,-15680,-15733,-15786,-15839,-15888,-15939,-15989,-16038,-16086,-16136,-16181,
+-16229,-16274,-16316,-16363,-16403,-16448,-16487,-16532,-16568,-16608,-16646,-16683,-16721,-16761,-16795,-16831,
+-16866,-16899,-16937,-16964,-17002,-17029,-17063,-17094,-17122,-17155,-17182,-17209,-17238,-17261,-17289,-17315,
+-17337,-17366,-17385,-17412,-17434,-17458,-17479,-17499,-17520,-17539,-17562,-17576,-17597,-17615,-17632,-17650,
+-17666,-17682,-17698,-17713,-17727,-17741,-17756,-17768,-17782,-17792,-17805,-17813,-17824,-17833,-17845,-17852,
+-17863,-17868,-17876,-17882,-17890,-17895,-17903,-17906,-17915,-17914,-17922,-17921,-17927,-17930,-17931,-17936,
+-17935,-17939,-17936,-17940,-17939,-17941,-17940,-17941,-17941,-17939,-17939,-17934,-17933,-17929,-17927,-17924,
+-17919,-17917,-17908,-17904,-17893,-17887,-17878,-17869,-17857,-17846,-17834,-17822,-17809,-17794,-17781,-17768,
+-17750,-17739,-17718,-17704,-17685,-17667,-17651,-17630,-17611,-17592,-17573,-17552,-17534,-17508,-17493,-17468,
+-17448,-17426,-17401,-17381,-17358,-17333,-17314,-17286,-17266,-17241,-17213,-17192,-17164,-17139,-17114,-17085,
+-17060,-17032,-17005,-16978,-16948,-16921,-16889,-16861,-16832,-16802,-16772,-16738,-16710,-16675,-16647,-16613,
+-16580,-16547,-16512,-16480,-16445,-16413,-16379,-16341,-16306,-16265,-16232,-16190,-16156,-16116,-16076,-16035,
+-15994,-15954,-15912,-15873,-15828,-15788,-15745,-15701,-15659,-15610,-15568,-15519,-15474,-15430,-15383,-15337,
+-15287,-15239,-15189,-15140,-15090,-15039,-14988,-14935,-14881,-14829,-14775,-14726,-14668,-14617,-14559,-14503,
+-14448,-14389,-14335,-14274,-14216,-14156,-14098,-14035,-13978,-13914,-13853,-13794,-13727,-13668,-13601,-13539,
+-13471,-13411,-13340,-13278,-13206,-13140,-13071,-13002,-12935,-12863,-12797,-12723,-12652,-12580,-12508,-12435,
+-12361,-12288,-12211,-12138,-12058,-11987,-11906,-11832,-11751,-11673,-11594,-11511,-11435,-11348,-11271,-11184,
+-11103,-11018,-10933,-10850,-10764,-10677,-10590,-10502,-10413,-10326,-10235,-10147,-10056,-9963,-9873,-9779,
+-9685,-9591,-9495,-9400,-9304,-9207,-9109,-9010,-8912,-8810,-8711,-8607,-8508,-8404,-8301,-8199,
+-8092,-7990,-7881,-7776,-7667,-7561,-7452,-7343,-7236,-7123,-7015,-6903,-6791,-6680,-6565,-6452,
+-6337,-6224,-6107,-5993,-5876,-5761,-5643,-5528,-5409,-5292,-5175,-5055,-4939,-4817,-4698,-4575,
+-4458,-4333,-4216,-4092,-3973,-3851,-3727,-3605,-3482,-3358,-3238,-3114,-2991,-2867,-2742,-2618,
+-2494,-2369,-2244,-2121,-1995,-1872,-1745,-1622,-1494,-1369,-1241,-1116,-991,-864,-742,-612,
+-489,-361,-236,-110,15,142,270,395,522,647,773,901,1027,1153,1280,1404,
+1533,1657,1786,1910,2042,2162,2295,2416,2546,2673,2799,2927,3054,3179,3309,3434,
+3564,3689,3817,3942,4071,4196,4327,4453,4584,4711,4840,4964,5096,5220,5351,5478,
+5608,5740,5867,5999,6125,6255,6383,6513,6642,6774,6904,7034,7164,7295,7425,7556,
+7686,7816,7948,8079,8212,8344,8477,8608,8740,8870,9004,9135,9271,9403,9537,9669,
+9801,9935,10067,10201,10333,10469,10602,10736,10869,11004,11137,11273,11405,11540,11673,11808,
+11940,12073,12209,12340,12478,12609,12746,12880,13013,13148,13281,13415,13548,13681,13815,13949,
+14081,14217,14346,14482,14614,14747,14880,15011,15143,15275,15406,15537,15669,15800,15931,16062,
+16193,16324,16452,16582,16711,16840,16969,17097,17223,17353,17476,17604,17727,17853,17980,18101,
+18230,18350,18473,18595,18716,18836,18957,19076,19196,19313,19431,19547,19662,19778,19890,20009,
+20115,20235,20340,20452,20562,20669,20777,20884,20989,21094,21198,21298,21401,21501,21602,21701,
+21799,21897,21993,22087,22183,22272,22367,22455,22546,22633,22721,22806,22892,22973,23058,23138,
+23220,23299,23377,23453,23531,23603,23679,23749,23819,23888,23949,24006,24059,24108,24153,24198,
+24235,24274,24304,24335,24358,24382,24401,24419,24432,24443,24449,24453,24457,24454,24452,24441,
+24437,24420,24413,24393,24376,24357,24330,24310,24278,24254,24222,24189,24156,24119,24083,24043,
+24001,23956,23910,23862,23813,23759,23707,23651,23590,23533,23465,23404,23335,23266,23195,23122,
+23049,22971,22893,22811,22727,22643,22555,22468,22379,22287,22193,22100,22000,21903,21800,21698,
+21593,21488,21381,21271,21163,21049,20938,20818,20704,20583,20465,20344,20223,20098,19976,19847,
+19722,19593,19464,19336,19203,19072,18938,18806,18670,18537,18400,18263,18128,17987,17852,17714,
+17574,17437,17291,17155,17012,16872,16732,16590,16452,16309,16168,16025,15883,15740,15599,15456,
+15316,15173,15032,14891,14749,14606,14465,14324,14183,14041,13902,13758,13621,13479,13339,13198,
+13062,12917,12782,12638,12503,12363,12227,12086,11950,11814,11673,11540,11401,11265,11132,10993,
+10861,10723,10589,10454,10319,10185,10051,9918,9783,9650,9516,9384,9253,9119,8989,8857,
+8726,8593,8464,8332,8200,8069,7938,7808,7679,7549,7420,7291,7161,7031,6904,6773,
+6648,6517,6392,6264,6138,6009,5884,5754,5630,5500,5375,5248,5122,4998,4872,4746,
+4622,4496,4372,4248,4127,4001,3882,3756,3637,3510,3391,3268,3146,3025,2906,2784,
+2668,2543,2426,2304,2189,2069,1952,1833,1716,1599,1482,1364,1252,1131,1022,902,
+791,673,562,446,338,222,111,-1,-113,-225,-335,-447,-555,-667,-774,-885,
+-993,-1103,-1210,-1319,-1425,-1533,-1640,-1746,-1853,-1962,-2065,-2172,-2277,-2379,-2488,-2588,
+-2695,-2798,-2902,-3007,-3110,-3213,-3315,-3415,-3519,-3622,-3725,-3830,-3927,-4032,-4131,-4230,
+-4334,-4430,-4532,-4631,-4730,-4828,-4929,-5024,-5125,-5221,-5320,-5418,-5516,-5611,-5710,-5803,
+-5903,-5994,-6095,-6187,-6284,-6378,-6471,-6566,-6657,-6754,-6842,-6941,-7028,-7122,-7214,-7303,
+-7396,-7484,-7577,-7665,-7756,-7845,-7931,-8023,-8107,-8198,-8286,-8372,-8460,-8543,-8629,-8712,
+-8797,-8881,-8963,-9047,-9131,-9211,-9293,-9373,-9453,-9534,-9611,-9692,-9767,-9849,-9920,-10001,
+-10072,-10151,-10219,-10297,-10366,-10440,-10511,-10581,-10653,-10718,-10792,-10854,-10926,-10989,-11056,-11122,
+-11183,-11251,-11309,-11375,-11431,-11495,-11552,-11612,-11670,-11727,-11786,-11839,-11898,-11949,-12007,-12057,
+-12111,-12162,-12212,-12266,-12312,-12364,-12411,-12457,-12506,-12549,-12597,-12641,-12686,-12732,-12771,-12817,
+-12856,-12898,-12938,-12976,-13017,-13054,-13092,-13130,-13165,-13202,-13236,-13272,-13307,-13338,-13375,-13402,
+-13438,-13465,-13497,-13526,-13556,-13582,-13610,-13637,-13663,-13692,-13717,-13740,-13768,-13787,-13815,-13836,
+-13858,-13881,-13901,-13922,-13943,-13961,-13980,-13999,-14015,-14033,-14049,-14067,-14081,-14099,-14112,-14126,
+-14142,-14153,-14167,-14181,-14191,-14205,-14214,-14223,-14236,-14240,-14254,-14260,-14268,-14279,-14282,-14292,
+-14296,-14304,-14308,-14317,-14317,-14329,-14326,-14336,-14336,-14339,-14343,-14344,-14348,-14350,-14351,-14356,
+-14353,-14355,-14357,-14355,-14358,-14354,-14355,-14352,-14355,-14350,-14351,-14350,-14348,-14348,-14344,-14341,
+-14340,-14337,-14333,-14331,-14324,-14319,-14315,-14306,-14302,-14293,-14286,-14278,-14269,-14261,-14250,-14240,
+-14228,-14217,-14205,-14194,-14178,-14171,-14152,-14144,-14125,-14114,-14095,-14083,-14064,-14051,-14033,-14018,
+-13998,-13985,-13964,-13948,-13928,-13909,-13891,-13872,-13853,-13837,-13814,-13798,-13773,-13757,-13732,-13714,
+-13689,-13672,-13646,-13626,-13602,-13578,-13554,-13529,-13506,-13483,-13458,-13432,-13407,-13380,-13356,-13327,
+-13300,-13275,-13245,-13219,-13190,-13160,-13133,-13102,-13072,-13044,-13012,-12982,-12950,-12919,-12886,-12859,
+-12820,-12793,-12754,-12724,-12688,-12655,-12617,-12587,-12546,-12514,-12476,-12440,-12405,-12365,-12330,-12289,
+-12254,-12213,-12177,-12135,-12099,-12055,-12018,-11975,-11936,-11896,-11853,-11813,-11768,-11727,-11684,-11638,
+-11600,-11550,-11512,-11463,-11422,-11375,-11332,-11284,-11240,-11189,-11148,-11095,-11054,-11000,-10955,-10906,
+-10858,-10809,-10759,-10709,-10658,-10606,-10556,-10505,-10453,-10403,-10347,-10297,-10240,-10189,-10131,-10079,
+-10022,-9967,-9913,-9853,-9801,-9738,-9686,-9622,-9567,-9505,-9448,-9386,-9325,-9264,-9203,-9141,
+-9080,-9014,-8950,-8887,-8818,-8757,-8689,-8623,-8556,-8490,-8420,-8355,-8280,-8215,-8141,-8073,
+-8000,-7928,-7854,-7782,-7709,-7633,-7560,-7484,-7408,-7333,-7256,-7179,-7103,-7022,-6946,-6865,
+-6787,-6705,-6627,-6545,-6464,-6384,-6299,-6220,-6136,-6051,-5968,-5882,-5799,-5715,-5628,-5545,
+-5456,-5372,-5285,-5198,-5113,-5021,-4938,-4846,-4760,-4671,-4580,-4493,-4402,-4314,-4221,-4137,
+-4040,-3957,-3860,-3772,-3681,-3587,-3498,-3405,-3312,-3224,-3128,-3039,-2943,-2853,-2757,-2668,
+-2571,-2481,-2384,-2295,-2196,-2107,-2010,-1917,-1823,-1729,-1635,-1541,-1447,-1352,-1259,-1165,
+-1070,-977,-879,-787,-689,-595,-500,-405,-312,-217,-123,-28,66,161,258,352,
+447,543,636,733,825,921,1017,1112,1207,1301,1397,1491,1588,1681,1777,1871,
+1967,2061,2158,2250,2348,2441,2536,2631,2726,2820,2917,3009,3107,3199,3297,3391,
+3486,3581,3676,3770,3866,3960,4055,4151,4244,4339,4433,4528,4626,4717,4817,4905,
+5006,5095,5195,5285,5383,5477,5573,5667,5763,5856,5951,6045,6140,6237,6328,6427,
+6518,6616,6710,6803,6899,6994,7088,7184,7276,7374,7466,7564,7657,7752,7847,7939,
+8037,8128,8225,8318,8413,8508,8603,8696,8791,8884,8980,9071,9169,9260,9357,9449,
+9544,9638,9730,9827,9915,10016,10104,10202,10295,10386,10482,10572,10668,10760,10854,10946,
+11040,11131,11224,11318,11407,11503,11592,11686,11777,11870,11962,12052,12145,12235,12326,12418,
+12505,12597,12686,12776,12866,12956,13046,13134,13224,13309,13402,13485,13576,13663,13747,13839,
+13919,14010,14091,14179,14259,14347,14429,14512,14596,14674,14761,14837,14922,14998,15082,15156,
+15239,15311,15391,15465,15543,15616,15693,15766,15838,15911,15982,16053,16124,16193,16262,16328,
+16398,16460,16529,16592,16656,16720,16782,16843,16905,16963,17023,17083,17140,17198,17255,17309,
+17362,17411,17456,17499,17538,17575,17611,17640,17670,17693,17716,17738,17752,17772,17779,17795,
+17799,17806,17808,17809,17806,17802,17796,17788,17778,17766,17751,17738,17718,17702,17679,17658,
+17634,17608,17584,17553,17524,17495,17460,17429,17393,17355,17320,17278,17238,17195,17148,17105,
+17054,17007,16955,16904,16850,16795,16737,16680,16618,16560,16494,16434,16368,16302,16234,16163,
+16095,16021,15949,15874,15798,15720,15645,15561,15480,15392,15308,15221,15131,15045,14950,14863,
+14767,14676,14580,14486,14391,14291,14199,14097,14000,13900,13799,13699,13598,13495,13394,13290,
+13188,13081,12981,12871,12772,12662,12560,12451,12348,12239,12135,12028,11921,11816,11706,11603,
+11492,11389,11278,11175,11066,10963,10855,10749,10643,10534,10432,10322,10222,10113,10012,9905,
+9799,9697,9591,9490,9387,9282,9181,9078,8978,8874,8774,8671,8571,8470,8370,8270,
+8171,8072,7973,7875,7776,7679,7581,7483,7386,7290,7192,7098,7001,6905,6810,6713,
+6620,6524,6432,6336,6242,6150,6054,5962,5869,5776,5683,5591,5498,5407,5313,5226,
+5129,5044,4946,4861,4764,4680,4584,4497,4405,4314,4226,4135,4045,3958,3866,3780,
+3689,3601,3512,3424,3335,3247,3161,3070,2986,2895,2810,2719,2632,2544,2461,2369,
+2289,2197,2117,2027,1947,1858,1775,1690,1604,1524,1435,1357,1269,1188,1106,1022,
+942,859,778,698,616,537,455,376,296,217,139,58,-18,-97,-175,-251,
+-330,-404,-481,-558,-631,-712,-780,-863,-929,-1010,-1077,-1155,-1226,-1299,-1374,-1443,
+-1517,-1587,-1660,-1727,-1801,-1869,-1939,-2012,-2077,-2150,-2215,-2286,-2351,-2420,-2487,-2553,
+-2622,-2685,-2755,-2818,-2886,-2950,-3015,-3079,-3145,-3207,-3273,-3335,-3398,-3460,-3523,-3584,
+-3647,-3708,-3769,-3831,-3892,-3952,-4012,-4071,-4132,-4187,-4251,-4304,-4367,-4421,-4482,-4537,
+-4595,-4651,-4707,-4765,-4818,-4875,-4929,-4984,-5039,-5091,-5146,-5197,-5250,-5304,-5355,-5408,
+-5461,-5508,-5565,-5606,-5664,-5706,-5760,-5807,-5854,-5907,-5949,-6000,-6043,-6091,-6135,-6181,
+-6226,-6269,-6316,-6355,-6402,-6441,-6484,-6527,-6565,-6608,-6647,-6686,-6727,-6763,-6803,-6838,
+-6877,-6912,-6949,-6985,-7019,-7054,-7087,-7120,-7153,-7186,-7216,-7250,-7279,-7309,-7340,-7368,
+-7397,-7425,-7452,-7481,-7507,-7533,-7560,-7584,-7609,-7635,-7656,-7680,-7702,-7725,-7746,-7769,
+-7789,-7811,-7828,-7852,-7866,-7890,-7901,-7925,-7937,-7959,-7972,-7992,-8003,-8023,-8032,-8052,
+-8060,-8078,-8088,-8102,-8113,-8128,-8136,-8151,-8159,-8171,-8179,-8192,-8197,-8211,-8215,-8227,
+-8232,-8241,-8246,-8255,-8260,-8267,-8271,-8279,-8281,-8290,-8290,-8298,-8299,-8304,-8307,-8309,
+-8315,-8313,-8318,-8318,-8320,-8324,-8322,-8327,-8324,-8328,-8325,-8328,-8324,-8327,-8323,-8324,
+-8323,-8319,-8322,-8316,-8317,-8313,-8311,-8310,-8305,-8306,-8299,-8299,-8294,-8291,-8287,-8282,
+-8279,-8273,-8272,-8265,-8262,-8257,-8252,-8247,-8244,-8236,-8233,-8225,-8221,-8216,-8208,-8205,
+-8196,-8191,-8184,-8176,-8168,-8162,-8150,-8145,-8135,-8125,-8117,-8105,-8097,-8084,-8065,-8044,
+-8024,-8001,-7981,-7957,-7938,-7914,-7891,-7871,-7845,-7826,-7800,-7779,-7753,-7731,-7707,-7682,
+-7660,-7633,-7612,-7587,-7560,-7539,-7510,-7491,-7461,-7440,-7410,-7389,-7361,-7337,-7311,-7286,
+-7257,-7234,-7204,-7180,-7152,-7126,-7100,-7073,-7046,-7017,-6992,-6964,-6935,-6911,-6880,-6854,
+-6826,-6797,-6770,-6742,-6711,-6685,-6654,-6628,-6597,-6571,-6539,-6512,-6482,-6453,-6424,-6393,
+-6365,-6334,-6305,-6276,-6242,-6218,-6182,-6156,-6123,-6093,-6062,-6033,-6001,-5972,-5940,-5909,
+-5879,-5846,-5818,-5782,-5758,-5719,-5696,-5658,-5630,-5597,-5565,-5534,-5501,-5472,-5438,-5409,
+-5376,-5342,-5312,-5277,-5247,-5213,-5182,-5150,-5117,-5085,-5052,-5019,-4987,-4953,-4921,-4889,
+-4854,-4824,-4789,-4755,-4725,-4687,-4658,-4621,-4589,-4555,-4522,-4486,-4455,-4420,-4385,-4354,
+-4316,-4284,-4249,-4213,-4181,-4144,-4111,-4075,-4039,-4005,-3969,-3936,-3899,-3863,-3829,-3791,
+-3759,-3720,-3685,-3649,-3612,-3578,-3540,-3505,-3469,-3431,-3397,-3356,-3323,-3285,-3246,-3214,
+-3172,-3140,-3099,-3064,-3024,-2989,-2949,-2914,-2876,-2839,-2801,-2764,-2725,-2689,-2651,-2613,
+-2575,-2537,-2499,-2462,-2424,-2384,-2349,-2308,-2274,-2234,-2197,-2160,-2120,-2088,-2043,-2013,
+-1968,-1937,-1895,-1860,-1820,-1786,-1745,-1712,-1672,-1636,-1600,-1561,-1526,-1488,-1452,-1416,
+-1377,-1344,-1304,-1271,-1234,-1197,-1162,-1125,-1090,-1054,-1021,-981,-950,-913,-876,-846,
+-805,-775,-738,-704,-672,-636,-603,-569,-534,-502,-467,-435,-401,-370,-335,-304,
+-270,-238,-205,-174,-142,-110,-80,-46,-18,15,44,78,107,138,168,199,
+229,262,290,322,351,383,412,444,471,505,531,564,591,623,652,680,
+711,739,770,799,829,857,887,916,944,973,1005,1029,1062,1087,1117,1146,
+1173,1202,1231,1257,1288,1313,1343,1370,1398,1426,1452,1482,1506,1537,1562,1590,
+1617,1645,1671,1700,1723,1753,1778,1806,1831,1859,1883,1912,1938,1964,1990,2016,
+2041,2069,2093,2121,2146,2170,2197,2221,2248,2273,2297,2323,2349,2371,2400,2421,
+2449,2471,2498,2519,2549,2568,2596,2620,2642,2668,2692,2712,2742,2760,2789,2807,
+2836,2855,2881,2903,2927,2949,2973,2995,3020,3039,3067,3083,3112,3128,3155,3172,
+3200,3216,3243,3263,3284,3308,3328,3349,3371,3391,3413,3434,3455,3476,3496,3517,
+3537,3558,3578,3598,3618,3638,3658,3678,3697,3716,3737,3754,3773,3794,3810,3830,
+3849,3865,3886,3902,3920,3939,3954,3975,3989,4008,4024,4040,4059,4073,4090,4105,
+4121,4136,4153,4166,4183,4197,4211,4227,4239,4255,4268,4280,4295,4307,4321,4332,
+4346,4357,4369,4382,4392,4403,4416,4424,4438,4446,4457,4467,4476,4486,4496,4503,
+4512,4516,4523,4527,4532,4535,4537,4538,4540,4541,4537,4541,4533,4535,4531,4525,
+4524,4515,4512,4503,4500,4488,4485,4472,4466,4455,4445,4437,4423,4416,4401,4392,
+4377,4367,4353,4341,4327,4314,4299,4286,4268,4258,4236,4226,4206,4191,4173,4157,
+4137,4122,4099,4086,4061,4047,4024,4005,3984,3964,3943,3921,3901,3878,3856,3834,
+3810,3790,3764,3743,3717,3694,3671,3644,3621,3598,3568,3548,3517,3496,3467,3443,
+3415,3391,3361,3338,3308,3282,3255,3227,3200,3173,3146,3116,3091,3060,3035,3005,
+2978,2950,2921,2895,2864,2839,2810,2780,2757,2722,2701,2668,2643,2614,2587,2558,
+2532,2501,2478,2446,2424,2391,2368,2339,2313,2285,2259,2232,2206,2179,2154,2126,
+2101,2076,2047,2026,1995,1973,1946,1921,1898,1870,1847,1822,1797,1773,1748,1723,
+1699,1676,1651,1628,1605,1579,1559,1533,1513,1487,1466,1442,1420,1397,1376,1351,
+1331,1307,1287,1264,1241,1222,1197,1179,1155,1136,1112,1095,1070,1051,1032,1007,
+991,967,948,928,906,888,865,848,826,807,786,766,748,725,711,685,
+671,648,632,610,595,573,555,537,517,500,481,462,445,426,409,391,
+373,357,336,323,302,288,269,252,236,218,203,185,171,152,140,118,
+108,87,77,57,44,27,12,-1,-18,-31,-46,-62,-74,-91,-103,-118,
+-132,-144,-160,-172,-186,-200,-213,-225,-239,-251,-264,-277,-289,-301,-314,-326,
+-338,-350,-361,-373,-386,-396,-407,-419,-430,-441,-453,-461,-475,-483,-495,-504,
+-516,-524,-538,-543,-558,-562,-577,-583,-593,-604,-611,-621,-630,-639,-649,-657,
+-664,-675,-681,-692,-699,-707,-715,-723,-731,-739,-747,-754,-761,-770,-774,-785,
+-789,-799,-803,-812,-817,-825,-831,-838,-843,-851,-856,-861,-869,-872,-879,-886,
+-888,-898,-899,-907,-911,-916,-921,-927,-929,-936,-939,-945,-947,-954,-953,-964,
+-959,-972,-967,-977,-977,-982,-986,-987,-992,-993,-997,-999,-1002,-1005,-1007,-1009,
+-1012,-1012,-1017,-1016,-1020,-1021,-1021,-1027,-1022,-1031,-1025,-1031,-1030,-1031,-1033,-1033,
+-1032,-1037,-1033,-1037,-1036,-1034,-1040,-1033,-1040,-1035,-1038,-1035,-1038,-1034,-1038,-1033,
+-1036,-1033,-1035,-1032,-1032,-1031,-1030,-1030,-1028,-1028,-1025,-1026,-1022,-1025,-1019,-1021,
+-1017,-1017,-1016,-1012,-1014,-1007,-1011,-1004,-1006,-1002,-1001,-998,-996,-994,-992,-990,
+-988,-986,-983,-980,-980,-974,-976,-970,-968,-967,-962,-963,-956,-957,-953,-949,
+-949,-944,-942,-940,-936,-934,-932,-926,-928,-918,-923,-913,-916,-908,-907,-905,
+-899,-900,-893,-892,-889,-884,-883,-879,-875,-873,-869,-867,-862,-860,-858,-851,
+-852,-845,-845,-839,-838,-834,-830,-828,-822,-822,-815,-814,-808,-807,-801,-800,
+-794,-793,-786,-786,-779,-778,-773,-769,-765,-761,-758,-754,-750,-746,-742,-738,
+-735,-731,-726,-723,-719,-715,-711,-708,-702,-701,-695,-690,-689,-682,-681,-675,
+-671,-669,-663,-661,-655,-652,-650,-642,-642,-634,-632,-628,-624,-620,-615,-613,
+-606,-606,-599,-597,-591,-589,-584,-579,-578,-571,-569,-565,-558,-558,-550,-550,
+-543,-541,-535,-534,-526,-528,-517,-519,-511,-509,-504,-502,-495,-495,-486,-487,
+-479,-480,-471,-472,-462,-465,-455,-456,-449,-446,-443,-437,-436,-429,-428,-423,
+-419,-416,-411,-408,-405,-399,-399,-391,-390,-385,-383,-377,-375,-371,-366,-365,
+-357,-358,-350,-352,-342,-344,-335,-336,-330,-327,-324,-320,-317,-313,-309,-306,
+-301,-301,-293,-294,-287,-286,-281,-277,-277,-268,-272,-260,-265,-254,-257,-250,
+-248,-245,-240,-239,-234,-231,-228,-224,-220,-218,-212,-210,-206,-203,-199,-197,
+-192,-190,-187,-182,-181,-174,-176,-166,-170,-160,-162,-155,-155,-150,-149,-143,
+-142,-138,-135,-134,-128,-128,-124,-121,-119,-115,-114,-109,-108,-104,-102,-99,
+-99,-91,-96,-85,-89,-83,-82,-80,-77,-73,-74,-68,-68,-66,-62,-63,
+-57,-58,-53,-53,-50,-48,-47,-43,-44,-39,-39,-36,-35,-32,-32,-28,
+-29,-25,-25,-23,-20,-20,-17,-18,-14,-15,-11,-11,-9,-10,-6,-6,
+-4,-4,-2,-2,0,1,2,1,5,3,8,5,8,8,9,10,
+12,11,14,13,14,16,16,16,19,16,21,19,21,21,22,24,
+22,25,25,25,28,26,28,28,29,29,30,31,32,32,33,33,
+33,36,33,37,36,36,38,36,39,37,41,38,40,42,40,42,
+41,43,42,45,41,46,42,46,45,45,48,45,47,47,46,48,
+48,48,49,49,48,50,51,49,51,50,51,53,50,54,49,56,
+49,55,52,55,53,55,52,57,52,58,51,59,51,60,52,59,
+53,57,55,57,55,57,56,56,58,55,58,57,57,57,58,57,
+57,59,55,60,55,59,57,58,57,59,57,57,59,55,61,54,
+60,56,58,57,58,58,57,58,57,57,57,58,54,60,54,59,
+56,56,56,57,56,57,56,56,56,55,56,55,56,55,54,56,
+52,57,52,57,51,57,51,55,53,52,55,50,55,52,52,53,
+51,53,50,53,49,52,51,49,52,48,50,50,48,50,48,49,
+48,48,47,48,46,48,46,46,46,46,45,47,43,46,43,46,
+42,45,42,43,43,42,41,43,39,44,37,42,37,41,37,40,
+37,37,39,34,39,34,37,35,36,34,35,34,34,33,34,31,
+33,32,31,31,30,31,31,29,29,28,30,28,27,29,26,28,
+27,24,29,22,27,24,25,25,22,25,20,26,19,24,21,21,
+23,18,23,17,23,17,20,18,19,18,18,17,17,18,15,18,
+15,16,15,16,14,16,13,15,14,14,14,13,13,13,13,11,
+13,11,12,11,11,10,12,10,10,10,9,11,9,9,9,8,
+10,7,9,7,8,9,6,8,8,6,8,7,5,8,4,9,
+4,8,4,6,6,5,6,5,5,6,4,5,5,5,4,5,
+3,6,2,7,0,6,2,4,3,4,2,4,3,3,3,2,
+3,2,4,1,3,2,3,2,3,1,4,0,4,0,3,1,
+2,2,0,4,-2,5,0,2,1,0,3,-1,4,-1,2,1,
+0,3,-1,3,0,2,0,1,0,1,0,0,3,-3,5,-4,
+5,-3,2,0,1,0,0,1,-2,3,-3,2,-2,
+0,
+// type
+249,-80,-301,99,393,354,7,-96,290,592,216,-285,-72,551,1091,1135,
+773,456,496,716,741,821,1060,1178,945,541,400,775,1205,882,520,2921,
+7914,-2259,-5478,2784,963,5383,-5592,-2511,-4831,3756,13208,-6271,-17412,7481,6026,3544,
+7903,-6952,-4297,5000,2038,-9437,-2761,2753,2449,313,-975,1912,30414,25099,-9766,-13231,
+-5995,-7557,-31132,-1685,5784,11611,5606,7479,-12269,-16651,1307,2812,-2097,2453,-9464,-13413,
+-16590,-2202,-540,-2773,7220,10624,3805,-20381,-27111,-2147,11887,-2757,-2166,-6800,-17157,-1603,
+15660,6067,-4772,3137,4184,5977,16838,6,-32392,-10059,19995,16356,-5844,-18042,-25399,-9572,
+15636,7227,2730,9795,7631,-4120,-4321,-6819,-12755,-7731,6530,15955,14067,198,-7118,1816,
+5911,9888,3701,-172,4319,11271,4805,6900,363,-11902,-5830,-710,3130,-1096,-2684,-8507,
+-9870,-5500,191,4132,9996,5565,466,-2228,-2820,410,-3025,-1887,-338,-1683,-537,5348,
+-752,786,3039,1852,3637,779,-6355,-7273,-3649,1146,1042,-1890,-4282,1061,7260,1074,
+-7402,-9573,-5420,6073,6994,262,-4714,-2408,-604,361,1707,2412,-2969,-7034,749,7007,
+-314,-5406,-5484,-1141,5352,5475,-851,-3771,-2580,5156,11450,7806,2411,-1781,-6153,-5667,
+552,1977,-1888,166,2916,4155,2615,-212,-1347,-1574,-1578,-1317,-1957,656,398,-1880,
+-2499,-4054,-5409,-3779,-515,3009,2980,-1532,195,6042,4056,619,300,-50,1009,762,
+62,395,1604,343,-3647,-1364,-1025,-1815,-2173,-2127,-2331,-2999,901,3608,3790,1388,
+2220,182,-3180,-2078,274,590,-1489,-439,492,-975,-1347,-1017,1760,4138,5452,7009,
+6117,1050,-1514,140,1222,4496,6551,4791,2827,3172,4228,4305,2459,-761,-418,-152,
+1306,3536,3494,2498,1661,2544,3258,3579,3077,1330,640,223,3213,6232,4857,1783,
+-11,587,3290,4495,2295,-245,935,1636,3042,3505,1622,502,330,-635,-913,-2840,
+-3155,-2122,-278,395,-100,-773,-2408,-3171,-2812,-2508,-1434,1239,1543,-638,-3153,-2696,
+-2183,-2203,-1414,-1675,-1608,-1467,-1873,-1009,-1218,-1665,593,989,-296,-731,339,920,
+681,252,-1291,-1552,-2729,-2988,-1690,-1116,-572,1406,2023,221,55,1458,1786,893,
+-197,-534,-997,-186,1939,1161,179,476,1492,1757,1071,766,758,2111,3156,3413,
+3076,2884,2958,1678,2068,4022,4628,4003,3854,3221,2313,1574,2278,2077,1287,1451,
+1861,1768,1472,565,-412,99,1659,2174,1821,1543,2311,3076,2375,1353,-156,-584,
+146,1293,2149,1481,598,1305,2540,1627,-79,-1300,-1958,-1452,509,943,19,-235,
+-628,-838,-417,103,-1069,-1420,107,717,-171,-240,185,1143,983,241,-842,-2081,
+-1328,-943,-1696,-2832,-3465,-2497,-733,-109,-1105,-1124,-574,-454,-1574,-856,-921,-2023,
+-627,1206,-436,-2138,-2026,-1524,-1683,-1196,-518,-538,-687,-441,224,-11,-255,-24,
+245,469,815,1044,68,-311,-230,73,432,277,360,545,948,1048,359,275,
+-392,504,464,-675,69,953,531,673,804,149,455,1520,2660,1762,685,950,
+2122,2620,1873,351,628,1745,2948,2724,1938,1647,2015,1831,1527,1122,108,-464,
+1017,1496,-1203,-3542,-2898,1719,248,-2147,-159,-2664,-1974,1733,260,-1350,382,-251,
+-379,-821,364,-2211,-2873,-516,-1716,-3890,-1642,-1636,-2108,-1231,124,-587,-3798,-2720,
+-1156,-165,-566,-865,-1417,-1283,-1277,-896,-2710,-4469,-3191,-816,-2406,-2954,-1121,-2330,
+-4425,-1427,-671,-4709,-2124,201,-2221,-1815,-444,-1529,-1608,408,301,-1592,-2296,162,
+21,469,1203,1001,341,538,2276,1275,636,1732,1106,70,1117,1463,49,638,
+740,1168,363,2371,2087,-770,1925,2115,644,118,1720,2075,-78,1137,1772,153,
+-702,1395,1274,-558,688,294,-217,764,683,-21,-1785,-402,-597,-1369,-197,-352,
+-499,-65,-877,-866,-474,-316,-1370,-2203,-849,-2014,-2490,-1170,-1943,-2652,-1666,-3287,
+-2908,-1249,-2272,-2449,-2250,-3370,-2800,-1906,-2030,-2904,-3116,-2551,-3141,-2367,-2614,-1919,
+-1618,-2390,-1994,-1335,-1147,-1174,-1314,-632,-1478,-1699,-1399,-1797,-1402,-2056,-1276,-314,
+-351,-14,1199,765,24,-30,619,1370,1717,1653,1665,1227,583,714,350,642,
+1308,996,308,497,708,1040,299,398,1529,928,379,879,928,1140,1637,1975,
+626,683,1625,1659,1549,929,-504,-417,-112,-112,-87,-286,-815,-652,-1080,-1239,
+-360,-468,-1425,-1150,106,-761,-1827,-1957,-1925,-2520,-2413,-1542,-956,-1094,-1337,-1528,
+-1642,-1096,-1377,-1812,-1552,-1987,-1885,-1985,-1578,-993,-1701,-1466,-1337,-1452,-1297,-642,
+-819,-1125,-666,45,-500,-613,-455,-561,-1030,-491,-639,-960,-818,-867,-602,-154,
+-521,-515,115,-25,296,203,497,1089,1402,572,1159,1546,970,1310,1717,1497,
+851,887,1474,1260,1402,1608,1048,934,1298,950,308,281,1268,1653,1056,1101,
+874,371,497,779,294,367,65,799,1889,3497,3689,2775,1640,-205,-1251,-1308,
+-1484,-2589,-4637,-5743,-4225,-2537,-2071,-1721,-1326,-1199,-1272,-945,-917,-1359,-1687,-1581,
+-1845,-2911,-2121,-2379,-2287,-1312,-215,919,-606,-1492,32,449,1348,6265,6309,1025,
+3802,4488,-7340,-3862,5022,-6197,-11332,-2345,-5011,-10217,836,7240,4979,-1575,2448,1341,
+-1109,1017,5959,2410,2673,4699,-1418,-7691,-4625,2681,-4641,634,2750,-6862,-9881,-675,
+-2122,1563,12298,-2357,-15929,-1699,5093,-1968,-2673,433,1312,624,2929,2614,-6070,-12656,
+-6539,11216,1089,-12726,-1775,-1119,-12621,-10094,-5870,-8126,-1074,-501,-401,-740,-3866,-4294,
+6363,4541,-6405,3879,7768,5032,-904,-5189,-6158,-3238,1223,3946,2710,-6362,-6625,-3944,
+-7788,-10691,3704,6165,138,3672,4436,-851,-1720,5027,2860,4242,7149,6819,7873,5299,
+-707,-3693,-8653,-7643,-3730,-1096,-1169,-1718,3819,8344,7492,6939,7703,5752,-581,2003,
+2115,-6239,-4361,-633,-758,-1468,4358,5160,353,1669,3405,-2902,-5327,3227,1670,-1046,
+1048,2262,-752,-1599,-953,-3903,-5612,2021,4809,2315,941,685,478,-2429,-3299,211,
+-1949,-4634,4345,5246,-776,-1780,-2152,-2519,-2294,-2496,-1162,2162,5238,-18,-1810,200,
+-579,297,-229,-2061,-1647,-7,323,-4084,-7712,-4269,-2040,271,4071,6282,5974,3197,
+2490,1327,2216,1196,-28,4673,3814,1266,2306,6063,4278,-1442,-1952,1241,4514,5164,
+3420,1211,303,1179,2153,2221,5325,5304,1876,1918,5894,6241,6750,6172,3351,783,
+635,-534,52,2019,3883,4691,5478,6481,2947,1240,744,-507,-147,1711,1244,1153,
+458,-176,-1666,4,2455,3202,2301,2240,2024,856,-829,-678,30,369,1665,1315,
+362,-508,-836,-1703,-2272,-2388,-2364,-1787,-1082,-650,889,666,-838,-845,-260,128,
+478,974,206,-822,-1296,-1117,-932,-2080,-2594,-307,759,-539,-1257,-913,-808,-928,
+340,867,1599,2652,2060,748,325,-1010,-393,1206,1643,1549,1401,2112,2141,974,
+1361,908,2020,3494,4616,4877,3380,1750,1431,1645,1899,1972,1577,1552,2286,3033,
+2371,955,143,179,1570,2985,2360,1208,313,430,1270,751,-348,1077,1607,1846,
+1301,504,740,-435,-2390,-2540,-891,419,1022,742,-317,-1817,-2250,-3222,-4140,-3932,
+-2602,-67,278,-1709,-2184,-2238,-2252,106,1119,-692,-916,179,1080,996,-1545,-5055,
+-5924,-4728,-3716,-2191,-1592,-3062,-3724,-881,-321,-1062,-1301,-2561,-2280,-2712,-3329,-2472,
+-3325,-3380,-842,49,1431,3883,3116,111,-2365,-1558,1077,1141,703,687,24,-725,
+-1014,-200,459,10,2403,4991,3123,2086,2459,818,-985,159,2150,3030,2271,2278,
+1229,460,1275,75,-366,1237,2738,5332,6196,3176,2501,3154,1628,149,1433,1658,
+1612,4922,6516,4376,3019,2614,645,-2400,-2836,-1413,501,1584,835,1500,3239,5612,
+4979,814,-1855,-1122,348,529,167,-759,-474,586,-255,-1685,-1411,-3445,-5081,-4179,
+-1767,-571,-1079,1121,2359,1980,2016,97,-1071,-693,-1574,-2985,-3392,-1994,-1224,-1409,
+-1307,-1902,-588,1103,1973,1880,75,-1851,-2959,-1900,-2183,-4150,-2849,-1242,-1004,1528,
+2766,11,-2034,-545,583,782,3025,4202,2619,562,-265,-687,-1279,-1810,-656,51,
+1060,2522,1733,1059,1662,2774,1445,461,1534,2018,1150,79,-216,730,1880,2334,
+3151,2820,3363,3450,1780,130,-164,148,-221,217,2594,3116,2299,2836,3249,3394,
+2624,1388,1089,1281,42,-1111,-457,761,510,53,404,-79,-1458,-1633,-1429,-2463,
+-1684,361,885,747,809,-784,-1791,-962,-1179,-2380,-1220,12,-389,-674,-993,-1273,
+-13,585,-36,-389,-1761,-3103,-2316,-1173,-877,-566,541,678,-488,-1400,-1968,-2860,
+-3166,-2925,-1901,-535,-1322,-1744,-1021,-907,-1320,-872,-704,-1254,298,1249,206,-1057,
+-1060,156,-470,-1527,-1520,-2140,-1916,-2002,-2037,-1254,-1927,-1659,-414,228,785,218,
+-393,-793,-749,-61,-343,-905,-630,530,75,-744,161,368,197,540,-195,-559,
+-351,69,-407,-1339,-170,568,533,223,-410,-802,-448,-491,-881,-612,-144,-571,
+-121,367,683,650,-44,-763,-1000,-1171,-1786,-1840,-979,-474,-373,547,140,-646,
+-623,-657,-1493,-2128,-2700,-2892,-2473,-2213,-1339,-692,-904,-1433,-1621,-1560,-1361,-1576,
+-1582,-1578,-1155,-748,-1461,-2064,-2207,-2105,-859,-637,-1221,-1108,-1036,-1520,-2322,-2236,
+-1461,-1257,-1386,-1566,-1552,-1388,-1356,-737,-622,-684,-625,-592,-957,-880,-537,-821,
+-1017,-610,-729,-1129,-855,-439,-15,-307,451,832,11,-305,413,434,-3,193,
+436,545,683,226,594,1117,505,409,879,1340,1214,1042,1264,1676,1514,1307,
+1244,1279,1124,761,443,400,215,-303,-563,-426,27,454,208,-70,127,220,
+242,186,281,31,-223,74,117,-134,-309,122,387,276,-102,-718,-845,-888,
+-1325,-1498,-1304,-1438,-1391,-926,-510,-434,-716,-977,-1214,-1133,-718,-880,-871,-462,
+-424,-842,-996,-1152,-1307,-1057,-659,-548,-395,-426,-553,-437,-298,-229,-86,225,
+558,430,130,324,300,409,675,953,1047,959,896,823,990,823,560,1079,
+1396,1023,934,975,843,613,992,1182,1506,1931,1768,1390,1488,971,747,902,
+848,1301,1016,606,857,894,1127,1630,1442,874,693,718,533,582,263,37,
+134,238,158,88,420,506,122,-488,-610,-219,-383,-1125,-970,-568,-543,-964,
+-1566,-1877,-2129,-1882,-1730,-1851,-1452,-922,-929,-1235,-1380,-1529,-1782,-1517,-876,-580,
+-596,-521,-706,-782,-552,-676,-855,-979,-1625,-1900,-1448,-1298,-1719,-1772,-1014,-340,
+-729,-1122,-970,-887,-878,-911,-622,-163,259,419,196,-84,-280,-73,279,264,
+71,150,340,713,837,639,781,773,372,130,197,435,287,-52,114,460,
+970,964,534,732,737,447,541,362,249,475,686,799,644,363,-15,-196,
+-504,-395,-105,-261,-109,219,-74,-440,-345,47,-85,-265,-261,-560,-627,-595,
+-447,-495,-504,-675,-886,-1150,-1345,-1183,-946,-930,-887,-730,-929,-858,-932,-1223,
+-1012,-363,-99,-75,-177,-819,-1055,-778,-511,-438,-759,-1178,-1452,-1290,-1310,-1684,
+-1211,-682,-407,-396,-835,-1108,-1161,-1161,-888,-514,3,213,513,777,358,-241,
+-645,-694,-413,72,518,795,604,373,339,712,890,663,495,303,48,217,
+400,219,608,1028,946,991,737,353,340,473,273,474,1187,1339,1337,1446,
+1106,452,547,519,254,697,776,297,506,579,445,309,375,674,433,227,
+401,684,792,469,547,911,382,208,425,328,197,51,-142,-66,27,-248,
+-440,-99,78,208,-117,-552,-408,-346,-528,-392,101,176,42,217,38,-300,
+-250,-310,68,480,261,35,229,416,426,402,363,219,-2,-7,-41,-208,
+127,611,693,805,856,529,257,253,303,548,829,988,990,686,561,629,
+951,1195,959,956,882,732,800,744,624,787,755,713,699,512,550,477,
+463,501,479,294,297,450,455,37,-93,-144,-129,71,-163,-474,-99,305,
+200,190,213,253,292,84,-113,-146,-536,-648,-673,-836,-948,-1015,-986,-845,
+-912,-942,-544,-486,-531,-531,-648,-717,-516,-117,-218,-611,-602,-191,175,66,
+-348,-463,-482,-537,-382,-304,-592,-596,-574,-545,-168,-203,-361,-266,-329,-332,
+-343,-387,-420,-402,-195,-19,177,320,212,-119,-208,-38,-95,-43,459,672,
+424,239,436,659,506,211,314,462,384,227,394,527,383,308,347,291,
+9,53,313,445,447,352,413,575,445,320,129,43,102,-41,-22,76,
+77,86,61,224,364,19,-64,185,152,-47,-202,-368,-198,179,417,735,
+722,360,99,-16,-43,-8,94,107,102,330,104,-54,387,586,384,9,
+-8,235,309,269,143,253,314,397,561,540,250,102,407,646,601,524,
+718,966,952,913,705,530,563,747,759,904,1117,1113,1007,1061,934,758,
+546,430,579,804,587,227,301,639,681,434,369,295,412,642,515,152,
+104,385,761,794,393,214,412,228,99,168,170,229,339,443,473,371,
+227,32,109,459,574,257,-79,103,362,278,-39,-173,-184,-224,-198,-69,
+-114,-65,321,502,480,460,376,-7,-24,194,158,94,28,114,247,294,
+470,446,137,8,183,221,218,416,365,326,371,368,425,638,555,269,
+248,351,456,570,773,706,487,531,527,444,475,463,473,494,424,485,
+460,248,183,112,248,386,524,530,302,395,862,1000,874,742,535,476,
+402,296,498,554,437,573,638,611,495,312,186,14,-35,-64,-108,-152,
+-249,-73,192,249,242,147,-20,-50,68,199,402,581,579,525,427,329,
+253,183,-211,-343,-75,102,214,222,270,105,87,144,188,229,289,208,
+188,416,650,693,596,654,713,484,263,185,44,57,101,86,146,265,
+224,177,240,247,130,-17,86,122,144,345,549,628,581,608,593,270,
+22,59,256,512,602,640,581,322,215,278,210,160,198,381,611,710,
+476,249,394,514,441,46,-341,-61,112,48,140,426,512,441,434,409,
+-37,-248,0,276,326,274,154,-7,-40,-54,-68,-112,-25,196,226,-39,
+-183,-45,-71,-183,-283,-222,-79,-245,-448,-346,-291,-275,-122,-20,33,71,
+-24,-245,-495,-527,-482,-498,-308,18,-19,-306,-458,-512,-632,-595,-490,-391,
+-235,-161,-96,-39,-133,-241,-228,-324,-422,-426,-272,-69,34,21,43,84,
+145,79,-193,-393,-240,-2,40,-166,-157,-4,-57,-98,-146,-220,-241,-180,
+22,-21,-166,-233,2,201,77,-64,-53,-86,-117,-31,21,152,150,207,
+410,269,-131,-333,-228,-33,153,-26,-302,-259,2,118,-11,-161,-245,-293,
+-338,-477,-548,-421,-329,-300,-317,-467,-675,-613,-502,-634,-724,-699,-600,-446,
+-334,-347,-517,-688,-674,-550,-534,-605,-408,-319,-390,-555,-759,-729,-652,-685,
+-607,-669,-740,-599,-574,-544,-392,-254,-213,-228,-261,-293,-377,-433,-370,-266,
+-205,-39,42,-53,-130,-164,-158,-114,-228,-158,-77,-53,-79,-29,81,111,
+201,352,388,358,389,159,101,408,417,394,567,664,547,476,407,361,
+369,314,345,472,538,526,357,167,209,193,189,261,456,534,401,176,
+274,469,370,97,75,144,224,309,164,34,43,40,133,335,161,-146,
+-217,-105,-150,-334,-418,-334,-180,-300,-567,-529,-455,-482,-576,-628,-671,-500,
+-366,-386,-490,-533,-558,-497,-509,-573,-533,-379,-349,-431,-402,-376,-246,-171,
+-198,-199,-102,-31,-20,-8,102,137,230,168,144,132,8,-18,112,183,
+325,359,210,-14,-98,4,-66,-150,-112,-40,-16,-33,-199,-228,24,261,
+245,113,48,21,18,-22,-56,-27,116,269,225,92,-34,-161,-85,76,
+1,-158,-171,-66,-126,-435,-653,-675,-671,-621,-618,-466,-389,-423,-455,-535,
+-691,-797,-729,-565,-440,-544,-714,-785,-677,-664,-780,-737,-613,-541,-616,-762,
+-756,-759,-880,-844,-825,-866,-696,-568,-630,-702,-830,-833,-750,-616,-518,-584,
+-588,-552,-622,-737,-955,-820,-652,-702,-606,-276,-144,-454,-519,-63,146,114,
+120,38,-19,40,33,-5,35,332,448,158,149,366,396,74,35,343,
+467,267,290,132,126,136,118,-147,182,573,569,422,-143,-419,-578,-988,
+-845,94,409,296,-52,-465,-1006,-989,-444,-240,-2,-57,-167,-499,-627,-695,
+-688,-326,-56,-311,-763,-537,-308,-157,-189,20,35,63,-207,-576,-636,-544,
+-398,-403,-227,-72,-231,-620,-891,-826,-414,-101,-186,-372,-266,5,-237,-282,
+175,169,93,580,708,285,448,828,738,517,648,317,-282,-309,-217,-260,
+197,583,636,594,159,-393,-417,35,333,659,716,641,695,693,142,-141,
+-94,-273,21,478,435,198,385,187,-42,80,170,19,-51,-135,-339,-194,
+173,336,349,471,376,203,55,8,-26,-205,-394,-403,-296,-234,-205,-274,
+-55,103,-106,-363,-344,-185,-253,-248,-203,-182,-194,-149,-309,-462,-434,-394,
+-359,-407,-358,-320,-313,-380,-217,-21,1,-91,-262,-285,-13,314,429,432,
+250,73,131,165,51,-108,-78,100,201,108,136,166,79,-212,-157,117,
+200,111,-25,-62,65,173,360,571,518,420,322,305,293,204,151,154,
+270,353,261,195,174,133,38,-94,-235,-325,-296,-68,190,199,41,-168,
+-198,-61,114,193,191,193,213,34,-190,-113,53,187,216,0,-194,-221,
+-233,-262,-323,-308,-234,-174,-191,-344,-464,-363,-228,-109,-74,-208,-201,-51,
+-57,-37,-30,-35,-74,21,-39,-50,-20,-109,-170,-132,-70,-152,-209,-171,
+-217,-229,-229,-311,-403,-340,-207,-128,-276,-326,-118,32,-85,-129,-10,38,
+36,54,61,72,-131,-296,-391,-336,-135,-119,-228,-186,-11,15,-185,-452,
+-477,-388,-293,-259,-237,-20,106,38,-54,-53,20,26,-148,-198,-93,16,
+-7,-81,-44,62,118,59,30,39,25,50,-5,-72,-84,-33,63,71,
+13,-49,1,137,175,122,140,187,274,329,370,281,248,411,387,395,
+412,319,271,267,284,266,231,277,201,110,185,277,328,225,123,278,
+453,327,-10,-95,-5,77,119,133,288,398,343,203,70,98,258,290,
+274,259,337,358,346,273,180,275,352,301,352,492,428,423,404,253,
+168,206,227,239,215,243,342,356,344,352,349,360,372,367,376,389,
+495,484,358,302,352,327,339,374,341,402,438,365,347,346,278,319,
+348,320,290,300,309,220,147,126,196,173,77,115,152,41,-59,-30,
+-119,-159,-119,-118,-68,-49,-120,-245,-177,-145,-238,-376,-406,-312,-237,-106,
+-73,-280,-353,-260,-260,-363,-309,-303,-205,-155,-259,-326,-415,-421,-287,-287,
+-322,-247,-241,-236,-271,-353,-293,-342,-336,-299,-239,-190,-163,-139,-222,-290,
+-307,-188,-79,41,78,84,84,74,45,15,-60,-120,-87,18,108,126,
+139,78,69,141,99,68,31,39,89,104,161,144,50,-18,-67,-46,
+-63,-53,-133,-218,-234,-193,-246,-264,-206,-132,-157,-295,-376,-378,-367,-375,
+-317,-270,-281,-280,-236,-264,-306,-290,-300,-301,-384,-440,-545,-523,-391,-295,
+-266,-266,-285,-437,-545,-620,-559,-451,-307,-258,-210,-215,-329,-283,-182,-187,
+-137,-80,-108,-194,-210,-160,-38,-36,-72,-42,-13,-52,-157,-172,-141,-17,
+66,171,168,175,227,204,187,181,243,288,427,452,413,374,326,373,
+475,474,368,290,324,384,383,362,318,255,313,380,343,350,413,444,
+441,469,419,293,237,295,430,447,308,220,274,308,222,143,80,117,
+171,126,92,86,85,41,71,138,112,124,138,96,36,65,72,113,
+73,29,106,179,159,219,223,114,51,106,240,277,278,302,326,317,
+290,236,225,400,476,507,523,550,637,622,554,491,597,711,704,649,
+658,721,705,633,629,682,666,642,578,443,378,363,366,488,610,627,
+590,518,334,280,290,337,348,330,351,398,344,245,217,261,262,206,
+75,93,207,311,315,289,207,125,69,-20,-113,-167,-180,-142,-97,-119,
+-152,-204,-201,-166,-272,-313,-264,-265,-212,-212,-254,-311,-411,-413,-354,-350,
+-349,-351,-368,-320,-224,-201,-282,-262,-186,-141,-190,-228,-234,-179,-161,-123,
+-42,16,61,148,168,38,-54,-143,-167,-58,23,-11,-17,65,137,103,
+20,-15,-75,9,118,154,150,115,100,70,91,96,100,124,170,97,
+40,50,74,24,-60,-71,-66,-67,-104,-147,-196,-157,-61,-60,-105,-148,
+-214,-222,-237,-284,-274,-302,-308,-279,-330,-426,-517,-507,-516,-470,-426,-480,
+-430,-388,-370,-316,-306,-361,-349,-280,-278,-302,-311,-258,-226,-222,-185,-176,
+-174,-143,-98,-104,-156,-167,-221,-300,-219,-195,-150,-109,-189,-280,-267,-198,
+-102,-63,-51,40,-18,-36,-3,-21,-53,58,117,119,72,78,111,123,
+178,184,188,192,201,259,252,252,233,216,213,277,310,277,223,163,
+217,182,169,228,242,152,138,148,195,192,179,114,99,81,44,5,
+100,171,184,136,36,-92,-47,48,116,89,85,125,160,190,175,84,
+-15,-36,-14,-18,-47,-46,-117,-140,-67,-28,-59,-131,-100,-63,-17,8,
+-45,-55,-33,-63,-18,76,14,4,6,-4,-34,21,66,74,121,133,
+82,50,59,111,185,244,176,26,37,116,129,75,49,-1,61,110,
+-19,-63,-10,30,-31,-77,-120,-178,-177,-152,-161,-247,-260,-215,-137,40,
+74,23,6,9,-46,-137,-81,11,95,54,-55,-13,18,-60,-175,-534,
+-1117,-1403,-896,262,1312,1798,1319,401,-201,-428,-820,-1166,-1019,-220,743,1003,
+763,676,624,422,196,-9,-228,-312,-282,-317,-216,8,117,229,651,880,
+434,-407,-901,-826,-312,-5,-61,-146,-158,-272,-356,-517,-676,-572,102,994,
+1408,1107,148,-629,-808,-655,-617,-730,-673,-305,146,572,822,712,314,-117,
+-504,-689,-558,-363,-175,15,-9,-110,-79,7,57,-23,-178,-267,-274,-163,
+-72,-146,-314,-360,-327,-201,-78,-28,-56,18,114,276,398,227,-74,-104,
+66,37,-206,-441,-432,-263,-1,274,390,258,18,-56,-68,-89,-130,-119,
+-84,-126,-207,-120,15,61,-35,-139,-254,-236,-257,-354,-362,-234,-81,37,
+-62,-327,-509,-553,-494,-325,-135,-81,-111,-188,-296,-337,-200,-33,-83,-190,
+-223,-173,-107,-66,-163,-290,-377,-354,-288,-291,-287,-350,-310,-185,90,512,
+534,268,-26,-105,-102,-116,-254,-358,-351,-234,-46,165,341,388,466,464,
+195,87,-117,-286,-104,69,-321,-443,-178,242,924,881,-183,-317,478,164,
+-461,-284,-474,-682,-248,376,-96,-2,294,-93,-525,200,515,-365,-494,364,
+920,233,-943,-872,-99,411,338,-416,-667,4,240,49,-194,-333,35,-719,
+-937,-260,-108,-612,-599,-412,-803,-392,225,-426,-487,736,-163,-925,25,326,
+-232,-72,129,-379,-258,-305,-716,-450,80,-101,-196,414,344,-181,-197,275,
+221,-220,-314,179,-145,-713,183,220,-330,-148,551,535,289,212,462,751,
+168,74,316,100,-227,35,-23,-580,170,913,469,97,195,126,-5,299,
+388,-2,-267,-374,-335,-74,254,260,-238,-297,-185,-162,-75,-329,-247,45,
+164,85,180,6,-414,-474,-172,-178,-399,-86,54,-280,-585,-472,-87,-102,
+-71,2,-275,-543,-332,-324,-216,32,-78,-44,-24,72,156,4,-407,-337,
+121,184,52,139,-92,-382,-108,250,354,311,30,-164,-40,366,376,-25,
+-120,399,508,143,146,396,325,142,437,696,364,67,303,371,272,277,
+181,102,409,536,207,31,228,523,431,155,95,257,360,338,283,54,
+25,277,247,35,15,6,-79,48,237,91,-236,-290,-84,29,20,51,
+154,25,-67,21,4,-67,-78,-199,-280,-59,140,-43,-180,-127,-238,-234,
+-128,-76,-116,-102,-23,-92,-94,74,67,-163,-95,-32,-147,-183,-158,-116,
+-10,97,13,-115,-123,98,73,31,313,421,145,95,219,136,24,126,
+208,147,224,360,212,116,239,225,83,216,352,205,-16,43,279,354,
+336,291,123,84,240,188,-109,-151,95,112,111,74,-100,-221,-154,67,
+197,132,203,180,42,90,87,-147,-196,58,129,47,-122,-268,-191,66,
+-38,-171,-59,-40,-100,-166,-146,-159,-289,-239,-23,47,67,3,-39,60,
+97,88,-52,-149,-147,-136,-116,-23,42,49,29,45,82,35,-56,-27,
+83,151,224,205,185,128,189,178,211,190,139,105,80,110,133,191,
+220,287,236,72,-3,23,15,-6,59,141,131,131,190,129,-50,-47,
+51,48,62,-3,-129,-111,-28,50,49,31,-36,-38,-20,-64,4,162,
+181,177,123,59,53,102,107,-15,-122,-73,-13,-36,47,17,-44,-31,
+-52,-85,-59,41,132,91,104,215,244,249,182,186,206,185,239,242,
+214,238,332,375,440,390,375,474,429,326,298,340,338,298,281,406,
+499,390,321,343,361,345,360,367,351,325,281,206,181,138,97,73,
+-76,-21,-68,-93,66,468,537,61,-274,-312,237,639,52,-658,-329,32,
+-170,-55,-63,-67,-24,359,69,-381,-41,-236,-976,-740,169,-313,-971,-464,
+736,1019,-466,-1047,-117,501,548,-45,-921,-731,211,424,351,-158,-8,-201,
+-828,-36,595,269,-266,-134,-440,-510,280,283,-280,867,1092,-128,87,800,
+732,71,103,-191,-112,106,90,-101,68,438,368,596,574,-42,-452,292,
+931,473,50,337,710,-127,-259,295,198,82,102,198,181,400,172,443,
+290,-36,219,-140,-702,-575,-362,-710,-707,147,477,119,-488,-63,182,-375,
+-509,-470,-637,-585,-555,-510,-410,15,-257,-821,-564,-574,-500,-521,-547,-229,
+-174,-340,-377,-151,-286,-484,-518,-275,-397,-615,-344,-229,-511,-676,-321,-121,
+-213,-221,-397,-282,-217,-333,-368,-193,-104,-121,-242,-76,244,108,-184,-345,
+-153,1,-177,-144,-97,-271,-142,339,515,397,131,-239,-177,163,434,433,
+95,225,768,643,-26,-107,-53,-238,-270,100,363,227,354,611,506,97,
+-533,-961,-851,-490,-37,475,535,176,-37,-175,-433,-211,201,110,-123,371,
+682,488,684,877,439,47,134,232,242,62,-455,-1053,-991,-695,-516,-332,
+-152,-131,-177,21,222,541,495,57,-131,63,260,116,11,11,-38,144,
+279,68,22,170,125,49,39,22,-61,-239,-250,-15,171,-23,-354,-191,
+199,440,442,322,280,405,471,393,398,437,271,52,75,244,397,434,
+446,412,354,328,127,23,107,100,225,413,560,652,514,169,54,139,
+216,198,-42,-83,83,174,163,103,110,205,253,150,2,-31,-162,-182,
+-52,133,211,236,283,167,-39,-253,-378,-360,-222,-131,-51,-19,-40,13,
+99,-89,-148,-239,-313,-256,-396,-238,79,586,432,5,-24,138,802,958,
+-382,-591,173,-21,-470,64,-205,-862,279,1018,-216,-679,891,299,-1141,-160,
+571,-414,-1305,71,1889,1283,-490,-232,573,716,707,56,-727,-129,382,661,
+710,249,-211,-595,-338,149,-106,-585,-858,-774,-971,-270,457,205,-256,726,
+680,-33,43,442,156,-1,188,190,94,-540,-1018,-848,-469,-843,-768,138,
+206,-515,-633,-37,-43,-499,-753,-72,-74,-834,118,491,107,-229,-199,-222,
+-498,-849,-547,-345,-461,-323,69,-304,-709,-322,200,-452,-262,1008,606,-329,
+-129,259,-168,-42,878,634,-289,-245,188,136,197,202,-158,-43,239,162,
+77,-123,187,691,761,601,1062,680,-341,-458,-316,-489,-658,-376,-178,588,
+1096,294,368,879,135,-61,98,-86,-835,-1291,-413,271,245,297,288,236,
+303,337,-429,-1395,-753,354,222,238,105,-366,-753,294,342,-499,-1050,-1090,
+-709,-181,340,-53,-150,687,704,-582,-703,-350,-776,-773,174,267,-470,-379,
+441,544,-138,48,-296,-248,-28,-372,-523,-644,-24,496,78,-361,-131,409,
+218,-107,-42,-61,297,651,1106,1105,503,157,2,342,816,339,-372,-289,
+119,257,98,-203,-19,177,106,38,269,313,304,287,-150,-224,88,78,
+152,463,332,-82,-53,24,-27,178,238,-77,-320,252,220,-891,-853,-418,
+27,617,378,120,-38,-181,-88,-159,-271,-59,-249,-223,230,299,-287,-421,
+-108,-201,18,351,436,85,127,48,-106,-272,81,459,237,-142,-883,-473,
+93,-257,-254,151,375,191,-248,-1068,-761,265,-143,-1033,-694,-447,-24,-67,
+-414,-90,800,2067,954,-1181,-1046,-414,-709,-1138,-108,35,-949,-1605,-803,55,
+-60,-54,150,576,1013,826,-487,-641,607,123,-97,255,978,1553,-114,196,
+1300,417,-1094,-1238,-569,-838,53,-36,-1667,34,1144,-113,-820,1123,2257,898,
+516,-61,-1086,-607,251,-583,-970,246,417,147,641,643,-587,-271,394,389,
+-181,-494,40,-448,-448,204,458,991,1198,748,-509,-736,-1311,-663,-84,-1291,
+-1364,-1374,-1711,-1013,-545,-1270,-1313,-632,-693,-571,-651,113,393,-783,-964,-428,
+290,-213,-756,-541,-653,-917,-107,101,-453,-734,-786,-1036,-623,456,1186,2812,
+2200,1135,-53,-2731,-2655,-2268,923,2436,1324,1307,297,-2237,-3821,-2532,381,1891,
+2816,2786,333,-2850,-1623,1961,3242,2905,1986,-220,-3277,-2560,859,2623,1726,135,
+-619,1088,713,-842,-335,1579,1138,119,1190,2194,749,-2594,-2743,-2271,-429,1173,
+2168,2937,243,-2887,-2471,-660,-73,-497,902,1654,-1334,-3139,-1071,955,1055,757,
+756,-400,-3124,-1823,889,1581,-487,-2048,-812,726,-47,-925,-1463,-1017,232,1027,
+862,-67,-1325,-2528,-1866,-183,647,890,1166,814,789,1324,1527,436,-1003,-1469,
+-900,-101,-879,-1423,-189,913,1595,1736,1932,1575,24,410,768,-89,729,1313,
+1410,1304,816,-336,-1478,-789,820,958,522,329,-292,272,206,-419,311,1812,
+1707,329,618,225,-960,-1168,296,1582,1171,1867,2656,1377,497,-50,-412,-528,
+-754,-864,-1046,-531,-972,-622,1179,1761,1382,1183,904,344,-612,-1658,-1429,-171,
+189,56,523,1007,1105,800,644,248,-274,-908,-1018,-1030,-913,-543,-268,252,
+1627,2541,1687,644,874,1128,20,-810,-593,-693,-791,-181,287,801,1352,1245,
+439,-386,-844,-1260,-1272,-740,-760,-585,538,1004,184,50,-41,-604,-644,-630,
+-411,275,141,-1030,-961,-321,-914,-1226,-146,53,-789,-1156,-881,-914,-704,70,
+312,490,700,523,227,130,-255,-232,40,486,663,763,600,-372,-926,-734,
+-714,-203,564,713,597,802,828,658,1004,1034,1054,1694,1707,728,535,714,
+582,414,601,886,1176,1108,800,729,237,-626,-992,-565,22,591,848,785,
+493,310,308,453,213,-19,389,968,890,558,228,-69,-50,-207,-276,-515,
+-865,-1467,-1498,-1007,-747,-481,-230,-276,-301,-175,-380,-803,-1033,-955,-1050,-813,
+-550,-619,-566,-601,-804,-1166,-1604,-1841,-2190,-2091,-1844,-1895,-1621,-968,-518,-278,
+-110,-127,-255,-487,-550,-428,-234,-332,-244,245,554,415,525,656,654,242,
+-591,-753,-249,142,238,579,879,1044,1248,1816,1787,1472,1003,431,427,606,
+647,471,674,857,770,969,1178,1062,915,724,742,668,698,795,763,1200,
+1117,926,1336,1020,1006,1081,828,805,683,738,737,767,468,-12,548,958,
+345,219,68,-696,-484,-84,7,74,-196,-296,-551,-408,-268,-560,-587,-426,
+-365,-464,-289,-414,-541,-684,-1050,-1017,-925,-940,-1047,-1041,-1052,-936,-794,-793,
+-429,-22,210,-162,-389,-288,-432,-345,22,462,-153,-533,-364,-29,122,-31,
+-262,-359,-7,155,208,437,375,257,1,197,523,346,260,66,-154,-263,
+-331,142,403,307,212,240,104,113,108,141,79,20,371,557,532,358,
+103,98,59,-110,-453,-675,-612,-328,-90,-35,-20,-68,-22,-39,-210,-78,
+37,66,224,10,-112,66,144,366,503,239,147,318,182,-185,-220,-36,
+-75,-170,113,698,975,894,659,524,615,582,392,289,299,331,430,721,
+908,931,734,624,840,1031,659,385,518,719,936,926,819,602,636,586,
+343,342,255,196,329,566,680,493,348,486,498,364,268,-28,-306,-336,
+-376,-469,-649,-812,-744,-300,-118,-438,-745,-798,-745,-771,-868,-941,-853,-713,
+-738,-902,-975,-1020,-1110,-1129,-856,-747,-991,-925,-618,-667,-704,-689,-666,-597,
+-494,-590,-763,-583,-491,-279,-177,15,134,212,466,349,98,-25,118,515,
+554,365,279,545,810,655,561,819,1015,939,769,710,787,826,893,909,
+940,1032,1109,1005,1012,1081,998,702,715,1177,1822,1894,1872,2181,1205,-215,
+588,3695,2372,601,2824,1489,48,2412,2636,-746,-1405,3,653,-1364,-749,-31,
+-23,-172,-510,-1494,-1608,-1334,-2268,-4246,-4654,-5353,-608,-201,-765,-2421,-3654,-1622,
+-129,643,-107,-1280,-3188,1677,1376,-3479,-3070,1504,-2057,103,4205,-473,-4622,-3861,
+-449,-2015,-3103,-3947,-3249,1614,6805,6241,-473,2025,5407,3215,633,192,181,-1560,
+696,3394,-839,-1368,3568,2846,1493,2358,2142,-446,-336,1521,-2820,3528,7939,-1012,
+-3075,1888,-257,-85,1947,739,-3057,-2795,2774,3423,3000,2474,-1555,-1975,53,1214,
+-748,-1333,-2561,-4011,-3608,-2199,1052,2886,924,-2059,-2262,-1638,-1435,-701,-3414,-5854,
+-1723,1916,1233,1748,-232,-5298,-6797,-5071,-5284,-2410,1980,447,-3111,637,4053,174,
+1994,3030,-4250,-3588,2834,4490,776,-1786,-2793,-2,617,3052,3146,179,718,-671,
+-1016,2303,4370,1881,-1130,1218,2510,2249,1917,-539,33,1312,771,829,2851,4544,
+2697,910,1179,-856,1520,5071,1561,-462,1615,-10,-1078,840,508,-1801,-3527,-1336,
+-196,593,435,-3543,-4072,-650,1324,791,-656,-1180,-1834,-4608,-3672,-2884,-3304,-3028,
+-2501,-178,46,-1986,-1478,-1494,-4034,-5110,-2961,-2276,-3159,-1526,-2677,-5175,-3857,-2533,
+-1548,699,908,-1077,-2418,-2369,-2556,-1673,665,-1196,-3740,-560,-538,-2490,199,2534,
+1472,1250,1413,1137,1292,1622,1850,2337,2266,2271,1902,1967,1627,2094,2395,1805,
+2258,1539,1215,1950,4249,3534,2492,3664,4056,3049,4171,4455,2637,4278,5368,2987,
+3059,3587,-657,-97,3762,-101,-2448,2230,2222,1618,1673,-631,708,2167,1483,1463,
+1562,1191,994,-1048,-524,-73,-2932,-2544,-358,-2190,-3531,-1987,-2321,-3311,-3006,-3045,
+-2677,-2910,-4290,-3432,-2570,-4124,-4184,-2540,-3353,-4119,-3759,-3311,-3666,-3522,-3206,-2631,
+-1773,-3077,-4264,-4483,-4269,-3979,-3701,-2140,-1232,-887,-312,212,-485,-663,411,193,
+104,416,-38,880,3530,2271,-189,1094,1917,2739,3004,1667,1942,2722,2856,4584,
+3488,2900,3477,2090,2267,3710,3637,4068,3525,3247,4119,3389,3372,4616,4464,4305,
+3625,2616,2366,1706,1379,1715,1524,788,667,1002,1086,442,149,779,1340,588,
+287,-477,-1461,-2025,-1556,-2336,-4289,-1416,-836,-2304,-2152,-4110,-3401,-2089,-3317,-2306,
+-2624,-5510,-3414,-1365,-5065,-3136,-1771,-5554,-3096,-492,-1719,-3412,-4525,-2986,-2524,-4192,
+-1742,-994,-4068,-384,868,-5249,-1898,1188,-2310,289,199,-4054,-1094,-1084,-2490,162,
+-276,-1000,1242,-144,-938,278,-298,-108,1506,1925,3177,2541,516,2916,1791,-437,
+2826,2378,655,3085,2959,1184,2485,1639,388,2312,1783,838,1413,1336,1595,1798,
+1444,2093,1885,918,1415,1816,1166,639,-405,-126,1237,69,5,1321,-84,-743,
+739,629,-276,452,334,-825,18,678,-517,-850,-500,-1276,-2518,-1813,-612,-59,
+-230,-1327,-1244,-2127,-2563,-2077,-1119,1288,-375,-1938,-1597,-1513,-1278,-573,-142,263,
+1604,-823,-1987,-1882,-1172,-205,-396,-677,-1196,-1904,-868,-1740,-1209,233,1510,494,
+-1199,-1612,-1568,-1420,101,1698,547,-1020,-1132,-332,-166,79,-8,-905,-1677,-471,
+430,62,900,2065,1334,-123,-583,-978,-742,-548,-325,-606,-472,-24,-6,-580,
+37,-51,76,974,249,-161,154,460,458,676,570,795,1552,2011,1323,971,
+1477,344,37,515,286,529,1597,1242,1217,1817,1805,1695,2347,2095,2185,2067,
+1201,903,1308,1816,1526,1071,1008,730,434,756,1233,1168,1526,2538,2703,2257,
+2205,1535,998,1555,1575,1225,1590,1671,1221,1113,1009,1085,1218,557,171,-111,
+-583,-525,-248,227,270,-213,58,198,-262,99,-244,-1407,-1252,-544,-642,-896,
+-831,-804,-825,-837,-795,-802,-916,-1075,-1198,-1175,-654,-713,-1093,-454,-553,-356,
+370,24,-332,129,-73,-730,-727,-451,-379,-274,-169,-492,-770,-21,643,49,
+288,868,1016,775,994,780,304,486,619,385,1944,2459,-25,974,1806,1590,
+2453,1400,1533,2272,1769,1315,739,1027,1836,1257,1427,1864,1109,1389,3013,2358,
+1960,1757,1657,2129,1334,417,1018,899,352,678,862,294,-116,837,1176,286,
+-430,-198,-674,-1438,-955,-528,-887,-717,57,414,-584,-1322,-1193,-1071,-984,-1632,
+-2462,-1110,-1007,-3123,-937,-780,-4078,-1340,-512,-3366,-1591,-958,-1946,-911,-1048,-1652,
+-1516,-2443,-2362,-1293,-2048,-1394,-774,-1022,-219,-403,-649,-39,-595,-676,-700,-962,
+-897,-995,-917,436,1080,376,242,468,-13,398,535,-24,114,157,1025,2353,
+774,1108,3673,1519,700,2504,787,446,908,1096,1841,475,744,2766,864,922,
+2682,-190,-1414,1687,634,-1304,441,1465,773,521,907,1032,158,-394,561,980,
+-235,-354,-84,-865,-671,-977,-1542,-1184,-1749,-1258,-353,-1648,-1420,-320,-1210,-1324,
+-462,-1189,-1354,-728,-1445,-2193,-1993,-1862,-1869,-1611,-1083,-974,-1445,-1110,-528,-1384,
+-1886,-1453,-1406,-1268,-946,-824,-873,-944,-626,-405,-547,-882,-503,138,119,67,
+335,-1,-412,-312,-134,-175,175,403,237,176,627,654,334,604,956,727,
+712,1144,693,487,1079,1078,689,755,988,1038,656,259,722,830,546,877,
+956,359,402,903,1148,686,405,663,457,249,503,618,288,177,249,459,
+640,257,-218,98,239,-193,-352,-174,-519,-770,-912,-1154,-1357,-1137,-675,-734,
+-798,-484,-454,-742,-826,-921,-1137,-930,-728,-863,-861,-674,-574,-889,-1232,-1029,
+-963,-1240,-1134,-850,-762,-1078,-1074,-524,-691,-702,-83,-232,-161,45,-337,-471,
+-453,-226,102,165,104,-181,-576,-567,-109,180,329,505,705,1038,979,699,
+497,378,223,370,574,538,383,620,1014,1169,1199,962,744,738,620,-50,
+-436,-147,207,597,625,602,1092,1103,762,805,730,560,606,219,-389,-266,
+187,94,-419,-574,-286,-290,-386,-550,-808,-464,-490,-1100,-955,-418,-1024,-1006,
+-243,-422,-804,-771,-452,-413,-734,-821,-841,-998,-947,-956,-1237,-1366,-994,-891,
+-590,-498,-646,-468,-700,-868,-493,-522,-624,-495,-137,164,66,-10,-2,149,
+205,5,-285,-516,-121,214,0,-151,81,238,240,552,809,870,772,631,
+552,746,735,611,683,570,511,764,812,588,759,815,702,592,698,591,
+242,174,323,354,274,279,185,183,48,-48,81,213,9,-241,-207,-299,
+-487,-243,-143,-258,-147,-51,-76,-280,-714,-789,-789,-787,-794,-889,-892,-852,
+-796,-835,-876,-630,-501,-611,-755,-817,-771,-665,-644,-687,-586,-354,-317,-484,
+-443,-376,-460,-442,-437,-432,-181,-77,-281,-241,-53,59,147,289,385,295,
+578,684,746,896,760,697,839,894,907,763,463,550,901,813,906,1134,
+952,885,1035,804,788,1107,1100,829,969,1045,832,768,846,902,700,500,
+640,591,483,426,244,290,721,746,370,191,169,269,239,196,312,242,
+142,141,28,-225,-260,-276,-434,-326,-244,-297,-457,-487,-464,-552,-580,-566,
+-728,-907,-793,-761,-788,-650,-575,-580,-635,-783,-778,-617,-699,-647,-586,-574,
+-458,-497,-565,-349,-129,-158,-268,-105,106,39,119,259,148,21,207,222,
+128,351,547,476,493,554,544,548,414,433,505,397,391,411,358,398,
+518,464,403,470,423,523,586,605,572,401,334,466,458,426,515,476,
+349,253,181,121,5,-93,-46,-16,-129,-190,-137,31,-162,-334,-239,-138,
+-158,-339,-473,-614,-227,201,-158,-601,-447,-490,-584,-440,-452,-468,-380,-361,
+-389,-484,-548,-647,-476,-270,-283,-380,-527,-264,-125,-176,-175,-255,-232,-331,
+-379,-337,-356,-138,36,-87,-124,-81,-21,35,-35,-204,-118,26,27,97,
+165,12,-39,207,427,305,-23,-99,113,284,277,34,-21,184,193,32,
+12,6,-61,10,116,112,166,-90,-116,66,86,-9,79,-52,-107,90,
+121,3,1,137,201,-37,-23,28,-118,-265,-199,-150,-206,-251,-171,-153,
+-66,47,70,95,19,-105,-12,66,244,251,63,120,109,82,-95,-152,
+-23,-130,-30,28,-153,-30,30,-86,-129,-121,47,78,-5,40,22,2,
+61,179,93,30,1,-54,45,130,-4,64,133,131,205,141,29,24,
+65,23,101,254,291,194,52,76,33,-47,42,-90,
+// return
+-2337,-338,943,728,-88,-587,-94,469,-174,-1005,-1130,-132,351,-664,-1193,-1052,
+-89,325,27,38,4497,16669,20135,2258,-15326,-4364,8563,14317,8410,-8370,-4482,14558,
+21750,-309,-9873,1105,3816,10596,3907,-18694,8066,7141,-6275,-9210,-11809,-793,11680,1307,
+-22903,-31074,-9280,24229,9804,-23371,-29339,-13094,319,8030,441,-18020,-9963,-12961,-8362,942,
+1944,-3402,-7845,-3841,-1313,2714,4379,3818,2902,-11429,-8832,-7191,-10351,-5640,-2327,-5800,
+930,4003,1063,14611,8992,-3388,6765,3953,2750,-3587,-2268,4450,6531,-77,4124,327,
+-7179,490,-4474,-7030,-7384,2700,7358,18426,9943,-859,-3320,1421,7416,5532,4361,3320,
+9470,15477,20200,15800,7119,5152,11159,23352,24190,9929,6309,9325,12189,14687,2178,3989,
+-181,2770,3367,-3085,-1664,5657,6187,2240,1910,250,10530,7599,-4538,-5857,1202,3053,
+1760,-1058,-2580,684,-3265,-5237,-7425,-9830,-6783,-2281,-4348,-8773,-3887,-1616,-5990,-5466,
+-10115,-8976,-11087,-9940,180,8982,6020,1712,916,-2399,-1124,-7966,-11167,-2135,-1250,-2932,
+-1586,-1144,4340,10634,6282,2920,-2790,-1609,-332,-4023,-8633,-13420,-4385,2335,1981,-3421,
+-6155,-1522,5682,6295,1330,500,7409,12770,5305,-3463,-3537,46,-361,3023,7088,3509,
+-836,-618,850,1721,2974,196,-29,4861,7484,7960,6064,3741,-70,-1862,308,4653,
+5226,3382,3794,5471,8207,9929,7857,2491,4328,10256,13506,16902,16973,13260,11263,9293,
+5177,2816,2238,5698,8047,7324,5427,-537,-4402,-7223,-6848,-6476,-5451,-2052,2405,5927,
+3001,1069,2343,1380,-4328,-8430,-8950,-7275,-5002,-4125,-3383,-210,3508,3402,2062,2346,
+-268,-1613,-4136,-4501,-2570,-2953,-4689,-6751,-8344,-6670,-7328,-9663,-9975,-9823,-8836,-7237,
+-8246,-10310,-12919,-14157,-12928,-14632,-19442,-19693,-15383,-12340,-11074,-11522,-14932,-18281,-20712,-21410,
+-19558,-19467,-18513,-14796,-9885,-8584,-9793,-11975,-13858,-13847,-12960,-9779,-5027,-2567,-2223,-1797,
+-2383,-2662,-2556,-1197,877,3305,5300,6562,8201,12236,16540,19009,19033,17625,18201,20885,
+21793,20348,17465,15968,18354,21149,21119,18926,18084,18694,20222,21736,22310,21473,22115,23934,
+24292,22061,18038,15970,14798,14608,13453,11348,11802,15007,15541,12753,9909,8940,10095,10920,
+11859,11121,11183,12222,10288,5953,1579,-1663,-2986,-2854,-4430,-7124,-10483,-13011,-14594,-16803,
+-19267,-19976,-20332,-19289,-20126,-23572,-26917,-28842,-29430,-31172,-32390,-31953,-31108,-30493,-30130,-29160,
+-27497,-26592,-25695,-24523,-24244,-23628,-22332,-22024,-20270,-17214,-13855,-12211,-11150,-10689,-10555,-10083,
+-8020,-6312,-5828,-5223,-5080,-3296,-793,806,1156,2649,5238,7927,9739,10647,12789,14975,
+15767,17216,18929,19923,20302,19916,20291,22398,25337,27271,27776,26740,26671,26601,26936,27568,
+28175,28511,28688,28721,27684,25738,23694,21614,19172,17410,16659,16005,14616,11837,10693,10148,
+8754,6820,3764,976,-266,-1847,-3891,-5059,-5934,-7244,-9139,-11040,-13023,-14971,-15952,-15293,
+-16118,-17339,-18461,-18813,-19774,-21551,-23337,-24603,-24758,-25381,-26378,-26588,-25251,-24046,-23740,-23079,
+-22758,-22469,-21985,-22077,-22045,-20256,-18367,-16950,-16333,-16583,-15827,-14547,-15254,-15183,-13598,-12195,
+-9476,-7355,-6658,-5419,-4198,-3206,-2558,-2085,543,3742,6014,8429,8476,8101,8732,10440,
+12482,13349,12813,13158,14662,16633,17842,16849,16965,18501,19753,19263,18362,18856,20455,21828,
+21584,20486,19686,19955,20551,19882,18104,15138,13497,12194,10491,8278,5861,4102,3271,2125,
+-70,-1934,-2929,-3579,-4467,-4825,-5115,-5387,-5098,-5573,-8311,-10521,-11454,-11394,-10835,-11579,
+-12511,-12633,-12686,-12426,-12847,-14707,-15190,-14714,-14204,-13523,-14163,-14948,-14544,-13665,-13122,-13298,
+-14468,-15381,-14584,-14004,-13828,-13751,-13772,-12334,-10642,-10385,-9896,-9219,-8460,-6398,-4726,-3524,
+-1961,-1030,438,1196,1896,3355,5194,6704,8036,8143,8184,9119,10564,11163,11226,12122,
+12976,13927,14051,12896,12198,12659,12268,11316,10529,9765,9186,9242,8992,8545,7918,6687,
+6335,6540,6388,6464,7299,8177,8332,6727,5311,5266,4231,2477,904,141,264,-281,
+-756,-1434,-2488,-2813,-3508,-4235,-5033,-5217,-4798,-4910,-5506,-6813,-7817,-8314,-8855,-10094,
+-11106,-12337,-12322,-10622,-9313,-8985,-9006,-8531,-8038,-7575,-8092,-8019,-7035,-5893,-4424,-3176,
+-2214,-1606,-1160,-772,-822,-37,1238,2760,4556,5603,5458,5741,6522,6996,7996,8337,
+7874,7625,7959,9471,10444,10640,11026,10980,10913,10320,9333,9246,10004,10775,10811,10357,
+9895,9565,8975,8409,7691,7601,7407,7109,6822,5640,4188,3305,2695,1885,769,-61,
+-232,-414,-219,-761,-1378,-1559,-1780,-2421,-3743,-4730,-5167,-5864,-7231,-8197,-8430,-8461,
+-8880,-10130,-11269,-11393,-10654,-9877,-10123,-10193,-10158,-9201,-8180,-8436,-9171,-9101,-8373,-7865,
+-7718,-8449,-8926,-8517,-7666,-7245,-7252,-6807,-6277,-4970,-3845,-3558,-2680,-1066,685,1608,
+1984,2329,3941,5789,7117,8080,8606,9749,10404,10547,10518,10768,11607,12819,13125,12823,
+12663,12770,12527,12168,11886,11629,11616,11282,10911,10293,10079,10078,9713,9377,8888,8535,
+7989,7595,7424,7242,7107,6473,5510,4407,3496,2956,2704,2352,2161,1456,478,-287,
+-1028,-2059,-3502,-4631,-5195,-5727,-6768,-7759,-8540,-9934,-11245,-12096,-13189,-14365,-15320,-16268,
+-16875,-17384,-17729,-17576,-17167,-17003,-16778,-16370,-16107,-15449,-14758,-13815,-12901,-11985,-11441,-11041,
+-10321,-9885,-9322,-8378,-7126,-5778,-4348,-3645,-3486,-2442,-769,124,36,107,1024,2136,
+3423,3460,3195,3805,4705,5270,5252,5391,5941,7448,8643,9819,10351,10738,11352,11289,
+11077,11971,12673,12827,12523,12795,13410,13684,13358,13133,12719,12653,12848,12986,11996,10676,
+9801,10190,10270,9718,8788,7825,6546,4857,3833,3629,2986,1636,444,648,935,-121,
+-2615,-4474,-4673,-5672,-6218,-4693,-4551,-5225,-5470,-5575,-7016,-7023,-6293,-6964,-9038,-9205,
+-8635,-9400,-8702,-9025,-11576,-10830,-8330,-8118,-9755,-9800,-8953,-7538,-7178,-6999,-8277,-8344,
+-7705,-6193,-3284,-3041,-5042,-5545,-3032,-2472,-2919,-1483,-3483,-3990,-2507,-3073,-1562,-451,
+265,65,2371,2023,3492,3080,959,3217,3119,3423,5429,7307,7934,7126,9332,6478,
+5688,6861,7422,9311,10576,6291,3818,5935,9622,8677,5563,7032,5607,6079,11091,10398,
+8031,5346,5441,6069,7245,9848,6203,2581,2495,3902,1565,-2942,-1126,62,764,-342,
+1493,2804,109,-1689,-1439,-187,-384,-611,-348,1495,1379,-273,-902,-275,10,-2519,
+-2020,-838,-263,-1506,-2602,-4813,-5540,-4285,-3376,-4464,-3631,-1784,-2782,-5544,-4218,-4554,
+-5701,-5691,-4811,-3901,-4307,-2449,-2321,-3560,-2365,-2706,-3235,-2494,-1460,-548,-1164,-788,
+276,-173,455,-162,1636,2361,1311,-286,-247,1896,2508,585,367,1142,1377,1132,
+572,63,98,-843,-1927,-290,431,371,-1317,-1204,-16,-313,792,1488,56,997,
+3287,1265,-17,766,106,-941,-71,1214,838,1665,2983,1631,308,1102,1642,-254,
+-304,920,335,1357,1476,1025,-207,-146,1033,1537,305,-1481,-620,-459,-263,-1624,
+-657,-12,-984,-1358,-1260,-1392,-1389,537,333,-1832,-945,1598,1115,-1418,-2111,-1081,
+-503,-448,404,-506,-1504,-1292,-831,-754,-992,-1845,-1933,-1506,-1237,-2868,-3649,-3518,
+-3306,-3158,-3341,-3407,-4249,-3983,-3909,-3598,-3633,-3878,-4263,-3753,-2228,-2356,-3500,-3843,
+-3257,-2884,-2203,-2539,-3911,-3417,-2099,-2038,-2412,-2137,-1987,-2085,-1795,-1907,-2389,-2067,
+-1662,-1743,-1361,-392,-543,-636,-179,256,630,1059,1533,1277,834,1088,1127,2011,
+3723,3957,3078,3555,3812,2865,2630,3163,4428,4594,4691,5428,4650,3763,3563,4078,
+4502,4471,4598,5344,4881,4009,3665,3631,3590,3874,4339,3646,2914,3610,4034,3148,
+2821,3445,3603,3072,2764,1982,1441,1656,2277,1760,1083,1120,1127,58,-1314,-1474,
+-1194,-1616,-2251,-2479,-2867,-3049,-3225,-3496,-3470,-3230,-2452,-2767,-3761,-4061,-3343,-2959,
+-3060,-3224,-3317,-3516,-3017,-2354,-1834,-1527,-1306,-469,273,231,11,32,-195,-143,
+377,695,372,-261,-141,65,388,109,-386,215,1339,1952,1679,1792,2284,2931,
+2942,2414,2563,2352,1841,2345,3094,3164,3403,4155,4515,4568,4258,4532,5263,5820,
+5586,5026,5118,5254,5188,5246,4733,3620,3185,2933,2351,2119,2179,1954,1280,532,
+-214,-583,-267,-75,-755,-697,-796,-380,137,-133,-17,-11,-675,-604,-863,-1085,
+-1882,-3127,-2214,-1881,-3967,-1635,-793,-3891,-2770,-1634,-1869,-2224,-2439,-1211,-2888,-3799,
+-3234,-1954,-657,-1851,-4654,-5415,-4090,-2625,-2533,-5029,-2023,2138,1223,-1921,131,3179,
+1617,-2150,4087,3265,1835,9950,6687,4,-206,4976,4301,1138,3823,-5240,-8585,2431,
+7742,2320,1901,359,-1060,7604,10649,-448,-3253,7073,2118,-3241,6220,4068,-4821,36,
+8397,355,-6927,-1392,1759,-1599,483,4647,934,14,1821,-4426,-3586,-2994,-6028,-6075,
+6,83,-65,734,-2691,-2021,3811,3992,-2027,-4032,-2929,-9403,-14124,-6041,-6835,-12923,
+-11665,-8051,-6190,-4066,-9678,-11783,-4577,-1562,-523,1153,-1865,-896,-2015,-1863,360,3530,
+305,809,-1188,-3790,487,-1132,-3874,-692,1796,-1657,-33,-1160,-1540,913,4452,2013,
+3018,6916,6996,3296,-1037,773,2492,1311,4407,6098,881,3545,6949,4545,3083,3806,
+6459,4668,6956,10453,7826,4344,7435,8181,7227,4363,5432,4185,787,2071,1928,3009,
+-612,-904,1584,700,891,2201,1954,-563,-1667,663,1063,-2241,1194,1726,-2632,-2842,
+-2413,-3648,-6159,-6838,-6372,-6213,-6357,-9570,-9640,-9792,-10161,-7624,-7547,-7638,-4363,-4572,
+-6901,-6976,-5495,-7115,-7996,-4599,-4798,-8787,-7211,-3244,-4672,-4793,-1897,-3567,-3842,-1732,
+-759,-1745,-1303,1309,-136,-1879,819,2469,1289,2544,4758,2387,3473,6611,6291,6073,
+6961,6839,5640,6909,9044,6367,4985,5659,6071,6506,6498,6460,6483,6663,6353,6987,
+8307,6549,4923,5900,6896,6502,6774,6698,4754,4514,5137,4230,4316,3807,2685,3626,
+4244,3364,2794,2174,379,-455,-475,-283,-1532,-1230,-101,-1484,-2104,-2862,-3678,-4093,
+-4872,-5391,-5790,-5286,-5224,-6036,-6161,-5461,-5695,-7534,-6550,-5231,-6007,-6744,-7431,-7346,
+-7032,-6850,-5330,-4152,-4387,-4994,-5631,-4857,-3296,-3698,-4440,-4182,-2219,-2237,-3168,-2166,
+-1877,-2564,-1325,-268,453,706,71,1037,1301,1277,1970,1767,1857,2444,3476,3593,
+3414,3623,4421,5019,5571,5823,6189,7165,7115,6240,5438,4416,3657,2710,2411,2169,
+2019,1905,2036,2764,1816,1696,3695,4384,3798,4159,4705,3826,3293,2651,1810,1820,
+1891,1240,584,221,-284,-1276,-2229,-1477,-1364,-1948,-2308,-2610,-2226,-2264,-2065,-1990,
+-1926,-1885,-1917,-1386,-620,-1192,-2560,-2575,-2120,-1869,-1722,-1860,-2627,-3310,-3712,-3812,
+-3907,-3922,-3378,-3315,-2853,-1436,-1142,-1226,-1389,-1169,-531,48,-157,-426,530,1420,
+1205,500,221,897,1591,1696,1616,1169,939,1032,983,-9,-136,1009,1171,577,
+1040,1285,809,312,732,1209,531,375,939,1078,463,-411,-241,17,-519,-1264,
+-1860,-2167,-2022,-1452,-1906,-2399,-1875,-1559,-1288,-1250,-2007,-2753,-2800,-2679,-3147,-3484,
+-3449,-3477,-3316,-2892,-3325,-4056,-4464,-4241,-3545,-3484,-4137,-3917,-3417,-3485,-3674,-3760,
+-2832,-2181,-2432,-2395,-2393,-2820,-3325,-3365,-3313,-3091,-3671,-3493,-2317,-2475,-3249,-3580,
+-2785,-2518,-2938,-2385,-1761,-1655,-1165,-464,185,1212,1434,1648,1650,1782,2389,2724,
+2710,3313,3259,2855,3209,3305,2534,1989,2485,3037,2751,2689,2616,2352,2357,1927,
+1691,1610,1478,1595,2152,1928,1653,2042,2153,2481,2501,2885,3278,1713,143,-179,
+1093,440,-1367,-623,1134,1375,1291,1861,2420,3803,2035,-1588,-1810,1633,1095,-728,
+-1180,-2952,-3531,-2894,-3430,-1919,1765,-2081,-810,3605,4018,-162,-1492,3005,889,-499,
+2780,-2586,-3541,-2413,-2664,-1706,-412,1441,-4548,2730,519,-3452,1092,2281,1281,452,
+4430,3233,3562,6258,9104,-972,-6169,5317,4573,-2892,1402,5602,-1001,1825,7903,3885,
+-5633,1624,3698,-3739,1632,4822,1868,3682,496,-3016,127,1018,2258,5218,3291,3216,
+4875,4721,1850,5920,4958,-4271,-2639,-365,-4834,-8514,-5111,-3021,-5551,-2757,4355,1201,
+536,2459,1465,-493,-59,2442,-1312,-905,3278,-190,-2539,-1744,-532,4707,5295,-654,
+-982,-1521,-1357,2034,1168,-3003,-2675,3118,142,-3026,4294,2056,-4729,-1075,4488,3774,
+2286,2617,327,-2057,-1073,537,-1969,-4572,-6,2944,527,888,4604,3021,-913,50,
+1758,1856,1965,1541,725,1253,1651,2869,1711,-595,-834,697,646,-1211,826,1072,
+-872,2442,3834,1388,3236,-2339,-6933,770,-1584,-3440,1336,-2458,-3530,3084,1214,-1500,
+976,4621,5725,3072,-1961,-6290,-3528,-2218,-3329,-10698,-16551,-8150,-916,-970,-2101,-1979,
+2089,8811,8997,-31,-532,1969,763,-1040,910,-5194,-10321,-4134,-6207,-4194,-3024,-1527,
+-3518,6817,13383,4014,4093,3176,3554,-596,-1870,-2939,-106,4321,-4591,-8949,-2190,-3469,
+-4260,1813,6915,-3754,-597,2265,6121,2157,3390,8,686,11792,11152,-2649,-7233,4834,
+-2123,-6613,2513,5867,-598,-2243,1356,1001,-4125,-5357,-467,-2268,-1794,3939,2299,-4735,
+-1204,3714,-3020,-5090,2517,-11,-8593,-8269,-2447,-3750,-8852,-9129,-7754,-4193,-1437,4701,
+2089,732,1615,-1073,5191,10308,2780,2876,4685,-2223,871,-592,-12381,-11644,-2351,-2520,
+-14166,-9264,2146,93,3699,11415,9290,11186,10341,1419,-4074,-7196,-7614,-2851,732,7287,
+-4938,-14469,-3388,4721,-4454,-3161,10210,-1116,-5657,-1030,-1140,-1329,-5283,-6704,-9313,-6037,
+2044,-1462,-7439,-3364,306,9876,410,-9567,6168,-3182,818,-2537,8187,7242,2083,4997,
+9410,-796,-11969,-7084,-6717,6271,13508,7219,6348,7726,8832,-4256,-5484,350,-5045,-310,
+-7561,-5832,3965,1340,1210,-1737,184,-2676,-5098,-2879,-14556,-17944,-6039,5293,9055,12772,
+16312,12111,11667,13933,10721,8086,5023,-2677,6121,15396,6452,4624,3713,8055,3311,272,
+2230,-3907,-9353,-5966,-1177,4001,5413,6752,5780,5097,6105,8237,8130,1326,6718,14051,
+5050,79,3923,-3848,-9184,-6287,2354,4099,-8065,-2574,-162,-6357,-2214,-3640,-7742,-8506,
+-9746,572,4697,1103,1948,-2948,-3716,-7428,-6481,-7304,-10778,-4133,-2733,-4573,-3273,-5693,
+-2827,-2191,-2892,6148,-6026,-11064,-6580,-5476,-6071,-5338,2043,-2038,-9624,2915,9424,270,
+-2483,298,14192,7043,-690,11994,993,-4889,2721,-6048,-15002,-9378,4411,2156,-3681,6498,
+6715,-4178,8862,8770,3326,5107,-3651,-5900,-7082,-16362,-15448,-10737,-11361,-7519,80,11583,
+15729,17347,17814,18096,20544,19085,15204,10890,10642,5121,-10052,-15634,-7653,-3543,-815,267,
+5767,9705,7907,5988,5287,2843,-4892,-8967,-4750,3384,247,2456,5868,3574,3547,-1037,
+-2593,-4568,-3043,-1192,-7469,-6924,-5326,-4579,-1235,-5476,-10914,-8497,-6075,-9957,-9427,-1398,
+-917,-6917,-808,5204,110,-2166,-3033,-5033,-6635,-8055,-5349,-4691,-3317,1283,2348,-708,
+-1876,1363,3788,93,-5891,-7289,-12235,-16609,-14101,-10758,-8430,-6678,2699,8190,5265,5076,
+6143,2533,-619,-1970,-6133,-10519,-10229,-5302,-2009,147,2960,7366,13083,16634,18784,18765,
+13672,11134,8698,1951,-2684,-3390,-5918,-6494,-4290,-1287,1806,1756,4630,7416,7687,10402,
+13440,10342,4521,1946,2276,-1164,-6592,-3006,981,902,1920,4921,5538,5273,6776,4823,
+3678,5248,3972,1161,439,-740,-4746,-7348,-5471,-4994,-5783,-5279,-4606,-2632,-2828,-3558,
+-3329,-4114,-5750,-6257,-4657,-5527,-6932,-6247,-4442,-1294,1100,2270,2525,1612,990,-1838,
+-4363,-4641,-6411,-9624,-10253,-9691,-9208,-8558,-9096,-8459,-6683,-5242,-4301,-3584,203,3314,
+6074,7235,8887,9002,5601,2835,782,-1904,-5266,-6929,-5317,-3587,-3124,-3796,-1363,3207,
+5022,5571,6112,8018,8853,6997,6153,6156,5757,5209,4655,4751,4813,4151,4221,4062,
+4044,4197,3515,3822,4855,4839,3972,4139,3532,2741,3621,3899,4609,5690,6979,7504,
+7112,4973,3955,3555,2487,1495,1327,414,-453,-512,-1462,-2575,-2011,-1838,-553,1165,
+1781,2758,3069,2312,883,-137,-1650,-3567,-5588,-7251,-9037,-9385,-7885,-6800,-6628,-6117,
+-4842,-4230,-3801,-3345,-3156,-2986,-2515,-1716,-300,-284,-926,-1357,-1646,-2111,-2487,-2577,
+-2741,-2385,-2723,-3139,-2432,-2973,-3668,-3755,-3481,-2697,-2263,-1905,-574,1128,1569,1445,
+1809,2759,2953,2025,2010,2808,3095,1792,1202,1282,1104,1808,2131,3484,5393,6282,
+6618,7348,7600,7086,6569,5125,4301,4084,4008,3629,3307,2473,1364,1468,1752,1465,
+1049,959,1843,3722,3439,2152,2222,2932,3713,3937,3845,4905,4858,3987,3017,1116,
+-1300,-2938,-4083,-3995,-3207,-3362,-3756,-4291,-5322,-5544,-5863,-5940,-6532,-6002,-3975,-2361,
+-1382,-1519,-1375,-512,-987,-1840,-3149,-4525,-5274,-5993,-6763,-6803,-6962,-7226,-6541,-5235,
+-3833,-3460,-4143,-3230,-2436,-2666,-3323,-3847,-4295,-4264,-3567,-3106,-3264,-3003,-2298,-1848,
+-946,452,-315,-727,-79,357,1113,1318,890,1299,2573,2852,2533,2781,4397,4773,
+4084,3111,2727,3646,3178,1963,1058,835,1052,1634,2262,2268,2101,3004,4308,4364,
+3797,4094,4878,5483,5209,4449,3883,2936,2156,2654,3433,3868,3720,3288,2857,2768,
+2373,1790,1946,2315,3120,3195,3415,3219,1736,500,-244,-159,-237,-1511,-2244,-2244,
+-3326,-4899,-5616,-5888,-5522,-5495,-4018,-3370,-3084,-2175,-2561,-2364,-2806,-3289,-3545,-4577,
+-5148,-5365,-5232,-5068,-5102,-4265,-2901,-2220,-1495,-1086,-1065,-2093,-3178,-3839,-4573,-5195,
+-4854,-4018,-3457,-2538,-1559,-673,-791,103,691,61,19,468,-212,-1307,-1949,-2008,
+-1921,-1812,-1454,-680,-54,465,1499,2569,2709,3717,5063,5070,4350,4117,4050,3346,
+3304,3228,3367,3487,3513,4205,4878,5727,5729,5557,5433,3531,2569,2230,1531,1228,
+1813,1875,1711,2053,2448,3189,3641,3733,2409,1585,1735,1359,803,-248,-130,185,
+-464,392,1282,1280,1604,1482,2104,1545,-115,-661,-1033,-1519,-1954,-2549,-2662,-2815,
+-3062,-2825,-2920,-2953,-2698,-2611,-2272,-1697,-1092,-1181,-1893,-1890,-2082,-2652,-3116,-3424,
+-3350,-2223,-2044,-2465,-2883,-3034,-2246,-2333,-2765,-2790,-2589,-2498,-1865,-1428,-1195,-526,
+149,1148,1512,2063,3034,2732,2451,2338,1793,1857,1315,198,-6,189,99,450,
+702,1467,1882,1665,1883,2005,1939,2056,2099,2361,2638,3115,3269,3017,3152,3648,
+3747,3320,2349,1593,1046,644,349,286,410,880,867,757,711,478,526,855,
+1497,1524,815,776,1252,1319,882,109,-679,-349,26,-175,-1202,-1625,-1826,-1930,
+-1434,-1593,-1545,-1216,-1195,-852,-474,-748,-1079,-1792,-1841,-1946,-2409,-2200,-2206,-1961,
+-1607,-1611,-1761,-1584,-957,-367,-926,-716,-99,459,368,-300,-105,78,121,-245,
+-454,-143,-154,-162,-187,118,560,599,628,704,1022,844,245,117,-68,-319,
+-359,-298,350,253,-253,-563,-242,306,412,764,1539,1904,1962,1322,1267,1741,
+1831,2376,2473,1798,1487,1463,1308,1024,478,-661,-784,-648,-996,-1573,-1490,-1699,
+-1577,-1240,-1739,-1800,-1709,-1397,-1149,-967,-574,-192,-1050,-1601,-1103,-1585,-1416,-1712,
+-2297,-2171,-1927,-1793,-2826,-2802,-1706,-2108,-2423,-2012,-1385,-1286,-2114,-1856,-401,-590,
+-1399,-1399,-1628,-701,223,23,-304,-108,-172,-792,-1001,-724,-869,-736,-921,-879,
+-242,466,814,1287,2038,2257,1721,2037,2113,1672,1654,2475,2350,1378,1126,1943,
+2059,1875,2457,1562,1386,2417,3056,2798,1815,1062,1007,2591,3222,2507,2226,1816,
+2156,2463,882,223,821,2058,2781,1937,842,425,442,585,749,481,159,-467,
+69,99,-159,319,-376,-1331,-1104,-603,-1047,-1881,-1818,-1272,-1789,-2479,-1476,-589,
+-816,-749,-878,-1942,-2557,-2567,-2349,-2820,-2972,-2771,-2728,-2542,-2037,-1837,-2036,-1418,
+-978,-1419,-1643,-592,-3,-1355,-1802,-896,-1029,-1755,-661,266,-455,-549,-384,75,
+702,1224,837,833,1512,1916,1988,1420,945,628,479,304,367,1017,1750,1846,
+2116,3072,3320,3047,3103,3224,3474,2944,2379,2352,2336,2902,2884,3097,3890,3770,
+3163,2658,2623,1829,969,1238,1840,1791,1710,1663,1033,516,615,760,1244,1671,
+2043,1618,1423,1585,1429,1452,978,573,718,412,26,-968,-1573,-2104,-2112,-1948,
+-2469,-2754,-2941,-3524,-3954,-3967,-3761,-3748,-3494,-2533,-1583,-1386,-1701,-1677,-1538,-1816,
+-2499,-2739,-2248,-2100,-2745,-2795,-2424,-1924,-1330,-695,73,-1001,-1425,338,-668,-872,
+-376,-888,-905,-1797,-2487,-1759,-202,151,42,569,976,1436,3155,3030,1556,914,
+819,1441,689,214,42,-618,-47,1285,1985,1201,-89,956,3034,3034,2913,3397,
+3163,3096,3250,3098,2466,2157,1872,2496,2573,2481,2753,2441,2276,1264,242,97,
+352,1147,94,-1202,-918,-410,-142,77,-608,-1145,-192,-221,192,1013,-464,-1532,
+-2382,-2948,-997,-2072,-5560,-4865,-1390,-1676,-2070,-1992,-2100,-2924,-1104,-1310,-3637,-3116,
+-3129,-1647,-2284,-2398,-4007,-4269,-1974,-1917,-1867,-2150,-2938,-2268,-2489,-3667,-2192,-853,
+-2409,-1792,-210,-309,-2037,-2170,6,532,-561,-1303,-608,767,1277,833,-702,-306,
+1678,1049,-420,1258,1479,-287,-737,924,1749,581,605,1489,1006,1152,2219,2732,
+1659,2672,4940,3755,2707,3378,2633,1181,2053,2290,869,393,1127,1393,1121,577,
+1418,2017,438,1347,3028,1889,1304,126,697,1731,890,333,874,-324,-172,618,
+-4,453,1148,1036,-388,-81,1319,-525,-2465,-2262,-1562,-1335,-1194,-1034,-701,-1240,
+-1094,-1236,-1200,-395,-1745,-2652,-1007,-930,-1597,-1378,-1579,-1550,-2511,-2683,-1178,-1643,
+-2479,-2215,-1823,-1398,-1654,-1421,-1193,-2196,-1496,-63,-291,-1274,-1135,-794,-532,-238,
+232,231,-195,389,811,215,62,921,753,347,824,1242,161,96,563,336,
+727,452,323,1353,1817,1122,1509,2221,1911,1901,2256,2265,2335,2237,2728,2576,
+2227,3062,2642,2165,3272,2829,1921,2370,2646,1721,1319,1408,1978,2407,2125,1204,
+494,528,-52,-357,-140,-319,-126,-64,4,429,1002,732,376,89,-16,236,
+13,-1166,-1820,-1540,-1424,-1706,-2333,-1923,-928,-749,-640,-555,-1143,-1300,-1055,-1333,
+-1376,-781,-643,-937,-953,-465,-1124,-2986,-3031,-1442,-1162,-2632,-2238,-991,-1196,-1378,
+-132,-196,-1473,-1275,-1058,-992,-796,-137,336,548,887,1858,1942,-338,-550,1149,
+1767,330,-942,-2069,532,1346,1299,1294,44,785,1670,1484,1210,888,1820,1659,
+42,620,891,894,85,-622,-929,-241,1090,-599,-1593,-1474,326,-1220,-1233,2081,
+1376,-533,-2200,-1476,-353,-1469,-1951,-1001,-2867,-4131,-1002,-2166,-2039,-843,-1177,-2172,
+-1565,2,-1236,-1836,-4270,-2645,-1199,-1343,-1872,-2296,-1269,-1657,-1930,-115,1492,115,
+-435,664,1726,1176,-1534,-1719,-1504,34,769,191,348,413,-1106,-712,-355,-453,
+1057,333,-2008,-1001,2393,1641,537,3289,3015,2447,4176,5167,1686,-562,2011,2988,
+3026,5629,5354,4430,4049,3736,3578,3297,2043,1974,2640,1948,1269,1668,2450,21,
+-462,798,944,538,787,94,-172,1782,1243,423,1592,2066,-15,-939,1476,2168,
+176,-907,-1146,-1194,-329,-3115,-4467,-3398,-2832,-3108,-3723,-1214,-76,-310,410,1172,
+-797,-1468,-1820,-2702,-1895,-2979,-4370,-4516,-4090,-4408,-4068,-3684,-2914,-2702,-2906,-2171,
+-1772,-1997,-1861,-1334,-1366,-1606,-416,-292,-1591,-1496,-742,-236,-79,39,213,95,
+-645,-56,724,-35,702,1493,1908,2889,2905,2235,2970,3722,3931,2907,3042,2513,
+910,1358,2080,1586,1257,1280,1539,2262,3281,3891,4184,5254,5114,4862,4543,3951,
+3010,1282,1266,2468,2312,1634,1707,1871,1241,771,2062,2690,2015,1434,1534,279,
+-910,-1191,-1578,-2338,-2834,-1375,-403,-656,-1414,-1290,-1169,-1135,-351,614,-260,-1927,
+-2294,-2859,-2990,-3029,-3513,-4023,-2946,-2000,-2199,-1856,-2347,-3219,-3106,-1969,-2198,-2414,
+-2809,-3245,-3473,-2965,-2692,-3301,-2960,-2264,-1979,-1876,-971,-378,-557,271,557,-119,
+460,1143,580,70,-205,-821,-1105,-805,-380,-231,-87,550,837,1427,1721,1719,
+1465,1301,1193,1329,1984,2316,2612,3215,3441,3484,3155,3235,3107,2312,1517,1071,
+753,-285,-1203,-1111,-834,-873,-419,62,612,771,977,1583,1157,356,387,602,
+574,975,761,514,795,809,427,-210,-179,-265,-693,-776,-568,-402,-552,-361,
+-408,-888,-1217,-1138,-1267,-1131,-1335,-1637,-1445,-1229,-990,-625,-523,-680,-674,-378,
+-226,-148,65,175,-374,-424,-176,-418,-671,-802,-1000,-915,-801,-784,-514,-495,
+-975,-980,-644,-763,-929,-649,-199,186,916,1320,1066,1277,1275,1245,1081,644,
+180,-244,-225,-150,99,131,414,480,133,193,160,-56,-237,-393,-542,-593,
+-476,-727,-984,-885,-847,-541,-261,84,633,694,183,-59,-296,-557,-732,-796,
+-682,-990,-1084,-442,-229,-43,124,238,527,743,605,199,-195,-361,-618,-924,
+-701,-564,-577,-1031,-1347,-1244,-1217,-1238,-851,-151,419,818,1173,1058,1073,1292,
+1224,945,674,324,-41,-56,-270,-207,-40,102,419,645,218,-632,-746,-631,
+-791,-857,-485,-306,238,361,222,507,482,403,806,809,835,1015,695,408,
+458,-45,-315,-316,-375,-411,-588,-504,-460,-498,-561,-584,-274,-140,59,441,
+478,781,1024,848,637,550,194,7,281,986,805,529,995,1179,745,505,
+-173,-875,-1006,-980,-807,-707,-716,-867,-687,33,640,989,1116,1541,1605,1406,
+1390,1416,1516,890,486,710,587,190,212,-261,-1065,-1121,-934,-929,-1096,-1506,
+-1688,-1523,-1299,-1104,-784,-576,-410,-476,-483,-220,-285,-163,-203,-621,-813,-892,
+-1239,-1434,-1555,-1490,-1317,-1272,-1165,-1163,-1260,-1534,-1374,-1215,-1222,-1445,-1497,-1432,
+-1568,-1406,-1394,-1459,-1057,-569,-356,-421,-235,34,146,-62,-131,-203,-426,-252,
+-266,-657,-700,-140,314,552,934,1211,1133,1309,1553,1546,1312,1240,1286,1696,
+1705,1743,2183,2431,2250,2321,2434,2277,1937,1674,1520,1457,1556,1733,1702,1692,
+2041,2417,2304,2528,2921,2586,2233,2401,2509,1895,1108,1118,1023,578,327,168,
+6,-204,-286,-37,19,157,164,-337,-799,-742,-837,-1029,-1171,-921,-814,-771,
+-639,-650,-1099,-1378,-1054,-935,-1279,-1517,-1607,-1808,-2042,-2275,-2114,-2145,-2150,-1890,
+-1846,-1700,-1335,-1180,-1020,-1031,-1126,-1140,-1323,-1564,-1221,-713,-684,-958,-894,-816,
+-919,-952,-847,-624,-399,-273,-226,-7,-7,127,207,276,550,1019,1299,1304,
+1432,1678,1818,1653,1446,1302,1489,1726,1843,1917,1916,1692,1686,1406,1281,1301,
+1197,1050,930,830,734,322,240,351,444,645,709,756,862,1083,1132,1003,
+749,652,961,795,371,187,-73,-310,-107,-158,-559,-897,-744,-731,-930,-1302,
+-1219,-1087,-1449,-1565,-1458,-1458,-1494,-1343,-1357,-1329,-1071,-864,-725,-571,-766,-900,
+-1050,-1190,-1174,-1430,-1638,-1327,-1256,-1173,-1189,-1272,-1246,-1390,-1165,-920,-1014,-777,
+-646,-521,-346,-445,-636,-541,-391,-52,79,91,6,-50,-55,0,197,672,
+828,883,888,870,712,485,315,199,143,239,410,366,287,241,345,575,
+533,469,445,534,646,599,254,157,321,318,177,61,201,107,-160,-270,
+-315,-490,-750,-722,-475,-226,108,376,181,88,99,-160,-588,-520,-584,-744,
+-710,-671,-663,-787,-737,-603,-802,-681,-781,-891,-778,-1094,-1212,-1122,-1005,-1061,
+-899,-782,-621,-288,58,398,473,406,284,155,256,295,105,-307,-477,-83,
+169,21,-82,-82,119,191,148,354,400,272,479,823,693,706,716,764,
+618,513,549,809,1001,1130,1331,1233,1025,694,660,657,524,289,176,379,
+508,581,639,804,754,508,482,562,380,232,125,77,-56,-158,59,54,
+-227,-157,-199,-56,25,-161,-169,143,150,-189,-157,102,148,0,50,311,
+139,105,268,280,153,114,244,308,307,357,266,64,127,192,131,161,
+245,74,218,302,239,263,289,401,590,620,617,526,492,707,567,606,
+769,1015,958,791,553,399,253,249,282,334,525,855,964,1059,1046,1004,
+1188,1202,963,966,986,840,544,299,325,400,403,188,161,298,154,-243,
+-293,-147,-198,-236,-554,-781,-862,-722,-495,-484,-183,27,-206,-399,-248,-196,
+-189,-48,-6,-44,-106,-299,-622,-849,-1083,-1132,-1131,-1099,-898,-861,-790,-793,
+-620,-474,-207,225,447,280,386,503,91,-274,-81,-110,-275,-382,-272,-383,
+-569,-523,-394,-366,-267,-241,28,153,15,30,-1,22,68,216,250,165,
+221,462,520,651,938,957,995,965,767,535,459,286,132,322,397,215,
+214,187,79,159,261,232,149,243,531,450,482,314,51,-97,-295,-219,
+-73,-383,-493,-351,-216,-263,-367,-400,-236,-25,-160,-301,-407,-577,-556,-664,
+-697,-656,-785,-885,-628,-427,-290,-226,-280,-250,-257,-319,-461,-795,-964,-853,
+-698,-779,-984,-1020,-879,-997,-747,-514,-563,-475,-286,-334,-503,-736,-842,-632,
+-372,-336,-484,-486,-259,-216,-158,-96,-94,-281,-179,123,223,262,350,455,
+425,549,731,666,650,662,481,258,109,-188,-450,-487,-540,-495,-283,-91,
+-29,175,387,682,704,587,818,955,751,455,505,440,438,470,281,228,
+228,143,36,-94,-85,-312,-244,-96,-189,-183,-151,-222,-147,-155,-161,-143,
+-33,-149,-218,-284,-477,-713,-693,-532,-343,-363,-498,-402,-309,-219,-284,-178,
+71,84,34,-110,-118,-236,-357,-443,-403,-368,-325,-311,-400,-362,-375,-389,
+-113,-147,-287,-337,-294,-209,-463,-550,-417,-440,-196,83,137,237,246,297,
+516,744,851,817,665,611,400,222,145,-49,97,337,419,640,758,791,
+924,1005,781,658,516,426,526,518,629,700,621,813,1148,1136,1093,1050,
+1074,1099,976,978,965,819,544,573,397,193,312,314,196,215,327,433,
+346,243,337,377,389,473,415,258,21,85,44,-165,-160,-47,84,-27,
+-204,-207,-118,-201,-180,-157,-101,14,-71,-53,19,-10,-40,31,-117,-278,
+-362,-549,-495,-564,-678,-676,-847,-801,-606,-516,-383,-238,-447,-433,-303,-95,
+-120,-320,-202,-40,-62,-111,-24,-179,-339,-401,-306,-305,-276,-299,-199,-39,
+13,-114,-141,-154,-48,140,394,292,101,58,-66,-136,-179,-117,69,134,
+121,196,61,-208,-319,-299,-97,-133,-100,93,161,245,171,262,434,443,
+408,466,474,507,465,255,364,269,94,-78,-202,-252,-371,-564,-524,-447,
+-230,-391,-513,-378,-189,-164,-127,-139,-250,-421,-353,-433,-734,-678,-492,-305,
+-278,-446,-545,-475,-388,-327,-354,-251,-232,-292,-341,-639,-740,-786,-744,-496,
+-290,-275,-309,-401,-467,-426,-289,-234,-123,-63,-8,118,161,-97,-243,-206,
+-264,-281,-172,-246,-349,-282,-6,-45,-225,-70,138,175,260,240,250,290,
+305,298,310,331,440,222,135,225,529,642,583,405,466,611,712,603,
+532,452,529,
+0,
+// tink
+4763,2482,-1436,-3932,-3364,-1793,-1147,-985,-555,460,66,-1104,-1367,-238,886,931,
+-526,-952,-221,178,-240,-1419,-2347,-1977,-1596,-1001,153,1619,2836,3046,1772,-79,
+-1112,-955,-778,-701,-127,673,1235,1104,231,-366,46,749,1066,854,797,765,
+850,608,108,148,598,985,1079,408,-347,-378,-58,397,274,145,593,359,
+-353,470,1758,1982,1422,496,495,1365,772,-562,-482,-91,-193,-600,-369,544,
+1115,460,-228,104,-14,-367,-490,-640,-158,-564,-982,-541,-116,-163,-116,-323,
+-682,-361,-392,-690,-916,-901,-530,-403,-20,544,-287,11,467,439,1459,1141,
+116,2612,13233,17860,3016,-17644,-22407,-1998,14030,7551,-2079,-4355,-3853,2908,2946,502,
+7557,17837,5605,-20390,-21945,6381,17272,7675,2786,-7414,-22539,-3457,27909,17544,-23128,-32393,
+176,23718,13497,1748,-4817,-4906,4518,8719,2086,-7048,-10437,2482,13963,5033,-10642,-8895,
+7396,9275,-8560,-16154,29,15558,12980,-163,-4801,4205,12484,4588,-9854,-19797,-15532,596,
+10224,4540,-2488,-1504,5338,7686,79,-13435,-17131,-6087,4125,7064,3647,-5878,-9086,-2281,
+1923,-1752,-8018,-13033,-6251,11364,17900,2683,-11226,-4435,5366,4314,3007,-1368,-8612,-5961,
+3393,7499,3724,-3019,-5835,-4262,-353,2545,507,1259,9069,10121,-1663,-11435,-4307,8930,
+7501,-7652,-15854,-6319,11834,20657,11565,-6691,-10235,6646,16407,2823,-14187,-16048,-7856,2504,
+7502,-839,-9256,250,13020,9961,756,-2620,-2119,-630,4790,3141,-11386,-16517,-3499,6414,
+1299,-6068,-4624,1682,6631,6142,-2483,-9344,-4437,3213,5080,3015,-567,-4037,-1660,2061,
+-1025,-5939,-6340,-2922,-3398,-4049,1765,5966,1326,-1681,1625,-112,-6918,-9104,-5578,-1990,
+-1334,-1293,-797,-1315,791,732,-4401,-7195,-4454,1588,4735,8353,6080,-4037,-12277,-6886,
+365,-3346,-5805,-1617,4116,5124,7017,6809,1694,1154,-714,-5349,-815,7649,6632,-875,
+1575,6507,7147,7768,3242,-6059,-10226,-895,2694,4733,9433,8057,2625,1322,2928,2075,
+-1287,-7881,-6769,3929,8201,3726,438,1486,359,3230,859,-4859,-2047,3656,4469,2693,
+1236,-2494,-3326,1554,1841,-4364,-4659,263,5973,7103,4472,353,-1370,1427,1817,-1557,
+-5994,-1289,2134,-1656,-3674,-1663,3411,7435,5065,-3132,-7853,-5684,862,4858,3909,234,
+-1906,3558,4645,-1621,-7392,-8220,-5438,510,3359,2456,-313,-2595,-3019,266,1078,-624,
+-651,2692,1430,-3335,-8042,-5820,-500,-148,-2691,-1991,-272,1810,2536,2370,1120,289,
+971,2236,-2936,-5831,-6385,-4029,-968,23,409,1105,745,249,-520,-2619,-2778,-994,
+1305,511,-2327,-2009,-660,585,-1459,-4843,-3097,3512,3733,-1255,-2215,-1141,-198,-1103,
+-1026,-279,2138,3052,3628,3980,3613,1068,-2634,-3051,-1229,428,986,2912,4378,4193,
+3237,2524,1556,-684,-972,-165,48,536,1034,795,1202,3162,3281,2365,1524,875,
+1237,530,-1035,-1071,1390,4497,2867,-1061,-1584,-2139,-1065,2350,2879,3648,4925,5231,
+2191,-836,-2517,-3728,-2743,-549,-1480,281,4911,2736,-362,-2100,-2726,-995,341,494,
+791,-669,-2444,685,4359,691,-4255,-4297,-3608,-4837,-3989,-3368,-700,2607,932,-1679,
+-336,430,-1718,-3601,-2942,-194,2042,1263,-1180,-3860,-3095,-324,1072,-727,-2867,-1593,
+536,145,1381,814,-652,-541,-1375,-4816,-4877,373,4002,4339,2457,204,1451,4236,
+4799,1814,-4516,-7196,-1202,4213,2416,729,649,-371,10,1500,83,-1720,-2046,-126,
+2440,2010,1483,2224,2068,1437,1170,680,615,775,1289,3014,3998,2342,-694,-1710,
+-68,120,-974,-625,2138,2977,1520,1090,229,-1727,-1747,-410,-241,-747,-12,1106,
+1443,481,-664,-1574,-813,-956,-1802,-2473,-3093,-1848,733,1179,263,-524,592,1223,
+583,-691,-469,1006,1955,438,592,1289,-242,-2600,-1725,1029,3307,2566,943,-67,
+-1448,-1879,-139,554,-646,-1801,-337,1341,1440,1975,1721,-157,804,1940,999,411,
+149,51,1216,2521,2414,745,516,1617,888,-1046,-691,1888,2040,-424,-806,416,
+300,582,1235,779,484,550,634,779,918,-17,-1721,-2155,-1100,-425,-332,-195,
+365,1407,1706,835,-857,-2354,-2000,-1038,-1215,-879,785,1603,1158,1017,1312,21,
+-1735,-1777,-280,709,260,-936,53,1815,1713,255,-1113,-1803,-1486,-323,967,903,
+-735,-1382,-565,-621,-1386,-1495,-21,1153,1349,1963,2831,2774,1576,-460,-1385,-1727,
+-1717,-179,1842,1915,969,1576,3227,2624,241,-891,-520,-10,-552,-1095,622,1972,
+1396,959,775,535,2,-1088,-1566,-1045,-469,422,1497,968,-1306,-2361,-1085,-999,
+-2145,-2175,-1228,79,106,-1236,-2247,-2577,-2123,-1406,-1071,-922,-1300,-1589,-975,-867,
+-1589,-2006,-1824,-2135,-2809,-2954,-1971,-1023,-603,85,325,-283,-1102,-1500,-1589,-1765,
+-1797,-1342,-642,44,385,359,370,139,-329,-227,82,13,-544,-761,-694,-938,
+-1311,-602,219,256,-12,279,373,664,1415,1564,1129,546,188,692,1131,1183,
+1397,1698,1867,1793,1374,937,826,1248,1603,1284,1475,2281,2257,1682,708,-71,
+618,2177,3078,2388,618,-12,682,1403,1589,619,-298,-93,627,1253,1193,98,
+-129,434,770,435,-181,-58,390,1019,1493,1301,1239,804,88,-189,-293,-826,
+-926,-883,-243,771,804,337,-414,-904,-379,97,-330,-957,-886,-95,456,242,
+-472,-1194,-1082,-407,-271,-394,-726,-471,390,888,336,-744,-1621,-1340,-439,28,
+61,388,1073,1040,274,-604,-1067,-766,-35,304,-350,-949,-327,485,260,-346,
+-793,-1188,-1205,-1031,-1034,-1170,-926,-430,128,-223,-1141,-1943,-1606,-600,-220,-276,
+-285,34,357,362,303,-139,-1257,-1476,-344,708,723,437,646,789,462,115,
+-43,26,74,11,56,-103,-177,474,1416,1622,583,-769,-803,687,1643,1742,
+1436,1155,1117,1140,767,196,-295,-238,210,409,274,-99,-10,612,741,535,
+790,1072,959,286,-297,-508,-415,-62,438,596,147,-359,-22,363,-18,-407,
+-300,-349,-907,-2020,-2015,-866,35,-140,-723,-1056,-1028,-711,-545,-797,-1216,-1531,
+-1509,-835,-532,-1476,-2609,-2661,-1669,-847,-759,-1092,-1697,-2214,-2214,-1966,-1456,-636,
+-238,-283,-785,-1125,-367,354,139,-173,-257,-227,-36,307,562,85,-889,-775,
+266,1043,653,-553,-1054,-670,-40,653,576,-125,-488,85,1067,1263,687,459,
+1038,1370,819,235,36,-300,-495,-1,240,-199,-313,421,1130,595,-380,-562,
+416,1133,214,-1254,-1123,-20,810,474,-502,-1172,-1152,-695,-372,-453,-745,-792,
+-730,-1131,-2055,-2336,-1414,-433,-135,-521,-1520,-2027,-1719,-1032,-470,-645,-1112,-536,
+559,761,-33,-819,-652,25,348,176,-245,-807,-1207,-1202,-690,-243,-76,315,
+446,6,-569,-693,-159,479,180,-649,-689,89,920,1075,515,233,612,1126,
+1322,977,70,-470,12,887,1204,953,530,420,634,914,745,495,742,1395,
+1702,1045,-59,131,1184,1230,315,-150,-118,-133,-499,-451,-24,50,10,280,
+257,-629,-1234,-479,600,754,440,-73,-292,-101,-304,-406,83,230,-7,204,
+388,38,-441,-361,378,701,-7,-764,-688,-290,201,585,640,315,290,701,
+829,722,773,787,737,1204,1398,1244,1195,1263,1070,792,795,910,635,347,
+235,425,942,1262,1004,860,869,781,969,1301,1476,1507,1329,1243,1426,1531,
+856,6,176,1071,1093,398,-79,147,633,391,-140,172,822,836,438,150,
+-32,-365,-489,-202,334,740,510,-103,-789,-1089,-675,11,-165,-733,-650,-566,
+-1094,-1470,-1229,-907,-962,-1061,-1119,-992,-790,-865,-890,-338,50,-89,-424,-569,
+-849,-1198,-991,-430,-251,-700,-933,-457,-198,-612,-653,-306,-195,-204,-37,155,
+-90,-423,-280,184,323,-202,-496,-163,425,894,935,667,608,527,482,685,
+473,-119,-54,633,1196,1330,1117,970,828,853,1154,1587,1579,1121,801,718,
+822,1125,855,114,95,551,613,152,-152,-450,-622,-192,28,-477,-644,-429,
+-258,-241,-403,-681,-559,-237,-44,-348,-922,-1186,-780,-307,-411,-1150,-1552,-1092,
+-142,-2,-743,-1035,-808,-778,-1134,-1837,-1995,-1572,-1212,-958,-959,-1229,-1008,-726,
+-775,-1013,-1429,-1637,-1042,-335,-345,-1052,-1115,-111,610,112,-938,-1181,-165,762,
+647,-13,-5,784,1284,1084,674,334,554,1265,1682,1408,1184,1552,1769,1381,
+806,626,1034,1597,1769,1480,1027,977,1455,1741,1498,965,643,820,1117,1033,
+825,1051,1294,900,256,70,361,626,655,395,66,-193,-234,-220,-370,-683,
+-940,-1026,-551,95,-376,-972,-675,-562,-927,-1077,-767,-747,-1308,-1755,-1856,-1672,
+-1113,-675,-1114,-1947,-2189,-1552,-944,-818,-1129,-1626,-1776,-1352,-869,-808,-1079,-1378,
+-1485,-1132,-582,-423,-687,-776,-467,-31,157,-182,-478,-337,-61,-91,-484,-339,
+558,1126,1025,773,748,1010,1218,1260,1236,1182,1245,1450,1643,1763,1718,1457,
+1323,1415,1482,1299,1253,1543,1559,1070,798,1010,1433,1814,1813,1405,986,1105,
+1527,1534,1213,873,961,1429,1473,872,474,680,898,635,218,53,222,474,
+471,72,-518,-963,-897,-298,-52,-571,-849,-642,-525,-750,-878,-857,-1031,-1376,
+-1426,-1029,-728,-986,-1452,-1462,-1235,-1325,-1722,-1843,-1588,-1133,-868,-1043,-1020,-589,
+-226,-147,-429,-902,-1066,-791,-701,-666,-510,-361,-399,-469,-494,-511,-604,-580,
+-514,-513,-409,-175,15,-59,-218,-31,239,375,508,509,305,227,555,716,
+672,454,299,459,597,277,236,690,1084,979,294,-232,104,807,959,535,
+208,41,297,709,889,661,161,-247,-137,141,-14,-362,-619,-493,-76,155,
+71,103,-70,-768,-988,-484,-265,-443,-500,-466,-612,-354,220,253,-344,-659,
+-525,-340,-285,-340,-210,-214,-648,-1017,-773,-405,-647,-1067,-971,-454,-266,-392,
+-468,-244,-36,-182,-296,-213,14,317,661,506,-289,-689,-173,516,457,-94,
+-414,-148,327,615,578,308,223,574,785,321,-181,-119,464,910,763,502,
+766,1243,888,139,-61,297,771,919,658,321,205,337,525,500,119,-296,
+-226,320,675,556,93,-137,98,267,180,76,-2,-173,-347,-239,-114,-360,
+-636,-540,-388,-246,-247,-455,-603,-377,92,127,-368,-559,-154,216,155,-295,
+-604,-558,-259,-52,-171,-401,-356,-275,-214,-315,-587,-756,-629,-430,-416,-530,
+-408,-155,-128,-298,-325,-108,145,162,-83,-438,-434,166,711,640,175,-21,
+141,204,-28,-273,-196,218,605,672,528,228,-29,-76,107,393,346,124,
+335,605,622,541,537,740,755,349,-142,-191,262,684,571,268,102,80,
+143,196,128,-30,-106,216,640,611,354,133,88,249,411,370,143,2,
+63,43,-73,-119,-220,-340,-361,-214,-112,-193,-30,207,17,-388,-212,308,
+333,-326,-861,-558,8,99,12,19,-11,-31,-114,-291,-476,-552,-292,83,
+158,-275,-619,-351,256,435,246,75,40,153,249,161,144,102,32,132,
+246,-40,-348,-171,386,526,110,-162,41,198,193,241,319,444,539,614,
+795,729,484,367,654,826,582,299,343,608,776,689,359,114,112,372,
+559,276,-245,-412,105,767,897,513,289,398,496,286,146,348,384,239,
+133,30,-96,-263,-199,191,256,-87,-317,-269,-176,-314,-569,-531,-279,-349,
+-661,-674,-364,-171,-242,-352,-541,-738,-636,-391,-580,-1017,-1023,-644,-420,-658,
+-978,-889,-548,-498,-687,-736,-620,-635,-754,-698,-595,-647,-540,-105,273,-90,
+-740,-723,-182,-27,-413,-659,-419,11,114,-27,-144,-90,75,316,371,138,
+-274,-335,80,642,734,262,37,413,764,608,130,-22,481,937,714,188,
+-56,194,597,666,293,-14,168,588,799,623,320,269,640,937,776,458,
+294,282,276,224,321,405,200,-55,-135,-272,-259,94,380,224,13,40,
+268,289,-175,-623,-449,-134,-107,-186,-262,-479,-599,-461,-284,-291,-476,-674,
+-676,-585,-668,-631,-452,-391,-586,-699,-618,-332,-149,-169,-234,-211,-165,-34,
+-3,-92,-129,-21,76,50,-103,-215,-229,-198,-261,-268,-3,178,49,-125,
+23,302,410,284,135,130,125,72,197,421,475,395,282,309,575,727,
+529,382,492,644,639,471,309,326,403,488,617,801,774,599,331,108,
+113,293,397,369,257,143,98,115,80,-79,-264,-363,-409,-435,-365,-185,
+-55,-160,-361,-402,-354,-206,-145,-383,-653,-621,-342,-101,-231,-779,-1153,-924,
+-465,-316,-645,-939,-841,-587,-475,-562,-656,-556,-391,-457,-753,-865,-476,66,
+298,49,-391,-498,-213,4,-201,-574,-537,10,409,226,-243,-385,-110,188,
+179,-56,-163,154,622,785,618,376,315,524,679,435,266,519,791,811,
+650,499,499,553,628,651,470,333,530,861,925,652,300,326,622,703,
+653,671,768,702,457,243,233,370,503,461,199,-101,-230,-77,142,115,
+-71,-173,-141,-124,-284,-435,-343,-204,-213,-201,-131,-183,-326,-351,-258,-248,
+-349,-454,-637,-810,-831,-635,-456,-450,-561,-632,-710,-679,-587,-604,-682,-606,
+-449,-304,-153,-211,-443,-602,-558,-458,-444,-457,-373,-370,-409,-480,-533,-431,
+-229,-181,-259,-251,-102,-87,-188,-106,6,-129,-151,-14,40,-14,51,178,
+240,149,-35,-141,-67,28,-73,-197,-129,89,202,147,120,126,-104,-223,
+-20,249,259,228,342,403,246,99,109,236,239,-76,-289,-159,14,-56,
+-232,-333,-307,-293,-366,-429,-386,-311,-225,-81,-124,-371,-575,-474,-154,-21,
+-201,-352,-357,-216,-122,-204,-397,-480,-475,-318,-92,-36,-126,-162,-89,12,
+-45,-132,-57,70,134,102,94,61,31,118,243,225,96,93,183,155,
+-22,-157,-107,109,315,356,283,261,267,254,298,513,548,454,417,421,
+349,397,611,752,584,317,325,598,812,621,194,10,207,445,503,399,
+335,272,163,257,356,197,145,348,533,350,31,-27,228,334,-9,-351,
+-245,106,168,-46,-194,-200,-184,-134,-164,-351,-514,-274,203,270,-67,-350,
+-339,-178,-44,-151,-376,-450,-308,-190,-241,-344,-437,-339,-55,-10,-280,-466,
+-365,-143,-60,-115,-50,110,140,52,-51,-99,-31,123,97,-38,-46,16,
+54,141,140,-20,-183,-118,77,103,31,15,183,396,281,24,-81,135,
+483,568,348,251,297,417,484,347,84,7,134,307,381,249,-20,-164,
+33,262,279,76,-134,-134,-64,-40,12,98,118,-30,-185,-256,-145,-29,
+45,-64,-208,-280,-322,-222,-164,-189,-182,-142,-103,-66,-27,-98,-246,-316,
+-183,-14,-44,-137,-86,-50,-145,-287,-308,-151,-71,-215,-405,-358,-221,-145,
+-99,-65,-12,28,-43,-98,-37,14,-5,34,189,303,235,86,2,57,
+133,114,107,164,146,44,20,126,286,245,99,-33,-6,215,420,430,
+351,293,355,512,495,250,46,158,369,385,259,195,188,200,170,115,
+107,152,192,144,42,1,109,288,347,165,-10,-35,65,95,-83,-248,
+-186,-65,-45,-92,-218,-341,-456,-426,-270,-259,-369,-363,-278,-271,-375,-381,
+-214,-83,-36,-95,-195,-199,-180,-220,-220,-147,-79,-93,-164,-185,-182,-210,
+-254,-294,-226,-96,-37,-130,-286,-314,-173,-42,-17,-25,71,160,142,70,
+84,119,98,42,28,14,32,60,50,74,196,306,379,413,357,299,
+276,325,387,423,394,395,488,519,435,345,354,338,312,292,287,287,
+287,280,248,210,196,128,74,155,247,224,137,158,223,207,101,73,
+124,118,85,72,116,73,-50,-139,-218,-258,-233,-112,7,67,51,-14,
+-81,-78,-125,-186,-188,-140,-79,23,34,-101,-157,-35,34,-118,-274,-217,
+-103,-80,-185,-321,-311,-152,-2,-24,-150,-200,-135,-26,119,198,80,-65,
+-33,125,117,-39,-19,207,335,206,-45,-146,1,215,212,98,94,221,
+331,356,323,310,259,187,286,457,442,220,84,74,135,213,273,256,
+227,123,-44,-111,-107,-117,-95,-76,-86,-108,-59,66,131,65,-32,-83,
+-86,4,46,11,-156,-231,-31,183,41,-299,-445,-234,-4,-129,-399,-381,
+-147,-39,-226,-433,-385,-198,-115,-197,-316,-360,-282,-119,-124,-339,-506,-427,
+-257,-205,-342,-505,-496,-325,-144,-159,-303,-325,-193,-107,-164,-206,-116,82,
+171,51,-177,-75,224,220,-13,-169,-141,-55,56,87,2,-129,-96,47,
+134,130,137,151,135,105,144,291,464,534,388,224,206,316,382,307,
+152,33,90,289,390,337,177,102,92,124,159,94,27,80,154,103,
+45,72,143,207,137,14,-90,-142,-86,13,42,-24,-149,-209,-183,-154,
+-164,-229,-248,-184,-125,-185,-289,-263,-155,-130,-145,-79,6,-35,-227,-355,
+-314,-214,-142,-131,-214,-332,-349,-294,-186,-136,-85,-43,-18,-56,-155,-188,
+-119,-105,-44,103,149,61,-73,-66,51,113,124,143,68,-84,-198,-141,
+13,154,215,220,222,230,224,126,59,117,276,372,334,320,344,352,
+308,299,331,352,255,147,96,63,-36,-56,132,321,290,138,41,84,
+106,93,75,102,120,98,51,21,62,121,80,-21,-9,29,-28,-93,
+-175,-187,-127,-70,-84,-126,-82,-21,-82,-150,-88,74,83,-90,-216,-155,
+-103,-115,-120,-181,-261,-296,-258,-214,-230,-316,-408,-324,-197,-185,-331,-369,
+-285,-150,-73,0,59,50,61,102,61,-38,-36,7,-66,-99,43,210,
+254,150,33,34,110,143,121,108,140,146,86,50,37,47,107,162,
+185,91,-56,-127,-88,-23,-49,-101,-106,6,94,-14,-166,-86,137,155,
+24,-34,-5,52,119,147,92,37,45,113,62,-158,-322,-260,-63,18,
+-101,-299,-370,-250,-80,-38,-202,-341,-298,-134,-96,-213,-315,-244,-118,-20,
+-41,-119,-183,-137,-22,49,25,-71,-136,-141,-191,-315,-337,-215,-6,43,
+-66,-153,-99,-46,-97,-114,-34,93,92,39,21,54,27,-14,5,93,
+97,-17,-127,-75,23,68,55,73,139,191,159,52,-25,-1,112,253,
+308,236,120,113,204,314,286,175,72,63,130,142,61,32,101,120,
+140,140,154,149,80,-21,-18,124,205,99,-44,-49,48,115,72,-13,
+-53,-29,-26,-2,28,39,-8,-58,-103,-120,-98,21,105,84,-24,-9,
+79,101,79,27,-61,-40,67,133,102,-70,-158,-53,54,28,-46,-43,
+2,-39,-76,24,166,235,159,45,31,109,202,196,120,61,57,124,
+169,103,-13,-43,25,81,80,36,19,72,173,197,138,80,91,136,
+113,73,106,223,285,194,62,-3,10,78,79,41,-24,-44,-4,-6,
+-50,-97,-123,-130,-106,-105,-125,-120,-144,-132,-47,44,48,-56,-109,-101,
+-87,-131,-168,-150,-71,-28,-105,-193,-254,-229,-146,-99,-125,-196,-216,-186,
+-130,-136,-194,-202,-168,-134,-143,-206,-247,-226,-201,-218,-226,-175,-175,-239,
+-334,-346,-238,-72,-17,-54,-154,-184,-114,-17,18,-10,-22,40,119,106,
+-19,-77,-44,-14,-16,-21,-19,-26,-51,-72,-59,4,86,146,75,1,
+-2,88,141,117,99,157,184,121,5,23,119,151,72,6,-8,60,
+83,25,-21,-9,29,72,97,89,24,-28,12,26,61,100,137,101,
+-42,-112,-56,4,10,-37,-79,-79,-53,-61,-99,-145,-161,-94,-15,-5,
+-66,-100,-21,27,-46,-129,-72,31,37,-52,-138,-173,-145,-88,-97,-162,
+-197,-152,-115,-192,-282,-308,-191,-75,-39,-77,-112,-110,-84,-56,-63,-49,
+1,7,-53,-125,-120,-46,30,-34,-139,-130,-14,46,-39,-101,-76,-33,
+22,120,114,-2,-56,8,98,126,129,185,227,217,103,25,35,66,
+78,56,54,75,48,18,48,87,64,14,19,43,57,91,111,68,
+44,87,150,100,-38,-117,-120,-96,-79,-48,-30,-32,-112,-141,-82,18,
+41,-34,-94,-89,-57,13,85,127,113,70,39,25,-35,-88,-55,-6,
+-19,-87,-136,-108,-90,-140,-246,-281,-179,-35,3,-80,-162,-121,-31,-14,
+-99,-107,-49,34,45,22,-7,44,152,198,129,-32,-76,62,219,169,
+36,-11,87,161,132,49,67,163,222,205,130,96,127,173,165,91,
+61,46,40,14,-15,-12,26,50,59,33,12,25,96,141,103,35,
+35,49,37,-28,-48,-23,42,53,64,78,51,-54,-168,-163,-57,-7,
+-108,-197,-177,-111,-78,-82,-133,-189,-217,-179,-94,-63,-56,-98,-147,-167,
+-181,-199,-213,-204,-182,-175,-153,-91,-54,-82,-192,-277,-223,-49,94,67,
+-55,-108,-18,59,71,61,45,46,48,46,-7,12,79,93,19,-15,
+-1,44,38,31,42,70,98,123,153,160,175,159,152,172,234,204,
+133,98,106,139,188,196,120,29,2,29,82,165,203,142,43,5,
+50,98,127,167,179,137,72,42,36,34,-5,-60,-64,25,70,-5,
+-103,-123,-119,-117,-98,-53,-10,-20,-75,-88,-81,-55,-31,-22,-39,-64,
+-78,-33,41,19,-80,-115,-35,21,-32,-151,-174,-75,53,80,22,-20,
+-9,34,47,36,40,68,105,107,51,-1,13,94,111,5,-107,-88,
+50,134,127,92,65,84,124,144,103,16,14,123,267,268,167,81,
+113,165,100,39,29,105,128,116,60,18,-2,36,71,-3,-136,-139,
+16,142,106,-33,-110,-108,-56,-15,13,-3,-58,-141,-143,-125,-125,-146,
+-142,-92,-59,-95,-121,-96,-107,-157,-193,-154,-91,-57,-72,-128,-162,-162,
+-123,-69,-60,-147,-227,-193,-98,-74,-105,-124,-102,-99,-114,-132,-124,-127,
+-100,-34,23,18,8,33,11,-16,-1,63,116,121,54,11,-7,14,
+18,25,20,21,-6,-25,-3,26,54,87,62,15,-48,-23,57,117,
+114,104,81,106,127,93,33,-18,-14,55,100,102,34,-28,-7,56,
+96,49,29,36,48,48,19,10,67,106,80,32,-14,-29,-38,-20,
+22,26,-18,-42,-59,-58,-68,-53,-44,-38,-16,16,24,35,24,-3,
+-46,-8,41,69,63,66,43,14,5,34,49,-1,-47,-44,-15,-11,
+-16,40,68,73,37,27,42,75,94,107,132,145,128,99,70,52,
+42,35,46,24,-6,-7,14,25,30,68,83,64,17,44,90,143,
+140,124,64,31,6,42,73,33,-38,-65,-5,66,57,-10,-56,-50,
+-28,-49,-84,-106,-73,-11,23,4,-12,-22,-31,-26,-22,-23,-45,-42,
+-52,-86,-122,-138,-103,-71,-44,-53,-93,-112,-94,-77,-61,-58,-40,-14,
+21,20,15,-7,-6,25,63,93,73,38,31,31,11,9,45,83,
+59,18,-16,-6,-12,-49,-42,-3,38,60,49,6,-34,-6,79,117,
+103,55,31,9,25,22,34,53,52,45,56,101,136,138,114,94,
+59,55,52,40,47,84,145,146,66,-38,-59,-22,11,5,-8,-24,
+-10,-25,-47,-42,-62,-65,-14,34,70,40,-24,-33,40,101,87,36,
+4,18,38,37,-11,-47,-29,-14,-54,-95,-82,-68,-81,-104,-87,-42,
+-9,-8,-42,-51,-45,-6,18,11,-1,-48,-27,10,25,-64,-128,-109,
+-28,-10,-57,-128,-120,-53,17,-12,-64,-63,15,71,57,10,-7,-8,
+14,-8,-63,-59,-37,-1,-16,-54,-85,-70,-48,-45,-77,-119,-128,-88,
+-32,-25,-81,-115,-69,8,12,-71,-111,-80,-31,-7,-12,-52,-80,-76,
+-41,-31,-32,-52,-40,-4,10,-11,-19,-14,18,3,-38,-60,-56,-20,
+-13,-43,-37,-27,14,18,-42,-90,-90,-59,-49,-43,-42,-22,-10,-18,
+-53,-70,-25,41,88,74,19,-18,-6,33,71,56,40,46,56,35,
+-9,-15,17,56,57,40,21,0,-7,-9,19,34,70,99,125,111,
+70,53,71,98,112,101,80,70,49,56,34,14,15,33,40,51,
+33,40,61,65,69,79,113,140,144,112,90,92,109,126,138,115,
+96,95,100,108,76,24,-17,14,41,52,18,-9,8,17,0,-25,
+-13,23,84,83,44,-15,-37,-10,27,35,16,-16,3,26,52,41,
+1,-13,26,76,59,2,-42,-14,19,32,20,29,4,-31,-45,-25,
+-41,-60,-66,-64,-58,-92,-100,-68,-37,-37,-92,-132,-135,-81,-25,-21,
+-53,-77,-72,-34,-12,-52,-98,-90,-45,7,-5,-26,-67,-102,-124,-101,
+-74,-33,-19,-7,-24,-60,-93,-65,-6,8,-66,-98,-53,-4,-8,-25,
+-19,-27,-37,-58,-82,-99,-78,-70,-46,-41,-42,-43,-39,-27,-12,-22,
+-23,26,88,110,54,31,18,40,58,46,11,-15,-31,-41,-1,23,
+18,-25,-72,-56,-29,-2,-5,-7,-7,34,72,67,16,-5,8,17,
+36,58,70,40,-35,-56,-23,34,47,25,3,-36,-43,-21,-3,19,
+14,23,60,86,68,29,36,66,80,45,-6,-8,-3,25,13,25,
+54,74,62,27,-14,-22,7,39,74,77,74,76,75,66,68,67,
+60,37,39,53,81,90,86,112,96,63,64,103,120,89,68,86,
+150,186,155,101,70,98,119,139,144,131,93,68,58,43,28,23,
+33,31,21,0,18,41,46,20,19,-7,-6,17,72,88,82,58,
+35,40,55,49,34,13,9,4,25,7,-24,-47,-44,-63,-91,-81,
+-76,-66,-98,-73,-28,23,-16,-102,-136,-109,-70,-62,-64,-78,-85,-83,
+-95,-79,-87,-97,-87,-81,-54,-35,-27,-42,-42,-11,9,0,0,-10,
+-19,1,14,25,-7,-20,-66,-64,-50,-23,-20,-52,-32,17,42,6,
+-60,-85,-45,11,33,-5,-13,1,39,33,34,23,27,35,52,12,
+-36,-33,-19,17,20,28,33,34,16,-8,-31,-16,21,59,38,-15,
+-27,22,65,41,-30,-98,-110,-73,-49,-61,-108,-164,-157,-122,-85,-100,
+-144,-151,-119,-65,-58,-60,-66,-79,-38,-6,15,10,-13,-30,-25,-15,
+-8,-5,-21,-34,-43,-74,-71,-65,-44,-61,-49,-41,-20,6,12,-8,
+-40,-9,33,69,53,44,38,71,90,87,42,20,28,48,58,48,
+41,58,70,71,46,48,57,66,70,62,85,97,80,68,74,75,
+69,74,73,71,44,48,32,40,12,1,14,29,14,-27,-61,-59,
+-7,3,-17,-16,4,-13,-55,-70,-76,-58,-68,-74,-56,-40,-24,-47,
+-74,-85,-83,-69,-37,-23,-10,-11,-31,-14,-17,-5,-11,-43,-91,-76,
+-42,-13,-39,-59,-64,-55,-22,-46,-61,-62,-65,-57,-15,24,9,-37,
+-11,31,61,31,46,85,126,131,87,60,44,61,64,64,57,44,
+45,49,89,101,100,97,74,39,5,25,63,97,79,70,60,55,
+40,9,-9,-4,27,53,33,17,1,19,33,39,11,-22,-55,-41,
+-19,0,37,47,17,-12,-12,18,9,-31,-70,-47,4,11,-53,-95,
+-97,-98,-101,-105,-96,-84,-88,-102,-77,-93,-97,-87,-53,-52,-41,-59,
+-65,-45,-24,-13,2,15,13,10,-7,-12,4,23,39,32,-2,-8,
+21,53,46,28,16,29,67,69,73,50,57,49,47,21,-17,-39,
+-9,-8,-2,-13,-8,-1,37,18,26,31,52,68,62,43,18,16,
+45,72,79,54,28,21,8,-11,10,17,38,39,29,8,6,7,
+0,-2,-43,-39,-41,-16,-13,-8,-4,-19,-9,-7,-25,-73,-91,-85,
+-65,-50,-67,-53,-73,-97,-94,-58,-38,-37,-49,-51,-37,-27,-5,5,
+-10,-34,-42,-20,-8,-12,13,29,11,-13,-13,-7,-7,-36,-29,5,
+52,47,30,13,-7,5,20,42,51,40,54,70,74,24,4,20,
+47,39,23,9,-2,9,7,35,48,46,39,34,35,43,60,65,
+52,36,36,34,35,6,-22,-6,22,-4,-47,-59,-36,-37,-66,-78,
+-69,-73,-85,-78,-62,-55,-38,-18,-16,-17,-17,-17,1,46,41,29,
+10,2,-1,-6,-32,-36,-23,-7,9,-11,-13,6,23,24,-3,-7,
+-10,10,17,26,18,37,33,35,33,26,24,8,6,-2,41,74,
+63,46,38,33,63,78,90,75,82,89,88,100,97,98,103,109,
+97,78,70,76,78,55,32,33,49,61,44,24,41,82,90,75,
+20,16,1,12,10,-2,3,-12,-28,-39,-49,-40,-44,-49,-64,-47,
+-62,-89,-93,-60,-40,-34,-60,-75,-70,-60,-31,-30,-46,-63,-64,-62,
+-75,-98,-99,-93,-74,-71,-92,-102,-105,-85,-79,-73,-84,-72,-25,-12,
+-47,-53,-27,5,19,-4,-28,-16,-12,-8,-19,-29,1,25,12,-27,
+-56,-56,-60,-47,-20,2,7,13,-4,-15,-11,2,19,35,41,16,
+16,36,57,55,27,5,15,13,10,-21,-38,-22,11,14,9,-13,
+-24,-15,-6,-3,-2,-8,3,8,27,6,-4,-17,-2,-2,-22,-49,
+-47,-30,-16,-33,-57,-58,-20,-12,-21,-45,-37,-39,-37,-24,-20,-21,
+-31,-29,-2,10,12,-16,-18,-20,-8,-15,-4,8,7,-6,-27,-27,
+-22,-12,19,25,23,25,34,30,13,14,21,34,45,40,24,15,
+10,25,29,37,19,14,12,36,42,24,25,45,43,36,37,47,
+54,54,72,72,70,71,79,92,76,54,29,39,49,36,18,24,
+43,69,47,40,36,17,14,-7,2,18,27,20,2,-14,-13,-23,
+-40,-52,-61,-66,-44,-36,-42,-49,-66,-44,-49,-38,-36,-31,-23,-18,
+-1,-2,-9,-34,-38,-38,-33,-27,-29,-21,-24,-39,-47,-68,-70,-75,
+-82,-72,-58,-51,-47,-45,-40,-48,-50,-26,-37,-24,-42,-57,-62,-57,
+-46,-37,-48,-38,-50,-59,-76,-60,-32,-24,-38,-35,-36,-24,-31,-32,
+-26,5,12,11,-5,-27,-35,-46,-54,-61,-46,-31,-36,-51,-67,-57,
+-55,-51,-71,-69,-52,-28,-26,-32,-27,-17,3,19,18,11,-11,-17,
+-23,-4,13,26,2,-20,-35,-31,-19,-16,-3,2,0,-10,-15,-3,
+-23,-32,-33,-25,-10,-11,-9,-8,6,-2,-22,-23,-13,-25,-47,-38,
+-22,4,-1,3,4,-1,-4,-4,-11,-5,17,36,46,22,-1,4,
+41,53,27,2,7,25,40,46,51,44,35,29,25,36,23,14,
+24,23,15,3,5,9,-1,-8,0,1,13,-2,-25,-32,-26,-5,
+-14,-14,-18,-25,-4,16,25,22,23,38,57,61,33,28,4,22,
+21,46,36,14,-28,-33,-14,4,-1,-15,-29,-37,-45,-46,-24,-9,
+11,12,19,30,24,8,2,17,29,32,47,36,12,1,7,14,
+1,-14,-24,-30,-36,-48,-29,-2,1,-6,-8,-16,-22,-9,12,34,
+25,-3,-24,-9,-2,-14,-27,-28,-5,-16,-28,-37,-35,-1,23,13,
+-4,5,10,21,4,7,28,62,75,52,22,9,12,20,51,64,
+63,37,36,38,37,11,14,20,13,2,-18,-21,-4,21,34,30,
+17,6,7,-15,-18,-2,43,69,61,46,40,34,36,23,39,64,
+64,73,69,65,43,32,24,30,28,30,15,3,17,30,34,20,
+-8,-33,-39,-21,-13,5,18,34,32,26,18,19,19,31,45,50,
+19,-1,4,8,1,-16,-14,-27,-26,-61,-59,-58,-22,-2,7,-22,
+-39,-47,-48,-52,-38,-22,-7,2,-9,-38,-28,-28,-19,-29,-31,-20,
+-33,-43,-44,-49,-68,-62,-57,-54,-57,-72,-70,-54,-28,-20,-30,-37,
+-25,-21,-20,-24,-17,4,19,18,-11,-50,-51,-20,11,-15,-31,-44,
+-29,-23,-26,-33,-54,-38,-17,-1,-4,-18,-35,-24,-14,0,-18,-18,
+-37,-46,-59,-56,-49,-39,-39,-21,-34,-33,-19,-14,-13,-8,-23,-35,
+-24,-5,5,18,12,20,25,19,7,10,3,-9,-8,10,15,19,
+12,10,16,25,28,28,22,20,24,27,19,34,36,27,20,35,
+32,48,63,68,66,74,48,
+0,
+// firehit
+20,35,41,42,37,43,43,44,40,33,30,28,30,39,34,43,
+33,28,25,31,36,29,20,3,16,28,47,66,81,71,42,-46,
+-126,-235,-393,-580,-811,-1034,-1244,-1418,-1538,-1570,-1520,-1351,-1075,-691,-256,247,
+795,1376,1986,2607,3250,3895,4576,5256,5934,6553,7145,7688,8124,8439,8645,8696,
+8584,8304,7859,7227,6470,5584,4627,3592,2545,1501,464,-510,-1423,-2277,-3046,-3736,
+-4349,-4906,-5372,-5787,-6173,-6540,-6909,-7263,-7622,-7959,-8284,-8566,-8786,-8985,-9121,-9228,
+-9277,-9288,-9260,-9186,-9092,-8984,-8875,-8794,-8736,-8723,-8758,-8826,-8888,-8960,-9030,-9083,
+-9149,-9171,-9187,-9153,-9073,-8975,-8799,-8600,-8359,-8118,-7852,-7592,-7350,-7125,-6927,-6741,
+-6542,-6351,-6129,-5899,-5659,-5375,-5079,-4736,-4353,-3954,-3553,-3144,-2726,-2330,-1962,-1630,
+-1314,-1035,-753,-511,-254,-11,269,561,872,1220,1580,1966,2356,2783,3233,3714,
+4270,4913,5665,6527,7516,8599,9768,10978,12234,13530,14899,16383,17992,19762,21660,23603,
+25551,27402,29080,30477,31534,32175,32393,32126,31409,30247,28723,26902,24930,22896,20925,19097,
+17483,16091,14915,13910,13016,12162,11286,10348,9318,8163,6899,5555,4162,2754,1405,155,
+-948,-1914,-2724,-3374,-3925,-4406,-4870,-5311,-5805,-6342,-6934,-7568,-8237,-8872,-9458,-9927,
+-10262,-10476,-10530,-10448,-10236,-9931,-9570,-9198,-8848,-8538,-8305,-8137,-8044,-8023,-8045,-8114,
+-8205,-8299,-8384,-8440,-8439,-8375,-8235,-8046,-7816,-7574,-7351,-7164,-7056,-6999,-7020,-7098,
+-7205,-7340,-7473,-7616,-7720,-7781,-7799,-7750,-7623,-7434,-7192,-6918,-6640,-6373,-6124,-5883,
+-5702,-5547,-5421,-5303,-5178,-5006,-4832,-4630,-4383,-4113,-3813,-3478,-3145,-2832,-2532,-2253,
+-2021,-1818,-1654,-1513,-1398,-1304,-1214,-1133,-1047,-983,-909,-837,-760,-709,-635,-565,
+-505,-439,-402,-356,-341,-332,-328,-332,-334,-363,-378,-383,-418,-467,-499,-503,
+-465,-403,-308,-164,21,238,449,658,839,1006,1169,1322,1451,1565,1691,1795,
+1909,2044,2207,2416,2666,2954,3245,3541,3776,3986,4145,4254,4335,4383,4445,4502,
+4605,4744,4925,5173,5479,5832,6255,6695,7145,7593,7982,8331,8602,8765,8835,8802,
+8687,8487,8224,7877,7488,7071,6620,6164,5687,5207,4688,4138,3528,2854,2100,1296,
+438,-418,-1257,-2042,-2747,-3348,-3834,-4201,-4483,-4645,-4762,-4809,-4872,-4983,-5120,-5341,
+-5623,-5990,-6402,-6845,-7262,-7619,-7906,-8096,-8194,-8188,-8095,-7941,-7744,-7521,-7321,-7153,
+-7011,-6929,-6897,-6905,-6937,-6981,-7026,-7041,-7000,-6933,-6792,-6581,-6294,-5966,-5595,-5207,
+-4802,-4406,-4009,-3624,-3250,-2874,-2482,-2093,-1689,-1281,-870,-434,-5,422,845,1227,
+1598,1937,2231,2533,2793,3057,3290,3505,3706,3873,4024,4132,4209,4275,4365,4428,
+4518,4612,4736,4873,5027,5191,5359,5505,5640,5741,5747,5681,5523,5264,4926,4509,
+4028,3531,3014,2524,2075,1680,1341,1079,887,746,646,599,583,587,613,646,
+685,726,776,820,878,947,1038,1152,1277,1418,1563,1694,1826,1933,2010,2088,
+2131,2136,2136,2116,2072,2025,1951,1870,1770,1678,1592,1540,1501,1488,1511,1558,
+1602,1660,1711,1735,1742,1718,1657,1522,1333,1069,769,406,26,-336,-715,-1046,
+-1342,-1598,-1798,-1923,-1992,-1987,-1918,-1799,-1658,-1478,-1304,-1137,-972,-806,-645,-495,
+-370,-256,-177,-125,-111,-148,-210,-306,-458,-644,-848,-1053,-1263,-1472,-1667,-1860,
+-2039,-2221,-2406,-2579,-2767,-2932,-3083,-3226,-3344,-3470,-3601,-3738,-3885,-4063,-4277,-4515,
+-4797,-5069,-5348,-5632,-5910,-6161,-6368,-6526,-6620,-6659,-6664,-6616,-6550,-6468,-6379,-6309,
+-6263,-6240,-6233,-6223,-6228,-6242,-6262,-6249,-6209,-6144,-6052,-5919,-5745,-5553,-5337,-5112,
+-4875,-4628,-4380,-4130,-3883,-3654,-3451,-3233,-3034,-2834,-2642,-2410,-2151,-1856,-1548,-1193,
+-784,-322,158,664,1190,1731,2268,2798,3317,3815,4296,4769,5224,5675,6124,6553,
+7005,7419,7857,8288,8754,9218,9708,10250,10887,11682,12658,13865,15291,16839,18443,19965,
+21317,22429,23232,23708,23819,23591,23023,22135,20944,19527,17975,16382,14814,13334,11997,10835,
+9805,8940,8175,7491,6835,6168,5482,4748,3961,3131,2291,1466,674,-49,-668,-1185,
+-1573,-1874,-2073,-2261,-2451,-2669,-2974,-3387,-3917,-4556,-5266,-6022,-6768,-7485,-8111,-8649,
+-9055,-9352,-9542,-9644,-9690,-9693,-9702,-9717,-9774,-9874,-10036,-10219,-10441,-10652,-10811,-10906,
+-10896,-10805,-10609,-10337,-10009,-9644,-9265,-8917,-8591,-8295,-8051,-7844,-7680,-7548,-7427,-7321,
+-7200,-7054,-6881,-6666,-6443,-6189,-5943,-5687,-5442,-5192,-4973,-4732,-4484,-4212,-3947,-3692,
+-3436,-3194,-2967,-2757,-2560,-2355,-2156,-1979,-1813,-1656,-1520,-1396,-1264,-1145,-995,-841,
+-655,-466,-268,-68,138,326,504,672,844,996,1155,1312,1483,1639,1804,1970,
+2175,2417,2682,2954,3266,3579,3889,4179,4442,4682,4896,5066,5181,5273,5351,5399,
+5425,5449,5457,5454,5464,5460,5464,5445,5361,5231,5049,4792,4473,4095,3693,3253,
+2821,2415,2061,1765,1540,1394,1294,1251,1218,1219,1183,1131,1021,912,727,505,
+251,-1,-262,-504,-691,-816,-893,-908,-881,-840,-795,-744,-732,-725,-736,-775,
+-836,-914,-1013,-1116,-1241,-1374,-1521,-1664,-1806,-1935,-2059,-2146,-2224,-2277,-2301,-2328,
+-2322,-2292,-2279,-2236,-2214,-2176,-2146,-2138,-2147,-2182,-2252,-2349,-2454,-2580,-2702,-2832,
+-2959,-3103,-3246,-3397,-3581,-3765,-3962,-4156,-4366,-4534,-4687,-4817,-4900,-4939,-4956,-4952,
+-4884,-4808,-4703,-4594,-4470,-4349,-4213,-4076,-3933,-3789,-3607,-3413,-3205,-2958,-2696,-2425,
+-2131,-1840,-1544,-1244,-933,-620,-308,30,338,657,966,1260,1535,1779,1992,2170,
+2327,2443,2551,2641,2745,2872,3031,3215,3431,3657,3885,4111,4348,4587,4807,5028,
+5259,5516,5804,6121,6549,7065,7693,8411,9221,10100,11023,11923,12788,13558,14200,14703,
+15041,15206,15226,15091,14829,14476,14062,13620,13164,12686,12216,11753,11288,10813,10337,9833,
+9291,8711,8105,7457,6802,6115,5438,4768,4122,3515,2900,2310,1750,1197,642,92,
+-471,-1036,-1595,-2171,-2728,-3283,-3831,-4356,-4873,-5355,-5815,-6244,-6649,-7013,-7334,-7612,
+-7859,-8054,-8221,-8350,-8448,-8521,-8572,-8609,-8637,-8652,-8672,-8666,-8666,-8628,-8575,-8498,
+-8393,-8277,-8141,-7972,-7776,-7561,-7349,-7110,-6859,-6574,-6273,-5953,-5611,-5259,-4891,-4541,
+-4202,-3891,-3610,-3339,-3122,-2925,-2763,-2626,-2512,-2405,-2310,-2216,-2112,-1974,-1797,-1630,
+-1415,-1188,-973,-751,-559,-400,-277,-171,-106,-55,-26,-7,11,80,174,292,
+432,591,757,920,1048,1148,1212,1254,1257,1243,1207,1157,1110,1041,993,941,
+920,910,904,887,849,782,693,582,480,380,283,193,113,24,-62,-132,
+-221,-307,-391,-472,-544,-639,-731,-843,-952,-1066,-1186,-1318,-1448,-1575,-1677,-1766,
+-1842,-1883,-1893,-1879,-1850,-1796,-1709,-1603,-1469,-1330,-1204,-1093,-974,-866,-761,-667,
+-580,-493,-404,-265,-121,25,169,321,483,627,752,854,912,926,890,802,
+652,456,227,-64,-358,-667,-974,-1247,-1475,-1663,-1808,-1898,-1957,-1995,-2025,-2005,
+-2002,-2009,-2023,-2006,-1976,-1925,-1842,-1726,-1558,-1327,-1064,-734,-390,4,379,794,
+1195,1581,1930,2244,2496,2674,2778,2809,2779,2682,2528,2332,2104,1834,1550,1249,
+943,653,348,50,-250,-545,-827,-1093,-1338,-1539,-1697,-1796,-1857,-1873,-1853,-1799,
+-1698,-1570,-1423,-1266,-1120,-981,-849,-730,-617,-537,-446,-362,-260,-131,41,230,
+473,745,1068,1413,1777,2150,2547,2961,3372,3792,4235,4681,5140,5579,6040,6492,
+6943,7369,7763,8086,8352,8551,8714,8818,8890,8910,8908,8864,8804,8737,8606,8448,
+8264,8058,7814,7564,7299,7001,6685,6318,5919,5494,5065,4609,4129,3639,3143,2627,
+2089,1505,922,351,-196,-719,-1220,-1689,-2147,-2576,-3006,-3439,-3867,-4315,-4734,-5142,
+-5510,-5850,-6159,-6442,-6688,-6890,-7092,-7256,-7389,-7514,-7630,-7765,-7913,-8096,-8314,-8555,
+-8792,-9040,-9288,-9509,-9713,-9883,-10004,-10086,-10109,-10081,-9998,-9878,-9724,-9540,-9346,-9156,
+-8982,-8815,-8667,-8556,-8464,-8383,-8319,-8253,-8189,-8127,-8050,-7943,-7824,-7680,-7504,-7322,
+-7130,-6961,-6778,-6622,-6467,-6349,-6237,-6146,-6038,-5942,-5839,-5699,-5535,-5352,-5145,-4908,
+-4656,-4387,-4115,-3846,-3563,-3288,-3020,-2740,-2491,-2255,-2010,-1784,-1559,-1330,-1094,-860,
+-619,-367,-78,211,516,850,1185,1528,1893,2251,2650,3051,3462,3899,4353,4832,
+5348,5891,6465,7074,7693,8347,9052,9748,10480,11239,12022,12851,13735,14727,15791,16913,
+18095,19266,20371,21305,22061,22569,22808,22769,22452,21868,21056,20079,18983,17862,16752,15725,
+14779,13963,13268,12657,12116,11590,11055,10447,9754,8966,8093,7153,6157,5142,4146,3229,
+2403,1682,1092,611,254,-32,-264,-474,-679,-892,-1153,-1461,-1817,-2210,-2664,-3123,
+-3569,-3970,-4355,-4659,-4923,-5131,-5314,-5482,-5626,-5797,-5976,-6168,-6396,-6670,-6984,-7305,
+-7618,-7907,-8153,-8359,-8485,-8539,-8519,-8432,-8288,-8104,-7896,-7682,-7500,-7337,-7223,-7153,
+-7115,-7114,-7114,-7132,-7125,-7092,-7004,-6894,-6755,-6575,-6378,-6168,-5978,-5801,-5634,-5488,
+-5376,-5266,-5168,-5075,-4983,-4858,-4701,-4503,-4269,-3990,-3679,-3358,-3002,-2655,-2303,-1982,
+-1679,-1407,-1150,-944,-732,-550,-354,-178,40,279,557,872,1216,1565,1902,2225,
+2520,2779,2990,3171,3327,3469,3599,3739,3892,4060,4259,4498,4795,5113,5480,5910,
+6379,6876,7363,7860,8311,8733,9068,9321,9462,9469,9353,9113,8766,8311,7765,7168,
+6551,5947,5337,4767,4241,3742,3273,2813,2379,1946,1520,1082,657,234,-158,-532,
+-880,-1184,-1450,-1675,-1856,-2011,-2138,-2245,-2320,-2373,-2423,-2463,-2498,-2513,-2510,-2494,
+-2451,-2394,-2332,-2261,-2175,-2089,-1990,-1872,-1764,-1675,-1591,-1521,-1469,-1466,-1490,-1546,
+-1625,-1741,-1881,-2038,-2217,-2425,-2624,-2817,-2992,-3157,-3288,-3404,-3493,-3586,-3684,-3789,
+-3886,-3980,-4098,-4215,-4354,-4499,-4659,-4807,-4952,-5098,-5232,-5354,-5437,-5492,-5517,-5523,
+-5496,-5477,-5438,-5388,-5350,-5305,-5294,-5296,-5299,-5311,-5332,-5342,-5350,-5358,-5341,-5289,
+-5222,-5130,-5026,-4911,-4801,-4660,-4555,-4454,-4367,-4272,-4183,-4097,-3992,-3891,-3768,-3627,
+-3452,-3255,-3027,-2798,-2537,-2275,-2008,-1730,-1442,-1145,-842,-530,-212,133,465,805,
+1139,1479,1830,2179,2530,2872,3206,3555,3894,4215,4544,4855,5153,5442,5707,5939,
+6114,6235,6341,6396,6433,6441,6432,6399,6342,6278,6184,6081,5975,5906,5862,5849,
+5871,5924,5995,6084,6170,6252,6307,6339,6340,6299,6217,6081,5899,5688,5434,5165,
+4886,4612,4350,4101,3877,3660,3446,3216,2977,2726,2461,2207,1919,1623,1347,1084,
+815,571,324,106,-83,-258,-403,-543,-666,-802,-944,-1095,-1264,-1420,-1585,-1731,
+-1855,-1956,-2040,-2094,-2127,-2147,-2164,-2186,-2214,-2250,-2322,-2411,-2529,-2675,-2833,-2987,
+-3123,-3240,-3333,-3426,-3474,-3505,-3531,-3531,-3544,-3531,-3526,-3513,-3485,-3460,-3422,-3400,
+-3346,-3304,-3234,-3138,-3013,-2888,-2739,-2576,-2382,-2187,-1977,-1768,-1571,-1360,-1156,-971,
+-801,-646,-509,-387,-286,-226,-167,-135,-114,-90,-63,-22,13,64,114,190,
+277,389,500,631,767,919,1071,1231,1377,1528,1669,1825,1960,2109,2248,2400,
+2533,2697,2845,3016,3188,3368,3581,3826,4075,4359,4655,4981,5301,5624,5924,6231,
+6462,6681,6822,6913,6916,6853,6737,6537,6315,6027,5712,5348,4966,4541,4118,3698,
+3283,2887,2514,2171,1865,1587,1348,1150,983,849,756,695,647,607,579,586,
+610,633,682,752,849,944,1044,1119,1191,1205,1173,1098,964,786,542,265,
+-58,-425,-812,-1192,-1589,-1963,-2329,-2700,-3085,-3442,-3788,-4109,-4405,-4680,-4929,-5152,
+-5337,-5496,-5623,-5758,-5856,-5985,-6089,-6219,-6334,-6461,-6581,-6719,-6845,-6997,-7134,-7260,
+-7339,-7436,-7488,-7518,-7525,-7518,-7488,-7446,-7392,-7315,-7236,-7145,-7043,-6935,-6827,-6714,
+-6596,-6462,-6319,-6183,-6026,-5847,-5632,-5432,-5230,-5014,-4801,-4580,-4380,-4185,-4011,-3843,
+-3682,-3532,-3404,-3293,-3186,-3046,-2922,-2769,-2561,-2325,-2057,-1753,-1437,-1101,-761,-421,
+-98,199,485,760,1015,1288,1561,1843,2153,2465,2817,3197,3576,3969,4358,4726,
+5058,5313,5527,5649,5700,5703,5641,5530,5385,5220,5068,4939,4841,4793,4801,4845,
+4914,5012,5106,5207,5306,5390,5459,5532,5603,5667,5753,5852,5956,6089,6205,6352,
+6521,6671,6793,6894,6988,7043,7060,7041,6985,6899,6762,6577,6354,6076,5749,5363,
+4939,4474,4022,3574,3138,2710,2316,1942,1572,1216,865,537,216,-126,-443,-745,
+-1058,-1368,-1655,-1940,-2206,-2473,-2718,-2943,-3150,-3342,-3526,-3724,-3906,-4068,-4232,-4396,
+-4544,-4686,-4816,-4902,-5008,-5100,-5196,-5263,-5361,-5439,-5520,-5598,-5638,-5675,-5675,-5672,
+-5615,-5545,-5435,-5320,-5205,-5070,-4935,-4807,-4681,-4555,-4411,-4260,-4096,-3922,-3738,-3528,
+-3336,-3123,-2933,-2739,-2588,-2435,-2305,-2208,-2120,-2047,-1980,-1907,-1833,-1771,-1711,-1627,
+-1558,-1520,-1492,-1496,-1494,-1524,-1544,-1559,-1571,-1583,-1588,-1577,-1555,-1519,-1473,-1407,
+-1345,-1277,-1217,-1164,-1096,-1028,-948,-842,-729,-612,-452,-281,-88,121,323,532,
+734,934,1149,1373,1592,1806,2023,2261,2493,2722,2944,3153,3347,3550,3741,3927,
+4089,4216,4330,4405,4466,4502,4536,4560,4592,4626,4693,4773,4904,5069,5278,5512,
+5774,6050,6324,6590,6835,7027,7173,7261,7297,7263,7166,7026,6824,6606,6361,6088,
+5831,5579,5321,5078,4830,4573,4317,4043,3742,3443,3140,2816,2488,2141,1810,1476,
+1148,822,517,251,16,-208,-415,-637,-866,-1115,-1397,-1707,-2047,-2390,-2730,-3066,
+-3387,-3666,-3926,-4145,-4306,-4435,-4519,-4569,-4585,-4571,-4565,-4561,-4580,-4600,-4644,-4681,
+-4722,-4763,-4782,-4797,-4783,-4747,-4675,-4575,-4414,-4256,-4047,-3831,-3590,-3346,-3085,-2844,
+-2608,-2402,-2209,-2027,-1853,-1710,-1572,-1431,-1277,-1122,-956,-767,-550,-312,-50,215,
+514,810,1131,1444,1754,2031,2293,2523,2737,2936,3103,3244,3380,3509,3643,3752,
+3843,3909,3959,3981,3956,3898,3789,3665,3489,3305,3093,2850,2589,2329,2040,1729,
+1419,1101,804,499,200,-79,-317,-535,-721,-878,-991,-1091,-1155,-1194,-1221,-1207,
+-1185,-1135,-1074,-995,-901,-789,-670,-555,-421,-317,-212,-126,-38,28,102,165,
+256,350,457,572,695,831,937,1053,1134,1199,1236,1256,1275,1279,1282,1283,
+1294,1310,1342,1399,1473,1568,1679,1811,1943,2072,2194,2301,2388,2492,2555,2614,
+2675,2711,2748,2779,2811,2833,2862,2907,2959,3007,3067,3131,3183,3223,3246,3243,
+3212,3162,3057,2905,2734,2521,2289,2043,1765,1481,1183,885,572,281,-20,-296,
+-560,-803,-1049,-1269,-1472,-1653,-1836,-2024,-2205,-2370,-2542,-2704,-2879,-3044,-3214,-3379,
+-3527,-3680,-3808,-3923,-4028,-4132,-4199,-4261,-4307,-4377,-4433,-4509,-4593,-4673,-4764,-4869,
+-4950,-5044,-5113,-5174,-5212,-5247,-5246,-5237,-5201,-5161,-5083,-5019,-4943,-4883,-4845,-4814,
+-4791,-4799,-4828,-4872,-4931,-4991,-5072,-5144,-5205,-5251,-5289,-5274,-5226,-5154,-5067,-4954,
+-4817,-4684,-4547,-4407,-4270,-4138,-4022,-3907,-3798,-3704,-3604,-3517,-3415,-3314,-3184,-3068,
+-2930,-2757,-2575,-2387,-2202,-1991,-1774,-1563,-1365,-1188,-1011,-839,-711,-583,-497,-437,
+-367,-306,-247,-170,-100,10,118,251,387,522,677,812,966,1146,1295,1458,
+1631,1822,2011,2199,2378,2568,2752,2942,3098,3244,3359,3447,3512,3572,3605,3631,
+3640,3643,3635,3615,3621,3645,3681,3747,3833,3928,4031,4115,4174,4207,4180,4109,
+4012,3869,3687,3452,3204,2936,2674,2413,2175,1964,1778,1616,1471,1331,1212,1079,
+925,764,609,456,307,182,55,-45,-101,-140,-156,-148,-120,-81,-20,30,
+93,146,189,228,251,276,302,320,339,359,382,406,435,453,475,526,
+571,635,689,757,832,905,969,1037,1103,1168,1235,1289,1333,1417,1496,1583,
+1683,1812,1947,2097,2247,2400,2549,2684,2799,2899,2994,3074,3155,3245,3373,3509,
+3679,3871,4134,4423,4747,5102,5461,5843,6204,6529,6821,7073,7269,7401,7463,7463,
+7390,7237,7030,6753,6422,6037,5624,5174,4696,4202,3719,3227,2716,2210,1689,1169,
+641,101,-434,-969,-1476,-1974,-2433,-2832,-3191,-3518,-3818,-4073,-4320,-4545,-4759,-4994,
+-5222,-5456,-5647,-5856,-6060,-6242,-6385,-6501,-6572,-6623,-6626,-6601,-6556,-6497,-6428,-6345,
+-6241,-6146,-6046,-5963,-5858,-5739,-5605,-5457,-5276,-5085,-4870,-4622,-4368,-4090,-3806,-3523,
+-3245,-2999,-2764,-2583,-2424,-2301,-2203,-2158,-2125,-2117,-2099,-2064,-2026,-1958,-1873,-1768,
+-1655,-1540,-1433,-1315,-1216,-1113,-1048,-991,-960,-919,-886,-837,-780,-699,-582,-423,
+-244,-40,175,394,609,802,988,1159,1323,1429,1545,1591,1634,1676,1667,1682,
+1676,1656,1646,1629,1603,1563,1519,1466,1373,1266,1135,997,843,683,518,363,
+229,106,21,-49,-80,-73,-49,-11,47,111,185,268,358,470,602,791,
+1021,1306,1643,2042,2493,2980,3522,4091,4667,5229,5783,6301,6777,7218,7600,7932,
+8201,8419,8584,8698,8752,8764,8727,8648,8545,8398,8208,7975,7717,7428,7118,6783,
+6400,6004,5582,5115,4636,4131,3604,3069,2536,2000,1487,986,523,56,-385,-805,
+-1206,-1595,-1971,-2318,-2665,-2961,-3266,-3537,-3785,-4011,-4215,-4399,-4568,-4712,-4848,-4990,
+-5127,-5252,-5368,-5497,-5599,-5695,-5781,-5850,-5883,-5916,-5943,-5948,-5960,-5971,-5995,-6019,
+-6044,-6062,-6107,-6157,-6198,-6223,-6236,-6258,-6250,-6231,-6191,-6130,-6050,-5947,-5837,-5706,
+-5568,-5403,-5238,-5081,-4917,-4747,-4587,-4425,-4283,-4140,-3989,-3832,-3673,-3518,-3339,-3145,
+-2927,-2696,-2442,-2188,-1916,-1648,-1353,-1076,-775,-477,-192,72,300,514,683,827,
+966,1047,1131,1193,1267,1332,1397,1466,1529,1633,1711,1820,1904,1987,2070,2135,
+2193,2256,2316,2363,2406,2487,2577,2680,2769,2896,3036,3188,3358,3541,3723,3918,
+4118,4315,4515,4673,4821,4943,5053,5093,5079,5010,4873,4704,4469,4216,3934,3639,
+3312,3009,2700,2417,2140,1876,1634,1399,1168,936,731,519,323,146,-27,-184,
+-337,-444,-548,-666,-748,-844,-941,-1028,-1112,-1189,-1284,-1355,-1427,-1481,-1562,-1626,
+-1728,-1804,-1878,-1957,-2016,-2066,-2111,-2125,-2127,-2116,-2107,-2068,-2022,-1981,-1938,-1906,
+-1848,-1820,-1790,-1749,-1722,-1700,-1677,-1648,-1610,-1559,-1499,-1437,-1354,-1265,-1193,-1110,
+-1034,-981,-941,-907,-908,-956,-1007,-1102,-1194,-1310,-1412,-1521,-1618,-1681,-1712,-1724,
+-1705,-1651,-1568,-1474,-1329,-1201,-1061,-916,-775,-626,-496,-343,-225,-114,-17,61,
+143,217,307,393,470,560,635,710,757,792,801,772,707,634,526,403,
+269,143,9,-104,-209,-269,-331,-365,-376,-379,-349,-294,-232,-148,-49,72,
+214,363,549,742,959,1192,1443,1683,1929,2199,2449,2703,2944,3163,3390,3604,
+3807,3994,4173,4355,4515,4675,4807,4944,5045,5121,5148,5139,5074,4967,4810,4606,
+4352,4091,3808,3527,3232,2942,2663,2396,2111,1831,1540,1264,983,702,421,167,
+-70,-277,-456,-613,-718,-787,-832,-853,-842,-808,-769,-709,-660,-592,-538,-471,
+-379,-308,-252,-212,-175,-160,-157,-156,-162,-163,-166,-175,-183,-185,-199,-233,
+-310,-418,-557,-733,-941,-1182,-1450,-1732,-2025,-2305,-2569,-2824,-3066,-3273,-3482,-3656,
+-3826,-3983,-4138,-4270,-4388,-4496,-4579,-4651,-4707,-4742,-4761,-4742,-4708,-4655,-4584,-4494,
+-4415,-4303,-4183,-4036,-3885,-3717,-3515,-3295,-3050,-2799,-2546,-2275,-2007,-1722,-1440,-1167,
+-896,-636,-387,-167,51,230,395,551,668,789,886,988,1095,1208,1332,1471,
+1630,1800,2005,2191,2413,2651,2887,3134,3392,3645,3884,4120,4380,4611,4877,5144,
+5438,5762,6103,6451,6791,7091,7368,7609,7744,7779,7725,7578,7340,7024,6620,6183,
+5728,5271,4831,4431,4085,3783,3536,3352,3205,3080,2995,2891,2771,2648,2468,2288,
+2062,1811,1544,1257,970,654,358,84,-170,-403,-625,-823,-1022,-1203,-1398,-1604,
+-1826,-2073,-2320,-2572,-2855,-3135,-3407,-3658,-3898,-4135,-4331,-4513,-4644,-4769,-4876,-4965,
+-5038,-5105,-5179,-5245,-5333,-5402,-5470,-5518,-5548,-5571,-5575,-5547,-5498,-5427,-5325,-5215,
+-5087,-4977,-4836,-4710,-4569,-4446,-4334,-4230,-4139,-4064,-4012,-3968,-3923,-3870,-3807,-3758,
+-3671,-3603,-3516,-3416,-3302,-3171,-3061,-2944,-2810,-2691,-2567,-2453,-2335,-2241,-2147,-2066,
+-1993,-1911,-1831,-1758,-1672,-1578,-1483,-1378,-1278,-1180,-1077,-981,-890,-802,-739,-678,
+-634,-583,-538,-497,-454,-398,-333,-255,-174,-70,35,132,236,358,482,593,
+723,856,998,1143,1289,1444,1601,1767,1933,2107,2293,2474,2652,2847,3040,3234,
+3439,3639,3875,4119,4387,4675,5005,5353,5713,6120,6528,6939,7335,7720,8063,8355,
+8581,8756,8863,8915,8909,8840,8746,8588,8407,8204,7980,7738,7502,7252,7007,6753,
+6469,6172,5849,5505,5118,4739,4339,3935,3525,3118,2704,2308,1928,1547,1182,822,
+488,137,-192,-511,-820,-1131,-1443,-1758,-2059,-2342,-2613,-2874,-3128,-3342,-3542,-3713,
+-3878,-4003,-4136,-4254,-4373,-4472,-4579,-4700,-4824,-4964,-5105,-5235,-5359,-5471,-5563,-5655,
+-5721,-5790,-5829,-5866,-5919,-5970,-6022,-6077,-6131,-6193,-6254,-6314,-6369,-6391,-6422,-6420,
+-6390,-6319,-6244,-6129,-6010,-5842,-5659,-5465,-5247,-5038,-4813,-4602,-4375,-4156,-3935,-3713,
+-3503,-3281,-3080,-2867,-2657,-2451,-2222,-1978,-1729,-1457,-1156,-843,-521,-184,158,524,
+885,1268,1619,2001,2332,2666,2984,3296,3567,3823,4049,4262,4474,4655,4836,4982,
+5162,5306,5459,5598,5741,5884,6019,6165,6316,6468,6590,6712,6828,6930,7025,7104,
+7166,7216,7250,7258,7254,7189,7128,7031,6912,6771,6593,6409,6204,5972,5722,5477,
+5216,4935,4625,4312,3973,3632,3264,2892,2514,2122,1758,1410,1081,766,485,224,
+-14,-239,-449,-654,-857,-1083,-1295,-1522,-1747,-1983,-2225,-2456,-2669,-2894,-3090,-3300,
+-3484,-3656,-3816,-3963,-4103,-4213,-4312,-4404,-4477,-4529,-4554,-4569,-4574,-4579,-4569,-4555,
+-4533,-4513,-4478,-4441,-4396,-4356,-4297,-4225,-4170,-4082,-3986,-3898,-3792,-3684,-3564,-3431,
+-3285,-3125,-2952,-2761,-2542,-2322,-2080,-1836,-1607,-1378,-1177,-981,-803,-649,-513,-398,
+-309,-245,-190,-155,-135,-133,-160,-202,-279,-370,-479,-620,-762,-905,-1055,-1192,
+-1341,-1473,-1603,-1726,-1852,-1962,-2066,-2167,-2254,-2339,-2422,-2494,-2567,-2621,-2672,-2721,
+-2763,-2786,-2820,-2850,-2871,-2870,-2872,-2867,-2876,-2876,-2869,-2863,-2853,-2824,-2783,-2744,
+-2676,-2615,-2524,-2427,-2326,-2199,-2071,-1925,-1781,-1623,-1466,-1297,-1102,-895,-694,-465,
+-212,36,303,585,879,1150,1434,1693,1952,2183,2420,2645,2866,3097,3316,3546,
+3775,4000,4228,4441,4638,4839,5030,5202,5365,5537,5714,5893,6075,6255,6431,6606,
+6768,6910,7035,7130,7186,7196,7151,7064,6948,6801,6613,6418,6201,5981,5775,5557,
+5339,5136,4929,4726,4523,4310,4093,3865,3621,3358,3072,2800,2498,2214,1941,1666,
+1418,1158,923,691,496,282,61,-146,-377,-612,-864,-1100,-1365,-1621,-1891,-2138,
+-2357,-2563,-2740,-2923,-3086,-3226,-3361,-3488,-3631,-3786,-3946,-4121,-4289,-4472,-4654,-4831,
+-4985,-5128,-5244,-5355,-5408,-5461,-5479,-5476,-5461,-5423,-5369,-5310,-5271,-5224,-5188,-5171,
+-5166,-5145,-5133,-5120,-5072,-5010,-4926,-4822,-4701,-4553,-4388,-4195,-4004,-3800,-3608,-3429,
+-3269,-3108,-2981,-2879,-2758,-2655,-2558,-2438,-2302,-2162,-1985,-1814,-1607,-1394,-1153,-892,
+-633,-387,-128,130,368,598,804,999,1169,1334,1493,1645,1809,1975,2146,2304,
+2488,2663,2836,2987,3114,3197,3237,3231,3171,3054,2895,2693,2477,2285,2079,1900,
+1737,1611,1494,1433,1383,1344,1312,1282,1248,1196,1128,1052,989,900,829,752,
+707,665,651,658,693,751,816,889,948,1009,1038,1063,1057,1028,961,875,
+775,658,551,432,310,199,96,7,-67,-134,-209,-261,-319,-374,-424,-461,
+-481,-524,-534,-548,-515,-453,-384,-271,-141,32,213,422,642,874,1116,1360,
+1614,1871,2115,2366,2598,2813,3038,3261,3489,3685,3865,4030,4175,4316,4419,4501,
+4544,4566,4557,4546,4511,4452,4399,4315,4222,4136,4020,3908,3768,3612,3444,3275,
+3109,2941,2770,2602,2437,2267,2100,1930,1767,1587,1406,1219,1034,831,644,453,
+269,84,-70,-242,-396,-561,-700,-831,-971,-1118,-1239,-1361,-1457,-1557,-1656,-1718,
+-1766,-1795,-1836,-1860,-1889,-1907,-1949,-2003,-2043,-2109,-2155,-2207,-2246,-2283,-2299,-2314,
+-2339,-2339,-2351,-2357,-2341,-2317,-2280,-2237,-2183,-2115,-2031,-1926,-1812,-1677,-1550,-1405,
+-1251,-1078,-868,-682,-454,-236,19,249,489,735,977,1175,1357,1506,1629,1718,
+1774,1801,1791,1781,1763,1720,1690,1659,1604,1552,1484,1384,1283,1156,998,798,
+591,384,150,-66,-302,-501,-689,-834,-956,-1049,-1126,-1178,-1218,-1259,-1279,-1297,
+-1332,-1369,-1407,-1459,-1515,-1575,-1622,-1658,-1685,-1707,-1722,-1708,-1728,-1749,-1785,-1826,
+-1900,-1995,-2121,-2294,-2486,-2690,-2908,-3141,-3351,-3547,-3708,-3848,-3954,-4026,-4080,-4101,
+-4102,-4106,-4093,-4078,-4055,-4037,-4007,-3988,-3961,-3914,-3857,-3776,-3681,-3560,-3409,-3226,
+-3010,-2777,-2546,-2277,-2012,-1752,-1489,-1237,-983,-769,-542,-346,-153,10,177,327,
+479,624,767,906,1031,1168,1268,1368,1462,1549,1623,1687,1742,1783,1805,1817,
+1801,1799,1775,1746,1714,1671,1631,1582,1548,1485,1427,1370,1302,1221,1140,1033,
+939,844,749,657,564,483,401,327,273,208,151,111,57,-6,-41,-71,
+-99,-134,-142,-141,-103,-64,11,105,218,331,486,630,785,928,1056,1171,
+1272,1366,1422,1458,1471,1469,1445,1423,1396,1365,1315,1287,1254,1225,1191,1146,
+1102,1054,1000,944,898,860,835,823,843,893,981,1085,1222,1392,1584,1814,
+2052,2301,2554,2800,3032,3249,3463,3643,3826,3972,4115,4228,4316,4377,4406,4409,
+4381,4291,4218,4093,3931,3746,3587,3398,3197,2987,2808,2620,2436,2272,2123,1966,
+1819,1671,1532,1387,1227,1060,880,703,491,276,43,-211,-473,-720,-980,-1244,
+-1482,-1720,-1943,-2152,-2337,-2502,-2652,-2805,-2918,-3039,-3140,-3234,-3309,-3396,-3477,-3540,
+-3593,-3659,-3708,-3748,-3778,-3839,-3884,-3926,-3952,-3979,-4009,-4026,-4048,-4057,-4073,-4067,
+-4048,-4009,-3963,-3905,-3845,-3788,-3713,-3627,-3530,-3428,-3321,-3204,-3069,-2925,-2763,-2599,
+-2414,-2228,-2038,-1830,-1626,-1421,-1209,-999,-781,-564,-340,-111,106,336,561,795,
+1007,1217,1412,1585,1735,1869,1977,2066,2143,2178,2209,2222,2221,2195,2185,2148,
+2092,2034,1980,1930,1882,1832,1785,1764,1736,1732,1725,1735,1744,1775,1823,1882,
+1968,2085,2221,2364,2548,2741,2955,3200,3438,3680,3906,4100,4259,4398,4482,4528,
+4529,4486,4399,4270,4112,3924,3746,3536,3331,3119,2918,2723,2507,2294,2060,1824,
+1556,1277,986,660,321,-40,-397,-773,-1161,-1529,-1896,-2220,-2535,-2805,-3042,-3248,
+-3411,-3557,-3693,-3812,-3922,-4035,-4148,-4260,-4378,-4484,-4601,-4670,-4712,-4719,-4682,-4628,
+-4521,-4373,-4205,-4012,-3823,-3625,-3435,-3253,-3102,-2958,-2851,-2764,-2677,-2607,-2520,-2443,
+-2350,-2227,-2079,-1906,-1708,-1499,-1273,-1055,-828,-620,-444,-295,-174,-74,-1,68,
+118,169,225,289,371,490,600,734,850,958,1027,1086,1121,1108,1067,1005,
+932,831,737,646,574,506,464,447,454,473,513,546,583,619,640,658,
+652,633,591,536,480,409,363,307,267,234,199,176,175,164,141,138,
+110,88,61,39,20,18,25,35,86,168,259,378,494,626,756,877,
+978,1059,1096,1121,1109,1079,994,896,792,666,545,410,277,138,-5,-149,
+-284,-417,-553,-661,-764,-865,-957,-1040,-1114,-1159,-1196,-1229,-1263,-1276,-1286,-1278,
+-1275,-1265,-1266,-1236,-1234,-1222,-1202,-1179,-1159,-1146,-1141,-1138,-1122,-1119,-1117,-1123,
+-1107,-1092,-1067,-1037,-995,-954,-898,-841,-774,-707,-664,-627,-592,-566,-535,-511,
+-502,-473,-456,-416,-371,-297,-233,-148,-58,24,115,200,281,346,396,432,
+482,514,547,594,625,675,711,758,807,838,855,861,857,836,801,761,
+715,659,610,541,499,467,435,421,411,423,426,444,485,514,544,580,
+611,616,615,591,578,565,539,541,522,522,534,555,578,622,656,692,
+718,744,747,729,730,709,682,682,679,688,715,778,841,910,978,1064,
+1135,1226,1296,1364,1434,1482,1540,1553,1589,1620,1640,1637,1628,1641,1635,1661,
+1660,1675,1695,1740,1774,1809,1856,1896,1927,1938,1947,1915,1861,1771,1661,1510,
+1345,1159,940,721,491,280,65,-160,-364,-561,-758,-954,-1143,-1310,-1507,-1695,
+-1864,-2035,-2203,-2358,-2497,-2609,-2703,-2762,-2795,-2774,-2737,-2658,-2577,-2467,-2329,-2186,
+-2020,-1861,-1686,-1515,-1333,-1133,-900,-673,-411,-128,174,512,874,1255,1645,2026,
+2409,2789,3134,3464,3755,4030,4253,4471,4638,4805,4942,5074,5184,5261,5299,5318,
+5294,5217,5093,4917,4702,4435,4118,3773,3393,3002,2624,2233,1849,1486,1146,830,
+537,277,46,-175,-386,-569,-719,-861,-1000,-1109,-1207,-1303,-1393,-1460,-1524,-1572,
+-1633,-1687,-1735,-1791,-1843,-1891,-1929,-1949,-1990,-2021,-2060,-2092,-2139,-2170,-2221,-2278,
+-2326,-2360,-2399,-2424,-2445,-2462,-2487,-2477,-2479,-2450,-2434,-2414,-2381,-2343,-2292,-2237,
+-2165,-2070,-1976,-1848,-1720,-1569,-1420,-1260,-1114,-973,-835,-708,-594,-502,-405,-323,
+-251,-200,-176,-147,-127,-126,-112,-105,-104,-93,-76,-51,-15,27,79,151,
+246,325,396,465,551,618,707,770,847,926,1030,1132,1254,1413,1572,1744,
+1926,2101,2266,2426,2571,2687,2771,2815,2813,2783,2707,2590,2458,2305,2130,1934,
+1761,1579,1400,1232,1071,928,796,659,524,407,275,132,-12,-171,-329,-496,
+-657,-814,-965,-1097,-1231,-1337,-1435,-1527,-1615,-1709,-1771,-1840,-1913,-1968,-2023,-2060,
+-2096,-2126,-2135,-2150,-2160,-2166,-2173,-2165,-2156,-2151,-2143,-2116,-2099,-2068,-2020,-1958,
+-1904,-1824,-1753,-1654,-1561,-1466,-1359,-1252,-1135,-1005,-862,-727,-570,-425,-262,-100,
+78,228,384,541,689,831,977,1147,1305,1469,1658,1828,2022,2200,2394,2562,
+2737,2878,3016,3133,3214,3273,3321,3334,3301,3238,3134,3012,2836,2643,2404,2161,
+1876,1587,1281,974,681,379,74,-237,-540,-831,-1120,-1415,-1705,-1957,-2221,-2440,
+-2659,-2852,-3007,-3146,-3250,-3332,-3405,-3475,-3541,-3598,-3661,-3731,-3800,-3881,-3950,-4013,
+-4045,-4089,-4101,-4114,-4108,-4093,-4085,-4084,-4075,-4070,-4076,-4098,-4118,-4165,-4199,-4234,
+-4270,-4305,-4321,-4321,-4284,-4212,-4145,-4048,-3937,-3800,-3671,-3521,-3369,-3234,-3089,-2945,
+-2812,-2687,-2544,-2426,-2290,-2153,-2004,-1835,-1669,-1487,-1299,-1100,-907,-717,-531,-358,
+-199,-48,79,199,291,392,451,509,560,614,686,761,830,923,1019,1125,
+1249,1372,1499,1628,1779,1915,2082,2241,2407,2586,2764,2971,3193,3436,3677,3967,
+4277,4615,4974,5347,5718,6104,6482,6832,7139,7413,7635,7785,7849,7854,7796,7646,
+7445,7177,6867,6524,6165,5772,5367,4980,4607,4251,3904,3579,3270,2989,2719,2459,
+2222,2011,1797,1607,1429,1268,1096,950,818,682,527,361,203,15,-187,-389,
+-582,-790,-981,-1182,-1354,-1518,-1660,-1791,-1893,-1991,-2086,-2160,-2249,-2341,-2442,-2520,
+-2616,-2717,-2818,-2937,-3038,-3141,-3216,-3286,-3334,-3363,-3373,-3373,-3341,-3312,-3262,-3193,
+-3115,-3033,-2959,-2883,-2798,-2721,-2657,-2568,-2482,-2417,-2341,-2244,-2135,-2021,-1898,-1759,
+-1611,-1445,-1283,-1107,-952,-786,-634,-487,-336,-217,-98,25,130,233,319,403,
+479,537,587,621,656,670,688,711,705,731,739,732,726,716,703,656,
+596,518,406,300,164,33,-104,-215,-326,-425,-486,-512,-514,-485,-437,-339,
+-254,-121,-4,112,232,372,508,657,805,949,1101,1273,1444,1611,1775,1953,
+2142,2303,2467,2613,2725,2808,2885,2922,2928,2912,2870,2824,2774,2721,2663,2616,
+2598,2578,2582,2598,2642,2665,2678,2662,2619,2550,2443,2313,2159,1972,1761,1547,
+1330,1100,876,656,445,268,88,-85,-231,-385,-528,-695,-858,-1030,-1207,-1388,
+-1594,-1803,-2011,-2226,-2413,-2601,-2762,-2905,-3016,-3104,-3163,-3214,-3258,-3283,-3300,-3333,
+-3372,-3420,-3471,-3514,-3566,-3625,-3667,-3693,-3712,-3701,-3694,-3671,-3646,-3605,-3567,-3509,
+-3479,-3439,-3401,-3370,-3340,-3314,-3302,-3287,-3271,-3253,-3239,-3217,-3178,-3128,-3075,-3012,
+-2922,-2808,-2684,-2570,-2449,-2329,-2188,-2067,-1940,-1812,-1681,-1546,-1394,-1234,-1063,-879,
+-662,-451,-226,4,260,485,731,958,1177,1389,1581,1782,1966,2161,2348,2543,
+2729,2926,3118,3320,3502,3684,3850,4010,4171,4327,4480,4636,4790,4965,5138,5344,
+5537,5750,5981,6206,6440,6660,6867,7039,7181,7298,7355,7386,7353,7267,7136,6963,
+6738,6500,6227,5943,5629,5314,4985,4674,4356,4041,3726,3418,3109,2798,2477,2166,
+1862,1563,1286,1031,793,569,376,193,13,-147,-303,-471,-642,-820,-1009,-1194,
+-1367,-1536,-1701,-1845,-1972,-2077,-2156,-2216,-2262,-2300,-2330,-2366,-2401,-2449,-2512,-2587,
+-2674,-2761,-2853,-2942,-3016,-3081,-3140,-3184,-3208,-3212,-3205,-3187,-3142,-3099,-3057,-3005,
+-2967,-2931,-2907,-2886,-2887,-2892,-2894,-2903,-2916,-2923,-2921,-2906,-2888,-2859,-2808,-2757,
+-2697,-2623,-2554,-2468,-2391,-2289,-2184,-2084,-1965,-1851,-1701,-1542,-1361,-1181,-981,-767,
+-561,-358,-181,-2,145,270,361,438,476,496,478,433,385,311,219,113,
+0,-134,-287,-457,-638,-812,-1003,-1228,-1404,-1598,-1779,-1960,-2131,-2291,-2395,-2492,
+-2572,-2646,-2685,-2702,-2702,-2675,-2626,-2565,-2480,-2382,-2266,-2118,-1972,-1799,-1602,-1379,
+-1160,-915,-667,-405,-136,126,368,606,830,1050,1249,1454,1616,1770,1933,2083,
+2219,2354,2485,2619,2732,2840,2934,3030,3121,3197,3255,3299,3342,3348,3343,3356,
+3326,3307,3274,3261,3253,3243,3242,3232,3247,3235,3230,3220,3208,3169,3121,3059,
+2993,2916,2828,2741,2647,2554,2462,2379,2290,2182,2082,1970,1863,1741,1612,1467,
+1322,1174,1034,886,755,630,509,387,264,152,44,-61,-183,-307,-406,-518,
+-625,-741,-861,-968,-1070,-1158,-1250,-1322,-1383,-1448,-1490,-1522,-1547,-1561,-1560,-1569,
+-1586,-1619,-1631,-1648,-1695,-1730,-1763,-1789,-1819,-1848,-1862,-1885,-1908,-1945,-1994,-2047,
+-2107,-2208,-2311,-2424,-2546,-2667,-2790,-2910,-3008,-3071,-3117,-3127,-3102,-3037,-2970,-2838,
+-2692,-2520,-2335,-2140,-1948,-1758,-1577,-1397,-1208,-1025,-837,-648,-452,-253,-56,173,
+408,635,887,1130,1351,1580,1785,1969,2138,2303,2430,2550,2656,2742,2813,2870,
+2916,2941,2964,2973,2983,2974,2966,2954,2942,2933,2917,2902,2859,2807,2747,2661,
+2567,2444,2314,2176,2030,1850,1690,1542,1391,1258,1143,1014,899,789,659,520,
+378,217,50,-129,-321,-510,-720,-922,-1118,-1297,-1469,-1648,-1822,-1986,-2151,-2303,
+-2464,-2616,-2754,-2880,-2987,-3105,-3200,-3282,-3352,-3410,-3449,-3477,-3502,-3499,-3504,-3519,
+-3535,-3552,-3561,-3579,-3599,-3615,-3630,-3641,-3659,-3679,-3686,-3682,-3684,-3665,-3645,-3624,
+-3574,-3528,-3478,-3424,-3361,-3288,-3195,-3118,-3043,-2957,-2851,-2738,-2612,-2479,-2327,-2153,
+-1949,-1745,-1535,-1333,-1138,-941,-772,-611,-481,-343,-249,-156,-57,37,127,204,
+271,339,399,457,499,528,532,510,494,469,435,396,356,335,335,352,
+395,455,527,630,744,890,1035,1184,1333,1470,1596,1713,1828,1907,1982,2037,
+2096,2156,2195,2227,2262,2322,2388,2446,2514,2585,2668,2737,2789,2847,2865,2869,
+2860,2815,2759,2674,2581,2469,2355,2241,2104,1969,1849,1732,1626,1540,1440,1372,
+1332,1277,1249,1212,1190,1152,1121,1080,1027,978,925,877,824,803,795,813,
+848,906,964,1047,1130,1200,1266,1336,1380,1404,1413,1414,1408,1382,1369,1350,
+1354,1356,1346,1325,1303,1271,1214,1139,1066,959,820,680,520,363,194,21,
+-150,-330,-503,-669,-829,-963,-1098,-1222,-1340,-1439,-1513,-1582,-1653,-1702,-1730,-1759,
+-1766,-1763,-1735,-1710,-1685,-1650,-1604,-1557,-1534,-1503,-1502,-1494,-1503,-1535,-1552,-1590,
+-1627,-1671,-1720,-1775,-1818,-1856,-1898,-1922,-1951,-1983,-2003,-2032,-2035,-2052,-2037,-2018,
+-1967,-1916,-1832,-1713,-1564,-1400,-1205,-987,-749,-462,-169,133,450,774,1098,1422,
+1744,2044,2339,2625,2922,3189,3465,3729,3980,4225,4446,4636,4807,4948,5035,5086,
+5099,5072,4972,4836,4676,4474,4255,4014,3755,3502,3242,2986,2753,2530,2295,2083,
+1891,1683,1495,1301,1121,944,761,580,420,260,101,-42,-176,-306,-419,-532,
+-634,-724,-826,-911,-996,-1082,-1161,-1231,-1307,-1380,-1461,-1523,-1591,-1640,-1702,-1751,
+-1817,-1857,-1899,-1934,-1951,-1980,-1989,-1996,-1977,-1959,-1924,-1874,-1813,-1714,-1615,-1493,
+-1359,-1222,-1066,-924,-781,-648,-537,-427,-342,-247,-155,-73,0,82,181,271,
+363,477,585,689,800,863,935,1001,1070,1114,1160,1177,1201,1235,1252,1254,
+1238,1210,1144,1089,1010,925,831,721,580,437,281,136,-15,-169,-322,-456,
+-593,-716,-833,-930,-1020,-1110,-1190,-1259,-1319,-1389,-1446,-1509,-1571,-1622,-1656,-1687,
+-1705,-1722,-1728,-1700,-1673,-1635,-1565,-1502,-1438,-1362,-1320,-1261,-1239,-1215,-1222,-1238,
+-1265,-1301,-1369,-1439,-1485,-1557,-1597,-1639,-1688,-1724,-1746,-1773,-1794,-1827,-1842,-1880,
+-1922,-1945,-1973,-2000,-2009,-2005,-1980,-1942,-1881,-1809,-1730,-1634,-1543,-1448,-1344,-1259,
+-1158,-1067,-969,-872,-778,-664,-554,-453,-336,-227,-109,-2,114,208,289,390,
+464,565,648,745,818,898,989,1093,1184,1293,1412,1513,1638,1754,1867,1994,
+2119,2256,2379,2528,2683,2858,3039,3242,3447,3660,3881,4114,4332,4546,4746,4929,
+5065,5162,5231,5261,5251,5194,5100,4980,4818,4620,4407,4177,3953,3739,3512,3291,
+3075,2857,2640,2422,2188,1965,1722,1491,1239,1003,772,554,348,147,-34,-205,
+-347,-497,-638,-767,-919,-1055,-1203,-1355,-1517,-1661,-1816,-1966,-2109,-2233,-2354,-2462,
+-2553,-2632,-2688,-2728,-2742,-2750,-2733,-2705,-2647,-2590,-2537,-2473,-2412,-2369,-2338,-2296,
+-2258,-2242,-2216,-2191,-2122,-2057,-1968,-1873,-1751,-1631,-1519,-1389,-1286,-1187,-1102,-1032,
+-977,-930,-901,-873,-857,-831,-802,-745,-698,-620,-548,-461,-366,-254,-172,-94,
+-34,6,44,45,43,15,-22,-64,-122,-169,-205,-238,-266,-287,-297,-300,
+-318,-317,-307,-291,-288,-263,-254,-229,-196,-159,-98,-45,35,122,221,332,
+451,559,665,763,860,947,1033,1105,1174,1249,1335,1409,1490,1570,1666,1717,
+1766,1793,1777,1725,1653,1533,1376,1167,950,719,490,252,25,-193,-383,-559,
+-710,-855,-975,-1084,-1193,-1289,-1376,-1454,-1536,-1623,-1686,-1725,-1781,-1796,-1805,-1799,
+-1779,-1741,-1691,-1624,-1550,-1473,-1394,-1311,-1229,-1154,-1094,-1044,-995,-950,-931,-913,
+-903,-901,-890,-884,-880,-870,-852,-815,-791,-759,-717,-677,-636,-601,-564,-542,
+-522,-491,-470,-433,-384,-328,-271,-194,-92,9,123,260,384,515,652,767,
+869,978,1065,1152,1235,1316,1376,1435,1499,1566,1612,1646,1644,1660,1638,1585,
+1513,1409,1305,1171,1019,844,663,453,245,44,-174,-383,-590,-790,-985,-1167,
+-1327,-1472,-1605,-1713,-1804,-1870,-1936,-1972,-1980,-2000,-2012,-2008,-2016,-1995,-1988,-1959,
+-1924,-1878,-1801,-1719,-1608,-1491,-1351,-1200,-1046,-885,-722,-564,-401,-244,-93,46,
+202,355,515,679,857,1037,1232,1424,1631,1851,2062,2272,2477,2678,2875,3054,
+3202,3322,3421,3506,3562,3599,3590,3559,3496,3408,3288,3163,3012,2852,2693,2528,
+2351,2154,1963,1763,1558,1361,1177,982,804,607,428,251,71,-104,-299,-480,
+-665,-860,-1070,-1267,-1475,-1690,-1903,-2116,-2325,-2532,-2730,-2918,-3061,-3204,-3314,-3419,
+-3483,-3538,-3567,-3603,-3613,-3618,-3612,-3594,-3561,-3531,-3485,-3431,-3367,-3297,-3224,-3128,
+-3039,-2925,-2812,-2698,-2587,-2483,-2372,-2280,-2185,-2094,-2003,-1926,-1856,-1777,-1697,-1616,
+-1515,-1412,-1287,-1156,-1017,-853,-696,-546,-389,-230,-79,69,209,338,463,583,
+690,797,896,1027,1150,1263,1377,1481,1570,1656,1731,1795,1858,1880,1905,1922,
+1940,1948,1959,1976,1984,1989,1985,1988,1972,1951,1922,1887,1857,1809,1764,1714,
+1682,1648,1637,1623,1618,1637,1661,1695,1720,1768,1792,1821,1829,1826,1811,1781,
+1713,1613,1511,1375,1207,1036,845,645,455,264,77,-102,-280,-472,-618,-780,
+-939,-1099,-1250,-1398,-1566,-1721,-1871,-2004,-2139,-2259,-2344,-2398,-2426,-2431,-2415,-2361,
+-2301,-2228,-2147,-2050,-1966,-1865,-1780,-1673,-1571,-1460,-1331,-1216,-1084,-941,-792,-643,
+-487,-334,-162,-3,133,285,409,530,643,747,828,912,1003,1070,1121,1175,
+1213,1250,1288,1338,1350,1386,1399,1419,1439,1449,1456,1456,1451,1455,1438,1416,
+1408,1408,1398,1397,1402,1404,1387,1388,1392,1382,1333,1283,1201,1130,1026,919,
+781,652,489,350,201,57,-81,-232,-360,-483,-594,-709,-829,-944,-1050,-1157,
+-1282,-1389,-1505,-1614,-1707,-1767,-1827,-1863,-1877,-1870,-1825,-1779,-1695,-1607,-1500,-1379,
+-1259,-1137,-1010,-858,-713,-568,-371,-176,36,270,527,785,1071,1357,1655,1943,
+2234,2510,2767,3031,3298,3570,3845,4111,4401,4703,5026,5372,5687,5996,6290,6554,
+6772,6962,7086,7126,7089,6997,6820,6576,6307,5965,5608,5243,4868,4507,4155,3855,
+3589,3332,3102,2885,2687,2515,2334,2150,1974,1773,1576,1363,1170,974,796,616,
+441,282,136,-10,-182,-340,-491,-649,-828,-1014,-1199,-1381,-1570,-1761,-1946,-2139,
+-2326,-2511,-2689,-2869,-3047,-3237,-3416,-3584,-3739,-3898,-4039,-4180,-4277,-4397,-4482,-4569,
+-4618,-4687,-4732,-4775,-4822,-4857,-4881,-4915,-4938,-4956,-4951,-4946,-4933,-4934,-4898,-4865,
+-4827,-4796,-4748,-4699,-4654,-4588,-4526,-4447,-4358,-4256,-4164,-4051,-3937,-3812,-3677,-3543,
+-3391,-3245,-3087,-2917,-2757,-2594,-2441,-2301,-2182,-2066,-1964,-1865,-1786,-1707,-1633,-1556,
+-1511,-1446,-1384,-1317,-1262,-1229,-1196,-1173,-1147,-1143,-1162,-1170,-1189,-1204,-1219,-1219,
+-1209,-1172,-1120,-1067,-998,-882,-743,-601,-451,-291,-105,53,229,404,599,792,
+1000,1205,1424,1627,1859,2077,2324,2551,2789,3030,3269,3538,3790,4050,4323,4590,
+4866,5128,5393,5619,5854,6065,6240,6400,6534,6658,6733,6794,6819,6835,6826,6766,
+6691,6580,6433,6280,6093,5861,5606,5346,5070,4760,4458,4152,3841,3545,3235,2936,
+2637,2359,2080,1810,1551,1293,1029,773,511,280,50,-172,-379,-566,-758,-928,
+-1083,-1240,-1402,-1558,-1713,-1866,-2022,-2172,-2338,-2472,-2615,-2745,-2874,-2987,-3090,-3175,
+-3251,-3314,-3364,-3393,-3409,-3416,-3412,-3383,-3346,-3320,-3272,-3240,-3192,-3149,-3117,-3060,
+-3003,-2946,-2882,-2808,-2720,-2618,-2490,-2348,-2229,-2085,-1950,-1797,-1655,-1504,-1367,-1256,
+-1140,-1041,-923,-846,-759,-690,-608,-551,-485,-439,-378,-354,-316,-263,-239,-208,
+-184,-143,-106,-62,-17,3,57,107,176,227,306,379,459,555,661,768,
+875,996,1118,1239,1391,1535,1668,1786,1894,1999,2089,2161,2226,2242,2233,2200,
+2148,2073,1972,1841,1708,1545,1395,1205,1013,836,647,460,274,125,-26,-168,
+-282,-403,-505,-595,-667,-730,-768,-814,-822,-827,-827,-826,-823,-802,-793,-774,
+-749,-744,-747,-739,-712,-681,-658,-622,-602,-550,-498,-455,-395,-365,-323,-315,
+-299,-310,-320,-359,-391,-451,-515,-599,-694,-788,-893,-998,-1103,-1211,-1312,-1407,
+-1501,-1593,-1685,-1747,-1827,-1882,-1939,-1996,-2071,-2130,-2208,-2286,-2360,-2425,-2491,-2571,
+-2620,-2662,-2703,-2726,-2729,-2730,-2726,-2714,-2682,-2637,-2605,-2576,-2513,-2462,-2410,-2360,
+-2291,-2233,-2157,-2093,-2008,-1937,-1853,-1772,-1693,-1611,-1548,-1476,-1411,-1329,-1253,-1161,
+-1072,-990,-877,-775,-666,-555,-445,-327,-229,-151,-61,12,84,137,195,253,
+313,377,452,537,629,729,846,956,1081,1201,1329,1468,1605,1748,1907,2063,
+2223,2395,2591,2785,2990,3202,3414,3660,3889,4128,4329,4519,4696,4853,4980,5070,
+5137,5149,5121,5034,4928,4783,4607,4405,4186,3950,3705,3460,3208,2963,2727,2491,
+2271,2041,1817,1603,1374,1163,956,760,562,375,216,43,-106,-259,-417,-568,
+-726,-884,-1072,-1262,-1454,-1642,-1810,-1979,-2141,-2263,-2375,-2470,-2538,-2577,-2599,-2624,
+-2644,-2648,-2647,-2649,-2654,-2646,-2622,-2601,-2541,-2471,-2371,-2264,-2126,-1980,-1804,-1608,
+-1422,-1232,-1041,-862,-694,-539,-387,-248,-125,-20,86,181,261,323,388,430,
+466,491,515,540,548,550,538,519,497,459,425,392,357,315,266,220,
+170,143,112,64,26,8,-21,-41,-86,-127,-169,-195,-239,-285,-321,-336,
+-330,-324,-301,-287,-242,-206,-161,-118,-34,27,76,137,195,255,313,379,
+434,525,605,682,778,885,974,1076,1156,1246,1310,1391,1436,1486,1526,1563,
+1589,1645,1691,1736,1803,1855,1925,2003,2078,2165,2251,2326,2380,2446,2492,2525,
+2543,2567,2569,2559,2542,2525,2504,2473,2428,2379,2339,2270,2217,2151,2055,1965,
+1863,1750,1640,1501,1365,1232,1098,969,872,789,710,632,561,508,442,362,
+286,196,71,-52,-194,-350,-503,-678,-838,-1015,-1175,-1332,-1482,-1631,-1758,-1871,
+-1962,-2051,-2139,-2223,-2307,-2386,-2495,-2574,-2675,-2777,-2897,-3000,-3101,-3195,-3277,-3354,
+-3409,-3452,-3462,-3478,-3468,-3446,-3424,-3399,-3367,-3335,-3310,-3306,-3297,-3277,-3271,-3265,
+-3239,-3210,-3162,-3107,-3054,-2974,-2910,-2839,-2749,-2664,-2575,-2501,-2419,-2345,-2261,-2173,
+-2071,-1967,-1872,-1754,-1636,-1525,-1398,-1253,-1136,-998,-890,-784,-677,-585,-511,-426,
+-346,-253,-159,-70,36,137,263,384,515,639,779,891,1015,1130,1247,1355,
+1470,1574,1692,1818,1948,2094,2229,2373,2514,2649,2779,2896,3008,3091,3179,3244,
+3294,3308,3334,3332,3333,3305,3273,3217,3162,3088,3016,2935,2869,2795,2726,2658,
+2604,2565,2531,2532,2520,2512,2525,2546,2578,2606,2624,2632,2637,2640,2628,2611,
+2579,2546,2510,2469,2412,2340,2278,2199,2114,2014,1905,1764,1621,1445,1255,1050,
+832,615,363,130,-113,-340,-565,-768,-975,-1158,-1326,-1468,-1600,-1725,-1837,-1921,
+-2007,-2065,-2126,-2161,-2187,-2199,-2212,-2203,-2178,-2155,-2121,-2075,-2034,-1961,-1916,-1848,
+-1775,-1708,-1661,-1601,-1536,-1491,-1431,-1370,-1308,-1262,-1208,-1144,-1085,-1008,-944,-862,
+-785,-688,-618,-526,-446,-368,-316,-244,-214,-177,-148,-116,-108,-114,-106,-91,
+-69,-60,-31,9,48,83,144,172,206,247,288,335,381,427,476,533,
+591,633,698,756,799,825,849,842,845,826,810,765,702,636,545,446,
+346,217,73,-73,-221,-378,-526,-688,-831,-942,-1044,-1156,-1237,-1303,-1341,-1378,
+-1383,-1398,-1369,-1365,-1328,-1281,-1214,-1144,-1049,-935,-824,-701,-566,-431,-300,-187,
+-75,20,92,158,210,231,255,291,316,329,350,368,382,399,411,411,
+405,393,367,328,302,248,190,129,68,0,-51,-106,-165,-213,-276,-326,
+-388,-442,-518,-570,-648,-729,-817,-905,-1013,-1111,-1224,-1346,-1448,-1565,-1662,-1766,
+-1851,-1926,-1985,-2039,-2066,-2083,-2086,-2100,-2120,-2134,-2131,-2148,-2160,-2194,-2213,-2231,
+-2237,-2242,-2223,-2203,-2156,-2098,-2036,-1954,-1852,-1745,-1641,-1517,-1392,-1265,-1142,-1013,
+-878,-743,-623,-511,-388,-275,-159,-36,69,182,275,380,466,545,638,713,
+786,867,940,1012,1097,1165,1247,1323,1427,1500,1615,1712,1833,1943,2091,2235,
+2393,2568,2748,2916,3105,3291,3468,3644,3815,3965,4096,4206,4309,4384,4426,4439,
+4422,4376,4321,4235,4127,3998,3864,3710,3560,3412,3252,3105,2957,2813,2652,2505,
+2363,2205,2050,1891,1743,1592,1462,1326,1218,1118,1040,963,897,845,781,722,
+654,564,467,355,237,118,-19,-169,-325,-478,-641,-792,-952,-1092,-1234,-1382,
+-1532,-1687,-1816,-1959,-2099,-2247,-2396,-2568,-2716,-2873,-3020,-3182,-3312,-3413,-3499,-3585,
+-3625,-3653,-3661,-3638,-3612,-3564,-3506,-3436,-3363,-3295,-3202,-3094,-3000,-2876,-2742,-2596,
+-2416,-2227,-2018,-1789,-1541,-1266,-973,-680,-390,-93,227,540,850,1163,1480,1786,
+2099,2424,2708,3004,3271,3526,3763,3969,4146,4288,4412,4496,4548,4538,4507,4443,
+4344,4212,4058,3859,3640,3405,3148,2875,2587,2313,2042,1758,1477,1212,980,744,
+521,323,129,-65,-249,-427,-563,-697,-813,-948,-1069,-1171,-1282,-1402,-1509,-1650,
+-1766,-1887,-2015,-2144,-2280,-2409,-2532,-2646,-2747,-2849,-2934,-2984,-3032,-3054,-3075,-3079,
+-3070,-3070,-3055,-3037,-3019,-3018,-3007,-2993,-2971,-2944,-2903,-2847,-2789,-2715,-2629,-2523,
+-2411,-2294,-2158,-2048,-1925,-1827,-1714,-1611,-1522,-1428,-1342,-1277,-1219,-1152,-1091,-1034,
+-980,-896,-820,-752,-680,-602,-529,-470,-419,-377,-351,-329,-322,-318,-322,-340,
+-359,-371,-375,-370,-352,-331,-277,-238,-183,-132,-80,-17,33,88,126,163,
+203,219,241,256,288,331,346,394,426,470,493,519,543,580,601,617,
+648,677,700,725,754,799,825,864,897,928,955,964,987,1015,1016,1013,
+1014,982,968,939,891,832,771,684,588,492,393,277,162,57,-42,-122,
+-185,-242,-264,-274,-282,-275,-278,-264,-236,-227,-191,-145,-87,-27,28,109,
+196,295,408,533,672,826,980,1138,1317,1495,1696,1897,2092,2290,2495,2685,
+2874,3052,3227,3379,3520,3668,3784,3906,3996,4062,4106,4118,4110,4062,4003,3886,
+3747,3601,3419,3229,3031,2825,2620,2391,2183,1980,1757,1526,1311,1102,877,668,
+458,259,60,-131,-295,-462,-615,-739,-844,-930,-1008,-1063,-1115,-1153,-1166,-1190,
+-1212,-1227,-1245,-1252,-1263,-1281,-1294,-1299,-1297,-1307,-1291,-1290,-1280,-1273,-1250,-1244,
+-1214,-1185,-1185,-1184,-1178,-1185,-1210,-1223,-1267,-1338,-1402,-1481,-1564,-1658,-1769,-1853,
+-1952,-2048,-2128,-2205,-2260,-2318,-2358,-2377,-2400,-2428,-2431,-2436,-2413,-2405,-2379,-2360,
+-2327,-2290,-2241,-2183,-2140,-2086,-2018,-1971,-1928,-1874,-1823,-1775,-1739,-1707,-1691,-1681,
+-1681,-1709,-1751,-1796,-1862,-1946,-2025,-2110,-2196,-2304,-2387,-2476,-2557,-2626,-2680,-2727,
+-2750,-2752,-2748,-2734,-2699,-2645,-2590,-2531,-2465,-2379,-2292,-2177,-2062,-1948,-1820,-1685,
+-1542,-1396,-1244,-1101,-947,-792,-635,-487,-331,-192,-39,98,242,346,478,588,
+696,767,826,901,960,1021,1055,1102,1128,1169,1205,1257,1289,1312,1341,1361,
+1397,1424,1458,1482,1524,1568,1613,1655,1732,1815,1893,1988,2095,2196,2315,2426,
+2537,2637,2733,2817,2887,2948,2995,3010,3019,3005,2995,2966,2929,2894,2846,2795,
+2759,2714,2687,2654,2606,2567,2522,2463,2394,2312,2212,2114,1999,1877,1745,1621,
+1487,1353,1230,1108,992,874,760,643,548,448,351,250,158,62,-18,-97,
+-155,-207,-242,-266,-267,-251,-228,-191,-131,-72,-8,49,101,147,170,197,
+197,188,152,95,47,-9,-70,-135,-207,-295,-363,-456,-535,-612,-691,-762,
+-835,-891,-938,-981,-1016,-1020,-1011,-998,-969,-919,-854,-774,-669,-552,-430,-290,
+-160,-11,143,294,450,609,775,939,1114,1299,1475,1668,1854,2060,2247,2436,
+2602,2754,2908,3043,3144,3217,3268,3296,3297,3305,3272,3240,3193,3144,3091,3026,
+2971,2908,2848,2769,2680,2592,2505,2412,2292,2162,2032,1890,1736,1589,1435,1286,
+1122,980,838,693,550,413,277,139,10,-123,-248,-375,-503,-625,-751,-878,
+-995,-1100,-1209,-1322,-1418,-1507,-1585,-1633,-1686,-1729,-1759,-1784,-1799,-1830,-1873,-1908,
+-1946,-1986,-2043,-2088,-2153,-2216,-2270,-2333,-2402,-2474,-2528,-2600,-2687,-2758,-2832,-2899,
+-2975,-3044,-3111,-3194,-3235,-3273,-3310,-3334,-3386,-3406,-3427,-3428,-3439,-3421,-3418,-3384,
+-3351,-3304,-3253,-3194,-3122,-3045,-2953,-2853,-2756,-2642,-2521,-2399,-2256,-2113,-1964,-1808,
+-1658,-1508,-1347,-1178,-1022,-873,-728,-598,-464,-351,-229,-123,-25,43,105,157,
+220,261,285,307,326,329,339,328,324,311,298,290,262,249,234,220,
+206,179,165,166,135,124,121,111,97,100,100,105,112,130,152,185,
+222,263,299,353,413,442,483,534,585,647,702,760,823,884,945,1029,
+1121,1205,1298,1391,1488,1609,1719,1836,1950,2078,2182,2298,2400,2517,2605,2693,
+2763,2822,2883,2937,2979,3002,3016,3050,3067,3094,3103,3138,3164,3190,3206,3227,
+3232,3223,3211,3183,3142,3077,2993,2913,2797,2666,2529,2397,2239,2080,1888,1709,
+1522,1328,1115,911,706,507,299,112,-73,-244,-408,-535,-655,-742,-832,-880,
+-902,-916,-905,-883,-841,-794,-734,-667,-585,-510,-427,-355,-281,-217,-152,-104,
+-66,-40,-18,-28,-54,-110,-178,-268,-383,-498,-636,-799,-948,-1117,-1290,-1442,
+-1601,-1743,-1898,-2018,-2144,-2252,-2364,-2472,-2568,-2658,-2757,-2849,-2929,-3020,-3088,-3127,
+-3164,-3197,-3217,-3203,-3196,-3164,-3124,-3096,-3031,-2971,-2914,-2861,-2800,-2739,-2692,-2631,
+-2571,-2502,-2456,-2392,-2331,-2247,-2172,-2064,-1963,-1855,-1744,-1617,-1480,-1354,-1221,-1085,
+-956,-808,-672,-527,-379,-225,-75,82,228,384,545,697,851,1017,1160,1311,
+1472,1631,1772,1922,2078,2228,2380,2531,2670,2814,2935,3063,3158,3250,3322,3381,
+3407,3410,3389,3349,3287,3205,3097,2960,2813,2638,2449,2259,2033,1816,1606,1384,
+1176,951,765,577,414,253,109,-12,-139,-236,-331,-406,-472,-539,-583,-617,
+-644,-679,-679,-677,-682,-662,-655,-653,-648,-645,-634,-635,-643,-665,-687,-708,
+-761,-815,-858,-904,-969,-1034,-1106,-1161,-1244,-1323,-1430,-1522,-1622,-1715,-1807,-1888,
+-1966,-2054,-2133,-2217,-2267,-2347,-2420,-2488,-2547,-2604,-2646,-2683,-2716,-2735,-2738,-2744,
+-2718,-2681,-2643,-2572,-2509,-2446,-2365,-2281,-2211,-2128,-2043,-1963,-1876,-1789,-1710,-1629,
+-1546,-1474,-1398,-1321,-1247,-1188,-1121,-1071,-1023,-951,-895,-848,-799,-746,-672,-609,
+-527,-459,-379,-294,-199,-103,15,127,272,406,537,677,837,980,1139,1287,
+1446,1605,1758,1900,2036,2170,2313,2454,2590,2729,2857,2989,3115,3256,3367,3460,
+3544,3640,3712,3771,3818,3849,3881,3898,3894,3893,3897,3883,3866,3833,3796,3765,
+3721,3694,3655,3611,3585,3549,3521,3483,3452,3415,3374,3319,3264,3213,3142,3079,
+3010,2948,2880,2795,2725,2627,2550,2471,2371,2263,2144,2013,1871,1736,1581,1430,
+1257,1096,938,771,607,434,281,131,-22,-161,-280,-403,-521,-641,-770,-870,
+-991,-1107,-1234,-1368,-1515,-1664,-1829,-1996,-2152,-2336,-2510,-2676,-2849,-2995,-3135,-3262,
+-3404,-3512,-3626,-3724,-3826,-3897,-3970,-4032,-4079,-4098,-4125,-4130,-4140,-4117,-4074,-4026,
+-3969,-3895,-3818,-3728,-3619,-3528,-3422,-3314,-3209,-3110,-3008,-2917,-2817,-2733,-2639,-2567,
+-2476,-2373,-2270,-2175,-2071,-1952,-1834,-1719,-1607,-1503,-1384,-1266,-1158,-1056,-939,-833,
+-742,-630,-528,-432,-343,-240,-129,-41,81,178,299,418,543,658,785,925,
+1049,1175,1302,1451,1590,1745,1913,2086,2267,2458,2660,2855,3062,3247,3431,3576,
+3724,3829,3930,3992,4041,4054,4059,4035,3988,3919,3847,3756,3654,3545,3429,3288,
+3149,2981,2813,2651,2479,2296,2084,1883,1685,1480,1268,1027,809,602,379,167,
+-29,-212,-382,-535,-682,-824,-958,-1082,-1186,-1284,-1371,-1441,-1516,-1562,-1626,-1687,
+-1731,-1768,-1811,-1833,-1878,-1922,-1959,-1988,-2030,-2066,-2114,-2175,-2220,-2255,-2307,-2374,
+-2442,-2524,-2594,-2680,-2783,-2886,-2983,-3085,-3178,-3287,-3380,-3475,-3542,-3610,-3651,-3690,
+-3722,-3731,-3740,-3751,-3742,-3721,-3696,-3660,-3608,-3558,-3484,-3410,-3318,-3208,-3061,-2928,
+-2780,-2638,-2471,-2306,-2142,-1956,-1801,-1628,-1462,-1284,-1118,-931,-748,-570,-390,-211,
+-33,123,277,446,577,722,844,943,1021,1106,1190,1240,1262,1292,1322,1338,
+1343,1336,1339,1339,1349,1347,1351,1356,1373,1351,1353,1339,1330,1313,1312,1314,
+1319,1339,1342,1382,1414,1477,1539,1611,1701,1806,1922,2058,2206,2364,2529,2703,
+2885,3066,3258,3464,3657,3868,4054,4248,4415,4591,4759,4896,5037,5145,5257,5342,
+5427,5471,5512,5516,5502,5476,5435,5341,5246,5122,4985,4820,4652,4480,4305,4117,
+3928,3751,3556,3380,3198,3034,2858,2697,2519,2345,2171,2014,1831,1654,1452,1260,
+1066,881,668,468,270,60,-149,-369,-554,-761,-958,-1155,-1342,-1530,-1705,-1887,
+-2052,-2218,-2373,-2517,-2650,-2762,-2877,-2981,-3057,-3122,-3177,-3224,-3257,-3276,-3283,-3271,
+-3276,-3264,-3257,-3232,-3216,-3192,-3168,-3142,-3119,-3064,-3002,-2952,-2892,-2801,-2716,-2645,
+-2568,-2486,-2386,-2293,-2218,-2151,-2083,-2023,-1948,-1901,-1847,-1789,-1739,-1690,-1647,-1597,
+-1561,-1502,-1461,-1419,-1382,-1352,-1316,-1271,-1239,-1207,-1168,-1136,-1097,-1058,-1014,-981,
+-940,-893,-848,-789,-723,-672,-609,-536,-458,-398,-335,-278,-224,-169,-130,-83,
+-41,16,77,133,207,279,372,463,578,700,840,971,1120,1260,1416,1573,
+1718,1881,2007,2150,2283,2419,2527,2621,2706,2777,2824,2852,2855,2852,2834,2792,
+2744,2684,2628,2540,2454,2365,2294,2208,2117,2010,1920,1844,1761,1675,1609,1537,
+1463,1398,1333,1269,1212,1167,1111,1055,975,935,878,819,760,684,603,508,
+419,308,180,54,-88,-234,-374,-541,-700,-852,-978,-1126,-1271,-1393,-1512,-1615,
+-1721,-1820,-1908,-2014,-2097,-2207,-2281,-2363,-2434,-2519,-2581,-2650,-2691,-2702,-2732,-2741,
+-2730,-2713,-2675,-2631,-2578,-2516,-2449,-2373,-2282,-2185,-2080,-1980,-1861,-1748,-1622,-1479,
+-1339,-1185,-1023,-872,-717,-573,-427,-292,-150,-19,91,196,276,361,444,523,
+591,655,708,762,822,871,913,963,1022,1054,1113,1146,1183,1233,1278,1324,
+1364,1419,1505,1594,1684,1772,1887,1984,2105,2221,2332,2450,2562,2672,2762,2845,
+2922,2975,3008,3045,3058,3064,3063,3067,3052,3021,2992,2942,2897,2836,2772,2695,
+2596,2474,2337,2194,2028,1869,1690,1517,1317,1115,909,722,536,352,187,23,
+-145,-296,-440,-566,-702,-820,-946,-1056,-1172,-1300,-1414,-1512,-1602,-1685,-1768,-1827,
+-1886,-1928,-1942,-1973,-1993,-2035,-2055,-2088,-2124,-2151,-2188,-2230,-2275,-2314,-2373,-2414,
+-2454,-2498,-2552,-2608,-2665,-2728,-2766,-2838,-2885,-2931,-2975,-3015,-3045,-3088,-3112,-3132,
+-3161,-3186,-3188,-3171,-3163,-3150,-3134,-3096,-3056,-3016,-2981,-2928,-2867,-2822,-2771,-2727,
+-2669,-2642,-2583,-2549,-2513,-2454,-2396,-2371,-2326,-2297,-2247,-2215,-2167,-2147,-2118,-2091,
+-2084,-2082,-2059,-2059,-2049,-2016,-1979,-1937,-1880,-1810,-1741,-1664,-1569,-1471,-1375,-1287,
+-1197,-1111,-1029,-940,-869,-799,-738,-661,-579,-509,-433,-358,-268,-167,-78,23,
+115,224,339,445,567,700,825,954,1087,1243,1400,1564,1717,1889,2060,2233,
+2436,2619,2809,3001,3214,3411,3606,3782,3958,4109,4236,4343,4426,4485,4515,4527,
+4502,4473,4430,4362,4294,4187,4077,3940,3795,3636,3461,3257,3044,2802,2566,2304,
+2042,1777,1513,1256,1000,767,534,326,127,-76,-260,-439,-594,-768,-919,-1079,
+-1228,-1359,-1484,-1601,-1723,-1814,-1898,-1973,-2028,-2062,-2095,-2129,-2152,-2147,-2155,-2160,
+-2173,-2161,-2160,-2161,-2158,-2137,-2120,-2092,-2075,-2053,-2017,-1955,-1911,-1848,-1788,-1722,
+-1651,-1586,-1520,-1453,-1392,-1319,-1246,-1152,-1078,-976,-873,-759,-639,-521,-372,-233,
+-85,62,196,365,525,677,828,974,1140,1294,1459,1620,1800,1982,2167,2347,
+2552,2749,2936,3128,3301,3470,3613,3745,3865,3989,4065,4118,4153,4167,4139,4084,
+4028,3939,3837,3712,3589,3436,3288,3126,2984,2815,2646,2476,2318,2156,1984,1818,
+1665,1536,1399,1280,1169,1075,984,923,874,824,770,724,676,615,551,482,
+414,329,235,130,47,-54,-165,-263,-355,-460,-561,-644,-749,-847,-957,-1065,
+-1172,-1287,-1396,-1512,-1626,-1744,-1851,-1945,-2017,-2089,-2148,-2190,-2222,-2258,-2254,-2261,
+-2270,-2276,-2264,-2262,-2251,-2239,-2225,-2193,-2170,-2127,-2078,-2007,-1941,-1879,-1808,-1733,
+-1663,-1605,-1544,-1500,-1458,-1441,-1433,-1415,-1419,-1414,-1424,-1440,-1437,-1439,-1439,-1423,
+-1413,-1412,-1407,-1423,-1409,-1427,-1423,-1442,-1456,-1479,-1525,-1556,-1591,-1626,-1665,-1695,
+-1738,-1761,-1780,-1812,-1826,-1858,-1881,-1912,-1916,-1922,-1938,-1941,-1942,-1939,-1922,-1914,
+-1908,-1883,-1856,-1823,-1803,-1766,-1713,-1672,-1624,-1576,-1514,-1460,-1376,-1317,-1223,-1157,
+-1069,-1006,-926,-846,-757,-675,-594,-523,-441,-358,-265,-191,-102,-10,89,172,
+238,338,417,499,593,693,790,872,967,1059,1150,1249,1338,1430,1528,1619,
+1699,1780,1873,1950,2032,2122,2205,2287,2347,2405,2482,2554,2623,2681,2749,2825,
+2904,2973,3050,3149,3223,3311,3383,3468,3545,3603,3655,3691,3730,3762,3781,3798,
+3821,3834,3863,3886,3918,3929,3942,3946,3965,3979,3983,3976,3958,3937,3898,3853,
+3810,3747,3683,3602,3511,3417,3318,3207,3099,3002,2893,2796,2679,2573,2500,2389,
+2296,2204,2116,2023,1918,1813,1712,1611,1507,1387,1275,1161,1043,909,776,625,
+476,343,194,56,-89,-225,-391,-543,-687,-844,-990,-1144,-1299,-1454,-1607,-1757,
+-1908,-2065,-2204,-2332,-2469,-2581,-2697,-2775,-2862,-2921,-2969,-3018,-3033,-3049,-3044,-3032,
+-3017,-2989,-2951,-2909,-2860,-2815,-2766,-2685,-2627,-2541,-2470,-2373,-2263,-2166,-2056,-1947,
+-1827,-1718,-1602,-1498,-1378,-1273,-1181,-1086,-987,-888,-802,-719,-643,-559,-480,-402,
+-313,-223,-141,-63,21,94,172,247,292,366,412,457,500,537,552,569,
+565,576,564,551,512,461,408,325,230,131,9,-118,-233,-361,-466,-588,
+-694,-767,-834,-886,-931,-965,-969,-981,-985,-990,-991,-978,-970,-977,-982,-986,
+-984,-994,-995,-984,-977,-964,-942,-930,-912,-890,-865,-848,-845,-831,-827,-827,
+-822,-805,-821,-817,-816,-816,-814,-797,-782,-765,-752,-730,-705,-672,-645,-616,
+-587,-564,-547,-533,-526,-539,-531,-529,-545,-552,-548,-553,-567,-564,-566,-582,
+-568,-586,-591,-590,-600,-607,-606,-607,-620,-631,-633,-624,-634,-624,-622,-605,
+-603,-591,-586,-557,-545,-516,-501,-485,-472,-453,-418,-403,-386,-355,-325,-288,
+-255,-215,-151,-96,-58,-17,26,58,100,123,152,166,191,204,202,206,
+215,215,243,271,297,326,360,415,467,513,567,651,723,789,872,953,
+1038,1115,1188,1265,1359,1450,1522,1616,1697,1771,1822,1872,1917,1942,1965,1966,
+1948,1927,1894,1870,1816,1757,1671,1593,1506,1421,1344,1250,1161,1062,981,895,
+808,741,671,622,575,543,520,510,513,514,525,542,558,588,600,611,
+640,646,664,672,675,675,669,666,658,642,635,606,570,519,466,393,
+302,199,68,-74,-237,-413,-593,-794,-972,-1161,-1330,-1505,-1648,-1786,-1900,-2005,
+-2069,-2132,-2178,-2203,-2220,-2209,-2207,-2184,-2162,-2133,-2086,-2046,-1998,-1934,-1870,-1811,
+-1720,-1646,-1560,-1475,-1386,-1298,-1209,-1131,-1044,-957,-879,-785,-716,-636,-553,-479,
+-401,-333,-256,-184,-107,-35,20,79,124,170,220,247,276,308,333,342,
+339,347,367,380,397,411,429,461,503,538,597,670,742,808,894,977,
+1066,1166,1258,1350,1445,1534,1619,1671,1750,1791,1838,1847,1854,1829,1779,1707,
+1613,1506,1371,1218,1050,853,663,449,247,51,-134,-326,-508,-667,-820,-959,
+-1093,-1213,-1305,-1403,-1514,-1584,-1669,-1755,-1834,-1891,-1941,-1963,-1996,-2002,-2006,-1998,
+-1966,-1936,-1888,-1835,-1790,-1748,-1691,-1650,-1607,-1560,-1524,-1489,-1474,-1429,-1392,-1348,
+-1316,-1270,-1231,-1183,-1139,-1101,-1068,-1032,-1007,-995,-972,-972,-962,-965,-950,-942,
+-948,-930,-906,-882,-838,-804,-751,-688,-630,-564,-497,-425,-367,-276,-200,-116,
+-42,30,99,172,229,281,340,392,444,484,526,555,578,592,597,590,
+578,559,521,471,416,365,316,263,203,149,95,55,38,14,5,-12,
+-6,-15,-13,-20,-31,-45,-61,-72,-79,-82,-100,-113,-112,-121,-116,-105,
+-92,-79,-70,-44,-30,-9,13,54,91,138,179,229,261,324,401,465,
+524,602,691,777,880,973,1079,1187,1305,1407,1516,1626,1726,1838,1944,2060,
+2154,2248,2339,2429,2500,2573,2631,2682,2717,2732,2723,2698,2661,2600,2546,2486,
+2398,2332,2237,2158,2055,1985,1906,1836,1747,1659,1560,1475,1395,1321,1236,1156,
+1083,1034,993,948,922,896,890,904,914,941,949,964,967,959,952,921,
+883,840,786,718,647,584,498,423,354,301,245,198,158,108,65,24,
+-19,-61,-112,-151,-214,-279,-347,-388,-435,-475,-503,-525,-535,-541,-523,-521,
+-506,-496,-496,-498,-501,-517,-539,-561,-579,-606,-643,-650,-668,-673,-685,-685,
+-694,-687,-686,-688,-716,-746,-781,-844,-907,-996,-1093,-1217,-1316,-1441,-1568,-1683,
+-1784,-1909,-2017,-2098,-2178,-2273,-2332,-2416,-2477,-2530,-2585,-2623,-2658,-2702,-2719,-2719,
+-2716,-2709,-2677,-2643,-2600,-2524,-2441,-2347,-2253,-2142,-2026,-1920,-1814,-1696,-1572,-1466,
+-1354,-1250,-1153,-1064,-979,-904,-868,-822,-803,-777,-775,-775,-797,-813,-838,-873,
+-902,-942,-986,-1018,-1049,-1079,-1091,-1117,-1122,-1129,-1132,-1119,-1110,-1082,-1046,-1008,
+-968,-912,-849,-776,-709,-638,-556,-469,-362,-260,-152,-47,70,214,346,467,
+609,753,884,1028,1158,1296,1429,1559,1684,1821,1957,2107,2258,2384,2537,2691,
+2848,3000,3149,3284,3434,3554,3648,3745,3823,3878,3933,3950,3960,3948,3909,3866,
+3799,3728,3650,3545,3431,3304,3175,3043,2896,2739,2558,2398,2222,2051,1873,1684,
+1492,1316,1136,969,813,665,526,388,273,159,49,-45,-142,-245,-340,-433,
+-532,-626,-718,-807,-878,-954,-1038,-1095,-1158,-1206,-1257,-1304,-1339,-1373,-1415,-1460,
+-1481,-1497,-1506,-1508,-1518,-1516,-1512,-1467,-1424,-1368,-1302,-1228,-1129,-1040,-924,-806,
+-690,-569,-418,-277,-131,9,161,321,481,644,790,931,1075,1218,1344,1465,
+1586,1698,1783,1865,1931,1969,1992,2007,2004,1991,1951,1902,1857,1810,1752,1671,
+1587,1506,1420,1319,1232,1143,1060,968,853,755,658,541,438,360,278,201,
+123,60,9,-32,-47,-77,-89,-86,-90,-60,-36,-2,38,92,147,226,
+309,398,501,598,679,780,886,982,1068,1136,1198,1254,1298,1307,1314,1297,
+1264,1219,1156,1062,957,859,744,600,451,293,129,-44,-234,-438,-636,-834,
+-1047,-1252,-1470,-1663,-1873,-2046,-2220,-2383,-2534,-2655,-2773,-2886,-2999,-3086,-3164,-3226,
+-3296,-3370,-3409,-3434,-3467,-3487,-3470,-3465,-3435,-3384,-3334,-3283,-3205,-3125,-3039,-2959,
+-2866,-2781,-2706,-2615,-2537,-2452,-2365,-2279,-2190,-2094,-2005,-1908,-1818,-1714,-1614,-1528,
+-1426,-1310,-1195,-1097,-987,-876,-783,-687,-591,-474,-368,-280,-182,-74,28,124,
+212,296,387,474,541,611,661,708,747,782,800,834,853,885,911,924,
+944,967,1000,1019,1034,1063,1083,1090,1109,1094,1100,1078,1066,1049,1046,1021,
+1013,994,1009,1023,1034,1037,1057,1065,1070,1094,1116,1140,1137,1157,1160,1172,
+1174,1172,1175,1175,1182,1191,1201,1206,1215,1222,1236,1231,1230,1216,1213,1184,
+1151,1099,1042,974,898,825,752,676,602,528,456,378,295,231,144,68,
+-20,-110,-211,-323,-428,-545,-639,-742,-832,-935,-1014,-1094,-1151,-1203,-1249,-1284,
+-1288,-1290,-1301,-1291,-1258,-1199,-1141,-1070,-999,-916,-821,-695,-584,-461,-326,-197,
+-57,84,227,358,483,604,717,833,925,1001,1074,1107,1142,1181,1191,1203,
+1183,1174,1147,1128,1095,1066,1046,996,968,908,854,803,743,691,646,598,
+570,526,511,487,469,482,466,452,456,453,450,450,443,432,402,370,
+342,312,277,247,212,181,151,113,87,64,37,11,-20,-51,-82,-110,
+-154,-168,-198,-217,-257,-267,-278,-285,-297,-301,-295,-288,-289,-258,-247,-224,
+-209,-181,-157,-136,-122,-89,-51,-6,26,79,143,207,277,344,407,471,
+545,601,661,703,729,740,744,735,709,680,633,580,525,442,357,261,
+178,81,-18,-121,-227,-324,-426,-534,-650,-756,-874,-1006,-1147,-1277,-1396,-1531,
+-1647,-1784,-1911,-2031,-2142,-2261,-2376,-2476,-2567,-2663,-2765,-2858,-2940,-3022,-3088,-3175,
+-3245,-3291,-3344,-3374,-3404,-3408,-3406,-3404,-3389,-3366,-3346,-3309,-3282,-3230,-3194,-3135,
+-3079,-3032,-2981,-2910,-2846,-2809,-2741,-2668,-2592,-2534,-2466,-2400,-2326,-2274,-2208,-2150,
+-2098,-2043,-2003,-1979,-1934,-1903,-1874,-1845,-1823,-1805,-1780,-1754,-1746,-1736,-1727,-1713,
+-1709,-1692,-1700,-1697,-1677,-1667,-1649,-1612,-1582,-1543,-1487,-1444,-1375,-1308,-1226,-1134,
+-1040,-931,-821,-716,-596,-461,-322,-192,-49,103,270,435,586,760,930,1101,
+1282,1466,1646,1822,1999,2163,2337,2512,2660,2820,2985,3140,3293,3461,3607,3773,
+3951,4141,4334,4548,4767,5012,5275,5546,5841,6118,6382,6645,6885,7097,7298,7457,
+7570,7633,7662,7676,7673,7643,7580,7494,7387,7262,7142,7002,6842,6673,6494,6275,
+6030,5777,5510,5226,4914,4587,4255,3922,3596,3252,2927,2617,2303,1999,1681,1373,
+1072,766,478,175,-137,-424,-719,-994,-1260,-1498,-1751,-1964,-2151,-2322,-2462,-2592,
+-2719,-2845,-2946,-3058,-3136,-3225,-3304,-3395,-3469,-3542,-3613,-3688,-3743,-3806,-3848,-3880,
+-3917,-3947,-3980,-3983,-3991,-3999,-3999,-3982,-3985,-3972,-3936,-3899,-3837,-3765,-3699,-3613,
+-3516,-3416,-3307,-3183,-3065,-2967,-2837,-2704,-2585,-2456,-2327,-2194,-2039,-1882,-1731,-1555,
+-1393,-1240,-1081,-935,-796,-662,-544,-438,-355,-276,-210,-163,-119,-84,-67,-38,
+-6,10,30,63,84,107,116,116,126,127,112,112,103,101,94,112,
+104,103,125,149,178,218,269,329,396,465,537,604,686,773,853,929,
+1001,1086,1159,1230,1284,1330,1384,1439,1483,1504,1524,1540,1540,1546,1547,1548,
+1533,1513,1486,1458,1427,1386,1344,1291,1257,1210,1152,1110,1051,1008,959,910,
+867,817,769,723,692,651,618,573,537,489,451,420,380,343,289,228,
+174,117,58,0,-68,-143,-211,-277,-370,-441,-525,-626,-723,-827,-924,-1032,
+-1138,-1240,-1333,-1451,-1540,-1645,-1746,-1842,-1916,-1986,-2040,-2101,-2141,-2175,-2205,-2202,
+-2187,-2179,-2163,-2099,-2045,-1967,-1883,-1781,-1687,-1570,-1467,-1347,-1213,-1084,-955,-822,
+-681,-544,-406,-235,-76,85,247,407,572,745,897,1058,1206,1367,1504,1642,
+1778,1907,2036,2134,2248,2346,2443,2532,2636,2714,2802,2880,2957,3030,3092,3158,
+3211,3270,3304,3318,3336,3344,3349,3336,3305,3269,3215,3162,3096,3030,2945,2849,
+2746,2623,2491,2357,2209,2043,1866,1689,1511,1335,1163,984,809,658,512,374,
+249,129,24,-61,-152,-228,-292,-356,-417,-477,-540,-591,-635,-661,-696,-714,
+-730,-741,-739,-723,-706,-722,-696,-689,-683,-687,-682,-693,-714,-737,-746,-751,
+-776,-795,-798,-783,-769,-753,-732,-708,-691,-659,-624,-596,-573,-543,-531,-520,
+-497,-495,-498,-497,-503,-498,-495,-495,-508,-515,-536,-562,-605,-647,-717,-784,
+-880,-945,-1033,-1112,-1204,-1283,-1369,-1448,-1525,-1590,-1650,-1707,-1758,-1808,-1850,-1904,
+-1961,-2016,-2054,-2109,-2141,-2166,-2161,-2143,-2146,-2129,-2113,-2080,-2037,-1987,-1944,-1872,
+-1837,-1798,-1781,-1737,-1706,-1682,-1664,-1654,-1615,-1584,-1550,-1524,-1485,-1438,-1395,-1342,
+-1287,-1241,-1181,-1155,-1090,-1053,-1007,-967,-935,-896,-848,-799,-738,-670,-591,-491,
+-390,-281,-159,-38,91,224,362,500,629,774,932,1069,1216,1358,1506,1641,
+1794,1948,2090,2228,2376,2503,2632,2753,2865,2965,3045,3120,3172,3211,3228,3233,
+3219,3184,3125,3050,2960,2839,2707,2547,2372,2190,1988,1757,1541,1316,1075,836,
+602,387,171,-49,-259,-441,-601,-763,-915,-1038,-1156,-1250,-1357,-1427,-1513,-1564,
+-1624,-1676,-1727,-1768,-1804,-1833,-1839,-1848,-1851,-1862,-1862,-1857,-1848,-1836,-1827,-1824,
+-1809,-1818,-1828,-1830,-1834,-1839,-1847,-1874,-1892,-1906,-1924,-1931,-1927,-1936,-1956,-1958,
+-1975,-1990,-2009,-1997,-2014,-2019,-2008,-1980,-1981,-1955,-1915,-1871,-1819,-1762,-1699,-1631,
+-1563,-1483,-1393,-1305,-1208,-1115,-1006,-906,-789,-678,-558,-430,-318,-195,-83,28,
+144,254,355,443,544,625,712,793,863,923,994,1051,1121,1174,1223,1274,
+1319,1363,1408,1450,1488,1528,1563,1601,1617,1639,1653,1674,1701,1721,1739,1755,
+1776,1788,1819,1823,1837,1866,1886,1899,1926,1953,1984,2018,2051,2088,2125,2159,
+2203,2236,2277,2293,2311,2330,2325,2336,2326,2316,2291,2266,2240,2190,2145,2096,
+2024,1963,1891,1830,1734,1653,1578,1486,1384,1304,1216,1138,1070,1005,953,909,
+865,833,804,774,767,746,740,736,740,760,764,777,777,796,804,810,
+804,798,791,777,749,703,635,565,466,369,258,135,3,-145,-303,-455,
+-612,-758,-908,-1081,-1228,-1368,-1516,-1655,-1787,-1929,-2054,-2173,-2272,-2368,-2467,-2567,
+-2658,-2718,-2786,-2842,-2883,-2914,-2944,-2959,-2997,-2994,-3017,-3019,-3010,-2998,-2978,-2958,
+-2930,-2893,-2858,-2820,-2778,-2738,-2684,-2643,-2598,-2558,-2514,-2476,-2447,-2408,-2378,-2336,
+-2302,-2264,-2239,-2201,-2168,-2127,-2105,-2060,-2029,-1979,-1936,-1874,-1794,-1730,-1652,-1573,
+-1481,-1404,-1323,-1250,-1166,-1067,-972,-878,-798,-710,-596,-496,-408,-300,-193,-88,
+29,146,265,381,484,601,711,811,912,1005,1086,1175,1266,1341,1421,1502,
+1581,1671,1746,1820,1893,1978,2040,2106,2159,2222,2254,2304,2325,2349,2384,2393,
+2417,2418,2430,2434,2425,2407,2414,2398,2382,2367,2336,2311,2267,2228,2182,2116,
+2065,2013,1950,1884,1820,1768,1708,1660,1602,1538,1462,1405,1325,1243,1167,1075,
+975,863,762,652,534,435,321,187,53,-67,-202,-326,-469,-614,-747,-888,
+-1012,-1142,-1256,-1376,-1500,-1588,-1688,-1766,-1842,-1899,-1957,-2008,-2040,-2061,-2091,-2125,
+-2142,-2143,-2141,-2136,-2108,-2097,-2079,-2026,-1973,-1924,-1856,-1780,-1704,-1601,-1492,-1395,
+-1302,-1206,-1107,-1012,-905,-808,-698,-595,-482,-389,-275,-158,-41,80,201,329,
+446,572,693,797,897,992,1089,1155,1226,1294,1363,1410,1455,1498,1543,1591,
+1637,1676,1701,1734,1765,1801,1818,1858,1878,1906,1925,1941,1947,1972,1999,2013,
+2027,2040,2057,2064,2089,2107,2125,2135,2133,2151,2152,2139,2108,2092,2062,2031,
+1994,1920,1868,1811,1751,1676,1589,1508,1416,1325,1211,1091,976,856,721,601,
+469,343,213,95,-21,-130,-240,-337,-422,-504,-580,-662,-720,-776,-842,-877,
+-930,-963,-1000,-1038,-1070,-1116,-1131,-1160,-1167,-1177,-1190,-1208,-1221,-1222,-1223,-1231,
+-1236,-1238,-1251,-1272,-1291,-1305,-1330,-1347,-1369,-1407,-1427,-1456,-1463,-1485,-1503,-1533,
+-1538,-1547,-1548,-1546,-1540,-1529,-1520,-1497,-1454,-1410,-1361,-1288,-1216,-1128,-1046,-955,
+-841,-742,-631,-514,-406,-279,-166,-59,40,133,235,317,409,488,566,637,
+700,772,827,882,919,944,960,975,962,965,944,923,877,841,785,711,
+646,571,485,421,344,271,181,95,5,-80,-165,-252,-342,-422,-506,-585,
+-685,-781,-873,-955,-1028,-1099,-1169,-1222,-1276,-1310,-1354,-1380,-1404,-1423,-1417,-1406,
+-1400,-1385,-1354,-1324,-1269,-1224,-1165,-1100,-1041,-968,-882,-794,-696,-584,-487,-376,
+-266,-146,-51,61,176,289,392,495,585,683,774,844,914,981,1040,1075,
+1127,1160,1195,1214,1231,1238,1250,1262,1253,1255,1250,1247,1244,1229,1205,1180,
+1166,1162,1145,1112,1089,1056,1043,986,959,938,901,872,834,803,781,773,
+758,737,728,728,726,730,733,737,739,737,733,720,713,692,685,651,
+636,609,592,576,552,552,538,528,523,526,521,519,515,508,519,524,
+526,535,547,563,595,624,650,686,740,801,856,933,1001,1069,1142,1224,
+1293,1364,1424,1486,1543,1583,1638,1662,1704,1715,1741,1740,1734,1710,1684,1641,
+1566,1474,1368,1245,1108,950,785,599,433,229,43,-152,-338,-503,-682,-842,
+-1001,-1145,-1290,-1413,-1523,-1634,-1724,-1793,-1876,-1909,-1965,-1983,-2003,-1987,-1978,-1967,
+-1945,-1900,-1862,-1822,-1776,-1724,-1658,-1599,-1544,-1481,-1435,-1375,-1333,-1283,-1229,-1196,
+-1156,-1106,-1057,-1018,-970,-934,-896,-854,-829,-793,-764,-719,-675,-639,-604,-559,
+-512,-476,-432,-390,-349,-314,-270,-222,-168,-135,-94,-67,-30,-12,20,43,
+69,81,93,113,127,135,134,130,132,103,80,47,-2,-33,-80,-152,
+-221,-289,-368,-451,-533,-624,-716,-808,-899,-985,-1083,-1171,-1256,-1344,-1432,-1515,
+-1588,-1659,-1720,-1775,-1832,-1882,-1925,-1969,-1994,-2019,-2040,-2059,-2060,-2062,-2061,-2073,
+-2058,-2056,-2054,-2057,-2067,-2059,-2044,-2036,-2038,-2034,-2021,-1989,-1969,-1930,-1878,-1839,
+-1798,-1745,-1677,-1623,-1575,-1526,-1472,-1404,-1365,-1306,-1270,-1211,-1165,-1118,-1066,-1025,
+-958,-900,-835,-785,-703,-630,-568,-491,-410,-320,-232,-168,-83,-8,85,176,
+266,360,465,573,685,801,926,1035,1151,1273,1381,1495,1611,1721,1825,1926,
+2017,2114,2207,2306,2409,2509,2617,2732,2850,2963,3082,3222,3342,3471,3585,3698,
+3802,3892,3978,4059,4126,4172,4208,4238,4238,4245,4239,4202,4159,4089,4017,3930,
+3809,3684,3551,3419,3270,3098,2929,2765,2615,2456,2290,2134,1998,1858,1720,1598,
+1462,1335,1192,1067,938,814,685,556,424,309,197,80,-20,-118,-200,-266,
+-341,-401,-458,-507,-553,-598,-633,-667,-688,-734,-768,-787,-812,-840,-841,-856,
+-854,-863,-860,-860,-861,-875,-869,-891,-914,-939,-967,-1000,-1041,-1072,-1109,-1139,
+-1176,-1194,-1237,-1264,-1288,-1302,-1316,-1339,-1350,-1369,-1382,-1426,-1458,-1486,-1519,-1558,
+-1591,-1644,-1684,-1734,-1765,-1805,-1845,-1881,-1932,-1964,-1997,-2027,-2061,-2090,-2128,-2149,
+-2187,-2214,-2256,-2283,-2321,-2322,-2330,-2317,-2307,-2280,-2240,-2210,-2157,-2115,-2072,-2030,
+-1975,-1932,-1883,-1830,-1783,-1734,-1693,-1637,-1583,-1542,-1484,-1443,-1388,-1322,-1257,-1200,
+-1147,-1093,-1052,-990,-930,-884,-851,-783,-721,-677,-639,-596,-546,-493,-458,-430,
+-391,-344,-315,-299,-265,-248,-224,-211,-201,-193,-167,-153,-132,-131,-120,-96,
+-64,-54,-34,-29,-3,8,22,25,24,40,34,29,31,37,39,48,
+49,65,56,60,77,97,129,155,165,195,214,247,279,321,371,408,
+462,493,571,623,686,753,815,897,950,1020,1097,1169,1218,1294,1354,1403,
+1447,1506,1530,1575,1626,1656,1705,1715,1756,1780,1807,1819,1838,1874,1899,1913,
+1912,1910,1911,1903,1873,1842,1797,1744,1685,1626,1545,1466,1371,1284,1191,1106,
+1011,928,839,740,633,534,439,351,268,188,118,56,0,-47,-90,-111,
+-146,-164,-188,-187,-194,-191,-176,-171,-147,-135,-106,-85,-60,-24,25,79,
+139,204,279,346,424,511,600,701,806,907,1012,1118,1220,1322,1447,1562,
+1682,1776,1879,2006,2096,2196,2303,2400,2482,2548,2611,2686,2735,2760,2803,2822,
+2822,2816,2801,2782,2757,2725,2679,2612,2529,2449,2350,2247,2137,1999,1875,1718,
+1569,1402,1242,1071,886,691,513,325,148,-28,-205,-382,-544,-720,-878,-1023,
+-1171,-1298,-1432,-1539,-1644,-1735,-1813,-1891,-1943,-1985,-2012,-2029,-2035,-2038,-2038,-2043,
+-2028,-2009,-1989,-1960,-1953,-1929,-1903,-1864,-1822,-1785,-1755,-1696,-1645,-1591,-1535,-1480,
+-1421,-1359,-1309,-1260,-1222,-1187,-1150,-1122,-1093,-1090,-1093,-1078,-1107,-1132,-1166,-1192,
+-1215,-1244,-1276,-1306,-1348,-1387,-1419,-1454,-1466,-1474,-1497,-1494,-1508,-1481,-1462,-1467,
+-1455,-1445,-1401,-1355,-1312,-1281,-1234,-1180,-1129,-1073,-1018,-950,-886,-833,-778,-722,
+-662,-612,-568,-531,-492,-465,-427,-412,-408,-414,-407,-414,-435,-435,-454,-482,
+-518,-548,-594,-614,-645,-686,-721,-761,-802,-831,-853,-887,-916,-933,-939,-963,
+-967,-958,-945,-912,-881,-850,-798,-746,-673,-596,-512,-429,-358,-272,-186,-93,
+-4,70,165,254,336,425,504,598,673,753,833,911,983,1051,1124,1191,
+1254,1307,1372,1432,1479,1531,1587,1639,1696,1746,1793,1852,1893,1954,2018,2079,
+2142,2197,2244,2298,2332,2364,2383,2387,2375,2350,2324,2266,2204,2125,2019,1928,
+1819,1716,1590,1466,1337,1199,1058,908,767,633,493,357,224,90,-38,-155,
+-282,-406,-517,-617,-729,-830,-918,-1003,-1090,-1160,-1218,-1291,-1352,-1415,-1468,-1528,
+-1569,-1630,-1668,-1700,-1731,-1751,-1764,-1773,-1769,-1756,-1740,-1705,-1673,-1634,-1588,-1563,
+-1512,-1470,-1408,-1357,-1295,-1238,-1170,-1104,-1025,-931,-852,-769,-679,-588,-490,-405,
+-337,-248,-172,-78,8,86,160,249,324,402,468,541,615,691,748,818,
+883,923,964,1002,1044,1061,1078,1091,1101,1117,1128,1128,1130,1127,1132,1136,
+1132,1134,1119,1114,1116,1102,1101,1087,1089,1071,1043,1024,1009,977,969,945,
+933,927,911,887,868,844,822,793,779,768,746,721,701,691,674,663,
+665,652,661,663,681,672,663,652,647,637,619,603,569,527,462,409,
+368,302,250,195,139,73,17,-35,-97,-146,-199,-268,-304,-369,-426,-484,
+-538,-604,-669,-740,-812,-865,-922,-1004,-1066,-1122,-1183,-1242,-1308,-1380,-1446,-1526,
+-1614,-1702,-1791,-1883,-1966,-2069,-2153,-2253,-2335,-2419,-2481,-2523,-2577,-2608,-2633,-2656,
+-2660,-2664,-2634,-2611,-2578,-2537,-2492,-2430,-2365,-2268,-2172,-2077,-1953,-1828,-1696,-1566,
+-1432,-1270,-1118,-958,-811,-652,-495,-346,-199,-54,69,191,322,439,565,671,
+768,850,935,1005,1080,1148,1212,1272,1319,1369,1428,1477,1519,1550,1601,1651,
+1713,1762,1831,1880,1933,1992,2062,2132,2189,2243,2296,2350,2402,2437,2467,2485,
+2489,2492,2491,2467,2435,2413,2378,2314,2260,2170,2096,2015,1919,1835,1734,1620,
+1514,1404,1289,1174,1064,957,840,746,643,539,437,339,248,160,63,-36,
+-110,-189,-258,-347,-426,-493,-568,-641,-709,-764,-821,-867,-912,-963,-991,-1018,
+-1036,-1069,-1088,-1110,-1133,-1154,-1169,-1179,-1177,-1194,-1198,-1199,-1193,-1182,-1181,-1166,
+-1143,-1122,-1097,-1069,-1046,-1008,-994,-941,-916,-865,-834,-791,-749,-697,-646,-584,
+-535,-476,-417,-352,-284,-214,-144,-82,-19,48,120,178,260,310,366,418,
+478,535,577,621,664,715,750,784,803,845,896,929,945,971,981,1027,
+1040,1061,1079,1082,1086,1105,1116,1105,1107,1090,1090,1075,1045,1013,973,935,
+878,831,764,714,646,588,520,456,381,322,242,178,97,33,-50,-116,
+-183,-255,-328,-399,-458,-525,-581,-640,-691,-724,-739,-773,-795,-814,-820,-812,
+-814,-823,-815,-800,-787,-767,-758,-733,-720,-691,-656,-632,-597,-561,-525,-479,
+-442,-399,-354,-305,-273,-243,-204,-200,-183,-174,-172,-165,-180,-196,-209,-226,
+-239,-272,-315,-356,-399,-427,-489,-544,-607,-662,-718,-762,-797,-828,-859,-893,
+-915,-929,-933,-927,-922,-914,-911,-897,-882,-850,-827,-803,-768,-742,-706,-696,
+-651,-612,-583,-567,-535,-511,-507,-489,-491,-481,-476,-491,-505,-519,-534,-566,
+-580,-590,-614,-631,-618,-632,-624,-636,-618,-602,-594,-582,-562,-544,-510,-468,
+-452,-424,-381,-348,-307,-261,-220,-172,-120,-65,-35,30,82,137,188,230,
+279,309,356,385,420,455,485,518,545,559,574,595,625,639,643,648,
+654,672,673,684,672,657,643,628,616,604,588,575,549,544,545,541,
+534,540,550,565,575,582,597,604,606,614,618,624,634,622,610,608,
+608,604,589,590,589,587,594,612,609,608,602,593,587,575,561,540,
+546,532,525,517,497,496,491,499,506,503,505,500,501,500,487,480,
+450,426,403,385,359,337,309,288,248,240,212,184,175,151,128,95,
+57,33,-6,-43,-83,-122,-168,-226,-262,-305,-373,-414,-461,-498,-552,-580,
+-613,-651,-679,-709,-726,-748,-776,-799,-820,-826,-837,-852,-862,-848,-843,-832,
+-825,-809,-782,-733,-700,-666,-621,-580,-517,-449,-397,-332,-268,-193,-140,-57,
+7,81,157,219,286,336,393,441,502,546,603,644,683,735,784,815,
+876,909,946,982,1021,1037,1055,1063,1081,1082,1078,1037,1007,970,938,888,
+837,786,715,675,634,594,541,483,463,421,379,364,319,282,258,232,
+206,189,173,152,138,134,124,116,121,139,144,164,197,195,213,221,
+227,227,235,244,251,240,243,226,243,226,209,193,172,144,110,70,
+12,-48,-123,-210,-314,-414,-521,-637,-762,-900,-1040,-1156,-1288,-1410,-1535,-1637,
+-1731,-1826,-1915,-2002,-2083,-2175,-2238,-2304,-2354,-2417,-2451,-2479,-2502,-2516,-2512,-2509,
+-2491,-2464,-2443,-2418,-2374,-2336,-2281,-2237,-2196,-2134,-2086,-2024,-1965,-1891,-1809,-1724,
+-1643,-1544,-1448,-1352,-1250,-1142,-1021,-919,-805,-712,-609,-523,-428,-353,-271,-193,
+-121,-52,7,80,130,200,260,334,384,442,476,535,575,614,649,687,
+724,761,795,828,868,924,975,1016,1058,1115,1177,1247,1308,1370,1424,1489,
+1567,1636,1699,1751,1835,1898,1965,2025,2094,2165,2213,2282,2333,2370,2405,2436,
+2459,2465,2478,2484,2467,2440,2407,2372,2334,2288,2243,2197,2163,2113,2081,2046,
+2002,1982,1929,1900,1871,1852,1822,1791,1743,1711,1670,1648,1613,1594,1562,1528,
+1494,1481,1438,1397,1352,1298,1244,1170,1073,982,880,775,646,523,386,250,
+112,-31,-165,-305,-442,-589,-713,-840,-947,-1064,-1158,-1260,-1340,-1421,-1488,-1546,
+-1601,-1644,-1687,-1712,-1734,-1751,-1755,-1746,-1733,-1707,-1686,-1654,-1621,-1591,-1529,-1490,
+-1427,-1353,-1274,-1209,-1124,-1033,-937,-845,-741,-642,-538,-427,-329,-230,-131,-26,
+83,181,264,367,456,557,654,739,820,914,991,1078,1140,1221,1281,1348,
+1396,1461,1502,1549,1579,1604,1633,1651,1667,1664,1664,1671,1644,1631,1592,1562,
+1501,1446,1377,1295,1198,1091,970,853,723,594,467,344,205,75,-56,-170,
+-294,-405,-519,-620,-745,-841,-948,-1043,-1142,-1220,-1307,-1389,-1449,-1504,-1554,-1598,
+-1638,-1671,-1695,-1715,-1736,-1757,-1776,-1772,-1785,-1791,-1807,-1793,-1793,-1787,-1773,-1752,
+-1720,-1694,-1658,-1619,-1574,-1533,-1499,-1469,-1436,-1407,-1386,-1366,-1345,-1334,-1326,-1335,
+-1337,-1336,-1343,-1348,-1347,-1352,-1336,-1340,-1324,-1326,-1316,-1312,-1282,-1245,-1229,-1197,
+-1165,-1130,-1121,-1086,-1032,-986,-942,-919,-873,-818,-767,-725,-683,-643,-609,-591,
+-573,-546,-537,-524,-521,-509,-512,-511,-522,-510,-510,-504,-494,-496,-479,-472,
+-448,-444,-424,-412,-384,-372,-358,-345,-305,-268,-222,-182,-151,-120,-71,7,
+65,138,205,265,324,394,461,525,588,648,706,759,821,880,944,981,
+1036,1088,1143,1188,1232,1280,1332,1370,1400,1426,1441,1445,1457,1477,1479,1487,
+1505,1508,1531,1539,1576,1618,1661,1727,1794,1850,1904,1976,2053,2131,2185,2243,
+2297,2364,2437,2501,2556,2605,2647,2690,2714,2745,2760,2764,2761,2727,2682,2621,
+2559,2458,2377,2260,2144,2007,1876,1737,1590,1470,1323,1179,1038,900,747,590,
+442,299,145,-6,-164,-323,-486,-644,-789,-926,-1067,-1203,-1331,-1446,-1562,-1657,
+-1751,-1845,-1926,-2003,-2063,-2131,-2184,-2239,-2277,-2321,-2326,-2328,-2344,-2335,-2324,-2275,
+-2256,-2205,-2165,-2095,-2032,-1955,-1880,-1790,-1709,-1607,-1507,-1395,-1292,-1192,-1075,-950,
+-816,-705,-581,-464,-336,-238,-130,-40,51,138,203,264,311,355,393,409,
+409,415,403,383,341,293,236,154,79,1,-102,-205,-319,-428,-556,-678,
+-810,-917,-1030,-1132,-1238,-1336,-1429,-1522,-1593,-1690,-1768,-1847,-1924,-2007,-2066,-2128,
+-2195,-2249,-2288,-2328,-2345,-2363,-2372,-2380,-2371,-2349,-2340,-2318,-2299,-2265,-2234,-2204,
+-2170,-2137,-2089,-2041,-1991,-1924,-1854,-1779,-1701,-1611,-1508,-1407,-1305,-1201,-1092,-978,
+-858,-741,-611,-484,-358,-237,-113,14,161,293,416,540,674,814,951,1076,
+1198,1321,1433,1540,1647,1736,1830,1910,1992,2064,2130,2186,2242,2299,2357,2416,
+2478,2527,2570,2603,2635,2662,2669,2679,2660,2647,2615,2587,2542,2504,2440,2382,
+2340,2289,2231,2174,2115,2073,2021,1981,1930,1887,1843,1794,1762,1733,1699,1660,
+1632,1601,1565,1524,1486,1455,1411,1365,1315,1257,1193,1118,1043,952,871,766,
+668,555,456,349,238,130,36,-76,-171,-267,-345,-434,-512,-597,-687,-759,
+-822,-881,-940,-989,-1037,-1057,-1075,-1088,-1071,-1082,-1073,-1062,-1041,-1019,-1001,-986,
+-952,-940,-921,-919,-901,-892,-874,-870,-854,-846,-824,-800,-807,-777,-757,-751,
+-739,-722,-707,-674,-672,-658,-635,-606,-584,-574,-565,-543,-516,-492,-458,-414,
+-366,-330,-272,-217,-144,-90,-11,37,114,164,229,275,335,376,418,452,
+489,528,566,601,620,651,675,698,723,729,744,744,753,752,754,740,
+736,730,735,735,736,745,745,757,746,753,749,755,744,754,747,736,
+731,718,717,710,695,705,688,690,697,710,731,742,757,780,792,812,
+806,812,830,829,836,810,805,787,777,749,735,687,644,608,560,504,
+434,361,280,200,107,0,-109,-224,-332,-440,-538,-646,-759,-862,-964,-1071,
+-1161,-1247,-1331,-1396,-1467,-1531,-1592,-1626,-1663,-1671,-1701,-1713,-1724,-1720,-1720,-1714,
+-1698,-1690,-1658,-1631,-1601,-1571,-1534,-1486,-1448,-1423,-1368,-1312,-1258,-1210,-1146,-1090,
+-1020,-970,-910,-861,-788,-734,-661,-609,-565,-485,-451,-398,-354,-321,-283,-239,
+-203,-163,-132,-93,-68,-41,-9,26,54,66,66,72,92,96,96,103,
+103,104,95,95,91,96,93,86,95,95,90,81,78,81,69,62,
+58,46,29,19,0,-7,-21,-37,-49,-75,-78,-91,-101,-109,-123,-135,
+-139,-142,-153,-159,-165,-179,-180,-187,-200,-212,-197,-198,-200,-189,-169,-150,
+-129,-103,-63,-28,14,62,102,162,229,291,357,429,512,592,672,750,
+842,929,1023,1115,1200,1261,1340,1423,1495,1561,1630,1693,1744,1785,1843,1879,
+1900,1918,1921,1936,1943,1942,1905,1877,1851,1813,1772,1731,1664,1602,1535,1455,
+1368,1276,1189,1117,1021,923,821,714,612,518,426,335,226,129,25,-53,
+-144,-224,-319,-394,-462,-537,-601,-664,-718,-761,-807,-862,-918,-954,-992,-1021,
+-1071,-1097,-1132,-1171,-1191,-1214,-1217,-1222,-1221,-1208,-1194,-1183,-1162,-1128,-1090,-1050,
+-1025,-999,-944,-894,-848,-800,-745,-705,-662,-613,-569,-523,-478,-410,-361,-292,
+-249,-193,-130,-73,-17,25,69,112,144,196,234,260,283,318,354,391,
+421,450,484,522,534,541,568,580,586,573,554,542,521,493,463,425,
+392,358,319,298,253,234,203,174,135,123,93,79,56,46,30,31,
+34,31,38,40,63,77,100,121,176,206,241,284,318,379,412,466,
+498,564,606,665,701,741,804,859,903,946,995,1028,1057,1079,1108,1121,
+1105,1090,1076,1055,1027,993,950,903,851,801,736,676,611,532,445,364,
+280,190,93,-7,-102,-205,-300,-386,-490,-588,-685,-767,-860,-955,-1039,-1130,
+-1222,-1323,-1404,-1497,-1590,-1678,-1763,-1850,-1935,-2018,-2101,-2166,-2213,-2246,-2293,-2330,
+-2352,-2354,-2351,-2364,-2370,-2372,-2357,-2334,-2315,-2303,-2286,-2262,-2224,-2170,-2119,-2072,
+-2016,-1953,-1874,-1784,-1713,-1622,-1534,-1442,-1351,-1256,-1153,-1058,-958,-868,-773,-679,
+-574,-461,-345,-239,-142,-18,88,190,270,372,455,540,604,664,712,768,
+834,876,916,965,1011,1046,1087,1115,1147,1184,1220,1254,1277,1297,1328,1355,
+1380,1391,1417,1443,1470,1501,1538,1561,1589,1623,1652,1686,1715,1752,1783,1802,
+1831,1851,1862,1878,1880,1881,1887,1897,1909,1924,1923,1923,1917,1914,1922,1913,
+1903,1882,1857,1833,1784,1746,1695,1641,1580,1526,1450,1382,1297,1222,1135,1056,
+957,863,746,631,510,383,260,115,-25,-185,-317,-455,-599,-738,-880,-1008,
+-1138,-1262,-1367,-1473,-1587,-1682,-1796,-1891,-1991,-2078,-2174,-2256,-2326,-2396,-2445,-2477,
+-2506,-2533,-2532,-2531,-2527,-2496,-2465,-2420,-2379,-2323,-2297,-2229,-2173,-2114,-2046,-1981,
+-1910,-1820,-1747,-1678,-1603,-1531,-1450,-1376,-1292,-1229,-1160,-1096,-1035,-990,-924,-870,
+-826,-782,-740,-692,-656,-605,-551,-500,-450,-382,-341,-283,-237,-178,-123,-70,
+-27,34,74,122,186,249,300,347,406,457,515,572,622,667,738,783,
+833,879,931,973,1014,1068,1102,1126,1162,1184,1205,1236,1252,1268,1278,1296,
+1291,1287,1284,1290,1282,1278,1265,1256,1276,1283,1296,1316,1338,1373,1392,1421,
+1460,1511,1545,1583,1621,1656,1690,1704,1719,1737,1727,1737,1732,1726,1696,1681,
+1638,1592,1537,1473,1418,1355,1273,1170,1073,967,865,740,611,477,341,211,
+68,-63,-204,-346,-475,-603,-730,-858,-982,-1093,-1217,-1325,-1433,-1532,-1637,-1725,
+-1810,-1897,-1968,-2033,-2091,-2145,-2182,-2218,-2240,-2253,-2272,-2275,-2284,-2285,-2281,-2272,
+-2245,-2231,-2210,-2185,-2142,-2112,-2074,-2029,-1976,-1929,-1869,-1814,-1761,-1707,-1646,-1590,
+-1545,-1508,-1473,-1420,-1381,-1346,-1303,-1270,-1225,-1175,-1131,-1072,-1022,-959,-906,-850,
+-791,-728,-669,-611,-552,-507,-458,-409,-383,-333,-297,-251,-214,-184,-158,-112,
+-69,-42,-17,20,59,89,124,146,171,205,223,246,260,287,313,347,
+371,413,461,534,595,677,749,840,939,1040,1147,1252,1390,1514,1639,1761,
+1884,2015,2159,2299,2421,2557,2691,2804,2917,3017,3112,3198,3284,3335,3371,3392,
+3402,3392,3391,3363,3308,3262,3191,3124,3044,2944,2856,2758,2647,2526,2411,2308,
+2177,2063,1939,1829,1713,1599,1487,1371,1257,1157,1057,962,854,762,659,546,
+443,346,260,149,51,-49,-156,-245,-329,-404,-490,-552,-619,-672,-737,-789,
+-820,-844,-868,-888,-910,-915,-917,-905,-892,-870,-853,-826,-790,-738,-682,-645,
+-584,-542,-499,-442,-384,-347,-312,-293,-268,-247,-221,-217,-215,-209,-215,-227,
+-236,-264,-278,-307,-335,-359,-396,-429,-479,-519,-556,-600,-655,-688,-743,-784,
+-835,-862,-892,-926,-963,-985,-1003,-1011,-1032,-1050,-1067,-1080,-1086,-1087,-1099,-1104,
+-1115,-1105,-1118,-1114,-1114,-1107,-1097,-1091,-1078,-1076,-1077,-1066,-1042,-1021,-996,-987,
+-964,-955,-925,-897,-857,-830,-817,-779,-735,-684,-652,-611,-577,-545,-508,-464,
+-430,-401,-375,-341,-320,-298,-275,-248,-224,-212,-177,-143,-111,-97,-68,-67,
+-52,-39,-27,-38,-53,-64,-105,-117,-141,-164,-193,-238,-268,-296,-333,-355,
+-393,-408,-442,-471,-496,-528,-542,-570,-588,-595,-617,-620,-623,-621,-612,-603,
+-568,-541,-513,-449,-405,-334,-250,-184,-110,-25,68,158,254,341,443,537,
+646,756,872,988,1080,1188,1282,1394,1467,1551,1625,1690,1734,1774,1804,1826,
+1828,1826,1834,1816,1791,1752,1704,1668,1620,1571,1508,1442,1366,1293,1197,1084,
+987,889,787,689,582,494,402,311,241,169,95,34,-19,-61,-114,-149,
+-180,-221,-253,-276,-313,-334,-366,-388,-412,-419,-437,-448,-441,-431,-418,-390,
+-370,-342,-315,-269,-231,-181,-120,-66,-7,68,145,226,304,402,504,615,
+720,824,924,1041,1152,1251,1354,1458,1542,1629,1709,1781,1837,1894,1930,1964,
+1975,1983,1988,1975,1952,1909,1871,1807,1729,1647,1552,1458,1350,1231,1107,986,
+853,734,601,472,347,224,98,-40,-166,-285,-420,-554,-691,-828,-961,-1095,
+-1241,-1366,-1485,-1588,-1693,-1808,-1894,-1982,-2049,-2126,-2184,-2254,-2306,-2352,-2395,-2433,
+-2472,-2513,-2540,-2561,-2591,-2616,-2622,-2619,-2630,-2611,-2592,-2576,-2571,-2557,-2539,-2516,
+-2495,-2490,-2462,-2443,-2420,-2405,-2386,-2362,-2333,-2300,-2278,-2257,-2223,-2177,-2137,-2098,
+-2052,-1996,-1966,-1908,-1862,-1809,-1771,-1719,-1660,-1604,-1530,-1472,-1410,-1338,-1260,-1192,
+-1137,-1064,-994,-921,-846,-787,-728,-649,-593,-546,-494,-445,-395,-354,-308,-257,
+-219,-176,-141,-119,-97,-63,-30,4,17,68,106,144,172,207,270,330,
+391,446,495,567,649,724,792,864,956,1027,1113,1204,1294,1388,1460,1550,
+1635,1706,1802,1881,1952,2032,2099,2155,2212,2259,2311,2345,2383,2392,2402,2415,
+2413,2404,2387,2369,2345,2298,2271,2239,2222,2162,2101,2034,1964,1886,1819,1741,
+1654,1560,1466,1365,1255,1153,1076,958,857,768,668,573,485,387,292,202,
+115,33,-51,-129,-220,-302,-378,-444,-522,-577,-643,-706,-749,-783,-827,-843,
+-865,-879,-906,-926,-932,-922,-933,-938,-948,-957,-961,-950,-944,-950,-945,-934,
+-913,-903,-885,-863,-840,-812,-786,-778,-753,-721,-679,-637,-597,-563,-522,-507,
+-461,-430,-368,-317,-266,-213,-164,-116,-82,-27,28,90,144,175,218,271,
+315,378,436,489,532,576,626,687,737,805,848,904,953,1008,1058,1110,
+1161,1214,1257,1293,1344,1363,1394,1430,1443,1465,1481,1495,1509,1504,1491,1479,
+1458,1429,1395,1352,1304,1246,1196,1135,1075,1013,943,873,801,727,663,584,
+517,438,370,308,237,169,100,34,-23,-73,-133,-173,-214,-258,-287,-320,
+-358,-402,-442,-449,-482,-501,-516,-531,-547,-547,-548,-545,-550,-537,-540,-519,
+-500,-466,-442,-405,-373,-347,-324,-287,-263,-239,-223,-192,-160,-126,-97,-71,
+-19,22,71,118,171,225,285,329,366,412,447,492,532,550,561,576,
+603,611,623,613,602,567,535,506,449,388,327,265,182,89,3,-80,
+-180,-288,-395,-486,-574,-673,-745,-817,-896,-962,-1026,-1084,-1130,-1169,-1215,-1243,
+-1268,-1285,-1303,-1329,-1344,-1336,-1323,-1320,-1297,-1282,-1253,-1222,-1186,-1139,-1089,-1033,
+-976,-919,-873,-828,-784,-716,-653,-598,-556,-507,-447,-381,-319,-271,-210,-161,
+-113,-78,-42,12,36,83,109,132,172,196,227,247,286,306,338,361,
+386,404,425,435,442,455,450,451,450,445,429,418,386,368,347,329,
+290,269,242,204,158,116,78,34,-21,-77,-132,-174,-215,-247,-281,-323,
+-357,-377,-391,-396,-392,-378,-382,-370,-364,-344,-315,-291,-269,-248,-224,-199,
+-163,-139,-98,-58,-10,32,94,151,207,252,298,346,393,446,494,507,
+535,550,589,602,600,621,619,617,609,592,573,564,552,533,507,484,
+433,393,353,318,274,236,186,142,108,71,44,0,-12,-25,-56,-62,
+-77,-76,-72,-93,-104,-107,-125,-131,-140,-144,-143,-151,-160,-174,-179,-192,
+-204,-228,-249,-269,-294,-316,-336,-369,-406,-429,-454,-483,-507,-522,-524,-539,
+-551,-578,-604,-601,-587,-588,-595,-588,-575,-596,-592,-595,-595,-581,-573,-569,
+-567,-569,-566,-557,-534,-532,-511,-488,-484,-471,-454,-441,-424,-412,-395,-391,
+-394,-375,-359,-345,-328,-322,-307,-273,-263,-239,-225,-188,-149,-136,-88,-56,
+-4,30,70,136,179,232,287,353,424,503,567,650,710,777,827,890,
+926,970,1010,1048,1063,1063,1078,1066,1071,1065,1059,1036,1004,979,947,915,
+879,847,786,747,716,660,588,525,467,400,344,294,232,178,124,66,
+20,-32,-101,-153,-195,-248,-305,-364,-434,-477,-538,-595,-656,-714,-773,-815,
+-863,-893,-936,-952,-977,-1006,-1031,-1049,-1063,-1082,-1104,-1118,-1124,-1131,-1130,-1121,
+-1099,-1086,-1070,-1048,-994,-955,-919,-865,-818,-755,-695,-633,-560,-482,-405,-312,
+-233,-152,-65,19,110,189,279,362,428,505,584,641,708,765,819,859,
+897,927,935,954,958,966,973,974,966,967,967,957,942,930,919,896,
+887,862,837,803,789,757,722,672,646,611,585,549,518,499,456,432,
+395,346,312,273,228,177,137,108,69,33,19,-1,-17,-31,-36,-30,
+-10,-8,4,18,27,45,63,74,82,92,92,103,106,134,145,160,
+174,186,209,222,258,281,304,313,337,357,390,420,428,439,446,460,
+478,472,470,468,482,475,454,430,394,350,310,256,208,147,65,-11,
+-94,-179,-272,-340,-439,-505,-573,-658,-750,-800,-861,-920,-972,-1027,-1062,-1111,
+-1149,-1183,-1211,-1223,-1236,-1246,-1238,-1224,-1217,-1190,-1177,-1138,-1100,-1072,-1040,-989,
+-939,-879,-834,-779,-726,-681,-627,-572,-510,-457,-399,-338,-286,-218,-166,-109,
+-63,-11,42,93,125,170,215,258,311,365,414,467,510,567,622,673,
+726,767,820,856,909,944,986,1001,1029,1063,1076,1086,1110,1100,1118,1121,
+1109,1106,1084,1068,1044,1025,991,947,896,867,822,794,759,721,678,644,
+601,601,591,581,566,561,571,577,586,595,605,599,608,615,626,621,
+626,634,636,654,648,657,652,652,661,668,663,654,643,655,628,609,
+580,566,542,533,519,513,481,457,432,405,370,341,320,274,238,195,
+147,102,46,-26,-79,-142,-211,-269,-332,-391,-456,-529,-575,-627,-677,-733,
+-773,-819,-853,-888,-932,-966,-982,-1000,-1041,-1071,-1095,-1099,-1112,-1120,-1122,-1134,
+-1131,-1121,-1118,-1113,-1107,-1095,-1089,-1065,-1058,-1038,-1013,-995,-976,-968,-956,-941,
+-915,-901,-891,-887,-891,-872,-882,-877,-886,-907,-915,-920,-926,-947,-968,-981,
+-993,-1011,-1006,-1035,-1055,-1048,-1062,-1077,-1091,-1098,-1100,-1118,-1110,-1119,-1134,-1139,
+-1132,-1137,-1118,-1106,-1081,-1073,-1066,-1034,-1020,-994,-946,-913,-876,-843,-814,-776,
+-738,-673,-641,-584,-535,-500,-431,-367,-312,-249,-174,-84,-25,36,102,174,
+260,324,383,446,505,564,637,688,740,785,840,896,946,1004,1053,1105,
+1163,1210,1257,1290,1335,1398,1444,1493,1531,1584,1636,1692,1759,1797,1834,1872,
+1915,1961,1992,2024,2069,2094,2107,2113,2107,2127,2129,2132,2124,2114,2100,2097,
+2083,2074,2055,2016,2001,1952,1911,1864,1813,1764,1709,1637,1558,1480,1421,1354,
+1274,1188,1115,1049,968,899,834,760,684,635,563,499,433,381,323,262,
+222,173,125,98,69,48,12,-17,-46,-63,-92,-121,-140,-171,-175,-199,
+-228,-259,-280,-303,-342,-364,-396,-414,-467,-511,-556,-588,-636,-690,-735,-799,
+-867,-927,-983,-1049,-1110,-1177,-1241,-1292,-1352,-1403,-1456,-1517,-1570,-1618,-1674,-1723,
+-1785,-1841,-1879,-1943,-1983,-2027,-2051,-2078,-2095,-2101,-2114,-2101,-2112,-2087,-2068,-2046,
+-2016,-2011,-1981,-1945,-1918,-1874,-1834,-1793,-1774,-1727,-1695,-1647,-1587,-1533,-1484,-1422,
+-1373,-1307,-1230,-1178,-1109,-1045,-972,-913,-839,-776,-703,-623,-550,-481,-400,-315,
+-233,-147,-68,17,99,193,275,363,442,521,596,659,750,805,873,932,
+1002,1047,1096,1121,1165,1191,1211,1210,1212,1217,1193,1165,1133,1086,1025,958,
+891,820,735,646,557,483,397,316,217,151,68,-4,-81,-159,-235,-305,
+-351,-409,-455,-508,-556,-597,-634,-655,-674,-680,-695,-696,-687,-668,-653,-634,
+-605,-590,-563,-541,-508,-481,-456,-420,-394,-371,-348,-319,-297,-267,-244,-212,
+-202,-169,-151,-124,-110,-96,-92,-81,-64,-51,-43,-28,-13,-1,8,22,
+36,48,61,98,119,160,181,209,234,264,308,345,386,422,466,519,
+558,614,668,719,767,835,891,946,985,1037,1105,1154,1193,1250,1291,1346,
+1406,1453,1489,1525,1565,1619,1652,1689,1735,1775,1795,1811,1835,1846,1857,1857,
+1857,1859,1860,1848,1837,1811,1789,1761,1727,1711,1657,1618,1573,1531,1482,1419,
+1361,1285,1213,1140,1065,994,923,839,757,691,606,512,430,363,289,207,
+133,55,-24,-115,-181,-260,-326,-399,-476,-543,-623,-673,-726,-778,-832,-884,
+-930,-984,-1037,-1087,-1125,-1171,-1213,-1269,-1313,-1347,-1400,-1432,-1461,-1484,-1504,-1536,
+-1537,-1549,-1546,-1545,-1547,-1534,-1531,-1508,-1503,-1469,-1428,-1390,-1354,-1321,-1267,-1218,
+-1155,-1112,-1040,-977,-923,-866,-825,-769,-740,-700,-674,-629,-621,-586,-567,-569,
+-562,-563,-546,-549,-544,-551,-542,-560,-577,-606,-614,-631,-659,-695,-722,-756,
+-784,-820,-850,-878,-895,-897,-903,-905,-918,-925,-910,-896,-900,-875,-851,-815,
+-782,-751,-710,-659,-591,-538,-467,-393,-303,-206,-106,-8,99,229,325,430,
+522,629,727,815,894,964,1037,1103,1162,1197,1239,1260,1290,1291,1290,1285,
+1278,1261,1246,1223,1196,1159,1098,1042,990,954,884,827,777,716,670,630,
+578,523,488,441,393,354,298,254,194,152,102,66,6,-42,-93,-137,
+-166,-218,-243,-284,-324,-364,-399,-440,-470,-514,-534,-567,-588,-605,-622,-637,
+-643,-642,-634,-617,-612,-601,-588,-552,-525,-499,-469,-426,-401,-349,-305,-257,
+-200,-159,-87,-26,46,114,184,240,310,373,421,478,524,561,616,641,
+660,688,711,722,726,722,723,723,704,687,680,652,627,600,556,507,
+468,440,400,359,318,270,233,203,156,134,98,79,42,17,-7,-34,
+-38,-73,-85,-108,-133,-130,-128,-118,-115,-105,-67,-30,23,80,130,192,
+262,341,436,522,620,692,794,876,957,1041,1137,1215,1299,1383,1459,1530,
+1596,1657,1713,1767,1816,1875,1911,1928,1941,1949,1950,1942,1931,1907,1893,1860,
+1815,1761,1718,1660,1590,1515,1449,1360,1266,1167,1054,951,836,725,605,499,
+383,273,145,30,-89,-183,-286,-395,-508,-592,-684,-745,-833,-915,-995,-1055,
+-1107,-1167,-1226,-1257,-1304,-1350,-1366,-1379,-1390,-1383,-1404,-1409,-1411,-1411,-1414,-1415,
+-1414,-1407,-1402,-1401,-1384,-1368,-1361,-1346,-1328,-1303,-1283,-1274,-1240,-1207,-1178,-1145,
+-1126,-1104,-1081,-1063,-1047,-1025,-1004,-993,-957,-945,-935,-918,-894,-873,-860,-852,
+-823,-810,-809,-789,-786,-782,-785,-778,-780,-785,-792,-806,-803,-808,-810,-822,
+-809,-823,-824,-827,-831,-830,-832,-839,-837,-840,-834,-833,-820,-822,-792,-764,
+-733,-695,-654,-595,-527,-457,-377,-310,-218,-125,-31,61,142,238,347,449,
+557,662,762,871,967,1064,1157,1265,1344,1414,1469,1534,1585,1640,1653,1684,
+1692,1710,1718,1721,1718,1708,1699,1695,1689,1663,1641,1624,1617,1592,1561,1518,
+1475,1438,1394,1343,1294,1254,1198,1138,1092,1045,1001,961,938,892,866,835,
+818,799,771,752,727,712,699,668,647,622,612,601,571,562,525,499,
+460,445,406,371,320,274,216,164,103,39,-23,-78,-136,-205,-267,-318,
+-380,-433,-495,-568,-635,-690,-743,-815,-875,-964,-1015,-1082,-1126,-1178,-1229,-1280,
+-1320,-1358,-1391,-1419,-1433,-1448,-1457,-1462,-1476,-1480,-1489,-1489,-1479,-1473,-1469,-1459,
+-1447,-1428,-1417,-1392,-1372,-1349,-1331,-1292,-1274,-1225,-1191,-1166,-1131,-1105,-1068,-1021,
+-988,-965,-935,-887,-834,-786,-743,-679,-609,-561,-502,-437,-375,-290,-229,-151,
+-83,-16,46,130,196,268,348,420,490,558,624,674,740,802,842,899,
+935,976,1021,1036,1056,1075,1086,1101,1111,1118,1111,1098,1093,1090,1079,1068,
+1050,1048,1026,998,974,936,909,856,819,775,720,678,624,573,539,509,
+489,439,394,377,337,297,269,237,205,172,136,117,67,51,26,21,
+-10,-27,-50,-62,-79,-106,-132,-151,-171,-196,-213,-245,-258,-282,-312,-351,
+-374,-401,-440,-475,-509,-528,-571,-624,-667,-725,-775,-820,-880,-946,-1017,-1084,
+-1150,-1223,-1297,-1359,-1431,-1505,-1587,-1649,-1720,-1781,-1847,-1895,-1942,-1988,-2031,-2079,
+-2114,-2148,-2179,-2191,-2191,-2200,-2200,-2190,-2180,-2162,-2128,-2085,-2059,-2012,-1966,-1915,
+-1863,-1819,-1748,-1680,-1599,-1534,-1467,-1378,-1299,-1217,-1130,-1043,-950,-857,-768,-666,
+-582,-472,-375,-285,-196,-116,-23,58,140,221,303,381,462,527,595,668,
+742,807,879,944,1011,1071,1119,1181,1253,1317,1384,1461,1523,1597,1669,1753,
+1811,1885,1962,2029,2104,2163,2230,2278,2330,2359,2395,2429,2437,2450,2460,2447,
+2440,2420,2399,2372,2336,2297,2241,2198,2128,2073,2006,1923,1842,1764,1687,1585,
+1499,1405,1307,1218,1105,1004,898,794,686,593,484,386,290,203,111,27,
+-74,-151,-236,-296,-376,-453,-513,-580,-613,-650,-698,-741,-785,-811,-848,-883,
+-936,-966,-997,-1032,-1068,-1097,-1127,-1134,-1173,-1199,-1210,-1232,-1251,-1248,-1266,-1285,
+-1313,-1326,-1325,-1327,-1335,-1324,-1322,-1323,-1311,-1315,-1298,-1276,-1250,-1224,-1179,-1143,
+-1096,-1044,-995,-949,-889,-834,-778,-725,-663,-613,-561,-502,-447,-401,-361,-299,
+-243,-194,-141,-103,-54,12,48,97,135,173,208,248,275,319,338,367,
+397,434,469,515,559,586,617,654,714,755,807,833,884,929,959,1007,
+1067,1112,1147,1202,1258,1304,1346,1399,1443,1482,1512,1542,1563,1586,1596,1598,
+1597,1608,1605,1602,1589,1572,1550,1541,1526,1506,1483,1456,1448,1412,1397,1369,
+1350,1322,1289,1247,1227,1190,1131,1095,1055,1004,965,910,860,817,742,700,
+629,588,544,477,408,334,285,237,181,110,43,-1,-43,-95,-140,-179,
+-209,-247,-292,-326,-349,-379,-402,-441,-482,-522,-550,-592,-609,-641,-669,-693,
+-719,-742,-785,-813,-858,-903,-945,-992,-1030,-1072,-1124,-1171,-1220,-1239,-1282,-1300,
+-1332,-1372,-1398,-1428,-1440,-1453,-1463,-1473,-1503,-1505,-1522,-1528,-1537,-1534,-1542,-1548,
+-1536,-1530,-1523,-1513,-1486,-1449,-1415,-1393,-1356,-1321,-1277,-1233,-1181,-1139,-1094,-1038,
+-986,-928,-868,-798,-728,-667,-609,-535,-464,-386,-321,-261,-203,-139,-97,-43,
+6,49,93,125,172,192,221,253,276,297,303,311,319,322,331,339,
+323,304,297,299,295,280,285,290,290,282,289,300,317,340,369,404,
+444,481,514,564,621,661,706,752,805,870,907,957,1006,1058,1099,1145,
+1185,1220,1254,1280,1316,1349,1374,1401,1414,1433,1445,1461,1463,1480,1493,1496,
+1490,1501,1529,1553,1572,1586,1594,1611,1633,1653,1684,1717,1735,1736,1749,1757,
+1773,1770,1767,1765,1757,1740,1724,1692,1659,1616,1576,1516,1450,1360,1273,1178,
+1078,965,865,749,642,525,414,299,196,83,-17,-132,-231,-314,-416,-517,
+-610,-692,-780,-835,-918,-986,-1049,-1108,-1161,-1195,-1227,-1246,-1283,-1297,-1313,-1320,
+-1329,-1330,-1354,-1342,-1355,-1352,-1340,-1341,-1335,-1326,-1314,-1297,-1283,-1262,-1252,-1221,
+-1186,-1163,-1134,-1103,-1076,-1056,-1017,-976,-960,-944,-920,-891,-878,-839,-829,-818,
+-806,-780,-755,-738,-711,-702,-691,-666,-638,-606,-579,-561,-542,-538,-504,-475,
+-446,-420,-376,-340,-306,-279,-249,-220,-182,-152,-109,-63,-46,-22,14,29,
+60,88,114,149,193,212,236,251,267,287,299,326,333,342,353,360,
+362,368,371,379,375,376,385,379,372,364,369,355,352,343,329,313,
+283,261,225,188,152,127,99,56,16,-17,-59,-91,-110,-133,-160,-199,
+-247,-279,-298,-328,-366,-382,-412,-434,-447,-461,-465,-469,-457,-468,-475,-459,
+-456,-441,-453,-439,-434,-450,-464,-466,-466,-494,-503,-517,-524,-539,-540,-544,
+-562,-569,-595,-613,-626,-654,-674,-697,-722,-753,-774,-803,-823,-853,-875,-884,
+-894,-895,-891,-895,-889,-889,-874,-850,-834,-802,-773,-737,-719,-689,-641,-598,
+-566,-530,-503,-466,-424,-380,-337,-306,-276,-246,-233,-218,-194,-186,-174,-168,
+-176,-175,-163,-151,-148,-154,-149,-136,-135,-111,-106,-92,-76,-53,-34,-6,
+34,76,116,163,201,269,329,398,486,569,655,733,825,923,1017,1102,
+1190,1273,1365,1442,1515,1587,1672,1738,1799,1867,1919,1965,2012,2048,2073,2089,
+2113,2117,2114,2087,2058,2023,1977,1942,1877,1809,1728,1652,1585,1517,1446,1352,
+1267,1190,1095,988,894,799,711,613,515,422,332,241,172,85,20,-42,
+-100,-164,-225,-266,-297,-331,-366,-391,-428,-461,-468,-493,-512,-521,-522,-534,
+-536,-538,-529,-527,-519,-513,-509,-507,-503,-496,-491,-480,-477,-506,-505,-522,
+-526,-544,-553,-569,-572,-574,-576,-569,-565,-552,-537,-537,-540,-524,-519,-484,
+-495,-493,-491,-492,-490,-488,-476,-483,-496,-500,-493,-506,-521,-534,-563,-585,
+-636,-674,-711,-762,-814,-884,-933,-1004,-1073,-1129,-1189,-1256,-1311,-1379,-1429,-1488,
+-1532,-1578,-1629,-1668,-1712,-1751,-1781,-1808,-1822,-1840,-1848,-1869,-1859,-1863,-1864,-1845,
+-1820,-1788,-1751,-1716,-1674,-1635,-1576,-1506,-1448,-1382,-1303,-1223,-1146,-1062,-971,-885,
+-790,-685,-577,-482,-376,-285,-202,-138,-66,18,102,169,241,297,349,403,
+458,520,557,590,622,644,683,703,722,733,751,761,763,773,774,760,
+755,758,763,775,775,777,778,800,795,815,829,848,864,886,909,936,
+963,982,1004,1031,1055,1096,1135,1173,1191,1237,1269,1304,1334,1362,1391,1429,
+1447,1455,1465,1471,1471,1476,1482,1473,1473,1471,1454,1422,1403,1388,1360,1326,
+1298,1281,1251,1202,1172,1135,1104,1070,1024,991,947,896,873,840,793,759,
+733,707,675,641,597,572,529,487,459,407,364,321,285,243,210,178,
+132,95,53,11,-26,-61,-84,-127,-166,-230,-275,-320,-359,-415,-456,-489,
+-536,-577,-601,-625,-650,-666,-688,-698,-701,-708,-702,-699,-705,-691,-682,-672,
+-658,-625,-590,-565,-517,-469,-430,-384,-337,-293,-252,-200,-148,-102,-66,-33,
+17,67,98,136,177,212,238,264,289,331,350,397,406,420,440,440,
+444,447,444,437,428,427,417,400,394,379,382,365,341,333,333,318,
+323,309,314,312,315,321,341,343,371,394,432,465,501,555,608,663,
+707,748,797,837,885,910,935,952,967,972,982,961,939,914,870,836,
+769,720,644,561,497,404,317,210,108,-10,-113,-231,-351,-478,-582,-699,
+-807,-925,-1013,-1109,-1198,-1275,-1358,-1449,-1504,-1570,-1636,-1686,-1741,-1793,-1835,-1883,
+-1921,-1934,-1940,-1942,-1949,-1958,-1945,-1939,-1924,-1915,-1882,-1850,-1814,-1793,-1770,-1753,
+-1716,-1683,-1663,-1628,-1588,-1552,-1516,-1476,-1438,-1384,-1338,-1302,-1240,-1196,-1166,-1110,
+-1052,-993,-933,-872,-819,-777,-717,-647,-576,-506,-443,-379,-309,-237,-165,-96,
+-16,52,131,194,265,338,408,483,554,620,703,764,849,901,961,1035,
+1105,1167,1204,1256,1310,1363,1381,1397,1412,1427,1449,1454,1463,1457,1449,1435,
+1439,1407,1397,1360,1352,1319,1295,1246,1214,1180,1135,1117,1070,1043,1014,999,
+978,963,943,950,938,933,910,912,900,903,896,883,878,848,844,816,
+794,777,771,760,727,698,678,657,643,614,588,552,509,469,440,407,
+355,304,270,231,185,139,106,60,31,-12,-59,-110,-170,-214,-263,-312,
+-364,-425,-474,-530,-582,-626,-680,-724,-761,-803,-828,-869,-905,-923,-934,-964,
+-987,-987,-996,-997,-997,-986,-988,-980,-971,-939,-929,-897,-855,-806,-764,-725,
+-675,-628,-567,-502,-440,-396,-330,-265,-194,-124,-56,25,92,151,216,269,
+351,392,453,513,570,618,664,693,731,757,788,821,843,871,906,927,
+961,990,1014,1036,1063,1094,1111,1133,1147,1154,1172,1164,1166,1165,1163,1170,
+1161,1142,1118,1098,1067,1038,1014,977,944,891,845,784,721,662,594,521,
+442,368,299,230,157,82,30,-24,-90,-151,-186,-241,-286,-333,-387,-435,
+-469,-514,-532,-574,-605,-627,-646,-651,-670,-668,-676,-671,-671,-652,-658,-644,
+-641,-644,-638,-631,-626,-626,-639,-647,-659,-674,-688,-698,-714,-740,-767,-787,
+-817,-848,-865,-903,-931,-968,-994,-1034,-1066,-1084,-1104,-1129,-1146,-1171,-1174,-1181,
+-1178,-1189,-1186,-1182,-1183,-1168,-1162,-1158,-1151,-1134,-1128,-1112,-1102,-1094,-1052,-1027,
+-1010,-980,-951,-921,-886,-865,-831,-800,-759,-733,-703,-675,-639,-607,-569,-535,
+-509,-475,-453,-418,-386,-370,-343,-316,-294,-273,-254,-248,-220,-206,-196,-179,
+-162,-148,-132,-110,-105,-83,-65,-40,-8,10,39,49,78,96,131,151,
+177,219,249,279,310,334,355,394,413,435,461,480,523,536,560,587,
+614,616,627,639,656,666,681,706,728,734,759,779,802,832,863,883,
+920,938,963,982,1010,1037,1050,1062,1058,1061,1055,1063,1064,1068,1052,1037,
+1027,1020,1009,992,967,944,899,869,824,783,727,682,624,569,506,436,
+390,342,281,230,173,132,87,43,2,-35,-77,-130,-150,-180,-229,-264,
+-295,-330,-360,-378,-415,-451,-489,-513,-531,-553,-587,-618,-641,-667,-698,-722,
+-738,-767,-784,-801,-804,-815,-814,-816,-814,-801,-791,-767,-740,-716,-672,-633,
+-599,-564,-527,-483,-415,-351,-302,-240,-186,-118,-64,3,57,126,176,228,
+255,298,315,356,369,384,386,382,392,388,368,351,335,311,278,254,
+219,194,164,119,65,20,-11,-56,-94,-136,-177,-208,-251,-249,-271,-285,
+-298,-291,-305,-313,-313,-289,-278,-262,-236,-207,-177,-149,-118,-81,-43,7,
+57,103,151,206,254,307,353,400,439,485,521,544,553,574,585,602,
+609,602,602,596,594,583,564,547,522,496,476,457,414,383,344,299,
+245,207,182,136,84,46,2,-41,-89,-126,-182,-226,-271,-307,-361,-421,
+-468,-521,-569,-611,-658,-717,-772,-815,-864,-914,-974,-1015,-1056,-1105,-1150,-1200,
+-1245,-1306,-1358,-1402,-1457,-1496,-1540,-1585,-1623,-1658,-1698,-1722,-1753,-1785,-1801,-1798,
+-1803,-1806,-1805,-1792,-1770,-1753,-1739,-1712,-1670,-1627,-1585,-1526,-1458,-1398,-1338,-1260,
+-1180,-1108,-1015,-927,-840,-738,-657,-543,-461,-355,-245,-139,-52,63,166,264,
+348,437,529,618,697,763,837,910,981,1037,1093,1166,1215,1281,1330,1388,
+1428,1483,1536,1591,1642,1696,1735,1785,1849,1892,1952,2011,2065,2110,2166,2189,
+2237,2264,2298,2325,2363,2397,2420,2432,2446,2454,2469,2473,2482,2471,2465,2454,
+2433,2425,2407,2390,2365,2336,2301,2267,2222,2170,2132,2093,2025,1946,1879,1802,
+1730,1637,1538,1444,1339,1250,1139,1018,905,801,697,565,449,341,224,121,
+10,-104,-195,-304,-405,-514,-594,-680,-760,-835,-905,-978,-1029,-1087,-1136,-1175,
+-1210,-1248,-1295,-1331,-1363,-1382,-1405,-1426,-1448,-1453,-1462,-1465,-1474,-1473,-1470,-1459,
+-1462,-1451,-1437,-1422,-1418,-1397,-1378,-1357,-1327,-1297,-1270,-1243,-1201,-1171,-1116,-1067,
+-1009,-941,-889,-833,-773,-709,-639,-577,-514,-448,-386,-304,-234,-161,-108,-27,
+32,130,207,275,338,396,466,530,604,649,715,764,795,830,864,888,
+907,923,928,941,938,932,924,915,893,874,852,805,785,738,696,661,
+616,559,519,473,419,373,331,297,274,234,188,160,152,146,127,101,
+79,73,60,65,67,57,65,61,70,77,88,97,116,131,139,149,
+160,177,163,157,156,143,115,90,61,26,-15,-87,-132,-175,-222,-294,
+-359,-423,-500,-563,-634,-706,-779,-845,-930,-1005,-1092,-1172,-1229,-1287,-1368,-1430,
+-1482,-1535,-1583,-1623,-1666,-1696,-1734,-1768,-1783,-1806,-1822,-1827,-1828,-1840,-1843,-1842,
+-1819,-1815,-1791,-1765,-1741,-1718,-1690,-1658,-1639,-1619,-1583,-1557,-1535,-1490,-1479,-1437,
+-1409,-1365,-1334,-1306,-1268,-1231,-1193,-1146,-1089,-1036,-1007,-952,-901,-838,-784,-723,
+-656,-586,-518,-448,-366,-296,-203,-116,-33,61,160,248,335,420,509,614,
+702,796,891,987,1077,1181,1270,1371,1458,1566,1677,1773,1865,1971,2075,2181,
+2271,2373,2460,2550,2612,2689,2746,2803,2852,2900,2922,2951,2966,2991,3002,3013,
+3006,3007,3000,2984,2972,2946,2908,2877,2849,2824,2774,2730,2691,2652,2617,2563,
+2523,2475,2432,2379,2310,2266,2198,2134,2064,1995,1896,1818,1720,1628,1527,1425,
+1324,1229,1103,1005,902,782,678,565,455,343,220,98,-29,-152,-281,-387,
+-520,-625,-752,-859,-963,-1065,-1158,-1247,-1338,-1433,-1523,-1603,-1664,-1733,-1808,-1859,
+-1919,-1972,-2005,-2044,-2075,-2116,-2129,-2134,-2121,-2133,-2130,-2130,-2115,-2087,-2065,-2056,
+-2018,-1997,-1954,-1929,-1901,-1872,-1843,-1805,-1772,-1734,-1706,-1666,-1634,-1598,-1577,-1551,
+-1533,-1502,-1478,-1462,-1455,-1434,-1416,-1391,-1379,-1359,-1347,-1340,-1332,-1313,-1295,-1285,
+-1276,-1284,-1283,-1280,-1292,-1293,-1299,-1287,-1299,-1291,-1301,-1292,-1289,-1277,-1259,-1237,
+-1216,-1200,-1167,-1132,-1092,-1064,-1011,-976,-933,-885,-850,-800,-749,-704,-666,-624,
+-587,-539,-510,-472,-430,-401,-378,-342,-322,-299,-282,-281,-267,-251,-246,-238,
+-244,-245,-247,-248,-240,-236,-216,-207,-207,-182,-175,-161,-136,-114,-85,-63,
+-44,-14,16,48,77,120,154,194,239,289,325,361,407,458,511,554,
+587,648,687,708,733,759,781,815,817,809,810,816,803,788,763,750,
+719,684,649,623,589,564,529,489,457,436,414,382,366,357,343,338,
+347,356,374,389,406,429,439,482,521,555,589,616,669,710,765,799,
+836,871,913,954,985,1005,1017,1040,1064,1073,1068,1064,1045,1030,1018,996,
+981,955,934,912,895,849,806,764,729,691,663,616,571,535,511,474,
+433,414,395,383,361,357,355,346,349,358,368,378,371,407,418,431,
+450,480,506,516,529,549,555,576,579,597,614,634,636,621,627,639,
+638,646,634,624,628,651,640,640,653,668,680,698,712,733,734,766,
+782,809,810,823,845,842,850,847,860,865,867,872,871,861,856,850,
+843,811,795,746,721,687,651,603,550,491,434,356,285,211,129,43,
+-28,-125,-201,-289,-385,-478,-568,-673,-778,-873,-976,-1074,-1172,-1253,-1348,-1426,
+-1511,-1579,-1639,-1696,-1744,-1775,-1825,-1862,-1908,-1937,-1952,-1980,-1998,-2006,-2011,-2014,
+-2006,-1989,-1981,-1964,-1940,-1904,-1863,-1817,-1782,-1742,-1681,-1642,-1591,-1549,-1477,-1423,
+-1362,-1309,-1248,-1178,-1121,-1069,-1004,-931,-868,-814,-759,-706,-660,-626,-586,-548,
+-516,-496,-479,-462,-447,-427,-421,-415,-409,-412,-409,-404,-405,-406,-408,-406,
+-402,-396,-405,-420,-416,-406,-394,-378,-366,-343,-307,-262,-206,-176,-138,-99,
+-39,21,72,134,179,225,277,325,381,424,476,526,580,622,682,714,
+753,803,830,863,906,938,954,966,1007,1024,1044,1054,1076,1095,1124,1139,
+1132,1159,1178,1199,1227,1232,1240,1254,1252,1270,1274,1265,1272,1274,1275,1265,
+1262,1247,1243,1235,1217,1196,1158,1139,1097,1060,1004,949,899,833,764,690,
+610,517,446,363,275,201,118,30,-42,-115,-182,-265,-335,-396,-460,-527,
+-575,-630,-683,-724,-767,-816,-846,-868,-880,-887,-886,-894,-884,-865,-846,-836,
+-811,-778,-739,-698,-662,-617,-562,-510,-464,-417,-367,-307,-244,-186,-137,-73,
+-24,18,60,103,149,193,225,251,296,317,358,374,388,400,418,447,
+466,483,500,516,523,548,562,580,588,609,619,624,635,672,686,718,
+737,749,766,792,820,834,852,872,881,891,910,910,917,904,894,893,
+881,870,855,833,809,786,767,743,709,674,644,607,567,518,475,433,
+370,316,268,230,166,113,66,24,-18,-74,-113,-159,-194,-226,-268,-304,
+-349,-377,-416,-450,-495,-521,-548,-584,-622,-646,-663,-682,-695,-710,-727,-745,
+-750,-758,-780,-804,-796,-795,-808,-818,-825,-818,-831,-831,-834,-826,-816,-802,
+-805,-800,-793,-775,-758,-753,-746,-734,-727,-720,-715,-695,-679,-662,-640,-651,
+-645,-633,-631,-610,-604,-597,-601,-601,-611,-623,-631,-630,-623,-630,-633,-628,
+-626,-619,-627,-634,-629,-623,-622,-622,-617,-607,-616,-611,-610,-604,-600,-594,
+-598,-594,-579,-583,-564,-549,-545,-527,-532,-517,-509,-504,-482,-481,-475,-472,
+-461,-462,-449,-427,-408,-403,-387,-353,-340,-312,-288,-253,-207,-176,-140,-104,
+-60,-23,28,60,124,175,225,298,343,403,457,528,573,633,673,739,
+776,833,866,905,930,971,997,1035,1058,1086,1124,1141,1165,1198,1216,1233,
+1254,1250,1276,1269,1275,1278,1268,1256,1229,1209,1186,1172,1138,1116,1087,1045,
+1014,967,930,885,845,799,765,706,675,626,575,521,479,450,418,381,
+347,309,296,285,266,241,229,225,230,221,220,224,225,225,244,254,
+277,300,326,335,350,368,387,408,436,452,455,470,475,476,482,481,
+477,470,461,449,438,428,427,400,381,358,354,327,304,281,261,223,
+192,171,145,116,83,74,46,17,-4,-26,-34,-56,-76,-105,-109,-137,
+-163,-185,-210,-248,-272,-306,-324,-347,-383,-393,-426,-439,-454,-476,-500,-517,
+-525,-549,-560,-573,-581,-603,-627,-643,-654,-671,-673,-682,-676,-690,-693,-685,
+-669,-663,-665,-648,-630,-609,-594,-565,-543,-520,-505,-473,-452,-409,-392,-338,
+-332,-278,-246,-205,-170,-139,-93,-63,-39,-12,10,26,34,43,59,64,
+63,62,53,42,34,21,1,-15,-41,-72,-98,-112,-130,-150,-178,-192,
+-216,-222,-243,-241,-245,-256,-255,-257,-251,-250,-250,-236,-213,-200,-170,-150,
+-130,-107,-84,-72,-43,-13,22,48,67,94,132,151,174,187,196,209,
+224,233,233,242,248,235,216,207,178,154,127,101,86,49,10,-43,
+-71,-108,-157,-194,-248,-295,-344,-396,-449,-489,-543,-583,-611,-649,-672,-713,
+-741,-776,-805,-844,-863,-894,-926,-936,-953,-975,-996,-1007,-1011,-1004,-1012,-1026,
+-1024,-1009,-1011,-997,-963,-935,-903,-898,-863,-840,-802,-773,-731,-702,-653,-620,
+-578,-533,-497,-445,-395,-356,-313,-278,-236,-213,-168,-126,-78,-49,-13,9,
+34,61,97,137,165,186,208,240,262,292,321,344,365,373,389,411,
+428,448,461,479,492,515,532,555,583,597,622,648,658,679,701,725,
+742,767,778,798,818,830,843,859,870,886,902,912,927,945,967,974,
+978,998,1002,1017,1034,1050,1062,1058,1076,1092,1101,1116,1132,1141,1158,1181,
+1198,1211,1231,1242,1255,1264,1263,1271,1269,1259,1239,1226,1194,1169,1126,1083,
+1029,981,917,847,765,688,598,512,393,289,188,80,-30,-147,-254,-349,
+-445,-536,-618,-717,-784,-850,-931,-991,-1040,-1089,-1140,-1188,-1225,-1249,-1270,-1293,
+-1316,-1315,-1321,-1323,-1290,-1281,-1248,-1215,-1188,-1157,-1125,-1080,-1039,-999,-963,-917,
+-874,-831,-783,-744,-703,-654,-615,-587,-554,-516,-492,-450,-427,-410,-387,-383,
+-368,-355,-339,-347,-349,-338,-326,-310,-302,-277,-269,-247,-242,-215,-188,-161,
+-127,-106,-77,-38,-12,35,66,100,134,167,190,239,273,297,326,350,
+373,390,414,424,433,430,437,421,437,426,415,412,403,382,352,345,
+343,327,316,293,256,253,232,198,179,163,136,117,100,82,68,52,
+53,40,46,36,26,20,18,15,27,25,26,20,19,19,16,5,
+14,2,-11,-17,-37,-51,-73,-84,-106,-118,-151,-174,-218,-248,-276,-301,
+-336,-378,-412,-457,-487,-531,-560,-584,-621,-649,-691,-715,-747,-801,-850,-878,
+-911,-937,-973,-1024,-1044,-1080,-1099,-1121,-1139,-1167,-1159,-1182,-1193,-1192,-1201,-1204,
+-1205,-1199,-1184,-1173,-1163,-1135,-1106,-1086,-1053,-1017,-976,-933,-874,-822,-761,-696,
+-634,-575,-518,-465,-389,-321,-263,-194,-127,-47,14,50,118,173,240,306,
+365,431,489,553,611,660,709,753,822,877,906,945,1008,1069,1103,1152,
+1193,1236,1292,1333,1389,1435,1483,1533,1584,1630,1675,1721,1778,1821,1860,1912,
+1953,2010,2057,2089,2144,2187,2231,2272,2304,2331,2353,2362,2353,2384,2380,2355,
+2331,2308,2289,2251,2212,2173,2133,2104,2044,1997,1940,1887,1836,1782,1732,1670,
+1632,1593,1545,1470,1421,1375,1337,1297,1252,1200,1176,1140,1082,1042,1001,970,
+925,870,811,766,718,662,610,564,497,433,383,328,273,218,148,72,
+15,-49,-121,-197,-278,-334,-419,-498,-579,-648,-732,-798,-871,-937,-999,-1055,
+-1116,-1174,-1224,-1272,-1316,-1361,-1403,-1451,-1499,-1534,-1561,-1588,-1616,-1645,-1663,-1663,
+-1686,-1696,-1695,-1693,-1704,-1707,-1711,-1706,-1703,-1710,-1699,-1692,-1704,-1705,-1699,-1695,
+-1705,-1713,-1718,-1724,-1725,-1736,-1739,-1750,-1766,-1785,-1808,-1819,-1838,-1842,-1861,-1884,
+-1902,-1921,-1939,-1950,-1951,-1948,-1952,-1975,-1967,-1965,-1934,-1922,-1918,-1906,-1894,-1869,
+-1846,-1824,-1791,-1756,-1722,-1670,-1631,-1590,-1543,-1497,-1427,-1372,-1321,-1263,-1204,-1139,
+-1082,-1011,-944,-878,-809,-726,-654,-570,-492,-415,-328,-264,-171,-82,1,82,
+148,232,312,393,475,557,656,736,818,898,983,1056,1127,1220,1300,1373,
+1448,1526,1594,1675,1728,1794,1850,1901,1961,2011,2049,2086,2121,2156,2179,2189,
+2208,2223,2213,2215,2200,2191,2167,2143,2111,2063,2022,1970,1915,1849,1791,1714,
+1653,1584,1506,1426,1331,1241,1154,1068,999,904,821,722,642,542,459,361,
+285,189,116,42,-42,-115,-179,-244,-307,-375,-429,-465,-511,-558,-596,-642,
+-671,-697,-730,-753,-768,-764,-776,-768,-772,-761,-749,-729,-731,-713,-685,-657,
+-627,-602,-582,-563,-526,-484,-461,-444,-415,-388,-351,-326,-300,-264,-236,-199,
+-169,-136,-98,-63,-30,9,40,88,132,171,217,264,297,335,385,443,
+491,537,575,608,651,708,735,777,809,853,884,925,949,991,1036,1067,
+1119,1152,1177,1209,1237,1278,1296,1320,1336,1358,1366,1369,1371,1369,1376,1368,
+1348,1331,1303,1273,1240,1204,1171,1123,1082,1038,977,920,873,817,759,690,
+636,579,519,450,401,350,278,238,191,150,96,40,-10,-58,-116,-166,
+-224,-273,-336,-384,-426,-490,-542,-602,-658,-715,-772,-826,-892,-953,-1014,-1082,
+-1138,-1224,-1294,-1372,-1438,-1528,-1597,-1679,-1738,-1800,-1867,-1917,-1978,-2013,-2080,-2110,
+-2153,-2203,-2234,-2259,-2285,-2321,-2338,-2355,-2348,-2358,-2353,-2334,-2311,-2280,-2257,-2225,
+-2179,-2129,-2077,-2041,-1974,-1914,-1849,-1782,-1722,-1668,-1613,-1532,-1481,-1431,-1374,-1307,
+-1244,-1191,-1132,-1073,-1016,-980,-936,-903,-865,-827,-791,-745,-717,-683,-663,-643,
+-627,-602,-569,-554,-534,-512,-500,-464,-443,-418,-390,-357,-327,-286,-257,-220,
+-175,-125,-78,-29,40,113,179,257,317,407,477,560,646,736,819,905,
+990,1088,1177,1257,1350,1437,1519,1591,1662,1730,1791,1846,1874,1901,1939,1956,
+1971,1982,1962,1945,1915,1904,1867,1838,1804,1759,1719,1687,1644,1597,1551,1512,
+1470,1406,1374,1323,1280,1238,1180,1131,1088,1043,1011,979,933,908,877,838,
+812,778,741,702,664,640,601,560,527,508,470,430,401,371,337,313,
+291,268,257,239,228,202,202,190,175,154,143,148,136,148,159,172,
+171,195,202,209,229,254,270,287,310,309,322,335,345,348,337,320,
+312,305,287,282,270,256,232,212,188,163,128,96,54,15,-32,-69,
+-110,-152,-201,-251,-273,-311,-344,-387,-414,-443,-456,-490,-527,-547,-559,-580,
+-598,-627,-638,-648,-647,-656,-653,-657,-649,-634,-600,-587,-568,-538,-500,-462,
+-440,-400,-370,-327,-280,-240,-198,-159,-136,-101,-53,6,46,83,112,147,
+180,206,242,277,287,297,312,323,326,325,315,309,303,295,267,242,
+219,192,148,119,70,10,-47,-108,-171,-219,-288,-367,-427,-498,-562,-623,
+-696,-746,-812,-858,-921,-965,-1019,-1049,-1099,-1130,-1171,-1199,-1220,-1236,-1264,-1285,
+-1291,-1301,-1317,-1305,-1302,-1302,-1273,-1250,-1233,-1238,-1202,-1163,-1154,-1124,-1107,-1083,
+-1058,-1018,-981,-941,-921,-881,-847,-818,-782,-745,-713,-662,-622,-590,-565,-526,
+-498,-471,-435,-403,-370,-342,-314,-301,-266,-237,-223,-188,-160,-153,-134,-122,
+-98,-73,-57,-47,-39,-32,-31,-36,-35,-42,-46,-49,-47,-69,-92,-100,
+-112,-130,-139,-155,-169,-184,-208,-225,-246,-256,-276,-263,-265,-254,-250,-233,
+-222,-193,-163,-130,-102,-57,-26,17,83,130,198,251,305,365,445,510,
+585,649,727,808,881,950,1007,1065,1115,1182,1227,1286,1316,1359,1401,1444,
+1475,1498,1518,1530,1546,1550,1571,1573,1572,1567,1554,1530,1527,1494,1479,1444,
+1417,1403,1370,1340,1309,1267,1243,1216,1186,1152,1115,1067,1034,994,958,938,
+890,848,809,789,756,714,674,629,603,571,545,513,468,426,393,365,
+330,283,246,194,161,128,103,88,55,23,-5,-25,-41,-39,-63,-61,
+-81,-82,-77,-83,-89,-91,-87,-79,-80,-80,-60,-72,-63,-69,-81,-72,
+-76,-85,-92,-93,-98,-113,-131,-139,-154,-179,-204,-220,-238,-252,-283,-302,
+-319,-352,-361,-371,-389,-396,-408,-422,-430,-432,-432,-437,-438,-435,-427,-422,
+-396,-402,-382,-365,-346,-337,-321,-307,-294,-285,-287,-273,-262,-256,-265,-252,
+-249,-240,-247,-268,-272,-272,-276,-296,-293,-318,-328,-346,-347,-366,-362,-364,
+-370,-384,-387,-379,-376,-364,-357,-350,-338,-317,-298,-276,-253,-225,-202,-184,
+-171,-145,-136,-115,-94,-74,-61,-61,-67,-48,-22,-19,-11,-12,-14,-7,
+-14,-24,-18,-25,-38,-70,-78,-117,-128,-144,-161,-191,-213,-211,-222,-232,
+-249,-244,-251,-249,-259,-254,-252,-240,-223,-213,-207,-195,-177,-158,-138,-119,
+-95,-78,-62,-34,-17,16,37,67,75,96,86,113,114,113,100,102,
+103,107,96,73,63,41,37,24,-3,-24,-56,-88,-94,-121,-142,-173,
+-188,-214,-243,-262,-287,-274,-276,-267,-272,-268,-257,-238,-230,-201,-186,-155,
+-116,-92,-51,-21,26,74,137,174,218,285,330,379,435,489,544,609,
+644,695,741,771,825,865,892,920,960,984,1019,1032,1073,1097,1120,1118,
+1134,1144,1161,1164,1174,1170,1162,1149,1152,1145,1148,1134,1116,1095,1079,1063,
+1032,1014,977,953,904,871,819,756,702,650,594,532,478,426,383,322,
+261,216,177,135,73,13,-40,-99,-134,-182,-235,-270,-311,-354,-394,-415,
+-444,-471,-469,-497,-513,-519,-544,-552,-552,-566,-560,-557,-557,-560,-554,-547,
+-537,-528,-505,-497,-466,-458,-428,-398,-367,-327,-305,-267,-249,-219,-188,-166,
+-147,-118,-85,-65,-65,-38,-19,-4,-6,-8,4,6,23,13,7,-8,
+-22,-37,-53,-73,-105,-118,-156,-181,-216,-243,-267,-290,-306,-328,-362,-383,
+-406,-425,-442,-454,-478,-481,-473,-477,-462,-467,-453,-428,-412,-390,-375,-337,
+-301,-274,-238,-206,-178,-145,-125,-92,-63,-36,-16,1,19,24,54,66,
+80,82,82,92,88,81,58,50,34,19,-2,-33,-60,-80,-110,-132,
+-161,-180,-222,-254,-282,-307,-348,-386,-432,-460,-511,-543,-580,-628,-667,-709,
+-753,-790,-840,-870,-893,-924,-940,-970,-978,-1011,-1018,-1037,-1043,-1064,-1063,-1066,
+-1087,-1090,-1091,-1096,-1093,-1102,-1096,-1104,-1094,-1077,-1077,-1066,-1072,-1057,-1050,-1042,
+-1039,-1020,-1014,-1001,-999,-985,-965,-942,-921,-895,-880,-854,-819,-792,-766,-745,
+-710,-689,-654,-627,-592,-557,-518,-476,-453,-421,-384,-334,-301,-256,-231,-197,
+-165,-129,-98,-59,-28,25,60,99,126,167,205,237,264,305,330,366,
+400,426,453,476,527,553,592,621,654,680,714,745,768,803,832,874,
+902,932,961,999,1027,1055,1083,1104,1111,1140,1160,1179,1186,1200,1214,1236,
+1236,1240,1243,1240,1245,1232,1248,1231,1205,1183,1164,1168,1141,1116,1096,1069,
+1035,998,962,925,891,840,802,751,708,648,608,555,503,457,406,346,
+303,258,218,169,127,106,59,44,22,-11,-25,-35,-38,-54,-53,-57,
+-55,-41,-27,-13,-2,15,34,58,82,121,139,175,203,257,287,309,
+350,386,407,431,448,472,484,499,499,509,519,522,518,520,506,499,
+495,482,456,441,431,416,378,357,329,310,282,253,214,181,149,116,
+95,65,31,-8,-29,-56,-80,-118,-145,-197,-227,-271,-303,-341,-367,-401,
+-435,-483,-518,-549,-586,-629,-643,-686,-728,-758,-802,-819,-862,-892,-917,-943,
+-976,-995,-1006,-1016,-1029,-1033,-1044,-1053,-1054,-1043,-1058,-1068,-1057,-1066,-1053,-1042,
+-1026,-1023,-1020,-1017,-1009,-988,-964,-947,-926,-913,-881,-856,-828,-808,-782,-759,
+-734,-709,-668,-643,-603,-585,-559,-526,-504,-481,-468,-439,-408,-375,-363,-326,
+-312,-308,-284,-283,-276,-279,-277,-268,-269,-266,-282,-277,-282,-277,-287,-274,
+-274,-280,-278,-282,-279,-277,-276,-281,-283,-305,-281,-272,-272,-268,-261,-259,
+-240,-220,-213,-204,-174,-160,-135,-106,-75,-58,-28,15,54,110,139,182,
+216,267,303,352,402,451,506,549,580,623,669,703,744,767,792,810,
+820,826,836,855,865,863,867,869,862,864,866,871,868,867,860,855,
+856,854,830,829,833,831,845,848,846,847,850,848,859,860,881,892,
+890,923,928,940,947,956,971,977,978,975,989,1000,995,1001,986,973,
+956,939,926,908,901,870,834,820,797,762,744,711,685,652,627,624,
+601,593,578,547,535,534,524,529,537,533,535,536,540,558,583,596,
+616,634,646,668,688,690,710,708,717,732,722,721,713,708,698,687,
+681,679,672,648,644,616,599,588,564,553,536,511,487,462,445,436,
+417,396,378,360,363,356,349,338,333,316,319,315,317,303,302,328,
+318,321,316,315,312,300,293,297,284,278,245,231,210,194,137,104,
+65,9,-45,-103,-160,-222,-299,-360,-418,-484,-555,-640,-698,-765,-841,-906,
+-975,-1040,-1099,-1154,-1226,-1268,-1321,-1383,-1431,-1469,-1497,-1521,-1555,-1589,-1604,-1611,
+-1631,-1651,-1653,-1666,-1676,-1692,-1688,-1691,-1685,-1680,-1676,-1672,-1670,-1648,-1628,-1607,
+-1577,-1561,-1535,-1513,-1486,-1446,-1408,-1389,-1366,-1334,-1288,-1259,-1231,-1192,-1160,-1135,
+-1113,-1083,-1056,-1028,-980,-958,-936,-918,-907,-892,-873,-867,-850,-845,-842,-828,
+-829,-831,-814,-819,-826,-829,-820,-813,-818,-814,-799,-797,-794,-799,-790,-786,
+-771,-768,-747,-736,-725,-710,-673,-660,-631,-596,-547,-504,-470,-433,-413,-365,
+-320,-274,-239,-196,-141,-96,-41,-2,54,109,162,210,268,325,378,420,
+486,537,592,637,697,744,799,863,915,977,1042,1097,1168,1218,1276,1336,
+1402,1450,1506,1565,1616,1663,1698,1737,1770,1802,1843,1854,1870,1881,1884,1882,
+1877,1880,1871,1851,1827,1811,1779,1761,1708,1676,1639,1594,1521,1478,1437,1381,
+1309,1258,1204,1149,1109,1055,1005,939,888,826,784,734,689,632,585,542,
+478,447,407,379,351,322,300,258,229,213,189,165,141,125,94,85,
+75,46,28,15,26,8,-11,-33,-17,-39,-42,-50,-63,-82,-93,-102,
+-122,-135,-158,-190,-204,-231,-239,-260,-267,-293,-302,-310,-314,-335,-344,-343,
+-344,-341,-337,-347,-357,-359,-376,-367,-364,-360,-367,-372,-382,-376,-387,-381,
+-389,-381,-404,-416,-437,-449,-473,-501,-517,-548,-562,-600,-612,-628,-659,-697,
+-725,-738,-766,-775,-811,-825,-844,-855,-862,-874,-868,-885,-890,-885,-887,-873,
+-852,-829,-818,-792,-764,-751,-717,-685,-653,-613,-587,-561,-517,-496,-466,-441,
+-399,-369,-347,-311,-287,-262,-238,-204,-191,-168,-140,-113,-104,-95,-88,-83,
+-74,-70,-61,-47,-50,-41,-29,-12,-18,-18,-8,3,10,5,12,15,
+0,-2,-19,-30,-24,-46,-42,-64,-78,-99,-109,-122,-131,-138,-158,-163,
+-168,-164,-179,-195,-206,-218,-231,-230,-243,-252,-261,-266,-279,-285,-297,-299,
+-295,-315,-325,-319,-326,-333,-343,-343,-349,-364,-380,-398,-404,-412,-434,-428,
+-444,-436,-444,-457,-484,-506,-515,-523,-539,-556,-568,-562,-564,-565,-589,-592,
+-585,-572,-569,-567,-544,-535,-528,-513,-500,-484,-462,-441,-435,-406,-376,-345,
+-320,-287,-253,-215,-176,-144,-114,-72,-23,26,74,119,167,218,265,304,
+344,401,455,499,545,600,651,704,755,812,861,904,955,1004,1042,1100,
+1144,1199,1227,1266,1294,1313,1347,1374,1396,1408,1421,1444,1473,1483,1499,1501,
+1506,1510,1493,1489,1495,1488,1468,1457,1447,1421,1398,1376,1357,1335,1310,1280,
+1233,1202,1156,1131,1085,1041,1007,969,924,862,822,786,731,677,638,590,
+560,515,466,429,396,345,312,262,219,192,158,112,90,53,23,-15,
+-37,-68,-87,-108,-117,-150,-182,-202,-227,-251,-282,-315,-347,-380,-425,-456,
+-491,-526,-560,-594,-627,-675,-706,-745,-788,-840,-874,-918,-967,-1000,-1052,-1084,
+-1114,-1145,-1178,-1218,-1243,-1260,-1299,-1336,-1360,-1393,-1393,-1420,-1441,-1459,-1465,-1484,
+-1491,-1499,-1502,-1497,-1497,-1473,-1463,-1436,-1417,-1393,-1365,-1336,-1289,-1257,-1207,-1153,
+-1105,-1056,-999,-935,-878,-824,-759,-686,-613,-528,-469,-385,-314,-246,-163,-77,
+-9,68,146,205,273,343,406,477,537,590,646,692,748,800,855,898,
+929,981,1020,1056,1082,1097,1120,1135,1142,1148,1159,1154,1163,1150,1150,1130,
+1111,1106,1097,1077,1045,1022,990,970,930,898,857,829,786,738,701,665,
+608,564,531,490,462,417,371,303,279,223,192,137,99,59,19,-28,
+-82,-108,-140,-175,-195,-230,-265,-278,-309,-340,-367,-384,-410,-439,-479,-492,
+-526,-545,-576,-604,-614,-637,-661,-675,-691,-707,-729,-745,-756,-776,-780,-801,
+-804,-829,-825,-832,-832,-847,-856,-854,-838,-834,-829,-824,-803,-803,-781,-758,
+-737,-718,-699,-675,-655,-615,-594,-570,-549,-509,-471,-431,-400,-351,-316,-250,
+-206,-151,-103,-52,8,62,111,156,225,283,360,399,472,546,607,666,
+728,801,856,918,974,1041,1096,1163,1216,1279,1325,1381,1433,1481,1526,1566,
+1602,1660,1689,1736,1754,1784,1807,1827,1832,1850,1845,1847,1838,1819,1804,1763,
+1725,1682,1636,1592,1547,1492,1441,1407,1344,1281,1222,1166,1111,1034,958,903,
+843,792,722,667,613,543,493,445,396,353,299,262,215,172,136,98,
+51,6,-25,-66,-106,-144,-177,-213,-247,-280,-314,-343,-374,-416,-425,-450,
+-479,-501,-526,-555,-592,-606,-627,-655,-672,-683,-705,-720,-742,-752,-765,-747,
+-754,-756,-753,-746,-750,-758,-753,-735,-728,-721,-714,-691,-666,-666,-653,-643,
+-635,-616,-595,-590,-583,-587,-588,-593,-595,-605,-602,-624,-642,-657,-679,-695,
+-720,-746,-774,-802,-814,-832,-847,-862,-881,-885,-899,-914,-919,-918,-914,-904,
+-901,-903,-887,-862,-837,-812,-778,-748,-724,-679,-648,-609,-566,-522,-480,-426,
+-393,-358,-323,-274,-235,-193,-152,-118,-81,-44,-9,12,37,63,95,109,
+133,142,137,144,146,149,144,157,141,133,137,130,126,137,125,126,
+124,121,118,120,126,140,148,169,174,201,219,246,263,281,317,341,
+370,393,408,426,469,476,491,501,525,522,533,546,544,554,565,577,
+565,570,566,556,542,520,513,494,485,467,434,407,374,330,322,285,
+248,206,176,138,94,52,21,-22,-50,-98,-149,-196,-258,-289,-338,-365,
+-423,-464,-506,-548,-583,-621,-660,-695,-737,-772,-793,-831,-852,-875,-897,-926,
+-949,-980,-997,-991,-1002,-999,-1002,-995,-1008,-1014,-992,-973,-955,-944,-915,-903,
+-863,-840,-829,-793,-750,-722,-679,-634,-580,-534,-479,-412,-358,-308,-247,-192,
+-132,-85,-28,23,77,131,191,245,302,359,412,467,533,599,653,708,
+751,798,852,895,923,968,1006,1029,1048,1078,1078,1092,1099,1100,1111,1100,
+1107,1101,1086,1055,1043,1025,1020,994,964,932,901,867,829,789,760,741,
+712,672,626,609,582,554,540,515,485,456,434,422,402,374,366,347,
+350,330,311,315,323,316,312,307,298,278,286,285,276,279,262,253,
+235,219,195,177,165,136,124,96,59,29,-17,-54,-93,-142,-200,-262,
+-308,-358,-412,-466,-512,-575,-627,-693,-740,-765,-811,-863,-901,-945,-982,-1019,
+-1049,-1086,-1130,-1162,-1187,-1209,-1228,-1248,-1277,-1289,-1306,-1318,-1319,-1339,-1341,-1351,
+-1351,-1351,-1350,-1336,-1327,-1334,-1338,-1330,-1319,-1311,-1297,-1285,-1267,-1246,-1221,-1181,
+-1164,-1141,-1120,-1093,-1056,-1026,-983,-934,-888,-851,-810,-759,-703,-653,-604,-558,
+-500,-438,-385,-334,-270,-213,-156,-122,-64,-13,34,75,117,164,195,227,
+258,304,316,336,376,410,438,441,464,477,499,519,528,541,555,569,
+585,597,598,603,631,635,641,649,661,672,678,694,698,701,709,717,
+719,716,722,728,736,724,717,717,716,707,700,687,680,662,644,620,
+599,578,556,535,508,487,455,425,390,369,339,315,292,252,239,221,
+219,191,173,148,123,105,79,68,52,46,35,29,22,-3,-5,-9,
+-18,-28,-22,-23,-9,-24,-23,-15,-12,0,18,26,41,59,76,109,
+124,154,178,202,230,280,306,331,372,409,448,475,522,550,595,634,
+667,711,751,794,827,891,940,973,1003,1030,1072,1115,1145,1181,1209,1234,
+1257,1289,1324,1349,1367,1383,1402,1429,1453,1471,1472,1482,1487,1503,1496,1484,
+1482,1473,1458,1440,1423,1402,1375,1359,1332,1285,1259,1221,1197,1159,1124,1079,
+1044,1011,961,912,873,824,782,736,688,645,607,566,519,467,422,381,
+337,301,250,200,155,103,54,18,-19,-62,-108,-145,-186,-220,-255,-285,
+-311,-337,-365,-400,-444,-455,-486,-506,-531,-557,-583,-593,-613,-639,-664,-692,
+-698,-708,-731,-756,-771,-786,-811,-839,-856,-903,-934,-961,-996,-1026,-1069,-1100,
+-1156,-1195,-1232,-1278,-1334,-1389,-1434,-1476,-1509,-1563,-1608,-1667,-1716,-1774,-1809,-1840,
+-1884,-1918,-1958,-1999,-2029,-2052,-2071,-2082,-2106,-2105,-2100,-2122,-2112,-2114,-2109,-2097,
+-2074,-2060,-2037,-2012,-1988,-1950,-1916,-1867,-1823,-1780,-1735,-1686,-1625,-1565,-1509,-1469,
+-1396,-1338,-1267,-1207,-1136,-1075,-1005,-935,-878,-801,-718,-642,-585,-519,-449,-389,
+-327,-263,-218,-178,-120,-60,-8,54,80,129,163,212,260,306,355,395,
+449,476,524,567,614,648,686,712,744,789,817,851,869,904,929,953,
+970,982,1011,1033,1043,1051,1065,1084,1092,1088,1090,1106,1103,1101,1107,1099,
+1091,1078,1078,1085,1074,1068,1054,1034,1025,1025,1015,1012,998,1004,992,977,
+973,977,964,987,987,987,974,990,1010,1020,1020,1033,1039,1056,1064,1078,
+1086,1092,1109,1105,1116,1119,1133,1123,1127,1132,1133,1136,1130,1109,1103,1090,
+1080,1050,1038,1031,1003,988,957,955,920,891,879,858,852,836,819,799,
+782,772,756,731,710,694,676,655,639,613,594,560,543,532,504,492,
+476,446,420,386,354,312,281,244,190,160,111,60,6,-39,-94,-161,
+-210,-253,-325,-380,-434,-481,-538,-608,-675,-718,-765,-824,-883,-933,-976,-1021,
+-1063,-1087,-1122,-1149,-1177,-1193,-1217,-1232,-1241,-1245,-1251,-1254,-1274,-1271,-1273,-1267,
+-1262,-1243,-1231,-1221,-1216,-1199,-1157,-1144,-1136,-1124,-1099,-1075,-1061,-1040,-1033,-1012,
+-998,-977,-964,-952,-941,-908,-887,-864,-839,-823,-804,-785,-755,-743,-723,-704,
+-698,-669,-652,-648,-633,-605,-613,-604,-588,-568,-558,-540,-537,-531,-516,-508,
+-509,-491,-480,-482,-466,-466,-459,-452,-445,-450,-428,-436,-432,-427,-413,-403,
+-398,-380,-385,-367,-363,-353,-349,-335,-321,-316,-305,-302,-282,-277,-241,-228,
+-197,-193,-168,-150,-122,-106,-77,-69,-31,-16,4,25,54,71,101,121,
+140,155,189,208,220,241,258,278,302,329,339,348,362,360,373,387,
+410,409,410,425,434,439,441,445,443,452,454,451,444,445,440,437,
+415,403,400,370,350,341,322,312,293,276,257,238,216,203,194,192,
+167,143,138,127,112,104,96,103,98,97,99,106,115,109,126,131,
+141,167,204,206,226,243,266,308,330,354,374,408,440,460,487,515,
+558,577,588,601,626,642,660,672,695,713,721,733,757,760,767,773,
+792,814,815,821,821,842,843,836,834,842,834,825,833,834,841,840,
+835,840,822,821,810,813,804,795,778,752,734,706,683,672,636,609,
+578,546,521,490,468,416,384,348,301,267,228,195,152,108,59,29,
+14,-25,-61,-91,-120,-131,-135,-154,-173,-181,-178,-180,-191,-189,-190,-183,
+-172,-164,-163,-139,-140,-126,-121,-111,-100,-89,-67,-72,-47,-47,-30,-30,
+-14,-18,-24,-30,-31,-30,-26,-39,-52,-74,-94,-99,-103,-109,-117,-129,
+-141,-164,-180,-205,-221,-236,-253,-274,-285,-299,-331,-357,-382,-396,-416,-427,
+-448,-459,-489,-515,-532,-560,-591,-615,-640,-656,-681,-723,-749,-756,-776,-792,
+-820,-827,-846,-862,-866,-869,-895,-895,-895,-910,-918,-918,-904,-915,-915,-900,
+-902,-891,-893,-888,-869,-861,-838,-819,-798,-782,-767,-758,-749,-733,-710,-686,
+-671,-645,-638,-610,-598,-579,-553,-532,-511,-484,-470,-462,-432,-409,-393,-367,
+-348,-320,-297,-275,-243,-208,-186,-154,-124,-98,-62,-29,6,37,65,95,
+141,158,198,231,256,292,318,359,397,418,460,494,519,555,595,635,
+659,670,699,747,759,786,802,840,847,865,866,891,913,910,910,923,
+929,945,946,943,940,930,928,928,921,913,905,895,900,870,861,859,
+851,828,810,796,779,778,754,737,715,684,658,639,602,568,545,512,
+480,433,409,367,344,307,258,218,194,138,110,91,55,20,-12,-50,
+-60,-82,-108,-118,-119,-124,-119,-132,-134,-139,-137,-149,-147,-143,-147,-160,
+-153,-157,-165,-167,-174,-177,-195,-211,-207,-217,-222,-241,-246,-267,-280,-292,
+-311,-339,-363,-389,-406,-426,-460,-479,-494,-508,-530,-549,-554,-560,-576,-589,
+-591,-593,-596,-597,-609,-609,-603,-604,-595,-568,-555,-541,-533,-510,-492,-463,
+-431,-392,-369,-337,-302,-260,-235,-193,-155,-111,-83,-42,0,58,113,151,
+182,232,281,331,355,374,416,453,488,517,527,555,580,584,588,603,
+611,609,604,597,593,569,554,534,532,493,457,406,362,317,267,226,
+171,122,63,3,-48,-114,-168,-224,-282,-337,-388,-447,-509,-570,-623,-670,
+-723,-778,-810,-858,-895,-947,-971,-1004,-1024,-1045,-1058,-1078,-1093,-1108,-1112,-1122,
+-1133,-1132,-1129,-1127,-1121,-1111,-1102,-1091,-1069,-1050,-1033,-1002,-973,-948,-931,-903,
+-861,-845,-816,-790,-756,-718,-675,-635,-609,-573,-544,-495,-451,-413,-383,-345,
+-306,-266,-227,-196,-171,-125,-95,-62,-37,-8,32,67,95,128,167,191,
+233,269,310,326,362,381,418,448,489,524,550,578,606,644,682,708,
+743,778,827,856,887,925,969,994,1030,1064,1093,1114,1153,1165,1193,1223,
+1237,1257,1280,1295,1304,1321,1325,1330,1335,1340,1339,1349,1343,1331,1330,1319,
+1320,1289,1285,1250,1225,1204,1174,1150,1112,1084,1044,1023,975,932,890,838,
+798,747,708,646,613,562,515,461,411,366,322,285,238,207,144,116,
+63,26,-11,-51,-98,-130,-184,-222,-258,-294,-350,-384,-421,-440,-475,-500,
+-534,-569,-583,-613,-638,-676,-695,-722,-731,-750,-763,-790,-796,-809,-818,-823,
+-832,-838,-828,-837,-834,-842,-842,-862,-852,-858,-859,-861,-864,-852,-861,-835,
+-833,-831,-836,-820,-812,-806,-785,-779,-773,-766,-755,-739,-725,-715,-711,-698,
+-670,-661,-646,-628,-616,-599,-571,-551,-525,-502,-476,-444,-418,-379,-336,-307,
+-273,-234,-191,-156,-121,-80,-38,16,59,98,144,189,249,277,293,338,
+367,417,437,462,495,532,555,597,623,650,682,710,728,761,790,798,
+814,822,836,841,862,868,868,881,895,896,901,894,894,878,854,863,
+850,831,791,775,736,708,674,648,603,567,530,475,442,403,369,315,
+277,247,186,148,106,73,47,2,-27,-67,-93,-114,-151,-184,-209,-240,
+-265,-295,-314,-334,-353,-376,-380,-381,-393,-418,-431,-439,-447,-446,-459,-460,
+-462,-469,-471,-470,-488,-490,-483,-490,-491,-495,-494,-507,-512,-507,-521,-532,
+-529,-531,-530,-531,-539,-530,-532,-533,-538,-544,-526,-520,-515,-510,-508,-503,
+-490,-487,-483,-487,-478,-473,-469,-458,-451,-432,-439,-430,-437,-419,-405,-397,
+-404,-398,-394,-389,-383,-373,-381,-363,-362,-354,-352,-341,-311,-299,-291,-280,
+-245,-238,-215,-191,-157,-132,-121,-96,-54,-26,6,37,59,88,140,168,
+207,244,288,309,351,382,433,463,499,531,564,611,633,660,686,695,
+723,741,759,770,776,784,774,782,762,752,734,728,710,692,671,640,
+607,586,564,522,495,448,424,395,368,323,286,251,214,181,155,110,
+61,28,-1,-8,-40,-65,-90,-121,-132,-150,-162,-177,-193,-203,-188,-202,
+-203,-211,-201,-190,-184,-163,-138,-106,-94,-72,-32,6,59,91,138,170,
+220,271,308,343,390,433,490,538,568,611,648,686,717,744,774,800,
+823,842,858,874,883,875,869,864,845,841,831,825,800,771,742,723,
+696,674,641,610,575,542,496,464,425,399,371,334,306,292,276,239,
+235,215,216,206,179,170,163,159,144,126,120,103,87,73,60,57,
+48,38,21,-3,-17,-26,-45,-55,-66,-81,-100,-120,-137,-152,-168,-184,
+-200,-215,-229,-252,-268,-281,-289,-300,-306,-326,-349,-358,-371,-391,-398,-411,
+-423,-447,-470,-498,-523,-540,-551,-567,-599,-634,-671,-687,-718,-737,-787,-818,
+-852,-877,-902,-940,-975,-1009,-1030,-1048,-1066,-1087,-1093,-1097,-1113,-1118,-1124,-1127,
+-1120,-1132,-1128,-1128,-1109,-1095,-1088,-1095,-1081,-1064,-1055,-1039,-1027,-1008,-977,-964,
+-952,-932,-923,-915,-899,-879,-876,-863,-859,-850,-843,-833,-830,-813,-803,-807,
+-803,-805,-793,-770,-766,-753,-754,-741,-725,-701,-680,-686,-662,-638,-619,-597,
+-569,-534,-513,-482,-458,-403,-365,-304,-271,-248,-212,-158,-98,-46,-3,56,
+99,130,183,243,287,334,372,425,478,523,573,615,650,698,738,783,
+826,866,901,928,962,1015,1043,1072,1113,1150,1188,1222,1258,1266,1302,1328,
+1366,1386,1417,1439,1459,1492,1505,1524,1549,1549,1571,1599,1610,1623,1607,1613,
+1605,1594,1571,1560,1543,1520,1496,1463,1428,1390,1352,1323,1280,1239,1186,1145,
+1085,1038,989,930,883,838,783,741,674,620,553,506,443,382,339,288,
+236,175,132,72,29,-19,-52,-95,-150,-182,-223,-262,-306,-333,-363,-392,
+-429,-450,-471,-499,-527,-545,-559,-576,-585,-592,-589,-599,-611,-614,-611,-599,
+-602,-594,-594,-572,-556,-544,-529,-520,-509,-487,-474,-453,-444,-431,-428,-429,
+-412,-403,-409,-383,-391,-387,-399,-400,-397,-405,-411,-430,-431,-447,-460,-472,
+-495,-517,-531,-532,-547,-571,-586,-590,-596,-593,-605,-604,-602,-593,-594,-582,
+-578,-562,-552,-543,-525,-502,-471,-436,-412,-384,-339,-310,-269,-227,-181,-133,
+-86,-46,-5,38,79,135,177,202,234,263,296,315,347,370,380,401,
+416,428,443,455,459,470,463,464,460,467,448,431,421,420,394,382,
+367,338,317,284,260,228,187,136,105,56,1,-30,-90,-134,-174,-230,
+-284,-350,-396,-451,-493,-554,-600,-640,-668,-714,-763,-799,-834,-867,-907,-941,
+-984,-999,-1032,-1046,-1068,-1097,-1098,-1121,-1130,-1135,-1130,-1134,-1128,-1127,-1130,-1121,
+-1099,-1080,-1075,-1057,-1031,-1011,-961,-944,-920,-902,-859,-820,-775,-742,-696,-661,
+-616,-568,-543,-485,-451,-398,-373,-328,-288,-243,-204,-141,-103,-51,-16,30,
+54,96,136,185,224,262,282,311,353,388,436,474,510,544,584,609,
+639,667,713,743,792,808,847,870,893,927,941,971,999,1036,1056,1099,
+1118,1143,1172,1207,1218,1239,1265,1289,1308,1332,1343,1350,1354,1350,1352,1359,
+1374,1378,1360,1364,1335,1330,1319,1304,1286,1261,1243,1222,1191,1152,1114,1095,
+1057,1019,978,941,900,858,825,781,740,695,680,624,578,541,495,460,
+409,365,338,291,255,218,181,154,119,83,68,29,2,-34,-45,-66,
+-87,-113,-122,-133,-158,-172,-191,-217,-224,-242,-258,-271,-285,-299,-323,-334,
+-351,-367,-381,-401,-424,-435,-458,-464,-488,-497,-502,-517,-535,-531,-542,-546,
+-549,-551,-559,-563,-560,-549,-559,-563,-572,-579,-582,-590,-581,-572,-575,-578,
+-566,-560,-545,-560,-540,-531,-526,-534,-524,-515,-506,-510,-501,-503,-499,-486,
+-471,-457,-463,-453,-452,-432,-408,-397,-386,-371,-353,-337,-319,-303,-295,-268,
+-242,-210,-190,-171,-142,-91,-64,-27,3,24,45,86,123,161,196,212,
+234,250,276,299,313,308,320,323,337,342,333,332,310,309,295,274,
+262,231,206,172,158,119,99,69,45,7,-21,-49,-75,-111,-137,-166,
+-198,-228,-256,-292,-328,-345,-371,-400,-431,-445,-462,-477,-503,-512,-514,-524,
+-534,-547,-560,-556,-554,-545,-545,-535,-534,-524,-509,-499,-487,-467,-452,-428,
+-405,-382,-360,-328,-302,-284,-267,-241,-212,-179,-157,-123,-102,-67,-59,-19,
+4,39,73,93,114,152,175,204,230,259,279,288,303,319,344,375,
+375,398,416,443,458,471,492,500,512,522,521,533,540,561,553,553,
+553,545,531,526,518,501,505,492,466,453,430,414,397,389,367,340,
+306,287,273,246,217,200,187,171,156,147,133,140,128,140,152,174,
+177,202,223,249,268,293,324,345,381,408,430,477,518,571,603,639,
+674,707,739,759,779,816,834,855,862,895,898,899,898,895,898,881,
+876,851,836,820,793,753,718,669,641,595,541,499,449,386,338,297,
+236,199,142,84,44,-15,-56,-112,-157,-196,-252,-290,-341,-391,-426,-462,
+-516,-556,-590,-631,-657,-700,-729,-740,-765,-799,-822,-842,-871,-896,-916,-945,
+-953,-974,-973,-993,-1018,-1026,-1014,-1009,-1012,-1009,-1000,-983,-971,-964,-948,-927,
+-895,-876,-875,-839,-816,-802,-778,-744,-703,-681,-668,-634,-608,-589,-561,-550,
+-523,-498,-497,-476,-464,-452,-433,-429,-437,-446,-421,-425,-426,-427,-420,-419,
+-432,-422,-441,-435,-452,-448,-459,-457,-452,-468,-464,-460,-447,-430,-421,-415,
+-413,-390,-359,-350,-324,-289,-267,-246,-220,-192,-178,-139,-128,-93,-71,-56,
+-25,14,49,57,89,123,140,159,182,203,228,254,275,305,326,334,
+356,378,399,425,443,444,471,478,499,521,541,553,557,571,574,575,
+592,592,591,594,587,598,604,590,585,580,581,569,563,550,542,529,
+536,520,502,493,484,476,451,450,443,430,428,430,421,416,412,410,
+409,407,400,404,406,397,394,378,378,378,373,369,363,349,340,337,
+333,308,271,255,228,198,159,144,99,74,36,-5,-57,-99,-142,-177,
+-224,-264,-303,-350,-388,-433,-486,-515,-556,-593,-637,-667,-708,-737,-784,-814,
+-833,-854,-871,-888,-885,-886,-881,-901,-890,-896,-904,-902,-889,-872,-862,-862,
+-844,-829,-816,-782,-760,-732,-713,-667,-658,-621,-586,-548,-516,-491,-458,-417,
+-376,-344,-318,-275,-251,-210,-166,-117,-85,-38,-10,20,48,82,116,143,
+177,217,237,260,287,316,332,343,366,375,400,408,419,423,429,427,
+428,419,413,408,402,383,366,346,322,305,286,271,255,253,238,214,
+197,167,159,158,151,142,124,123,116,122,113,136,141,151,164,184,
+198,221,245,256,285,298,319,337,372,397,405,426,449,467,474,485,
+505,526,520,534,558,559,566,553,560,556,550,543,519,516,503,492,
+475,456,435,415,422,403,373,343,313,297,273,222,207,167,133,85,
+70,55,19,-9,-29,-62,-74,-111,-133,-145,-176,-209,-221,-238,-240,-276,
+-291,-301,-319,-326,-338,-342,-343,-349,-344,-333,-308,-295,-294,-290,-276,-243,
+-231,-213,-206,-178,-166,-145,-131,-115,-115,-93,-78,-60,-36,-20,-13,-5,
+19,29,45,47,40,33,23,44,43,51,55,50,50,32,29,24,
+31,35,19,8,-12,-5,-7,-2,-5,-7,-21,-15,-16,-14,-15,-17,
+-11,-8,-1,-3,0,2,7,9,24,20,31,21,24,9,23,34,
+42,30,30,38,49,53,57,64,75,73,92,91,89,99,108,122,
+130,154,168,179,177,202,215,247,255,282,294,308,327,335,369,386,
+389,401,421,441,451,465,464,485,500,501,517,525,515,510,514,509,
+497,485,485,475,464,447,432,426,408,390,365,365,353,340,327,309,
+280,277,268,260,243,230,229,224,217,203,191,180,168,171,170,168,
+156,147,136,137,124,110,92,89,73,55,31,21,12,4,-10,-22,
+-30,-47,-65,-78,-86,-105,-128,-134,-151,-160,-175,-199,-211,-219,-232,-252,
+-258,-267,-285,-291,-298,-310,-322,-335,-351,-345,-360,-353,-362,-377,-384,-399,
+-405,-401,-394,-393,-384,-390,-373,-349,-348,-345,-323,-307,-285,-273,-255,-246,
+-218,-192,-171,-143,-123,-103,-101,-68,-45,-13,7,44,72,90,112,135,
+158,187,226,248,263,282,309,331,355,386,410,433,454,474,485,513,
+526,525,515,524,521,531,525,515,500,487,480,459,441,412,399,370,
+353,334,307,274,231,202,167,129,81,26,-11,-69,-127,-160,-204,-252,
+-312,-362,-416,-461,-518,-557,-605,-676,-714,-786,-850,-889,-936,-967,-1018,-1041,
+-1072,-1107,-1131,-1157,-1184,-1203,-1223,-1234,-1249,-1250,-1252,-1260,-1242,-1244,-1228,-1226,
+-1197,-1190,-1172,-1165,-1133,-1103,-1072,-1043,-1018,-988,-962,-945,-913,-891,-856,-835,
+-809,-788,-773,-757,-725,-712,-695,-681,-678,-651,-649,-646,-628,-622,-628,-622,
+-609,-602,-597,-592,-587,-580,-558,-548,-536,-522,-494,-473,-429,-420,-391,-356,
+-317,-276,-231,-192,-139,-87,-46,5,54,122,191,249,312,364,423,497,
+561,617,681,749,821,878,939,996,1074,1128,1200,1258,1320,1362,1416,1471,
+1520,1567,1619,1663,1706,1750,1774,1799,1832,1846,1856,1866,1872,1874,1869,1871,
+1854,1846,1825,1795,1766,1726,1704,1673,1623,1577,1514,1461,1401,1363,1284,1225,
+1136,1080,1010,951,871,795,725,662,614,539,461,384,306,253,196,139,
+67,22,-38,-93,-140,-206,-254,-304,-338,-376,-423,-485,-520,-555,-583,-609,
+-655,-696,-727,-753,-783,-806,-826,-841,-877,-876,-882,-890,-909,-907,-903,-909,
+-900,-905,-894,-893,-890,-873,-870,-872,-867,-856,-842,-834,-822,-813,-803,-793,
+-766,-780,-774,-765,-742,-728,-728,-719,-707,-699,-704,-692,-680,-671,-662,-646,
+-635,-626,-607,-592,-564,-561,-550,-519,-498,-476,-455,-434,-419,-388,-362,-343,
+-309,-268,-233,-204,-164,-125,-92,-58,-21,20,58,94,122,169,210,241,
+265,316,341,368,399,428,440,468,487,494,511,519,535,541,534,542,
+520,513,496,485,463,451,440,429,412,389,367,337,317,299,277,268,
+236,216,190,165,140,110,102,80,57,24,4,-15,-30,-50,-64,-87,
+-115,-137,-159,-176,-209,-221,-255,-284,-304,-328,-348,-376,-401,-422,-447,-465,
+-482,-499,-517,-549,-565,-589,-595,-612,-624,-639,-650,-654,-658,-654,-666,-668,
+-660,-632,-627,-621,-604,-593,-580,-574,-550,-536,-517,-515,-486,-475,-449,-441,
+-432,-427,-402,-385,-385,-361,-349,-343,-335,-322,-315,-313,-291,-282,-266,-259,
+-242,-232,-222,-184,-171,-145,-131,-105,-82,-51,-25,12,42,69,96,137,
+174,210,247,271,309,346,386,419,458,502,527,576,617,665,703,750,
+798,835,868,909,954,1002,1036,1083,1125,1161,1205,1248,1298,1332,1360,1386,
+1416,1440,1467,1489,1515,1535,1549,1561,1588,1586,1591,1605,1591,1591,1596,1576,
+1570,1543,1522,1493,1466,1426,1399,1346,1301,1255,1215,1170,1119,1062,1004,955,
+897,839,783,727,675,623,563,506,447,394,349,287,239,188,142,113,
+70,49,5,-31,-63,-92,-128,-153,-188,-201,-239,-275,-302,-331,-362,-379,
+-402,-429,-456,-476,-506,-528,-562,-582,-600,-631,-639,-665,-708,-739,-767,-788,
+-809,-849,-881,-904,-925,-955,-982,-1001,-1023,-1037,-1073,-1106,-1112,-1128,-1143,-1163,
+-1165,-1178,-1186,-1182,-1191,-1189,-1204,-1207,-1206,-1208,-1202,-1219,-1202,-1191,-1195,-1201,
+-1196,-1197,-1197,-1203,-1199,-1202,-1184,-1185,-1181,-1182,-1167,-1165,-1152,-1133,-1118,-1095,
+-1087,-1066,-1044,-1022,-989,-943,-907,-874,-814,-769,-721,-674,-612,-543,-479,-426,
+-364,-295,-227,-159,-89,-22,46,124,181,250,312,363,418,489,542,594,
+641,688,736,782,831,864,906,939,957,979,993,1014,1028,1037,1047,1046,
+1041,1038,1052,1034,1024,1009,987,991,972,952,925,891,874,839,799,769,
+748,702,683,650,624,590,564,533,506,456,428,407,381,350,312,290,
+263,226,193,165,141,113,85,49,32,10,-15,-31,-57,-81,-108,-138,
+-151,-185,-200,-236,-259,-283,-305,-336,-359,-381,-399,-423,-438,-457,-469,-496,
+-518,-546,-562,-589,-617,-622,-637,-651,-672,-674,-664,-652,-660,-661,-667,-658,
+-649,-646,-635,-629,-614,-592,-559,-538,-517,-495,-489,-457,-422,-383,-358,-327,
+-286,-262,-221,-184,-135,-116,-84,-57,-21,18,56,89,123,156,174,207,
+245,273,306,338,353,383,401,437,464,483,512,521,533,545,562,595,
+612,621,659,676,693,717,736,750,774,789,805,822,840,852,861,870,
+882,884,883,884,896,884,886,878,870,865,856,833,824,804,771,754,
+738,724,694,656,624,600,586,550,531,500,479,454,429,406,380,363,
+340,317,305,292,280,260,231,207,196,173,153,123,115,105,90,55,
+28,-2,-32,-54,-86,-131,-171,-211,-256,-287,-336,-382,-423,-490,-541,-590,
+-637,-691,-737,-790,-828,-881,-922,-969,-1015,-1054,-1096,-1116,-1145,-1161,-1184,-1219,
+-1242,-1245,-1250,-1245,-1251,-1250,-1265,-1238,-1232,-1228,-1202,-1190,-1169,-1141,-1128,-1099,
+-1075,-1034,-1017,-983,-944,-905,-873,-837,-796,-760,-723,-676,-629,-591,-546,-514,
+-456,-419,-367,-323,-290,-242,-191,-130,-88,-37,18,82,140,193,250,305,
+364,419,489,550,614,661,715,771,825,877,925,981,1026,1083,1124,1157,
+1201,1216,1232,1255,1289,1305,1313,1324,1329,1303,1301,1284,1274,1252,1220,1190,
+1131,1099,1056,1022,968,931,861,820,749,702,652,593,538,468,432,381,
+331,296,245,195,157,131,85,29,-12,-34,-71,-99,-112,-146,-171,-200,
+-220,-232,-249,-270,-269,-274,-275,-290,-291,-304,-309,-320,-322,-324,-328,-343,
+-365,-356,-363,-370,-374,-387,-404,-421,-431,-441,-451,-449,-476,-487,-499,-515,
+-532,-552,-571,-594,-616,-618,-643,-670,-678,-696,-697,-714,-733,-759,-771,-780,
+-798,-818,-815,-812,-828,-845,-845,-850,-849,-841,-829,-824,-815,-789,-774,-757,
+-747,-719,-694,-665,-642,-619,-591,-560,-540,-505,-462,-426,-399,-366,-340,-299,
+-279,-244,-197,-170,-138,-109,-79,-50,-8,22,43,71,116,145,173,216,
+247,290,333,362,388,430,469,495,526,533,571,596,613,615,628,637,
+659,659,679,666,661,652,643,619,606,580,574,549,507,473,441,413,
+376,349,312,282,245,212,183,153,122,78,58,19,-15,-38,-56,-81,
+-98,-119,-126,-144,-153,-163,-178,-185,-183,-181,-191,-178,-181,-185,-174,-175,
+-167,-158,-158,-156,-142,-139,-116,-104,-103,-89,-80,-57,-49,-20,-14,5,
+-6,16,32,49,56,76,77,96,89,99,113,117,126,119,137,147,
+149,158,162,165,173,164,158,154,148,158,162,155,159,160,150,151,
+149,161,162,170,170,182,182,187,203,202,224,218,241,252,250,262,
+281,277,301,302,302,314,334,337,341,336,355,343,351,351,349,353,
+360,355,352,341,325,320,314,302,290,272,255,233,205,179,166,149,
+115,99,76,52,23,-10,-24,-54,-72,-100,-123,-158,-169,-195,-214,-234,
+-240,-238,-249,-260,-266,-279,-288,-272,-263,-250,-233,-213,-204,-186,-182,-165,
+-146,-132,-121,-101,-89,-77,-66,-42,-36,-25,-6,3,22,33,46,52,
+48,56,45,49,55,41,42,36,32,21,4,-2,1,-13,-22,-36,
+-51,-70,-67,-73,-82,-90,-109,-121,-146,-154,-170,-185,-196,-225,-232,-239,
+-247,-254,-267,-287,-303,-316,-332,-330,-338,-352,-369,-384,-380,-394,-400,-403,
+-397,-390,-395,-383,-367,-344,-333,-319,-297,-266,-245,-215,-181,-158,-117,-75,
+-33,7,52,89,135,179,214,256,304,345,395,433,478,516,553,580,
+617,653,686,710,736,761,775,795,816,838,843,843,834,841,847,843,
+839,835,821,804,788,779,752,735,710,690,669,646,615,593,567,528,
+499,473,455,427,405,373,340,301,287,262,245,228,205,175,169,142,
+124,112,107,104,84,83,68,78,73,64,53,66,67,75,76,82,
+86,93,94,99,119,119,134,129,138,121,122,121,132,127,109,101,
+81,74,58,42,39,0,-20,-32,-54,-82,-109,-125,-154,-187,-221,-250,
+-283,-307,-341,-362,-404,-411,-439,-462,-497,-506,-521,-545,-567,-581,-601,-642,
+-653,-676,-698,-700,-730,-736,-758,-765,-767,-788,-801,-820,-841,-837,-852,-870,
+-880,-886,-894,-891,-904,-899,-915,-924,-916,-909,-912,-908,-903,-883,-866,-866,
+-847,-834,-802,-768,-742,-708,-678,-645,-605,-550,-528,-484,-443,-396,-350,-296,
+-250,-215,-149,-100,-66,-29,-6,34,58,78,107,139,163,181,203,210,
+220,221,236,237,231,233,220,211,214,193,173,164,150,129,114,102,
+90,85,70,56,47,30,27,20,27,28,24,6,10,6,18,17,
+27,31,40,50,73,64,77,89,95,112,128,150,157,166,171,175,
+190,203,211,215,223,232,229,249,246,265,273,274,287,291,298,303,
+310,318,330,327,334,336,350,354,356,368,382,377,374,370,378,377,
+377,368,369,374,365,348,340,325,339,320,319,318,309,306,293,301,
+280,271,270,266,268,278,270,270,273,271,275,275,287,280,292,303,
+314,319,332,345,366,384,394,408,431,450,456,480,490,518,522,525,
+540,561,555,569,581,596,594,600,590,583,581,583,568,542,525,501,
+483,459,437,430,391,358,325,300,254,227,199,159,110,81,43,3,
+-42,-78,-114,-149,-202,-236,-271,-309,-338,-374,-397,-435,-467,-505,-528,-551,
+-580,-610,-630,-640,-663,-685,-695,-714,-730,-728,-722,-727,-724,-719,-709,-707,
+-709,-704,-696,-687,-664,-660,-653,-647,-639,-632,-622,-611,-592,-577,-576,-591,
+-595,-584,-595,-593,-597,-599,-617,-632,-639,-668,-686,-706,-718,-760,-785,-802,
+-825,-840,-874,-905,-925,-946,-970,-1000,-1020,-1029,-1054,-1072,-1089,-1084,-1084,-1071,
+-1065,-1070,-1055,-1046,-1034,-1020,-1007,-982,-942,-903,-881,-849,-816,-772,-739,-699,
+-661,-631,-574,-521,-448,-415,-367,-315,-265,-208,-152,-102,-52,7,52,100,
+154,198,247,301,347,403,443,493,537,576,617,653,699,742,781,813,
+841,865,889,916,941,962,980,983,995,994,1006,1030,1036,1035,1037,1048,
+1030,1034,1021,1004,1002,973,961,945,932,914,880,867,848,819,809,787,
+780,763,727,708,687,668,645,620,613,592,580,573,548,542,528,523,
+516,508,511,511,512,502,503,508,530,540,534,519,525,548,548,568,
+572,581,569,573,579,600,596,605,594,612,616,620,628,615,604,602,
+612,608,601,590,583,590,584,567,547,543,528,508,484,470,461,431,
+422,402,380,352,336,318,294,266,252,231,217,206,180,152,132,113,
+98,80,71,38,17,3,6,-4,-12,-38,-48,-40,-48,-76,-89,-88,
+-106,-107,-128,-127,-138,-142,-160,-163,-182,-193,-203,-210,-220,-220,-238,-258,
+-274,-305,-332,-346,-375,-388,-398,-416,-444,-469,-496,-514,-517,-528,-529,-537,
+-553,-566,-569,-560,-565,-562,-567,-557,-567,-558,-546,-538,-523,-522,-505,-497,
+-488,-480,-463,-459,-457,-446,-439,-430,-430,-427,-428,-427,-427,-434,-452,-445,
+-452,-442,-453,-455,-455,-464,-471,-473,-472,-470,-467,-472,-468,-466,-469,-469,
+-460,-460,-461,-451,-442,-438,-419,-405,-390,-378,-351,-330,-313,-307,-290,-285,
+-254,-240,-212,-191,-182,-169,-155,-135,-107,-95,-86,-84,-67,-57,-39,-41,
+-36,-37,-31,-23,-30,-28,-38,-33,-36,-41,-41,-35,-42,-46,-40,-45,
+-45,-62,-61,-60,-62,-61,-72,-78,-91,-87,-98,-96,-92,-94,-86,-90,
+-81,-83,-78,-71,-54,-53,-48,-41,-41,-38,-36,-14,-27,-17,-12,-18,
+-18,-23,-17,4,-4,-26,-39,-56,-46,-54,-63,-77,-93,-113,-118,-137,
+-151,-163,-189,-204,-209,-221,-235,-241,-255,-255,-271,-277,-291,-295,-289,-298,
+-294,-289,-285,-289,-265,-270,-254,-241,-211,-189,-166,-132,-103,-89,-68,-40,
+-7,36,62,108,141,178,221,283,328,369,411,470,529,564,608,656,
+713,748,795,828,860,893,942,967,988,1028,1036,1056,1083,1109,1122,1146,
+1161,1170,1174,1186,1178,1173,1159,1165,1165,1150,1135,1132,1113,1098,1088,1063,
+1042,1026,1004,977,945,902,864,835,795,762,721,680,633,587,532,487,
+443,387,331,276,213,159,91,42,-14,-73,-122,-186,-226,-292,-339,-391,
+-438,-485,-521,-553,-576,-612,-630,-657,-686,-705,-712,-734,-738,-742,-749,-739,
+-734,-735,-734,-728,-722,-701,-695,-689,-688,-677,-669,-673,-676,-688,-687,-692,
+-710,-723,-727,-746,-761,-779,-790,-817,-820,-834,-853,-874,-897,-888,-905,-927,
+-930,-946,-943,-963,-972,-980,-972,-976,-965,-961,-965,-947,-947,-926,-914,-896,
+-880,-850,-824,-801,-784,-765,-726,-710,-675,-642,-610,-581,-542,-496,-454,-417,
+-385,-362,-328,-282,-248,-200,-163,-117,-87,-57,-20,1,46,71,105,136,
+168,196,241,275,305,315,346,376,395,426,442,464,482,511,548,572,
+588,619,632,660,677,703,722,730,746,760,782,798,806,819,822,827,
+834,832,835,838,837,842,841,851,829,828,824,818,809,802,778,777,
+765,738,727,707,695,663,635,627,604,580,550,519,506,480,445,418,
+391,359,336,313,277,261,239,217,185,164,148,126,111,89,66,55,
+59,44,27,7,-8,-14,-15,-23,-29,-45,-49,-58,-48,-50,-60,-54,
+-68,-78,-87,-104,-102,-112,-118,-142,-144,-153,-163,-175,-203,-201,-213,-227,
+-239,-250,-249,-264,-270,-279,-304,-318,-332,-336,-342,-349,-353,-364,-359,-367,
+-364,-355,-359,-349,-335,-320,-307,-303,-296,-269,-250,-239,-230,-206,-197,-177,
+-170,-138,-128,-117,-96,-74,-59,-40,-34,-22,-24,-16,-2,-5,-7,-4,
+13,10,1,21,21,14,15,15,22,21,34,37,59,72,87,83,
+104,122,133,153,165,176,190,219,252,276,293,318,340,360,375,393,
+416,428,453,464,479,490,503,511,518,521,525,524,529,525,533,531,
+527,515,505,486,470,456,432,423,394,376,350,332,307,295,276,260,
+236,205,189,173,155,135,110,86,61,39,-5,-34,-57,-80,-116,-127,
+-154,-177,-214,-250,-270,-305,-328,-366,-403,-434,-462,-493,-521,-555,-591,-633,
+-655,-682,-712,-735,-754,-774,-795,-818,-823,-826,-832,-848,-857,-858,-864,-859,
+-863,-868,-868,-862,-843,-819,-792,-784,-763,-746,-718,-695,-662,-629,-599,-572,
+-543,-523,-492,-450,-413,-380,-345,-297,-253,-214,-173,-123,-85,-56,-10,24,
+78,106,141,180,216,243,280,309,336,368,396,439,461,486,507,535,
+552,577,597,609,608,620,625,641,655,650,659,661,654,649,631,628,
+617,611,603,606,598,579,568,560,542,521,515,500,492,479,471,459,
+452,437,428,426,417,409,390,385,380,371,353,336,315,293,285,251,
+238,224,201,179,136,117,81,56,14,-23,-57,-96,-136,-173,-210,-258,
+-287,-316,-356,-405,-444,-468,-481,-523,-549,-572,-590,-632,-663,-688,-710,-730,
+-764,-789,-803,-816,-835,-863,-861,-888,-894,-900,-914,-921,-931,-924,-932,-936,
+-934,-926,-918,-922,-920,-906,-907,-898,-886,-875,-870,-844,-836,-809,-798,-772,
+-743,-723,-697,-671,-647,-611,-586,-535,-493,-451,-416,-365,-300,-244,-200,-150,
+-107,-32,33,92,157,214,285,359,418,472,538,591,663,747,796,848,
+896,967,1022,1067,1125,1170,1216,1260,1291,1324,1345,1376,1403,1419,1431,1454,
+1478,1488,1494,1502,1508,1500,1499,1493,1482,1487,1476,1462,1448,1436,1411,1384,
+1361,1354,1322,1296,1276,1245,1224,1212,1177,1150,1126,1098,1067,1042,1004,969,
+936,887,855,819,795,738,689,643,599,545,480,410,374,322,253,178,
+126,71,2,-60,-128,-195,-261,-326,-387,-448,-499,-572,-627,-689,-744,-801,
+-857,-912,-964,-1012,-1056,-1123,-1162,-1215,-1235,-1275,-1312,-1334,-1359,-1382,-1388,-1394,
+-1416,-1427,-1426,-1419,-1411,-1402,-1401,-1399,-1390,-1366,-1347,-1321,-1304,-1297,-1268,-1230,
+-1203,-1185,-1168,-1144,-1123,-1095,-1070,-1054,-1027,-1009,-991,-978,-951,-946,-942,-927,
+-919,-899,-886,-872,-858,-827,-829,-797,-789,-766,-732,-716,-714,-677,-652,-627,
+-603,-563,-527,-498,-471,-418,-386,-351,-312,-269,-219,-193,-149,-101,-69,-22,
+29,78,124,173,221,275,320,367,414,458,510,548,600,645,678,715,
+750,785,804,833,879,918,955,972,998,1031,1068,1086,1113,1139,1167,1181,
+1202,1207,1243,1249,1261,1264,1276,1286,1291,1296,1286,1274,1268,1261,1251,1227,
+1218,1188,1167,1120,1085,1048,1004,950,898,843,789,737,675,613,538,478,
+416,349,288,228,168,93,32,-33,-84,-152,-212,-264,-322,-364,-408,-458,
+-488,-528,-563,-584,-609,-611,-639,-642,-649,-657,-670,-668,-651,-644,-622,-617,
+-588,-576,-541,-531,-498,-472,-431,-410,-377,-337,-316,-277,-250,-213,-186,-161,
+-130,-98,-74,-45,-31,-7,25,40,75,81,107,127,149,164,178,196,
+201,224,231,241,253,256,241,248,258,271,250,249,236,239,236,231,
+231,234,219,205,203,194,184,181,158,160,153,144,126,112,114,99,
+93,74,75,56,49,28,9,-6,-20,-30,-47,-51,-86,-96,-112,-121,
+-144,-149,-154,-160,-175,-173,-183,-200,-194,-201,-197,-202,-211,-224,-223,-220,
+-205,-195,-188,-188,-187,-175,-178,-159,-158,-165,-154,-154,-140,-140,-145,-138,
+-141,-138,-135,-134,-131,-154,-172,-164,-180,-194,-205,-240,-249,-283,-309,-335,
+-376,-409,-439,-478,-492,-529,-575,-604,-642,-672,-709,-731,-756,-790,-821,-832,
+-855,-889,-899,-916,-928,-947,-951,-950,-958,-953,-954,-940,-926,-919,-913,-906,
+-889,-867,-856,-824,-814,-785,-776,-755,-741,-719,-693,-661,-628,-607,-588,-563,
+-536,-495,-452,-418,-392,-366,-331,-298,-264,-242,-206,-168,-114,-84,-45,-6,
+26,61,102,157,188,242,283,333,369,414,455,498,535,581,616,657,
+699,734,774,805,839,883,901,925,961,995,1017,1045,1072,1080,1093,1105,
+1118,1124,1132,1144,1150,1165,1169,1179,1175,1181,1173,1178,1169,1171,1176,1164,
+1148,1135,1125,1112,1104,1097,1075,1066,1049,1030,1022,1007,999,967,951,918,
+908,877,847,829,810,785,756,726,691,665,644,610,574,536,505,465,
+437,399,357,323,287,248,216,188,140,105,77,35,-4,-33,-51,-85,
+-112,-149,-177,-202,-237,-263,-271,-291,-318,-337,-353,-361,-378,-384,-395,-403,
+-414,-409,-406,-391,-409,-407,-408,-405,-393,-398,-394,-383,-380,-375,-366,-360,
+-341,-317,-320,-310,-294,-280,-267,-254,-242,-228,-209,-218,-227,-217,-221,-212,
+-212,-212,-222,-228,-231,-247,-249,-269,-280,-291,-303,-311,-337,-359,-377,-401,
+-399,-421,-437,-454,-460,-468,-475,-474,-481,-478,-467,-461,-452,-446,-426,-408,
+-390,-365,-327,-300,-270,-241,-210,-167,-129,-88,-45,-4,39,67,116,145,
+177,219,248,272,304,334,353,388,401,411,422,426,431,433,425,413,
+421,406,386,369,336,304,284,248,223,176,158,114,66,38,2,-39,
+-84,-138,-170,-224,-265,-317,-346,-382,-429,-472,-511,-559,-599,-626,-673,-707,
+-734,-757,-788,-819,-845,-856,-880,-915,-929,-944,-973,-985,-997,-1013,-1027,-1049,
+-1044,-1054,-1048,-1059,-1049,-1057,-1065,-1055,-1045,-1036,-1034,-1006,-985,-973,-948,-927,
+-902,-875,-833,-798,-756,-720,-675,-631,-588,-553,-505,-465,-422,-374,-326,-290,
+-235,-193,-120,-84,-31,7,51,94,152,208,261,308,359,396,452,488,
+525,573,614,659,700,747,780,821,862,899,935,979,1010,1045,1077,1104,
+1131,1160,1189,1213,1242,1266,1274,1301,1305,1333,1352,1357,1369,1383,1391,1405,
+1418,1419,1419,1424,1434,1437,1431,1437,1436,1431,1418,1418,1422,1413,1395,1386,
+1374,1352,1339,1320,1302,1285,1246,1219,1188,1153,1118,1086,1040,996,962,912,
+856,813,764,726,669,622,569,532,487,431,379,344,289,243,189,145,
+98,49,8,-30,-71,-107,-141,-155,-204,-218,-256,-288,-325,-354,-386,-411,
+-435,-471,-495,-536,-550,-585,-595,-624,-651,-696,-710,-740,-760,-786,-810,-835,
+-861,-875,-912,-929,-944,-960,-980,-1011,-1032,-1044,-1050,-1052,-1057,-1067,-1079,-1065,
+-1076,-1075,-1084,-1066,-1061,-1051,-1050,-1040,-1026,-1018,-993,-986,-971,-945,-923,-916,
+-890,-876,-862,-840,-812,-791,-772,-770,-748,-739,-719,-705,-710,-695,-694,-704,
+-700,-704,-698,-704,-693,-682,-695,-695,-706,-708,-710,-709,-716,-718,-719,-697,
+-691,-687,-678,-661,-649,-644,-623,-598,-578,-548,-506,-482,-443,-429,-395,-366,
+-335,-303,-268,-219,-189,-160,-135,-100,-63,-31,-5,11,44,60,84,102,
+129,142,166,166,172,178,195,199,202,196,198,206,200,195,200,187,
+169,159,146,146,143,132,130,112,106,99,94,92,85,94,92,86,
+77,80,76,77,92,95,101,104,105,121,125,120,138,159,177,177,
+185,202,217,240,248,260,270,292,308,328,331,351,359,376,397,417,
+434,455,469,490,501,501,519,529,542,553,548,552,553,562,561,571,
+576,574,569,576,580,573,570,574,563,559,538,542,525,519,501,486,
+482,468,465,448,426,391,384,377,358,329,324,303,284,258,238,217,
+202,177,150,138,116,107,89,72,55,34,30,26,23,13,12,12,
+9,1,13,31,39,42,56,72,96,104,126,151,172,200,231,273,
+290,324,345,365,389,402,433,459,467,492,503,508,519,521,535,534,
+541,526,520,506,488,474,453,436,400,368,342,315,279,251,231,204,
+174,144,111,86,71,39,23,-6,-15,-25,-47,-72,-90,-94,-110,-115,
+-117,-127,-134,-129,-119,-122,-123,-121,-100,-91,-84,-69,-77,-90,-69,-64,
+-48,-43,-18,-22,-13,6,11,14,23,30,33,35,36,46,31,34,
+20,21,29,29,13,4,1,-14,-16,-31,-36,-46,-48,-48,-71,-86,
+-93,-90,-106,-111,-124,-139,-150,-142,-149,-151,-171,-183,-201,-203,-203,-216,
+-225,-243,-260,-276,-279,-282,-300,-321,-328,-335,-334,-345,-362,-369,-376,-385,
+-383,-398,-395,-395,-406,-412,-401,-405,-395,-391,-394,-392,-387,-375,-361,-350,
+-336,-324,-313,-297,-287,-263,-254,-234,-219,-206,-194,-182,-157,-151,-129,-113,
+-89,-77,-67,-58,-41,-20,-6,4,6,20,32,34,39,46,60,62,
+61,59,77,74,87,80,84,86,79,73,65,74,57,55,46,44,
+22,26,17,18,2,8,1,-3,-13,2,-9,-1,-5,-3,-6,7,
+13,26,38,46,64,75,101,115,133,152,160,164,179,204,224,244,
+254,256,269,270,275,264,267,267,267,273,259,248,235,217,207,191,
+177,169,147,137,117,105,81,73,57,36,23,-3,-14,-27,-37,-67,
+-69,-77,-74,-77,-87,-88,-89,-97,-93,-90,-96,-83,-79,-73,-80,-66,
+-74,-81,-66,-60,-40,-52,-38,-39,-43,-35,-41,-40,-22,-26,-40,-40,
+-35,-34,-40,-39,-40,-35,-28,-24,-16,-22,-14,-10,7,8,15,22,
+22,50,59,69,74,98,108,119,143,144,151,162,189,200,215,217,
+221,221,235,230,229,232,222,225,220,227,230,215,222,212,197,183,
+172,156,142,133,106,90,79,60,60,46,30,35,9,2,-12,-26,
+-28,-30,-39,-42,-54,-72,-83,-86,-78,-93,-89,-92,-81,-88,-69,-76,
+-77,-83,-79,-70,-73,-75,-76,-74,-79,-81,-90,-102,-100,-102,-115,-120,
+-128,-142,-153,-164,-183,-203,-214,-229,-245,-263,-279,-303,-328,-348,-384,-404,
+-435,-446,-477,-511,-541,-557,-575,-598,-625,-658,-683,-692,-714,-737,-751,-769,
+-778,-786,-807,-816,-805,-809,-805,-819,-817,-806,-788,-776,-774,-764,-750,-732,
+-722,-708,-692,-670,-647,-639,-599,-586,-553,-524,-500,-473,-446,-416,-396,-363,
+-344,-324,-290,-267,-234,-216,-194,-192,-168,-132,-119,-97,-81,-63,-47,-35,
+-11,-4,6,22,30,52,59,76,90,96,112,132,148,166,177,202,
+208,228,232,241,254,267,282,286,302,313,322,326,332,351,347,358,
+351,375,375,376,382,374,379,387,396,399,412,414,425,417,426,439,
+447,463,483,492,515,528,551,569,598,621,649,671,694,717,734,757,
+791,826,847,855,875,899,923,929,956,966,972,976,990,974,978,973,
+972,951,938,926,903,886,878,841,817,779,752,709,686,650,621,589,
+546,521,490,463,436,398,359,326,298,286,268,234,224,200,180,159,
+138,118,99,99,81,71,49,33,13,-7,-25,-36,-38,-51,-60,-70,
+-87,-104,-118,-138,-149,-149,-167,-193,-202,-215,-227,-249,-262,-274,-292,-306,
+-322,-341,-366,-379,-402,-403,-420,-445,-465,-488,-492,-500,-508,-530,-550,-562,
+-572,-582,-592,-590,-594,-596,-590,-601,-599,-607,-598,-593,-586,-574,-561,-549,
+-539,-532,-525,-509,-497,-480,-463,-438,-436,-417,-393,-372,-360,-351,-338,-315,
+-302,-288,-271,-255,-235,-238,-210,-187,-181,-161,-154,-136,-114,-108,-103,-110,
+-89,-97,-96,-95,-104,-88,-77,-79,-79,-88,-83,-88,-80,-92,-85,-87,
+-70,-82,-85,-86,-78,-82,-80,-83,-90,-86,-90,-88,-92,-99,-105,-103,
+-104,-112,-112,-114,-123,-129,-137,-140,-141,-141,-146,-157,-174,-172,-182,-187,
+-203,-201,-206,-213,-207,-217,-221,-224,-221,-224,-215,-211,-212,-200,-203,-196,
+-178,-170,-155,-141,-134,-130,-110,-91,-80,-63,-54,-37,-23,-1,2,17,
+35,45,59,72,78,74,90,92,106,95,106,112,116,112,110,117,
+108,98,97,101,96,83,103,101,111,110,116,134,124,140,148,161,
+182,203,228,260,278,298,332,351,391,420,464,491,525,553,591,629,
+672,707,739,773,810,848,870,898,912,965,988,1005,1033,1054,1075,1070,
+1086,1100,1114,1117,1133,1129,1125,1106,1111,1111,1096,1090,1073,1055,1039,1041,
+1023,1003,972,956,944,914,893,865,837,803,780,733,701,668,628,610,
+571,538,490,455,412,381,343,306,270,230,192,152,110,54,17,-11,
+-47,-93,-135,-172,-199,-229,-264,-291,-336,-358,-394,-418,-451,-480,-498,-527,
+-559,-584,-613,-617,-628,-650,-681,-693,-687,-698,-699,-716,-711,-707,-705,-697,
+-701,-699,-675,-674,-664,-653,-632,-626,-617,-597,-586,-572,-561,-551,-527,-516,
+-503,-490,-485,-465,-455,-456,-443,-432,-420,-416,-405,-411,-408,-393,-396,-392,
+-395,-398,-412,-419,-428,-436,-449,-446,-459,-462,-466,-479,-487,-499,-507,-512,
+-518,-537,-538,-539,-535,-556,-551,-544,-550,-550,-552,-538,-541,-524,-523,-518,
+-500,-487,-469,-461,-443,-448,-435,-415,-405,-381,-380,-368,-363,-347,-330,-331,
+-327,-319,-316,-303,-301,-297,-300,-289,-299,-305,-306,-318,-314,-319,-318,-333,
+-341,-349,-356,-364,-373,-379,-388,-394,-381,-384,-398,-410,-429,-426,-420,-414,
+-416,-424,-436,-427,-430,-421,-418,-410,-418,-405,-414,-390,-388,-385,-372,-376,
+-375,-365,-349,-346,-323,-322,-305,-308,-288,-270,-236,-222,-195,-180,-168,-138,
+-106,-78,-54,-34,1,37,74,111,132,175,207,238,280,327,369,405,
+451,492,520,559,607,642,686,724,764,788,835,859,886,912,945,979,
+1007,1041,1058,1083,1101,1119,1140,1150,1160,1171,1198,1197,1212,1210,1213,1206,
+1212,1217,1204,1213,1225,1221,1207,1203,1200,1201,1181,1182,1181,1175,1162,1166,
+1150,1143,1124,1124,1107,1098,1090,1061,1056,1048,1024,1010,990,950,929,918,
+901,873,848,804,783,755,720,670,621,587,556,519,472,424,378,336,
+277,227,186,130,75,29,-35,-87,-134,-191,-244,-300,-348,-398,-442,-494,
+-531,-581,-622,-662,-698,-747,-782,-798,-828,-845,-872,-879,-900,-917,-927,-927,
+-927,-941,-933,-935,-930,-938,-930,-921,-902,-904,-889,-884,-870,-862,-851,-842,
+-836,-827,-821,-824,-835,-825,-822,-825,-831,-834,-823,-842,-839,-843,-873,-871,
+-865,-865,-865,-875,-869,-874,-880,-877,-876,-866,-865,-872,-860,-846,-837,-815,
+-802,-784,-776,-746,-733,-706,-684,-662,-634,-611,-599,-564,-528,-512,-479,-461,
+-428,-418,-377,-343,-323,-298,-264,-245,-214,-186,-153,-130,-93,-75,-52,-32,
+-6,29,53,79,110,133,155,178,206,244,267,291,318,339,359,382,
+406,443,468,496,516,534,552,579,595,612,630,634,652,648,664,661,
+669,670,674,659,656,651,640,622,614,588,571,552,532,507,475,454,
+427,393,369,335,306,263,237,199,175,146,108,81,44,17,-4,-26,
+-58,-81,-99,-113,-141,-149,-152,-163,-178,-185,-190,-198,-193,-211,-220,-213,
+-213,-196,-199,-191,-183,-189,-179,-165,-157,-146,-139,-132,-138,-132,-109,-103,
+-99,-84,-87,-85,-72,-64,-66,-55,-45,-42,-34,-23,-8,12,12,18,
+31,48,66,70,76,86,115,133,142,146,167,196,219,231,245,250,
+267,289,302,323,343,371,375,385,411,431,446,465,485,498,519,536,
+551,560,564,576,587,595,600,602,604,618,609,606,600,604,608,602,
+603,595,584,576,577,577,562,552,556,550,544,531,523,511,507,500,
+498,503,485,481,473,483,459,452,454,458,449,433,424,414,410,393,
+377,363,352,336,325,292,277,247,228,197,175,137,108,66,31,-10,
+-50,-88,-123,-161,-215,-247,-284,-322,-364,-403,-438,-489,-517,-570,-579,-614,
+-645,-677,-705,-733,-761,-769,-781,-788,-804,-824,-834,-840,-838,-844,-856,-849,
+-854,-860,-870,-871,-866,-873,-879,-880,-871,-878,-877,-883,-886,-882,-870,-883,
+-871,-880,-859,-856,-862,-846,-845,-838,-822,-818,-808,-787,-773,-762,-746,-741,
+-712,-676,-657,-633,-608,-591,-573,-545,-518,-486,-454,-420,-385,-372,-333,-308,
+-261,-224,-185,-164,-132,-94,-57,-10,19,52,91,137,172,212,246,277,
+310,335,379,420,455,487,531,558,583,620,651,689,715,740,770,804,
+823,845,865,888,918,933,954,966,971,991,999,1008,1023,1035,1036,1036,
+1025,1017,1006,1002,992,975,969,940,919,900,880,854,828,797,770,720,
+695,656,619,573,526,501,453,421,372,326,295,261,217,178,127,103,
+75,43,7,-37,-66,-90,-111,-138,-179,-207,-225,-248,-273,-290,-312,-323,
+-330,-347,-351,-368,-379,-380,-381,-396,-405,-404,-414,-407,-404,-398,-400,-399,
+-389,-398,-390,-389,-371,-371,-370,-361,-358,-354,-332,-326,-325,-319,-318,-301,
+-297,-287,-291,-286,-284,-278,-263,-257,-250,-246,-237,-240,-232,-234,-229,-213,
+-204,-196,-192,-171,-158,-147,-122,-111,-86,-65,-39,-8,30,53,70,103,
+148,169,199,255,287,321,350,380,420,444,488,532,562,581,606,621,
+640,663,682,698,703,719,727,724,733,724,733,748,730,725,714,702,
+687,679,667,650,618,603,580,556,535,508,474,440,415,391,356,325,
+288,254,233,206,166,122,88,54,25,-8,-44,-76,-107,-147,-177,-202,
+-235,-270,-298,-335,-363,-395,-432,-465,-497,-523,-563,-598,-618,-635,-666,-695,
+-712,-754,-779,-792,-799,-818,-825,-839,-859,-851,-867,-869,-871,-876,-877,-879,
+-874,-869,-862,-854,-848,-843,-825,-828,-800,-786,-773,-744,-736,-722,-708,-688,
+-676,-652,-628,-615,-590,-588,-558,-549,-525,-512,-488,-476,-462,-447,-435,-423,
+-408,-395,-378,-375,-363,-355,-349,-343,-320,-309,-314,-302,-285,-271,-265,-247,
+-243,-235,-227,-215,-213,-196,-182,-177,-173,-155,-133,-121,-103,-98,-76,-68,
+-50,-38,-9,2,8,29,49,68,76,93,101,121,140,151,158,170,
+211,212,226,226,232,241,257,239,255,267,265,257,252,264,257,260,
+252,253,242,234,219,223,214,218,212,210,209,201,209,193,195,190,
+183,198,200,188,208,214,218,228,232,228,238,242,251,249,261,256,
+275,279,286,276,279,291,289,301,306,301,299,294,298,308,308,305,
+300,292,281,291,273,273,274,273,261,249,257,275,260,267,250,261,
+257,248,253,260,264,253,263,245,251,250,253,264,259,264,265,271,
+268,270,267,258,248,248,239,230,219,208,207,181,172,154,134,121,
+110,97,89,78,69,52,43,45,33,18,12,20,10,5,8,22,
+23,30,36,38,50,58,69,77,94,96,118,134,143,156,162,155,
+186,203,217,214,229,237,241,239,249,256,246,240,238,237,231,211,
+197,194,185,170,148,134,112,109,88,62,51,23,-20,-31,-39,-64,
+-79,-109,-118,-140,-157,-193,-204,-223,-224,-230,-244,-262,-277,-281,-298,-292,
+-302,-302,-309,-305,-306,-305,-314,-310,-311,-304,-313,-300,-294,-285,-276,-262,
+-255,-235,-234,-230,-221,-223,-201,-187,-170,-155,-161,-144,-134,-130,-134,-130,
+-127,-122,-108,-105,-95,-102,-112,-113,-119,-109,-124,-128,-138,-149,-158,-173,
+-178,-183,-197,-223,-246,-256,-277,-287,-305,-322,-330,-347,-365,-392,-395,-404,
+-429,-447,-456,-469,-491,-499,-513,-522,-530,-546,-558,-569,-562,-575,-586,-592,
+-595,-589,-596,-604,-595,-594,-582,-574,-562,-559,-544,-532,-521,-502,-484,-475,
+-457,-428,-395,-365,-334,-309,-271,-233,-195,-155,-122,-84,-50,-7,38,81,
+114,146,193,234,268,295,325,366,382,414,444,492,510,525,539,567,
+581,597,614,638,633,636,648,654,671,689,700,701,698,712,713,720,
+731,733,746,750,763,766,777,789,788,798,798,809,833,840,862,860,
+877,890,901,920,926,933,948,954,970,965,967,967,973,968,968,975,
+979,963,965,959,946,930,927,911,895,875,864,850,830,801,779,751,
+730,695,676,645,617,592,570,543,519,496,451,422,407,367,359,317,
+296,281,265,239,200,181,165,158,125,108,88,78,58,33,10,8,
+-8,-21,-45,-60,-83,-87,-106,-127,-155,-173,-181,-191,-207,-222,-246,-265,
+-269,-280,-293,-320,-337,-349,-362,-373,-392,-415,-419,-444,-459,-492,-505,-528,
+-537,-561,-579,-605,-630,-648,-677,-697,-715,-743,-772,-789,-816,-828,-842,-864,
+-875,-896,-910,-922,-921,-939,-954,-969,-968,-968,-974,-981,-982,-997,-995,-986,
+-981,-980,-975,-977,-980,-969,-963,-953,-949,-925,-927,-922,-913,-900,-887,-874,
+-862,-853,-841,-826,-810,-789,-762,-740,-733,-715,-697,-659,-640,-618,-593,-571,
+-538,-517,-475,-455,-426,-403,-367,-343,-318,-284,-239,-204,-196,-174,-157,-132,
+-114,-93,-72,-58,-34,-30,-8,12,23,38,46,55,62,80,94,93,
+98,108,129,124,136,141,147,167,181,197,210,218,238,261,282,311,
+334,349,377,393,422,452,468,487,513,532,550,568,589,610,622,624,
+655,672,693,694,707,710,714,713,720,731,729,713,715,712,712,701,
+683,678,648,637,634,629,621,603,576,575,550,542,522,507,477,448,
+456,441,425,405,401,384,378,369,359,339,327,306,301,294,275,262,
+238,231,222,212,205,196,177,169,157,140,120,96,79,78,62,48,
+32,29,26,13,-3,1,-7,-19,-29,-26,-17,-15,-16,-20,-14,-10,
+3,12,23,33,41,46,60,79,102,116,128,138,160,164,193,211,
+218,239,265,280,280,300,311,322,336,338,322,324,324,324,331,326,
+318,302,292,299,283,275,254,248,229,213,192,169,153,137,107,70,
+48,31,13,-17,-37,-66,-95,-129,-154,-164,-198,-226,-254,-284,-312,-342,
+-366,-390,-403,-437,-466,-475,-493,-520,-541,-545,-564,-572,-585,-593,-606,-612,
+-627,-636,-647,-658,-659,-652,-659,-667,-663,-671,-672,-666,-678,-683,-679,-685,
+-691,-695,-711,-704,-717,-722,-745,-754,-773,-774,-779,-797,-805,-815,-811,-823,
+-842,-865,-869,-876,-882,-889,-903,-923,-923,-917,-917,-928,-930,-940,-938,-926,
+-935,-931,-937,-936,-933,-921,-929,-912,-887,-880,-870,-869,-844,-838,-835,-808,
+-774,-751,-728,-704,-697,-678,-640,-616,-573,-556,-518,-485,-444,-411,-369,-331,
+-280,-240,-209,-156,-124,-72,-23,24,74,109,157,214,257,308,349,391,
+449,486,514,571,600,644,687,721,758,800,825,852,889,916,943,966,
+986,1013,1026,1052,1056,1078,1092,1117,1125,1137,1135,1152,1157,1165,1155,1161,
+1161,1174,1175,1165,1157,1163,1155,1148,1136,1124,1116,1103,1105,1099,1089,1087,
+1072,1057,1028,1008,1001,974,967,942,911,890,870,837,809,787,767,730,
+706,679,644,609,580,560,517,470,433,405,376,336,309,274,239,209,
+180,152,124,113,90,67,40,35,18,-2,-22,-40,-41,-66,-75,-80,
+-80,-96,-96,-100,-102,-103,-90,-92,-88,-100,-101,-105,-79,-78,-60,-54,
+-44,-27,-14,7,26,46,65,88,102,116,135,162,178,188,193,208,
+226,239,251,257,275,283,283,293,303,308,296,283,280,266,258,252,
+257,250,224,205,193,191,177,162,146,127,112,82,68,54,45,19,
+13,-1,-24,-45,-50,-63,-79,-105,-128,-136,-146,-141,-159,-177,-192,-207,
+-218,-230,-237,-262,-275,-294,-314,-322,-344,-354,-381,-389,-404,-433,-449,-474,
+-489,-491,-519,-535,-561,-583,-596,-620,-631,-638,-664,-673,-699,-704,-719,-734,
+-747,-754,-759,-773,-790,-803,-809,-823,-828,-825,-833,-826,-833,-839,-851,-848,
+-854,-854,-853,-852,-856,-863,-859,-857,-860,-851,-856,-853,-850,-844,-839,-844,
+-832,-832,-823,-823,-814,-803,-793,-779,-760,-739,-728,-703,-691,-686,-672,-649,
+-614,-595,-564,-531,-513,-470,-435,-390,-360,-326,-282,-232,-194,-156,-111,-77,
+-37,11,53,101,144,178,231,274,314,351,401,453,488,522,553,595,
+644,663,710,740,772,796,828,854,895,919,952,983,1001,1037,1052,1065,
+1083,1099,1123,1140,1144,1152,1157,1152,1172,1154,1153,1151,1145,1147,1148,1124,
+1112,1082,1067,1056,1037,1023,996,970,948,917,899,869,835,809,771,742,
+701,673,652,622,586,540,508,483,459,421,391,363,330,292,258,243,
+211,177,148,127,113,87,56,46,24,5,-3,-19,-34,-44,-68,-84,
+-96,-113,-120,-133,-131,-141,-151,-153,-160,-164,-159,-163,-162,-184,-185,-193,
+-204,-210,-217,-225,-227,-239,-257,-250,-282,-284,-301,-302,-327,-341,-358,-373,
+-372,-394,-415,-431,-443,-454,-465,-486,-490,-499,-525,-526,-534,-527,-524,-528,
+-532,-546,-533,-528,-526,-522,-512,-498,-487,-478,-467,-464,-450,-418,-398,-382,
+-374,-356,-341,-315,-306,-282,-281,-244,-236,-225,-212,-198,-177,-161,-152,-135,
+-126,-120,-106,-82,-69,-66,-58,-51,-41,-35,-20,-15,5,9,20,16,
+21,32,45,44,51,57,71,82,74,85,88,99,101,98,96,117,
+103,102,97,107,113,109,101,103,106,92,90,81,83,73,73,64,
+44,41,38,36,20,13,-13,-17,-25,-35,-58,-71,-66,-76,-90,-110,
+-117,-124,-129,-136,-144,-143,-167,-170,-185,-199,-192,-212,-225,-242,-248,-243,
+-259,-265,-284,-289,-296,-319,-336,-356,-359,-374,-381,-400,-405,-422,-421,-431,
+-438,-451,-452,-469,-475,-477,-465,-455,-457,-453,-451,-446,-447,-432,-424,-416,
+-400,-381,-361,-345,-319,-304,-290,-252,-227,-209,-196,-155,-132,-110,-82,-65,
+-28,-17,15,36,61,91,105,135,150,169,210,220,236,267,289,299,
+315,335,355,370,373,379,400,416,429,445,451,461,469,478,482,497,
+503,495,506,500,510,501,494,495,489,499,494,491,480,483,476,474,
+461,464,455,461,443,444,435,433,422,423,408,407,411,408,414,406,
+398,417,415,415,420,403,399,389,395,392,382,371,367,363,354,343,
+342,335,318,291,275,271,246,231,215,200,173,149,128,110,95,74,
+42,28,-1,-29,-43,-72,-84,-97,-118,-143,-161,-180,-213,-216,-244,-255,
+-270,-276,-294,-313,-335,-347,-364,-366,-384,-381,-387,-397,-401,-410,-420,-426,
+-424,-424,-436,-437,-445,-434,-434,-441,-439,-433,-428,-416,-423,-420,-402,-398,
+-390,-373,-366,-357,-345,-340,-320,-310,-287,-276,-258,-237,-223,-197,-172,-149,
+-133,-112,-85,-79,-56,-39,-16,8,30,42,57,88,106,123,143,166,
+174,182,183,193,221,221,229,234,242,244,243,233,248,242,257,241,
+238,230,230,232,217,208,205,193,181,176,168,160,152,149,134,114,
+109,108,92,92,71,67,56,46,28,17,0,-13,-27,-49,-56,-73,
+-92,-121,-126,-145,-154,-181,-205,-220,-241,-255,-285,-297,-314,-323,-340,-355,
+-379,-392,-405,-411,-424,-437,-454,-456,-469,-477,-481,-488,-500,-498,-513,-528,
+-534,-536,-539,-542,-549,-571,-566,-564,-567,-572,-570,-557,-563,-546,-543,-518,
+-522,-516,-511,-496,-475,-465,-450,-442,-415,-385,-373,-347,-321,-301,-282,-252,
+-227,-202,-173,-135,-117,-91,-63,-24,3,20,48,71,104,148,168,196,
+233,257,291,310,345,364,389,422,457,471,491,521,549,580,596,623,
+654,673,702,730,754,767,783,806,828,840,861,880,897,909,921,928,
+936,955,969,975,974,979,987,987,1002,997,1000,994,996,972,972,966,
+962,951,939,928,910,894,889,879,850,835,812,803,795,772,761,736,
+710,699,678,647,615,602,589,571,551,532,499,470,450,421,404,374,
+353,321,289,261,240,218,170,152,115,93,55,39,-5,-39,-73,-108,
+-138,-174,-205,-234,-267,-304,-326,-358,-393,-414,-443,-473,-505,-523,-554,-566,
+-595,-616,-627,-646,-664,-669,-672,-679,-691,-700,-706,-706,-697,-708,-697,-694,
+-693,-677,-693,-670,-681,-662,-654,-654,-649,-641,-627,-603,-598,-606,-586,-585,
+-561,-559,-541,-529,-508,-504,-485,-476,-455,-441,-419,-409,-381,-363,-347,-338,
+-332,-325,-310,-297,-284,-271,-258,-242,-244,-230,-231,-212,-212,-207,-210,-216,
+-209,-206,-207,-199,-205,-209,-217,-217,-218,-227,-230,-236,-243,-247,-239,-245,
+-261,-258,-263,-254,-260,-268,-286,-290,-272,-276,-270,-265,-271,-270,-256,-250,
+-239,-231,-229,-231,-214,-200,-190,-181,-159,-143,-139,-130,-127,-99,-92,-65,
+-60,-53,-35,-22,-3,10,28,44,61,74,88,89,105,115,121,136,
+144,162,174,170,187,180,199,184,193,197,204,197,194,196,203,194,
+191,187,193,184,175,177,170,165,167,165,164,163,162,168,161,161,
+163,161,170,174,175,196,199,209,218,228,229,249,260,275,282,297,
+311,334,345,358,380,407,411,432,439,463,479,490,510,532,533,541,
+550,550,565,568,575,578,575,578,577,574,572,565,564,558,550,552,
+549,549,529,522,514,489,484,469,475,451,450,434,427,414,409,400,
+406,390,379,359,364,355,346,339,337,322,315,297,288,274,264,252,
+225,223,210,207,181,172,166,139,125,101,94,91,68,48,40,29,
+12,-2,-8,-26,-34,-50,-67,-71,-79,-90,-104,-112,-115,-123,-135,-138,
+-146,-158,-165,-175,-179,-198,-200,-202,-202,-219,-229,-245,-240,-249,-249,-268,
+-264,-278,-285,-285,-299,-298,-318,-305,-315,-329,-331,-325,-326,-334,-352,-354,
+-343,-325,-342,-351,-350,-355,-342,-353,-352,-360,-376,-377,-377,-371,-382,-398,
+-404,-415,-408,-416,-428,-431,-428,-424,-438,-451,-460,-459,-460,-466,-468,-478,
+-487,-486,-497,-501,-507,-511,-517,-525,-535,-529,-541,-537,-540,-550,-555,-556,
+-557,-553,-579,-578,-580,-586,-589,-587,-603,-604,-624,-624,-612,-616,-633,-626,
+-626,-619,-622,-627,-609,-609,-588,-586,-592,-575,-560,-550,-541,-526,-515,-493,
+-464,-474,-452,-439,-418,-390,-377,-353,-347,-315,-295,-267,-255,-239,-220,-203,
+-190,-164,-148,-128,-120,-100,-85,-67,-56,-35,-31,-9,0,16,26,32,
+49,58,64,81,93,100,108,126,127,150,149,174,183,192,181,196,
+205,205,223,234,241,235,242,254,268,265,267,275,285,295,293,292,
+308,299,317,320,327,326,328,335,343,330,346,336,336,343,334,343,
+342,354,355,357,348,353,364,370,376,386,392,403,408,429,445,454,
+461,481,505,528,538,565,596,619,629,637,671,681,711,727,747,766,
+766,778,796,807,814,812,827,838,838,834,842,840,836,831,816,804,
+788,785,775,771,748,737,712,691,671,656,626,610,584,564,542,519,
+483,462,435,412,379,361,336,305,280,247,224,198,183,156,141,115,
+95,60,48,38,18,4,-20,-43,-51,-59,-74,-85,-91,-93,-116,-119,
+-121,-119,-129,-151,-151,-148,-163,-167,-175,-172,-174,-176,-199,-205,-212,-221,
+-225,-243,-258,-278,-289,-295,-318,-332,-353,-385,-397,-417,-435,-462,-485,-506,
+-526,-538,-574,-591,-611,-634,-644,-671,-678,-699,-701,-721,-735,-759,-769,-763,
+-773,-785,-788,-798,-806,-802,-802,-801,-794,-790,-771,-766,-769,-756,-754,-740,
+-728,-712,-700,-672,-638,-609,-598,-578,-556,-521,-500,-469,-441,-406,-373,-333,
+-317,-286,-235,-197,-164,-128,-90,-69,-29,-11,29,60,109,140,173,199,
+238,250,266,289,310,339,360,378,384,392,415,427,432,426,427,443,
+433,440,427,423,423,423,401,395,398,388,382,369,352,328,327,315,
+304,294,298,295,276,274,270,265,264,271,294,289,283,285,283,291,
+293,291,306,304,316,308,317,313,317,326,319,335,329,321,329,332,
+322,325,319,319,320,315,306,298,299,298,287,281,272,271,258,246,
+248,235,246,243,224,227,222,226,225,225,220,217,227,227,227,224,
+229,225,236,230,225,220,231,231,231,225,231,229,235,234,234,231,
+214,207,208,213,206,212,200,204,194,198,195,192,186,171,173,161,
+159,159,150,138,126,125,113,100,86,78,52,37,42,15,4,-9,
+-20,-39,-51,-72,-84,-107,-124,-137,-164,-164,-187,-209,-215,-222,-242,-253,
+-269,-272,-288,-295,-308,-317,-316,-330,-341,-346,-360,-365,-363,-370,-381,-371,
+-375,-385,-380,-391,-395,-389,-381,-387,-398,-377,-381,-385,-400,-394,-394,-402,
+-401,-405,-411,-408,-406,-408,-407,-401,-408,-388,-392,-395,-393,-386,-377,-373,
+-382,-382,-371,-367,-371,-373,-354,-349,-343,-341,-333,-330,-331,-320,-320,-309,
+-308,-309,-293,-294,-299,-302,-293,-289,-282,-281,-281,-272,-258,-259,-255,-240,
+-247,-244,-245,-238,-238,-240,-229,-215,-224,-207,-191,-183,-168,-144,-142,-127,
+-123,-88,-89,-65,-51,-36,-18,4,14,17,25,36,48,60,77,97,
+107,118,117,121,133,151,155,149,144,141,138,144,143,150,141,133,
+130,134,122,108,100,102,94,90,86,81,67,65,61,62,49,39,
+38,26,20,21,12,11,-7,-13,-11,-24,-36,-42,-51,-63,-76,-78,
+-97,-110,-126,-129,-140,-151,-165,-173,-177,-184,-196,-196,-205,-195,-208,-216,
+-213,-206,-205,-208,-212,-202,-194,-186,-174,-164,-153,-127,-96,-84,-71,-44,
+-29,-2,24,42,70,95,126,144,173,202,228,261,284,306,327,353,
+376,389,410,438,447,462,477,484,501,517,520,522,538,542,540,547,
+550,551,549,543,547,560,553,549,545,538,538,528,522,519,509,495,
+495,482,483,470,462,449,464,435,417,405,402,398,379,375,363,354,
+348,334,328,317,302,312,299,297,279,279,258,265,253,242,234,233,
+228,224,206,202,183,184,170,169,157,157,148,142,129,121,112,90,
+73,61,47,29,20,0,-18,-37,-47,-53,-79,-95,-115,-138,-149,-175,
+-193,-217,-226,-242,-256,-273,-288,-305,-322,-328,-339,-352,-363,-376,-372,-387,
+-392,-400,-398,-409,-415,-404,-401,-396,-409,-402,-398,-392,-393,-393,-377,-366,
+-348,-348,-338,-320,-315,-303,-293,-275,-261,-250,-239,-219,-201,-188,-179,-165,
+-152,-140,-113,-93,-80,-68,-61,-39,-32,-15,5,16,33,31,32,43,
+43,52,56,59,61,50,55,62,58,53,47,48,41,39,33,20,
+17,12,3,-9,-10,-15,-16,-18,-19,-21,-30,-20,-16,-16,-21,-28,
+-28,-21,-17,-13,-14,-20,-10,-6,-16,-12,-4,-3,-5,3,1,15,
+4,-4,-17,-5,-16,-19,-38,-39,-56,-54,-61,-69,-75,-87,-95,-108,
+-115,-113,-139,-150,-163,-172,-186,-186,-194,-214,-218,-236,-242,-243,-265,-277,
+-276,-283,-301,-312,-316,-314,-308,-321,-324,-337,-335,-339,-332,-338,-334,-336,
+-339,-338,-333,-338,-334,-334,-317,-304,-299,-300,-286,-267,-252,-250,-226,-219,
+-198,-190,-181,-156,-122,-107,-92,-58,-47,-6,12,26,56,82,116,138,
+165,188,209,239,252,286,306,332,353,372,401,427,456,468,488,502,
+531,536,545,569,574,588,595,599,600,616,618,638,637,648,644,653,
+655,653,660,653,660,652,663,651,657,653,646,648,659,643,628,628,
+640,632,635,622,621,612,611,597,583,579,565,554,552,551,543,525,
+519,501,490,475,461,450,439,411,401,389,384,364,341,333,323,303,
+282,267,242,229,209,200,177,153,142,134,109,90,58,33,5,-22,
+-52,-77,-105,-114,-145,-171,-199,-234,-265,-277,-314,-341,-371,-399,-423,-459,
+-473,-496,-523,-560,-577,-585,-610,-637,-659,-673,-692,-696,-713,-725,-728,-752,
+-759,-767,-771,-785,-798,-797,-798,-793,-795,-809,-812,-808,-795,-804,-809,-801,
+-798,-792,-789,-775,-771,-779,-771,-766,-755,-749,-736,-727,-714,-702,-696,-694,
+-676,-662,-651,-636,-615,-596,-586,-560,-541,-531,-504,-479,-454,-443,-421,-395,
+-367,-352,-329,-306,-281,-257,-234,-196,-178,-161,-141,-117,-89,-73,-55,-30,
+-9,17,51,81,92,112,138,163,195,217,235,254,267,285,301,312,
+344,344,365,371,392,402,414,424,419,426,436,437,449,445,448,442,
+441,436,444,443,432,426,422,418,404,403,390,389,388,383,373,368,
+353,342,341,319,304,296,283,273,257,247,232,227,214,187,180,161,
+153,131,118,93,76,66,45,35,16,4,-13,-23,-44,-57,-73,-84,
+-93,-105,-117,-135,-152,-157,-176,-185,-194,-196,-210,-211,-212,-215,-224,-215,
+-211,-207,-193,-184,-177,-170,-173,-161,-158,-144,-132,-115,-94,-86,-81,-68,
+-59,-39,-27,-5,7,26,42,59,69,88,106,122,126,129,156,168,
+177,197,222,226,242,249,267,292,306,318,335,356,383,399,415,430,
+453,470,496,510,534,551,576,597,629,638,661,678,708,716,734,754,
+787,789,798,812,834,830,835,842,852,853,860,853,850,842,834,823,
+815,803,775,753,747,727,703,683,662,632,619,600,569,543,524,499,
+477,439,420,375,352,305,282,253,217,180,152,111,68,29,-6,-53,
+-95,-128,-164,-204,-247,-289,-334,-369,-414,-463,-500,-542,-591,-618,-663,-690,
+-734,-764,-800,-846,-869,-896,-916,-943,-969,-982,-1008,-1026,-1053,-1063,-1069,-1082,
+-1083,-1097,-1103,-1110,-1111,-1112,-1096,-1091,-1101,-1088,-1090,-1077,-1066,-1056,-1045,-1034,
+-1027,-1008,-1005,-980,-972,-957,-945,-929,-917,-899,-887,-872,-855,-841,-823,-806,
+-802,-782,-774,-753,-732,-718,-691,-669,-649,-632,-613,-598,-562,-534,-510,-485,
+-468,-441,-406,-381,-348,-326,-293,-273,-218,-193,-163,-128,-96,-63,-29,16,
+44,89,129,169,195,227,269,306,355,393,421,454,496,531,566,595,
+638,666,705,724,758,778,798,830,864,882,898,910,921,927,950,962,
+973,975,971,969,974,977,974,959,962,950,948,926,913,900,877,866,
+839,821,805,794,772,739,709,683,659,643,626,599,573,539,512,485,
+468,442,427,402,376,355,330,300,285,263,241,210,192,170,158,126,
+118,89,66,48,41,29,11,-2,-24,-43,-51,-60,-64,-80,-88,-96,
+-107,-105,-102,-106,-117,-112,-116,-121,-128,-117,-119,-110,-106,-110,-101,-107,
+-96,-99,-93,-99,-95,-87,-86,-77,-88,-81,-85,-85,-84,-81,-74,-77,
+-80,-88,-82,-83,-86,-93,-94,-104,-101,-96,-104,-105,-97,-102,-113,-108,
+-120,-118,-124,-116,-111,-126,-116,-124,-113,-113,-116,-124,-125,-106,-124,-128,
+-117,-116,-120,-122,-120,-124,-121,-124,-136,-136,-142,-145,-144,-154,-154,-162,
+-168,-181,-188,-191,-188,-198,-205,-222,-231,-219,-227,-232,-239,-240,-239,-242,
+-255,-266,-256,-255,-259,-263,-271,-278,-277,-264,-278,-299,-280,-282,-292,-303,
+-298,-309,-317,-317,-323,-332,-335,-333,-337,-343,-355,-354,-368,-365,-356,-364,
+-365,-382,-384,-393,-393,-390,-412,-409,-413,-404,-415,-414,-430,-420,-429,-427,
+-427,-419,-430,-431,-426,-433,-430,-425,-418,-404,-413,-410,-421,-409,-401,-392,
+-380,-381,-376,-376,-366,-355,-350,-343,-321,-325,-302,-290,-265,-259,-234,-208,
+-194,-184,-173,-145,-123,-101,-75,-65,-37,-19,14,41,63,91,102,125,
+137,167,196,216,243,261,289,304,322,350,364,386,407,426,441,451,
+465,477,492,510,522,536,555,559,578,593,598,615,631,637,636,660,
+670,684,682,704,701,716,724,745,742,754,748,764,761,764,768,774,
+768,769,764,759,752,762,740,741,722,699,678,682,681,664,639,629,
+608,587,575,557,538,519,503,478,460,433,407,387,367,342,324,307,
+290,278,265,244,230,209,185,172,148,134,135,113,114,102,81,66,
+72,69,56,45,45,43,37,35,34,38,28,27,10,17,3,1,
+3,9,-2,-4,1,0,-8,-16,-18,-22,-40,-40,-50,-56,-70,-74,
+-86,-95,-113,-121,-130,-143,-148,-163,-172,-188,-214,-227,-243,-256,-269,-297,
+-317,-320,-348,-363,-375,-379,-405,-414,-435,-445,-452,-461,-475,-487,-488,-501,
+-507,-521,-521,-518,-523,-531,-520,-517,-510,-511,-521,-510,-492,-478,-465,-456,
+-453,-440,-434,-420,-411,-392,-379,-373,-342,-323,-300,-291,-279,-261,-236,-224,
+-208,-189,-178,-168,-157,-137,-114,-114,-108,-106,-99,-84,-63,-50,-53,-36,
+-42,-33,-26,-29,-12,-17,-8,-13,-15,-13,-22,-30,-25,-33,-39,-47,
+-49,-49,-66,-65,-77,-73,-87,-95,-98,-100,-102,-110,-112,-125,-114,-136,
+-134,-133,-123,-127,-105,-114,-99,-113,-91,-89,-87,-76,-70,-62,-65,-65,
+-51,-45,-45,-37,-22,-29,-28,-20,-21,-19,-22,-2,-9,-9,-14,-16,
+-5,-10,-16,-28,-24,-30,-35,-35,-36,-28,-32,-31,-37,-27,-28,-16,
+-14,-12,-23,-12,-6,-1,12,13,26,25,38,42,64,60,74,87,
+93,108,122,141,139,156,158,165,172,192,183,187,198,204,202,216,
+206,207,228,222,217,208,209,211,204,215,213,196,195,192,191,192,
+195,186,171,166,165,159,158,156,148,140,140,137,139,135,137,124,
+111,99,109,113,100,103,95,102,94,87,90,83,73,62,71,73,
+70,68,62,69,70,73,68,69,67,77,76,76,70,69,65,71,
+59,75,61,62,53,53,55,60,52,49,54,43,33,38,25,33,
+22,16,11,6,-1,-19,-32,-37,-51,-49,-60,-62,-83,-92,-104,-115,
+-118,-132,-133,-153,-161,-168,-169,-175,-190,-207,-206,-214,-213,-225,-221,-232,
+-243,-244,-245,-250,-253,-254,-251,-255,-257,-268,-268,-256,-254,-259,-253,-244,
+-247,-243,-230,-224,-219,-206,-191,-180,-179,-162,-148,-141,-127,-106,-83,-77,
+-65,-51,-32,-17,0,7,34,38,55,68,88,107,114,122,131,138,
+152,155,160,165,170,182,185,189,181,185,188,200,197,200,186,185,
+181,193,177,163,170,165,164,161,151,151,146,148,132,131,127,120,
+120,106,119,107,111,105,98,103,97,93,87,77,81,75,66,60,
+53,51,45,43,28,14,2,-14,-15,-19,-28,-32,-35,-41,-43,-39,
+-40,-40,-41,-42,-41,-36,-41,-26,-22,-12,-3,6,19,23,23,39,
+66,94,105,114,126,142,151,167,182,193,195,211,234,243,255,253,
+260,250,252,268,281,264,262,258,257,247,243,240,225,208,196,189,
+179,163,155,138,140,123,115,105,88,75,64,55,47,33,26,23,
+11,0,-19,-27,-32,-30,-48,-50,-52,-61,-62,-74,-76,-77,-88,-90,
+-88,-89,-99,-102,-98,-98,-97,-106,-105,-96,-94,-101,-97,-97,-94,-96,
+-97,-88,-93,-91,-84,-93,-76,-77,-78,-75,-75,-61,-72,-68,-68,-66,
+-63,-59,-63,-57,-54,-53,-54,-48,-60,-57,-49,-59,-56,-52,-63,-57,
+-53,-51,-47,-52,-55,-51,-52,-43,-44,-48,-51,-26,-23,-13,-20,-2,
+-4,14,12,16,29,47,53,69,64,79,83,111,113,111,116,124,
+148,154,174,185,191,200,207,228,228,237,251,247,256,260,274,281,
+282,279,289,291,288,291,286,298,311,295,292,286,286,288,274,268,
+267,252,236,227,212,198,178,172,158,154,122,99,93,67,55,36,
+19,2,-17,-29,-46,-71,-88,-105,-109,-123,-142,-150,-166,-185,-187,-191,
+-197,-214,-215,-225,-223,-234,-242,-250,-263,-254,-267,-274,-274,-272,-265,-266,
+-269,-278,-287,-283,-294,-295,-306,-312,-313,-324,-339,-354,-353,-358,-364,-383,
+-397,-410,-417,-418,-432,-451,-447,-466,-478,-480,-483,-502,-501,-507,-498,-516,
+-519,-514,-508,-510,-517,-501,-491,-485,-485,-469,-462,-441,-430,-408,-407,-386,
+-375,-362,-334,-321,-305,-294,-270,-247,-217,-203,-184,-175,-151,-126,-116,-95,
+-89,-68,-55,-39,-14,9,8,19,36,54,56,70,73,92,96,109,
+112,117,137,139,148,151,167,170,167,168,164,162,159,172,180,171,
+165,151,162,154,166,160,152,133,124,124,114,108,107,93,85,81,
+67,63,63,63,65,58,48,51,42,51,47,56,50,46,42,42,
+45,57,56,64,68,71,82,86,93,96,98,108,114,117,123,140,
+146,148,153,174,169,179,191,201,217,227,227,244,248,245,255,271,
+284,280,288,295,309,316,321,320,333,332,345,339,350,356,368,364,
+359,356,348,343,349,345,343,348,335,334,333,331,328,320,317,307,
+305,305,304,299,293,293,293,298,293,291,284,286,295,289,292,298,
+303,296,293,301,297,297,298,297,290,296,299,288,284,269,265,251,
+242,241,221,232,224,197,186,175,139,131,109,91,85,60,43,22,
+3,-12,-40,-41,-62,-92,-113,-126,-143,-167,-185,-202,-218,-231,-233,-257,
+-263,-278,-296,-317,-329,-340,-352,-369,-375,-385,-392,-409,-432,-448,-463,-474,
+-481,-492,-505,-523,-530,-550,-559,-574,-592,-600,-610,-619,-639,-642,-649,-661,
+-673,-669,-674,-675,-692,-684,-695,-676,-686,-684,-685,-682,-677,-666,-659,-647,
+-642,-630,-622,-603,-599,-578,-581,-567,-539,-532,-524,-518,-500,-483,-468,-446,
+-428,-409,-408,-396,-372,-347,-340,-319,-298,-289,-270,-257,-237,-222,-200,-188,
+-176,-155,-143,-120,-100,-75,-54,-42,-25,-2,12,34,56,78,104,123,
+156,167,194,215,238,259,296,314,336,362,396,414,443,460,492,509,
+539,554,570,588,612,636,662,668,683,688,705,719,723,732,737,734,
+751,743,744,738,743,743,735,718,716,695,692,682,669,663,644,623,
+604,602,592,568,548,543,524,503,491,482,465,443,430,421,393,385,
+375,356,338,316,320,318,303,283,275,265,269,256,238,226,220,211,
+201,198,182,176,164,168,154,136,143,129,114,107,98,95,88,82,
+70,63,50,45,39,46,31,27,10,15,13,16,11,4,-2,-8,
+-7,-27,-20,-15,-23,-21,-22,-27,-23,-36,-24,-46,-46,-54,-60,-54,
+-62,-64,-74,-68,-81,-96,-96,-102,-111,-103,-114,-114,-114,-118,-131,-137,
+-129,-124,-130,-126,-127,-114,-122,-116,-96,-93,-84,-81,-68,-62,-42,-29,
+-11,-8,7,21,35,35,59,69,86,94,116,120,139,139,152,158,
+160,173,173,179,180,176,166,159,171,155,143,131,125,120,106,91,
+74,56,34,15,-3,-22,-20,-48,-64,-96,-114,-138,-154,-176,-190,-209,
+-224,-238,-255,-271,-290,-305,-316,-327,-339,-363,-375,-389,-392,-393,-405,-418,
+-420,-436,-447,-452,-449,-454,-461,-459,-466,-469,-474,-470,-481,-480,-489,-490,
+-486,-485,-480,-477,-480,-474,-488,-492,-488,-490,-493,-497,-494,-492,-511,-495,
+-493,-494,-498,-503,-499,-496,-499,-496,-498,-504,-493,-502,-500,-495,-496,-493,
+-485,-484,-470,-470,-464,-457,-457,-440,-429,-411,-406,-393,-389,-370,-349,-326,
+-312,-302,-287,-266,-254,-240,-217,-204,-173,-153,-124,-106,-80,-56,-33,-4,
+30,54,77,104,124,144,178,207,234,249,281,301,339,372,402,417,
+437,471,484,518,552,583,595,618,645,671,687,706,722,739,749,772,
+782,795,811,823,821,822,832,840,850,841,843,825,821,816,815,797,
+782,765,755,740,721,707,687,658,649,611,586,567,534,522,484,460,
+432,409,373,349,325,306,285,265,234,215,186,158,133,106,82,61,
+45,34,3,-19,-28,-58,-67,-90,-107,-148,-163,-186,-206,-225,-242,-262,
+-281,-297,-318,-340,-356,-372,-387,-411,-425,-432,-439,-453,-466,-481,-493,-494,
+-492,-495,-506,-504,-503,-508,-508,-523,-523,-518,-495,-495,-488,-492,-483,-473,
+-462,-465,-452,-448,-437,-421,-414,-403,-399,-380,-369,-354,-336,-321,-310,-306,
+-286,-276,-268,-251,-240,-216,-210,-200,-188,-178,-163,-141,-141,-123,-122,-107,
+-96,-72,-67,-59,-41,-48,-23,-18,10,16,24,33,43,55,65,83,
+95,101,111,120,128,137,146,155,158,167,185,191,195,195,192,192,
+194,190,189,189,189,179,179,177,167,156,142,133,130,119,107,92,
+74,53,36,21,-1,-20,-34,-53,-65,-90,-114,-130,-146,-159,-171,-192,
+-218,-226,-233,-249,-244,-268,-279,-287,-287,-293,-291,-287,-299,-299,-290,-294,
+-290,-284,-275,-272,-271,-263,-259,-236,-226,-227,-215,-210,-191,-183,-170,-172,
+-151,-148,-133,-113,-119,-112,-94,-85,-76,-67,-64,-55,-36,-30,-20,-5,
+8,15,22,43,57,68,89,99,112,125,141,170,190,206,225,244,
+284,310,327,353,385,407,430,460,493,528,555,583,602,637,654,695,
+693,717,729,750,760,785,799,808,817,830,828,831,834,834,839,839,
+833,827,823,803,798,795,776,764,740,737,722,717,693,678,645,631,
+599,585,559,538,513,492,463,434,397,378,344,313,270,237,211,163,
+137,92,61,22,-20,-58,-93,-128,-169,-207,-234,-260,-298,-335,-367,-393,
+-428,-448,-474,-496,-527,-545,-575,-584,-605,-612,-621,-640,-644,-654,-663,-675,
+-666,-679,-667,-666,-663,-668,-668,-661,-657,-644,-639,-629,-631,-622,-614,-600,
+-596,-599,-589,-590,-574,-577,-553,-562,-554,-545,-545,-539,-538,-523,-524,-519,
+-515,-502,-506,-500,-497,-496,-492,-489,-470,-465,-461,-443,-439,-420,-407,-396,
+-383,-364,-360,-339,-321,-293,-283,-258,-230,-205,-183,-153,-129,-105,-77,-44,
+-12,3,39,68,96,127,147,172,201,225,244,271,285,310,337,361,
+390,395,412,435,447,459,474,485,491,504,517,524,541,535,546,556,
+557,555,551,558,565,562,558,549,550,550,541,543,529,519,514,518,
+517,512,507,500,493,478,475,460,460,446,434,420,404,384,375,361,
+348,328,308,291,273,252,236,225,195,180,165,142,113,99,73,52,
+22,15,-4,-30,-61,-90,-105,-114,-132,-157,-164,-189,-197,-209,-222,-233,
+-254,-270,-285,-297,-300,-310,-323,-330,-335,-332,-342,-349,-358,-355,-368,-371,
+-366,-368,-359,-367,-373,-374,-376,-365,-378,-378,-377,-372,-369,-379,-379,-367,
+-365,-352,-349,-353,-338,-333,-330,-327,-323,-313,-293,-277,-279,-263,-242,-232,
+-221,-203,-181,-159,-148,-124,-103,-95,-68,-53,-34,-16,5,34,50,68,
+77,89,117,135,159,170,193,201,212,221,242,251,262,271,283,304,
+316,320,330,328,334,343,337,351,360,373,374,366,374,384,398,386,
+384,393,399,384,388,387,396,399,400,395,387,391,392,386,387,382,
+380,376,376,353,350,348,335,330,320,301,300,284,284,267,260,240,
+237,213,198,188,180,163,150,118,100,85,76,67,34,12,-14,-13,
+-33,-43,-58,-83,-102,-120,-136,-149,-160,-182,-193,-213,-219,-240,-259,-257,
+-277,-287,-300,-304,-314,-331,-338,-346,-357,-358,-372,-388,-391,-389,-395,-395,
+-401,-404,-413,-422,-412,-422,-413,-417,-417,-425,-416,-414,-404,-410,-408,-405,
+-413,-408,-410,-397,-393,-381,-378,-370,-369,-361,-353,-341,-335,-329,-317,-311,
+-301,-287,-266,-238,-237,-222,-197,-183,-159,-138,-117,-104,-83,-59,-35,-5,
+11,31,48,70,102,123,142,156,174,197,213,229,243,245,255,277,
+274,286,288,286,288,283,288,289,287,275,272,256,244,234,224,215,
+201,180,170,149,130,115,107,77,69,53,39,27,11,-8,-24,-38,
+-46,-54,-68,-78,-95,-100,-125,-136,-141,-155,-159,-166,-174,-180,-204,-211,
+-213,-222,-231,-243,-248,-249,-252,-254,-266,-262,-267,-277,-282,-273,-276,-280,
+-279,-275,-278,-284,-297,-287,-283,-281,-271,-272,-275,-268,-267,-269,-268,-266,
+-258,-260,-258,-253,-259,-254,-248,-242,-235,-230,-223,-211,-202,-202,-191,-174,
+-159,-157,-149,-137,-128,-112,-110,-100,-89,-68,-56,-41,-22,-3,13,12,
+25,36,56,77,87,118,128,137,156,165,189,213,232,242,263,282,
+307,316,332,359,376,390,414,429,452,464,487,495,510,523,533,545,
+554,570,579,590,604,607,620,626,629,639,640,637,633,641,644,638,
+637,634,625,617,610,596,589,576,568,552,537,515,513,498,473,450,
+433,423,396,383,356,350,322,310,264,255,241,227,208,178,172,147,
+133,113,101,73,57,36,24,3,-18,-36,-54,-72,-104,-99,-133,-147,
+-165,-187,-197,-229,-240,-267,-286,-303,-318,-338,-355,-384,-407,-429,-440,-460,
+-471,-500,-505,-524,-538,-558,-574,-590,-598,-594,-607,-613,-621,-622,-638,-622,
+-625,-623,-628,-624,-615,-614,-597,-591,-578,-566,-555,-546,-543,-513,-498,-491,
+-476,-467,-446,-428,-415,-397,-390,-372,-346,-338,-316,-304,-291,-280,-265,-245,
+-236,-224,-203,-191,-183,-161,-157,-143,-119,-110,-101,-89,-70,-58,-46,-40,
+-18,-10,-2,5,21,38,53,67,77,87,105,108,124,133,153,154,
+149,164,170,185,182,194,193,206,208,215,211,212,220,217,225,226,
+227,226,222,219,229,225,229,227,219,222,229,220,216,219,217,218,
+220,215,227,219,216,206,204,206,206,208,210,212,210,207,197,197,
+196,188,195,195,185,176,178,165,163,155,158,146,153,137,135,134,
+120,116,116,103,92,86,76,74,68,64,50,39,43,35,21,14,
+2,3,6,2,-15,-22,-18,-16,-13,-24,-27,-26,-30,-33,-31,-23,
+-18,-14,-8,-13,0,4,12,19,21,30,37,48,51,61,73,88,
+93,104,110,129,134,142,152,159,168,192,191,209,211,211,225,236,
+241,236,238,256,251,256,259,257,261,267,265,263,274,266,265,271,
+268,272,268,262,264,263,260,262,257,260,257,263,257,269,262,263,
+269,266,264,262,270,271,265,260,260,260,256,239,232,231,225,224,
+209,203,201,180,175,158,143,144,125,107,107,91,85,68,55,51,
+43,35,26,22,15,5,-2,1,-2,1,-2,-13,-12,-20,-19,-28,
+-22,-19,-25,-24,-32,-19,-18,-21,-31,-28,-36,-37,-41,-49,-47,-51,
+-59,-79,-76,-98,-104,-122,-121,-144,-145,-160,-167,-182,-194,-206,-218,-230,
+-251,-268,-269,-285,-291,-308,-307,-315,-335,-341,-355,-357,-371,-369,-389,-384,
+-404,-411,-423,-429,-429,-442,-441,-451,-440,-449,-446,-451,-455,-455,-461,-468,
+-469,-465,-474,-468,-474,-467,-468,-474,-476,-472,-472,-474,-468,-466,-462,-465,
+-459,-471,-454,-451,-445,-439,-443,-435,-433,-424,-418,-403,-388,-379,-382,-377,
+-364,-345,-335,-320,-305,-299,-273,-258,-240,-235,-218,-188,-170,-154,-137,-114,
+-101,-82,-68,-51,-19,5,19,33,54,78,105,125,140,151,173,188,
+204,219,243,263,285,293,309,340,352,372,386,394,415,417,431,450,
+465,466,473,480,508,507,513,511,521,527,533,548,557,553,546,554,
+555,545,547,542,549,555,546,538,535,538,521,521,509,512,495,486,
+473,465,446,432,425,408,400,382,373,343,332,313,304,279,262,249,
+224,211,197,193,175,152,142,130,112,102,87,88,69,71,60,51,
+43,33,33,19,16,8,12,-5,-11,-16,-24,-28,-30,-43,-49,-60,
+-75,-91,-93,-112,-111,-132,-144,-165,-178,-188,-203,-224,-233,-249,-271,-288,
+-298,-316,-323,-347,-359,-367,-387,-397,-400,-405,-429,-443,-445,-452,-456,-455,
+-463,-468,-476,-466,-461,-464,-465,-462,-446,-451,-436,-428,-417,-419,-399,-398,
+-382,-384,-374,-375,-359,-353,-337,-325,-324,-316,-302,-293,-274,-275,-260,-268,
+-257,-243,-237,-230,-218,-212,-196,-195,-187,-191,-186,-180,-170,-165,-161,-155,
+-148,-142,-143,-138,-129,-125,-126,-127,-123,-117,-104,-115,-100,-98,-92,-87,
+-87,-78,-72,-76,-72,-60,-56,-52,-45,-46,-51,-48,-35,-26,-23,-22,
+-13,-18,-7,-8,-4,9,20,17,18,13,29,29,33,47,48,49,
+49,56,56,60,70,95,91,91,99,100,103,109,114,124,128,128,
+137,142,147,159,162,168,172,171,173,180,183,189,191,200,208,199,
+202,200,200,195,198,198,191,183,181,186,185,169,173,165,163,150,
+146,142,140,130,127,110,111,98,104,90,95,83,66,68,67,71,
+65,61,59,58,65,65,74,63,64,64,71,81,88,86,93,99,
+105,106,112,127,130,142,142,147,158,149,149,159,163,164,170,164,
+168,166,170,174,166,173,174,175,169,175,172,167,173,168,173,179,
+169,167,182,183,189,193,194,197,194,195,206,203,210,216,223,216,
+221,223,216,221,217,215,213,204,211,207,203,197,196,184,186,168,
+165,147,154,139,130,108,103,84,78,63,52,42,32,27,8,1,
+-10,-19,-30,-43,-59,-68,-73,-79,-96,-97,-104,-113,-130,-133,-130,-137,
+-144,-136,-146,-146,-165,-164,-169,-163,-160,-157,-163,-168,-162,-165,-166,-182,
+-180,-183,-186,-194,-190,-204,-199,-202,-207,-213,-213,-204,-210,-215,-221,-226,
+-222,-223,-218,-225,-218,-221,-211,-203,-198,-194,-188,-182,-186,-177,-171,-160,
+-144,-138,-120,-114,-79,-70,-57,-44,-24,-13,2,20,30,49,67,77,
+92,121,132,157,159,185,195,212,227,243,247,245,256,279,287,288,
+290,300,305,301,314,317,318,315,311,316,325,317,313,303,302,302,
+296,290,275,276,264,254,255,235,246,241,239,228,229,214,221,212,
+214,207,202,206,203,202,202,204,203,206,194,195,193,182,185,180,
+179,173,158,148,134,122,120,108,106,99,81,56,47,35,25,16,
+-3,-15,-42,-41,-69,-76,-112,-119,-131,-141,-151,-171,-177,-189,-207,-220,
+-228,-239,-250,-254,-278,-284,-312,-311,-311,-321,-335,-355,-365,-373,-375,-390,
+-395,-401,-404,-421,-417,-426,-431,-437,-440,-444,-445,-457,-456,-446,-452,-440,
+-442,-442,-441,-426,-413,-418,-399,-387,-366,-349,-336,-310,-306,-288,-268,-249,
+-232,-210,-185,-166,-139,-131,-99,-77,-49,-31,-17,10,28,54,76,101,
+111,127,133,155,170,188,199,203,224,239,252,257,256,262,272,282,
+278,288,279,281,288,295,291,298,298,292,300,304,304,305,312,313,
+312,311,315,319,318,329,331,328,323,326,338,340,333,348,333,338,
+335,337,333,332,327,314,307,313,288,285,273,262,262,253,240,222,
+212,191,172,173,149,119,110,89,78,64,38,16,2,-14,-31,-51,
+-59,-74,-103,-132,-140,-161,-176,-197,-212,-226,-235,-255,-262,-288,-297,-307,
+-303,-319,-334,-345,-356,-358,-355,-362,-375,-376,-376,-372,-379,-379,-386,-375,
+-382,-372,-382,-378,-371,-362,-365,-361,-351,-348,-352,-360,-351,-345,-341,-335,
+-335,-327,-321,-316,-326,-324,-318,-305,-299,-297,-290,-280,-277,-271,-264,-256,
+-253,-241,-223,-208,-194,-188,-182,-173,-162,-156,-140,-124,-103,-99,-79,-72,
+-63,-62,-40,-30,-19,-16,-2,11,18,30,35,40,47,55,62,60,
+65,77,70,81,75,81,95,89,87,88,89,89,97,90,100,100,
+106,102,105,102,107,111,114,108,103,101,107,105,107,102,93,94,
+96,85,78,75,73,59,51,44,26,22,16,6,-7,-13,-26,-36,
+-60,-73,-85,-78,-96,-114,-124,-137,-135,-152,-160,-172,-185,-178,-189,-187,
+-196,-197,-201,-200,-200,-208,-213,-212,-201,-202,-190,-187,-187,-183,-169,-164,
+-152,-147,-146,-129,-122,-98,-96,-81,-69,-61,-48,-42,-34,-19,-7,2,
+6,28,41,51,64,77,83,83,100,120,140,140,151,157,183,189,
+203,213,228,241,248,268,290,295,307,327,334,345,355,369,383,390,
+400,412,421,432,438,434,444,450,457,460,458,467,463,462,459,464,
+454,450,441,446,431,433,422,417,394,396,380,376,357,358,344,332,
+315,301,288,278,274,244,224,211,203,192,178,170,161,150,132,116,
+99,94,79,86,71,59,42,41,34,31,23,15,6,2,-2,-2,
+-18,-19,-25,-24,-39,-38,-41,-44,-59,-57,-69,-75,-87,-84,-96,-101,
+-114,-130,-140,-155,-171,-175,-185,-203,-214,-230,-242,-254,-271,-277,-293,-308,
+-320,-336,-341,-344,-355,-369,-373,-380,-372,-376,-382,-373,-379,-387,-388,-380,
+-370,-377,-374,-365,-358,-351,-348,-343,-324,-312,-305,-298,-302,-278,-286,-272,
+-271,-252,-252,-246,-241,-228,-215,-204,-197,-200,-196,-186,-187,-178,-174,-161,
+-149,-145,-143,-135,-131,-117,-105,-103,-98,-90,-80,-71,-61,-60,-51,-44,
+-44,-41,-38,-21,-21,-10,-14,-10,-10,-4,8,0,4,10,20,15,
+19,22,21,16,17,16,19,25,29,29,35,28,24,33,24,31,
+31,29,36,34,50,43,48,45,52,53,59,66,69,83,86,89,
+92,102,112,115,132,136,142,157,168,177,177,189,190,193,196,206,
+207,210,212,222,214,219,214,222,215,213,208,212,207,204,202,195,
+197,190,182,179,186,180,177,167,168,168,164,158,167,163,168,170,
+161,166,165,162,170,166,165,169,179,175,187,180,197,190,194,206,
+218,214,231,221,234,237,242,245,238,259,257,273,275,282,283,282,
+283,276,281,287,286,288,293,287,296,289,292,284,291,292,282,280,
+288,287,295,296,300,298,299,287,291,287,289,282,296,298,291,295,
+293,293,294,302,308,312,311,316,304,301,309,304,301,300,298,292,
+295,282,281,267,255,250,230,221,216,198,192,176,149,137,112,102,
+78,62,52,25,2,-32,-58,-74,-92,-109,-135,-150,-174,-200,-221,-241,
+-260,-283,-308,-332,-350,-374,-383,-419,-431,-454,-462,-482,-503,-515,-536,-562,
+-570,-588,-603,-621,-639,-649,-664,-681,-692,-693,-704,-709,-721,-725,-739,-759,
+-751,-759,-760,-758,-769,-770,-779,-764,-770,-767,-773,-752,-752,-736,-733,-721,
+-716,-708,-690,-681,-659,-651,-634,-617,-603,-584,-569,-550,-523,-513,-494,-481,
+-459,-435,-406,-390,-378,-358,-337,-313,-285,-277,-257,-234,-215,-194,-181,-160,
+-137,-113,-95,-72,-57,-29,-17,4,22,41,65,90,124,129,152,166,
+191,212,232,257,279,295,309,333,347,366,385,403,425,436,458,460,
+477,498,513,528,539,551,558,569,570,577,577,589,585,599,607,593,
+600,590,598,592,586,583,581,581,574,562,556,547,541,535,521,520,
+493,484,460,458,438,425,410,391,390,366,353,336,309,297,289,273,
+261,248,225,213,205,183,168,152,138,119,108,104,93,91,73,64,
+53,49,45,29,27,37,22,16,9,9,7,1,-4,-8,-13,-11,
+-27,-32,-32,-39,-45,-37,-24,-36,-42,-44,-45,-37,-35,-33,-36,-31,
+-37,-27,-26,-7,-18,-7,-11,7,6,16,24,31,32,41,45,53,
+55,59,66,82,86,87,89,94,98,104,93,92,95,102,100,91,
+90,86,79,68,57,52,49,39,23,16,-8,-17,-28,-27,-45,-54,
+-69,-85,-92,-116,-110,-132,-132,-147,-155,-164,-183,-197,-211,-223,-230,-234,
+-240,-247,-249,-260,-271,-274,-281,-273,-280,-286,-301,-302,-306,-308,-304,-321,
+-313,-320,-319,-332,-339,-338,-337,-347,-357,-353,-362,-372,-375,-371,-381,-379,
+-382,-382,-387,-386,-400,-397,-399,-398,-407,-399,-401,-397,-397,-397,-391,-398,
+-388,-389,-378,-380,-370,-368,-364,-359,-354,-356,-345,-334,-325,-318,-320,-317,
+-308,-303,-304,-291,-284,-273,-258,-260,-250,-245,-227,-226,-212,-207,-197,-199,
+-188,-178,-164,-152,-135,-133,-110,-109,-102,-87,-81,-68,-61,-38,-21,-26,
+-4,4,17,25,44,58,66,79,94,102,120,119,144,150,172,177,
+192,192,212,218,226,241,249,270,279,288,296,310,315,319,326,342,
+344,350,348,361,367,376,390,386,395,384,391,393,398,394,395,399,
+390,397,389,394,385,387,375,378,367,371,360,358,359,363,369,353,
+355,353,342,341,329,326,330,321,328,319,312,301,303,285,282,258,
+250,228,230,213,206,197,173,157,137,129,103,93,79,64,51,33,
+24,4,-13,-26,-34,-45,-55,-67,-83,-89,-93,-98,-99,-110,-106,-109,
+-115,-116,-121,-116,-123,-119,-116,-101,-102,-95,-99,-93,-88,-80,-66,-67,
+-63,-68,-53,-51,-41,-44,-40,-40,-41,-40,-47,-51,-53,-48,-42,-47,
+-51,-57,-64,-73,-70,-79,-83,-89,-98,-94,-103,-108,-110,-114,-113,-112,
+-115,-129,-121,-117,-122,-124,-124,-128,-114,-115,-127,-126,-129,-123,-122,-112,
+-110,-105,-97,-100,-92,-104,-93,-90,-95,-91,-84,-80,-77,-84,-82,-77,
+-73,-67,-70,-62,-61,-50,-51,-45,-40,-41,-37,-26,-19,-16,-21,-14,
+-7,9,12,15,22,24,37,34,44,36,49,51,73,76,71,71,
+64,73,68,73,72,75,82,80,74,70,70,67,55,72,63,62,
+63,56,57,56,53,58,51,46,43,42,43,50,36,33,32,29,
+26,25,29,24,26,20,19,22,10,23,13,22,19,12,7,13,
+7,18,19,38,27,36,36,42,41,51,60,64,62,62,70,66,
+80,83,91,92,92,97,110,108,111,122,117,116,112,120,114,118,
+125,120,119,117,122,120,121,122,128,123,124,114,113,130,123,122,
+117,111,120,117,136,126,130,125,123,129,126,125,126,124,131,142,
+134,141,137,131,130,132,129,124,127,126,137,124,122,113,120,108,
+105,97,86,91,83,69,54,57,50,46,29,30,29,16,25,18,
+13,0,-3,5,2,-7,-8,-14,-4,-10,-8,-7,-10,0,4,7,
+6,7,8,17,14,16,14,13,20,26,29,29,24,27,16,15,
+17,10,12,2,4,-6,3,2,-8,-13,-26,-34,-47,-47,-50,-60,
+-66,-68,-75,-78,-82,-90,-89,-97,-88,-94,-95,-101,-106,-96,-107,-104,
+-107,-110,-106,-112,-109,-107,-112,-112,-108,-97,-107,-106,-103,-102,-104,-98,
+-104,-107,-111,-110,-104,-116,-113,-111,-122,-115,-127,-120,-117,-127,-126,-128,
+-127,-125,-130,-124,-131,-129,-122,-130,-136,-132,-127,-121,-127,-121,-130,-126,
+-123,-115,-114,-117,-118,-107,-106,-107,-91,-95,-84,-71,-71,-61,-67,-53,
+-51,-39,-36,-17,-10,0,-2,16,23,32,25,41,45,51,57,71,
+71,85,72,80,80,96,105,106,104,98,96,101,83,93,89,78,
+76,65,62,57,65,61,46,38,26,24,16,15,9,-4,0,-7,
+-17,-32,-34,-45,-40,-51,-65,-71,-71,-72,-81,-76,-85,-92,-105,-111,
+-109,-113,-124,-130,-135,-139,-139,-142,-138,-145,-146,-148,-158,-156,-155,-155,
+-151,-158,-154,-159,-152,-155,-154,-146,-151,-138,-135,-140,-139,-127,-133,-124,
+-116,-118,-112,-102,-103,-101,-102,-99,-97,-90,-90,-85,-79,-76,-80,-80,
+-76,-74,-84,-77,-77,-82,-92,-87,-94,-85,-100,-97,-104,-101,-102,-105,
+-115,-111,-119,-113,-127,-118,-124,-120,-115,-116,-111,-110,-105,-97,-91,-92,
+-84,-89,-76,-70,-54,-47,-37,-32,-19,-13,-1,4,16,21,31,36,
+53,52,61,66,73,79,79,91,87,99,96,105,109,124,119,127,
+131,129,133,130,129,130,143,142,151,145,150,152,156,158,160,161,
+165,166,168,164,166,175,176,174,179,176,183,186,175,183,188,191,
+193,191,193,192,188,195,200,204,194,194,191,196,199,198,197,203,
+201,203,196,198,198,196,190,203,190,191,190,181,178,164,173,161,
+158,155,151,137,134,131,120,116,103,106,89,91,80,80,64,60,
+52,44,37,26,28,11,6,-2,-4,-16,-21,-33,-37,-43,-57,-67,
+-73,-85,-88,-103,-101,-114,-113,-124,-140,-149,-164,-164,-169,-186,-195,-195,
+-208,-221,-229,-229,-250,-249,-259,-263,-279,-283,-294,-289,-297,-302,-311,-320,
+-325,-327,-327,-336,-340,-340,-342,-336,-340,-331,-337,-331,-333,-328,-325,-320,
+-315,-320,-313,-300,-290,-288,-291,-289,-275,-273,-259,-261,-249,-255,-233,-224,
+-225,-217,-206,-196,-193,-188,-176,-172,-154,-143,-139,-125,-117,-97,-105,-85,
+-84,-63,-47,-38,-27,-21,2,10,23,29,51,49,75,82,102,119,
+126,131,153,161,172,181,192,208,219,232,239,259,253,268,269,282,
+290,291,303,307,314,314,322,319,332,333,334,346,339,337,353,349,
+346,339,351,352,353,349,346,338,347,354,352,341,331,321,329,322,
+320,310,301,297,287,276,265,256,254,233,233,212,207,196,189,177,
+163,155,144,137,135,123,113,106,96,91,85,77,69,63,57,54,
+55,51,55,49,51,51,50,46,49,48,54,53,65,64,72,70,
+73,78,87,96,97,102,120,120,130,138,146,159,170,179,188,189,
+196,207,215,229,234,245,246,249,252,261,266,268,275,273,271,271,
+267,273,263,264,248,254,249,238,235,232,229,211,204,197,181,176,
+166,156,145,140,130,127,120,112,94,96,98,90,80,76,73,68,
+69,70,60,61,63,62,56,49,48,45,40,34,32,22,20,14,
+14,4,0,-8,-16,-30,-44,-51,-67,-82,-105,-111,-128,-148,-158,-175,
+-199,-209,-230,-240,-255,-276,-301,-316,-326,-349,-361,-374,-391,-408,-423,-443,
+-449,-465,-471,-485,-495,-505,-517,-528,-538,-548,-556,-559,-563,-573,-585,-592,
+-594,-599,-597,-610,-606,-617,-608,-611,-611,-612,-610,-600,-604,-605,-605,-603,
+-594,-594,-584,-577,-578,-564,-550,-544,-532,-523,-510,-501,-481,-472,-458,-447,
+-429,-414,-402,-387,-364,-343,-331,-309,-294,-280,-262,-245,-231,-206,-193,-180,
+-161,-144,-124,-108,-87,-87,-65,-53,-40,-28,-12,-9,8,23,40,46,
+62,66,89,98,121,127,133,144,159,177,202,209,223,236,252,259,
+283,299,314,331,343,358,371,385,396,411,432,443,456,469,479,487,
+502,514,524,527,538,539,550,552,557,560,567,567,571,566,561,560,
+562,558,545,536,536,527,513,503,496,480,471,458,442,428,412,391,
+375,359,340,318,301,290,279,257,249,234,209,202,185,170,162,149,
+138,118,104,83,86,75,72,56,50,42,39,26,21,12,14,2,
+7,0,-9,-20,-29,-31,-16,-32,-38,-54,-55,-55,-58,-63,-74,-74,
+-76,-83,-85,-94,-94,-106,-103,-108,-108,-108,-122,-123,-127,-128,-130,-130,
+-133,-127,-117,-118,-119,-120,-111,-119,-109,-97,-97,-97,-92,-81,-74,-67,
+-71,-61,-53,-43,-42,-41,-35,-31,-30,-19,-10,-10,-8,-10,1,4,
+3,17,16,21,21,31,33,33,35,32,36,47,42,43,37,40,
+42,51,41,42,36,42,40,42,42,37,35,24,28,24,23,14,
+18,5,-4,-23,-27,-25,-51,-48,-74,-79,-95,-108,-119,-132,-150,-173,
+-173,-193,-209,-223,-233,-252,-276,-289,-293,-304,-318,-328,-343,-348,-358,-366,
+-370,-373,-390,-401,-411,-407,-413,-420,-424,-426,-432,-423,-436,-434,-429,-426,
+-422,-422,-417,-421,-409,-412,-403,-411,-399,-400,-392,-379,-386,-368,-371,-350,
+-353,-348,-343,-329,-329,-316,-305,-300,-299,-283,-277,-270,-257,-240,-239,-222,
+-220,-203,-195,-179,-165,-154,-141,-128,-110,-102,-89,-79,-62,-49,-30,-13,
+-1,20,28,46,59,83,102,120,137,150,174,188,203,218,233,247,
+269,288,311,323,330,353,369,390,396,418,422,444,452,468,478,498,
+498,508,515,528,537,557,562,568,574,579,590,590,610,610,623,616,
+624,617,632,626,627,634,626,642,628,638,621,622,618,614,618,604,
+603,596,590,579,577,566,551,547,539,524,507,493,473,463,444,421,
+409,383,371,338,328,296,286,265,241,226,197,175,145,124,110,84,
+64,36,10,-5,-32,-42,-62,-85,-98,-117,-131,-150,-169,-182,-180,-200,
+-211,-232,-238,-248,-259,-264,-281,-280,-293,-299,-308,-318,-325,-332,-346,-351,
+-364,-364,-377,-387,-392,-398,-402,-400,-418,-423,-429,-426,-435,-448,-448,-452,
+-456,-466,-459,-469,-466,-471,-468,-470,-468,-469,-468,-473,-469,-469,-456,-455,
+-455,-452,-449,-446,-448,-434,-423,-414,-417,-411,-397,-390,-383,-374,-358,-346,
+-337,-327,-320,-312,-301,-290,-277,-277,-260,-246,-234,-231,-213,-204,-188,-180,
+-164,-152,-139,-119,-106,-92,-91,-71,-55,-44,-25,-20,-4,8,29,40,
+48,62,71,82,94,106,112,116,126,132,145,143,151,153,160,170,
+168,168,173,175,182,184,173,176,171,177,174,171,172,168,164,157,
+150,139,130,121,129,120,121,114,103,89,86,81,79,66,68,58,
+55,47,43,32,27,17,21,11,13,15,-1,9,-4,-4,-11,-7,
+-16,-18,-8,-16,-12,-26,-13,-18,-4,-21,-12,-14,-12,-13,-16,-15,
+-10,-13,-3,-8,3,-3,2,5,5,7,4,7,15,14,17,22,
+30,29,38,39,38,40,58,68,69,66,73,86,102,106,108,123,
+129,147,152,162,171,185,190,197,208,225,233,240,246,251,270,274,
+281,281,290,286,291,299,299,301,303,297,300,294,293,293,276,274,
+260,263,249,247,237,229,213,212,196,185,179,171,158,149,135,132,
+113,104,88,81,74,68,50,39,31,28,12,9,-4,-3,-25,-26,
+-43,-54,-60,-64,-67,-80,-93,-94,-106,-108,-125,-126,-135,-145,-148,-153,
+-158,-164,-169,-176,-171,-179,-183,-192,-194,-196,-202,-197,-197,-194,-191,-192,
+-190,-195,-189,-189,-177,-172,-172,-159,-160,-157,-151,-145,-138,-136,-128,-122,
+-114,-115,-112,-95,-89,-87,-83,-78,-72,-59,-60,-57,-53,-47,-36,-33,
+-14,-20,-5,-12,-2,-2,7,5,18,22,26,28,37,48,46,41,
+41,51,56,58,62,61,58,66,67,71,66,67,77,82,83,83,
+77,75,78,80,86,80,82,82,84,80,85,86,81,78,80,75,
+78,82,73,76,70,78,66,66,70,69,61,54,52,51,51,46,
+37,32,35,25,26,8,6,-2,-9,-6,-16,-18,-34,-31,-35,-37,
+-46,-49,-57,-63,-63,-74,-73,-80,-77,-84,-97,-97,-103,-100,-100,-107,
+-105,-114,-106,-113,-105,-110,-112,-111,-110,-111,-116,-122,-116,-114,-112,-118,
+-115,-116,-123,-125,-116,-118,-114,-110,-114,-109,-107,-97,-94,-97,-89,-83,
+-82,-72,-71,-60,-54,-47,-31,-27,-16,-8,11,12,31,43,53,58,
+66,77,83,97,105,114,132,138,143,148,152,157,164,172,177,181,
+172,179,170,173,164,179,169,173,161,162,159,151,145,139,149,139,
+140,135,131,131,125,128,122,132,119,121,120,120,117,122,125,126,
+122,123,123,124,125,119,124,121,123,126,118,127,116,124,112,118,
+112,110,107,98,103,95,91,86,80,69,74,65,64,51,44,43,
+38,28,23,22,12,11,0,-1,-5,-11,-17,-24,-32,-30,-46,-37,
+-48,-44,-47,-54,-48,-50,-51,-65,-60,-65,-56,-66,-65,-72,-74,-73,
+-67,-76,-74,-86,-79,-89,-79,-83,-85,-83,-95,-92,-90,-97,-105,-102,
+-109,-109,-120,-123,-130,-123,-131,-127,-146,-148,-152,-160,-160,-167,-168,-173,
+-178,-182,-187,-189,-193,-209,-213,-219,-214,-220,-216,-225,-224,-226,-233,-235,
+-236,-233,-239,-243,-242,-244,-241,-244,-242,-245,-238,-247,-241,-243,-237,-238,
+-238,-228,-227,-226,-224,-212,-218,-209,-208,-201,-201,-198,-196,-187,-182,-181,
+-175,-170,-171,-160,-156,-139,-136,-129,-126,-124,-113,-105,-90,-88,-84,-69,
+-64,-56,-52,-47,-32,-28,-13,-18,-11,-3,1,7,15,17,22,25,
+25,25,27,26,35,36,33,34,27,40,41,39,34,34,36,40,
+38,42,33,36,33,44,37,36,38,43,44,48,52,58,64,67,
+64,70,66,69,80,88,96,95,107,108,112,113,121,121,128,128,
+130,129,140,139,149,153,153,158,161,166,164,163,166,164,168,176,
+168,173,178,184,177,184,177,184,185,196,192,201,196,199,205,209,
+213,216,219,229,236,241,244,245,254,258,261,265,273,274,278,278,
+282,289,289,290,304,303,307,301,297,296,294,298,287,297,287,282,
+281,273,282,269,262,257,247,256,242,240,236,230,220,211,208,193,
+196,183,185,175,163,156,150,152,141,132,123,108,104,94,92,75,
+75,57,52,47,45,31,32,11,10,-3,-13,-19,-22,-33,-43,-50,
+-62,-70,-78,-84,-94,-98,-110,-108,-127,-128,-144,-141,-147,-156,-154,-166,
+-177,-182,-187,-186,-194,-198,-200,-205,-207,-216,-216,-219,-225,-223,-231,-238,
+-232,-239,-239,-240,-246,-242,-244,-244,-248,-240,-238,-249,-252,-247,-244,-247,
+-242,-249,-244,-236,-234,-227,-231,-222,-227,-225,-226,-224,-216,-216,-204,-208,
+-204,-199,-196,-200,-198,-189,-182,-186,-185,-175,-172,-165,-159,-165,-156,-149,
+-145,-148,-142,-145,-128,-127,-115,-115,-107,-112,-97,-95,-88,-79,-81,-77,
+-80,-69,-67,-61,-48,-55,-45,-52,-46,-46,-42,-47,-41,-35,-35,-31,
+-37,-28,-30,-25,-29,-27,-30,-28,-28,-27,-18,-15,-24,-18,-22,-13,
+-21,-15,-22,-12,-12,-12,-17,-23,-10,-4,-2,-12,-10,-6,-3,1,
+-11,-4,-10,-2,-5,2,-1,-4,0,-9,-9,-8,-14,-16,-20,-13,
+-14,-11,-17,-15,-19,-13,-13,-13,-11,-15,-5,-4,-1,-5,-5,6,
+7,12,17,23,24,29,38,45,47,56,72,80,83,86,89,96,
+106,118,116,137,138,152,151,169,167,185,185,198,206,218,222,231,
+232,251,249,258,265,268,264,268,274,282,281,290,293,290,292,291,
+289,285,298,286,293,286,289,297,294,290,287,284,283,283,275,270,
+268,275,274,269,264,273,263,266,265,265,253,261,254,247,248,249,
+242,239,240,237,233,230,229,223,224,219,220,214,205,193,184,178,
+166,166,151,145,134,132,118,113,95,86,64,59,43,44,15,2,
+-14,-27,-32,-52,-59,-79,-92,-105,-127,-134,-145,-159,-174,-186,-193,-210,
+-213,-226,-237,-247,-254,-255,-271,-283,-293,-297,-307,-316,-325,-327,-326,-332,
+-341,-347,-355,-353,-365,-371,-377,-375,-379,-384,-383,-381,-383,-384,-387,-392,
+-386,-391,-381,-387,-378,-382,-375,-374,-369,-364,-356,-350,-354,-347,-352,-336,
+-329,-317,-317,-311,-297,-301,-291,-292,-267,-269,-261,-267,-254,-251,-248,-240,
+-235,-225,-231,-220,-223,-218,-210,-208,-201,-202,-196,-195,-186,-178,-183,-175,
+-175,-167,-171,-160,-153,-143,-143,-135,-143,-134,-123,-115,-115,-108,-93,-87,
+-74,-68,-61,-62,-52,-43,-29,-25,-12,-12,-8,4,5,10,20,30,
+48,47,49,52,61,63,65,73,77,87,87,93,99,97,106,103,
+114,114,114,120,125,131,128,140,134,144,146,157,157,171,169,179,
+178,189,194,191,205,216,223,224,228,234,244,255,268,271,285,291,
+294,305,312,325,335,337,343,348,363,362,377,375,381,391,397,418,
+412,419,416,417,425,422,433,431,433,442,432,441,431,441,438,433,
+430,428,420,416,422,410,406,396,391,381,381,372,372,359,352,342,
+342,329,319,312,302,303,287,287,275,264,260,248,241,233,228,211,
+215,198,184,179,169,158,138,136,122,108,101,91,81,70,56,41,
+30,23,7,-1,-21,-31,-42,-56,-68,-87,-96,-111,-117,-136,-139,-148,
+-172,-171,-190,-191,-206,-216,-232,-245,-251,-257,-265,-273,-285,-291,-308,-307,
+-316,-325,-333,-334,-347,-348,-356,-360,-364,-368,-375,-381,-386,-389,-396,-395,
+-402,-402,-406,-399,-409,-404,-406,-410,-407,-409,-403,-403,-397,-401,-393,-391,
+-385,-374,-377,-371,-359,-348,-343,-332,-328,-318,-310,-297,-288,-270,-259,-255,
+-246,-238,-225,-212,-202,-187,-184,-170,-165,-151,-140,-128,-119,-108,-104,-88,
+-88,-71,-67,-60,-50,-46,-34,-32,-14,-14,-1,6,11,22,25,34,
+29,36,40,45,48,55,62,66,68,70,72,84,82,90,91,91,
+96,97,96,99,99,111,104,109,105,104,104,103,99,101,101,100,
+105,96,103,94,89,92,88,94,87,89,83,85,81,79,74,71,
+77,75,78,77,77,76,75,69,67,65,61,69,68,78,64,68,
+60,68,65,63,62,67,67,66,59,60,60,67,63,64,55,61,
+60,62,68,61,55,61,59,62,66,65,62,54,56,56,56,56,
+50,42,37,35,32,30,30,24,23,10,10,4,8,5,-2,3,
+-8,-6,-8,-9,-8,-14,-8,-10,-5,-12,-2,-6,6,1,8,14,
+17,13,18,25,33,38,41,40,47,49,58,60,68,69,73,71,
+78,79,84,80,87,82,86,87,89,96,81,91,83,86,79,71,
+70,63,65,68,67,54,58,50,55,52,44,44,35,41,33,35,
+25,26,24,17,20,18,14,11,9,7,6,2,0,-3,-5,-11,
+-11,-13,-17,-22,-22,-23,-28,-30,-39,-37,-46,-38,-47,-50,-59,-64,
+-67,-72,-71,-82,-84,-84,-89,-90,-99,-98,-108,-108,-112,-112,-120,-120,
+-125,-129,-126,-132,-133,-138,-145,-144,-154,-152,-157,-163,-161,-159,-169,-176,
+-176,-182,-182,-192,-189,-190,-194,-199,-200,-196,-200,-207,-205,-210,-211,-212,
+-216,-215,-214,-207,-207,-211,-196,-203,-191,-193,-182,-184,-176,-170,-164,-150,
+-150,-138,-138,-117,-112,-107,-96,-86,-75,-64,-53,-43,-31,-29,-6,-6,
+12,17,36,37,50,56,62,74,80,92,98,99,113,116,132,125,
+137,134,141,143,144,151,154,165,156,163,153,169,155,169,164,167,
+166,168,166,160,166,164,159,161,163,168,168,165,168,164,168,163,
+163,162,163,167,174,165,168,153,160,151,157,159,157,151,149,136,
+138,129,121,123,114,113,105,104,84,89,67,67,56,54,36,24,
+15,14,12,4,-9,-18,-17,-26,-32,-41,-48,-56,-55,-62,-60,-58,
+-64,-61,-65,-61,-61,-57,-61,-61,-63,-57,-55,-49,-47,-45,-38,-36,
+-28,-23,-16,-14,-16,-5,3,6,13,10,25,26,38,39,44,54,
+60,66,73,75,83,85,97,100,108,109,116,127,138,146,157,153,
+165,173,179,183,183,192,197,207,202,213,216,222,222,223,227,229,
+235,224,229,213,226,227,231,232,219,214,208,206,198,198,190,191,
+178,169,165,152,152,142,135,122,120,107,111,98,94,81,74,64,
+53,50,47,45,33,27,22,15,9,1,-3,-5,-14,-17,-23,-32,
+-44,-52,-52,-61,-70,-75,-81,-94,-100,-110,-114,-119,-128,-131,-142,-149,
+-160,-163,-166,-173,-180,-187,-198,-205,-209,-214,-216,-227,-231,-235,-244,-249,
+-250,-254,-262,-264,-258,-269,-269,-275,-273,-287,-278,-288,-273,-284,-288,-286,
+-290,-285,-286,-282,-277,-277,-277,-275,-270,-275,-267,-262,-262,-263,-253,-255,
+-244,-248,-237,-236,-225,-228,-224,-209,-204,-192,-187,-183,-172,-169,-159,-150,
+-143,-141,-123,-113,-98,-85,-86,-67,-59,-45,-29,-17,-15,5,11,27,
+38,46,63,71,89,97,107,120,128,138,152,158,173,178,189,192,
+193,207,206,222,222,235,242,239,244,241,240,247,245,243,243,240,
+249,241,250,239,235,231,229,218,221,211,208,198,197,194,196,189,
+185,179,176,168,168,159,159,151,146,146,143,141,134,134,131,129,
+127,123,115,109,102,102,92,97,95,86,78,78,71,66,60,47,
+50,35,31,28,16,15,3,3,-13,-20,-30,-31,-40,-44,-60,-60,
+-65,-68,-76,-82,-72,-77,-75,-82,-85,-82,-91,-89,-90,-86,-89,-84,
+-88,-87,-86,-86,-76,-74,-72,-66,-66,-60,-63,-57,-60,-53,-45,-44,
+-37,-40,-32,-25,-15,-14,-15,-11,-4,5,7,8,15,19,23,27,
+29,41,41,52,50,59,57,70,63,72,71,86,84,84,86,84,
+89,91,87,83,88,84,87,90,81,87,86,86,83,78,68,66,
+64,62,58,56,48,46,47,43,39,28,30,23,24,18,12,9,
+-2,-4,-8,-7,-16,-13,-28,-31,-41,-46,-55,-53,-67,-62,-78,-75,
+-82,-87,-90,-101,-106,-112,-121,-127,-134,-137,-141,-148,-148,-157,-161,-168,
+-174,-177,-182,-194,-192,-202,-197,-206,-213,-217,-227,-219,-229,-236,-235,-252,
+-239,-256,-253,-262,-260,-264,-267,-264,-280,-275,-280,-274,-276,-277,-278,-278,
+-279,-277,-273,-278,-272,-267,-261,-266,-252,-254,-246,-244,-234,-224,-219,-207,
+-203,-189,-182,-180,-163,-162,-148,-144,-133,-128,-111,-99,-94,-82,-78,-61,
+-53,-41,-41,-27,-23,-11,2,5,13,16,25,30,42,44,58,64,
+65,71,71,80,85,90,91,100,102,104,109,115,119,121,121,125,
+128,134,137,138,144,146,158,159,168,171,179,171,180,177,189,182,
+189,189,197,198,201,202,211,207,207,211,200,203,202,203,209,204,
+205,201,204,202,202,205,201,196,200,199,200,201,203,203,198,207,
+209,207,208,210,209,207,205,208,209,213,211,213,211,207,209,202,
+202,198,195,199,193,197,194,186,181,176,177,166,166,159,161,147,
+141,138,136,128,124,116,111,106,105,94,94,85,86,76,73,68,
+64,55,47,46,41,39,25,29,21,20,14,13,15,7,9,-2,
+3,-6,-4,-8,-15,-20,-16,-18,-18,-21,-24,-20,-24,-27,-30,-32,
+-37,-40,-41,-38,-41,-43,-48,-50,-47,-52,-51,-60,-67,-65,-69,-76,
+-72,-77,-75,-82,-87,-89,-89,-98,-98,-111,-114,-114,-121,-118,-122,-127,
+-129,-136,-134,-138,-138,-143,-141,-155,-155,-164,-160,-166,-163,-171,-173,-177,
+-184,-185,-190,-187,-196,-196,-199,-200,-207,-205,-213,-217,-224,-225,-223,-223,
+-229,-230,-238,-237,-238,-238,-243,-246,-251,-245,-247,-244,-247,-245,-246,-248,
+-247,-252,-244,-248,-245,-246,-240,-238,-237,-240,-234,-232,-229,-230,-225,-225,
+-219,-216,-221,-208,-218,-200,-209,-198,-198,-196,-194,-187,-187,-186,-183,-175,
+-173,-170,-172,-162,-163,-156,-158,-144,-143,-133,-141,-128,-129,-115,-109,-94,
+-83,-77,-68,-61,-55,-44,-30,-21,-9,6,12,28,36,53,64,76,
+92,99,117,126,141,154,165,179,180,199,207,222,230,238,247,257,
+271,276,285,296,307,310,314,319,326,335,341,340,342,344,352,357,
+354,365,365,375,378,380,385,387,396,389,400,395,402,401,400,402,
+409,407,413,410,409,404,406,412,407,409,402,405,402,402,394,395,
+388,385,378,372,368,358,356,346,348,335,334,324,321,308,296,283,
+278,262,257,246,238,226,220,203,189,178,161,156,139,135,119,108,
+94,84,72,65,49,35,22,11,5,-5,-18,-24,-34,-48,-56,-69,
+-79,-88,-93,-108,-121,-124,-135,-142,-155,-167,-165,-174,-178,-191,-197,-201,
+-203,-212,-217,-216,-224,-229,-232,-237,-233,-239,-239,-241,-243,-245,-240,-237,
+-232,-235,-236,-235,-239,-236,-235,-227,-221,-219,-219,-214,-220,-215,-219,-209,
+-211,-203,-203,-193,-200,-185,-197,-186,-189,-185,-188,-183,-184,-186,-184,-188,
+-181,-186,-176,-190,-178,-182,-178,-185,-185,-184,-182,-182,-183,-180,-181,-173,
+-179,-175,-170,-170,-167,-165,-164,-163,-161,-152,-153,-141,-148,-141,-136,-130,
+-124,-121,-115,-110,-105,-105,-92,-94,-85,-79,-78,-69,-69,-69,-54,-53,
+-47,-50,-48,-42,-38,-37,-35,-30,-38,-30,-33,-24,-24,-22,-20,-13,
+-21,-15,-19,-12,-7,-6,-2,-4,2,2,17,14,23,27,32,39,
+37,48,50,60,56,69,68,75,70,83,85,95,95,101,110,100,
+108,103,106,113,110,115,114,122,112,123,115,121,117,121,118,121,
+117,117,114,112,112,114,111,112,111,114,114,110,110,106,99,102,
+99,101,100,108,97,104,93,100,95,89,93,91,94,87,97,89,
+92,93,95,93,91,87,91,89,90,86,86,88,81,86,76,80,
+75,78,74,72,73,67,74,68,75,70,73,66,62,64,66,62,
+73,61,64,57,64,64,64,58,63,58,61,58,55,58,52,54,
+50,48,50,48,45,41,47,47,47,45,37,39,32,39,30,34,
+25,24,21,19,20,16,13,15,7,10,6,3,-2,-1,-2,-6,
+-5,-10,-11,-17,-21,-25,-23,-24,-27,-27,-32,-26,-33,-39,-37,-48,
+-36,-55,-44,-52,-50,-48,-56,-59,-61,-64,-68,-69,-72,-77,-81,-88,
+-90,-95,-92,-104,-100,-115,-114,-121,-124,-130,-132,-137,-142,-144,-151,-147,
+-162,-156,-169,-166,-171,-175,-178,-181,-190,-186,-196,-190,-198,-190,-201,-201,
+-204,-198,-201,-196,-201,-197,-196,-200,-202,-198,-198,-194,-190,-194,-185,-192,
+-189,-194,-191,-190,-188,-188,-182,-186,-185,-183,-186,-180,-181,-181,-179,-178,
+-173,-178,-171,-175,-164,-164,-156,-158,-150,-148,-136,-134,-129,-119,-117,-114,
+-108,-97,-94,-82,-78,-65,-62,-50,-42,-34,-26,-13,-9,2,8,24,
+25,38,40,56,64,74,81,84,89,94,113,113,129,121,136,140,
+145,149,155,160,163,170,177,173,183,182,190,189,197,192,198,200,
+203,201,200,199,200,206,202,200,203,203,205,198,194,194,196,194,
+193,189,184,185,181,182,178,176,173,169,171,167,166,159,157,148,
+151,149,141,141,135,136,130,125,121,121,118,110,107,105,103,94,
+95,82,80,77,69,73,63,53,50,47,44,43,29,28,11,9,
+2,2,-9,-15,-26,-29,-38,-38,-47,-43,-57,-57,-61,-72,-68,-77,
+-73,-78,-90,-84,-88,-89,-94,-100,-100,-101,-102,-101,-106,-106,-103,-108,
+-101,-110,-101,-105,-95,-100,-100,-98,-101,-97,-91,-91,-88,-88,-79,-80,
+-79,-77,-71,-72,-60,-59,-56,-50,-41,-38,-33,-31,-31,-27,-17,-15,
+0,7,7,14,12,21,28,30,37,34,46,43,48,45,52,52,
+52,58,58,60,56,61,56,67,60,62,63,56,61,61,65,62,
+60,62,63,64,64,65,64,67,64,67,69,63,65,70,68,71,
+64,66,64,63,64,61,60,61,52,51,49,45,43,40,37,33,
+25,25,16,13,8,2,-5,-10,-21,-22,-23,-26,-35,-37,-42,-45,
+-47,-56,-60,-68,-66,-68,-76,-76,-82,-85,-87,-93,-92,-97,-94,-97,
+-95,-102,-97,-102,-98,-99,-102,-100,-98,-99,-97,-88,-92,-87,-89,-83,
+-87,-81,-83,-77,-76,-67,-69,-60,-62,-56,-54,-47,-48,-44,-37,-39,
+-32,-29,-23,-22,-15,-17,-8,-2,4,4,11,17,19,25,36,37,
+50,46,55,57,67,71,84,82,89,92,97,102,108,105,122,119,
+132,130,136,141,140,149,145,158,152,164,161,160,165,159,173,164,
+168,162,164,166,162,168,163,166,157,163,158,156,155,153,157,151,
+144,147,145,137,139,134,131,125,122,116,120,110,113,106,106,101,
+103,94,96,87,84,81,78,74,72,65,66,57,58,50,48,44,
+39,37,31,27,27,20,19,14,6,4,-2,-5,-11,-10,-16,-16,
+-21,-25,-29,-34,-38,-45,-41,-49,-46,-49,-49,-54,-57,-64,-60,-61,
+-66,-61,-68,-66,-69,-70,-72,-69,-75,-74,-74,-75,-74,-83,-81,-79,
+-81,-81,-81,-84,-85,-84,-87,-87,-93,-85,-95,-89,-96,-90,-91,-90,
+-96,-93,-99,-94,-96,-92,-93,-92,-92,-90,-86,-83,-83,-84,-80,-82,
+-76,-76,-69,-69,-70,-63,-64,-59,-61,-53,-54,-51,-46,-46,-46,-40,
+-43,-36,-42,-34,-36,-37,-33,-35,-33,-32,-26,-28,-23,-30,-24,-28,
+-23,-25,-20,-25,-20,-20,-24,-18,-15,-16,-12,-13,-14,-13,-10,-9,
+-8,-9,-6,-5,-4,-3,-6,-1,4,-3,-1,-2,-5,-3,-3,-9,
+-4,-3,-7,-10,-15,-14,-10,-17,-16,-20,-25,-27,-34,-37,-40,-43,
+-43,-49,-61,-56,-67,-66,-72,-77,-78,-87,-88,-93,-92,-101,-102,-105,
+-110,-113,-118,-120,-122,-124,-126,-132,-133,-138,-133,-135,-142,-141,-139,-140,
+-140,-141,-139,-138,-137,-138,-140,-130,-135,-128,-130,-126,-125,-121,-121,-111,
+-116,-103,-102,-93,-92,-86,-87,-77,-75,-69,-62,-59,-50,-46,-44,-33,
+-34,-25,-26,-14,-14,-1,0,10,13,17,21,26,36,38,46,47,
+55,58,72,73,81,86,94,95,103,108,111,122,125,133,136,146,
+148,156,156,167,167,173,175,175,179,182,183,186,188,191,189,194,
+194,198,193,193,196,198,190,195,189,192,183,184,182,180,174,175,
+170,171,165,163,157,156,148,148,144,141,135,127,125,112,113,101,
+100,98,91,81,78,72,68,60,50,46,37,35,26,23,11,11,
+-1,-1,-11,-18,-24,-30,-34,-45,-46,-55,-51,-64,-60,-70,-70,-74,
+-80,-77,-83,-82,-86,-89,-88,-94,-90,-96,-93,-94,-92,-92,-96,-94,
+-96,-94,-97,-94,-99,-94,-95,-96,-95,-91,-90,-90,-90,-89,-90,-88,
+-85,-84,-84,-82,-78,-82,-76,-83,-75,-77,-78,-78,-77,-78,-74,-78,
+-70,-75,-69,-68,-63,-60,-65,-63,-67,-56,-60,-51,-52,-51,-46,-49,
+-45,-49,-43,-40,-38,-36,-34,-38,-30,-34,-27,-28,-25,-22,-29,-20,
+-26,-20,-23,-22,-18,-22,-13,-18,-19,-19,-23,-22,-22,-25,-24,-25,
+-25,-25,-34,-30,-42,-32,-43,-41,-44,-46,-45,-56,-52,-58,-53,-55,
+-58,-60,-66,-70,-71,-76,-70,-81,-75,-83,-79,-80,-83,-84,-80,-85,
+-81,-81,-79,-81,-78,-79,-75,-77,-71,-76,-70,-70,-67,-63,-66,-60,
+-58,-57,-55,-48,-51,-41,-48,-39,-39,-33,-33,-23,-24,-18,-19,-11,
+-12,-8,-1,-1,9,10,24,22,32,32,37,45,50,59,62,73,
+70,83,86,97,101,108,115,117,130,129,140,141,150,152,157,156,
+170,169,182,172,183,181,182,187,183,191,183,192,190,200,197,199,
+197,193,195,192,198,193,198,193,195,193,195,197,194,191,190,191,
+189,191,187,187,186,182,179,172,173,168,168,162,159,157,158,150,
+151,143,141,138,130,130,121,122,112,116,107,105,95,95,93,85,
+84,74,77,69,67,63,57,52,49,44,41,39,33,34,27,25,
+21,13,14,5,6,-3,-1,-8,-9,-13,-23,-22,-29,-33,-37,-37,
+-45,-44,-55,-54,-57,-64,-66,-76,-71,-83,-81,-91,-94,-97,-98,-101,
+-102,-108,-112,-113,-123,-116,-126,-120,-128,-127,-129,-130,-131,-126,-134,-129,
+-135,-130,-134,-132,-134,-135,-132,-130,-131,-133,-129,-131,-124,-132,-124,-127,
+-125,-115,-126,-112,-122,-109,-114,-108,-114,-103,-108,-97,-96,-98,-91,-97,
+-88,-90,-85,-85,-86,-77,-80,-77,-78,-76,-74,-69,-71,-66,-67,-69,
+-67,-63,-60,-59,-58,-55,-56,-57,-54,-53,-49,-52,-44,-47,-42,-43,
+-40,-34,-37,-34,-38,-28,-34,-27,-27,-29,-22,-28,-24,-23,-25,-20,
+-26,-22,-21,-23,-18,-23,-23,-21,-29,-28,-26,-29,-23,-29,-29,-32,
+-31,-33,-30,-34,-33,-38,-40,-41,-38,-38,-42,-44,-42,-41,-39,-37,
+-35,-36,-33,-36,-31,-37,-28,-33,-21,-27,-18,-22,-17,-15,-10,-10,
+-9,-5,-5,0,2,7,7,15,20,20,24,24,29,33,36,41,
+42,48,52,53,58,58,65,68,76,72,79,79,85,86,95,90,
+94,97,101,105,110,113,112,115,121,120,123,125,129,128,133,129,
+131,137,132,139,134,137,137,140,141,140,136,140,136,137,140,136,
+138,132,133,132,129,130,129,126,127,122,125,118,124,117,122,110,
+116,109,110,106,103,104,101,96,98,90,93,86,86,83,79,76,
+75,72,65,60,60,51,52,46,43,33,34,24,22,11,6,4,
+-2,-5,-12,-25,-22,-33,-36,-42,-47,-52,-58,-58,-70,-72,-78,-83,
+-87,-91,-95,-102,-105,-110,-116,-117,-124,-127,-131,-134,-135,-139,-140,-146,
+-153,-149,-156,-149,-160,-157,-160,-161,-155,-165,-154,-165,-155,-163,-158,-162,
+-154,-160,-154,-157,-151,-155,-150,-149,-145,-146,-142,-139,-137,-136,-133,-135,
+-127,-127,-123,-121,-119,-112,-116,-111,-110,-106,-105,-100,-98,-94,-92,-89,
+-87,-87,-79,-79,-68,-68,-66,-60,-58,-49,-51,-41,-40,-39,-29,-28,
+-19,-23,-16,-12,-6,1,4,8,17,16,23,23,29,30,33,39,
+42,45,47,52,50,58,50,60,56,63,63,65,64,65,68,64,
+70,65,74,66,70,72,71,77,74,71,74,67,78,67,75,69,
+73,67,72,67,69,68,65,70,66,64,69,63,68,62,62,60,
+61,59,57,57,53,57,52,52,48,46,45,46,41,43,43,39,
+39,35,34,32,31,26,27,23,24,21,21,23,17,17,13,15,
+9,15,8,12,11,8,9,7,6,6,3,6,3,4,1,3,
+1,0,3,1,0,-2,0,1,0,0,-1,4,-4,4,-6,4,
+-2,1,2,-2,2,6,-2,4,0,5,5,7,5,8,6,9,
+9,10,12,11,15,15,20,20,15,23,19,26,21,26,26,25,
+28,29,30,34,32,31,33,31,33,32,37,32,39,28,38,29,
+35,26,36,26,34,25,33,25,30,25,26,24,21,23,18,19,
+12,18,12,13,12,7,9,4,6,5,4,0,-2,-3,-2,-8,
+-4,-10,-6,-11,-11,-13,-16,-14,-16,-19,-18,-26,-21,-30,-22,-29,
+-29,-34,-37,-37,-37,-41,-41,-49,-43,-53,-49,-57,-56,-60,-62,-63,
+-64,-66,-68,-68,-68,-70,-76,-76,-74,-76,-70,-77,-74,-76,-74,-74,
+-73,-76,-68,-74,-67,-72,-66,-67,-62,-60,-62,-60,-58,-57,-47,-53,
+-46,-48,-43,-43,-41,-35,-39,-27,-38,-24,-36,-22,-26,-22,-20,-21,
+-20,-16,-18,-12,-15,-11,-15,-9,-12,-6,-7,-5,-2,1,-2,3,
+0,5,4,9,9,10,12,18,17,21,19,23,22,28,26,31,
+30,36,32,36,36,39,37,43,36,47,40,45,47,43,51,44,
+52,44,52,46,48,47,48,47,50,45,50,45,48,42,49,39,
+44,41,41,44,41,41,39,40,33,38,33,37,30,33,30,33,
+30,29,23,28,20,27,20,25,18,22,16,21,17,19,15,14,
+16,14,15,12,12,15,12,15,14,11,17,9,18,11,19,15,
+16,18,17,19,18,20,22,16,26,18,29,21,30,24,30,26,
+29,29,32,32,33,31,35,32,37,32,42,31,38,35,38,34,
+38,32,37,35,35,31,35,31,31,33,30,28,29,23,27,22,
+21,21,18,18,14,18,12,17,10,12,5,5,4,4,3,0,
+1,-2,-2,-1,-2,0,-3,-6,-2,-8,1,-6,-3,-6,-4,-4,
+-2,-6,-5,-8,-6,-8,-7,-10,-9,-12,-11,-13,-15,-13,-17,-15,
+-20,-16,-21,-17,-22,-23,-24,-27,-29,-24,-35,-26,-33,-26,-33,-30,
+-33,-29,-34,-31,-33,-31,-33,-31,-32,-29,-33,-28,-30,-27,-30,-25,
+-31,-25,-27,-25,-25,-27,-25,-25,-25,-25,-22,-26,-23,-24,-22,-25,
+-23,-26,-22,-28,-23,-27,-25,-23,-27,-27,-28,-26,-29,-27,-30,-28,
+-31,-26,-33,-26,-33,-30,-29,-32,-26,-31,-27,-27,-27,-29,-26,-30,
+-27,-29,-26,-27,-23,-28,-24,-25,-22,-24,-23,-23,-24,-21,-23,-21,
+-21,-20,-21,-19,-21,-18,-19,-14,-20,-13,-19,-13,-15,-14,-14,-14,
+-14,-11,-12,-10,-9,-9,-6,-8,-6,-5,-5,-4,-2,0,0,-3,
+3,0,4,0,5,2,7,3,7,4,9,8,11,9,11,8,
+17,4,18,12,15,17,15,16,20,15,20,18,20,20,21,22,
+22,24,21,26,25,26,28,25,31,26,32,26,33,31,34,33,
+31,34,33,36,36,35,38,37,38,41,35,43,35,42,39,40,
+39,43,39,42,39,43,37,43,36,43,34,41,37,35,37,31,
+36,31,34,28,32,27,28,24,25,22,23,20,16,20,12,17,
+9,14,7,11,4,9,3,7,2,2,2,-1,-2,-3,-2,-6,
+-2,-9,-2,-10,-7,-11,-7,-12,-11,-15,-12,-16,-13,-20,-16,-21,
+-18,-24,-21,-23,-25,-23,-28,-26,-28,-29,-29,-31,-32,-34,-32,-38,
+-31,-37,-35,-35,-41,-35,-40,-37,-40,-38,-41,-37,-41,-38,-40,-40,
+-37,-41,-37,-39,-39,-36,-39,-33,-39,-34,-36,-32,-35,-34,-31,-34,
+-33,-33,-33,-32,-30,-32,-30,-30,-30,-29,-28,-29,-29,-28,-27,-28,
+-26,-28,-25,-25,-29,-22,-28,-22,-23,-25,-21,-24,-20,-22,-19,-19,
+-18,-17,-13,-19,-11,-16,-12,-15,-10,-12,-7,-10,-8,-6,-8,-2,
+-8,-1,-4,-1,0,-2,0,0,2,1,4,3,5,7,2,8,
+3,10,6,9,7,10,8,12,7,12,7,11,10,10,9,12,
+8,10,11,8,11,6,10,6,10,6,10,6,7,7,6,6,
+7,5,8,5,6,6,3,5,3,4,2,4,2,3,3,1,
+3,1,2,2,-1,4,-2,3,0,2,2,0,2,0,2,-1,
+4,-2,4,-1,4,0,2,0,6,-2,11,-3,7,4,4,6,
+8,2,11,5,12,8,10,8,13,11,13,15,14,15,17,16,
+19,19,18,23,20,23,22,25,24,27,26,28,29,29,28,28,
+32,30,33,33,32,35,33,36,34,36,35,36,39,33,40,35,
+38,40,34,42,33,43,33,42,37,39,40,36,40,37,38,39,
+37,39,36,37,36,35,37,32,38,28,35,30,32,30,29,29,
+26,27,25,23,24,21,22,19,17,17,14,15,13,11,11,8,
+9,6,8,1,6,0,5,-2,0,-2,-4,-3,-5,-6,-4,-10,
+-4,-14,-5,-15,-9,-14,-12,-15,-14,-16,-18,-17,-19,-19,-20,-22,
+-21,-23,-22,-24,-25,-26,-25,-28,-27,-29,-30,-28,-33,-28,-34,-28,
+-34,-31,-32,-34,-32,-34,-35,-32,-37,-32,-37,-33,-34,-35,-33,-34,
+-35,-32,-36,-31,-35,-32,-32,-32,-31,-31,-31,-30,-30,-29,-29,-27,
+-29,-25,-28,-23,-26,-22,-25,-21,-24,-20,-20,-19,-18,-17,-19,-14,
+-17,-13,-13,-14,-12,-12,-9,-12,-6,-11,-7,-6,-8,-3,-6,-1,
+-3,-5,2,-5,4,-3,4,-1,5,2,4,6,3,9,2,11,
+4,12,7,9,11,9,11,13,9,14,12,12,14,12,14,13,
+15,14,13,16,11,17,12,16,12,15,13,14,13,13,12,14,
+12,13,11,13,11,13,10,11,12,8,13,6,14,7,12,8,
+9,10,8,8,9,7,9,7,5,10,4,7,6,5,5,7,
+2,9,0,6,4,3,4,3,2,3,2,2,1,3,1,3,
+1,2,0,2,0,1,1,2,0,2,0,1,1,2,0,3,
+-2,3,0,2,0,3,-2,4,-2,4,-2,4,-1,1,3,-2,
+4,-1,1,2,0,3,-2,3,0,2,0,2,0,2,1,0,
+2,1,0,2,1,1,0,3,-2,4,-1,3,-1,2,1,1,
+1,1,-1,2,-1,1,0,3,-3,5,-6,5,-4,2,1,-3,
+3,-2,-1,1,-4,2,-4,2,-4,2,-4,2,-4,0,-3,-1,
+-2,-3,-2,-1,-3,0,-4,-1,-2,-3,-1,-2,-2,-2,-3,0,
+-4,-1,-1,-4,3,-4,0,0,-3,1,-2,
+0,
+};
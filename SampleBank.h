@@ -0,0 +1,56 @@
+// Sample bank generated by tools/kit_compiler from kit.txt, do not edit
+//
+// kit kit.txt
+// name             encoding  samples    rate     bytes 44.1k bytes   ratio  snr dB
+// kick             pcm16       10461   44100     20922       20922    1.0:1       -
+// type             pcm16        7212   44100     14424       14424    1.0:1       -
+// return           pcm16        5171   44100     10342       10342    1.0:1       -
+// tink             pcm16        5751   44100     11502       11502    1.0:1       -
+// firehit          pcm16       49611   44100     99222       99222    1.0:1       -
+// total                                         156412      156412    1.0:1
+// 
+// drum             layers  samples     bytes
+// kick                  1        1     20922
+// type                  1        1     14424
+// return                1        1     10342
+// tink                  1        1     11502
+// firehit               1        1     99222
+
+#pragma once
+
+#include "SampleBankEntry.h"
+
+extern const int16_t SAMPLE_BANK_DATA[78210];
+
+namespace SAMPLE_BANK
+{
+  constexpr SAMPLE_BANK_ENTRY KICK             = { SAMPLE_BANK_DATA + 0, 10461, 44100, 0x81, 32488, 10461, 10461, 10461, nullptr, 0, { 10326, 10274, 9982, 9958, 9919, 9848, 9694, 9426 } };
+  constexpr SAMPLE_BANK_ENTRY TYPE             = { SAMPLE_BANK_DATA + 10462, 7212, 44100, 0x81, 32392, 7212, 7212, 7212, nullptr, 0, { 7212, 7212, 7212, 7206, 7205, 7081, 6938, 6598 } };
+  constexpr SAMPLE_BANK_ENTRY RETURN           = { SAMPLE_BANK_DATA + 17674, 5171, 44100, 0x81, 32390, 5171, 5171, 5171, nullptr, 0, { 5171, 5171, 5171, 5171, 5171, 5171, 4962, 4335 } };
+  constexpr SAMPLE_BANK_ENTRY TINK             = { SAMPLE_BANK_DATA + 22846, 5751, 44100, 0x81, 32393, 5751, 5751, 5751, nullptr, 0, { 5751, 5751, 5750, 4760, 3774, 2890, 2159, 1477 } };
+  constexpr SAMPLE_BANK_ENTRY FIREHIT          = { SAMPLE_BANK_DATA + 28598, 49611, 44100, 0x81, 32393, 49611, 49611, 49611, nullptr, 0, { 49432, 49352, 48504, 48208, 46419, 43594, 37217, 25090 } };
+
+  constexpr const SAMPLE_BANK_ENTRY* KICK_LAYER_0[] = { &KICK };
+  constexpr SAMPLE_LAYER KICK_LAYERS[] = { { KICK_LAYER_0, 1, 0 } };
+  constexpr DRUM_SAMPLES KICK_DRUM = { KICK_LAYERS, 1 };
+
+  constexpr const SAMPLE_BANK_ENTRY* TYPE_LAYER_0[] = { &TYPE };
+  constexpr SAMPLE_LAYER TYPE_LAYERS[] = { { TYPE_LAYER_0, 1, 0 } };
+  constexpr DRUM_SAMPLES TYPE_DRUM = { TYPE_LAYERS, 1 };
+
+  constexpr const SAMPLE_BANK_ENTRY* RETURN_LAYER_0[] = { &RETURN };
+  constexpr SAMPLE_LAYER RETURN_LAYERS[] = { { RETURN_LAYER_0, 1, 0 } };
+  constexpr DRUM_SAMPLES RETURN_DRUM = { RETURN_LAYERS, 1 };
+
+  constexpr const SAMPLE_BANK_ENTRY* TINK_LAYER_0[] = { &TINK };
+  constexpr SAMPLE_LAYER TINK_LAYERS[] = { { TINK_LAYER_0, 1, 0 } };
+  constexpr DRUM_SAMPLES TINK_DRUM = { TINK_LAYERS, 1 };
+
+  constexpr const SAMPLE_BANK_ENTRY* FIREHIT_LAYER_0[] = { &FIREHIT };
+  constexpr SAMPLE_LAYER FIREHIT_LAYERS[] = { { FIREHIT_LAYER_0, 1, 0 } };
+  constexpr DRUM_SAMPLES FIREHIT_DRUM = { FIREHIT_LAYERS, 1 };
+
+  constexpr const SAMPLE_BANK_ENTRY* ALL_SAMPLES[] = { &KICK, &TYPE, &RETURN, &TINK, &FIREHIT };
+
+  constexpr int NUM_ENTRIES = 5;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+class File;
+
+// format byte, as used in the wav2sketch header - the top bits are the encoding, the low bits are the rate
+constexpr uint8_t SAMPLE_FORMAT_ENCODING_MASK = 0xF0;
+constexpr uint8_t SAMPLE_FORMAT_PCM_16        = 0x80;
+constexpr uint8_t SAMPLE_FORMAT_ULAW          = 0x00;
+constexpr uint8_t SAMPLE_FORMAT_IMA_ADPCM     = 0x40;
+constexpr uint8_t SAMPLE_FORMAT_RATE_MASK     = 0x0F;
+constexpr uint8_t SAMPLE_FORMAT_RATE_44100    = 0x01;
+constexpr uint8_t SAMPLE_FORMAT_RATE_22050    = 0x02;
+constexpr uint8_t SAMPLE_FORMAT_RATE_11025    = 0x03;
+
+// IMA ADPCM data is split into blocks, each starting with a 4 byte header (16 bit predictor, step index, unused)
+// followed by one nibble per sample, low nibble first
+constexpr int     IMA_ADPCM_BLOCK_SAMPLES     = 256;
+constexpr int     IMA_ADPCM_HEADER_BYTES      = 4;
+
+// a voice stops once the rest of its sample would be below this, 1 LSB of the 12 bit DAC
+constexpr int     EFFECTIVE_END_THRESHOLD     = 16;
+constexpr int     EFFECTIVE_END_LEVELS        = 8;      // gain levels 6dB apart, starting at full gain
+
+// a sample in the bank generated by tools/kit_compiler
+struct SAMPLE_BANK_ENTRY
+{
+  const int16_t*  m_data;
+  uint32_t        m_length;         // in decoded samples
+  uint32_t        m_sample_rate;
+  uint8_t         m_format;
+  int16_t         m_peak;
+  uint32_t        m_loop_start;     // no loop when start == end == length
+  uint32_t        m_loop_end;
+  uint32_t        m_resident_length;  // samples in m_data, the rest are streamed from m_stream_file
+  File*           m_stream_file;      // nullptr unless the sample is streamed
+  uint32_t        m_stream_offset;    // position in the file of the first streamed sample, sector aligned
+  uint32_t        m_effective_end[EFFECTIVE_END_LEVELS];  // at each gain level, the sample after the last one above EFFECTIVE_END_THRESHOLD
+};
+
+constexpr uint32_t sample_format_rate( uint8_t format )
+{
+  return ( format & SAMPLE_FORMAT_RATE_MASK ) == SAMPLE_FORMAT_RATE_44100 ? 44100 :
+         ( format & SAMPLE_FORMAT_RATE_MASK ) == SAMPLE_FORMAT_RATE_22050 ? 22050 :
+         ( format & SAMPLE_FORMAT_RATE_MASK ) == SAMPLE_FORMAT_RATE_11025 ? 11025 : 0;
+}
+
+constexpr uint8_t sample_format_encoding( uint8_t format )
+{
+  return format & SAMPLE_FORMAT_ENCODING_MASK;
+}
+
+// the sample player handles 16 bit PCM, u-law and IMA ADPCM at a rate it knows, only 16 bit PCM can be streamed
+constexpr bool is_playable( const SAMPLE_BANK_ENTRY& sample )
+{
+  return ( sample_format_encoding( sample.m_format ) == SAMPLE_FORMAT_PCM_16 ||
+           sample_format_encoding( sample.m_format ) == SAMPLE_FORMAT_ULAW ||
+           sample_format_encoding( sample.m_format ) == SAMPLE_FORMAT_IMA_ADPCM ) &&
+         sample_format_rate( sample.m_format ) == sample.m_sample_rate &&
+         sample.m_length > 0 &&
+         sample.m_resident_length <= sample.m_length &&
+         ( sample.m_resident_length == sample.m_length || sample_format_encoding( sample.m_format ) == SAMPLE_FORMAT_PCM_16 );
+}
+
+// bytes of sample data needed to hold the resident part of the sample
+constexpr uint32_t encoded_bytes( const SAMPLE_BANK_ENTRY& sample )
+{
+  return sample_format_encoding( sample.m_format ) == SAMPLE_FORMAT_PCM_16 ? sample.m_resident_length * 2 :
+         sample_format_encoding( sample.m_format ) == SAMPLE_FORMAT_ULAW ? sample.m_resident_length :
+         ( ( ( sample.m_resident_length + IMA_ADPCM_BLOCK_SAMPLES - 1 ) / IMA_ADPCM_BLOCK_SAMPLES ) * IMA_ADPCM_HEADER_BYTES ) + ( ( sample.m_resident_length + 1 ) / 2 );
+}
+
+template< size_t NUM_SAMPLES >
+constexpr bool all_playable( const SAMPLE_BANK_ENTRY* const (&samples)[NUM_SAMPLES] )
+{
+  for( size_t si = 0; si < NUM_SAMPLES; ++si )
+  {
+    if( !is_playable( *samples[si] ) )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+constexpr int     MAX_VELOCITY_LAYERS         = 8;
+
+// the samples a drum plays at and above a velocity, taking turns (round robin)
+struct SAMPLE_LAYER
+{
+  const SAMPLE_BANK_ENTRY* const* m_samples;
+  uint8_t         m_num_samples;
+  uint8_t         m_min_velocity;
+};
+
+// a drum's velocity layers in the bank
+struct DRUM_SAMPLES
+{
+  const SAMPLE_LAYER* m_layers;       // in order of increasing m_min_velocity
+  uint8_t         m_num_layers;
+};
+
+// kit files on the SD card, written by kit_compiler -sd. All values are little endian.
+// The header sector holds the magic, version, number of samples and data size (4, 2, 2 and 4 bytes, then 4 unused)
+// followed by an entry per sample: data offset, length, rate (4 bytes each), format, unused (1 byte each), peak (2 bytes),
+// loop start, loop end, resident length, stream offset and the effective ends (4 bytes each). The resident sample data starts at the next
+// sector so it can be read a sector at a time, the streamed part of each sample follows it, each starting on a sector.
+constexpr uint32_t SD_KIT_MAGIC               = 0x544B4452;   // "RDKT"
+constexpr uint16_t SD_KIT_VERSION             = 3;
+constexpr int      SD_KIT_SECTOR_BYTES        = 512;
+constexpr int      SD_KIT_HEADER_BYTES        = 16;
+constexpr int      SD_KIT_ENTRY_BYTES         = 32 + ( EFFECTIVE_END_LEVELS * 4 );
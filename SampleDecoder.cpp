@@ -0,0 +1,104 @@
+#include "Util.h"
+#include "SampleDecoder.h"
+
+namespace
+{
+  const int16_t ULAW_DECODE_TABLE[256] = {
+    -32124, -31100, -30076, -29052, -28028, -27004, -25980, -24956, -23932, -22908, -21884, -20860, -19836, -18812, -17788, -16764,
+    -15996, -15484, -14972, -14460, -13948, -13436, -12924, -12412, -11900, -11388, -10876, -10364, -9852, -9340, -8828, -8316,
+    -7932, -7676, -7420, -7164, -6908, -6652, -6396, -6140, -5884, -5628, -5372, -5116, -4860, -4604, -4348, -4092,
+    -3900, -3772, -3644, -3516, -3388, -3260, -3132, -3004, -2876, -2748, -2620, -2492, -2364, -2236, -2108, -1980,
+    -1884, -1820, -1756, -1692, -1628, -1564, -1500, -1436, -1372, -1308, -1244, -1180, -1116, -1052, -988, -924,
+    -876, -844, -812, -780, -748, -716, -684, -652, -620, -588, -556, -524, -492, -460, -428, -396,
+    -372, -356, -340, -324, -308, -292, -276, -260, -244, -228, -212, -196, -180, -164, -148, -132,
+    -120, -112, -104, -96, -88, -80, -72, -64, -56, -48, -40, -32, -24, -16, -8, 0,
+    32124, 31100, 30076, 29052, 28028, 27004, 25980, 24956, 23932, 22908, 21884, 20860, 19836, 18812, 17788, 16764,
+    15996, 15484, 14972, 14460, 13948, 13436, 12924, 12412, 11900, 11388, 10876, 10364, 9852, 9340, 8828, 8316,
+    7932, 7676, 7420, 7164, 6908, 6652, 6396, 6140, 5884, 5628, 5372, 5116, 4860, 4604, 4348, 4092,
+    3900, 3772, 3644, 3516, 3388, 3260, 3132, 3004, 2876, 2748, 2620, 2492, 2364, 2236, 2108, 1980,
+    1884, 1820, 1756, 1692, 1628, 1564, 1500, 1436, 1372, 1308, 1244, 1180, 1116, 1052, 988, 924,
+    876, 844, 812, 780, 748, 716, 684, 652, 620, 588, 556, 524, 492, 460, 428, 396,
+    372, 356, 340, 324, 308, 292, 276, 260, 244, 228, 212, 196, 180, 164, 148, 132,
+    120, 112, 104, 96, 88, 80, 72, 64, 56, 48, 40, 32, 24, 16, 8, 0,
+  };
+
+  const int16_t IMA_ADPCM_STEP_TABLE[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+    130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060,
+    1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484,
+    7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+  };
+
+  const int8_t IMA_ADPCM_INDEX_TABLE[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+}
+
+SAMPLE_DECODER::SAMPLE_DECODER() :
+  m_ring(),
+  m_data(nullptr),
+  m_encoding(SAMPLE_FORMAT_ULAW),
+  m_decoded(0),
+  m_predictor(0),
+  m_step_index(0)
+#ifdef SHOW_DECODE_PERF
+  ,m_decode_cycles(0)
+#endif
+{
+}
+
+void SAMPLE_DECODER::start( const SAMPLE_BANK_ENTRY& sample )
+{
+  m_data        = reinterpret_cast<const uint8_t*>( sample.m_data );
+  m_encoding    = sample_format_encoding( sample.m_format );
+  m_decoded     = 0;
+  m_predictor   = 0;
+  m_step_index  = 0;
+}
+
+int16_t SAMPLE_DECODER::decode_ulaw()
+{
+  return ULAW_DECODE_TABLE[ m_data[ m_decoded ] ];
+}
+
+int16_t SAMPLE_DECODER::decode_ima_adpcm()
+{
+  const int sample_in_block = m_decoded & ( IMA_ADPCM_BLOCK_SAMPLES - 1 );
+  if( sample_in_block == 0 )
+  {
+    // block header resets the decoder, so errors don't accumulate across the sample
+    m_predictor   = static_cast<int16_t>( m_data[0] | ( m_data[1] << 8 ) );
+    m_step_index  = m_data[2];
+    m_data       += IMA_ADPCM_HEADER_BYTES;
+  }
+
+  const int nibble  = ( sample_in_block & 1 ) ? ( *m_data++ >> 4 ) : ( *m_data & 0x0F );
+  const int step    = IMA_ADPCM_STEP_TABLE[ m_step_index ];
+
+  int diff          = step >> 3;
+  if( nibble & 1 )
+  {
+    diff           += step >> 2;
+  }
+  if( nibble & 2 )
+  {
+    diff           += step >> 1;
+  }
+  if( nibble & 4 )
+  {
+    diff           += step;
+  }
+
+  m_predictor       = ( nibble & 8 ) ? m_predictor - diff : m_predictor + diff;
+  m_predictor       = clamp<int32_t>( m_predictor, -32768, 32767 );
+  m_step_index      = clamp<int>( m_step_index + IMA_ADPCM_INDEX_TABLE[ nibble ], 0, 88 );
+
+  return static_cast<int16_t>( m_predictor );
+}
+
+#ifdef SHOW_DECODE_PERF
+uint32_t SAMPLE_DECODER::take_decode_cycles()
+{
+  const uint32_t cycles = m_decode_cycles;
+  m_decode_cycles       = 0;
+  return cycles;
+}
+#endif
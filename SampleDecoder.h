@@ -0,0 +1,75 @@
+#pragma once
+
+#include <array>
+#include <Arduino.h>
+
+#include "CompileSwitches.h"
+#include "SampleBankEntry.h"
+
+/////////////////////////////////////////////////////////
+
+// reads 16 bit PCM samples straight from the bank
+struct PCM_READER
+{
+  const int16_t*        m_data = nullptr;
+
+  inline void           prepare( int /*index*/ )                        { }
+  inline int16_t        operator[]( int index ) const                   { return m_data[index]; }
+};
+
+/////////////////////////////////////////////////////////
+
+// decodes u-law and IMA ADPCM samples into a small ring, just ahead of the interpolator,
+// so each source sample is decoded once however fast the sample is played
+class SAMPLE_DECODER
+{
+  static constexpr int  RING_SIZE                                       = 16;     // power of 2
+  static constexpr int  RING_MASK                                       = RING_SIZE - 1;
+
+  std::array<int16_t, RING_SIZE> m_ring;
+
+  const uint8_t*        m_data;
+  uint8_t               m_encoding;
+  int                   m_decoded;          // samples decoded since start()
+
+  int32_t               m_predictor;        // IMA ADPCM state
+  int                   m_step_index;
+
+#ifdef SHOW_DECODE_PERF
+  uint32_t              m_decode_cycles;
+#endif
+
+  int16_t               decode_ulaw();
+  int16_t               decode_ima_adpcm();
+
+  public:
+
+  SAMPLE_DECODER();
+
+  void                  start( const SAMPLE_BANK_ENTRY& sample );
+
+  // decode up to and including this sample, indices must not go backwards
+  inline void           prepare( int index )
+  {
+#ifdef SHOW_DECODE_PERF
+    const uint32_t start_cycles = ARM_DWT_CYCCNT;
+#endif
+    while( m_decoded <= index )
+    {
+      m_ring[ m_decoded & RING_MASK ] = m_encoding == SAMPLE_FORMAT_ULAW ? decode_ulaw() : decode_ima_adpcm();
+      ++m_decoded;
+    }
+#ifdef SHOW_DECODE_PERF
+    m_decode_cycles += ARM_DWT_CYCCNT - start_cycles;
+#endif
+  }
+
+  // only the last RING_SIZE decoded samples are available
+  inline int16_t        operator[]( int index ) const                   { return m_ring[ index & RING_MASK ]; }
+
+#ifdef SHOW_DECODE_PERF
+  uint32_t              take_decode_cycles();
+#endif
+};
+
+/////////////////////////////////////////////////////////
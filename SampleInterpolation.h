@@ -0,0 +1,108 @@
+#pragma once
+
+#include "FixedPoint.h"
+#include "Util.h"
+
+/////////////////////////////////////////////////////////
+
+// the voice's fixed point interpolators, free functions so the DSP benchmarks can call them directly.
+// READER returns the sample at an index (PCM_READER, SAMPLE_DECODER or SAMPLE_STREAM).
+namespace SAMPLE_INTERPOLATION
+{
+  constexpr FIXED_POINT HALF( 0.5f );
+  constexpr FIXED_POINT TWO( 2.0f );
+
+  template< typename READER >
+  int16_t read_sample_linear_fp( const READER& reader, FIXED_POINT read_head, int sample_length, FIXED_POINT gain )
+  {
+    // linearly interpolate between the current sample and its neighbour
+    // (previous neighbour if frac is less than 0.5, otherwise next)
+    const int int_part   = read_head.trunc_to_int32();
+    const FIXED_POINT frac_part( read_head - int_part );
+
+    const int16_t curr_samp   = reader[ int_part ];
+
+    if( frac_part < HALF )
+    {
+      int prev        = int_part - 1;
+      if( prev < 0 )
+      {
+        // at the beginning of the buffer, assume next sample was the same and use that (e.g. no interpolation)
+        return curr_samp;
+      }
+
+      const FIXED_POINT t     = frac_part * TWO;
+
+      const int16_t prev_samp = reader[ prev ];
+
+      FIXED_POINT lerp_samp   = lerp<FIXED_POINT >( FIXED_POINT(prev_samp), FIXED_POINT(curr_samp), t );
+
+      return lerp_samp.trunc_to_int16();
+    }
+    else
+    {
+      int next        = int_part + 1;
+      if( next >= sample_length )
+      {
+        // at the end of the buffer, assume next sample was the same and use that (e.g. no interpolation)
+        return curr_samp;
+      }
+
+      const FIXED_POINT t     = ( frac_part - HALF ) * TWO;
+
+      const int16_t next_samp = reader[ next ];
+
+      FIXED_POINT lerp_samp   = lerp<FIXED_POINT>( FIXED_POINT(curr_samp), FIXED_POINT(next_samp), t ) * gain;
+
+      return lerp_samp.trunc_to_int16();
+    }
+  }
+
+  template< typename READER >
+  int16_t read_sample_cubic_fp( const READER& reader, FIXED_POINT read_head, int sample_length, FIXED_POINT gain )
+  {
+    const int int_part   = read_head.trunc_to_int32();
+    const FIXED_POINT frac_part( read_head - int_part );
+
+    FIXED_POINT p0;
+    if( int_part >= 2 )
+    {
+      p0                        = reader[ int_part - 2 ];
+    }
+    else
+    {
+      // at the beginning of the buffer, assume previous sample was the same
+      p0                        = reader[ 0 ];
+    }
+
+    FIXED_POINT p1;
+    if( int_part <= 2 )
+    {
+      // reuse p0
+      p1                        = p0;
+    }
+    else
+    {
+      p1                        = reader[ int_part - 1 ];
+    }
+
+    FIXED_POINT p2;
+    p2                          = reader[ int_part ];
+
+    FIXED_POINT p3;
+    if( int_part < sample_length - 1)
+    {
+      p3                        = reader[ int_part + 1 ];
+    }
+    else
+    {
+      p3                        = p2;
+    }
+
+    const FIXED_POINT t         = lerp<FIXED_POINT>( FIXED_POINT(0.33333f), FIXED_POINT(0.66666f), frac_part );
+
+    const FIXED_POINT sampf     = cubic_interpolation<FIXED_POINT>( p0, p1, p2, p3, t ) * gain;
+
+    return sampf.trunc_to_int16();
+  }
+}
@@ -1,163 +1,353 @@
 #include "Util.h"
 #include "SamplePlayer.h"
+#include "SampleInterpolation.h"
+#include "AudioClock.h"
+#include "TriggerLatency.h"
 
 constexpr FIXED_POINT FIXED_POINT_ZERO( 0.0f );
-constexpr FIXED_POINT FIXED_POINT_HALF( 0.5f );
 constexpr FIXED_POINT FIXED_POINT_ONE( 1.0f );
-constexpr FIXED_POINT FIXED_POINT_TWO( 2.0f );
+
+constexpr uint32_t    ENVELOPE_FULL_GAIN = 0xFFFF;
+
+VOICE_ENVELOPE VOICE_ENVELOPE::from_times( int gate_ms, int decay_ms )
+{
+  VOICE_ENVELOPE envelope;
+  envelope.m_active           = gate_ms > 0 || decay_ms > 0;
+  envelope.m_gate_samples     = static_cast<uint32_t>( max_val( gate_ms, 0 ) * ( AUDIO_SAMPLE_RATE_EXACT / 1000.0f ) );
+  if( decay_ms > 0 )
+  {
+    // -60dB over the decay time
+    const float blocks        = ( decay_ms / 1000.0f ) * ( AUDIO_SAMPLE_RATE_EXACT / AUDIO_BLOCK_SAMPLES );
+    envelope.m_decay_per_block = static_cast<uint32_t>( powf( 0.001f, 1.0f / blocks ) * ENVELOPE_FULL_GAIN );
+  }
+  return envelope;
+}
 
 SAMPLE_PLAYER_EFFECT::SAMPLE_PLAYER_EFFECT() :
   AudioStream( 1, m_input_queue_array ),
   m_input_queue_array(),
   m_sample_data(nullptr),
   m_sample_length(0),
+  m_sample_encoding(SAMPLE_FORMAT_PCM_16),
+  m_pcm_reader(),
+  m_decoder(),
+#ifdef SD_KITS
+  m_stream(nullptr),
+#endif
   m_speed(1.0f),
   m_read_head(0.0f),
-  m_gain(0.0f)
+  m_gain(0.0f),
+  m_start_offset(0),
+  m_effective_end(nullptr),
+  m_sample_peak(0),
+  m_gain_q16(0),
+  m_envelope(),
+  m_envelope_gain(ENVELOPE_FULL_GAIN),
+  m_gate_remaining(0),
+  m_fade_tail(),
+  m_fade_length(0)
 {
 }
 
-int16_t SAMPLE_PLAYER_EFFECT::read_sample_linear_fp() const
+// renders until the end of the block or the sample, returns the number of samples rendered
+template< typename READER >
+int SAMPLE_PLAYER_EFFECT::render( READER& reader, int16_t* dest, int num_samples )
 {
-  // linearly interpolate between the current sample and its neighbour
-  // (previous neighbour if frac is less than 0.5, otherwise next)
-  const int int_part   = m_read_head.trunc_to_int32();
-  const FIXED_POINT frac_part( m_read_head - int_part );
-  
-  const int16_t curr_samp   = m_sample_data[ int_part ];
-  
-  if( frac_part < FIXED_POINT_HALF )
-  {
-    int prev        = int_part - 1;
-    if( prev < 0 )
+  for( int i = 0; i < num_samples; ++i )
+  {
+    const int head_int = m_read_head.trunc_to_int32();
+    if( head_int >= m_sample_length )
     {
-      // at the beginning of the buffer, assume next sample was the same and use that (e.g. no interpolation)
-      return curr_samp;
+      return i;
     }
-    
-    const FIXED_POINT t     = frac_part * FIXED_POINT_TWO;
-    
-    const int16_t prev_samp = m_sample_data[ prev ];
 
-    FIXED_POINT lerp_samp   = lerp<FIXED_POINT >( FIXED_POINT(prev_samp), FIXED_POINT(curr_samp), t ); 
-        
-    return lerp_samp.trunc_to_int16();
+    reader.prepare( min_val( head_int + 1, m_sample_length - 1 ) );
+    dest[i] = SAMPLE_INTERPOLATION::read_sample_cubic_fp( reader, m_read_head, m_sample_length, m_gain );
+    m_read_head += m_speed;
   }
-  else
+
+  return num_samples;
+}
+
+// holds full gain until the gate closes, then ramps each block towards the next step of the decay
+void SAMPLE_PLAYER_EFFECT::apply_envelope( int16_t* dest, int num_samples )
+{
+  if( m_gate_remaining >= static_cast<uint32_t>( num_samples ) )
   {
-    int next        = int_part + 1;
-    if( next >= m_sample_length )
-    {
-      // at the end of the buffer, assume next sample was the same and use that (e.g. no interpolation)
-      return curr_samp;
-    }
-    
-    const FIXED_POINT t     = ( frac_part - FIXED_POINT_HALF ) * FIXED_POINT_TWO;
-    
-    const int16_t next_samp = m_sample_data[ next ];
-    
-    FIXED_POINT lerp_samp   = lerp<FIXED_POINT>( FIXED_POINT(curr_samp), FIXED_POINT(next_samp), t ) * m_gain;
-     
-    return lerp_samp.trunc_to_int16();
+    m_gate_remaining -= num_samples;
+    return;
   }
+
+  const int ramp_start      = m_gate_remaining;
+  m_gate_remaining          = 0;
+
+  const uint32_t end_gain   = ( m_envelope_gain * m_envelope.m_decay_per_block ) >> 16;
+  const int32_t step        = ( static_cast<int32_t>( end_gain ) - static_cast<int32_t>( m_envelope_gain ) ) / ( num_samples - ramp_start );
+  int32_t gain              = m_envelope_gain;
+  for( int i = ramp_start; i < num_samples; ++i )
+  {
+    dest[i]                 = ( dest[i] * gain ) >> 16;
+    gain                   += step;
+  }
+  m_envelope_gain           = end_gain;
 }
 
-int16_t SAMPLE_PLAYER_EFFECT::read_sample_cubic_fp() const
+// true once the rest of the sample, at the current gain, is below EFFECTIVE_END_THRESHOLD
+bool SAMPLE_PLAYER_EFFECT::inaudible() const
 {
-  const int int_part   = m_read_head.trunc_to_int32();
-  const FIXED_POINT frac_part( m_read_head - int_part );
-  
-  FIXED_POINT p0;
-  if( int_part >= 2 )
+  const uint32_t gain = ( m_gain_q16 * m_envelope_gain ) >> 16;
+  if( ( ( m_sample_peak * gain ) >> 16 ) < static_cast<uint32_t>( EFFECTIVE_END_THRESHOLD ) )
   {
-    p0                        = m_sample_data[ int_part - 2 ];
+    return true;
   }
-  else
+
+  // each level halves the gain
+  int level = 0;
+  while( level < EFFECTIVE_END_LEVELS - 1 && gain <= ( 0x10000u >> ( level + 1 ) ) )
   {
-    // at the beginning of the buffer, assume previous sample was the same
-    p0                        = m_sample_data[ 0 ];
+    ++level;
   }
-  
-  FIXED_POINT p1;
-  if( int_part <= 2 )
+  return static_cast<uint32_t>( m_read_head.trunc_to_int32() ) >= m_effective_end[level];
+}
+
+// renders with whichever reader the sample needs, returns the number of samples rendered
+int SAMPLE_PLAYER_EFFECT::render_sample( int16_t* dest, int num_samples )
+{
+  int rendered;
+#ifdef SD_KITS
+  if( m_stream != nullptr )
   {
-    // reuse p0
-    p1                        = p0;
+    rendered = render( *m_stream, dest, num_samples );
+    m_stream->set_read_position( m_read_head.trunc_to_int32() );
+    if( m_stream->take_underrun() )
+    {
+      SAMPLE_STREAMER::count_underrun();
+    }
+    if( rendered < num_samples )
+    {
+      m_stream->release();
+      m_stream = nullptr;
+    }
   }
   else
+#endif
+  if( m_sample_encoding == SAMPLE_FORMAT_PCM_16 )
   {
-    p1                        = m_sample_data[ int_part - 1 ];
-  }
-  
-  FIXED_POINT p2;
-  p2                          = m_sample_data[ int_part ];
-  
-  FIXED_POINT p3;
-  if( int_part < m_sample_length - 1)
-  {
-    p3                        = m_sample_data[ int_part + 1 ];
+    rendered = render( m_pcm_reader, dest, num_samples );
   }
   else
   {
-    p3                        = p2;
+    rendered = render( m_decoder, dest, num_samples );
+
+#ifdef SHOW_DECODE_PERF
+    const uint32_t cycles = m_decoder.take_decode_cycles();
+    s_decode_cycles      += cycles;
+    s_max_decode_cycles   = max_val( s_max_decode_cycles, cycles );
+    ++s_decoded_blocks;
+#endif
   }
-  
-  const FIXED_POINT t         = lerp<FIXED_POINT>( FIXED_POINT(0.33333f), FIXED_POINT(0.66666f), frac_part );
-  
-  const FIXED_POINT sampf     = cubic_interpolation<FIXED_POINT>( p0, p1, p2, p3, t ) * m_gain;
-  
-  return sampf.trunc_to_int16();
+
+  return rendered;
 }
-  
+
 void SAMPLE_PLAYER_EFFECT::update()
 {
-  if( playing() )
+  if( playing() || m_fade_length > 0 )
   {
     audio_block_t* block = allocate();
 
     if( block != nullptr )
     {
-      //Serial.print("*Speed:");
-      //Serial.print(m_speed.to_float());
-      //Serial.print(" Read head:");
-      //Serial.println(m_read_head.to_float());
-      for( int i = 0; i < AUDIO_BLOCK_SAMPLES; ++i )
+      int num_samples = 0;
+      int rendered    = 0;
+      if( playing() )
       {
-        const int head_int = m_read_head.trunc_to_int32();
-        if( head_int < m_sample_length )
-        {
-          block->data[i] = read_sample_cubic_fp();
-          m_read_head += m_speed;
-        }
-        else
+        // silence until the trigger point within this block
+        memset( block->data, 0, m_start_offset * sizeof(int16_t) );
+
+        num_samples   = AUDIO_BLOCK_SAMPLES - m_start_offset;
+        rendered      = render_sample( block->data + m_start_offset, num_samples );
+
+        if( m_envelope.m_active )
         {
-          // reached the end of the sample
-          memset( block->data + i, 0, (AUDIO_BLOCK_SAMPLES - i) * sizeof(int16_t) );
-          break;
+          apply_envelope( block->data + m_start_offset, rendered );
         }
+
+        // reached the end of the sample
+        memset( block->data + m_start_offset + rendered, 0, (num_samples - rendered) * sizeof(int16_t) );
+
+#ifdef MEASURE_TRIGGER_LATENCY
+        report_first_sample( block->data );
+#endif
+
+        m_start_offset = 0;
+      }
+      else
+      {
+        memset( block->data, 0, AUDIO_BLOCK_SAMPLES * sizeof(int16_t) );
+      }
+
+      // the end of the sound this voice was playing before it was stolen
+      for( int i = 0; i < m_fade_length; ++i )
+      {
+        block->data[i] = clamp<int32_t>( block->data[i] + m_fade_tail[i], INT16_MIN, INT16_MAX );
       }
+      m_fade_length = 0;
 
       transmit( block, 0 );
 
       release( block );
+
+      // free the voice as soon as nothing more would be heard
+      if( playing() && ( rendered < num_samples || inaudible() ) )
+      {
+        stop();
+      }
     }
   }
 }
 
-void SAMPLE_PLAYER_EFFECT::play( const uint16_t* sample_data, int sample_length, float speed, float gain )
+#ifdef MEASURE_TRIGGER_LATENCY
+void SAMPLE_PLAYER_EFFECT::report_first_sample( const int16_t* data ) const
 {
-  m_sample_data   = sample_data;
-  m_sample_length = sample_length;
-  m_speed         = FIXED_POINT(speed);
-  m_read_head     = FIXED_POINT_ZERO;
-  m_gain          = FIXED_POINT(gain);
+  for( int i = m_start_offset; i < AUDIO_BLOCK_SAMPLES; ++i )
+  {
+    if( data[i] != 0 )
+    {
+      // when it leaves the DAC, not when it's rendered
+      const uint32_t offset_us = ( i * 1000000 ) / static_cast<int32_t>( AUDIO_SAMPLE_RATE_EXACT + 0.5f );
+      TRIGGER_LATENCY::output( this, AUDIO_CLOCK::block_time_us() + AUDIO_CLOCK::OUTPUT_LATENCY_US + offset_us );
+      return;
+    }
+  }
+}
+#endif // MEASURE_TRIGGER_LATENCY
+
+// renders the next few milliseconds of the current sound with a ramp down, to mix into the next block
+// (added to any tail not yet mixed, from a steal or choke earlier in the same block)
+void SAMPLE_PLAYER_EFFECT::capture_fade_tail()
+{
+  // not heard yet if it hasn't rendered its first block
+  if( !playing() || m_read_head == FIXED_POINT_ZERO )
+  {
+    return;
+  }
+
+  std::array<int16_t, FADE_SAMPLES> tail;
+  const int rendered        = render_sample( tail.data(), FADE_SAMPLES );
+  const int32_t start_gain  = m_envelope.m_active ? m_envelope_gain : ENVELOPE_FULL_GAIN;
+  const int32_t step        = start_gain / FADE_SAMPLES;
+  int32_t gain              = start_gain;
+  for( int i = 0; i < rendered; ++i )
+  {
+    const int32_t faded     = ( tail[i] * gain ) >> 16;
+    const int32_t pending   = i < m_fade_length ? m_fade_tail[i] : 0;
+    m_fade_tail[i]          = clamp<int32_t>( pending + faded, INT16_MIN, INT16_MAX );
+    gain                   -= step;
+  }
+  m_fade_length             = max_val( m_fade_length, rendered );
+}
+
+void SAMPLE_PLAYER_EFFECT::play( const SAMPLE_BANK_ENTRY& sample, float speed, float gain, int start_offset, const VOICE_ENVELOPE& envelope )
+{
+#ifdef MEASURE_TRIGGER_LATENCY
+  TRIGGER_LATENCY::play( this, micros() );
+#endif
+
+  // the audio update would otherwise render this voice while it's half way through restarting
+  AUDIO_NO_INTERRUPTS no_interrupts;
+
+  // stealing a playing voice, fade the old sound out rather than cutting it mid waveform
+  capture_fade_tail();
+
+  m_sample_data     = sample.m_data;
+  m_sample_length   = sample.m_length;
+  m_sample_encoding = sample_format_encoding( sample.m_format );
+  // step through lower rate samples more slowly so they play at the right pitch
+  m_speed           = FIXED_POINT( speed * ( sample.m_sample_rate / static_cast<float>(AUDIO_SAMPLE_RATE_EXACT) ) );
+  m_read_head       = FIXED_POINT_ZERO;
+  m_gain            = FIXED_POINT(gain);
+  m_start_offset    = start_offset;
+  m_effective_end   = sample.m_effective_end;
+  m_sample_peak     = sample.m_peak;
+  m_gain_q16        = static_cast<uint32_t>( clamp( gain, 0.0f, 1.0f ) * ENVELOPE_FULL_GAIN );
+  m_envelope        = envelope;
+  m_envelope_gain   = ENVELOPE_FULL_GAIN;
+  m_gate_remaining  = envelope.m_gate_samples;
+
+  if( m_sample_encoding == SAMPLE_FORMAT_PCM_16 )
+  {
+    m_pcm_reader.m_data = sample.m_data;
+  }
+  else
+  {
+    m_decoder.start( sample );
+  }
+
+#ifdef SD_KITS
+  if( m_stream != nullptr )
+  {
+    m_stream->release();
+    m_stream = nullptr;
+  }
+  if( sample.m_resident_length < sample.m_length )
+  {
+    m_stream = SAMPLE_STREAMER::claim( sample, static_cast<uint32_t>( m_speed.to_float() * 256.0f ) );
+    if( m_stream == nullptr )
+    {
+      // no stream free, just play the resident part
+      m_sample_length = sample.m_resident_length;
+      SAMPLE_STREAMER::count_underrun();
+    }
+  }
+#endif
 }
 
 void SAMPLE_PLAYER_EFFECT::stop()
 {
+#ifdef SD_KITS
+  if( m_stream != nullptr )
+  {
+    m_stream->release();
+    m_stream = nullptr;
+  }
+#endif
   m_sample_data   = nullptr;
   m_sample_length = 0;
   m_read_head     = FIXED_POINT_ZERO;
   m_gain          = FIXED_POINT_ONE;
+  m_start_offset  = 0;
+  m_envelope      = VOICE_ENVELOPE();
 }
 
+void SAMPLE_PLAYER_EFFECT::fade_out()
+{
+  AUDIO_NO_INTERRUPTS no_interrupts;
+  capture_fade_tail();
+  stop();
+}
+
+#ifdef SHOW_DECODE_PERF
+uint32_t SAMPLE_PLAYER_EFFECT::s_decode_cycles     = 0;
+uint32_t SAMPLE_PLAYER_EFFECT::s_max_decode_cycles = 0;
+uint32_t SAMPLE_PLAYER_EFFECT::s_decoded_blocks    = 0;
+
+void SAMPLE_PLAYER_EFFECT::print_decode_perf()
+{
+  __disable_irq();
+  const uint32_t cycles     = s_decode_cycles;
+  const uint32_t max_cycles = s_max_decode_cycles;
+  const uint32_t blocks     = s_decoded_blocks;
+  s_decode_cycles           = 0;
+  s_max_decode_cycles       = 0;
+  s_decoded_blocks          = 0;
+  __enable_irq();
+
+  Serial.print( "Decode cycles per block avg:" );
+  Serial.print( blocks > 0 ? cycles / blocks : 0 );
+  Serial.print( " max:" );
+  Serial.print( max_cycles );
+  Serial.print( " blocks:" );
+  Serial.println( blocks );
+}
+#endif
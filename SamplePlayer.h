@@ -1,37 +1,116 @@
 #pragma once
 
+#include <array>
 #include <Audio.h>
 #include "FixedPoint.h"
+#include "SampleBankEntry.h"
+#include "SampleDecoder.h"
+#include "SampleStream.h"
 #include "Util.h"
 
 /////////////////////////////////////////////////////////
 
 constexpr int           SEMI_TONE_RANGE( 3.3f * 12 );
 
+// keeps the audio update from running for the scope, unlike AudioNoInterrupts()/AudioInterrupts() it can be nested
+struct AUDIO_NO_INTERRUPTS
+{
+  const bool            m_was_enabled;
+
+  AUDIO_NO_INTERRUPTS() :
+    m_was_enabled( NVIC_IS_ENABLED( IRQ_SOFTWARE ) )
+  {
+    AudioNoInterrupts();
+  }
+
+  ~AUDIO_NO_INTERRUPTS()
+  {
+    if( m_was_enabled )
+    {
+      AudioInterrupts();
+    }
+  }
+};
+
+// optional amplitude envelope, full gain for the gate time then an exponential decay
+struct VOICE_ENVELOPE
+{
+  bool                  m_active          = false;
+  uint32_t              m_gate_samples    = 0;
+  uint32_t              m_decay_per_block = 0;  // Q16 gain multiplier each block after the gate, 0 cuts the voice within a block
+
+  static VOICE_ENVELOPE from_times( int gate_ms, int decay_ms );   // decay_ms is the time to fall by 60dB, both 0 for no envelope
+};
+
 class SAMPLE_PLAYER_EFFECT : public AudioStream
 {
+  static constexpr int  FADE_SAMPLES      = 64;   // ~1.5ms fade out of a stolen voice
+
   audio_block_t*        m_input_queue_array[1];
 
-  const uint16_t*       m_sample_data;
+  const int16_t*        m_sample_data;
   int                   m_sample_length;
+  uint8_t               m_sample_encoding;
+
+  PCM_READER            m_pcm_reader;
+  SAMPLE_DECODER        m_decoder;          // for compressed samples
+#ifdef SD_KITS
+  SAMPLE_STREAM*        m_stream;           // for samples streamed from the SD card
+#endif
 
   FIXED_POINT           m_speed;
   FIXED_POINT           m_read_head;
   FIXED_POINT           m_gain;
 
-  //int16_t               read_sample_linear() const;
-  int16_t               read_sample_linear_fp() const;
-  int16_t               read_sample_cubic_fp() const;
+  int                   m_start_offset;     // sample within the next block to start rendering from
+
+  const uint32_t*       m_effective_end;    // of the sample at each gain level, see EFFECTIVE_END_LEVELS
+  int16_t               m_sample_peak;
+  uint32_t              m_gain_q16;
+
+  VOICE_ENVELOPE        m_envelope;
+  uint32_t              m_envelope_gain;    // Q16, 0xFFFF is full gain
+  uint32_t              m_gate_remaining;   // samples before the decay starts
+
+  std::array<int16_t, FADE_SAMPLES> m_fade_tail;  // the previous sound faded out, mixed into the next block
+  int                   m_fade_length;
+
+#ifdef SHOW_DECODE_PERF
+  static uint32_t       s_decode_cycles;
+  static uint32_t       s_max_decode_cycles;
+  static uint32_t       s_decoded_blocks;
+#endif
+
+  template< typename READER >
+  int                   render( READER& reader, int16_t* dest, int num_samples );
+  int                   render_sample( int16_t* dest, int num_samples );
+  void                  apply_envelope( int16_t* dest, int num_samples );
+  void                  capture_fade_tail();
+#ifdef MEASURE_TRIGGER_LATENCY
+  void                  report_first_sample( const int16_t* data ) const;
+#endif
+  bool                  inaudible() const;
 
   public:
 
   SAMPLE_PLAYER_EFFECT();
   virtual void          update() override;
 
-  void                  play( const uint16_t* sample_data, int sample_length, float speed, float gain );
+  void                  play( const SAMPLE_BANK_ENTRY& sample, float speed, float gain, int start_offset = 0, const VOICE_ENVELOPE& envelope = VOICE_ENVELOPE() );
   void                  stop();
+  void                  fade_out();         // stop over the next ~1.5ms rather than instantly
+
+  // play() and fade_out() render the end of the old sound, so they hold off the audio update while they run
 
   inline bool           playing() const                 { return m_sample_data != nullptr; }
+  inline bool           playing_from( const void* begin, const void* end ) const
+  {
+    return m_sample_data >= begin && m_sample_data < end;
+  }
+
+#ifdef SHOW_DECODE_PERF
+  static void           print_decode_perf();
+#endif
 };
 
 /////////////////////////////////////////////////////////
@@ -44,26 +123,21 @@ class POLYPHONIC_SAMPLE_PLAYER
   int                   m_num_voices;
   int                   m_next_voice;
 
-  const uint16_t*       m_sample_data;
-  int                   m_sample_length;
+  const SAMPLE_BANK_ENTRY* m_sample;
 
  public:
 
-  POLYPHONIC_SAMPLE_PLAYER(const uint16_t* sample_data) :
+  POLYPHONIC_SAMPLE_PLAYER( const SAMPLE_BANK_ENTRY& sample ) :
     m_num_voices(0),
     m_next_voice(0),
-    m_sample_data( sample_data + 2 ),
-    m_sample_length(0)
+    m_sample( &sample )
   {
-    const uint32_t header = (reinterpret_cast<const uint32_t*>(sample_data))[0];
-    m_sample_length       = header & 0xFFFFFF;
-
-    const int rate_code   = header >> 24;
-    
-    Serial.print( "sample length:");
-    Serial.print(m_sample_length);
-    Serial.print( " rate code:0x");
-    Serial.println(rate_code, HEX);
+  }
+
+  // playing voices carry on with the previous sample
+  void                  set_sample( const SAMPLE_BANK_ENTRY& sample )
+  {
+    m_sample = &sample;
   }
 
   void                  add_sample_player( SAMPLE_PLAYER_EFFECT& sample_player )
@@ -76,11 +150,20 @@ class POLYPHONIC_SAMPLE_PLAYER
     m_sample_players[ m_num_voices++ ] = &sample_player;
   }
 
-  void                  play( float speed, float gain )
+  void                  play( float speed, float gain, int start_offset, const VOICE_ENVELOPE& envelope )
   {
+    // voices stop once they become inaudible, prefer a free one to cutting one off
+    for( int vi = 0; vi < m_num_voices && m_sample_players[ m_next_voice ]->playing(); ++vi )
+    {
+      if( ++m_next_voice == m_num_voices )
+      {
+        m_next_voice = 0;
+      }
+    }
+
+    // a stolen voice fades out its old sound as the new one starts
     SAMPLE_PLAYER_EFFECT& sample_player = *m_sample_players[ m_next_voice ];
-    sample_player.stop();
-    sample_player.play( m_sample_data, m_sample_length, speed, gain );
+    sample_player.play( *m_sample, speed, gain, start_offset, envelope );
 
     if( ++m_next_voice == m_num_voices )
     {
@@ -88,7 +171,7 @@ class POLYPHONIC_SAMPLE_PLAYER
     }
   }
 
-  void                  play_at_pitch( int semitone, float gain )
+  void                  play_at_pitch( int semitone, float gain, int start_offset, const VOICE_ENVELOPE& envelope )
   {
     // semitone 0 = 0.5x speed
     // semitone 1 = 1x speed
@@ -98,7 +181,7 @@ class POLYPHONIC_SAMPLE_PLAYER
     const int offset_semitone = semitone - semitone_offset;
     const float speed = powf( 2.0f, offset_semitone / 12.0f );
 
-    play( speed, gain );
+    play( speed, gain, start_offset, envelope );
   }
 
   void                play_at_quantised_pitch( int semitone )
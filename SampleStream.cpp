@@ -0,0 +1,170 @@
+#include "Util.h"
+#include "SampleStream.h"
+#include "TimedSection.h"
+
+#include <SD.h>
+
+SAMPLE_STREAM::SAMPLE_STREAM() :
+  m_buffers(),
+  m_buffer_chunk{ -1, -1 },
+  m_sample(nullptr),
+  m_in_use(false),
+  m_generation(0),
+  m_next_chunk(0),
+  m_read_position(0),
+  m_speed_fp(0),
+  m_underrun(false)
+{
+}
+
+void SAMPLE_STREAM::start( const SAMPLE_BANK_ENTRY& sample, uint32_t speed_fp )
+{
+  m_generation      = m_generation + 1;
+  m_sample          = &sample;
+  m_speed_fp        = max_val<uint32_t>( speed_fp, 1 );
+  m_read_position   = 0;
+  m_next_chunk      = 0;
+  m_underrun        = false;
+  for( volatile int32_t& chunk : m_buffer_chunk )
+  {
+    chunk           = -1;
+  }
+  m_in_use          = true;
+}
+
+void SAMPLE_STREAM::release()
+{
+  m_in_use          = false;
+  m_generation      = m_generation + 1;
+}
+
+bool SAMPLE_STREAM::needs_fill() const
+{
+  if( !m_in_use )
+  {
+    return false;
+  }
+
+  const uint32_t chunk_start = m_sample->m_resident_length + ( m_next_chunk * CHUNK_SAMPLES );
+  return chunk_start < m_sample->m_length && m_buffer_chunk[ m_next_chunk % NUM_BUFFERS ] < 0;
+}
+
+uint32_t SAMPLE_STREAM::output_samples_until_needed() const
+{
+  const uint32_t chunk_start = m_sample->m_resident_length + ( m_next_chunk * CHUNK_SAMPLES );
+  const uint32_t position    = m_read_position;
+  if( chunk_start <= position )
+  {
+    return 0;
+  }
+  return ( ( chunk_start - position ) << 8 ) / m_speed_fp;
+}
+
+bool SAMPLE_STREAM::fill()
+{
+  const uint32_t generation = m_generation;
+  const int32_t chunk       = m_next_chunk;
+  const int buffer          = chunk % NUM_BUFFERS;
+
+  File& file                = *m_sample->m_stream_file;
+  if( !file.seek( m_sample->m_stream_offset + ( chunk * SD_KIT_SECTOR_BYTES ) ) )
+  {
+    return false;
+  }
+  const int bytes           = file.read( m_buffers[buffer].data(), SD_KIT_SECTOR_BYTES );
+
+  // the voice may have moved on to another sample while reading
+  __disable_irq();
+  const bool current        = generation == m_generation;
+  if( current && bytes > 0 )
+  {
+    m_buffer_chunk[buffer]  = chunk;
+    m_next_chunk            = chunk + 1;
+  }
+  __enable_irq();
+
+  return bytes > 0;
+}
+
+bool SAMPLE_STREAM::take_underrun()
+{
+  const bool underrun = m_underrun;
+  m_underrun          = false;
+  return underrun;
+}
+
+void SAMPLE_STREAM::prepare( int index )
+{
+  // the interpolator reads 3 samples behind the index, once they're past a buffer it can be refilled
+  const int oldest_needed = index - 3 - static_cast<int>( m_sample->m_resident_length );
+  if( oldest_needed < 0 )
+  {
+    return;
+  }
+
+  const int oldest_chunk = oldest_needed / CHUNK_SAMPLES;
+  for( volatile int32_t& chunk : m_buffer_chunk )
+  {
+    if( chunk >= 0 && chunk < oldest_chunk )
+    {
+      chunk = -1;
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////
+
+std::array<SAMPLE_STREAM, SAMPLE_STREAMER::MAX_STREAMS> SAMPLE_STREAMER::s_streams;
+volatile uint32_t SAMPLE_STREAMER::s_underruns = 0;
+
+SAMPLE_STREAM* SAMPLE_STREAMER::claim( const SAMPLE_BANK_ENTRY& sample, uint32_t speed_fp )
+{
+  for( SAMPLE_STREAM& stream : s_streams )
+  {
+    if( !stream.m_in_use )
+    {
+      stream.start( sample, speed_fp );
+      return &stream;
+    }
+  }
+  return nullptr;
+}
+
+void SAMPLE_STREAMER::count_underrun()
+{
+  s_underruns = s_underruns + 1;
+}
+
+uint32_t SAMPLE_STREAMER::underruns()
+{
+  return s_underruns;
+}
+
+void SAMPLE_STREAMER::update()
+{
+  ADD_TIMED_SECTION( STREAM_FILL );
+
+  for( int read = 0; read < MAX_READS_PER_UPDATE; ++read )
+  {
+    // earliest deadline first
+    SAMPLE_STREAM* most_urgent  = nullptr;
+    uint32_t most_urgent_time   = 0;
+    for( SAMPLE_STREAM& stream : s_streams )
+    {
+      if( stream.needs_fill() )
+      {
+        const uint32_t time     = stream.output_samples_until_needed();
+        if( most_urgent == nullptr || time < most_urgent_time )
+        {
+          most_urgent           = &stream;
+          most_urgent_time      = time;
+        }
+      }
+    }
+
+    if( most_urgent == nullptr || !most_urgent->fill() )
+    {
+      return;
+    }
+  }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <Arduino.h>
+
+#include "CompileSwitches.h"
+#include "SampleBankEntry.h"
+
+/////////////////////////////////////////////////////////
+
+// the streamed part of a sample, read from the SD card a sector at a time into a double buffer while
+// the voice plays the resident part, used as the sample reader by SAMPLE_PLAYER_EFFECT
+class SAMPLE_STREAM
+{
+  static constexpr int  CHUNK_SAMPLES                                   = SD_KIT_SECTOR_BYTES / sizeof(int16_t);
+  static constexpr int  NUM_BUFFERS                                     = 2;
+
+  std::array<std::array<int16_t, CHUNK_SAMPLES>, NUM_BUFFERS> m_buffers;
+  volatile int32_t      m_buffer_chunk[NUM_BUFFERS];  // chunk in each buffer, -1 when empty - only filled by fill(), only emptied by prepare()
+
+  const SAMPLE_BANK_ENTRY* m_sample;
+  volatile bool         m_in_use;
+  volatile uint32_t     m_generation;       // changes when the stream is claimed, so fill() can't finish a read for the previous sample
+  volatile int32_t      m_next_chunk;       // next to fill
+  volatile uint32_t     m_read_position;    // of the voice, for the deadline
+  uint32_t              m_speed_fp;         // samples per output sample, 8 fractional bits
+  mutable bool          m_underrun;
+
+  friend class SAMPLE_STREAMER;
+
+  public:
+
+  SAMPLE_STREAM();
+
+  void                  start( const SAMPLE_BANK_ENTRY& sample, uint32_t speed_fp );
+  void                  release();
+
+  bool                  needs_fill() const;
+  uint32_t              output_samples_until_needed() const;
+  bool                  fill();
+
+  void                  set_read_position( uint32_t position )          { m_read_position = position; }
+  bool                  take_underrun();
+
+  // reader interface for the interpolator, indices must not go backwards
+  void                  prepare( int index );
+  inline int16_t        operator[]( int index ) const
+  {
+    if( index < static_cast<int>( m_sample->m_resident_length ) )
+    {
+      return m_sample->m_data[index];
+    }
+
+    const int stream_index  = index - m_sample->m_resident_length;
+    const int chunk         = stream_index / CHUNK_SAMPLES;
+    const int buffer        = chunk % NUM_BUFFERS;
+    if( m_buffer_chunk[buffer] != chunk )
+    {
+      // not read from the SD card in time
+      m_underrun            = true;
+      return 0;
+    }
+    return m_buffers[buffer][ stream_index % CHUNK_SAMPLES ];
+  }
+};
+
+/////////////////////////////////////////////////////////
+
+// shares a few streams between all the voices, and fills their buffers from loop(), most urgent first
+class SAMPLE_STREAMER
+{
+  static constexpr int  MAX_STREAMS                                     = 2;
+  static constexpr int  MAX_READS_PER_UPDATE                            = 2;
+
+  static std::array<SAMPLE_STREAM, MAX_STREAMS> s_streams;
+  static volatile uint32_t s_underruns;
+
+  public:
+
+  static SAMPLE_STREAM* claim( const SAMPLE_BANK_ENTRY& sample, uint32_t speed_fp );   // nullptr when all the streams are in use
+  static void           count_underrun();
+  static uint32_t       underruns();
+
+  static void           update();     // call from loop()
+};
+
+/////////////////////////////////////////////////////////
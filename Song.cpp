@@ -0,0 +1,79 @@
+#include "Song.h"
+
+bool SONG::read( const char* filename, int num_patterns )
+{
+  m_num_entries = 0;
+
+  File song_file = SD.open(filename, FILE_READ);
+
+  if( !song_file )
+  {
+    return false;
+  }
+
+  DEBUG_TEXT("Loading:")
+  DEBUG_TEXT_LINE(filename);
+
+  // entries are {pattern,repeats} or {pattern,repeats,f}, separated by commas or new lines
+  while( song_file.available() > 0 && m_num_entries < MAX_ENTRIES )
+  {
+    if( song_file.read() != '{' )
+    {
+      continue;
+    }
+
+    const int BUFFER_SIZE = 32;
+    char buffer[BUFFER_SIZE];
+    int bi = 0;
+    char c;
+    while( song_file.available() > 0 && (c = song_file.read()) != '}' && bi < BUFFER_SIZE - 1 )
+    {
+      buffer[bi++] = c;
+    }
+    buffer[bi] = '\0';
+
+    char* field = strtok( buffer, ", " );
+    const int pattern = field != nullptr ? atoi( field ) : 0;
+    if( pattern < 1 || pattern > num_patterns )
+    {
+      // every pattern is loaded up front, so switching can't stall
+      DEBUG_TEXT("Song pattern not loaded:");
+      DEBUG_TEXT_LINE(pattern);
+      continue;
+    }
+
+    field = strtok( nullptr, ", " );
+    const int repeats = field != nullptr ? atoi( field ) : 1;
+
+    field = strtok( nullptr, ", " );
+    const bool fill = field != nullptr && field[0] == 'f';
+
+    ENTRY& entry    = m_entries[m_num_entries++];
+    entry.m_pattern = pattern - 1;
+    entry.m_fill    = fill;
+    entry.m_repeats = clamp( repeats, 1, 255 );
+
+    DEBUG_TEXT("Song{");
+    DEBUG_TEXT(pattern);
+    DEBUG_TEXT(",");
+    DEBUG_TEXT(entry.m_repeats);
+    DEBUG_TEXT_LINE(fill ? ",f} " : "} ");
+  }
+
+  return m_num_entries > 0;
+}
+
+bool SONG::active() const
+{
+  return m_num_entries > 0;
+}
+
+int SONG::num_entries() const
+{
+  return m_num_entries;
+}
+
+const SONG::ENTRY& SONG::entry( int index ) const
+{
+  return m_entries[index];
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <array>
+#include "Util.h"
+
+////////////////////////////////////////////////////////////
+// an arrangement of patterns, compiled from a song file into a table of entries
+class SONG
+{
+public:
+
+  struct ENTRY
+  {
+    uint8_t                                               m_pattern     : 7;
+    uint8_t                                               m_fill        : 1;    // play the last repeat as a fill
+    uint8_t                                               m_repeats;
+  };
+
+private:
+
+  static constexpr int MAX_ENTRIES                                            = 64;
+  std::array<ENTRY, MAX_ENTRIES>                          m_entries;
+  uint8_t                                                 m_num_entries       = 0;
+
+public:
+
+  bool                                                    read( const char* filename, int num_patterns );
+
+  bool                                                    active() const;
+  int                                                     num_entries() const;
+  const ENTRY&                                            entry( int index ) const;
+};
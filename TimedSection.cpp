@@ -0,0 +1,89 @@
+#include "Util.h"
+#include "TimedSection.h"
+
+namespace
+{
+  constexpr uint32_t CYCLES_PER_US = F_CPU / 1000000;
+
+#define TIMED_SECTION_NAME( id, threshold_us ) #id,
+  const char* const SECTION_NAMES[] = { TIMED_SECTION_LIST( TIMED_SECTION_NAME ) };
+#undef TIMED_SECTION_NAME
+
+#define TIMED_SECTION_THRESHOLD( id, threshold_us ) threshold_us * CYCLES_PER_US,
+  const uint32_t SECTION_THRESHOLD_CYCLES[] = { TIMED_SECTION_LIST( TIMED_SECTION_THRESHOLD ) };
+#undef TIMED_SECTION_THRESHOLD
+}
+
+constexpr int TIMED_SECTIONS::MAX_RECORDS;
+
+std::array<uint32_t, TIMED_SECTIONS::MAX_RECORDS>           TIMED_SECTIONS::s_records   = {};
+volatile uint32_t                                           TIMED_SECTIONS::s_write_index = 0;
+uint32_t                                                    TIMED_SECTIONS::s_read_index  = 0;
+uint32_t                                                    TIMED_SECTIONS::s_dropped     = 0;
+std::array<TIMED_SECTIONS::STATS, TIMED_SECTIONS::NUM_SECTIONS> TIMED_SECTIONS::s_stats = {};
+uint32_t                                                    TIMED_SECTIONS::s_next_report_time_ms = 0;
+
+void TIMED_SECTIONS::update( uint32_t time_ms )
+{
+  const uint32_t write_index = s_write_index;
+  if( write_index - s_read_index > static_cast<uint32_t>( MAX_RECORDS ) )
+  {
+    // overwritten before we got to them
+    s_dropped     += ( write_index - s_read_index ) - MAX_RECORDS;
+    s_read_index   = write_index - MAX_RECORDS;
+  }
+
+  for( ; s_read_index != write_index; ++s_read_index )
+  {
+    const uint32_t record = s_records[ s_read_index & ( MAX_RECORDS - 1 ) ];
+    const int id          = record >> 24;
+    const uint32_t cycles = record & MAX_RECORD_CYCLES;
+    if( id >= NUM_SECTIONS )
+    {
+      continue;
+    }
+
+    STATS& stats          = s_stats[id];
+    ++stats.m_count;
+    stats.m_total_cycles += cycles;
+    stats.m_max_cycles    = max_val( stats.m_max_cycles, cycles );
+    if( cycles > SECTION_THRESHOLD_CYCLES[id] )
+    {
+      ++stats.m_over_threshold;
+    }
+  }
+
+  if( static_cast<int32_t>( time_ms - s_next_report_time_ms ) < 0 )
+  {
+    return;
+  }
+  s_next_report_time_ms = time_ms + REPORT_INTERVAL_MS;
+
+  for( int id = 0; id < NUM_SECTIONS; ++id )
+  {
+    const STATS& stats = s_stats[id];
+    if( stats.m_count == 0 )
+    {
+      continue;
+    }
+
+    Serial.print( SECTION_NAMES[id] );
+    Serial.print( " count:" );
+    Serial.print( stats.m_count );
+    Serial.print( " avg:" );
+    Serial.print( static_cast<uint32_t>( stats.m_total_cycles / stats.m_count ) / CYCLES_PER_US );
+    Serial.print( "us max:" );
+    Serial.print( stats.m_max_cycles / CYCLES_PER_US );
+    Serial.print( "us over threshold:" );
+    Serial.println( stats.m_over_threshold );
+  }
+
+  if( s_dropped > 0 )
+  {
+    Serial.print( "Timed sections dropped:" );
+    Serial.println( s_dropped );
+  }
+
+  s_stats.fill( STATS() );
+  s_dropped = 0;
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <Arduino.h>
+
+#include "CompileSwitches.h"
+
+/////////////////////////////////////////////////////
+
+// every timed section, as X( id, threshold_us ) - a section taking longer than its threshold is counted as over
+#define TIMED_SECTION_LIST( X ) \
+  X( CLOCK_TICKS,     200 )     \
+  X( PATTERN_CLOCK,   100 )     \
+  X( TRIGGER_UPDATE,  100 )     \
+  X( KIT_LOAD,        1000 )    \
+  X( STREAM_FILL,     1000 )
+
+enum class TIMED_SECTION_ID : uint8_t
+{
+#define TIMED_SECTION_ENUM( id, threshold_us ) id,
+  TIMED_SECTION_LIST( TIMED_SECTION_ENUM )
+#undef TIMED_SECTION_ENUM
+  NUM_SECTIONS
+};
+
+#define TIMED_SECTION_CONCAT_( a, b ) a##b
+#define TIMED_SECTION_CONCAT( a, b ) TIMED_SECTION_CONCAT_( a, b )
+
+// e.g. ADD_TIMED_SECTION( KIT_LOAD ); times the rest of the enclosing scope
+#ifdef SHOW_TIMED_SECTIONS
+#define ADD_TIMED_SECTION( id ) TIMED_SECTION TIMED_SECTION_CONCAT( timed_section_, __LINE__ )( TIMED_SECTION_ID::id )
+#else
+#define ADD_TIMED_SECTION( id )
+#endif
+
+/////////////////////////////////////////////////////
+
+// durations of the timed sections, written to a ring buffer as they end (from any context) and
+// read back from loop() where they're summarised and printed, so timing never prints in a hot path
+class TIMED_SECTIONS
+{
+  static constexpr int        NUM_SECTIONS          = static_cast<int>( TIMED_SECTION_ID::NUM_SECTIONS );
+  static constexpr int        MAX_RECORDS           = 64;   // power of 2
+  static constexpr int        REPORT_INTERVAL_MS    = 2000;
+  static constexpr uint32_t   MAX_RECORD_CYCLES     = 0xFFFFFF;
+
+  struct STATS
+  {
+    uint32_t                  m_count;
+    uint32_t                  m_over_threshold;
+    uint32_t                  m_max_cycles;
+    uint64_t                  m_total_cycles;
+  };
+
+  // each record is the section id in the top 8 bits and its cycles in the low 24
+  static std::array<uint32_t, MAX_RECORDS>  s_records;
+  static volatile uint32_t    s_write_index;
+  static uint32_t             s_read_index;
+  static uint32_t             s_dropped;
+
+  static std::array<STATS, NUM_SECTIONS>    s_stats;
+  static uint32_t             s_next_report_time_ms;
+
+public:
+
+  inline static void          record( TIMED_SECTION_ID id, uint32_t cycles )
+  {
+    const uint32_t record     = ( static_cast<uint32_t>( id ) << 24 ) | ( cycles < MAX_RECORD_CYCLES ? cycles : MAX_RECORD_CYCLES );
+    __disable_irq();
+    s_records[ s_write_index & ( MAX_RECORDS - 1 ) ] = record;
+    s_write_index             = s_write_index + 1;
+    __enable_irq();
+  }
+
+  static void                 update( uint32_t time_ms );   // call from loop()
+};
+
+/////////////////////////////////////////////////////
+
+struct TIMED_SECTION
+{
+  TIMED_SECTION_ID            m_id;
+  uint32_t                    m_start_cycles;
+
+  explicit TIMED_SECTION( TIMED_SECTION_ID id ) :
+    m_id( id ),
+    m_start_cycles( ARM_DWT_CYCCNT )
+  {
+  }
+
+  ~TIMED_SECTION()
+  {
+    TIMED_SECTIONS::record( m_id, ARM_DWT_CYCCNT - m_start_cycles );
+  }
+};
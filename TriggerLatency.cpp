@@ -0,0 +1,120 @@
+#include "Util.h"
+#include "TriggerLatency.h"
+
+volatile uint32_t                 TRIGGER_LATENCY::s_edge_us          = 0;
+volatile TRIGGER_LATENCY::STATE   TRIGGER_LATENCY::s_state            = TRIGGER_LATENCY::IDLE;
+uint32_t                          TRIGGER_LATENCY::s_start_us         = 0;
+uint32_t                          TRIGGER_LATENCY::s_clock_us         = 0;
+uint32_t                          TRIGGER_LATENCY::s_play_us          = 0;
+const SAMPLE_PLAYER_EFFECT*       TRIGGER_LATENCY::s_voice            = nullptr;
+uint32_t                          TRIGGER_LATENCY::s_measurements     = 0;
+uint32_t                          TRIGGER_LATENCY::s_predicted        = 0;
+uint64_t                          TRIGGER_LATENCY::s_clock_total_us   = 0;
+uint64_t                          TRIGGER_LATENCY::s_play_total_us    = 0;
+uint64_t                          TRIGGER_LATENCY::s_output_total_us  = 0;
+uint32_t                          TRIGGER_LATENCY::s_max_us           = 0;
+uint32_t                          TRIGGER_LATENCY::s_last_us          = 0;
+std::array<uint32_t, TRIGGER_LATENCY::NUM_BUCKETS> TRIGGER_LATENCY::s_histogram = {};
+
+void TRIGGER_LATENCY::edge( uint32_t time_us )
+{
+  s_edge_us = time_us;
+}
+
+void TRIGGER_LATENCY::clock( uint32_t tick_time_us, uint32_t tick_period_us, uint32_t now_us )
+{
+  // once locked the PLL can tick just before the edge it predicts, then measure from the prediction
+  const uint32_t edge_us  = s_edge_us;
+  const bool edge_first   = tick_time_us - edge_us < tick_period_us / 2;
+  s_start_us              = edge_first ? edge_us : tick_time_us;
+  s_clock_us              = now_us;
+  s_state                 = CLOCKED;
+  if( !edge_first )
+  {
+    ++s_predicted;
+  }
+}
+
+void TRIGGER_LATENCY::play( const SAMPLE_PLAYER_EFFECT* voice, uint32_t now_us )
+{
+  if( s_state == CLOCKED )
+  {
+    s_voice               = voice;
+    s_play_us             = now_us;
+    s_state               = PLAYING;
+  }
+}
+
+void TRIGGER_LATENCY::output( const SAMPLE_PLAYER_EFFECT* voice, uint32_t dac_time_us )
+{
+  if( s_state != PLAYING || voice != s_voice )
+  {
+    return;
+  }
+  s_state                 = IDLE;
+
+  const uint32_t total_us = dac_time_us - s_start_us;
+  ++s_measurements;
+  s_clock_total_us       += s_clock_us - s_start_us;
+  s_play_total_us        += s_play_us - s_clock_us;
+  s_output_total_us      += dac_time_us - s_play_us;
+  s_max_us                = max_val( s_max_us, total_us );
+  s_last_us               = total_us;
+  ++s_histogram[ min_val<uint32_t>( total_us / BUCKET_US, NUM_BUCKETS - 1 ) ];
+}
+
+uint32_t TRIGGER_LATENCY::take_last_us()
+{
+  __disable_irq();
+  const uint32_t last_us  = s_last_us;
+  s_last_us               = 0;
+  __enable_irq();
+  return last_us;
+}
+
+void TRIGGER_LATENCY::print()
+{
+  __disable_irq();
+  const uint32_t measurements = s_measurements;
+  const uint32_t predicted    = s_predicted;
+  const uint64_t clock_us     = s_clock_total_us;
+  const uint64_t play_us      = s_play_total_us;
+  const uint64_t output_us    = s_output_total_us;
+  const uint32_t max_us       = s_max_us;
+  const std::array<uint32_t, NUM_BUCKETS> histogram = s_histogram;
+  s_measurements              = 0;
+  s_predicted                 = 0;
+  s_clock_total_us            = 0;
+  s_play_total_us             = 0;
+  s_output_total_us           = 0;
+  s_max_us                    = 0;
+  s_histogram.fill( 0 );
+  __enable_irq();
+
+  if( measurements == 0 )
+  {
+    return;
+  }
+
+  Serial.print( "Trigger latency avg us edge->clock:" );
+  Serial.print( static_cast<uint32_t>( clock_us / measurements ) );
+  Serial.print( " clock->play:" );
+  Serial.print( static_cast<uint32_t>( play_us / measurements ) );
+  Serial.print( " play->DAC:" );
+  Serial.print( static_cast<uint32_t>( output_us / measurements ) );
+  Serial.print( " total:" );
+  Serial.print( static_cast<uint32_t>( ( clock_us + play_us + output_us ) / measurements ) );
+  Serial.print( " max:" );
+  Serial.print( max_us );
+  Serial.print( " from prediction:" );
+  Serial.println( predicted );
+
+  // 0.5ms buckets, the last is everything over
+  Serial.print( "Latency histogram (0.5ms):" );
+  for( uint32_t count : histogram )
+  {
+    Serial.print( " " );
+    Serial.print( count );
+  }
+  Serial.println();
+}
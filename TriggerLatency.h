@@ -0,0 +1,54 @@
+#pragma once
+
+#include <array>
+#include <Arduino.h>
+
+#include "CompileSwitches.h"
+
+class SAMPLE_PLAYER_EFFECT;
+
+/////////////////////////////////////////////////////////
+
+// measures the time from a trigger edge to the first sample of the drum it plays leaving the DAC, through each
+// stage: the edge interrupt, PATTERN_SET::clock(), SAMPLE_PLAYER_EFFECT::play() and the sample's place in its
+// block plus the output's fixed latency (AUDIO_CLOCK::OUTPUT_LATENCY_US).
+// One measurement is in flight at a time, started by each clock tick and finished by the first voice it plays.
+class TRIGGER_LATENCY
+{
+  static constexpr int      NUM_BUCKETS             = 32;     // up to 16ms, the output alone is 2 blocks
+  static constexpr int      BUCKET_US               = 500;
+
+  enum STATE : uint8_t
+  {
+    IDLE,
+    CLOCKED,
+    PLAYING
+  };
+
+  static volatile uint32_t  s_edge_us;
+  static volatile STATE     s_state;
+  static uint32_t           s_start_us;       // the edge, or the predicted edge when the PLL ticked first
+  static uint32_t           s_clock_us;
+  static uint32_t           s_play_us;
+  static const SAMPLE_PLAYER_EFFECT* s_voice;
+
+  // totals since the last print
+  static uint32_t           s_measurements;
+  static uint32_t           s_predicted;      // started from the PLL's prediction, the edge hadn't arrived
+  static uint64_t           s_clock_total_us;
+  static uint64_t           s_play_total_us;
+  static uint64_t           s_output_total_us;
+  static uint32_t           s_max_us;
+  static uint32_t           s_last_us;
+  static std::array<uint32_t, NUM_BUCKETS> s_histogram;
+
+public:
+
+  static void               edge( uint32_t time_us );
+  static void               clock( uint32_t tick_time_us, uint32_t tick_period_us, uint32_t now_us );
+  static void               play( const SAMPLE_PLAYER_EFFECT* voice, uint32_t now_us );
+  static void               output( const SAMPLE_PLAYER_EFFECT* voice, uint32_t dac_time_us );
+
+  static void               print();          // from loop(), then starts counting again
+  static uint32_t           take_last_us();   // the latest total, 0 if there's been none since the last call (for the host tests)
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <limits>
 
 #include <Audio.h>
@@ -33,37 +34,12 @@ inline bool _assert_fail( const char* assert, const char* msg )
 #define DEBUG_TEXT_LINE_MODE(x, y)
 #endif
 
-#ifdef SHOW_TIMED_SECTIONS
-#define ADD_TIMED_SECTION(x, y) TIMED_SECTION __FILE__##__LINE__(x, y)
-#else
-#define ADD_TIMED_SECTION(x, y)
-#endif
-
-struct TIMED_SECTION
+// for timing with ARM_DWT_CYCCNT
+inline void enable_cycle_counter()
 {
-  const char* m_section_name;
-  uint64_t    m_start_time;
-  uint64_t    m_threshold_us;
-
-  TIMED_SECTION( const char* section_name, uint64_t threshold_us ) :
-    m_section_name( section_name ),
-    m_start_time( micros() ),
-    m_threshold_us( threshold_us )
-  {      
-  }
-
-  ~TIMED_SECTION()
-  {
-    const uint64_t duration = micros() - m_start_time;
-    if( duration > m_threshold_us )
-    {
-      Serial.print( m_section_name );
-      Serial.print(" ");
-      Serial.print( static_cast<int>(duration) );
-      Serial.println( "us" );
-    }
-  }
-};
+  ARM_DEMCR      |= ARM_DEMCR_TRCENA;
+  ARM_DWT_CTRL   |= ARM_DWT_CTRL_CYCCNTENA;
+}
 
 /////////////////////////////////////////////////////
 
@@ -193,6 +169,41 @@ inline constexpr uint8_t reverse_byte( uint8_t byte_to_reverse )
 
 /////////////////////////////////////////////////////
 
+// xorshift32, cheap enough for the clock path and always gives the same sequence for a given seed
+class RANDOM
+{
+  uint32_t                m_state;
+
+public:
+
+  explicit RANDOM( uint32_t seed = 1 )
+  {
+    set_seed( seed );
+  }
+
+  void set_seed( uint32_t seed )
+  {
+    // zero is the one state xorshift can't leave
+    m_state               = seed != 0 ? seed : 0x9E3779B9;
+  }
+
+  uint32_t next()
+  {
+    m_state              ^= m_state << 13;
+    m_state              ^= m_state >> 17;
+    m_state              ^= m_state << 5;
+    return m_state;
+  }
+
+  // true with the given probability (in percent), avoiding a divide
+  bool chance( int percent )
+  {
+    return static_cast<int>( ( ( next() >> 16 ) * 100 ) >> 16 ) < percent;
+  }
+};
+
+/////////////////////////////////////////////////////
+
 template < typename TYPE, int CAPACITY >
 class RUNNING_AVERAGE
 {
@@ -248,6 +259,64 @@ public:
   }
 };
 
+/////////////////////////////////////////////////////
+
+// single producer, single consumer queue, safe to push from an interrupt and pop from another context (or vice versa)
+template < typename TYPE, int CAPACITY >
+class LOCKLESS_QUEUE
+{
+  static_assert( ( CAPACITY & ( CAPACITY - 1 ) ) == 0, "Capacity must be a power of 2" );
+
+  TYPE                    m_values[ CAPACITY ];
+  volatile uint32_t       m_write;      // only modified by the producer
+  volatile uint32_t       m_read;       // only modified by the consumer
+
+public:
+
+  LOCKLESS_QUEUE() :
+    m_values(),
+    m_write(0),
+    m_read(0)
+  {
+  }
+
+  bool push( const TYPE& value )
+  {
+    const uint32_t write = m_write;
+    if( write - m_read == CAPACITY )
+    {
+      // full
+      return false;
+    }
+
+    m_values[ write & ( CAPACITY - 1 ) ] = value;
+    std::atomic_signal_fence( std::memory_order_release );
+    m_write               = write + 1;
+    return true;
+  }
+
+  bool pop( TYPE& value )
+  {
+    const uint32_t read = m_read;
+    if( read == m_write )
+    {
+      // empty
+      return false;
+    }
+
+    std::atomic_signal_fence( std::memory_order_acquire );
+    value                 = m_values[ read & ( CAPACITY - 1 ) ];
+    std::atomic_signal_fence( std::memory_order_release );
+    m_read                = read + 1;
+    return true;
+  }
+
+  bool empty() const
+  {
+    return m_read == m_write;
+  }
+};
+
 //// AUDIO ////
 
 namespace DSP_UTILS
@@ -0,0 +1,283 @@
+// dsp_benchmark - times RadioDrum's inner DSP kernels on the host, across speeds, gains and block sizes
+//
+// build:  g++ -std=gnu++14 -O2 -Ihost -I.. -o dsp_benchmark dsp_benchmark.cpp
+// usage:  dsp_benchmark [--filter <text>]
+//
+// Each case runs its kernel repeatedly for a fixed time and reports the best of several repetitions, in ns per
+// call and per sample, in the style of Google Benchmark. Only cases with <text> in their name are run with --filter.
+// The numbers are the host's, use them to compare before and after a change to a kernel. BENCHMARK_DSP gives
+// the cycles on the module.
+//
+// The kernels are the ones the sketch uses: the fixed point interpolators in SampleInterpolation.h, the mixer
+// gain kernels in MultiMixer.h, DSP_UTILS' float cubic and soft clipper and the FIXED_POINT operators.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "../FixedPoint.h"
+#include "../MultiMixer.h"
+#include "../SampleDecoder.h"
+#include "../SampleInterpolation.h"
+#include "../Util.h"
+
+namespace
+{
+
+constexpr float  BENCHMARK_SPEEDS[]         = { 0.5f, 1.0f, 1.4983f, 2.0f };
+constexpr int    BENCHMARK_BLOCK_SIZES[]    = { 32, AUDIO_BLOCK_SAMPLES };
+constexpr float  BENCHMARK_GAINS[]          = { 1.0f, 0.5f, 1.5f };
+constexpr float  BENCHMARK_CLIP[]           = { 0.1f, 0.5f };
+constexpr int    DATA_LENGTH                = 1024;   // enough for a block at the fastest speed
+
+constexpr int    REPETITIONS                = 5;
+constexpr double MIN_REPETITION_TIME_S      = 0.02;
+
+int16_t          benchmark_data[ DATA_LENGTH ];
+int16_t          benchmark_block[ AUDIO_BLOCK_SAMPLES ];
+
+// results go here so the kernels can't be optimised away
+volatile int32_t benchmark_sink             = 0;
+
+const char*      filter                     = nullptr;
+
+// stops the compiler assuming memory is unchanged between calls, as Google Benchmark's ClobberMemory()
+inline void clobber_memory()
+{
+  asm volatile( "" : : : "memory" );
+}
+
+// best ns per call of the kernel
+template< typename KERNEL >
+double best_ns( KERNEL kernel )
+{
+  using CLOCK = std::chrono::steady_clock;
+
+  // enough calls to fill the repetition time
+  long iterations = 1;
+  for( ;; )
+  {
+    const CLOCK::time_point start = CLOCK::now();
+    for( long i = 0; i < iterations; ++i )
+    {
+      kernel();
+      clobber_memory();
+    }
+    const double seconds = std::chrono::duration<double>( CLOCK::now() - start ).count();
+    if( seconds >= MIN_REPETITION_TIME_S )
+    {
+      break;
+    }
+    iterations *= 2;
+  }
+
+  double best = 1.0e30;
+  for( int r = 0; r < REPETITIONS; ++r )
+  {
+    const CLOCK::time_point start = CLOCK::now();
+    for( long i = 0; i < iterations; ++i )
+    {
+      kernel();
+      clobber_memory();
+    }
+    const double ns = std::chrono::duration<double, std::nano>( CLOCK::now() - start ).count() / iterations;
+    best = std::min( best, ns );
+  }
+  return best;
+}
+
+template< typename KERNEL >
+void run( const std::string& name, int num_samples, KERNEL kernel )
+{
+  if( filter != nullptr && name.find( filter ) == std::string::npos )
+  {
+    return;
+  }
+
+  const double ns = best_ns( kernel );
+  printf( "%-58s %10.1f ns %10.3f ns/sample\n", name.c_str(), ns, ns / num_samples );
+}
+
+std::string param( const char* name, float value )
+{
+  char text[32];
+  snprintf( text, sizeof(text), "/%s:%g", name, value );
+  return text;
+}
+
+std::string samples( int num_samples )
+{
+  return "/samples:" + std::to_string( num_samples );
+}
+
+void interpolators()
+{
+  PCM_READER reader;
+  reader.m_data                 = benchmark_data;
+  const FIXED_POINT gain( 0.7f );
+
+  for( float speed : BENCHMARK_SPEEDS )
+  {
+    const FIXED_POINT speed_fp( speed );
+    for( int num_samples : BENCHMARK_BLOCK_SIZES )
+    {
+      run( "read_sample_linear_fp" + param( "speed", speed ) + samples( num_samples ), num_samples, [&]()
+      {
+        int32_t sum             = 0;
+        FIXED_POINT read_head( 1.0f );
+        for( int i = 0; i < num_samples; ++i )
+        {
+          sum                  += SAMPLE_INTERPOLATION::read_sample_linear_fp( reader, read_head, DATA_LENGTH, gain );
+          read_head            += speed_fp;
+        }
+        benchmark_sink          = sum;
+      } );
+
+      run( "read_sample_cubic_fp" + param( "speed", speed ) + samples( num_samples ), num_samples, [&]()
+      {
+        int32_t sum             = 0;
+        FIXED_POINT read_head( 1.0f );
+        for( int i = 0; i < num_samples; ++i )
+        {
+          sum                  += SAMPLE_INTERPOLATION::read_sample_cubic_fp( reader, read_head, DATA_LENGTH, gain );
+          read_head            += speed_fp;
+        }
+        benchmark_sink          = sum;
+      } );
+
+      run( "DSP_UTILS::read_sample_cubic" + param( "speed", speed ) + samples( num_samples ), num_samples, [&]()
+      {
+        int32_t sum             = 0;
+        float read_head         = 1.0f;
+        for( int i = 0; i < num_samples; ++i )
+        {
+          sum                  += DSP_UTILS::read_sample_cubic( read_head, benchmark_data, DATA_LENGTH );
+          read_head            += speed;
+        }
+        benchmark_sink          = sum;
+      } );
+    }
+  }
+}
+
+void mixer()
+{
+  for( float gain : BENCHMARK_GAINS )
+  {
+    const int32_t mult          = static_cast<int32_t>( gain * MIXER_KERNELS::UNITY_GAIN );
+
+    // the kernels work on whole blocks
+    run( "MIXER_KERNELS::apply_gain" + param( "gain", gain ) + samples( AUDIO_BLOCK_SAMPLES ), AUDIO_BLOCK_SAMPLES, [&]()
+    {
+      MIXER_KERNELS::apply_gain( benchmark_block, mult );
+    } );
+
+    run( "MIXER_KERNELS::apply_gain_then_add" + param( "gain", gain ) + samples( AUDIO_BLOCK_SAMPLES ), AUDIO_BLOCK_SAMPLES, [&]()
+    {
+      MIXER_KERNELS::apply_gain_then_add( benchmark_data, benchmark_block, mult );
+    } );
+  }
+}
+
+void soft_clip()
+{
+  for( float clip_coefficient : BENCHMARK_CLIP )
+  {
+    for( int num_samples : BENCHMARK_BLOCK_SIZES )
+    {
+      run( "DSP_UTILS::soft_clip_sample" + param( "clip", clip_coefficient ) + samples( num_samples ), num_samples, [&]()
+      {
+        int32_t sum             = 0;
+        for( int i = 0; i < num_samples; ++i )
+        {
+          sum                  += DSP_UTILS::soft_clip_sample( benchmark_data[i], clip_coefficient );
+        }
+        benchmark_sink          = sum;
+      } );
+    }
+  }
+}
+
+void fixed_point()
+{
+  constexpr int NUM_OPS         = AUDIO_BLOCK_SAMPLES;
+  const FIXED_POINT t( 0.4f );
+
+  run( "FIXED_POINT+" + samples( NUM_OPS ), NUM_OPS, [&]()
+  {
+    FIXED_POINT sum( 0.0f );
+    for( int i = 0; i < NUM_OPS; ++i )
+    {
+      sum                       = sum + FIXED_POINT( benchmark_data[i] );
+    }
+    benchmark_sink              = sum.trunc_to_int32();
+  } );
+
+  // the sign of each side takes a different path
+  for( float by : { 0.7f, -0.7f } )
+  {
+    const FIXED_POINT mult( by );
+    run( "FIXED_POINT*" + param( "by", by ) + samples( NUM_OPS ), NUM_OPS, [&]()
+    {
+      int32_t sum               = 0;
+      for( int i = 0; i < NUM_OPS; ++i )
+      {
+        sum                    += ( FIXED_POINT( benchmark_data[i] ) * mult ).trunc_to_int32();
+      }
+      benchmark_sink            = sum;
+    } );
+  }
+
+  run( "lerp<FIXED_POINT>" + samples( NUM_OPS ), NUM_OPS, [&]()
+  {
+    int32_t sum                 = 0;
+    for( int i = 0; i < NUM_OPS; ++i )
+    {
+      sum                      += lerp<FIXED_POINT>( FIXED_POINT( benchmark_data[i] ), FIXED_POINT( benchmark_data[i + 1] ), t ).trunc_to_int32();
+    }
+    benchmark_sink              = sum;
+  } );
+
+  run( "cubic_interpolation<FIXED_POINT>" + samples( NUM_OPS ), NUM_OPS, [&]()
+  {
+    int32_t sum                 = 0;
+    for( int i = 0; i < NUM_OPS; ++i )
+    {
+      sum                      += cubic_interpolation<FIXED_POINT>( FIXED_POINT( benchmark_data[i] ), FIXED_POINT( benchmark_data[i + 1] ),
+                                                                    FIXED_POINT( benchmark_data[i + 2] ), FIXED_POINT( benchmark_data[i + 3] ), t ).trunc_to_int32();
+    }
+    benchmark_sink              = sum;
+  } );
+}
+
+} // namespace
+
+int main( int argc, char** argv )
+{
+  if( argc == 3 && strcmp( argv[1], "--filter" ) == 0 )
+  {
+    filter                      = argv[2];
+  }
+  else if( argc != 1 )
+  {
+    fprintf( stderr, "usage: %s [--filter <text>]\n", argv[0] );
+    return 1;
+  }
+
+  // the same data as BENCHMARK_DSP, a full scale sine with some harmonics so every sign and magnitude gets exercised
+  for( int i = 0; i < DATA_LENGTH; ++i )
+  {
+    const float phase           = ( i * 2.0f * M_PI ) / 97.0f;
+    benchmark_data[i]           = static_cast<int16_t>( ( sinf( phase ) * 0.8f + sinf( phase * 3.0f ) * 0.15f ) * INT16_MAX );
+  }
+
+  printf( "%-58s %13s %20s\n", "Benchmark", "Time", "Time per sample" );
+  interpolators();
+  mixer();
+  soft_clip();
+  fixed_point();
+
+  return 0;
+}
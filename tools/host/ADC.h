@@ -0,0 +1,3 @@
+#pragma once
+
+// host stand-in for the ADC library, the dials are read with analogRead() (see HOST_SIM::set_analog())
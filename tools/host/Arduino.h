@@ -0,0 +1,100 @@
+#pragma once
+
+// host stand-in for the Teensy core, just enough to build the sketch on a PC for the tests in tools/host.
+// Time is simulated by HOST_SIM, nothing here waits in real time.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <cmath>
+#include <algorithm>
+
+using std::abs;
+
+typedef uint8_t             byte;
+typedef bool                boolean;
+
+#define F_CPU               96000000
+
+#define HIGH                1
+#define LOW                 0
+#define INPUT               0
+#define OUTPUT              1
+#define INPUT_PULLUP        2
+#define RISING              3
+#define FALLING             2
+#define CHANGE              4
+#define DEC                 10
+#define HEX                 16
+
+#define A7                  21
+#define A8                  22
+#define A9                  23
+
+uint32_t                    millis();
+uint32_t                    micros();
+void                        delay( uint32_t ms );
+void                        delayMicroseconds( uint32_t us );
+
+int                         analogRead( int pin );
+void                        analogWrite( int pin, int value );
+void                        digitalWrite( int pin, int value );
+int                         digitalRead( int pin );
+void                        pinMode( int pin, int mode );
+inline int                  digitalPinToInterrupt( int pin )  { return pin; }
+void                        attachInterrupt( int interrupt, void (*isr)(), int mode );
+
+// the simulation only switches context when time advances, so there's nothing to mask
+inline void                 __disable_irq()                   { }
+inline void                 __enable_irq()                    { }
+
+// only the audio update's software interrupt can be masked
+#define IRQ_SOFTWARE        70
+bool                        host_nvic_is_enabled( int irq );
+void                        host_nvic_enable( int irq, bool enable );
+#define NVIC_IS_ENABLED(n)  ( host_nvic_is_enabled( n ) )
+#define NVIC_ENABLE_IRQ(n)  ( host_nvic_enable( n, true ) )
+#define NVIC_DISABLE_IRQ(n) ( host_nvic_enable( n, false ) )
+
+// cycles at F_CPU of simulated time, updates cost nothing unless they delay
+uint32_t                    host_cycle_count();
+#define ARM_DWT_CYCCNT      ( host_cycle_count() )
+extern uint32_t             ARM_DEMCR;
+extern uint32_t             ARM_DWT_CTRL;
+#define ARM_DEMCR_TRCENA    ( 1 << 24 )
+#define ARM_DWT_CTRL_CYCCNTENA ( 1 << 0 )
+
+////////////////////////////////////////////////////////////
+// prints to stdout the way Arduino's Print does, floats to 2 decimal places
+class HOST_SERIAL
+{
+  void                      print_number( long long value, int base );
+
+public:
+
+  void                      begin( int /*baud*/ )             { }
+  int                       available()                       { return 0; }
+  int                       read()                            { return -1; }
+  explicit                  operator bool() const             { return true; }
+
+  void                      print( const char* text )         { fputs( text, stdout ); }
+  void                      print( char c )                   { fputc( c, stdout ); }
+  void                      print( int value, int base = DEC )                { print_number( value, base ); }
+  void                      print( unsigned int value, int base = DEC )       { print_number( value, base ); }
+  void                      print( long value, int base = DEC )               { print_number( value, base ); }
+  void                      print( unsigned long value, int base = DEC )      { print_number( value, base ); }
+  void                      print( long long value, int base = DEC )          { print_number( value, base ); }
+  void                      print( unsigned long long value, int base = DEC ) { print_number( value, base ); }
+  void                      print( unsigned char value, int base = DEC )      { print_number( value, base ); }
+  void                      print( double value, int digits = 2 )             { printf( "%.*f", digits, value ); }
+
+  template< typename T >
+  void                      println( T value )                { print( value ); println(); }
+  template< typename T >
+  void                      println( T value, int format )    { print( value, format ); println(); }
+  void                      println()                         { fputc( '\n', stdout ); }
+};
+
+extern HOST_SERIAL          Serial;
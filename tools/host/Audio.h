@@ -0,0 +1,190 @@
+#pragma once
+
+// host stand-in for the Teensy audio library. AudioStream follows the library: a pool of reference counted
+// blocks, updates in construction order and connections that queue a block on each input. The delay, reverb
+// and DAC output are modelled on the library's, the reverb isn't bit exact with it.
+
+#include <Arduino.h>
+#include <SD.h>
+#include <vector>
+
+#define AUDIO_BLOCK_SAMPLES       128
+#define AUDIO_SAMPLE_RATE_EXACT   44117.64706f
+#define AUDIO_SAMPLE_RATE         AUDIO_SAMPLE_RATE_EXACT
+
+typedef struct audio_block_struct
+{
+  uint8_t                   ref_count;
+  uint8_t                   reserved1;
+  uint16_t                  memory_pool_index;
+  int16_t                   data[AUDIO_BLOCK_SAMPLES];
+} audio_block_t;
+
+class AudioStream;
+
+class AudioConnection
+{
+  AudioStream&              m_src;
+  AudioStream&              m_dst;
+  uint8_t                   m_src_index;
+  uint8_t                   m_dst_index;
+  AudioConnection*          m_next_dest;
+
+  friend class AudioStream;
+
+public:
+
+  AudioConnection( AudioStream& source, unsigned char source_output, AudioStream& destination, unsigned char destination_input );
+  AudioConnection( AudioStream& source, AudioStream& destination ) :
+    AudioConnection( source, 0, destination, 0 )
+  {
+  }
+};
+
+class AudioStream
+{
+  static AudioStream*       s_first_update;
+  static audio_block_t*     s_pool;
+  static std::vector<bool>  s_pool_used;
+
+  AudioStream*              m_next_update;
+  AudioConnection*          m_destination_list;
+  const uint8_t             m_num_inputs;
+  audio_block_t**           m_input_queue;
+
+  friend class AudioConnection;
+
+protected:
+
+  bool                      active;
+
+  static audio_block_t*     allocate();
+  static void               release( audio_block_t* block );
+  void                      transmit( audio_block_t* block, unsigned char index = 0 );
+  audio_block_t*            receiveReadOnly( unsigned int index = 0 );
+  audio_block_t*            receiveWritable( unsigned int index = 0 );
+
+public:
+
+  static uint16_t           memory_used;
+  static uint16_t           memory_used_max;
+  static uint16_t           cpu_cycles_total;
+  static uint16_t           cpu_cycles_total_max;
+  static uint32_t           allocation_failures;  // host only, allocate() found the pool empty
+  static uint32_t           update_count;         // host only, updates of the whole graph
+  uint16_t                  cpu_cycles;
+  uint16_t                  cpu_cycles_max;
+
+  AudioStream( unsigned char num_inputs, audio_block_t** input_queue );
+  virtual ~AudioStream()    { }
+
+  virtual void              update() = 0;
+
+  static void               initialize_memory( audio_block_t* data, unsigned int num );
+  static void               update_all();     // the software interrupt, run by HOST_SIM after each DMA interrupt
+};
+
+#define AudioMemory( num )        ( { static audio_block_t data[num]; AudioStream::initialize_memory( data, num ); } )
+#define AudioMemoryUsage()        ( AudioStream::memory_used )
+#define AudioMemoryUsageMax()     ( AudioStream::memory_used_max )
+#define AudioMemoryUsageMaxReset() ( AudioStream::memory_used_max = AudioStream::memory_used )
+#define AudioNoInterrupts()       ( NVIC_DISABLE_IRQ( IRQ_SOFTWARE ) )
+#define AudioInterrupts()         ( NVIC_ENABLE_IRQ( IRQ_SOFTWARE ) )
+
+// cpu_cycles are counted in 16s, as the percentage of a block's time
+#define CYCLE_COUNTER_APPROX_PERCENT( n ) ( ( (n) * 1600.0f ) / ( ( F_CPU / AUDIO_SAMPLE_RATE_EXACT ) * AUDIO_BLOCK_SAMPLES ) )
+#define AudioProcessorUsage()     ( CYCLE_COUNTER_APPROX_PERCENT( AudioStream::cpu_cycles_total ) )
+#define AudioProcessorUsageMax()  ( CYCLE_COUNTER_APPROX_PERCENT( AudioStream::cpu_cycles_total_max ) )
+
+// from the library's dspinst.h
+inline int32_t signed_saturate_rshift( int32_t val, int bits, int rshift )
+{
+  const int32_t max = ( 1 << ( bits - 1 ) ) - 1;
+  const int32_t shifted = val >> rshift;
+  return shifted > max ? max : ( shifted < -max - 1 ? -max - 1 : shifted );
+}
+
+////////////////////////////////////////////////////////////
+// up to 8 taps on one delay line of pool blocks, which are held for the length of the delay
+class AudioEffectDelay : public AudioStream
+{
+  static constexpr int      DELAY_QUEUE_SIZE  = 117;    // Teensy 3.2
+  static constexpr int      NUM_TAPS          = 8;
+
+  audio_block_t*            m_input_queue_array[1];
+  audio_block_t*            m_queue[DELAY_QUEUE_SIZE];
+  uint32_t                  m_head            = 0;
+  uint32_t                  m_tail            = 0;
+  uint32_t                  m_max_blocks      = 0;
+  uint32_t                  m_position[NUM_TAPS];     // samples
+  uint8_t                   m_active_mask     = 0;
+
+  void                      recompute_max_blocks();
+
+public:
+
+  AudioEffectDelay();
+  virtual void              update() override;
+
+  void                      delay( uint8_t tap, float milliseconds );
+  void                      disable( uint8_t tap );
+};
+
+////////////////////////////////////////////////////////////
+// mono Freeverb, 8 combs into 4 allpasses in 16 bit fixed point, always transmits
+class AudioEffectFreeverb : public AudioStream
+{
+  static constexpr int      COMB_SIZES[8]     = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617 };
+  static constexpr int      ALLPASS_SIZES[4]  = { 556, 441, 341, 225 };
+
+  audio_block_t*            m_input_queue_array[1];
+  std::vector<int16_t>      m_comb_buffers[8];
+  std::vector<int16_t>      m_allpass_buffers[4];
+  uint16_t                  m_comb_index[8]   = {};
+  uint16_t                  m_allpass_index[4] = {};
+  int16_t                   m_comb_filter[8]  = {};
+  int32_t                   m_comb_damp1      = 6553;
+  int32_t                   m_comb_damp2      = 26215;
+  int32_t                   m_comb_feedback   = 27524;
+
+public:
+
+  AudioEffectFreeverb();
+  virtual void              update() override;
+
+  void                      roomsize( float n );
+  void                      damping( float n );
+};
+
+////////////////////////////////////////////////////////////
+// the DAC, fed from a double buffer by DMA. Each DMA interrupt copies the oldest queued block into the half
+// that has just played, which is heard after the other half, so a block is heard 2 blocks after it's rendered.
+// Keeps everything it plays for the tests.
+class AudioOutputAnalog : public AudioStream
+{
+  audio_block_t*            m_input_queue_array[1];
+  audio_block_t*            m_block_1st       = nullptr;
+  audio_block_t*            m_block_2nd       = nullptr;
+
+  std::vector<int16_t>      m_played;
+  uint64_t                  m_first_sample_ns = 0;
+  uint32_t                  m_underruns       = 0;      // DMA interrupts with no block queued, after the first block
+  bool                      m_started         = false;
+
+  AudioOutputAnalog*        m_next_output;
+
+public:
+
+  static AudioOutputAnalog* s_first_output;
+
+  AudioOutputAnalog();
+  virtual void              update() override;
+
+  void                      analogReference( int /*ref*/ )    { }
+  void                      dma_interrupt( uint64_t time_ns );  // from HOST_SIM every block
+
+  const std::vector<int16_t>& played() const                  { return m_played; }
+  uint64_t                  sample_time_ns( size_t index ) const;  // when a played sample reached the DAC
+  uint32_t                  underruns() const                 { return m_underruns; }
+  AudioOutputAnalog*        next_output() const               { return m_next_output; }
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <Arduino.h>
+
+// host stand-in for the Bounce library, the button is never pressed
+
+class Bounce
+{
+public:
+
+  Bounce( int /*pin*/, unsigned long /*interval_ms*/ )    { }
+
+  int                       update()                          { return 0; }
+  int                       read()                            { return HIGH; }
+  int                       risingEdge()                      { return 0; }
+  int                       fallingEdge()                     { return 0; }
+};
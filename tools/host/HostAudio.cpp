@@ -0,0 +1,479 @@
+#include "HostSim.h"
+
+AudioStream*        AudioStream::s_first_update         = nullptr;
+audio_block_t*      AudioStream::s_pool                 = nullptr;
+std::vector<bool>   AudioStream::s_pool_used;
+uint16_t            AudioStream::memory_used            = 0;
+uint16_t            AudioStream::memory_used_max        = 0;
+uint16_t            AudioStream::cpu_cycles_total       = 0;
+uint16_t            AudioStream::cpu_cycles_total_max   = 0;
+uint32_t            AudioStream::allocation_failures    = 0;
+uint32_t            AudioStream::update_count           = 0;
+
+AudioOutputAnalog*  AudioOutputAnalog::s_first_output   = nullptr;
+
+constexpr int       AudioEffectFreeverb::COMB_SIZES[8];
+constexpr int       AudioEffectFreeverb::ALLPASS_SIZES[4];
+
+////////////////////////////////////////////////////////////
+
+AudioConnection::AudioConnection( AudioStream& source, unsigned char source_output, AudioStream& destination, unsigned char destination_input ) :
+  m_src( source ),
+  m_dst( destination ),
+  m_src_index( source_output ),
+  m_dst_index( destination_input ),
+  m_next_dest( nullptr )
+{
+  if( destination_input >= destination.m_num_inputs )
+  {
+    return;
+  }
+
+  AudioConnection** last = &source.m_destination_list;
+  while( *last != nullptr )
+  {
+    last = &(*last)->m_next_dest;
+  }
+  *last = this;
+
+  source.active       = true;
+  destination.active  = true;
+}
+
+////////////////////////////////////////////////////////////
+
+AudioStream::AudioStream( unsigned char num_inputs, audio_block_t** input_queue ) :
+  m_next_update( nullptr ),
+  m_destination_list( nullptr ),
+  m_num_inputs( num_inputs ),
+  m_input_queue( input_queue ),
+  active( false ),
+  cpu_cycles( 0 ),
+  cpu_cycles_max( 0 )
+{
+  for( int i = 0; i < num_inputs; ++i )
+  {
+    m_input_queue[i] = nullptr;
+  }
+
+  // updated in the order constructed
+  AudioStream** last = &s_first_update;
+  while( *last != nullptr )
+  {
+    last = &(*last)->m_next_update;
+  }
+  *last = this;
+}
+
+void AudioStream::initialize_memory( audio_block_t* data, unsigned int num )
+{
+  s_pool              = data;
+  s_pool_used.assign( num, false );
+  memory_used         = 0;
+  memory_used_max     = 0;
+}
+
+audio_block_t* AudioStream::allocate()
+{
+  for( size_t i = 0; i < s_pool_used.size(); ++i )
+  {
+    if( !s_pool_used[i] )
+    {
+      s_pool_used[i]              = true;
+      audio_block_t* block        = &s_pool[i];
+      block->ref_count            = 1;
+      block->memory_pool_index    = i;
+      memory_used_max             = std::max( memory_used_max, ++memory_used );
+      return block;
+    }
+  }
+
+  ++allocation_failures;
+  return nullptr;
+}
+
+void AudioStream::release( audio_block_t* block )
+{
+  if( block->ref_count > 1 )
+  {
+    --block->ref_count;
+  }
+  else
+  {
+    block->ref_count              = 0;
+    s_pool_used[ block->memory_pool_index ] = false;
+    --memory_used;
+  }
+}
+
+void AudioStream::transmit( audio_block_t* block, unsigned char index )
+{
+  for( AudioConnection* c = m_destination_list; c != nullptr; c = c->m_next_dest )
+  {
+    if( c->m_src_index == index && c->m_dst.m_input_queue[c->m_dst_index] == nullptr )
+    {
+      c->m_dst.m_input_queue[c->m_dst_index] = block;
+      ++block->ref_count;
+    }
+  }
+}
+
+audio_block_t* AudioStream::receiveReadOnly( unsigned int index )
+{
+  if( index >= m_num_inputs )
+  {
+    return nullptr;
+  }
+  audio_block_t* block  = m_input_queue[index];
+  m_input_queue[index]  = nullptr;
+  return block;
+}
+
+audio_block_t* AudioStream::receiveWritable( unsigned int index )
+{
+  audio_block_t* block  = receiveReadOnly( index );
+  if( block != nullptr && block->ref_count > 1 )
+  {
+    // shared with another input, write to a copy
+    audio_block_t* copy = allocate();
+    if( copy != nullptr )
+    {
+      memcpy( copy->data, block->data, sizeof(copy->data) );
+    }
+    --block->ref_count;
+    block               = copy;
+  }
+  return block;
+}
+
+void AudioStream::update_all()
+{
+  const uint32_t start_cycles = ARM_DWT_CYCCNT;
+  for( AudioStream* node = s_first_update; node != nullptr; node = node->m_next_update )
+  {
+    if( node->active )
+    {
+      const uint32_t node_start_cycles = ARM_DWT_CYCCNT;
+      node->update();
+      node->cpu_cycles      = ( ARM_DWT_CYCCNT - node_start_cycles ) >> 4;
+      node->cpu_cycles_max  = std::max( node->cpu_cycles_max, node->cpu_cycles );
+    }
+  }
+  cpu_cycles_total          = std::min<uint32_t>( ( ARM_DWT_CYCCNT - start_cycles ) >> 4, UINT16_MAX );
+  cpu_cycles_total_max      = std::max( cpu_cycles_total_max, cpu_cycles_total );
+  ++update_count;
+}
+
+////////////////////////////////////////////////////////////
+
+AudioEffectDelay::AudioEffectDelay() :
+  AudioStream( 1, m_input_queue_array ),
+  m_queue(),
+  m_position()
+{
+}
+
+void AudioEffectDelay::update()
+{
+  // queue the incoming block (or the lack of one), dropping the oldest if the queue is full
+  uint32_t head = m_head;
+  uint32_t tail = m_tail;
+  if( ++head >= DELAY_QUEUE_SIZE )
+  {
+    head = 0;
+  }
+  if( head == tail )
+  {
+    if( m_queue[tail] != nullptr )
+    {
+      release( m_queue[tail] );
+      m_queue[tail] = nullptr;
+    }
+    if( ++tail >= DELAY_QUEUE_SIZE )
+    {
+      tail = 0;
+    }
+  }
+  m_queue[head] = receiveReadOnly();
+  m_head        = head;
+
+  // keep only the blocks the longest tap needs
+  uint32_t count = head >= tail ? head - tail : DELAY_QUEUE_SIZE + head - tail;
+  if( count > m_max_blocks )
+  {
+    count -= m_max_blocks;
+    do
+    {
+      if( m_queue[tail] != nullptr )
+      {
+        release( m_queue[tail] );
+        m_queue[tail] = nullptr;
+      }
+      if( ++tail >= DELAY_QUEUE_SIZE )
+      {
+        tail = 0;
+      }
+    } while( --count > 0 );
+  }
+  m_tail = tail;
+
+  for( int tap = 0; tap < NUM_TAPS; ++tap )
+  {
+    if( ( m_active_mask & ( 1 << tap ) ) == 0 )
+    {
+      continue;
+    }
+
+    uint32_t index        = m_position[tap] / AUDIO_BLOCK_SAMPLES;
+    const uint32_t offset = m_position[tap] % AUDIO_BLOCK_SAMPLES;
+    index                 = head >= index ? head - index : DELAY_QUEUE_SIZE + head - index;
+
+    if( offset == 0 )
+    {
+      // on a block boundary, send the queued block itself
+      if( m_queue[index] != nullptr )
+      {
+        transmit( m_queue[index], tap );
+      }
+      continue;
+    }
+
+    // straddles 2 blocks
+    audio_block_t* output = allocate();
+    if( output == nullptr )
+    {
+      continue;
+    }
+    const uint32_t prev         = index > 0 ? index - 1 : DELAY_QUEUE_SIZE - 1;
+    const audio_block_t* first  = m_queue[prev];
+    const audio_block_t* second = m_queue[index];
+    for( uint32_t i = 0; i < offset; ++i )
+    {
+      output->data[i] = first != nullptr ? first->data[ AUDIO_BLOCK_SAMPLES - offset + i ] : 0;
+    }
+    for( uint32_t i = offset; i < AUDIO_BLOCK_SAMPLES; ++i )
+    {
+      output->data[i] = second != nullptr ? second->data[ i - offset ] : 0;
+    }
+    transmit( output, tap );
+    release( output );
+  }
+}
+
+void AudioEffectDelay::delay( uint8_t tap, float milliseconds )
+{
+  if( tap >= NUM_TAPS )
+  {
+    return;
+  }
+
+  milliseconds          = std::max( milliseconds, 0.0f );
+  uint32_t n            = static_cast<uint32_t>( milliseconds * ( AUDIO_SAMPLE_RATE_EXACT / 1000.0f ) + 0.5f );
+  n                     = std::min<uint32_t>( n, AUDIO_BLOCK_SAMPLES * ( DELAY_QUEUE_SIZE - 1 ) );
+  const uint32_t blocks = ( n + ( AUDIO_BLOCK_SAMPLES - 1 ) ) / AUDIO_BLOCK_SAMPLES + 1;
+
+  if( ( m_active_mask & ( 1 << tap ) ) == 0 || n > m_position[tap] )
+  {
+    m_position[tap]     = n;
+    m_max_blocks        = std::max( m_max_blocks, blocks );
+    m_active_mask      |= 1 << tap;
+  }
+  else
+  {
+    m_position[tap]     = n;
+    recompute_max_blocks();
+  }
+}
+
+void AudioEffectDelay::disable( uint8_t tap )
+{
+  if( tap < NUM_TAPS )
+  {
+    m_active_mask      &= ~( 1 << tap );
+    recompute_max_blocks();
+  }
+}
+
+void AudioEffectDelay::recompute_max_blocks()
+{
+  m_max_blocks          = 0;
+  for( int tap = 0; tap < NUM_TAPS; ++tap )
+  {
+    if( m_active_mask & ( 1 << tap ) )
+    {
+      const uint32_t blocks = ( m_position[tap] + ( AUDIO_BLOCK_SAMPLES - 1 ) ) / AUDIO_BLOCK_SAMPLES + 1;
+      m_max_blocks      = std::max( m_max_blocks, blocks );
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////
+
+namespace
+{
+  inline int16_t sat16( int32_t value, int rshift )
+  {
+    return signed_saturate_rshift( value, 16, rshift );
+  }
+
+  inline float clamp_unit( float n )
+  {
+    return std::min( std::max( n, 0.0f ), 1.0f );
+  }
+}
+
+AudioEffectFreeverb::AudioEffectFreeverb() :
+  AudioStream( 1, m_input_queue_array )
+{
+  for( int c = 0; c < 8; ++c )
+  {
+    m_comb_buffers[c].assign( COMB_SIZES[c], 0 );
+  }
+  for( int a = 0; a < 4; ++a )
+  {
+    m_allpass_buffers[a].assign( ALLPASS_SIZES[a], 0 );
+  }
+}
+
+void AudioEffectFreeverb::update()
+{
+  static const audio_block_t silence = {};
+
+  const audio_block_t* block = receiveReadOnly();
+  audio_block_t* out         = allocate();
+  if( out == nullptr )
+  {
+    if( block != nullptr )
+    {
+      release( const_cast<audio_block_t*>( block ) );
+    }
+    return;
+  }
+  const audio_block_t* in    = block != nullptr ? block : &silence;
+
+  for( int i = 0; i < AUDIO_BLOCK_SAMPLES; ++i )
+  {
+    const int16_t input     = sat16( in->data[i] * 8738, 17 );
+
+    int32_t sum             = 0;
+    for( int c = 0; c < 8; ++c )
+    {
+      int16_t& sample       = m_comb_buffers[c][ m_comb_index[c] ];
+      const int16_t bufout  = sample;
+      sum                  += bufout;
+      m_comb_filter[c]      = sat16( bufout * m_comb_damp2 + m_comb_filter[c] * m_comb_damp1, 15 );
+      sample                = sat16( input + sat16( m_comb_filter[c] * m_comb_feedback, 15 ), 0 );
+      if( ++m_comb_index[c] >= COMB_SIZES[c] )
+      {
+        m_comb_index[c]     = 0;
+      }
+    }
+
+    int16_t output          = sat16( sum * 31457, 17 );
+    for( int a = 0; a < 4; ++a )
+    {
+      int16_t& sample       = m_allpass_buffers[a][ m_allpass_index[a] ];
+      const int16_t bufout  = sample;
+      sample                = static_cast<int16_t>( output + ( bufout >> 1 ) );
+      output                = sat16( bufout - output, 1 );
+      if( ++m_allpass_index[a] >= ALLPASS_SIZES[a] )
+      {
+        m_allpass_index[a]  = 0;
+      }
+    }
+
+    out->data[i]            = sat16( output * 30, 0 );
+  }
+
+  transmit( out );
+  release( out );
+  if( block != nullptr )
+  {
+    release( const_cast<audio_block_t*>( block ) );
+  }
+}
+
+void AudioEffectFreeverb::roomsize( float n )
+{
+  n                         = clamp_unit( n );
+  m_comb_feedback           = static_cast<int32_t>( n * 9175.04f ) + 22937;
+}
+
+void AudioEffectFreeverb::damping( float n )
+{
+  n                         = clamp_unit( n );
+  const int x1              = static_cast<int>( n * 13107.2f );
+  m_comb_damp1              = x1;
+  m_comb_damp2              = 32768 - x1;
+}
+
+////////////////////////////////////////////////////////////
+
+AudioOutputAnalog::AudioOutputAnalog() :
+  AudioStream( 1, m_input_queue_array ),
+  m_next_output( nullptr )
+{
+  AudioOutputAnalog** last = &s_first_output;
+  while( *last != nullptr )
+  {
+    last = &(*last)->m_next_output;
+  }
+  *last = this;
+}
+
+void AudioOutputAnalog::update()
+{
+  audio_block_t* block = receiveReadOnly();
+  if( block == nullptr )
+  {
+    return;
+  }
+
+  m_started           = true;
+  if( m_block_1st == nullptr )
+  {
+    m_block_1st       = block;
+  }
+  else if( m_block_2nd == nullptr )
+  {
+    m_block_2nd       = block;
+  }
+  else
+  {
+    // both queued, drop the oldest
+    audio_block_t* oldest = m_block_1st;
+    m_block_1st       = m_block_2nd;
+    m_block_2nd       = block;
+    release( oldest );
+  }
+}
+
+void AudioOutputAnalog::dma_interrupt( uint64_t time_ns )
+{
+  // the half just played is refilled, and is heard once the other half has played
+  if( m_played.empty() )
+  {
+    m_first_sample_ns = time_ns + HOST_SIM::block_time_ns( 1 );
+  }
+
+  if( m_block_1st != nullptr )
+  {
+    m_played.insert( m_played.end(), m_block_1st->data, m_block_1st->data + AUDIO_BLOCK_SAMPLES );
+    release( m_block_1st );
+    m_block_1st       = m_block_2nd;
+    m_block_2nd       = nullptr;
+  }
+  else
+  {
+    if( m_started )
+    {
+      ++m_underruns;
+    }
+    m_played.insert( m_played.end(), AUDIO_BLOCK_SAMPLES, 0 );
+  }
+}
+
+uint64_t AudioOutputAnalog::sample_time_ns( size_t index ) const
+{
+  return m_first_sample_ns + static_cast<uint64_t>( llround( ( index * 1.0e9 ) / AUDIO_SAMPLE_RATE_EXACT ) );
+}
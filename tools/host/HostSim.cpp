@@ -0,0 +1,315 @@
+#include <map>
+#include <set>
+#include <string>
+
+#include "HostSim.h"
+
+HOST_SERIAL   Serial;
+SDClass       SD;
+SPIClass      SPI;
+uint32_t      ARM_DEMCR     = 0;
+uint32_t      ARM_DWT_CTRL  = 0;
+
+uint64_t      HOST_SIM::s_now_ns          = 0;
+uint64_t      HOST_SIM::s_next_dma_block  = 1;
+bool          HOST_SIM::s_update_enabled  = true;
+bool          HOST_SIM::s_update_pending  = false;
+bool          HOST_SIM::s_in_update       = false;
+void          (*HOST_SIM::s_edge_isr)()   = nullptr;
+
+namespace
+{
+  std::multiset<uint64_t>                                   edges;
+  std::map<int, int>                                        analog_values;
+  std::map<std::string, std::shared_ptr<HOST_FILE_DATA>>    card;
+
+  std::string card_key( const char* filename )
+  {
+    std::string key( filename );
+    for( char& c : key )
+    {
+      c = toupper( c );
+    }
+    return key;
+  }
+}
+
+////////////////////////////////////////////////////////////
+
+uint64_t HOST_SIM::block_time_ns( uint64_t block )
+{
+  return static_cast<uint64_t>( llround( ( block * AUDIO_BLOCK_SAMPLES * 1.0e9 ) / AUDIO_SAMPLE_RATE_EXACT ) );
+}
+
+void HOST_SIM::service_interrupts( uint64_t time_ns )
+{
+  for( ;; )
+  {
+    const uint64_t dma_ns   = block_time_ns( s_next_dma_block );
+    const uint64_t edge_ns  = edges.empty() ? UINT64_MAX : *edges.begin();
+    const uint64_t next_ns  = std::min( dma_ns, edge_ns );
+    if( next_ns > time_ns )
+    {
+      return;
+    }
+    s_now_ns                = std::max( s_now_ns, next_ns );
+
+    if( dma_ns <= edge_ns )
+    {
+      for( AudioOutputAnalog* output = AudioOutputAnalog::s_first_output; output != nullptr; output = output->next_output() )
+      {
+        output->dma_interrupt( s_now_ns );
+      }
+      ++s_next_dma_block;
+      s_update_pending      = true;
+    }
+    else
+    {
+      edges.erase( edges.begin() );
+      if( s_edge_isr != nullptr )
+      {
+        s_edge_isr();
+      }
+    }
+
+    if( s_update_pending && s_update_enabled && !s_in_update )
+    {
+      run_update();
+    }
+  }
+}
+
+void HOST_SIM::run_update()
+{
+  // anything that falls due while it runs preempts it, another DMA interrupt just leaves it pending again
+  s_in_update               = true;
+  while( s_update_pending && s_update_enabled )
+  {
+    s_update_pending        = false;
+    AudioStream::update_all();
+  }
+  s_in_update               = false;
+}
+
+void HOST_SIM::advance_to( uint64_t time_ns )
+{
+  service_interrupts( time_ns );
+  s_now_ns                  = std::max( s_now_ns, time_ns );
+}
+
+void HOST_SIM::run_until( uint64_t time_ns, void (*loop_fn)() )
+{
+  while( s_now_ns < time_ns )
+  {
+    if( loop_fn != nullptr )
+    {
+      loop_fn();
+    }
+    advance_to( std::min<uint64_t>( s_now_ns + LOOP_INTERVAL_US * 1000, time_ns ) );
+  }
+}
+
+void HOST_SIM::run_blocks( int num_blocks, void (*loop_fn)() )
+{
+  run_until( block_time_ns( s_next_dma_block + num_blocks - 1 ), loop_fn );
+}
+
+void HOST_SIM::add_edge( uint64_t time_ns )
+{
+  edges.insert( time_ns );
+}
+
+void HOST_SIM::set_analog( int pin, int value )
+{
+  analog_values[pin] = value;
+}
+
+int HOST_SIM::analog( int pin )
+{
+  return analog_values[pin];
+}
+
+void HOST_SIM::enable_update( bool enable )
+{
+  s_update_enabled = enable;
+  if( s_update_enabled && s_update_pending && !s_in_update )
+  {
+    run_update();
+  }
+}
+
+bool HOST_SIM::load_file( const char* path, const char* card_name )
+{
+  FILE* file = fopen( path, "rb" );
+  if( file == nullptr )
+  {
+    return false;
+  }
+
+  std::shared_ptr<HOST_FILE_DATA> data = std::make_shared<HOST_FILE_DATA>();
+  data->m_name = card_name;
+  int c;
+  while( ( c = fgetc( file ) ) != EOF )
+  {
+    data->m_bytes.push_back( static_cast<uint8_t>( c ) );
+  }
+  fclose( file );
+  card[ card_key( card_name ) ] = data;
+
+  return true;
+}
+
+bool HOST_SIM::save_file( const char* card_name, const char* path )
+{
+  const auto found = card.find( card_key( card_name ) );
+  if( found == card.end() )
+  {
+    return false;
+  }
+
+  FILE* file = fopen( path, "wb" );
+  if( file == nullptr )
+  {
+    return false;
+  }
+  const std::vector<uint8_t>& bytes = found->second->m_bytes;
+  const bool written = fwrite( bytes.data(), 1, bytes.size(), file ) == bytes.size();
+  fclose( file );
+
+  return written;
+}
+
+////////////////////////////////////////////////////////////
+
+uint32_t millis()
+{
+  return static_cast<uint32_t>( HOST_SIM::now_ns() / 1000000 );
+}
+
+uint32_t micros()
+{
+  return static_cast<uint32_t>( HOST_SIM::now_ns() / 1000 );
+}
+
+void delay( uint32_t ms )
+{
+  HOST_SIM::advance_to( HOST_SIM::now_ns() + ms * 1000000ull );
+}
+
+void delayMicroseconds( uint32_t us )
+{
+  HOST_SIM::advance_to( HOST_SIM::now_ns() + us * 1000ull );
+}
+
+uint32_t host_cycle_count()
+{
+  return static_cast<uint32_t>( ( HOST_SIM::now_ns() * ( F_CPU / 1000000 ) ) / 1000 );
+}
+
+bool host_nvic_is_enabled( int /*irq*/ )
+{
+  return HOST_SIM::update_enabled();
+}
+
+void host_nvic_enable( int /*irq*/, bool enable )
+{
+  HOST_SIM::enable_update( enable );
+}
+
+int analogRead( int pin )                                     { return HOST_SIM::analog( pin ); }
+void analogWrite( int /*pin*/, int /*value*/ )                { }
+void digitalWrite( int /*pin*/, int /*value*/ )               { }
+int digitalRead( int /*pin*/ )                                { return LOW; }
+void pinMode( int /*pin*/, int /*mode*/ )                     { }
+
+void attachInterrupt( int /*interrupt*/, void (*isr)(), int /*mode*/ )
+{
+  HOST_SIM::set_edge_isr( isr );
+}
+
+////////////////////////////////////////////////////////////
+
+void HOST_SERIAL::print_number( long long value, int base )
+{
+  printf( base == HEX ? "%llX" : "%lld", value );
+}
+
+////////////////////////////////////////////////////////////
+
+int File::available()
+{
+  return static_cast<int>( m_data->m_bytes.size() - m_position );
+}
+
+int File::peek()
+{
+  return m_position < m_data->m_bytes.size() ? m_data->m_bytes[m_position] : -1;
+}
+
+int File::read()
+{
+  return m_position < m_data->m_bytes.size() ? m_data->m_bytes[m_position++] : -1;
+}
+
+int File::read( void* buffer, size_t bytes )
+{
+  const size_t count = std::min( bytes, m_data->m_bytes.size() - m_position );
+  memcpy( buffer, m_data->m_bytes.data() + m_position, count );
+  m_position += count;
+  return static_cast<int>( count );
+}
+
+size_t File::write( uint8_t byte )
+{
+  return write( &byte, 1 );
+}
+
+size_t File::write( const uint8_t* buffer, size_t bytes )
+{
+  std::vector<uint8_t>& file_bytes = m_data->m_bytes;
+  if( m_position + bytes > file_bytes.size() )
+  {
+    file_bytes.resize( m_position + bytes );
+  }
+  memcpy( file_bytes.data() + m_position, buffer, bytes );
+  m_position += bytes;
+  return bytes;
+}
+
+bool File::seek( uint32_t position )
+{
+  if( position > m_data->m_bytes.size() )
+  {
+    return false;
+  }
+  m_position = position;
+  return true;
+}
+
+File SDClass::open( const char* filename, int mode )
+{
+  std::shared_ptr<HOST_FILE_DATA>& data = card[ card_key( filename ) ];
+  if( data == nullptr )
+  {
+    if( mode != FILE_WRITE )
+    {
+      card.erase( card_key( filename ) );
+      return File();
+    }
+    data = std::make_shared<HOST_FILE_DATA>();
+    data->m_name = filename;
+  }
+
+  // writes append, as with the SD library
+  return File( data, mode == FILE_WRITE ? data->m_bytes.size() : 0 );
+}
+
+bool SDClass::exists( const char* filename )
+{
+  return card.count( card_key( filename ) ) > 0;
+}
+
+bool SDClass::remove( const char* filename )
+{
+  return card.erase( card_key( filename ) ) > 0;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <Arduino.h>
+#include <Audio.h>
+
+////////////////////////////////////////////////////////////
+// runs the sketch against a simulated clock. A DMA interrupt every block feeds the DAC and runs the audio
+// update as the software interrupt (held off by AudioNoInterrupts()), trigger edges fire the attached pin
+// interrupt and loop() is called every LOOP_INTERVAL_US in between. Code only takes time when it delays,
+// and interrupts that fall due while it does preempt it, so everything is repeatable to the nanosecond.
+class HOST_SIM
+{
+  static constexpr uint32_t LOOP_INTERVAL_US                            = 20;
+
+  static uint64_t           s_now_ns;
+  static uint64_t           s_next_dma_block;
+  static bool               s_update_enabled;
+  static bool               s_update_pending;
+  static bool               s_in_update;
+  static void               (*s_edge_isr)();
+
+  static void               service_interrupts( uint64_t time_ns );
+  static void               run_update();
+
+public:
+
+  static uint64_t           block_time_ns( uint64_t block );   // the DMA interrupt of a block
+  static uint64_t           now_ns()                          { return s_now_ns; }
+
+  static void               advance_to( uint64_t time_ns );   // servicing interrupts on the way
+  static void               run_until( uint64_t time_ns, void (*loop_fn)() );
+  static void               run_blocks( int num_blocks, void (*loop_fn)() );
+
+  static void               add_edge( uint64_t time_ns );     // a rising edge on the pin with an interrupt attached
+  static void               set_analog( int pin, int value );
+
+  static bool               load_file( const char* path, const char* card_name );  // copies a file to the in memory SD card
+  static bool               save_file( const char* card_name, const char* path );
+
+  // for the stand-ins
+  static void               set_edge_isr( void (*isr)() )     { s_edge_isr = isr; }
+  static bool               update_enabled()                  { return s_update_enabled; }
+  static void               enable_update( bool enable );
+  static int                analog( int pin );
+};
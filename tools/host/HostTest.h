@@ -0,0 +1,60 @@
+#pragma once
+
+// shared by the host tests, which are run by run_tests.sh from the root of the repo
+
+#include <string>
+
+#include "HostSim.h"
+
+// copies p1.txt to p8.txt from the directory to the card, stopping at the first missing one as the sketch does
+inline int load_patterns( const char* directory )
+{
+  int num_patterns = 0;
+  for( ; num_patterns < 8; ++num_patterns )
+  {
+    const std::string name = "p" + std::to_string( num_patterns + 1 ) + ".txt";
+    if( !HOST_SIM::load_file( ( std::string( directory ) + "/" + name ).c_str(), name.c_str() ) )
+    {
+      break;
+    }
+  }
+  return num_patterns;
+}
+
+// writes a file to the in memory SD card, replacing any already there
+inline void write_card_file( const char* name, const char* text )
+{
+  SD.remove( name );
+  File file = SD.open( name, FILE_WRITE );
+  file.write( reinterpret_cast<const uint8_t*>( text ), strlen( text ) );
+  file.close();
+}
+
+// index of the first non-zero sample the output played at or after from_ns and before from_ns + search_ns, -1 if none
+inline int64_t first_sound( const AudioOutputAnalog& output, uint64_t from_ns, uint64_t search_ns )
+{
+  const std::vector<int16_t>& played = output.played();
+  for( size_t i = 0; i < played.size(); ++i )
+  {
+    const uint64_t time_ns = output.sample_time_ns( i );
+    if( time_ns >= from_ns + search_ns )
+    {
+      break;
+    }
+    if( time_ns >= from_ns && played[i] != 0 )
+    {
+      return static_cast<int64_t>( i );
+    }
+  }
+  return -1;
+}
+
+// prints the check, and counts it in failures if it didn't pass
+inline void check( bool passed, const char* description, int& failures )
+{
+  printf( "%s: %s\n", passed ? "ok" : "FAILED", description );
+  if( !passed )
+  {
+    ++failures;
+  }
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+// host stand-in for the SD library, the card is held in memory (see HOST_SIM::load_card())
+// and names are matched ignoring case, as on a FAT card
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <SPI.h>
+
+#define FILE_READ           0
+#define FILE_WRITE          1
+
+struct HOST_FILE_DATA
+{
+  std::string               m_name;
+  std::vector<uint8_t>      m_bytes;
+};
+
+class File
+{
+  std::shared_ptr<HOST_FILE_DATA> m_data;
+  size_t                    m_position      = 0;
+
+public:
+
+  File()                    { }
+  File( std::shared_ptr<HOST_FILE_DATA> data, size_t position ) :
+    m_data( data ),
+    m_position( position )
+  {
+  }
+
+  explicit                  operator bool() const             { return m_data != nullptr; }
+  const char*               name() const                      { return m_data->m_name.c_str(); }
+
+  int                       available();
+  int                       peek();
+  int                       read();
+  int                       read( void* buffer, size_t bytes );
+  size_t                    write( uint8_t byte );
+  size_t                    write( const uint8_t* buffer, size_t bytes );
+  bool                      seek( uint32_t position );
+  uint32_t                  position() const                  { return m_position; }
+  uint32_t                  size() const                      { return m_data->m_bytes.size(); }
+  void                      flush()                           { }
+  void                      close()                           { m_data = nullptr; }
+};
+
+class SDClass
+{
+public:
+
+  bool                      begin( int /*cs_pin*/ = 10 )      { return true; }
+  File                      open( const char* filename, int mode = FILE_READ );
+  bool                      exists( const char* filename );
+  bool                      remove( const char* filename );
+};
+
+extern SDClass              SD;
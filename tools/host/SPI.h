@@ -0,0 +1,13 @@
+#pragma once
+
+// host stand-in for the SPI library, the SD card is in memory so the pins do nothing
+
+class SPIClass
+{
+public:
+
+  void                      setMOSI( int /*pin*/ )            { }
+  void                      setSCK( int /*pin*/ )             { }
+};
+
+extern SPIClass             SPI;
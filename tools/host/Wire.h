@@ -0,0 +1,3 @@
+#pragma once
+
+// host stand-in for the Wire library, nothing on the sketch uses I2C
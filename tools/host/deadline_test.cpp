@@ -0,0 +1,47 @@
+// with INJECT_AUDIO_LOAD and CLOCK_IN_AUDIO_UPDATE, clocks the patterns from a steady trigger and checks the
+// audio clock counts each injected stall once as a missed block and once as an overrun, and nothing else
+
+#include "HostTest.h"
+#include "sketch.h"
+
+namespace
+{
+  constexpr uint64_t    TRIGGER_PERIOD_NS   = 125000000;    // 16ths at 120bpm
+  constexpr int         NUM_STALLS          = 6;
+}
+
+int main()
+{
+  if( load_patterns( "." ) == 0 )
+  {
+    fprintf( stderr, "no patterns, run from the root of the repo\n" );
+    return 2;
+  }
+
+  // a block past the last stall, so the update after it has run
+  const int num_blocks  = NUM_STALLS * AUDIO_CLOCK::INJECTED_LOAD_INTERVAL_BLOCKS + 4;
+  for( uint64_t time_ns = 200000000; time_ns < HOST_SIM::block_time_ns( num_blocks ); time_ns += TRIGGER_PERIOD_NS )
+  {
+    HOST_SIM::add_edge( time_ns );
+  }
+
+  setup();
+  HOST_SIM::run_until( HOST_SIM::block_time_ns( num_blocks ), loop );
+
+  // the stall is in the audio clock's update, once every INJECTED_LOAD_INTERVAL_BLOCKS updates of the graph
+  const uint32_t stalls = ( AudioStream::update_count - 1 ) / AUDIO_CLOCK::INJECTED_LOAD_INTERVAL_BLOCKS;
+  const uint32_t missed = AUDIO_CLOCK::deadline_misses( AUDIO_CLOCK::MISSED_BLOCK );
+  const uint32_t overrun = AUDIO_CLOCK::deadline_misses( AUDIO_CLOCK::OVERRUN );
+  const uint32_t late   = AUDIO_CLOCK::deadline_misses( AUDIO_CLOCK::LATE_TRIGGER );
+  printf( "updates:%u stalls:%u missed blocks:%u overruns:%u late triggers:%u\n", AudioStream::update_count, stalls, missed, overrun, late );
+
+  int failures = 0;
+  check( stalls == NUM_STALLS, "stalled the expected number of times", failures );
+  check( missed == stalls, "each stall missed one block", failures );
+  check( overrun == stalls, "each stall overran once", failures );
+  check( late == 0, "no late triggers", failures );
+  const std::vector<int16_t>& played = audio_output.played();
+  check( std::any_of( played.begin(), played.end(), []( int16_t sample ) { return sample != 0; } ), "the trigger played the patterns", failures );
+
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,168 @@
+// renders every pattern through the real audio graph with GOLDEN_AUDIO_TEST and compares a hash of each step
+// of output with golden_hashes.txt
+//
+//   golden_test [--record] [--write-reference <raw>] [--reference <raw> --tolerance <max deviation>]
+//
+// --record rewrites golden_hashes.txt, for an intentional change to the sound. --write-reference saves the
+// output in GOLDEN.RAW format, and --reference compares with one sample by sample, passing if no sample
+// differs by more than the tolerance, as GOLDEN_AUDIO does on the module.
+
+#include <vector>
+
+#include "HostTest.h"
+#include "sketch.h"
+
+namespace
+{
+  const char* const     HASH_FILE_NAME      = "tools/host/golden_hashes.txt";
+  constexpr uint32_t    FNV_PRIME           = 16777619u;
+  constexpr uint32_t    FNV_OFFSET_BASIS    = 2166136261u;
+  constexpr int         RECORD_BYTES        = sizeof(uint32_t) + AUDIO_BLOCK_SAMPLES * sizeof(int16_t);
+
+  // one hash per step, from the block hashes GOLDEN_AUDIO recorded
+  std::vector<uint32_t> step_hashes()
+  {
+    std::vector<uint32_t> hashes;
+    File file = SD.open( "GOLDEN.RAW" );
+    for( int block = 0; file && file.available() >= RECORD_BYTES; ++block )
+    {
+      uint32_t block_hash;
+      file.read( &block_hash, sizeof(block_hash) );
+      file.seek( file.position() + AUDIO_BLOCK_SAMPLES * sizeof(int16_t) );
+
+      if( block % GOLDEN_BLOCKS_PER_STEP == 0 )
+      {
+        hashes.push_back( FNV_OFFSET_BASIS );
+      }
+      hashes.back() = ( hashes.back() ^ block_hash ) * FNV_PRIME;
+    }
+    return hashes;
+  }
+
+  std::vector<uint32_t> read_hashes( const char* filename )
+  {
+    std::vector<uint32_t> hashes;
+    FILE* file = fopen( filename, "r" );
+    if( file == nullptr )
+    {
+      return hashes;
+    }
+    char line[64];
+    while( fgets( line, sizeof(line), file ) != nullptr )
+    {
+      unsigned int step, hash;
+      if( sscanf( line, "%u %x", &step, &hash ) == 2 )
+      {
+        hashes.push_back( hash );
+      }
+    }
+    fclose( file );
+    return hashes;
+  }
+
+  bool write_hashes( const char* filename, const std::vector<uint32_t>& hashes )
+  {
+    FILE* file = fopen( filename, "w" );
+    if( file == nullptr )
+    {
+      return false;
+    }
+    for( size_t step = 0; step < hashes.size(); ++step )
+    {
+      fprintf( file, "%zu %08X\n", step, hashes[step] );
+    }
+    fclose( file );
+    return true;
+  }
+}
+
+int main( int argc, char** argv )
+{
+  bool record                   = false;
+  const char* reference         = nullptr;
+  const char* write_reference   = nullptr;
+  int tolerance                 = 0;
+  for( int a = 1; a < argc; ++a )
+  {
+    const std::string arg( argv[a] );
+    if( arg == "--record" )
+    {
+      record                    = true;
+    }
+    else if( arg == "--reference" && a + 1 < argc )
+    {
+      reference                 = argv[++a];
+    }
+    else if( arg == "--write-reference" && a + 1 < argc )
+    {
+      write_reference           = argv[++a];
+    }
+    else if( arg == "--tolerance" && a + 1 < argc )
+    {
+      tolerance                 = atoi( argv[++a] );
+    }
+    else
+    {
+      fprintf( stderr, "usage: %s [--record] [--write-reference <raw>] [--reference <raw> --tolerance <max deviation>]\n", argv[0] );
+      return 2;
+    }
+  }
+
+  if( load_patterns( "." ) == 0 )
+  {
+    fprintf( stderr, "no patterns, run from the root of the repo\n" );
+    return 2;
+  }
+  // with a recording on the card GOLDEN_AUDIO compares with it
+  if( reference != nullptr && !HOST_SIM::load_file( reference, "GOLDEN.RAW" ) )
+  {
+    fprintf( stderr, "can't read %s\n", reference );
+    return 2;
+  }
+
+  setup();
+  golden_audio.set_tolerance( tolerance );
+
+  // a generous limit, the run ends when GOLDEN_AUDIO has captured every block
+  const int max_blocks = ( 8 * GOLDEN_STEPS_PER_PATTERN + GOLDEN_TAIL_STEPS + 8 ) * GOLDEN_BLOCKS_PER_STEP;
+  for( int block = 0; block < max_blocks && !golden_audio.finished(); block += GOLDEN_BLOCKS_PER_STEP )
+  {
+    HOST_SIM::run_blocks( GOLDEN_BLOCKS_PER_STEP, loop );
+  }
+
+  int failures = 0;
+  check( golden_audio.finished(), "captured every block", failures );
+  check( golden_audio.passed(), reference != nullptr ? "within the tolerance of the reference" : "recorded without dropping blocks", failures );
+  check( audio_output.underruns() == 0, "no DAC underruns", failures );
+
+  if( reference == nullptr )
+  {
+    const std::vector<uint32_t> hashes = step_hashes();
+    if( record )
+    {
+      check( write_hashes( HASH_FILE_NAME, hashes ), "recorded golden_hashes.txt", failures );
+    }
+    else
+    {
+      const std::vector<uint32_t> golden = read_hashes( HASH_FILE_NAME );
+      size_t first_mismatch = 0;
+      while( first_mismatch < hashes.size() && first_mismatch < golden.size() && hashes[first_mismatch] == golden[first_mismatch] )
+      {
+        ++first_mismatch;
+      }
+      if( first_mismatch < hashes.size() || hashes.size() != golden.size() )
+      {
+        printf( "step %zu of %zu differs (pattern %zu step %zu), steps in golden_hashes.txt:%zu\n",
+                first_mismatch, hashes.size(), first_mismatch / GOLDEN_STEPS_PER_PATTERN + 1, first_mismatch % GOLDEN_STEPS_PER_PATTERN, golden.size() );
+      }
+      check( !hashes.empty() && hashes == golden, "every step matches golden_hashes.txt", failures );
+    }
+  }
+
+  if( write_reference != nullptr )
+  {
+    check( HOST_SIM::save_file( "GOLDEN.RAW", write_reference ), "wrote the reference", failures );
+  }
+
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+// with MEASURE_TRIGGER_LATENCY, plays a short kick on every trigger edge and checks the latency TRIGGER_LATENCY
+// measures for each edge matches when the kick's first sample actually leaves the simulated DAC. The edge runs
+// through the real path: notify_trigger(), CLOCK::on_edge(), PATTERN_SET::clock() and the voices.
+
+#include "HostTest.h"
+#include "sketch.h"
+
+namespace
+{
+  // only the kick, which has no reverb or delay send, gated so it's silent before the next edge
+  const char            KICK_PATTERN[]      = "@envelope=1,20,0\n{0,127}\n-\n-\n-\n-\n";
+  constexpr uint64_t    TRIGGER_PERIOD_NS   = 125000000;    // 16ths at 120bpm
+  constexpr uint64_t    FIRST_EDGE_NS       = 300000000;
+  constexpr int         NUM_EDGES           = 40;
+  constexpr int         LOCK_EDGES          = 4;            // the PLL's first few ticks aren't measured from the edge
+  constexpr uint64_t    ONSET_SEARCH_NS     = 60000000;
+  constexpr int32_t     MAX_DIFFERENCE_US   = 50;           // a couple of samples, the attack may round to 0 in the mix
+}
+
+int main()
+{
+  write_card_file( "p1.txt", KICK_PATTERN );
+
+  for( int e = 0; e < NUM_EDGES; ++e )
+  {
+    HOST_SIM::add_edge( FIRST_EDGE_NS + e * TRIGGER_PERIOD_NS );
+  }
+
+  setup();
+
+  int failures              = 0;
+  int compared              = 0;
+  int32_t max_difference_us = 0;
+  uint64_t total_dac_us     = 0;
+  for( int e = 0; e < NUM_EDGES; ++e )
+  {
+    const uint64_t edge_ns  = FIRST_EDGE_NS + e * TRIGGER_PERIOD_NS;
+    HOST_SIM::run_until( edge_ns + ONSET_SEARCH_NS, loop );
+    const uint32_t measured_us = TRIGGER_LATENCY::take_last_us();
+    const int64_t onset     = first_sound( audio_output, edge_ns, ONSET_SEARCH_NS );
+    const uint64_t dac_ns   = onset >= 0 ? audio_output.sample_time_ns( onset ) : 0;
+    if( e < LOCK_EDGES )
+    {
+      continue;
+    }
+
+    const int32_t dac_us    = dac_ns > 0 ? static_cast<int32_t>( ( dac_ns - edge_ns ) / 1000 ) : -1;
+    const int32_t difference_us = abs( dac_us - static_cast<int32_t>( measured_us ) );
+    if( measured_us == 0 || dac_ns == 0 || difference_us > MAX_DIFFERENCE_US )
+    {
+      printf( "edge %d: measured %uus, heard %dus after the edge\n", e, measured_us, dac_us );
+      ++failures;
+      continue;
+    }
+    ++compared;
+    total_dac_us           += dac_us;
+    max_difference_us       = std::max( max_difference_us, difference_us );
+  }
+
+  printf( "edges compared:%d average edge->DAC:%uus max difference:%dus (output latency %dus)\n",
+          compared, compared > 0 ? static_cast<uint32_t>( total_dac_us / compared ) : 0, max_difference_us, AUDIO_CLOCK::OUTPUT_LATENCY_US );
+  check( compared == NUM_EDGES - LOCK_EDGES, "every edge's measured latency matches when it was heard", failures );
+
+  return failures == 0 ? 0 : 1;
+}
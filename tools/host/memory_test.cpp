@@ -0,0 +1,37 @@
+// with SIZE_AUDIO_MEMORY, runs the sketch's sizing mode, every drum hit every few milliseconds with the delay
+// line off, and checks AUDIO_GRAPH_BLOCKS is the pool's peak plus AUDIO_GRAPH_MARGIN_BLOCKS with no
+// allocation ever failing. The pool, connections and update order are the library's, so the peak should be
+// the module's too (the reverb is a model, but like the library's it holds no blocks between updates), a run
+// on the module is still the final word.
+
+#include "HostTest.h"
+#include "sketch.h"
+
+namespace
+{
+  constexpr uint64_t    RUN_NS              = 10000000000ull; // the sizing mode's report each second, 10 of them
+  constexpr int         NUM_DRUMS           = 5;
+  constexpr uint32_t    OLD_DELAY_TIME_MS   = 175;
+
+  // MAX_DELAY_TIME_MS without SIZE_AUDIO_MEMORY
+  constexpr uint32_t    DELAY_TIME_MS       = ( ( AUDIO_MEMORY_BLOCKS - AUDIO_GRAPH_BLOCKS - 1 ) * AUDIO_BLOCK_SAMPLES * 1000.0f ) / AUDIO_SAMPLE_RATE_EXACT;
+}
+
+int main()
+{
+  setup();
+
+  HOST_SIM::run_until( HOST_SIM::now_ns() + RUN_NS, loop );
+
+  const int peak_blocks     = AudioMemoryUsageMax();
+  printf( "peak blocks:%d recommended AUDIO_GRAPH_BLOCKS:%d (is %d) allocation failures:%u delay:%ums\n",
+          peak_blocks, peak_blocks + AUDIO_GRAPH_MARGIN_BLOCKS, AUDIO_GRAPH_BLOCKS, AudioStream::allocation_failures, DELAY_TIME_MS );
+
+  int failures = 0;
+  check( AudioStream::allocation_failures == 0, "no block allocation failed", failures );
+  check( peak_blocks >= NUM_DRUMS * DRUM::num_voices_per_drum(), "every voice was playing", failures );
+  check( peak_blocks + AUDIO_GRAPH_MARGIN_BLOCKS == AUDIO_GRAPH_BLOCKS, "AUDIO_GRAPH_BLOCKS is the peak plus the margin", failures );
+  check( DELAY_TIME_MS >= OLD_DELAY_TIME_MS, "the delay is no shorter than before it was sized", failures );
+
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+// plays a short kick from a steady trigger that drifts across the audio blocks, and measures the jitter of
+// when each kick is heard after its edge. Voices start at the trigger's sample offset within the block, and
+// the test compares them with starting at the beginning of the block, as they did before the offsets.
+
+#include <cmath>
+
+#include "HostTest.h"
+#include "sketch.h"
+
+namespace
+{
+  // only the kick, which has no reverb or delay send, gated so it's silent before the next edge
+  const char            KICK_PATTERN[]      = "@envelope=1,20,0\n{0,127}\n-\n-\n-\n-\n";
+  constexpr uint64_t    TRIGGER_PERIOD_NS   = 125000000;    // 43.07 blocks, so the edges drift through every part of a block
+  constexpr uint64_t    FIRST_EDGE_NS       = 300000000;
+  constexpr int         NUM_EDGES           = 64;
+  constexpr int         LOCK_EDGES          = 4;            // the PLL's first few ticks aren't at the edge
+  constexpr uint64_t    ONSET_SEARCH_NS     = 60000000;
+  constexpr double      MAX_JITTER_US       = 50.0;         // peak to peak, a couple of samples
+
+  struct JITTER
+  {
+    double              m_min_us            = 1.0e9;
+    double              m_max_us            = 0.0;
+    double              m_sum_us            = 0.0;
+    double              m_sum_squared_us    = 0.0;
+    int                 m_count             = 0;
+
+    void                add( double latency_us )
+    {
+      m_min_us          = std::min( m_min_us, latency_us );
+      m_max_us          = std::max( m_max_us, latency_us );
+      m_sum_us         += latency_us;
+      m_sum_squared_us += latency_us * latency_us;
+      ++m_count;
+    }
+
+    double              peak_to_peak_us() const   { return m_max_us - m_min_us; }
+    double              std_dev_us() const
+    {
+      const double mean = m_sum_us / m_count;
+      return sqrt( std::max( m_sum_squared_us / m_count - mean * mean, 0.0 ) );
+    }
+
+    void                print( const char* name ) const
+    {
+      printf( "%s: mean %.0fus, peak to peak %.0fus, std dev %.1fus\n", name, m_sum_us / m_count, peak_to_peak_us(), std_dev_us() );
+    }
+  };
+}
+
+int main()
+{
+  write_card_file( "p1.txt", KICK_PATTERN );
+
+  for( int e = 0; e < NUM_EDGES; ++e )
+  {
+    HOST_SIM::add_edge( FIRST_EDGE_NS + e * TRIGGER_PERIOD_NS );
+  }
+
+  setup();
+
+  int failures = 0;
+  JITTER sample_offset;
+  JITTER block_start;
+  for( int e = 0; e < NUM_EDGES; ++e )
+  {
+    const uint64_t edge_ns  = FIRST_EDGE_NS + e * TRIGGER_PERIOD_NS;
+    HOST_SIM::run_until( edge_ns + ONSET_SEARCH_NS, loop );
+    const int64_t onset     = first_sound( audio_output, edge_ns, ONSET_SEARCH_NS );
+    if( e < LOCK_EDGES )
+    {
+      continue;
+    }
+    if( onset < 0 )
+    {
+      printf( "edge %d: not heard\n", e );
+      ++failures;
+      continue;
+    }
+
+    // without the offset the voice starts at the beginning of the same block
+    const int64_t block_start_onset = onset - onset % AUDIO_BLOCK_SAMPLES;
+    sample_offset.add( ( audio_output.sample_time_ns( onset ) - edge_ns ) / 1000.0 );
+    block_start.add( ( audio_output.sample_time_ns( block_start_onset ) - edge_ns ) / 1000.0 );
+  }
+
+  block_start.print( "started at the block" );
+  sample_offset.print( "started at the sample offset" );
+  check( sample_offset.m_count == NUM_EDGES - LOCK_EDGES, "every edge was heard", failures );
+  check( sample_offset.peak_to_peak_us() <= MAX_JITTER_US, "onset jitter within a couple of samples", failures );
+  check( block_start.peak_to_peak_us() > AUDIO_CLOCK::BLOCK_DURATION_US / 2, "the edges drifted across the blocks", failures );
+
+  return failures == 0 ? 0 : 1;
+}
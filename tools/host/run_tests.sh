@@ -0,0 +1,33 @@
+#!/bin/sh
+# builds the sketch on the host against the stand-ins in this directory and runs each test against it,
+# from any directory. Pass test names to run only those, e.g. tools/host/run_tests.sh golden_test
+set -e
+
+cd "$(dirname "$0")/../.."
+CXX=${CXX:-g++}
+BUILD_DIR=${BUILD_DIR:-/tmp/radiodrum_host_tests}
+mkdir -p "$BUILD_DIR"
+
+SOURCES="AudioClock.cpp AudioProfiler.cpp Clock.cpp Drum.cpp DspBenchmark.cpp GoldenAudio.cpp Kit.cpp SampleBank.cpp
+         SampleDecoder.cpp SamplePlayer.cpp SampleStream.cpp Song.cpp TimedSection.cpp TriggerLatency.cpp Util.cpp
+         tools/host/HostSim.cpp tools/host/HostAudio.cpp"
+
+# <test> <compile switches>
+TESTS="golden_test -DGOLDEN_AUDIO_TEST
+deadline_test -DINJECT_AUDIO_LOAD -DCLOCK_IN_AUDIO_UPDATE
+latency_test -DMEASURE_TRIGGER_LATENCY
+onset_jitter_test
+steal_test
+memory_test -DSIZE_AUDIO_MEMORY"
+
+failed=0
+echo "$TESTS" | while read -r test switches; do
+  if [ $# -gt 0 ] && ! echo " $* " | grep -q " $test "; then
+    continue
+  fi
+  echo "== $test"
+  $CXX -std=gnu++14 -O2 -Wall -Wno-unused-function -Itools/host -I. $switches -o "$BUILD_DIR/$test" tools/host/$test.cpp $SOURCES || exit 1
+  "$BUILD_DIR/$test" || exit 1
+done || failed=1
+
+exit $failed
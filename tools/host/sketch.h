@@ -0,0 +1,10 @@
+#pragma once
+
+// the whole sketch as one translation unit, as the Arduino build joins the .ino files.
+// Each test includes this once and builds it with the switches it needs.
+
+#include <Arduino.h>
+#include "HostSim.h"
+
+#include "../../RadioDrum.ino"
+#include "../../Interface.ino"
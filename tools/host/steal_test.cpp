@@ -0,0 +1,134 @@
+// plays fast rolls on the fire hit, whose long ring keeps both its voices busy so every hit from the third on
+// steals one, and measures the click where each stolen sound ends. The same rolls are played twice, once as
+// the sketch plays them, fading the stolen sound out, and once stopping the stolen voice dead first, as it did
+// before the fade. The click is the energy of the output's second difference over the fade, where the new hit
+// hasn't started yet, so only the end of the stolen sound and the other voice are heard.
+
+#include <cmath>
+#include <vector>
+
+#include "HostTest.h"
+#include "sketch.h"
+
+namespace
+{
+  constexpr int         ROLL_GAPS[]         = { 3, 5, 9 };  // blocks between hits, 8.7ms to 26ms
+  constexpr int         ROLL_HITS           = 16;
+  constexpr uint32_t    HIT_OFFSET_US       = 2000;         // into the block, so the new hit starts after the fade
+  constexpr int         SILENCE_BLOCKS      = 500;          // between rolls, longer than the fire hit
+  constexpr int         PITCH               = 12;           // the sample's own speed
+  constexpr size_t      FADE_SAMPLES        = 64;           // SAMPLE_PLAYER_EFFECT's fade
+  constexpr double      MIN_REDUCTION_DB    = 3.0;
+
+  struct ROLL
+  {
+    int                 m_gap_blocks        = 0;
+    bool                m_hard_cut          = false;
+    uint64_t            m_next_hit_block    = 0;
+    int                 m_hits              = 0;
+    std::vector<uint64_t> m_steal_blocks;                   // the blocks the stolen sounds end in
+  };
+
+  ROLL                  roll;
+  int                   next_voice          = 0;            // POLYPHONIC_SAMPLE_PLAYER's round robin
+
+  // in place of the sketch's loop(), nothing else plays
+  void play_roll()
+  {
+    if( roll.m_hits == ROLL_HITS || HOST_SIM::now_ns() < HOST_SIM::block_time_ns( roll.m_next_hit_block ) + HIT_OFFSET_US * 1000ull )
+    {
+      return;
+    }
+
+    AudioNoInterrupts();
+
+    // the voice the player will pick, the next free one or if none are free the next in turn
+    int voice = next_voice;
+    for( int vi = 0; vi < DRUM::num_voices_per_drum() && drum_5.voice( voice ).playing(); ++vi )
+    {
+      voice = ( voice + 1 ) % DRUM::num_voices_per_drum();
+    }
+    next_voice = ( voice + 1 ) % DRUM::num_voices_per_drum();
+
+    if( drum_5.voice( voice ).playing() )
+    {
+      // rendered by the next block's update
+      roll.m_steal_blocks.push_back( roll.m_next_hit_block + 1 );
+      if( roll.m_hard_cut )
+      {
+        drum_5.voice( voice ).stop();
+      }
+    }
+    drum_5.trigger( PITCH, 127, micros() );
+
+    AudioInterrupts();
+
+    ++roll.m_hits;
+    roll.m_next_hit_block  += roll.m_gap_blocks;
+  }
+
+  // energy of the second difference over the fade at the start of each steal block, in dB
+  double click_energy_db( const std::vector<uint64_t>& steal_blocks )
+  {
+    const std::vector<int16_t>& played = audio_output.played();
+    double energy           = 0.0;
+    for( uint64_t block : steal_blocks )
+    {
+      // a block rendered by one DMA interrupt's update is heard from the DMA interrupt 2 blocks later
+      const uint64_t heard_ns = HOST_SIM::block_time_ns( block + 2 );
+      size_t start          = 0;
+      while( start < played.size() && audio_output.sample_time_ns( start ) < heard_ns )
+      {
+        ++start;
+      }
+      for( size_t i = std::max<size_t>( start, 2 ); i < std::min( start + FADE_SAMPLES, played.size() ); ++i )
+      {
+        const double second_difference = played[i] - 2.0 * played[i - 1] + played[i - 2];
+        energy             += second_difference * second_difference;
+      }
+    }
+    return 10.0 * log10( std::max( energy, 1.0 ) );
+  }
+
+  // plays the roll and returns its click energy, and how many hits stole a voice
+  double play( int gap_blocks, bool hard_cut, int& steals )
+  {
+    roll                    = ROLL();
+    roll.m_gap_blocks       = gap_blocks;
+    roll.m_hard_cut         = hard_cut;
+    roll.m_next_hit_block   = static_cast<uint64_t>( HOST_SIM::now_ns() / HOST_SIM::block_time_ns( 1 ) ) + 2;
+
+    HOST_SIM::run_blocks( gap_blocks * ROLL_HITS + SILENCE_BLOCKS, play_roll );
+
+    steals                  = static_cast<int>( roll.m_steal_blocks.size() );
+    return click_energy_db( roll.m_steal_blocks );
+  }
+}
+
+int main()
+{
+  setup();
+
+  // dry, so the clicks aren't smeared by the reverb
+  reverb_mixer.set_gain( 4, 0.0f );
+
+  int failures = 0;
+  for( int gap_blocks : ROLL_GAPS )
+  {
+    int fade_steals         = 0;
+    int cut_steals          = 0;
+    const double fade_db    = play( gap_blocks, false, fade_steals );
+    const double cut_db     = play( gap_blocks, true, cut_steals );
+
+    printf( "hits %d blocks apart: %d steals, click energy cut %.1fdB faded %.1fdB, %.1fdB less\n",
+            gap_blocks, fade_steals, cut_db, fade_db, cut_db - fade_db );
+
+    char description[80];
+    snprintf( description, sizeof(description), "%d block roll steals voices", gap_blocks );
+    check( fade_steals >= ROLL_HITS - DRUM::num_voices_per_drum() && cut_steals == fade_steals, description, failures );
+    snprintf( description, sizeof(description), "%d block roll fades with less click energy than cutting", gap_blocks );
+    check( cut_db - fade_db >= MIN_REDUCTION_DB, description, failures );
+  }
+
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,1024 @@
+// kit_compiler - builds a packed sample bank for RadioDrum from a kit description and WAV files
+//
+// build:  g++ -std=c++14 -O2 -o kit_compiler kit_compiler.cpp
+// usage:  kit_compiler <kit description> <output directory>
+//         kit_compiler -sd <kit description> <kit file>
+//
+// The kit description has one sample per line, '#' starts a comment:
+//
+//   <name> <wav file> [options]
+//
+// options:
+//   trim=<dBFS>          remove leading and trailing audio quieter than this level
+//   normalise            scale so the peak is full scale
+//   rate=<hz>            resample to 44100, 22050 or 11025Hz (WAVs at other rates are resampled to 44100Hz)
+//   loop=<start>,<end>   loop points in samples (taken from the WAV 'smpl' chunk if present)
+//   encoding=<pcm16|ulaw|adpcm>  how the sample is stored, u-law is half and IMA ADPCM about a quarter the size of pcm16
+//   stream=<ms>          kit files only, keep this much of a pcm16 sample in RAM and stream the rest from the SD card
+//   drum=<name>          add this sample to an earlier sample's drum as another velocity layer or round robin
+//   velocity=<1-127>     lowest velocity the sample's layer plays at, samples with the same drum and velocity take turns
+//
+// Each sample is a drum of its own unless it has drum=. Drums with layers are only supported in the bank, not kit files.
+//
+// WAV paths are relative to the kit description. SampleBank.h and SampleBank.cpp are written to the output directory,
+// or with -sd a kit file to copy to the SD card and select with @kit= in a pattern file.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../SampleBankEntry.h"
+
+namespace
+{
+
+constexpr double PI                   = 3.14159265358979323846;
+constexpr int    RESAMPLE_ZERO_CROSSINGS = 16;
+constexpr int    VALUES_PER_LINE      = 16;
+
+/////////////////////////////////////////////////////
+
+struct SAMPLE_DESC
+{
+  std::string           m_name;
+  std::string           m_filename;
+  double                m_trim_db         = 0.0;
+  bool                  m_trim            = false;
+  bool                  m_normalise       = false;
+  int                   m_rate            = 0;      // 0 = keep the WAV rate
+  int                   m_encoding        = SAMPLE_FORMAT_PCM_16;
+  int                   m_stream_ms       = -1;     // -1 = not streamed
+  int64_t               m_loop_start      = -1;
+  int64_t               m_loop_end        = -1;
+  std::string           m_drum;                     // empty for a drum of its own
+  int                   m_min_velocity    = 0;
+};
+
+struct WAV
+{
+  int                   m_rate            = 0;
+  std::vector<float>    m_samples;                  // mono, [-1,1]
+  int64_t               m_loop_start      = -1;
+  int64_t               m_loop_end        = -1;
+};
+
+struct COMPILED_SAMPLE
+{
+  SAMPLE_DESC           m_desc;
+  int                   m_rate            = 0;
+  std::vector<int16_t>  m_data;                     // as the player will decode it
+  std::vector<int16_t>  m_encoded;                  // what goes in the bank
+  uint32_t              m_resident_length = 0;      // samples not streamed
+  uint32_t              m_resident_words  = 0;      // of m_encoded
+  double                m_snr_db          = 0.0;    // of the encoding
+  int16_t               m_peak            = 0;
+  uint32_t              m_loop_start      = 0;
+  uint32_t              m_loop_end        = 0;
+  uint32_t              m_effective_end[EFFECTIVE_END_LEVELS] = {};
+  uint32_t              m_offset          = 0;      // in the bank
+  uint32_t              m_padding         = 0;      // zeros after the sample to keep the next one aligned
+};
+
+// the layers of a drum, each a list of samples played round robin
+struct DRUM_LAYERS
+{
+  std::string                       m_name;
+  std::vector<int>                  m_min_velocities;
+  std::vector<std::vector<size_t>>  m_layers;       // indices of the samples
+};
+
+constexpr int    SUPPORTED_RATES[]       = { 44100, 22050, 11025 };
+constexpr int    DEFAULT_RATE            = 44100;
+
+/////////////////////////////////////////////////////
+
+[[noreturn]] void fail( const std::string& message )
+{
+  std::cerr << "kit_compiler: " << message << std::endl;
+  exit( 1 );
+}
+
+uint32_t read_u32( const uint8_t* p )
+{
+  return p[0] | ( p[1] << 8 ) | ( p[2] << 16 ) | ( static_cast<uint32_t>( p[3] ) << 24 );
+}
+
+uint16_t read_u16( const uint8_t* p )
+{
+  return p[0] | ( p[1] << 8 );
+}
+
+WAV read_wav( const std::string& filename )
+{
+  std::ifstream file( filename, std::ios::binary );
+  if( !file )
+  {
+    fail( "unable to open " + filename );
+  }
+  const std::vector<uint8_t> bytes( ( std::istreambuf_iterator<char>( file ) ), std::istreambuf_iterator<char>() );
+
+  if( bytes.size() < 12 || memcmp( bytes.data(), "RIFF", 4 ) != 0 || memcmp( bytes.data() + 8, "WAVE", 4 ) != 0 )
+  {
+    fail( filename + " is not a WAV file" );
+  }
+
+  WAV wav;
+  int format          = 0;
+  int channels        = 0;
+  int bits            = 0;
+  const uint8_t* data = nullptr;
+  size_t data_size    = 0;
+
+  size_t pos = 12;
+  while( pos + 8 <= bytes.size() )
+  {
+    const uint8_t* chunk      = bytes.data() + pos;
+    const uint32_t chunk_size = read_u32( chunk + 4 );
+    const uint8_t* body       = chunk + 8;
+    if( pos + 8 + chunk_size > bytes.size() )
+    {
+      fail( filename + " has a truncated chunk" );
+    }
+
+    if( memcmp( chunk, "fmt ", 4 ) == 0 && chunk_size >= 16 )
+    {
+      format          = read_u16( body );
+      channels        = read_u16( body + 2 );
+      wav.m_rate      = read_u32( body + 4 );
+      bits            = read_u16( body + 14 );
+      if( format == 0xFFFE && chunk_size >= 26 )
+      {
+        // WAVE_FORMAT_EXTENSIBLE, the real format is the start of the sub format GUID
+        format        = read_u16( body + 24 );
+      }
+    }
+    else if( memcmp( chunk, "data", 4 ) == 0 )
+    {
+      data            = body;
+      data_size       = chunk_size;
+    }
+    else if( memcmp( chunk, "smpl", 4 ) == 0 && chunk_size >= 36 + 24 && read_u32( body + 28 ) > 0 )
+    {
+      wav.m_loop_start  = read_u32( body + 36 + 8 );
+      wav.m_loop_end    = read_u32( body + 36 + 12 ) + 1;   // smpl end is inclusive
+    }
+
+    pos += 8 + chunk_size + ( chunk_size & 1 );
+  }
+
+  if( data == nullptr || channels == 0 )
+  {
+    fail( filename + " has no audio" );
+  }
+  if( !( format == 1 && ( bits == 8 || bits == 16 || bits == 24 || bits == 32 ) ) && !( format == 3 && bits == 32 ) )
+  {
+    fail( filename + " must be 8/16/24/32 bit PCM or 32 bit float" );
+  }
+
+  const int bytes_per_sample  = bits / 8;
+  const size_t num_frames     = data_size / ( bytes_per_sample * channels );
+  wav.m_samples.resize( num_frames );
+
+  for( size_t f = 0; f < num_frames; ++f )
+  {
+    // mix down to mono
+    double sum = 0.0;
+    for( int c = 0; c < channels; ++c )
+    {
+      const uint8_t* s = data + ( ( f * channels ) + c ) * bytes_per_sample;
+      double value;
+      if( format == 3 )
+      {
+        float fv;
+        memcpy( &fv, s, sizeof(fv) );
+        value = fv;
+      }
+      else if( bits == 8 )
+      {
+        value = ( s[0] - 128 ) / 128.0;
+      }
+      else if( bits == 16 )
+      {
+        value = static_cast<int16_t>( read_u16( s ) ) / 32768.0;
+      }
+      else if( bits == 24 )
+      {
+        const int32_t v = static_cast<int32_t>( ( s[0] << 8 ) | ( s[1] << 16 ) | ( static_cast<uint32_t>( s[2] ) << 24 ) ) >> 8;
+        value = v / 8388608.0;
+      }
+      else
+      {
+        value = static_cast<int32_t>( read_u32( s ) ) / 2147483648.0;
+      }
+      sum += value;
+    }
+    wav.m_samples[f] = static_cast<float>( sum / channels );
+  }
+
+  return wav;
+}
+
+/////////////////////////////////////////////////////
+
+double sinc( double x )
+{
+  if( std::fabs( x ) < 1e-9 )
+  {
+    return 1.0;
+  }
+  return std::sin( PI * x ) / ( PI * x );
+}
+
+double blackman( double x )
+{
+  // x in [-1,1]
+  if( std::fabs( x ) >= 1.0 )
+  {
+    return 0.0;
+  }
+  const double t = ( x + 1.0 ) * 0.5;
+  return 0.42 - ( 0.5 * std::cos( 2.0 * PI * t ) ) + ( 0.08 * std::cos( 4.0 * PI * t ) );
+}
+
+// windowed sinc, with the cutoff lowered when downsampling to avoid aliasing
+std::vector<float> resample( const std::vector<float>& input, int input_rate, int output_rate )
+{
+  const double ratio        = static_cast<double>( output_rate ) / input_rate;
+  const double cutoff       = std::min( 1.0, ratio );
+  const double half_width   = RESAMPLE_ZERO_CROSSINGS / cutoff;
+  const size_t output_size  = static_cast<size_t>( std::ceil( input.size() * ratio ) );
+
+  std::vector<float> output( output_size );
+  for( size_t i = 0; i < output_size; ++i )
+  {
+    const double t      = i / ratio;
+    const int64_t first = static_cast<int64_t>( std::ceil( t - half_width ) );
+    const int64_t last  = static_cast<int64_t>( std::floor( t + half_width ) );
+
+    double sum = 0.0;
+    for( int64_t j = std::max<int64_t>( first, 0 ); j <= last && j < static_cast<int64_t>( input.size() ); ++j )
+    {
+      const double x = t - j;
+      sum += input[j] * cutoff * sinc( cutoff * x ) * blackman( x / half_width );
+    }
+    output[i] = static_cast<float>( sum );
+  }
+
+  return output;
+}
+
+/////////////////////////////////////////////////////
+
+int format_rate_code( int rate )
+{
+  for( int r = 0; r < static_cast<int>( sizeof(SUPPORTED_RATES) / sizeof(SUPPORTED_RATES[0]) ); ++r )
+  {
+    if( SUPPORTED_RATES[r] == rate )
+    {
+      return r + 1;
+    }
+  }
+  return 0;
+}
+
+/////////////////////////////////////////////////////
+
+// must match SampleDecoder.cpp
+constexpr int IMA_ADPCM_STEP_TABLE[89] = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+  130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060,
+  1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484,
+  7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+constexpr int IMA_ADPCM_INDEX_TABLE[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+struct IMA_ADPCM_ENCODER
+{
+  int32_t               m_predictor       = 0;
+  int                   m_step_index      = 0;
+
+  // returns the nibble, and updates the state exactly as the decoder will
+  int encode( int16_t target )
+  {
+    const int step  = IMA_ADPCM_STEP_TABLE[ m_step_index ];
+    int delta       = target - m_predictor;
+    int nibble      = 0;
+    if( delta < 0 )
+    {
+      nibble        = 8;
+      delta         = -delta;
+    }
+    if( delta >= step )
+    {
+      nibble       |= 4;
+      delta        -= step;
+    }
+    if( delta >= step >> 1 )
+    {
+      nibble       |= 2;
+      delta        -= step >> 1;
+    }
+    if( delta >= step >> 2 )
+    {
+      nibble       |= 1;
+    }
+
+    int diff        = step >> 3;
+    if( nibble & 1 )
+    {
+      diff         += step >> 2;
+    }
+    if( nibble & 2 )
+    {
+      diff         += step >> 1;
+    }
+    if( nibble & 4 )
+    {
+      diff         += step;
+    }
+    m_predictor     = ( nibble & 8 ) ? m_predictor - diff : m_predictor + diff;
+    m_predictor     = std::min( std::max( m_predictor, -32768 ), 32767 );
+    m_step_index    = std::min( std::max( m_step_index + IMA_ADPCM_INDEX_TABLE[ nibble ], 0 ), 88 );
+    return nibble;
+  }
+};
+
+// each block starts from the previous source sample, with the step size that encodes the block best
+std::vector<uint8_t> encode_ima_adpcm( std::vector<int16_t>& samples )
+{
+  std::vector<uint8_t> bytes;
+  for( size_t block_start = 0; block_start < samples.size(); block_start += IMA_ADPCM_BLOCK_SAMPLES )
+  {
+    const size_t block_end    = std::min( samples.size(), block_start + IMA_ADPCM_BLOCK_SAMPLES );
+    const int16_t predictor   = block_start > 0 ? samples[ block_start - 1 ] : 0;
+
+    int best_index            = 0;
+    double best_error         = -1.0;
+    for( int index = 0; index < 89; ++index )
+    {
+      IMA_ADPCM_ENCODER encoder;
+      encoder.m_predictor     = predictor;
+      encoder.m_step_index    = index;
+      double error            = 0.0;
+      for( size_t i = block_start; i < block_end; ++i )
+      {
+        encoder.encode( samples[i] );
+        const double e        = encoder.m_predictor - samples[i];
+        error                += e * e;
+      }
+      if( best_error < 0.0 || error < best_error )
+      {
+        best_error            = error;
+        best_index            = index;
+      }
+    }
+
+    bytes.push_back( static_cast<uint8_t>( predictor & 0xFF ) );
+    bytes.push_back( static_cast<uint8_t>( ( predictor >> 8 ) & 0xFF ) );
+    bytes.push_back( static_cast<uint8_t>( best_index ) );
+    bytes.push_back( 0 );
+
+    IMA_ADPCM_ENCODER encoder;
+    encoder.m_predictor       = predictor;
+    encoder.m_step_index      = best_index;
+    for( size_t i = block_start; i < block_end; ++i )
+    {
+      const int nibble        = encoder.encode( samples[i] );
+      if( ( i - block_start ) & 1 )
+      {
+        bytes.back()         |= nibble << 4;
+      }
+      else
+      {
+        bytes.push_back( static_cast<uint8_t>( nibble ) );
+      }
+      samples[i]              = static_cast<int16_t>( encoder.m_predictor );
+    }
+  }
+  return bytes;
+}
+
+int16_t decode_ulaw( uint8_t ulaw )
+{
+  ulaw                        = ~ulaw;
+  const int exponent          = ( ulaw >> 4 ) & 0x07;
+  const int magnitude         = ( ( ( ( ulaw & 0x0F ) << 3 ) + 0x84 ) << exponent ) - 0x84;
+  return static_cast<int16_t>( ( ulaw & 0x80 ) ? -magnitude : magnitude );
+}
+
+// G.711 u-law
+std::vector<uint8_t> encode_ulaw( std::vector<int16_t>& samples )
+{
+  constexpr int BIAS          = 0x84;
+  constexpr int CLIP          = 32635;
+
+  std::vector<uint8_t> bytes;
+  for( int16_t& sample : samples )
+  {
+    int magnitude             = std::min( std::abs( static_cast<int>( sample ) ), CLIP ) + BIAS;
+    const int sign            = sample < 0 ? 0x80 : 0x00;
+    int exponent              = 7;
+    while( exponent > 0 && ( magnitude & ( 0x4000 >> ( 7 - exponent ) ) ) == 0 )
+    {
+      --exponent;
+    }
+    const int mantissa        = ( magnitude >> ( exponent + 3 ) ) & 0x0F;
+    const uint8_t ulaw        = static_cast<uint8_t>( ~( sign | ( exponent << 4 ) | mantissa ) );
+    bytes.push_back( ulaw );
+    sample                    = decode_ulaw( ulaw );
+  }
+  return bytes;
+}
+
+// bank words, little endian like the target
+std::vector<int16_t> pack_words( const std::vector<uint8_t>& bytes )
+{
+  std::vector<int16_t> words( ( bytes.size() + 1 ) / 2 );
+  for( size_t i = 0; i < bytes.size(); ++i )
+  {
+    words[ i / 2 ]           |= static_cast<int16_t>( bytes[i] << ( ( i & 1 ) * 8 ) );
+  }
+  return words;
+}
+
+void encode( COMPILED_SAMPLE& sample )
+{
+  const std::vector<int16_t> original = sample.m_data;
+
+  if( sample.m_desc.m_encoding == SAMPLE_FORMAT_ULAW )
+  {
+    sample.m_encoded          = pack_words( encode_ulaw( sample.m_data ) );
+  }
+  else if( sample.m_desc.m_encoding == SAMPLE_FORMAT_IMA_ADPCM )
+  {
+    sample.m_encoded          = pack_words( encode_ima_adpcm( sample.m_data ) );
+  }
+  else
+  {
+    sample.m_encoded          = sample.m_data;
+  }
+
+  double signal               = 0.0;
+  double noise                = 0.0;
+  for( size_t i = 0; i < original.size(); ++i )
+  {
+    const double error        = sample.m_data[i] - original[i];
+    signal                   += static_cast<double>( original[i] ) * original[i];
+    noise                    += error * error;
+  }
+  sample.m_snr_db             = noise > 0.0 ? 10.0 * std::log10( signal / noise ) : 0.0;
+}
+
+/////////////////////////////////////////////////////
+
+COMPILED_SAMPLE compile_sample( const SAMPLE_DESC& desc, const std::string& base_dir )
+{
+  WAV wav = read_wav( base_dir + desc.m_filename );
+
+  COMPILED_SAMPLE sample;
+  sample.m_desc           = desc;
+  sample.m_rate           = desc.m_rate > 0 ? desc.m_rate : ( format_rate_code( wav.m_rate ) != 0 ? wav.m_rate : DEFAULT_RATE );
+
+  double loop_start       = desc.m_loop_start >= 0 ? desc.m_loop_start : wav.m_loop_start;
+  double loop_end         = desc.m_loop_end >= 0 ? desc.m_loop_end : wav.m_loop_end;
+
+  std::vector<float> samples = std::move( wav.m_samples );
+
+  if( sample.m_rate != wav.m_rate )
+  {
+    samples               = resample( samples, wav.m_rate, sample.m_rate );
+    const double ratio    = static_cast<double>( sample.m_rate ) / wav.m_rate;
+    loop_start           *= ratio;
+    loop_end             *= ratio;
+  }
+
+  if( desc.m_trim )
+  {
+    const float threshold = static_cast<float>( std::pow( 10.0, desc.m_trim_db / 20.0 ) );
+    auto audible          = [threshold]( float s ) { return std::fabs( s ) > threshold; };
+
+    const auto first      = std::find_if( samples.begin(), samples.end(), audible );
+    const auto last       = std::find_if( samples.rbegin(), samples.rend(), audible ).base();
+    const int64_t removed = first - samples.begin();
+    if( first < last )
+    {
+      samples             = std::vector<float>( first, last );
+    }
+    else
+    {
+      samples.clear();
+    }
+    loop_start           -= removed;
+    loop_end             -= removed;
+  }
+
+  if( desc.m_normalise )
+  {
+    float peak = 0.0f;
+    for( float s : samples )
+    {
+      peak                = std::max( peak, std::fabs( s ) );
+    }
+    if( peak > 0.0f )
+    {
+      for( float& s : samples )
+      {
+        s                /= peak;
+      }
+    }
+  }
+
+  sample.m_data.resize( samples.size() );
+  for( size_t i = 0; i < samples.size(); ++i )
+  {
+    const long value      = std::lround( samples[i] * 32767.0f );
+    sample.m_data[i]      = static_cast<int16_t>( std::min<long>( std::max<long>( value, -32768 ), 32767 ) );
+  }
+
+  encode( sample );
+
+  sample.m_resident_length  = static_cast<uint32_t>( sample.m_data.size() );
+  sample.m_resident_words   = static_cast<uint32_t>( sample.m_encoded.size() );
+  if( desc.m_stream_ms >= 0 )
+  {
+    if( desc.m_encoding != SAMPLE_FORMAT_PCM_16 )
+    {
+      fail( desc.m_name + " must be pcm16 to be streamed" );
+    }
+    sample.m_resident_length  = std::min<uint32_t>( sample.m_resident_length, static_cast<uint32_t>( std::lround( desc.m_stream_ms * sample.m_rate / 1000.0 ) ) );
+    sample.m_resident_words   = sample.m_resident_length;
+  }
+
+  for( int16_t s : sample.m_data )
+  {
+    sample.m_peak         = std::max<int16_t>( sample.m_peak, static_cast<int16_t>( std::min( std::abs( static_cast<int>( s ) ), 32767 ) ) );
+  }
+
+  // where the rest of the sample is inaudible at each gain level, so the voice can stop early
+  for( int level = 0; level < EFFECTIVE_END_LEVELS; ++level )
+  {
+    const int threshold   = EFFECTIVE_END_THRESHOLD << level;
+    for( size_t i = sample.m_data.size(); i > 0; --i )
+    {
+      if( std::abs( static_cast<int>( sample.m_data[i - 1] ) ) >= threshold )
+      {
+        sample.m_effective_end[level] = static_cast<uint32_t>( i );
+        break;
+      }
+    }
+  }
+
+  // no loop is start == end == length
+  const uint32_t length   = static_cast<uint32_t>( sample.m_data.size() );
+  if( loop_start >= 0.0 && loop_end > loop_start )
+  {
+    sample.m_loop_start   = static_cast<uint32_t>( std::min<double>( std::lround( loop_start ), length ) );
+    sample.m_loop_end     = static_cast<uint32_t>( std::min<double>( std::lround( loop_end ), length ) );
+  }
+  else
+  {
+    sample.m_loop_start   = length;
+    sample.m_loop_end     = length;
+  }
+
+  return sample;
+}
+
+/////////////////////////////////////////////////////
+
+std::vector<SAMPLE_DESC> read_kit( const std::string& filename )
+{
+  std::ifstream file( filename );
+  if( !file )
+  {
+    fail( "unable to open " + filename );
+  }
+
+  std::vector<SAMPLE_DESC> descs;
+  std::string line;
+  int line_number = 0;
+  while( std::getline( file, line ) )
+  {
+    ++line_number;
+    line = line.substr( 0, line.find( '#' ) );
+
+    std::istringstream fields( line );
+    SAMPLE_DESC desc;
+    if( !( fields >> desc.m_name ) )
+    {
+      continue;
+    }
+    if( !( fields >> desc.m_filename ) )
+    {
+      fail( filename + ":" + std::to_string( line_number ) + " missing WAV file" );
+    }
+
+    std::string option;
+    while( fields >> option )
+    {
+      const size_t equals     = option.find( '=' );
+      const std::string key   = option.substr( 0, equals );
+      const std::string value = equals != std::string::npos ? option.substr( equals + 1 ) : "";
+
+      if( key == "trim" )
+      {
+        desc.m_trim           = true;
+        desc.m_trim_db        = value.empty() ? -90.0 : atof( value.c_str() );
+      }
+      else if( key == "normalise" || key == "normalize" )
+      {
+        desc.m_normalise      = true;
+      }
+      else if( key == "rate" )
+      {
+        desc.m_rate           = atoi( value.c_str() );
+        if( format_rate_code( desc.m_rate ) == 0 )
+        {
+          fail( filename + ":" + std::to_string( line_number ) + " rate must be 44100, 22050 or 11025" );
+        }
+      }
+      else if( key == "loop" && value.find( ',' ) != std::string::npos )
+      {
+        desc.m_loop_start     = atoll( value.c_str() );
+        desc.m_loop_end       = atoll( value.c_str() + value.find( ',' ) + 1 );
+      }
+      else if( key == "stream" && !value.empty() )
+      {
+        desc.m_stream_ms      = atoi( value.c_str() );
+      }
+      else if( key == "encoding" && ( value == "pcm16" || value == "ulaw" || value == "adpcm" ) )
+      {
+        desc.m_encoding       = value == "ulaw" ? SAMPLE_FORMAT_ULAW : value == "adpcm" ? SAMPLE_FORMAT_IMA_ADPCM : SAMPLE_FORMAT_PCM_16;
+      }
+      else if( key == "drum" && !value.empty() )
+      {
+        desc.m_drum           = value;
+      }
+      else if( key == "velocity" && atoi( value.c_str() ) >= 1 && atoi( value.c_str() ) <= 127 )
+      {
+        desc.m_min_velocity   = atoi( value.c_str() );
+      }
+      else
+      {
+        fail( filename + ":" + std::to_string( line_number ) + " unknown option " + option );
+      }
+    }
+
+    descs.push_back( desc );
+  }
+
+  return descs;
+}
+
+std::string identifier( const std::string& name )
+{
+  std::string id;
+  for( char c : name )
+  {
+    id += isalnum( static_cast<unsigned char>( c ) ) ? static_cast<char>( toupper( c ) ) : '_';
+  }
+  return id;
+}
+
+// groups the samples into drums, with their layers in order of velocity
+std::vector<DRUM_LAYERS> group_drums( const std::vector<COMPILED_SAMPLE>& samples )
+{
+  std::vector<DRUM_LAYERS> drums;
+  for( size_t si = 0; si < samples.size(); ++si )
+  {
+    const SAMPLE_DESC& desc     = samples[si].m_desc;
+    const std::string name      = desc.m_drum.empty() ? desc.m_name : desc.m_drum;
+    auto drum = std::find_if( drums.begin(), drums.end(), [&name]( const DRUM_LAYERS& d ) { return d.m_name == name; } );
+    if( drum == drums.end() )
+    {
+      if( !desc.m_drum.empty() )
+      {
+        fail( desc.m_name + " is a layer of " + desc.m_drum + " which isn't an earlier sample" );
+      }
+      drums.push_back( DRUM_LAYERS() );
+      drum                      = drums.end() - 1;
+      drum->m_name              = name;
+    }
+
+    auto velocity = std::lower_bound( drum->m_min_velocities.begin(), drum->m_min_velocities.end(), desc.m_min_velocity );
+    const size_t layer          = velocity - drum->m_min_velocities.begin();
+    if( velocity == drum->m_min_velocities.end() || *velocity != desc.m_min_velocity )
+    {
+      drum->m_min_velocities.insert( velocity, desc.m_min_velocity );
+      drum->m_layers.insert( drum->m_layers.begin() + layer, std::vector<size_t>() );
+    }
+    drum->m_layers[layer].push_back( si );
+
+    if( drum->m_layers.size() > MAX_VELOCITY_LAYERS || drum->m_layers[layer].size() > 255 )
+    {
+      fail( "too many layers or round robin samples in " + name );
+    }
+  }
+
+  return drums;
+}
+
+const char* encoding_name( int encoding )
+{
+  return encoding == SAMPLE_FORMAT_ULAW ? "ulaw" : encoding == SAMPLE_FORMAT_IMA_ADPCM ? "adpcm" : "pcm16";
+}
+
+// flash used by each sample, and its compression ratio against 16 bit at 44.1kHz
+std::string memory_report( const std::vector<COMPILED_SAMPLE>& samples, const std::string& kit_name )
+{
+  std::ostringstream report;
+  char line[256];
+  snprintf( line, sizeof(line), "kit %s\n", kit_name.c_str() );
+  report << line;
+  snprintf( line, sizeof(line), "%-16s %-8s %8s %7s %9s %11s %7s %7s\n", "name", "encoding", "samples", "rate", "bytes", "44.1k bytes", "ratio", "snr dB" );
+  report << line;
+
+  size_t total_bytes           = 0;
+  size_t total_full_rate_bytes = 0;
+  for( const COMPILED_SAMPLE& sample : samples )
+  {
+    const size_t bytes            = sample.m_encoded.size() * sizeof(int16_t);
+    const size_t full_rate_bytes  = static_cast<size_t>( std::ceil( sample.m_data.size() * static_cast<double>( DEFAULT_RATE ) / sample.m_rate ) ) * sizeof(int16_t);
+    total_bytes                  += bytes;
+    total_full_rate_bytes        += full_rate_bytes;
+    const std::string snr         = sample.m_desc.m_encoding == SAMPLE_FORMAT_PCM_16 ? "-" : std::to_string( static_cast<int>( std::lround( sample.m_snr_db ) ) );
+    snprintf( line, sizeof(line), "%-16s %-8s %8zu %7d %9zu %11zu %6.1f:1 %7s\n", sample.m_desc.m_name.c_str(), encoding_name( sample.m_desc.m_encoding ),
+              sample.m_data.size(), sample.m_rate, bytes, full_rate_bytes, static_cast<double>( full_rate_bytes ) / std::max<size_t>( bytes, 1 ), snr.c_str() );
+    report << line;
+  }
+  snprintf( line, sizeof(line), "%-16s %-8s %8s %7s %9zu %11zu %6.1f:1\n", "total", "", "", "", total_bytes, total_full_rate_bytes,
+            static_cast<double>( total_full_rate_bytes ) / std::max<size_t>( total_bytes, 1 ) );
+  report << line;
+
+  // what each drum's layers cost, to trade flash for realism
+  report << "\n";
+  snprintf( line, sizeof(line), "%-16s %6s %8s %9s\n", "drum", "layers", "samples", "bytes" );
+  report << line;
+  for( const DRUM_LAYERS& drum : group_drums( samples ) )
+  {
+    size_t num_samples  = 0;
+    size_t bytes        = 0;
+    for( const std::vector<size_t>& layer : drum.m_layers )
+    {
+      num_samples      += layer.size();
+      for( size_t si : layer )
+      {
+        bytes          += samples[si].m_encoded.size() * sizeof(int16_t);
+      }
+    }
+    snprintf( line, sizeof(line), "%-16s %6zu %8zu %9zu\n", drum.m_name.c_str(), drum.m_layers.size(), num_samples, bytes );
+    report << line;
+  }
+
+  return report.str();
+}
+
+std::string effective_ends( const COMPILED_SAMPLE& sample )
+{
+  std::string ends;
+  for( int level = 0; level < EFFECTIVE_END_LEVELS; ++level )
+  {
+    ends += ( level > 0 ? ", " : "" ) + std::to_string( sample.m_effective_end[level] );
+  }
+  return ends;
+}
+
+std::string commented( const std::string& text )
+{
+  std::istringstream lines( text );
+  std::string result;
+  std::string line;
+  while( std::getline( lines, line ) )
+  {
+    result += "// " + line + "\n";
+  }
+  return result;
+}
+
+void write_bank( const std::vector<COMPILED_SAMPLE>& samples, uint32_t total_words, const std::string& kit_name, const std::string& output_dir )
+{
+  const std::string report  = memory_report( samples, kit_name );
+  const std::string banner  = "// Sample bank generated by tools/kit_compiler from " + kit_name + ", do not edit\n";
+
+  for( const COMPILED_SAMPLE& sample : samples )
+  {
+    if( sample.m_desc.m_stream_ms >= 0 )
+    {
+      fail( sample.m_desc.m_name + " can only be streamed from a kit file" );
+    }
+  }
+
+  std::ofstream header( output_dir + "SampleBank.h" );
+  if( !header )
+  {
+    fail( "unable to write " + output_dir + "SampleBank.h" );
+  }
+
+  header << banner << "//\n" << commented( report ) << "\n";
+  header << "#pragma once\n\n#include \"SampleBankEntry.h\"\n\n";
+  header << "extern const int16_t SAMPLE_BANK_DATA[" << std::max<uint32_t>( total_words, 1 ) << "];\n\n";
+  header << "namespace SAMPLE_BANK\n{\n";
+  for( const COMPILED_SAMPLE& sample : samples )
+  {
+    char line[512];
+    snprintf( line, sizeof(line), "  constexpr SAMPLE_BANK_ENTRY %-16s = { SAMPLE_BANK_DATA + %u, %zu, %d, 0x%02X, %d, %u, %u, %zu, nullptr, 0, { %s } };\n",
+              identifier( sample.m_desc.m_name ).c_str(), sample.m_offset, sample.m_data.size(), sample.m_rate, sample.m_desc.m_encoding | format_rate_code( sample.m_rate ), sample.m_peak, sample.m_loop_start, sample.m_loop_end, sample.m_data.size(), effective_ends( sample ).c_str() );
+    header << line;
+  }
+
+  // each drum's velocity layers, and the samples each plays round robin
+  for( const DRUM_LAYERS& drum : group_drums( samples ) )
+  {
+    const std::string id  = identifier( drum.m_name );
+    header << "\n";
+    for( size_t li = 0; li < drum.m_layers.size(); ++li )
+    {
+      header << "  constexpr const SAMPLE_BANK_ENTRY* " << id << "_LAYER_" << li << "[] = { ";
+      for( size_t si = 0; si < drum.m_layers[li].size(); ++si )
+      {
+        header << ( si > 0 ? ", &" : "&" ) << identifier( samples[ drum.m_layers[li][si] ].m_desc.m_name );
+      }
+      header << " };\n";
+    }
+    header << "  constexpr SAMPLE_LAYER " << id << "_LAYERS[] = { ";
+    for( size_t li = 0; li < drum.m_layers.size(); ++li )
+    {
+      header << ( li > 0 ? ", " : "" ) << "{ " << id << "_LAYER_" << li << ", " << drum.m_layers[li].size() << ", " << drum.m_min_velocities[li] << " }";
+    }
+    header << " };\n";
+    header << "  constexpr DRUM_SAMPLES " << id << "_DRUM = { " << id << "_LAYERS, " << drum.m_layers.size() << " };\n";
+  }
+
+  header << "\n  constexpr const SAMPLE_BANK_ENTRY* ALL_SAMPLES[] = { ";
+  for( size_t si = 0; si < samples.size(); ++si )
+  {
+    header << ( si > 0 ? ", &" : "&" ) << identifier( samples[si].m_desc.m_name );
+  }
+  header << " };\n";
+  header << "\n  constexpr int NUM_ENTRIES = " << samples.size() << ";\n";
+  header << "}\n";
+
+  std::ofstream source( output_dir + "SampleBank.cpp" );
+  if( !source )
+  {
+    fail( "unable to write " + output_dir + "SampleBank.cpp" );
+  }
+
+  source << banner << "\n#include \"SampleBank.h\"\n\n";
+  source << "alignas(4) const int16_t SAMPLE_BANK_DATA[" << std::max<uint32_t>( total_words, 1 ) << "] = {\n";
+  for( const COMPILED_SAMPLE& sample : samples )
+  {
+    source << "// " << sample.m_desc.m_name << "\n";
+    for( size_t i = 0; i < sample.m_encoded.size(); ++i )
+    {
+      source << sample.m_encoded[i] << ( ( ( i + 1 ) % VALUES_PER_LINE == 0 || i + 1 == sample.m_encoded.size() ) ? ",\n" : "," );
+    }
+    for( uint32_t i = 0; i < sample.m_padding; ++i )
+    {
+      source << "0,\n";
+    }
+  }
+  source << "};\n";
+
+  std::cout << report;
+}
+
+void put_u16( std::vector<uint8_t>& bytes, size_t pos, uint32_t value )
+{
+  bytes[pos]     = static_cast<uint8_t>( value );
+  bytes[pos + 1] = static_cast<uint8_t>( value >> 8 );
+}
+
+void put_u32( std::vector<uint8_t>& bytes, size_t pos, uint32_t value )
+{
+  put_u16( bytes, pos, value & 0xFFFF );
+  put_u16( bytes, pos + 2, value >> 16 );
+}
+
+// see SampleBankEntry.h for the layout
+void write_sd_kit( const std::vector<COMPILED_SAMPLE>& samples, uint32_t total_words, const std::string& kit_name, const std::string& filename )
+{
+  if( SD_KIT_HEADER_BYTES + ( samples.size() * SD_KIT_ENTRY_BYTES ) > SD_KIT_SECTOR_BYTES )
+  {
+    fail( "too many samples for a kit file" );
+  }
+  for( const COMPILED_SAMPLE& sample : samples )
+  {
+    if( !sample.m_desc.m_drum.empty() )
+    {
+      fail( sample.m_desc.m_name + " is a layer, kit files have one sample per drum" );
+    }
+  }
+
+  const uint32_t data_bytes = total_words * sizeof(int16_t);
+  std::vector<uint8_t> bytes( SD_KIT_SECTOR_BYTES + data_bytes, 0 );
+  size_t streamed_bytes     = 0;
+  put_u32( bytes, 0, SD_KIT_MAGIC );
+  put_u16( bytes, 4, SD_KIT_VERSION );
+  put_u16( bytes, 6, static_cast<uint32_t>( samples.size() ) );
+  put_u32( bytes, 8, data_bytes );
+
+  size_t entry = SD_KIT_HEADER_BYTES;
+  for( const COMPILED_SAMPLE& sample : samples )
+  {
+    put_u32( bytes, entry, sample.m_offset * sizeof(int16_t) );
+    put_u32( bytes, entry + 4, static_cast<uint32_t>( sample.m_data.size() ) );
+    put_u32( bytes, entry + 8, sample.m_rate );
+    bytes[entry + 12] = static_cast<uint8_t>( sample.m_desc.m_encoding | format_rate_code( sample.m_rate ) );
+    put_u16( bytes, entry + 14, static_cast<uint16_t>( sample.m_peak ) );
+    put_u32( bytes, entry + 16, sample.m_loop_start );
+    put_u32( bytes, entry + 20, sample.m_loop_end );
+    put_u32( bytes, entry + 24, sample.m_resident_length );
+    for( int level = 0; level < EFFECTIVE_END_LEVELS; ++level )
+    {
+      put_u32( bytes, entry + 32 + ( level * 4 ), sample.m_effective_end[level] );
+    }
+
+    for( size_t w = 0; w < sample.m_resident_words; ++w )
+    {
+      put_u16( bytes, SD_KIT_SECTOR_BYTES + ( ( sample.m_offset + w ) * sizeof(int16_t) ), static_cast<uint16_t>( sample.m_encoded[w] ) );
+    }
+
+    // the streamed part goes after the resident data, starting on a sector
+    if( sample.m_resident_words < sample.m_encoded.size() )
+    {
+      const size_t stream_offset  = ( ( bytes.size() + SD_KIT_SECTOR_BYTES - 1 ) / SD_KIT_SECTOR_BYTES ) * SD_KIT_SECTOR_BYTES;
+      const size_t stream_words   = sample.m_encoded.size() - sample.m_resident_words;
+      bytes.resize( stream_offset + ( stream_words * sizeof(int16_t) ), 0 );
+      for( size_t w = 0; w < stream_words; ++w )
+      {
+        put_u16( bytes, stream_offset + ( w * sizeof(int16_t) ), static_cast<uint16_t>( sample.m_encoded[ sample.m_resident_words + w ] ) );
+      }
+      put_u32( bytes, entry + 28, static_cast<uint32_t>( stream_offset ) );
+      streamed_bytes             += stream_words * sizeof(int16_t);
+    }
+
+    entry += SD_KIT_ENTRY_BYTES;
+  }
+
+  std::ofstream file( filename, std::ios::binary );
+  if( !file || !file.write( reinterpret_cast<const char*>( bytes.data() ), bytes.size() ) )
+  {
+    fail( "unable to write " + filename );
+  }
+
+  std::cout << memory_report( samples, kit_name );
+  std::cout << "kit file " << bytes.size() << " bytes, needs " << data_bytes << " bytes of kit arena, " << streamed_bytes << " bytes streamed" << std::endl;
+}
+
+} // namespace
+
+int main( int argc, char** argv )
+{
+  const bool sd_kit = argc == 4 && strcmp( argv[1], "-sd" ) == 0;
+  if( argc != 3 && !sd_kit )
+  {
+    std::cerr << "usage: kit_compiler <kit description> <output directory>" << std::endl;
+    std::cerr << "       kit_compiler -sd <kit description> <kit file>" << std::endl;
+    return 1;
+  }
+
+  const std::string kit_filename  = argv[sd_kit ? 2 : 1];
+  const size_t slash              = kit_filename.find_last_of( '/' );
+  const std::string base_dir      = slash != std::string::npos ? kit_filename.substr( 0, slash + 1 ) : "";
+  const std::string kit_name      = slash != std::string::npos ? kit_filename.substr( slash + 1 ) : kit_filename;
+  std::string output              = argv[sd_kit ? 3 : 2];
+  if( !sd_kit && !output.empty() && output.back() != '/' )
+  {
+    output += '/';
+  }
+
+  std::vector<COMPILED_SAMPLE> samples;
+  uint32_t total_words = 0;
+  for( const SAMPLE_DESC& desc : read_kit( kit_filename ) )
+  {
+    COMPILED_SAMPLE sample  = compile_sample( desc, base_dir );
+    sample.m_offset         = total_words;
+    total_words            += sample.m_resident_words;
+
+    // keep every sample 4 byte aligned
+    sample.m_padding        = total_words & 1;
+    total_words            += sample.m_padding;
+    samples.push_back( std::move( sample ) );
+  }
+
+  if( sd_kit )
+  {
+    write_sd_kit( samples, total_words, kit_name, output );
+  }
+  else
+  {
+    write_bank( samples, total_words, kit_name, output );
+  }
+
+  return 0;
+}